@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -17,79 +17,350 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Buffers are found through NBUCKET hash chains keyed by
+// (dev, blockno), each with its own lock, so lookups of
+// different blocks do not contend.  Unreferenced buffers also
+// sit on an LRU list, protected by bcache.lock, from which
+// bget recycles.  Recycling is serialized by bcache.evictlock,
+// the only path that ever holds two bucket locks at once.
+// Lock order: evictlock, then bucket locks, then bcache.lock.
+//
+// Buffer data lives in kalloc() pages, BPERPAGE buffers to a
+// page.  The cache starts with BCACHEMIN buffers in static
+// pages, which it never gives up, and grows a page at a time on
+// misses while memory is plentiful (more than BCACHEMINFREE
+// free pages), up to NBUF buffers.  When kalloc() runs dry it
+// calls bshrink() to give back grown pages whose buffers are all
+// idle.  The static floor means bget() always has buffers to
+// recycle, however short of memory the system gets.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
+#include "proc.h"
 #include "fs.h"
 #include "buf.h"
 
+#define NBUCKET 1031
+#define BPERPAGE (PGSIZE/BSIZE)
+#define NBPAGE   (NBUF/BPERPAGE)
+#define NBFLOOR  ((BCACHEMIN+BPERPAGE-1)/BPERPAGE)  // static pages
+#define BHASH(dev, blockno) (((dev)*NBUCKET/2 + (blockno)) % NBUCKET)
+
+struct bucket {
+  struct spinlock lock;
+  struct buf *head;            // chain through b->hnext
+};
+
 struct {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct spinlock evictlock;
+  struct buf buf[NBUF];         // buf[i] uses page[i/BPERPAGE]
+  char *page[NBPAGE];
+  int npage;                    // pages currently in use
+  struct bucket bucket[NBUCKET];
 
-  // Linked list of all buffers, through prev/next.
+  // Linked list of unreferenced buffers, through prev/next.
   // head.next is most recently used.
   struct buf head;
 } bcache;
 
+// Pages of the buffers the cache always keeps: page[0..NBFLOOR-1].
+static char floorpage[NBFLOOR][PGSIZE] __attribute__((aligned(PGSIZE)));
+
+static int bgrow(char*);
+
 void
 binit(void)
 {
   struct buf *b;
+  struct bucket *bk;
+  int i;
 
   initlock(&bcache.lock, "bcache");
+  initlock(&bcache.evictlock, "bcache.evict");
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+    initlock(&bk->lock, "bcache.bucket");
 
 //PAGEBREAK!
-  // Create linked list of buffers
+  // The LRU list starts out with the static buffers; bgrow()
+  // adds more to it as pages are allocated.
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
   for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+    b->blockno = NOBLOCK;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
   }
+  for(i = 0; i < NBFLOOR; i++)
+    bgrow(floorpage[i]);
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
-static struct buf*
-bget(uint dev, uint blockno)
+// Back the buffers of an unused page slot with page pg and put
+// them at the cold end of the LRU list, ready for bvictim().
+// Returns 0 if the cache is already at its maximum size.
+// Caller holds bcache.evictlock.
+static int
+bgrow(char *pg)
 {
   struct buf *b;
+  int i;
 
+  for(i = 0; i < NBPAGE; i++)
+    if(bcache.page[i] == 0)
+      break;
+  if(i == NBPAGE)
+    return 0;
+  bcache.page[i] = pg;
+  bcache.npage++;
   acquire(&bcache.lock);
+  for(b = &bcache.buf[i*BPERPAGE]; b < &bcache.buf[(i+1)*BPERPAGE]; b++){
+    b->data = (uchar*)pg;
+    pg += BSIZE;
+    b->dev = 0;
+    b->blockno = NOBLOCK;
+    b->flags = 0;
+    b->refcnt = 0;
+    b->prev = bcache.head.prev;
+    b->next = &bcache.head;
+    bcache.head.prev->next = b;
+    bcache.head.prev = b;
+  }
+  release(&bcache.lock);
+  return 1;
+}
 
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+static struct bucket*
+bucketof(uint dev, uint blockno)
+{
+  return &bcache.bucket[BHASH(dev, blockno)];
+}
+
+// Take a reference to the cached copy of dev/blockno, if any.
+// Caller holds bk->lock.
+static struct buf*
+blookup(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext){
     if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+      if(b->refcnt++ == 0){
+        // No longer a candidate for recycling.
+        acquire(&bcache.lock);
+        b->next->prev = b->prev;
+        b->prev->next = b->next;
+        release(&bcache.lock);
+      }
       return b;
     }
   }
+  return 0;
+}
 
-  // Not cached; recycle some unused buffer and clean buffer
-  // "clean" because B_DIRTY and not locked means log.c
-  // hasn't yet committed the changes to the buffer.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
+// Take the least recently used clean, unreferenced buffer off
+// the LRU list and out of its hash chain.  Caller holds
+// bcache.evictlock, so no one else changes buffer identities.
+static struct buf*
+bvictim(void)
+{
+  struct buf *b, **pp;
+  struct bucket *bk;
+
+  for(;;){
+    // "clean" because B_DIRTY and not locked means log.c
+    // hasn't yet committed the changes to the buffer.
+    acquire(&bcache.lock);
+    for(b = bcache.head.prev; b != &bcache.head; b = b->prev)
+      if((b->flags & B_DIRTY) == 0)
+        break;
+    release(&bcache.lock);
+    if(b == &bcache.head)
+      panic("bget: no buffers");
+
+    // A lookup may have grabbed b since we let go of
+    // bcache.lock; check again under its bucket lock.
+    bk = bucketof(b->dev, b->blockno);
+    acquire(&bk->lock);
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+      for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+        if(*pp == b){
+          *pp = b->hnext;
+          break;
+        }
+      }
+      acquire(&bcache.lock);
+      b->next->prev = b->prev;
+      b->prev->next = b->next;
       release(&bcache.lock);
-      acquiresleep(&b->lock);
+      release(&bk->lock);
       return b;
     }
+    release(&bk->lock);
+  }
+}
+
+// Forget the block cached in b if nobody is using it, so that
+// its data page can be reused.  Caller holds bcache.evictlock.
+// Returns 0 if b is busy.
+static int
+bforget(struct buf *b)
+{
+  struct buf **pp;
+  struct bucket *bk;
+
+  bk = bucketof(b->dev, b->blockno);
+  acquire(&bk->lock);
+  if(b->refcnt != 0 || (b->flags & B_DIRTY)){
+    release(&bk->lock);
+    return 0;
+  }
+  for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+    if(*pp == b){
+      *pp = b->hnext;
+      break;
+    }
   }
-  panic("bget: no buffers");
+  b->blockno = NOBLOCK;
+  b->flags = 0;
+  release(&bk->lock);
+  return 1;
+}
+
+// Give up to n pages of idle buffers back to the page allocator.
+// Called by kalloc() when it runs out of memory, so it must not
+// be called with any bcache lock held.  Returns pages freed.
+int
+bshrink(int n)
+{
+  struct buf *b, *e;
+  char *freed[8];
+  int i, nfreed, idle;
+
+  nfreed = 0;
+  acquire(&bcache.evictlock);
+  for(i = NBFLOOR; i < NBPAGE && nfreed < n && nfreed < NELEM(freed); i++){
+    if(bcache.page[i] == 0)
+      continue;
+    e = &bcache.buf[(i+1)*BPERPAGE];
+    idle = 1;
+    for(b = &bcache.buf[i*BPERPAGE]; b < e && idle; b++)
+      idle = b->refcnt == 0 && (b->flags & B_DIRTY) == 0;
+    if(!idle)
+      continue;
+    for(b = &bcache.buf[i*BPERPAGE]; b < e; b++)
+      if(!bforget(b))
+        break;
+    if(b < e)
+      continue;   // raced with a lookup; the rest stay cached
+    acquire(&bcache.lock);
+    for(b = &bcache.buf[i*BPERPAGE]; b < e; b++){
+      b->next->prev = b->prev;
+      b->prev->next = b->next;
+      b->data = 0;
+    }
+    release(&bcache.lock);
+    freed[nfreed++] = bcache.page[i];
+    bcache.page[i] = 0;
+    bcache.npage--;
+  }
+  release(&bcache.evictlock);
+  for(i = 0; i < nfreed; i++)
+    kfree(freed[i]);
+  return nfreed;
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer and set *fresh.
+// In either case, return a referenced but unlocked buffer.
+static struct buf*
+bfind(uint dev, uint blockno, int *fresh)
+{
+  struct buf *b;
+  struct bucket *bk;
+  char *pg;
+
+  bk = bucketof(dev, blockno);
+  *fresh = 0;
+
+  // Is the block already cached?
+  acquire(&bk->lock);
+  b = blookup(bk, dev, blockno);
+  release(&bk->lock);
+  if(b)
+    return b;
+
+  // Not cached.  While the cache is below its maximum and
+  // memory is plentiful, grow it by a page rather than evict.
+  // kalloc() may call bshrink(), so allocate before locking.
+  pg = 0;
+  if(bcache.npage < NBPAGE && kfreepages() > BCACHEMINFREE)
+    pg = kalloc();
+
+  // Recycle some unused buffer.  Check again once we are the
+  // only recycler, in case another process brought the block
+  // in while we were not holding bk->lock.
+  acquire(&bcache.evictlock);
+  if(pg && bgrow(pg))
+    pg = 0;
+  acquire(&bk->lock);
+  b = blookup(bk, dev, blockno);
+  release(&bk->lock);
+  if(b == 0){
+    b = bvictim();
+    b->dev = dev;
+    b->blockno = blockno;
+    b->flags = 0;
+    b->refcnt = 1;
+    acquire(&bk->lock);
+    b->hnext = bk->head;
+    bk->head = b;
+    release(&bk->lock);
+    *fresh = 1;
+  }
+  release(&bcache.evictlock);
+  if(pg)
+    kfree(pg);
+  return b;
+}
+
+// Return locked buffer for block on device dev.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+  struct buf *b;
+  int fresh;
+
+  b = bfind(dev, blockno, &fresh);
+  acquiresleep(&b->lock);
+  return b;
+}
+
+// Drop a reference to b; the last one puts it on the MRU end
+// of the list of buffers that may be recycled.
+static void
+bput(struct buf *b)
+{
+  struct bucket *bk;
+
+  // b's identity cannot change while we hold a reference,
+  // so its bucket is stable.
+  bk = bucketof(b->dev, b->blockno);
+  acquire(&bk->lock);
+  b->refcnt--;
+  if (b->refcnt == 0) {
+    // no one is waiting for it.
+    acquire(&bcache.lock);
+    b->next = bcache.head.next;
+    b->prev = &bcache.head;
+    bcache.head.next->prev = b;
+    bcache.head.next = b;
+    release(&bcache.lock);
+  }
+  release(&bk->lock);
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -100,8 +371,10 @@ bread(uint dev, uint blockno)
 
   b = bget(dev, blockno);
   if(!(b->flags & B_VALID)) {
+    statinc(ST_BMISS);
     iderw(b);
-  }
+  } else
+    statinc(ST_BHIT);
   return b;
 }
 
@@ -115,6 +388,43 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Start reading a block into the cache without waiting for it.
+// Does nothing if the block is cached or already being read.
+// A buffer we just claimed is hashed and unlocked, so a bread()
+// of the same block may lock it first (making us sleep here) and
+// read it in; then there is nothing left to do.
+// ideintr() hands the buffer back through bdone().
+void
+breada(uint dev, uint blockno)
+{
+  struct buf *b;
+  int fresh;
+
+  b = bfind(dev, blockno, &fresh);
+  if(!fresh){
+    bput(b);
+    return;
+  }
+  acquiresleep(&b->lock);
+  if(b->flags & B_VALID){
+    releasesleep(&b->lock);
+    bput(b);
+    return;
+  }
+  b->flags |= B_ASYNC;
+  iderw(b);
+}
+
+// Finish an asynchronous read started by breada().
+// Called by the disk driver, possibly from an interrupt.
+void
+bdone(struct buf *b)
+{
+  b->flags &= ~B_ASYNC;
+  releasesleep(&b->lock);
+  bput(b);
+}
+
 // Release a locked buffer.
 // Move to the head of the MRU list.
 void
@@ -124,20 +434,21 @@ brelse(struct buf *b)
     panic("brelse");
 
   releasesleep(&b->lock);
+  bput(b);
+}
 
-  acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-  
-  release(&bcache.lock);
+// Forget every cached block nobody is using, so that the next
+// reads go to the disk.  Used to benchmark cold reads.
+void
+bdrop(void)
+{
+  struct buf *b;
+
+  acquire(&bcache.evictlock);
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++)
+    if(b->data)
+      bforget(b);
+  release(&bcache.evictlock);
 }
 //PAGEBREAK!
 // Blank page.
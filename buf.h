@@ -6,9 +6,13 @@ struct buf {
   uint refcnt;
   struct buf *prev; // LRU cache list
   struct buf *next;
+  struct buf *hnext; // hash chain
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  uint deadline;     // disk queue: serve by this tick (IOSCHED=DEADLINE)
+  uchar *data;       // BSIZE bytes in a kalloc page, 0 if unbacked
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // read-ahead: nobody waits, driver calls bdone()
+#define NOBLOCK (~0U) // blockno of a buffer that caches nothing yet
 
@@ -9,11 +9,17 @@ struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct traceev;
+struct callstat;
 
 // bio.c
+void            bdone(struct buf*);
+void            bdrop(void);
 void            binit(void);
+void            breada(uint, uint);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
+int             bshrink(int);
 void            bwrite(struct buf*);
 
 // console.c
@@ -36,10 +42,13 @@ int             filewrite(struct file*, char*, int n);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
+int             setreadahead(int);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+void            idenywrite(struct inode*);
+void            iallowwrite(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
@@ -57,6 +66,7 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            iderwv(struct buf**, int);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -65,7 +75,12 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+void            kdup(char*);
 void            kfree(char*);
+int             kfreepages(void);
+int             krefcnt(char*);
+int             kzeroidle(void);
+char*           kzalloc(void);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -91,6 +106,18 @@ void            end_op();
 extern int      ismp;
 void            mpinit(void);
 
+// pci.c
+int             pcifind(int, int, uint*);
+uint            pciread(uint, int);
+void            pciwrite(uint, int, uint);
+
+// pcache.c
+char*           pcget(uint, uint, uint);
+void            pcinit(void);
+void            pcinval(uint, uint);
+int             pcput(uint, uint, uint, char*);
+int             pcshrink(int);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -106,17 +133,32 @@ int             pipewrite(struct pipe*, char*, int);
 void            exit(void);
 int             fork(void);
 int             growproc(int);
+void            kthread(char*, void (*)(void));
 int             kill(int);
 void            pinit(void);
 void            procdump(void);
+struct proc*    procslot(int);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setnice(int, int);
+int             settrace(int, uint64, int);
+int             procstat(int, struct callstat*);
+int             timeslice(void);
+void            mlfqboost(void);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
 void            yield(void);
 
+// swap.c
+void            swapinit(int);
+int             swapalloc(void);
+void            swapdup(int);
+void            swapfree(int);
+void            swapread(int, char*);
+int             swapwait(void);
+
 // swtch.S
 void            swtch(struct context**, struct context*);
 
@@ -135,6 +177,10 @@ void             releasesleep(struct sleeplock*);
 int             holdingsleep(struct sleeplock*);
 void            initsleeplock(struct sleeplock*, char*);
 
+// stats.c
+void            statinc(int);
+void            statsinit(void);
+
 // string.c
 int             memcmp(const void*, const void*, uint);
 void*           memmove(void*, const void*, uint);
@@ -147,6 +193,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argptrw(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -155,6 +202,14 @@ void            syscall(void);
 // timer.c
 void            timerinit(void);
 
+// trace.c
+void            traceinit(void);
+void            traceput(int, int, int);
+int             tracedrain(struct traceev*, int);
+void            tracecount(int, int, uint64);
+void            tracereap(struct proc*);
+int             tracestat(int, struct callstat*);
+
 // trap.c
 void            idtinit(void);
 extern uint     ticks;
@@ -175,8 +230,11 @@ int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
+int             cowfault(pde_t*, uint);
+int             pgfault(uint, uint);
+int             uvmprefault(uint, uint, int);
+int             uvmswapout(pde_t*, uint, uint*, char**, int*, int);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
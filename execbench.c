@@ -0,0 +1,76 @@
+// Program startup benchmark.
+// Times fork+exec+exit+wait of each of a list of the installed
+// programs, run with arguments that make them exit at once, and
+// reports the average in microseconds.  Compare kernels built
+// with EXECDEMAND 1 (pages read in on first touch) and 0 (the
+// whole program read in by exec).
+// Output of the programs is thrown away: they run with stdout
+// and stderr closed.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NROUNDS 50
+
+char *progs[][4] = {
+  { "echo", 0 },
+  { "ls", "README", 0 },
+  { "wc", "README", 0 },
+  { "grep", "xyzzy", "README", 0 },
+  { "kill", 0 },
+  { "mkdir", 0 },
+  { "rm", 0 },
+  { "ln", 0 },
+  { "nice", 0 },
+  { "schedbench", 0 },
+};
+
+// Run argv rounds times; return elapsed ticks.
+int
+timeexec(char **argv, int rounds)
+{
+  int i, pid, t0;
+
+  t0 = uptime();
+  for(i = 0; i < rounds; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(2, "execbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      close(1);
+      close(2);
+      exec(argv[0], argv);
+      exit();
+    }
+    wait();
+  }
+  return uptime() - t0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, rounds, t;
+  struct stat st;
+
+  rounds = argc > 1 ? atoi(argv[1]) : NROUNDS;
+  if(rounds <= 0){
+    printf(2, "usage: execbench [rounds]\n");
+    exit();
+  }
+
+  for(i = 0; i < sizeof(progs)/sizeof(progs[0]); i++){
+    if(stat(progs[i][0], &st) < 0){
+      printf(1, "execbench: %s: not installed\n", progs[i][0]);
+      continue;
+    }
+    t = timeexec(progs[i], rounds);
+    // 100 ticks a second, so a tick is 10000 us.
+    printf(1, "execbench: %s (%d bytes): %d us per run\n",
+           progs[i][0], st.size, t * 10000 / rounds);
+  }
+  exit();
+}
@@ -16,6 +16,9 @@ struct inode {
   int ref;            // Reference count
   struct sleeplock lock;
   int flags;          // I_VALID
+  uint ranext;        // next block of a sequential read
+  uint raend;         // read-ahead issued up to here
+  int nexec;          // processes running it; writei() refuses then
 
   short type;         // copy of disk inode
   short major;
@@ -25,17 +28,17 @@ struct inode {
   uint addrs[NDIRECT+1];
 };
 #define I_VALID 0x2
+#define I_PCACHE 0x4  // the page cache may hold pages of this file
 
 // table mapping major device number to
 // device functions
 struct devsw {
-  int (*read)(struct inode*, char*, int);
+  int (*read)(struct inode*, char*, uint, int);  // inode, dst, off, n
   int (*write)(struct inode*, char*, int);
 };
 
 extern struct devsw devsw[];
 
-#define CONSOLE 1
 
 //PAGEBREAK!
 // Blank page.
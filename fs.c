@@ -14,8 +14,8 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
@@ -250,10 +250,15 @@ iget(uint dev, uint inum)
     panic("iget: no inodes");
 
   ip = empty;
+  if(ip->flags & I_PCACHE)
+    pcinval(ip->dev, ip->inum);  // a later write could not find them
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->flags = 0;
+  ip->nexec = 0;
+  ip->ranext = 0;
+  ip->raend = 0;
   release(&icache.lock);
 
   return ip;
@@ -270,6 +275,29 @@ idup(struct inode *ip)
   return ip;
 }
 
+// A process runs ip, paging its text in from the file (see
+// pagein()): until iallowwrite(), writei() refuses to change it,
+// like ETXTBSY on Unix.  The first caller for an inode (exec())
+// must hold ip->lock, so no write is half way through.
+void
+idenywrite(struct inode *ip)
+{
+  acquire(&icache.lock);
+  ip->nexec++;
+  release(&icache.lock);
+}
+
+// A process no longer runs ip.
+void
+iallowwrite(struct inode *ip)
+{
+  acquire(&icache.lock);
+  if(ip->nexec <= 0)
+    panic("iallowwrite");
+  ip->nexec--;
+  release(&icache.lock);
+}
+
 // Lock the given inode.
 // Reads the inode from disk if necessary.
 void
@@ -393,6 +421,11 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  if(ip->flags & I_PCACHE){
+    pcinval(ip->dev, ip->inum);
+    ip->flags &= ~I_PCACHE;
+  }
+
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -427,18 +460,55 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Blocks of read-ahead for sequential readers; 0 turns it off.
+static int rawindow = RAWINDOW;
+
+// Set the read-ahead window, returning the old one.
+int
+setreadahead(int n)
+{
+  int old;
+
+  old = rawindow;
+  if(n >= 0)
+    rawindow = n;
+  return old;
+}
+
+// Start reading the blocks a sequential reader of ip will want
+// after block bn, so the disk works while the caller copies.
+// The window is topped up only once half of it has been
+// consumed, so requests reach the disk queue in batches.
+// Caller must hold ip->lock.
+static void
+readahead(struct inode *ip, uint bn)
+{
+  uint b, end;
+
+  if(rawindow == 0 || ip->raend > bn + rawindow/2)
+    return;
+  end = bn + rawindow;
+  if(end > (ip->size + BSIZE - 1) / BSIZE)
+    end = (ip->size + BSIZE - 1) / BSIZE;  // bmap must not allocate
+  for(b = ip->raend > bn ? ip->raend : bn; b < end; b++)
+    breada(ip->dev, bmap(ip, b));
+  ip->raend = end;
+}
+
 //PAGEBREAK!
 // Read data from inode.
+// Caller must hold ip->lock.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, bn;
+  int seq;
   struct buf *bp;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
       return -1;
-    return devsw[ip->major].read(ip, dst, n);
+    return devsw[ip->major].read(ip, dst, off, n);
   }
 
   if(off > ip->size || off + n < off)
@@ -446,6 +516,13 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
+  // A read that starts where the last one stopped, or inside
+  // the block it stopped in, is sequential.
+  bn = off/BSIZE;
+  seq = bn == ip->ranext || bn + 1 == ip->ranext;
+  if(!seq)
+    ip->raend = 0;
+
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
@@ -459,6 +536,11 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
+  if(n > 0){
+    ip->ranext = (off + BSIZE - 1) / BSIZE;
+    if(seq)
+      readahead(ip, ip->ranext);
+  }
   return n;
 }
 
@@ -476,10 +558,16 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return devsw[ip->major].write(ip, src, n);
   }
 
+  if(ip->nexec > 0)
+    return -1;   // a process is running it
   if(off > ip->size || off + n < off)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(ip->flags & I_PCACHE){
+    pcinval(ip->dev, ip->inum);
+    ip->flags &= ~I_PCACHE;
+  }
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
@@ -1,14 +1,15 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code.  Transfers use the PCI controller's
+// bus-master DMA engine when there is one, and PIO otherwise.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
@@ -23,16 +24,54 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+
+// Bus-master IDE registers of the primary channel, at offsets
+// from the controller's BAR4.
+#define BM_CMD        0     // command
+#define BM_STATUS     2     // status; write 1s to clear ERR, INTR
+#define BM_PRDT       4     // physical address of the PRD table
+#define BM_START      0x01  // command: start the engine
+#define BM_READ       0x08  // command: transfer from disk to memory
+#define BM_ERR        0x02  // status: transfer failed
+#define BM_INTR       0x04  // status: device raised its interrupt
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+// Physical region descriptor: one piece of memory a DMA
+// transfer fills or drains.  The last entry has PRD_EOT set.
+struct prd {
+  uint addr;
+  ushort count;   // bytes
+  ushort flags;
+};
+#define PRD_EOT       0x8000
+
+// Requests wait on idepending, sorted by (dev, blockno).  The
+// scheduler takes a run of requests for consecutive blocks in
+// the same direction off it and starts them as one command;
+// idequeue points to the run's buf now being read/written, and
+// idequeue->qnext to the rest of the run.  With PIO the disk
+// interrupts once per block of the run, with DMA once per run.
+// You must hold idelock while manipulating either queue.
+//
+// The default scheduler is C-LOOK: runs are taken in ascending
+// order from where the last run ended, wrapping to the lowest
+// pending block.  'make IOSCHED=DEADLINE' adds deadlines: a
+// request that has waited longer than IDEREADEXPIRE (reads) or
+// IDEWRITEEXPIRE (writes) ticks is served next regardless.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static struct buf *idepending;
+static uint idedev, ideblock;  // where the last run ended
+
+// One PRD per buf of a run.  The table must not cross a 64K
+// boundary; a page-aligned one smaller than a page cannot.
+static ushort bmbase;   // bus-master registers, 0 for PIO
+static struct prd prdt[IDEMAXRUN] __attribute__((aligned(PGSIZE)));
 
 static int havedisk1;
-static void idestart(struct buf*);
+static void idestart(struct buf*, int);
 
 // Wait for IDE disk to become ready.
 static int
@@ -47,6 +86,25 @@ idewait(int checkerr)
   return 0;
 }
 
+// Find the PCI IDE controller and, if it can act as bus master,
+// switch transfers to DMA.
+static void
+idedmainit(void)
+{
+  uint tag, bar;
+
+  if(!IDEDMA || !pcifind(0x01, 0x01, &tag))  // mass storage, IDE
+    return;
+  if(!(pciread(tag, 0x08) & 0x8000))  // programming interface
+    return;                           // cannot do bus mastering
+  bar = pciread(tag, 0x20);           // BAR4
+  if(!(bar & 1) || (bar & ~3) == 0)   // not an assigned I/O range
+    return;
+  // Enable I/O space decoding and bus mastering.
+  pciwrite(tag, 0x04, (pciread(tag, 0x04) & 0xffff) | 0x5);
+  bmbase = bar & 0xfffc;
+}
+
 void
 ideinit(void)
 {
@@ -68,15 +126,21 @@ ideinit(void)
 
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  idedmainit();
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the run of n requests beginning with b.
+// Caller must hold idelock.
 static void
-idestart(struct buf *b)
+idestart(struct buf *b, int n)
 {
+  struct buf *p;
+  int i;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  if(b->blockno + n > DISKSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
@@ -84,15 +148,31 @@ idestart(struct buf *b)
   int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
   if (sector_per_block > 7) panic("idestart");
+  if (n * sector_per_block > 256) panic("idestart: run too long");
+
+  if(bmbase){
+    // Point the engine at the run's data pages.
+    for(i = 0, p = b; i < n; i++, p = p->qnext){
+      prdt[i].addr = V2P(p->data);
+      prdt[i].count = BSIZE;
+      prdt[i].flags = (i == n-1) ? PRD_EOT : 0;
+    }
+    outl(bmbase + BM_PRDT, V2P(prdt));
+    outb(bmbase + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_READ);
+    outb(bmbase + BM_STATUS, inb(bmbase + BM_STATUS) | BM_ERR | BM_INTR);
+  }
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, (n * sector_per_block) & 0xff);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(bmbase){
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(bmbase + BM_CMD, inb(bmbase + BM_CMD) | BM_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
     outsl(0x1f0, b->data, BSIZE/4);
   } else {
@@ -100,11 +180,89 @@ idestart(struct buf *b)
   }
 }
 
+// Does b come before block blockno of dev in sector order?
+static int
+idebefore(struct buf *b, uint dev, uint blockno)
+{
+  return b->dev < dev || (b->dev == dev && b->blockno < blockno);
+}
+
+#ifdef IODEADLINE
+// Return the link to the pending request whose deadline passed
+// longest ago, or 0 if none has expired.
+static struct buf**
+ideexpired(void)
+{
+  struct buf **pp, **old;
+
+  old = 0;
+  for(pp = &idepending; *pp; pp = &(*pp)->qnext)
+    if((int)(ticks - (*pp)->deadline) >= 0 &&
+       (old == 0 || (int)((*pp)->deadline - (*old)->deadline) < 0))
+      old = pp;
+  return old;
+}
+#endif
+
+// Take the next run of requests off idepending and start it.
+// Caller must hold idelock and the disk must be idle.
+static void
+idedispatch(void)
+{
+  struct buf **pp, *b, *last;
+  int n;
+
+  if(idepending == 0)
+    return;
+  pp = 0;
+#ifdef IODEADLINE
+  pp = ideexpired();
+#endif
+  if(pp == 0){
+    for(pp = &idepending; *pp; pp = &(*pp)->qnext)
+      if(!idebefore(*pp, idedev, ideblock))
+        break;
+    if(*pp == 0)
+      pp = &idepending;   // wrap around
+  }
+
+  // Extend the run over following requests for the next blocks.
+  b = last = *pp;
+  for(n = 1; n < IDEMAXRUN && last->qnext; n++){
+    if(last->qnext->dev != b->dev ||
+       last->qnext->blockno != last->blockno + 1 ||
+       (last->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+    last = last->qnext;
+  }
+  *pp = last->qnext;
+  last->qnext = 0;
+
+  idequeue = b;
+  idedev = last->dev;
+  ideblock = last->blockno + 1;
+  idestart(b, n);
+}
+
+// Mark b done and wake the process waiting for it.
+// Nobody waits for a read-ahead; give it back to the cache.
+static void
+idedone(struct buf *b)
+{
+  b->flags |= B_VALID;
+  b->flags &= ~B_DIRTY;
+  if(b->flags & B_ASYNC)
+    bdone(b);
+  else
+    wakeup(b);
+}
+
 // Interrupt handler.
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *next;
+  int st;
 
   // First queued buffer is the active request.
   acquire(&idelock);
@@ -113,30 +271,48 @@ ideintr(void)
     // cprintf("spurious IDE interrupt\n");
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(bmbase){
+    // A DMA run interrupts once, when all of it is done.
+    // Reading the disk status acknowledges the interrupt.
+    st = inb(bmbase + BM_STATUS);
+    outb(bmbase + BM_CMD, inb(bmbase + BM_CMD) & ~BM_START);
+    outb(bmbase + BM_STATUS, st | BM_ERR | BM_INTR);
+    if(idewait(1) < 0 || (st & BM_ERR))
+      panic("ideintr: dma error");
+    idequeue = 0;
+    for(; b; b = next){
+      next = b->qnext;
+      idedone(b);
+    }
+  } else {
+    idequeue = b->qnext;
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    // Read data if needed.
+    if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+      insl(0x1f0, b->data, BSIZE/4);
 
-  // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+    // Feed the disk the next block of a write run; it interrupts
+    // again once that is written.  The next block of a read run
+    // interrupts by itself.
+    if(idequeue != 0 && (idequeue->flags & B_DIRTY)){
+      idewait(0);
+      outsl(0x1f0, idequeue->data, BSIZE/4);
+    }
+    idedone(b);
+  }
+
+  // Start disk on the next run once this one is done.
+  if(idequeue == 0)
+    idedispatch();
 
   release(&idelock);
 }
 
-//PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Insert b into idepending in sector order.
+// Caller must hold idelock.
+static void
+ideinsert(struct buf *b)
 {
   struct buf **pp;
 
@@ -147,22 +323,59 @@ iderw(struct buf *b)
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
-  acquire(&idelock);  //DOC:acquire-lock
-
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  for(pp=&idepending; *pp && idebefore(*pp, b->dev, b->blockno); pp=&(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
+  statinc(ST_IDERW);
+#ifdef IODEADLINE
+  b->deadline = ticks + ((b->flags & B_DIRTY) ? IDEWRITEEXPIRE : IDEREADEXPIRE);
+#endif
+}
+
+//PAGEBREAK!
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  acquire(&idelock);  //DOC:acquire-lock
+
+  ideinsert(b);
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(idequeue == 0)
+    idedispatch();
 
-  // Wait for request to finish.
+  // Wait for request to finish, unless it is a read-ahead.
+  if(b->flags & B_ASYNC){
+    release(&idelock);
+    return;
+  }
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
 
   release(&idelock);
 }
+
+// Sync the n bufs in bv with disk together, so that runs of
+// consecutive blocks among them go to the disk as one command.
+// Returns when all are done.
+void
+iderwv(struct buf **bv, int n)
+{
+  int i;
+
+  acquire(&idelock);
+  for(i = 0; i < n; i++)
+    ideinsert(bv[i]);
+  if(idequeue == 0)
+    idedispatch();
+  for(i = 0; i < n; i++){
+    while((bv[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(bv[i], &idelock);
+  }
+  release(&idelock);
+}
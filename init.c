@@ -13,12 +13,16 @@ main(void)
   int pid, wpid;
 
   if(open("console", O_RDWR) < 0){
-    mknod("console", 1, 1);
+    mknod("console", CONSOLE, 1);
     open("console", O_RDWR);
   }
   dup(0);  // stdout
   dup(0);  // stderr
 
+  // Event counters, for vmstat.  Both fail if they already exist.
+  mkdir("/dev");
+  mknod("/dev/stats", STATS, 0);
+
   for(;;){
     printf(1, "init: starting sh\n");
     pid = fork();
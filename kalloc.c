@@ -1,6 +1,12 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
 // and pipe buffers. Allocates 4096-byte pages.
+//
+// Built with 'make KALLOC=DEBUG', kfree() fills freed pages with
+// junk and kalloc() panics if the junk was overwritten, to catch
+// use after free.  Otherwise freed pages are left as they are,
+// and kzalloc() takes pages that idle CPUs have zeroed ahead of
+// time (see kzeroidle()).
 
 #include "types.h"
 #include "defs.h"
@@ -8,6 +14,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "proc.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -20,8 +27,30 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  int nfree;                   // pages on freelist
+  struct run *zeroed;          // free pages known to be all zeros
+  int nzeroed;                 // pages on zeroed
 } kmem;
 
+// Once kinit2() has run, each CPU keeps a magazine of free pages
+// that only it touches, with interrupts off, so most kalloc()s
+// and kfree()s take no lock.  An empty magazine is refilled from
+// kmem.freelist, and a full one drained to it, half a magazine
+// at a time.
+struct kmag {
+  int n;
+  char *page[KMAGSIZE];
+};
+static struct kmag kmag[NCPU];
+
+// References to each physical page, for pages that copy-on-write
+// fork shares between processes.  kalloc() sets a page's count
+// to 1 and kfree() only frees it when the last reference goes.
+// Changed with atomic instructions, not under kmem.lock, so that
+// the magazine paths stay lock-free.
+static ushort kref[PHYSTOP/PGSIZE];
+#define KREF(v) kref[V2P(v)/PGSIZE]
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -51,6 +80,39 @@ freerange(void *vstart, void *vend)
     kfree(p);
 }
 
+// Move half of this CPU's full magazine m to the freelist.
+// Caller has interrupts off.
+static void
+kdrain(struct kmag *m)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  while(m->n > KMAGSIZE/2){
+    r = (struct run*)m->page[--m->n];
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    kmem.nfree++;
+  }
+  release(&kmem.lock);
+}
+
+// Fill this CPU's empty magazine m halfway from the freelist.
+// Caller has interrupts off.
+static void
+krefill(struct kmag *m)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  while(m->n < KMAGSIZE/2 && (r = kmem.freelist) != 0){
+    kmem.freelist = r->next;
+    kmem.nfree--;
+    m->page[m->n++] = (char*)r;
+  }
+  release(&kmem.lock);
+}
+
 //PAGEBREAK: 21
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
@@ -60,37 +122,181 @@ void
 kfree(char *v)
 {
   struct run *r;
+  struct kmag *m;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
+  if(KREF(v) > 1 && __sync_sub_and_fetch(&KREF(v), 1) > 0)
+    return;   // still shared
+  KREF(v) = 0;
 
+#ifdef KALLOC_DEBUG
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
+
+  if(kmem.use_lock){
+    pushcli();
+    m = &kmag[cpu - cpus];
+    if(m->n == KMAGSIZE)
+      kdrain(m);
+    m->page[m->n++] = v;
+    popcli();
+    return;
+  }
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  kmem.nfree++;
+}
+
+#ifdef KALLOC_DEBUG
+// Check that nobody wrote to free page v since kfree() filled it.
+static void
+kcheck(char *v)
+{
+  int i;
+
+  for(i = sizeof(struct run); i < PGSIZE; i++)
+    if(v[i] != 1)
+      panic("kalloc: free page modified");
+}
+#endif
+
+// Take a page from this CPU's magazine, or 0.
+static char*
+kget(void)
+{
+  struct kmag *m;
+  char *v;
+
+  pushcli();
+  m = &kmag[cpu - cpus];
+  if(m->n == 0)
+    krefill(m);
+  v = m->n > 0 ? m->page[--m->n] : 0;
+  popcli();
+  return v;
+}
+
+// Take a page from the pool of zeroed pages, or 0.
+static char*
+kzget(void)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  r = kmem.zeroed;
+  if(r){
+    kmem.zeroed = r->next;
+    kmem.nzeroed--;
+    r->next = 0;
+  }
+  release(&kmem.lock);
+  return (char*)r;
 }
 
 // Allocate one 4096-byte page of physical memory.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
+// When memory runs out, use the zeroed pages, then ask the
+// buffer cache and the page cache to give some back, and last
+// wait for kswapd to swap some user pages out.
 char*
 kalloc(void)
 {
   struct run *r;
+  char *v;
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
-  return (char*)r;
+  if(!kmem.use_lock){
+    r = kmem.freelist;
+    if(r){
+      kmem.freelist = r->next;
+      kmem.nfree--;
+      KREF(r) = 1;
+    }
+    return (char*)r;
+  }
+
+  for(;;){
+    if((v = kget()) != 0 || (v = kzget()) != 0){
+#ifdef KALLOC_DEBUG
+      kcheck(v);
+#endif
+      KREF(v) = 1;
+      return v;
+    }
+    if(bshrink(1) == 0 && pcshrink(1) == 0 && swapwait() == 0)
+      return 0;
+  }
+}
+
+// Allocate a page of zeros.
+char*
+kzalloc(void)
+{
+  char *v;
+
+#ifndef KALLOC_DEBUG
+  if(kmem.use_lock && (v = kzget()) != 0){
+    KREF(v) = 1;
+    return v;
+  }
+#endif
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Called by the scheduler on an idle CPU: zero a free page for
+// kzalloc(), unless KZEROPAGES are ready already.
+// Returns 1 if it did.
+int
+kzeroidle(void)
+{
+#ifdef KALLOC_DEBUG
+  return 0;
+#else
+  struct run *r;
+
+  if(!kmem.use_lock || kmem.nzeroed >= KZEROPAGES)
+    return 0;
+  if((r = (struct run*)kget()) == 0)
+    return 0;
+  memset(r, 0, PGSIZE);
+  acquire(&kmem.lock);
+  r->next = kmem.zeroed;
+  kmem.zeroed = r;
+  kmem.nzeroed++;
+  release(&kmem.lock);
+  return 1;
+#endif
+}
+
+// Add a reference to page v, which is shared copy-on-write.
+void
+kdup(char *v)
+{
+  __sync_add_and_fetch(&KREF(v), 1);
+}
+
+// Number of references to page v.
+int
+krefcnt(char *v)
+{
+  return KREF(v);
+}
+
+// Number of free pages, read without locks: only a hint.
+int
+kfreepages(void)
+{
+  int i, n;
+
+  n = kmem.nfree + kmem.nzeroed;
+  for(i = 0; i < ncpu; i++)
+    n += kmag[i].n;
+  return n;
 }
 
@@ -0,0 +1,1329 @@
+
+_kallocbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 39                	mov    (%ecx),%edi
+  16:	8b 51 04             	mov    0x4(%ecx),%edx
+  int i, n, rounds, t0, t1, pages;
+
+  n = argc > 1 ? atoi(argv[1]) : NPROC;
+  19:	83 ff 01             	cmp    $0x1,%edi
+  1c:	7f 33                	jg     51 <main+0x51>
+  if(n <= 0 || rounds <= 0){
+    printf(2, "usage: kallocbench [nproc] [rounds]\n");
+    exit();
+  }
+
+  t0 = uptime();
+  1e:	e8 58 04 00 00       	call   47b <uptime>
+  n = argc > 1 ? atoi(argv[1]) : NPROC;
+  23:	bb 04 00 00 00       	mov    $0x4,%ebx
+  rounds = argc > 2 ? atoi(argv[2]) : NROUNDS;
+  28:	be d0 07 00 00       	mov    $0x7d0,%esi
+  t0 = uptime();
+  2d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < n; i++){
+  30:	31 ff                	xor    %edi,%edi
+  32:	eb 0b                	jmp    3f <main+0x3f>
+  34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  38:	83 c7 01             	add    $0x1,%edi
+  3b:	39 df                	cmp    %ebx,%edi
+  3d:	74 61                	je     a0 <main+0xa0>
+    if(fork() == 0)
+  3f:	e8 97 03 00 00       	call   3db <fork>
+  44:	85 c0                	test   %eax,%eax
+  46:	75 f0                	jne    38 <main+0x38>
+      churn(rounds);
+  48:	83 ec 0c             	sub    $0xc,%esp
+  4b:	56                   	push   %esi
+  4c:	e8 df 00 00 00       	call   130 <churn>
+  n = argc > 1 ? atoi(argv[1]) : NPROC;
+  51:	83 ec 0c             	sub    $0xc,%esp
+  54:	ff 72 04             	push   0x4(%edx)
+  rounds = argc > 2 ? atoi(argv[2]) : NROUNDS;
+  57:	be d0 07 00 00       	mov    $0x7d0,%esi
+  n = argc > 1 ? atoi(argv[1]) : NPROC;
+  5c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  5f:	e8 0c 03 00 00       	call   370 <atoi>
+  rounds = argc > 2 ? atoi(argv[2]) : NROUNDS;
+  64:	83 c4 10             	add    $0x10,%esp
+  n = argc > 1 ? atoi(argv[1]) : NPROC;
+  67:	89 c3                	mov    %eax,%ebx
+  rounds = argc > 2 ? atoi(argv[2]) : NROUNDS;
+  69:	83 ff 02             	cmp    $0x2,%edi
+  6c:	74 13                	je     81 <main+0x81>
+  6e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  71:	83 ec 0c             	sub    $0xc,%esp
+  74:	ff 72 08             	push   0x8(%edx)
+  77:	e8 f4 02 00 00       	call   370 <atoi>
+  7c:	83 c4 10             	add    $0x10,%esp
+  7f:	89 c6                	mov    %eax,%esi
+  if(n <= 0 || rounds <= 0){
+  81:	85 db                	test   %ebx,%ebx
+  83:	7e 08                	jle    8d <main+0x8d>
+  85:	85 f6                	test   %esi,%esi
+  87:	0f 8f 87 00 00 00    	jg     114 <main+0x114>
+    printf(2, "usage: kallocbench [nproc] [rounds]\n");
+  8d:	50                   	push   %eax
+  8e:	50                   	push   %eax
+  8f:	68 a4 08 00 00       	push   $0x8a4
+  94:	6a 02                	push   $0x2
+  96:	e8 c5 04 00 00       	call   560 <printf>
+    exit();
+  9b:	e8 43 03 00 00       	call   3e3 <exit>
+  }
+  for(i = 0; i < n; i++)
+  a0:	31 ff                	xor    %edi,%edi
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+  a8:	e8 3e 03 00 00       	call   3eb <wait>
+  for(i = 0; i < n; i++)
+  ad:	83 c7 01             	add    $0x1,%edi
+  b0:	39 df                	cmp    %ebx,%edi
+  b2:	75 f4                	jne    a8 <main+0xa8>
+  t1 = uptime();
+  b4:	e8 c2 03 00 00       	call   47b <uptime>
+  b9:	89 c1                	mov    %eax,%ecx
+
+  if(t1 == t0)
+  bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  be:	39 c1                	cmp    %eax,%ecx
+  c0:	74 4d                	je     10f <main+0x10f>
+    t1 = t0 + 1;
+  pages = n * rounds * NPAGES;
+  c2:	0f af f3             	imul   %ebx,%esi
+  printf(1, "kallocbench: %d procs, %d pages in and out in %d ticks\n",
+  c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  c8:	83 ec 0c             	sub    $0xc,%esp
+  cb:	29 c1                	sub    %eax,%ecx
+  pages = n * rounds * NPAGES;
+  cd:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+  printf(1, "kallocbench: %d procs, %d pages in and out in %d ticks\n",
+  d4:	51                   	push   %ecx
+         n, pages, t1 - t0);
+  // 100 ticks a second.
+  printf(1, "kallocbench: %d pages/s, %d pages/s per proc\n",
+         pages * 100 / (t1 - t0), pages * 100 / (t1 - t0) / n);
+  d5:	69 f6 20 03 00 00    	imul   $0x320,%esi,%esi
+  printf(1, "kallocbench: %d procs, %d pages in and out in %d ticks\n",
+  db:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  de:	50                   	push   %eax
+  df:	53                   	push   %ebx
+  e0:	68 cc 08 00 00       	push   $0x8cc
+  e5:	6a 01                	push   $0x1
+  e7:	e8 74 04 00 00       	call   560 <printf>
+         pages * 100 / (t1 - t0), pages * 100 / (t1 - t0) / n);
+  ec:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  ef:	89 f0                	mov    %esi,%eax
+  printf(1, "kallocbench: %d pages/s, %d pages/s per proc\n",
+  f1:	83 c4 20             	add    $0x20,%esp
+         pages * 100 / (t1 - t0), pages * 100 / (t1 - t0) / n);
+  f4:	99                   	cltd
+  f5:	f7 f9                	idiv   %ecx
+  printf(1, "kallocbench: %d pages/s, %d pages/s per proc\n",
+  f7:	99                   	cltd
+         pages * 100 / (t1 - t0), pages * 100 / (t1 - t0) / n);
+  f8:	89 c6                	mov    %eax,%esi
+  printf(1, "kallocbench: %d pages/s, %d pages/s per proc\n",
+  fa:	f7 fb                	idiv   %ebx
+  fc:	50                   	push   %eax
+  fd:	56                   	push   %esi
+  fe:	68 04 09 00 00       	push   $0x904
+ 103:	6a 01                	push   $0x1
+ 105:	e8 56 04 00 00       	call   560 <printf>
+  exit();
+ 10a:	e8 d4 02 00 00       	call   3e3 <exit>
+    t1 = t0 + 1;
+ 10f:	8d 48 01             	lea    0x1(%eax),%ecx
+ 112:	eb ae                	jmp    c2 <main+0xc2>
+  t0 = uptime();
+ 114:	e8 62 03 00 00       	call   47b <uptime>
+ 119:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < n; i++){
+ 11c:	e9 0f ff ff ff       	jmp    30 <main+0x30>
+ 121:	66 90                	xchg   %ax,%ax
+ 123:	66 90                	xchg   %ax,%ax
+ 125:	66 90                	xchg   %ax,%ax
+ 127:	66 90                	xchg   %ax,%ax
+ 129:	66 90                	xchg   %ax,%ax
+ 12b:	66 90                	xchg   %ax,%ax
+ 12d:	66 90                	xchg   %ax,%ax
+ 12f:	90                   	nop
+
+00000130 <churn>:
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	56                   	push   %esi
+ 134:	53                   	push   %ebx
+ 135:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(i = 0; i < rounds; i++){
+ 138:	85 f6                	test   %esi,%esi
+ 13a:	7e 47                	jle    183 <churn+0x53>
+ 13c:	31 db                	xor    %ebx,%ebx
+ 13e:	66 90                	xchg   %ax,%ax
+    if((p = sbrk(NPAGES*PGSIZE)) == (char*)-1){
+ 140:	83 ec 0c             	sub    $0xc,%esp
+ 143:	68 00 80 00 00       	push   $0x8000
+ 148:	e8 1e 03 00 00       	call   46b <sbrk>
+ 14d:	83 c4 10             	add    $0x10,%esp
+ 150:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 153:	74 33                	je     188 <churn+0x58>
+ 155:	8d 90 00 80 00 00    	lea    0x8000(%eax),%edx
+ 15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+      p[j*PGSIZE] = 1;  // fault the page in
+ 160:	c6 00 01             	movb   $0x1,(%eax)
+    for(j = 0; j < NPAGES; j++)
+ 163:	05 00 10 00 00       	add    $0x1000,%eax
+ 168:	39 d0                	cmp    %edx,%eax
+ 16a:	75 f4                	jne    160 <churn+0x30>
+    sbrk(-NPAGES*PGSIZE);
+ 16c:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < rounds; i++){
+ 16f:	83 c3 01             	add    $0x1,%ebx
+    sbrk(-NPAGES*PGSIZE);
+ 172:	68 00 80 ff ff       	push   $0xffff8000
+ 177:	e8 ef 02 00 00       	call   46b <sbrk>
+  for(i = 0; i < rounds; i++){
+ 17c:	83 c4 10             	add    $0x10,%esp
+ 17f:	39 de                	cmp    %ebx,%esi
+ 181:	75 bd                	jne    140 <churn+0x10>
+  exit();
+ 183:	e8 5b 02 00 00       	call   3e3 <exit>
+      printf(1, "kallocbench: sbrk failed\n");
+ 188:	50                   	push   %eax
+ 189:	50                   	push   %eax
+ 18a:	68 88 08 00 00       	push   $0x888
+ 18f:	6a 01                	push   $0x1
+ 191:	e8 ca 03 00 00       	call   560 <printf>
+      exit();
+ 196:	e8 48 02 00 00       	call   3e3 <exit>
+ 19b:	66 90                	xchg   %ax,%ax
+ 19d:	66 90                	xchg   %ax,%ax
+ 19f:	90                   	nop
+
+000001a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1a1:	31 c0                	xor    %eax,%eax
+{
+ 1a3:	89 e5                	mov    %esp,%ebp
+ 1a5:	53                   	push   %ebx
+ 1a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1b7:	83 c0 01             	add    $0x1,%eax
+ 1ba:	84 d2                	test   %dl,%dl
+ 1bc:	75 f2                	jne    1b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1c1:	89 c8                	mov    %ecx,%eax
+ 1c3:	c9                   	leave
+ 1c4:	c3                   	ret
+ 1c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	53                   	push   %ebx
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1da:	0f b6 02             	movzbl (%edx),%eax
+ 1dd:	84 c0                	test   %al,%al
+ 1df:	75 17                	jne    1f8 <strcmp+0x28>
+ 1e1:	eb 3a                	jmp    21d <strcmp+0x4d>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1ec:	83 c2 01             	add    $0x1,%edx
+ 1ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1f2:	84 c0                	test   %al,%al
+ 1f4:	74 1a                	je     210 <strcmp+0x40>
+    p++, q++;
+ 1f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1fb:	38 c3                	cmp    %al,%bl
+ 1fd:	74 e9                	je     1e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1ff:	29 d8                	sub    %ebx,%eax
+}
+ 201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 204:	c9                   	leave
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 210:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 214:	31 c0                	xor    %eax,%eax
+ 216:	29 d8                	sub    %ebx,%eax
+}
+ 218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 21b:	c9                   	leave
+ 21c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 21d:	0f b6 19             	movzbl (%ecx),%ebx
+ 220:	31 c0                	xor    %eax,%eax
+ 222:	eb db                	jmp    1ff <strcmp+0x2f>
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 236:	80 3a 00             	cmpb   $0x0,(%edx)
+ 239:	74 15                	je     250 <strlen+0x20>
+ 23b:	31 c0                	xor    %eax,%eax
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+ 240:	83 c0 01             	add    $0x1,%eax
+ 243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 247:	89 c1                	mov    %eax,%ecx
+ 249:	75 f5                	jne    240 <strlen+0x10>
+    ;
+  return n;
+}
+ 24b:	89 c8                	mov    %ecx,%eax
+ 24d:	5d                   	pop    %ebp
+ 24e:	c3                   	ret
+ 24f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 250:	31 c9                	xor    %ecx,%ecx
+}
+ 252:	5d                   	pop    %ebp
+ 253:	89 c8                	mov    %ecx,%eax
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000260 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 267:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 26a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 26d:	89 d7                	mov    %edx,%edi
+ 26f:	fc                   	cld
+ 270:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 272:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 275:	89 d0                	mov    %edx,%eax
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 28a:	0f b6 10             	movzbl (%eax),%edx
+ 28d:	84 d2                	test   %dl,%dl
+ 28f:	75 12                	jne    2a3 <strchr+0x23>
+ 291:	eb 1d                	jmp    2b0 <strchr+0x30>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 29c:	83 c0 01             	add    $0x1,%eax
+ 29f:	84 d2                	test   %dl,%dl
+ 2a1:	74 0d                	je     2b0 <strchr+0x30>
+    if(*s == c)
+ 2a3:	38 d1                	cmp    %dl,%cl
+ 2a5:	75 f1                	jne    298 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2a7:	5d                   	pop    %ebp
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2b0:	31 c0                	xor    %eax,%eax
+}
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	c3                   	ret
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2c9:	31 db                	xor    %ebx,%ebx
+{
+ 2cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ce:	eb 27                	jmp    2f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2d0:	83 ec 04             	sub    $0x4,%esp
+ 2d3:	6a 01                	push   $0x1
+ 2d5:	56                   	push   %esi
+ 2d6:	6a 00                	push   $0x0
+ 2d8:	e8 1e 01 00 00       	call   3fb <read>
+    if(cc < 1)
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	7e 1d                	jle    301 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2ef:	3c 0a                	cmp    $0xa,%al
+ 2f1:	74 10                	je     303 <gets+0x43>
+ 2f3:	3c 0d                	cmp    $0xd,%al
+ 2f5:	74 0c                	je     303 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2f7:	89 df                	mov    %ebx,%edi
+ 2f9:	83 c3 01             	add    $0x1,%ebx
+ 2fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2ff:	7c cf                	jl     2d0 <gets+0x10>
+ 301:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 30a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 30d:	5b                   	pop    %ebx
+ 30e:	5e                   	pop    %esi
+ 30f:	5f                   	pop    %edi
+ 310:	5d                   	pop    %ebp
+ 311:	c3                   	ret
+ 312:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	56                   	push   %esi
+ 324:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 325:	83 ec 08             	sub    $0x8,%esp
+ 328:	6a 00                	push   $0x0
+ 32a:	ff 75 08             	push   0x8(%ebp)
+ 32d:	e8 f1 00 00 00       	call   423 <open>
+  if(fd < 0)
+ 332:	83 c4 10             	add    $0x10,%esp
+ 335:	85 c0                	test   %eax,%eax
+ 337:	78 27                	js     360 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 339:	83 ec 08             	sub    $0x8,%esp
+ 33c:	ff 75 0c             	push   0xc(%ebp)
+ 33f:	89 c3                	mov    %eax,%ebx
+ 341:	50                   	push   %eax
+ 342:	e8 f4 00 00 00       	call   43b <fstat>
+  close(fd);
+ 347:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 34a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 34c:	e8 ba 00 00 00       	call   40b <close>
+  return r;
+ 351:	83 c4 10             	add    $0x10,%esp
+}
+ 354:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 357:	89 f0                	mov    %esi,%eax
+ 359:	5b                   	pop    %ebx
+ 35a:	5e                   	pop    %esi
+ 35b:	5d                   	pop    %ebp
+ 35c:	c3                   	ret
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 360:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 365:	eb ed                	jmp    354 <stat+0x34>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 377:	0f be 02             	movsbl (%edx),%eax
+ 37a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 37d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 380:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 385:	77 1e                	ja     3a5 <atoi+0x35>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 390:	83 c2 01             	add    $0x1,%edx
+ 393:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 396:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 39a:	0f be 02             	movsbl (%edx),%eax
+ 39d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3a0:	80 fb 09             	cmp    $0x9,%bl
+ 3a3:	76 eb                	jbe    390 <atoi+0x20>
+  return n;
+}
+ 3a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a8:	89 c8                	mov    %ecx,%eax
+ 3aa:	c9                   	leave
+ 3ab:	c3                   	ret
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+ 3b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3be:	85 c0                	test   %eax,%eax
+ 3c0:	7e 13                	jle    3d5 <memmove+0x25>
+ 3c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3c4:	89 d7                	mov    %edx,%edi
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3d1:	39 f8                	cmp    %edi,%eax
+ 3d3:	75 fb                	jne    3d0 <memmove+0x20>
+  return vdst;
+}
+ 3d5:	5e                   	pop    %esi
+ 3d6:	89 d0                	mov    %edx,%eax
+ 3d8:	5f                   	pop    %edi
+ 3d9:	5d                   	pop    %ebp
+ 3da:	c3                   	ret
+
+000003db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <exit>:
+SYSCALL(exit)
+ 3e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <wait>:
+SYSCALL(wait)
+ 3eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <pipe>:
+SYSCALL(pipe)
+ 3f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <read>:
+SYSCALL(read)
+ 3fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <write>:
+SYSCALL(write)
+ 403:	b8 10 00 00 00       	mov    $0x10,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <close>:
+SYSCALL(close)
+ 40b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <kill>:
+SYSCALL(kill)
+ 413:	b8 06 00 00 00       	mov    $0x6,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <exec>:
+SYSCALL(exec)
+ 41b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <open>:
+SYSCALL(open)
+ 423:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <mknod>:
+SYSCALL(mknod)
+ 42b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <unlink>:
+SYSCALL(unlink)
+ 433:	b8 12 00 00 00       	mov    $0x12,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <fstat>:
+SYSCALL(fstat)
+ 43b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <link>:
+SYSCALL(link)
+ 443:	b8 13 00 00 00       	mov    $0x13,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mkdir>:
+SYSCALL(mkdir)
+ 44b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <chdir>:
+SYSCALL(chdir)
+ 453:	b8 09 00 00 00       	mov    $0x9,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <dup>:
+SYSCALL(dup)
+ 45b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <getpid>:
+SYSCALL(getpid)
+ 463:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <sbrk>:
+SYSCALL(sbrk)
+ 46b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <sleep>:
+SYSCALL(sleep)
+ 473:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <uptime>:
+SYSCALL(uptime)
+ 47b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <trace>:
+SYSCALL(trace)
+ 483:	b8 16 00 00 00       	mov    $0x16,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <assign_nice>:
+SYSCALL(assign_nice)
+ 48b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <readahead>:
+SYSCALL(readahead)
+ 493:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <dropcache>:
+SYSCALL(dropcache)
+ 49b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <tracedrain>:
+SYSCALL(tracedrain)
+ 4a3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <settrace>:
+SYSCALL(settrace)
+ 4ab:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <tracestat>:
+ 4b3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+ 4bb:	66 90                	xchg   %ax,%ax
+ 4bd:	66 90                	xchg   %ax,%ax
+ 4bf:	90                   	nop
+
+000004c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	53                   	push   %ebx
+ 4c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4c8:	89 d1                	mov    %edx,%ecx
+{
+ 4ca:	83 ec 3c             	sub    $0x3c,%esp
+ 4cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4d0:	85 d2                	test   %edx,%edx
+ 4d2:	0f 89 80 00 00 00    	jns    558 <printint+0x98>
+ 4d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4dc:	74 7a                	je     558 <printint+0x98>
+    x = -xx;
+ 4de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4e8:	31 f6                	xor    %esi,%esi
+ 4ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4f0:	89 c8                	mov    %ecx,%eax
+ 4f2:	31 d2                	xor    %edx,%edx
+ 4f4:	89 f7                	mov    %esi,%edi
+ 4f6:	f7 f3                	div    %ebx
+ 4f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4fb:	0f b6 92 94 09 00 00 	movzbl 0x994(%edx),%edx
+ 502:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 506:	89 ca                	mov    %ecx,%edx
+ 508:	89 c1                	mov    %eax,%ecx
+ 50a:	39 da                	cmp    %ebx,%edx
+ 50c:	73 e2                	jae    4f0 <printint+0x30>
+  if(neg)
+ 50e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 511:	85 c0                	test   %eax,%eax
+ 513:	74 07                	je     51c <printint+0x5c>
+    buf[i++] = '-';
+ 515:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 51a:	89 f7                	mov    %esi,%edi
+ 51c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 51f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 522:	01 df                	add    %ebx,%edi
+ 524:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 528:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 52b:	83 ec 04             	sub    $0x4,%esp
+ 52e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 531:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 534:	6a 01                	push   $0x1
+ 536:	50                   	push   %eax
+ 537:	56                   	push   %esi
+ 538:	e8 c6 fe ff ff       	call   403 <write>
+  while(--i >= 0)
+ 53d:	89 f8                	mov    %edi,%eax
+ 53f:	83 c4 10             	add    $0x10,%esp
+ 542:	83 ef 01             	sub    $0x1,%edi
+ 545:	39 d8                	cmp    %ebx,%eax
+ 547:	75 df                	jne    528 <printint+0x68>
+}
+ 549:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 54c:	5b                   	pop    %ebx
+ 54d:	5e                   	pop    %esi
+ 54e:	5f                   	pop    %edi
+ 54f:	5d                   	pop    %ebp
+ 550:	c3                   	ret
+ 551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 558:	31 c0                	xor    %eax,%eax
+ 55a:	eb 89                	jmp    4e5 <printint+0x25>
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	53                   	push   %ebx
+ 566:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 569:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 56c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 56f:	0f b6 1e             	movzbl (%esi),%ebx
+ 572:	83 c6 01             	add    $0x1,%esi
+ 575:	84 db                	test   %bl,%bl
+ 577:	74 67                	je     5e0 <printf+0x80>
+ 579:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 57c:	31 d2                	xor    %edx,%edx
+ 57e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 581:	eb 34                	jmp    5b7 <printf+0x57>
+ 583:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 587:	90                   	nop
+ 588:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 58b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 590:	83 f8 25             	cmp    $0x25,%eax
+ 593:	74 18                	je     5ad <printf+0x4d>
+  write(fd, &c, 1);
+ 595:	83 ec 04             	sub    $0x4,%esp
+ 598:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 59b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 59e:	6a 01                	push   $0x1
+ 5a0:	50                   	push   %eax
+ 5a1:	57                   	push   %edi
+ 5a2:	e8 5c fe ff ff       	call   403 <write>
+ 5a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 5b0:	83 c6 01             	add    $0x1,%esi
+ 5b3:	84 db                	test   %bl,%bl
+ 5b5:	74 29                	je     5e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5ba:	85 d2                	test   %edx,%edx
+ 5bc:	74 ca                	je     588 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5be:	83 fa 25             	cmp    $0x25,%edx
+ 5c1:	75 ea                	jne    5ad <printf+0x4d>
+      if(c == 'd'){
+ 5c3:	83 f8 25             	cmp    $0x25,%eax
+ 5c6:	0f 84 24 01 00 00    	je     6f0 <printf+0x190>
+ 5cc:	83 e8 63             	sub    $0x63,%eax
+ 5cf:	83 f8 15             	cmp    $0x15,%eax
+ 5d2:	77 1c                	ja     5f0 <printf+0x90>
+ 5d4:	ff 24 85 3c 09 00 00 	jmp    *0x93c(,%eax,4)
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5e3:	5b                   	pop    %ebx
+ 5e4:	5e                   	pop    %esi
+ 5e5:	5f                   	pop    %edi
+ 5e6:	5d                   	pop    %ebp
+ 5e7:	c3                   	ret
+ 5e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+  write(fd, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5fa:	6a 01                	push   $0x1
+ 5fc:	52                   	push   %edx
+ 5fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 600:	57                   	push   %edi
+ 601:	e8 fd fd ff ff       	call   403 <write>
+ 606:	83 c4 0c             	add    $0xc,%esp
+ 609:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 60c:	6a 01                	push   $0x1
+ 60e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 611:	52                   	push   %edx
+ 612:	57                   	push   %edi
+ 613:	e8 eb fd ff ff       	call   403 <write>
+        putc(fd, c);
+ 618:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 61b:	31 d2                	xor    %edx,%edx
+ 61d:	eb 8e                	jmp    5ad <printf+0x4d>
+ 61f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 620:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 623:	83 ec 0c             	sub    $0xc,%esp
+ 626:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 62b:	8b 13                	mov    (%ebx),%edx
+ 62d:	6a 00                	push   $0x0
+ 62f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 631:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 634:	e8 87 fe ff ff       	call   4c0 <printint>
+        ap++;
+ 639:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 63c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 63f:	31 d2                	xor    %edx,%edx
+ 641:	e9 67 ff ff ff       	jmp    5ad <printf+0x4d>
+ 646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 650:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 653:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 655:	83 c0 04             	add    $0x4,%eax
+ 658:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 65b:	85 db                	test   %ebx,%ebx
+ 65d:	0f 84 9d 00 00 00    	je     700 <printf+0x1a0>
+        while(*s != 0){
+ 663:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 666:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 668:	84 c0                	test   %al,%al
+ 66a:	0f 84 3d ff ff ff    	je     5ad <printf+0x4d>
+ 670:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 673:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 676:	89 de                	mov    %ebx,%esi
+ 678:	89 d3                	mov    %edx,%ebx
+ 67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 686:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 689:	6a 01                	push   $0x1
+ 68b:	53                   	push   %ebx
+ 68c:	57                   	push   %edi
+ 68d:	e8 71 fd ff ff       	call   403 <write>
+        while(*s != 0){
+ 692:	0f b6 06             	movzbl (%esi),%eax
+ 695:	83 c4 10             	add    $0x10,%esp
+ 698:	84 c0                	test   %al,%al
+ 69a:	75 e4                	jne    680 <printf+0x120>
+      state = 0;
+ 69c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 69f:	31 d2                	xor    %edx,%edx
+ 6a1:	e9 07 ff ff ff       	jmp    5ad <printf+0x4d>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 01                	push   $0x1
+ 6bf:	e9 6b ff ff ff       	jmp    62f <printf+0xcf>
+ 6c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6cb:	83 ec 04             	sub    $0x4,%esp
+ 6ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6d9:	6a 01                	push   $0x1
+ 6db:	52                   	push   %edx
+ 6dc:	57                   	push   %edi
+ 6dd:	e8 21 fd ff ff       	call   403 <write>
+        ap++;
+ 6e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6e8:	31 d2                	xor    %edx,%edx
+ 6ea:	e9 be fe ff ff       	jmp    5ad <printf+0x4d>
+ 6ef:	90                   	nop
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	e9 11 ff ff ff       	jmp    611 <printf+0xb1>
+ 700:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 705:	bb 32 09 00 00       	mov    $0x932,%ebx
+ 70a:	e9 61 ff ff ff       	jmp    670 <printf+0x110>
+ 70f:	90                   	nop
+
+00000710 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 710:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 711:	a1 5c 0c 00 00       	mov    0xc5c,%eax
+{
+ 716:	89 e5                	mov    %esp,%ebp
+ 718:	57                   	push   %edi
+ 719:	56                   	push   %esi
+ 71a:	53                   	push   %ebx
+ 71b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 71e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 728:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 72a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 72c:	39 ca                	cmp    %ecx,%edx
+ 72e:	73 30                	jae    760 <free+0x50>
+ 730:	39 c1                	cmp    %eax,%ecx
+ 732:	72 04                	jb     738 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 734:	39 c2                	cmp    %eax,%edx
+ 736:	72 f0                	jb     728 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 738:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 73b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 73e:	39 f8                	cmp    %edi,%eax
+ 740:	74 2e                	je     770 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 742:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 745:	8b 42 04             	mov    0x4(%edx),%eax
+ 748:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 74b:	39 f1                	cmp    %esi,%ecx
+ 74d:	74 38                	je     787 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 74f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 751:	5b                   	pop    %ebx
+  freep = p;
+ 752:	89 15 5c 0c 00 00    	mov    %edx,0xc5c
+}
+ 758:	5e                   	pop    %esi
+ 759:	5f                   	pop    %edi
+ 75a:	5d                   	pop    %ebp
+ 75b:	c3                   	ret
+ 75c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 760:	39 c1                	cmp    %eax,%ecx
+ 762:	72 d0                	jb     734 <free+0x24>
+ 764:	eb c2                	jmp    728 <free+0x18>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 770:	03 70 04             	add    0x4(%eax),%esi
+ 773:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 776:	8b 02                	mov    (%edx),%eax
+ 778:	8b 00                	mov    (%eax),%eax
+ 77a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 77d:	8b 42 04             	mov    0x4(%edx),%eax
+ 780:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 783:	39 f1                	cmp    %esi,%ecx
+ 785:	75 c8                	jne    74f <free+0x3f>
+    p->s.size += bp->s.size;
+ 787:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 78a:	89 15 5c 0c 00 00    	mov    %edx,0xc5c
+    p->s.size += bp->s.size;
+ 790:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 793:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 796:	89 0a                	mov    %ecx,(%edx)
+}
+ 798:	5b                   	pop    %ebx
+ 799:	5e                   	pop    %esi
+ 79a:	5f                   	pop    %edi
+ 79b:	5d                   	pop    %ebp
+ 79c:	c3                   	ret
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 7ac:	8b 15 5c 0c 00 00    	mov    0xc5c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7b2:	8d 78 07             	lea    0x7(%eax),%edi
+ 7b5:	c1 ef 03             	shr    $0x3,%edi
+ 7b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 7bb:	85 d2                	test   %edx,%edx
+ 7bd:	0f 84 8d 00 00 00    	je     850 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7c5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7c8:	39 f9                	cmp    %edi,%ecx
+ 7ca:	73 64                	jae    830 <malloc+0x90>
+  if(nu < 4096)
+ 7cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7d1:	39 df                	cmp    %ebx,%edi
+ 7d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 7dd:	eb 0a                	jmp    7e9 <malloc+0x49>
+ 7df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7e2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7e5:	39 f9                	cmp    %edi,%ecx
+ 7e7:	73 47                	jae    830 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 7e9:	89 c2                	mov    %eax,%edx
+ 7eb:	39 05 5c 0c 00 00    	cmp    %eax,0xc5c
+ 7f1:	75 ed                	jne    7e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 7f3:	83 ec 0c             	sub    $0xc,%esp
+ 7f6:	56                   	push   %esi
+ 7f7:	e8 6f fc ff ff       	call   46b <sbrk>
+  if(p == (char*)-1)
+ 7fc:	83 c4 10             	add    $0x10,%esp
+ 7ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 802:	74 1c                	je     820 <malloc+0x80>
+  hp->s.size = nu;
+ 804:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 807:	83 ec 0c             	sub    $0xc,%esp
+ 80a:	83 c0 08             	add    $0x8,%eax
+ 80d:	50                   	push   %eax
+ 80e:	e8 fd fe ff ff       	call   710 <free>
+  return freep;
+ 813:	8b 15 5c 0c 00 00    	mov    0xc5c,%edx
+      if((p = morecore(nunits)) == 0)
+ 819:	83 c4 10             	add    $0x10,%esp
+ 81c:	85 d2                	test   %edx,%edx
+ 81e:	75 c0                	jne    7e0 <malloc+0x40>
+        return 0;
+  }
+}
+ 820:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 823:	31 c0                	xor    %eax,%eax
+}
+ 825:	5b                   	pop    %ebx
+ 826:	5e                   	pop    %esi
+ 827:	5f                   	pop    %edi
+ 828:	5d                   	pop    %ebp
+ 829:	c3                   	ret
+ 82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 830:	39 cf                	cmp    %ecx,%edi
+ 832:	74 4c                	je     880 <malloc+0xe0>
+        p->s.size -= nunits;
+ 834:	29 f9                	sub    %edi,%ecx
+ 836:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 839:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 83c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 83f:	89 15 5c 0c 00 00    	mov    %edx,0xc5c
+}
+ 845:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 848:	83 c0 08             	add    $0x8,%eax
+}
+ 84b:	5b                   	pop    %ebx
+ 84c:	5e                   	pop    %esi
+ 84d:	5f                   	pop    %edi
+ 84e:	5d                   	pop    %ebp
+ 84f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 850:	c7 05 5c 0c 00 00 60 	movl   $0xc60,0xc5c
+ 857:	0c 00 00 
+    base.s.size = 0;
+ 85a:	b8 60 0c 00 00       	mov    $0xc60,%eax
+    base.s.ptr = freep = prevp = &base;
+ 85f:	c7 05 60 0c 00 00 60 	movl   $0xc60,0xc60
+ 866:	0c 00 00 
+    base.s.size = 0;
+ 869:	c7 05 64 0c 00 00 00 	movl   $0x0,0xc64
+ 870:	00 00 00 
+    if(p->s.size >= nunits){
+ 873:	e9 54 ff ff ff       	jmp    7cc <malloc+0x2c>
+ 878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 880:	8b 08                	mov    (%eax),%ecx
+ 882:	89 0a                	mov    %ecx,(%edx)
+ 884:	eb b9                	jmp    83f <malloc+0x9f>
@@ -0,0 +1,69 @@
+// Page allocator benchmark.
+// Each of nproc processes repeatedly grows its memory by a batch
+// of pages with sbrk(), writes a byte to each page and shrinks it
+// again.  sbrk() only reserves the addresses, so it is the write
+// that faults the page in with a kalloc(); shrinking kfree()s it.
+// Every page therefore costs a page fault, one kalloc() and one
+// kfree() in the kernel.  Run with nproc equal to the number of
+// CPUs (CPUS= in the Makefile) and compare the pages per second
+// as CPUs are added: with one allocator lock they stop scaling,
+// with per-CPU page magazines they should not.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define PGSIZE  4096
+#define NPROC   4
+#define NPAGES  8       // pages per sbrk() batch
+#define NROUNDS 2000
+
+void
+churn(int rounds)
+{
+  int i, j;
+  char *p;
+
+  for(i = 0; i < rounds; i++){
+    if((p = sbrk(NPAGES*PGSIZE)) == (char*)-1){
+      printf(1, "kallocbench: sbrk failed\n");
+      exit();
+    }
+    for(j = 0; j < NPAGES; j++)
+      p[j*PGSIZE] = 1;  // fault the page in
+    sbrk(-NPAGES*PGSIZE);
+  }
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, rounds, t0, t1, pages;
+
+  n = argc > 1 ? atoi(argv[1]) : NPROC;
+  rounds = argc > 2 ? atoi(argv[2]) : NROUNDS;
+  if(n <= 0 || rounds <= 0){
+    printf(2, "usage: kallocbench [nproc] [rounds]\n");
+    exit();
+  }
+
+  t0 = uptime();
+  for(i = 0; i < n; i++){
+    if(fork() == 0)
+      churn(rounds);
+  }
+  for(i = 0; i < n; i++)
+    wait();
+  t1 = uptime();
+
+  if(t1 == t0)
+    t1 = t0 + 1;
+  pages = n * rounds * NPAGES;
+  printf(1, "kallocbench: %d procs, %d pages in and out in %d ticks\n",
+         n, pages, t1 - t0);
+  // 100 ticks a second.
+  printf(1, "kallocbench: %d pages/s, %d pages/s per proc\n",
+         pages * 100 / (t1 - t0), pages * 100 / (t1 - t0) / n);
+  exit();
+}
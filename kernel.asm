@@ -0,0 +1,23153 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages,
+  # and global pages for the kernel's mappings
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE|CR4_PGE), %eax
+8010000f:	0d 90 00 00 00       	or     $0x90,%eax
+  movl    %eax, %cr4
+80100014:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100017:	b8 00 d0 10 00       	mov    $0x10d000,%eax
+  movl    %eax, %cr3
+8010001c:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001f:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100022:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100027:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+8010002a:	bc 90 33 1a 80       	mov    $0x801a3390,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002f:	b8 30 4a 10 80       	mov    $0x80104a30,%eax
+  jmp *%eax
+80100034:	ff e0                	jmp    *%eax
+80100036:	66 90                	xchg   %ax,%ax
+80100038:	66 90                	xchg   %ax,%ax
+8010003a:	66 90                	xchg   %ax,%ax
+8010003c:	66 90                	xchg   %ax,%ax
+8010003e:	66 90                	xchg   %ax,%ax
+
+80100040 <bgrow>:
+// them at the cold end of the LRU list, ready for bvictim().
+// Returns 0 if the cache is already at its maximum size.
+// Caller holds bcache.evictlock.
+static int
+bgrow(char *pg)
+{
+80100040:	55                   	push   %ebp
+80100041:	89 e5                	mov    %esp,%ebp
+80100043:	56                   	push   %esi
+80100044:	89 c6                	mov    %eax,%esi
+80100046:	53                   	push   %ebx
+  struct buf *b;
+  int i;
+
+  for(i = 0; i < NBPAGE; i++)
+80100047:	31 db                	xor    %ebx,%ebx
+80100049:	eb 14                	jmp    8010005f <bgrow+0x1f>
+8010004b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010004f:	90                   	nop
+80100050:	83 c3 01             	add    $0x1,%ebx
+80100053:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+80100059:	0f 84 b7 00 00 00    	je     80100116 <bgrow+0xd6>
+    if(bcache.page[i] == 0)
+8010005f:	8b 04 9d 68 30 14 80 	mov    -0x7febcf98(,%ebx,4),%eax
+80100066:	85 c0                	test   %eax,%eax
+80100068:	75 e6                	jne    80100050 <bgrow+0x10>
+      break;
+  if(i == NBPAGE)
+    return 0;
+  bcache.page[i] = pg;
+  bcache.npage++;
+  acquire(&bcache.lock);
+8010006a:	83 ec 0c             	sub    $0xc,%esp
+  bcache.page[i] = pg;
+8010006d:	89 34 9d 68 30 14 80 	mov    %esi,-0x7febcf98(,%ebx,4)
+  for(b = &bcache.buf[i*BPERPAGE]; b < &bcache.buf[(i+1)*BPERPAGE]; b++){
+80100074:	c1 e3 03             	shl    $0x3,%ebx
+  bcache.npage++;
+80100077:	83 05 68 34 14 80 01 	addl   $0x1,0x80143468
+  acquire(&bcache.lock);
+8010007e:	68 00 f0 10 80       	push   $0x8010f000
+80100083:	e8 d8 6c 00 00       	call   80106d60 <acquire>
+  for(b = &bcache.buf[i*BPERPAGE]; b < &bcache.buf[(i+1)*BPERPAGE]; b++){
+80100088:	8d 53 01             	lea    0x1(%ebx),%edx
+8010008b:	83 c3 09             	add    $0x9,%ebx
+8010008e:	83 c4 10             	add    $0x10,%esp
+80100091:	6b d2 68             	imul   $0x68,%edx,%edx
+80100094:	6b c3 68             	imul   $0x68,%ebx,%eax
+80100097:	81 c2 00 f0 10 80    	add    $0x8010f000,%edx
+8010009d:	05 00 f0 10 80       	add    $0x8010f000,%eax
+801000a2:	39 c2                	cmp    %eax,%edx
+801000a4:	73 54                	jae    801000fa <bgrow+0xba>
+801000a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801000ad:	8d 76 00             	lea    0x0(%esi),%esi
+    b->data = (uchar*)pg;
+801000b0:	89 72 64             	mov    %esi,0x64(%edx)
+    pg += BSIZE;
+801000b3:	81 c6 00 02 00 00    	add    $0x200,%esi
+    b->dev = 0;
+801000b9:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+    b->blockno = NOBLOCK;
+801000c0:	c7 42 08 ff ff ff ff 	movl   $0xffffffff,0x8(%edx)
+    b->flags = 0;
+801000c7:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+    b->refcnt = 0;
+801000cd:	c7 42 4c 00 00 00 00 	movl   $0x0,0x4c(%edx)
+    b->prev = bcache.head.prev;
+801000d4:	8b 0d 44 16 15 80    	mov    0x80151644,%ecx
+    b->next = &bcache.head;
+801000da:	c7 42 54 f4 15 15 80 	movl   $0x801515f4,0x54(%edx)
+    b->prev = bcache.head.prev;
+801000e1:	89 4a 50             	mov    %ecx,0x50(%edx)
+    bcache.head.prev->next = b;
+801000e4:	8b 0d 44 16 15 80    	mov    0x80151644,%ecx
+801000ea:	89 51 54             	mov    %edx,0x54(%ecx)
+    bcache.head.prev = b;
+801000ed:	89 15 44 16 15 80    	mov    %edx,0x80151644
+  for(b = &bcache.buf[i*BPERPAGE]; b < &bcache.buf[(i+1)*BPERPAGE]; b++){
+801000f3:	83 c2 68             	add    $0x68,%edx
+801000f6:	39 c2                	cmp    %eax,%edx
+801000f8:	72 b6                	jb     801000b0 <bgrow+0x70>
+  }
+  release(&bcache.lock);
+801000fa:	83 ec 0c             	sub    $0xc,%esp
+801000fd:	68 00 f0 10 80       	push   $0x8010f000
+80100102:	e8 79 6e 00 00       	call   80106f80 <release>
+  return 1;
+80100107:	83 c4 10             	add    $0x10,%esp
+}
+8010010a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return 1;
+8010010d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80100112:	5b                   	pop    %ebx
+80100113:	5e                   	pop    %esi
+80100114:	5d                   	pop    %ebp
+80100115:	c3                   	ret
+80100116:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+80100119:	31 c0                	xor    %eax,%eax
+}
+8010011b:	5b                   	pop    %ebx
+8010011c:	5e                   	pop    %esi
+8010011d:	5d                   	pop    %ebp
+8010011e:	c3                   	ret
+8010011f:	90                   	nop
+
+80100120 <bforget>:
+// Forget the block cached in b if nobody is using it, so that
+// its data page can be reused.  Caller holds bcache.evictlock.
+// Returns 0 if b is busy.
+static int
+bforget(struct buf *b)
+{
+80100120:	55                   	push   %ebp
+80100121:	89 e5                	mov    %esp,%ebp
+80100123:	57                   	push   %edi
+80100124:	56                   	push   %esi
+80100125:	53                   	push   %ebx
+80100126:	89 c3                	mov    %eax,%ebx
+80100128:	83 ec 18             	sub    $0x18,%esp
+  return &bcache.bucket[BHASH(dev, blockno)];
+8010012b:	69 48 04 07 04 00 00 	imul   $0x407,0x4(%eax),%ecx
+80100132:	d1 e9                	shr    %ecx
+80100134:	03 48 08             	add    0x8(%eax),%ecx
+80100137:	b8 57 85 21 7f       	mov    $0x7f218557,%eax
+8010013c:	f7 e1                	mul    %ecx
+8010013e:	c1 ea 09             	shr    $0x9,%edx
+80100141:	69 c2 07 04 00 00    	imul   $0x407,%edx,%eax
+80100147:	29 c1                	sub    %eax,%ecx
+  struct buf **pp;
+  struct bucket *bk;
+
+  bk = bucketof(b->dev, b->blockno);
+  acquire(&bk->lock);
+80100149:	6b f1 38             	imul   $0x38,%ecx,%esi
+8010014c:	8d be 6c 34 14 80    	lea    -0x7febcb94(%esi),%edi
+80100152:	57                   	push   %edi
+80100153:	e8 08 6c 00 00       	call   80106d60 <acquire>
+  if(b->refcnt != 0 || (b->flags & B_DIRTY)){
+80100158:	8b 43 4c             	mov    0x4c(%ebx),%eax
+8010015b:	83 c4 10             	add    $0x10,%esp
+8010015e:	85 c0                	test   %eax,%eax
+80100160:	75 56                	jne    801001b8 <bforget+0x98>
+80100162:	f6 03 04             	testb  $0x4,(%ebx)
+80100165:	75 51                	jne    801001b8 <bforget+0x98>
+    release(&bk->lock);
+    return 0;
+  }
+  for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+80100167:	8b 86 a0 34 14 80    	mov    -0x7febcb60(%esi),%eax
+8010016d:	85 c0                	test   %eax,%eax
+8010016f:	74 1c                	je     8010018d <bforget+0x6d>
+    if(*pp == b){
+80100171:	39 c3                	cmp    %eax,%ebx
+80100173:	75 0f                	jne    80100184 <bforget+0x64>
+80100175:	eb 63                	jmp    801001da <bforget+0xba>
+80100177:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010017e:	66 90                	xchg   %ax,%ax
+80100180:	39 c3                	cmp    %eax,%ebx
+80100182:	74 4c                	je     801001d0 <bforget+0xb0>
+  for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+80100184:	89 c2                	mov    %eax,%edx
+80100186:	8b 40 58             	mov    0x58(%eax),%eax
+80100189:	85 c0                	test   %eax,%eax
+8010018b:	75 f3                	jne    80100180 <bforget+0x60>
+      break;
+    }
+  }
+  b->blockno = NOBLOCK;
+  b->flags = 0;
+  release(&bk->lock);
+8010018d:	83 ec 0c             	sub    $0xc,%esp
+  b->blockno = NOBLOCK;
+80100190:	c7 43 08 ff ff ff ff 	movl   $0xffffffff,0x8(%ebx)
+  b->flags = 0;
+80100197:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  release(&bk->lock);
+8010019d:	57                   	push   %edi
+8010019e:	e8 dd 6d 00 00       	call   80106f80 <release>
+  return 1;
+801001a3:	83 c4 10             	add    $0x10,%esp
+}
+801001a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 1;
+801001a9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+801001ae:	5b                   	pop    %ebx
+801001af:	5e                   	pop    %esi
+801001b0:	5f                   	pop    %edi
+801001b1:	5d                   	pop    %ebp
+801001b2:	c3                   	ret
+801001b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801001b7:	90                   	nop
+    release(&bk->lock);
+801001b8:	83 ec 0c             	sub    $0xc,%esp
+801001bb:	57                   	push   %edi
+801001bc:	e8 bf 6d 00 00       	call   80106f80 <release>
+    return 0;
+801001c1:	83 c4 10             	add    $0x10,%esp
+}
+801001c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+801001c7:	31 c0                	xor    %eax,%eax
+}
+801001c9:	5b                   	pop    %ebx
+801001ca:	5e                   	pop    %esi
+801001cb:	5f                   	pop    %edi
+801001cc:	5d                   	pop    %ebp
+801001cd:	c3                   	ret
+801001ce:	66 90                	xchg   %ax,%ax
+  for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+801001d0:	83 c2 58             	add    $0x58,%edx
+      *pp = b->hnext;
+801001d3:	8b 43 58             	mov    0x58(%ebx),%eax
+801001d6:	89 02                	mov    %eax,(%edx)
+      break;
+801001d8:	eb b3                	jmp    8010018d <bforget+0x6d>
+  for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+801001da:	8d 96 a0 34 14 80    	lea    -0x7febcb60(%esi),%edx
+801001e0:	eb f1                	jmp    801001d3 <bforget+0xb3>
+801001e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801001e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801001f0 <bput>:
+
+// Drop a reference to b; the last one puts it on the MRU end
+// of the list of buffers that may be recycled.
+static void
+bput(struct buf *b)
+{
+801001f0:	55                   	push   %ebp
+801001f1:	89 e5                	mov    %esp,%ebp
+801001f3:	56                   	push   %esi
+801001f4:	89 c6                	mov    %eax,%esi
+801001f6:	53                   	push   %ebx
+  return &bcache.bucket[BHASH(dev, blockno)];
+801001f7:	69 48 04 07 04 00 00 	imul   $0x407,0x4(%eax),%ecx
+801001fe:	d1 e9                	shr    %ecx
+80100200:	03 48 08             	add    0x8(%eax),%ecx
+80100203:	b8 57 85 21 7f       	mov    $0x7f218557,%eax
+  struct bucket *bk;
+
+  // b's identity cannot change while we hold a reference,
+  // so its bucket is stable.
+  bk = bucketof(b->dev, b->blockno);
+  acquire(&bk->lock);
+80100208:	83 ec 0c             	sub    $0xc,%esp
+  return &bcache.bucket[BHASH(dev, blockno)];
+8010020b:	f7 e1                	mul    %ecx
+8010020d:	c1 ea 09             	shr    $0x9,%edx
+80100210:	69 d2 07 04 00 00    	imul   $0x407,%edx,%edx
+80100216:	29 d1                	sub    %edx,%ecx
+  acquire(&bk->lock);
+80100218:	6b d9 38             	imul   $0x38,%ecx,%ebx
+8010021b:	81 c3 6c 34 14 80    	add    $0x8014346c,%ebx
+80100221:	53                   	push   %ebx
+80100222:	e8 39 6b 00 00       	call   80106d60 <acquire>
+  b->refcnt--;
+80100227:	8b 46 4c             	mov    0x4c(%esi),%eax
+  if (b->refcnt == 0) {
+8010022a:	83 c4 10             	add    $0x10,%esp
+  b->refcnt--;
+8010022d:	83 e8 01             	sub    $0x1,%eax
+80100230:	89 46 4c             	mov    %eax,0x4c(%esi)
+  if (b->refcnt == 0) {
+80100233:	85 c0                	test   %eax,%eax
+80100235:	74 19                	je     80100250 <bput+0x60>
+    b->prev = &bcache.head;
+    bcache.head.next->prev = b;
+    bcache.head.next = b;
+    release(&bcache.lock);
+  }
+  release(&bk->lock);
+80100237:	83 ec 0c             	sub    $0xc,%esp
+8010023a:	53                   	push   %ebx
+8010023b:	e8 40 6d 00 00       	call   80106f80 <release>
+}
+80100240:	83 c4 10             	add    $0x10,%esp
+80100243:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100246:	5b                   	pop    %ebx
+80100247:	5e                   	pop    %esi
+80100248:	5d                   	pop    %ebp
+80100249:	c3                   	ret
+8010024a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    acquire(&bcache.lock);
+80100250:	83 ec 0c             	sub    $0xc,%esp
+80100253:	68 00 f0 10 80       	push   $0x8010f000
+80100258:	e8 03 6b 00 00       	call   80106d60 <acquire>
+    b->next = bcache.head.next;
+8010025d:	a1 48 16 15 80       	mov    0x80151648,%eax
+    b->prev = &bcache.head;
+80100262:	c7 46 50 f4 15 15 80 	movl   $0x801515f4,0x50(%esi)
+    b->next = bcache.head.next;
+80100269:	89 46 54             	mov    %eax,0x54(%esi)
+    bcache.head.next->prev = b;
+8010026c:	a1 48 16 15 80       	mov    0x80151648,%eax
+80100271:	89 70 50             	mov    %esi,0x50(%eax)
+    bcache.head.next = b;
+80100274:	89 35 48 16 15 80    	mov    %esi,0x80151648
+    release(&bcache.lock);
+8010027a:	c7 04 24 00 f0 10 80 	movl   $0x8010f000,(%esp)
+80100281:	e8 fa 6c 00 00       	call   80106f80 <release>
+80100286:	83 c4 10             	add    $0x10,%esp
+80100289:	eb ac                	jmp    80100237 <bput+0x47>
+8010028b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010028f:	90                   	nop
+
+80100290 <blookup.isra.0>:
+  for(b = bk->head; b; b = b->hnext){
+80100290:	85 c0                	test   %eax,%eax
+80100292:	75 13                	jne    801002a7 <blookup.isra.0+0x17>
+80100294:	eb 28                	jmp    801002be <blookup.isra.0+0x2e>
+80100296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010029d:	8d 76 00             	lea    0x0(%esi),%esi
+801002a0:	8b 40 58             	mov    0x58(%eax),%eax
+801002a3:	85 c0                	test   %eax,%eax
+801002a5:	74 19                	je     801002c0 <blookup.isra.0+0x30>
+    if(b->dev == dev && b->blockno == blockno){
+801002a7:	39 50 04             	cmp    %edx,0x4(%eax)
+801002aa:	75 f4                	jne    801002a0 <blookup.isra.0+0x10>
+801002ac:	39 48 08             	cmp    %ecx,0x8(%eax)
+801002af:	75 ef                	jne    801002a0 <blookup.isra.0+0x10>
+      if(b->refcnt++ == 0){
+801002b1:	8b 50 4c             	mov    0x4c(%eax),%edx
+801002b4:	8d 4a 01             	lea    0x1(%edx),%ecx
+801002b7:	89 48 4c             	mov    %ecx,0x4c(%eax)
+801002ba:	85 d2                	test   %edx,%edx
+801002bc:	74 03                	je     801002c1 <blookup.isra.0+0x31>
+}
+801002be:	c3                   	ret
+801002bf:	90                   	nop
+801002c0:	c3                   	ret
+blookup(struct bucket *bk, uint dev, uint blockno)
+801002c1:	55                   	push   %ebp
+801002c2:	89 e5                	mov    %esp,%ebp
+801002c4:	83 ec 24             	sub    $0x24,%esp
+801002c7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        acquire(&bcache.lock);
+801002ca:	68 00 f0 10 80       	push   $0x8010f000
+801002cf:	e8 8c 6a 00 00       	call   80106d60 <acquire>
+        b->next->prev = b->prev;
+801002d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801002d7:	8b 48 54             	mov    0x54(%eax),%ecx
+801002da:	8b 50 50             	mov    0x50(%eax),%edx
+801002dd:	89 51 50             	mov    %edx,0x50(%ecx)
+        b->prev->next = b->next;
+801002e0:	8b 48 54             	mov    0x54(%eax),%ecx
+801002e3:	89 4a 54             	mov    %ecx,0x54(%edx)
+        release(&bcache.lock);
+801002e6:	c7 04 24 00 f0 10 80 	movl   $0x8010f000,(%esp)
+801002ed:	e8 8e 6c 00 00       	call   80106f80 <release>
+801002f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801002f5:	83 c4 10             	add    $0x10,%esp
+}
+801002f8:	c9                   	leave
+801002f9:	c3                   	ret
+801002fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80100300 <bfind>:
+{
+80100300:	55                   	push   %ebp
+80100301:	89 e5                	mov    %esp,%ebp
+80100303:	57                   	push   %edi
+80100304:	89 c7                	mov    %eax,%edi
+80100306:	56                   	push   %esi
+80100307:	53                   	push   %ebx
+80100308:	89 d3                	mov    %edx,%ebx
+8010030a:	83 ec 38             	sub    $0x38,%esp
+8010030d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  return &bcache.bucket[BHASH(dev, blockno)];
+80100310:	69 c8 07 04 00 00    	imul   $0x407,%eax,%ecx
+{
+80100316:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  return &bcache.bucket[BHASH(dev, blockno)];
+80100319:	b8 57 85 21 7f       	mov    $0x7f218557,%eax
+{
+8010031e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  return &bcache.bucket[BHASH(dev, blockno)];
+80100321:	d1 e9                	shr    %ecx
+80100323:	01 d1                	add    %edx,%ecx
+80100325:	f7 e1                	mul    %ecx
+80100327:	89 ce                	mov    %ecx,%esi
+80100329:	c1 ea 09             	shr    $0x9,%edx
+8010032c:	69 c2 07 04 00 00    	imul   $0x407,%edx,%eax
+80100332:	29 c6                	sub    %eax,%esi
+  *fresh = 0;
+80100334:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  return &bcache.bucket[BHASH(dev, blockno)];
+80100337:	89 75 d8             	mov    %esi,-0x28(%ebp)
+8010033a:	6b f6 38             	imul   $0x38,%esi,%esi
+  *fresh = 0;
+8010033d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  return &bcache.bucket[BHASH(dev, blockno)];
+80100343:	81 c6 6c 34 14 80    	add    $0x8014346c,%esi
+  acquire(&bk->lock);
+80100349:	56                   	push   %esi
+8010034a:	e8 11 6a 00 00       	call   80106d60 <acquire>
+  b = blookup(bk, dev, blockno);
+8010034f:	8b 46 34             	mov    0x34(%esi),%eax
+80100352:	89 d9                	mov    %ebx,%ecx
+80100354:	89 fa                	mov    %edi,%edx
+80100356:	e8 35 ff ff ff       	call   80100290 <blookup.isra.0>
+  release(&bk->lock);
+8010035b:	89 34 24             	mov    %esi,(%esp)
+  b = blookup(bk, dev, blockno);
+8010035e:	89 c3                	mov    %eax,%ebx
+  release(&bk->lock);
+80100360:	e8 1b 6c 00 00       	call   80106f80 <release>
+  if(b)
+80100365:	83 c4 10             	add    $0x10,%esp
+80100368:	85 db                	test   %ebx,%ebx
+8010036a:	74 14                	je     80100380 <bfind+0x80>
+}
+8010036c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010036f:	89 d8                	mov    %ebx,%eax
+80100371:	5b                   	pop    %ebx
+80100372:	5e                   	pop    %esi
+80100373:	5f                   	pop    %edi
+80100374:	5d                   	pop    %ebp
+80100375:	c3                   	ret
+80100376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010037d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(bcache.npage < NBPAGE && kfreepages() > BCACHEMINFREE)
+80100380:	81 3d 68 34 14 80 ff 	cmpl   $0xff,0x80143468
+80100387:	00 00 00 
+8010038a:	0f 8e 1d 01 00 00    	jle    801004ad <bfind+0x1ad>
+  acquire(&bcache.evictlock);
+80100390:	83 ec 0c             	sub    $0xc,%esp
+80100393:	68 34 f0 10 80       	push   $0x8010f034
+80100398:	e8 c3 69 00 00       	call   80106d60 <acquire>
+8010039d:	83 c4 10             	add    $0x10,%esp
+  acquire(&bk->lock);
+801003a0:	83 ec 0c             	sub    $0xc,%esp
+801003a3:	56                   	push   %esi
+801003a4:	e8 b7 69 00 00       	call   80106d60 <acquire>
+  b = blookup(bk, dev, blockno);
+801003a9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+801003ac:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801003af:	8b 46 34             	mov    0x34(%esi),%eax
+801003b2:	e8 d9 fe ff ff       	call   80100290 <blookup.isra.0>
+801003b7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801003ba:	89 c7                	mov    %eax,%edi
+  release(&bk->lock);
+801003bc:	89 34 24             	mov    %esi,(%esp)
+801003bf:	e8 bc 6b 00 00       	call   80106f80 <release>
+  if(b == 0){
+801003c4:	83 c4 10             	add    $0x10,%esp
+801003c7:	85 ff                	test   %edi,%edi
+801003c9:	0f 85 c1 00 00 00    	jne    80100490 <bfind+0x190>
+  return &bcache.bucket[BHASH(dev, blockno)];
+801003cf:	89 75 d0             	mov    %esi,-0x30(%ebp)
+801003d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    acquire(&bcache.lock);
+801003d8:	83 ec 0c             	sub    $0xc,%esp
+801003db:	68 00 f0 10 80       	push   $0x8010f000
+801003e0:	e8 7b 69 00 00       	call   80106d60 <acquire>
+    for(b = bcache.head.prev; b != &bcache.head; b = b->prev)
+801003e5:	8b 1d 44 16 15 80    	mov    0x80151644,%ebx
+801003eb:	83 c4 10             	add    $0x10,%esp
+801003ee:	81 fb f4 15 15 80    	cmp    $0x801515f4,%ebx
+801003f4:	75 19                	jne    8010040f <bfind+0x10f>
+801003f6:	e9 22 02 00 00       	jmp    8010061d <bfind+0x31d>
+801003fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801003ff:	90                   	nop
+80100400:	8b 5b 50             	mov    0x50(%ebx),%ebx
+80100403:	81 fb f4 15 15 80    	cmp    $0x801515f4,%ebx
+80100409:	0f 84 0e 02 00 00    	je     8010061d <bfind+0x31d>
+      if((b->flags & B_DIRTY) == 0)
+8010040f:	f6 03 04             	testb  $0x4,(%ebx)
+80100412:	75 ec                	jne    80100400 <bfind+0x100>
+    release(&bcache.lock);
+80100414:	83 ec 0c             	sub    $0xc,%esp
+80100417:	68 00 f0 10 80       	push   $0x8010f000
+8010041c:	e8 5f 6b 00 00       	call   80106f80 <release>
+    if(b == &bcache.head)
+80100421:	83 c4 10             	add    $0x10,%esp
+80100424:	81 fb f4 15 15 80    	cmp    $0x801515f4,%ebx
+8010042a:	0f 84 fd 01 00 00    	je     8010062d <bfind+0x32d>
+  return &bcache.bucket[BHASH(dev, blockno)];
+80100430:	69 4b 04 07 04 00 00 	imul   $0x407,0x4(%ebx),%ecx
+80100437:	b8 57 85 21 7f       	mov    $0x7f218557,%eax
+    acquire(&bk->lock);
+8010043c:	83 ec 0c             	sub    $0xc,%esp
+  return &bcache.bucket[BHASH(dev, blockno)];
+8010043f:	d1 e9                	shr    %ecx
+80100441:	03 4b 08             	add    0x8(%ebx),%ecx
+80100444:	f7 e1                	mul    %ecx
+80100446:	c1 ea 09             	shr    $0x9,%edx
+80100449:	69 c2 07 04 00 00    	imul   $0x407,%edx,%eax
+8010044f:	89 ca                	mov    %ecx,%edx
+80100451:	29 c2                	sub    %eax,%edx
+    acquire(&bk->lock);
+80100453:	6b fa 38             	imul   $0x38,%edx,%edi
+80100456:	8d b7 6c 34 14 80    	lea    -0x7febcb94(%edi),%esi
+8010045c:	56                   	push   %esi
+8010045d:	e8 fe 68 00 00       	call   80106d60 <acquire>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+80100462:	8b 53 4c             	mov    0x4c(%ebx),%edx
+80100465:	83 c4 10             	add    $0x10,%esp
+80100468:	85 d2                	test   %edx,%edx
+8010046a:	75 09                	jne    80100475 <bfind+0x175>
+8010046c:	f6 03 04             	testb  $0x4,(%ebx)
+8010046f:	0f 84 bb 00 00 00    	je     80100530 <bfind+0x230>
+    release(&bk->lock);
+80100475:	83 ec 0c             	sub    $0xc,%esp
+80100478:	56                   	push   %esi
+80100479:	e8 02 6b 00 00       	call   80106f80 <release>
+    acquire(&bcache.lock);
+8010047e:	83 c4 10             	add    $0x10,%esp
+80100481:	e9 52 ff ff ff       	jmp    801003d8 <bfind+0xd8>
+80100486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010048d:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&bcache.evictlock);
+80100490:	83 ec 0c             	sub    $0xc,%esp
+80100493:	68 34 f0 10 80       	push   $0x8010f034
+80100498:	e8 e3 6a 00 00       	call   80106f80 <release>
+  b = blookup(bk, dev, blockno);
+8010049d:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  release(&bcache.evictlock);
+801004a0:	83 c4 10             	add    $0x10,%esp
+}
+801004a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801004a6:	89 d8                	mov    %ebx,%eax
+801004a8:	5b                   	pop    %ebx
+801004a9:	5e                   	pop    %esi
+801004aa:	5f                   	pop    %edi
+801004ab:	5d                   	pop    %ebp
+801004ac:	c3                   	ret
+  if(bcache.npage < NBPAGE && kfreepages() > BCACHEMINFREE)
+801004ad:	e8 1e 36 00 00       	call   80103ad0 <kfreepages>
+801004b2:	3d 00 04 00 00       	cmp    $0x400,%eax
+801004b7:	0f 8e d3 fe ff ff    	jle    80100390 <bfind+0x90>
+    pg = kalloc();
+801004bd:	e8 8e 33 00 00       	call   80103850 <kalloc>
+  acquire(&bcache.evictlock);
+801004c2:	83 ec 0c             	sub    $0xc,%esp
+    pg = kalloc();
+801004c5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801004c8:	89 c7                	mov    %eax,%edi
+  acquire(&bcache.evictlock);
+801004ca:	68 34 f0 10 80       	push   $0x8010f034
+801004cf:	e8 8c 68 00 00       	call   80106d60 <acquire>
+  if(pg && bgrow(pg))
+801004d4:	83 c4 10             	add    $0x10,%esp
+801004d7:	89 f8                	mov    %edi,%eax
+801004d9:	85 ff                	test   %edi,%edi
+801004db:	0f 84 bf fe ff ff    	je     801003a0 <bfind+0xa0>
+801004e1:	e8 5a fb ff ff       	call   80100040 <bgrow>
+801004e6:	85 c0                	test   %eax,%eax
+801004e8:	0f 85 b2 fe ff ff    	jne    801003a0 <bfind+0xa0>
+  acquire(&bk->lock);
+801004ee:	83 ec 0c             	sub    $0xc,%esp
+801004f1:	56                   	push   %esi
+801004f2:	e8 69 68 00 00       	call   80106d60 <acquire>
+  b = blookup(bk, dev, blockno);
+801004f7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+801004fa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801004fd:	8b 46 34             	mov    0x34(%esi),%eax
+80100500:	e8 8b fd ff ff       	call   80100290 <blookup.isra.0>
+  release(&bk->lock);
+80100505:	89 34 24             	mov    %esi,(%esp)
+  b = blookup(bk, dev, blockno);
+80100508:	89 c3                	mov    %eax,%ebx
+  release(&bk->lock);
+8010050a:	e8 71 6a 00 00       	call   80106f80 <release>
+  if(b == 0){
+8010050f:	83 c4 10             	add    $0x10,%esp
+80100512:	85 db                	test   %ebx,%ebx
+80100514:	0f 84 b5 fe ff ff    	je     801003cf <bfind+0xcf>
+  release(&bcache.evictlock);
+8010051a:	83 ec 0c             	sub    $0xc,%esp
+8010051d:	68 34 f0 10 80       	push   $0x8010f034
+80100522:	e8 59 6a 00 00       	call   80106f80 <release>
+80100527:	83 c4 10             	add    $0x10,%esp
+8010052a:	e9 c1 00 00 00       	jmp    801005f0 <bfind+0x2f0>
+8010052f:	90                   	nop
+      for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+80100530:	89 fa                	mov    %edi,%edx
+80100532:	89 f7                	mov    %esi,%edi
+80100534:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80100537:	8b 8a a0 34 14 80    	mov    -0x7febcb60(%edx),%ecx
+8010053d:	85 c9                	test   %ecx,%ecx
+8010053f:	74 20                	je     80100561 <bfind+0x261>
+        if(*pp == b){
+80100541:	39 d9                	cmp    %ebx,%ecx
+80100543:	75 13                	jne    80100558 <bfind+0x258>
+80100545:	e9 cb 00 00 00       	jmp    80100615 <bfind+0x315>
+8010054a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80100550:	39 cb                	cmp    %ecx,%ebx
+80100552:	0f 84 b0 00 00 00    	je     80100608 <bfind+0x308>
+      for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+80100558:	89 ca                	mov    %ecx,%edx
+8010055a:	8b 49 58             	mov    0x58(%ecx),%ecx
+8010055d:	85 c9                	test   %ecx,%ecx
+8010055f:	75 ef                	jne    80100550 <bfind+0x250>
+      acquire(&bcache.lock);
+80100561:	83 ec 0c             	sub    $0xc,%esp
+80100564:	68 00 f0 10 80       	push   $0x8010f000
+80100569:	e8 f2 67 00 00       	call   80106d60 <acquire>
+      b->next->prev = b->prev;
+8010056e:	8b 53 50             	mov    0x50(%ebx),%edx
+80100571:	8b 4b 54             	mov    0x54(%ebx),%ecx
+80100574:	89 51 50             	mov    %edx,0x50(%ecx)
+      b->prev->next = b->next;
+80100577:	8b 4b 54             	mov    0x54(%ebx),%ecx
+8010057a:	89 4a 54             	mov    %ecx,0x54(%edx)
+      release(&bcache.lock);
+8010057d:	c7 04 24 00 f0 10 80 	movl   $0x8010f000,(%esp)
+80100584:	e8 f7 69 00 00       	call   80106f80 <release>
+      release(&bk->lock);
+80100589:	89 3c 24             	mov    %edi,(%esp)
+8010058c:	e8 ef 69 00 00       	call   80106f80 <release>
+    b->dev = dev;
+80100591:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    b->flags = 0;
+80100594:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    b->refcnt = 1;
+8010059a:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+    b->dev = dev;
+801005a1:	89 43 04             	mov    %eax,0x4(%ebx)
+    b->blockno = blockno;
+801005a4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801005a7:	89 43 08             	mov    %eax,0x8(%ebx)
+    acquire(&bk->lock);
+801005aa:	89 34 24             	mov    %esi,(%esp)
+801005ad:	e8 ae 67 00 00       	call   80106d60 <acquire>
+    b->hnext = bk->head;
+801005b2:	6b 45 d8 38          	imul   $0x38,-0x28(%ebp),%eax
+801005b6:	8b 90 a0 34 14 80    	mov    -0x7febcb60(%eax),%edx
+801005bc:	89 53 58             	mov    %edx,0x58(%ebx)
+    bk->head = b;
+801005bf:	89 98 a0 34 14 80    	mov    %ebx,-0x7febcb60(%eax)
+    release(&bk->lock);
+801005c5:	89 34 24             	mov    %esi,(%esp)
+801005c8:	e8 b3 69 00 00       	call   80106f80 <release>
+    *fresh = 1;
+801005cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801005d0:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  release(&bcache.evictlock);
+801005d6:	c7 04 24 34 f0 10 80 	movl   $0x8010f034,(%esp)
+801005dd:	e8 9e 69 00 00       	call   80106f80 <release>
+  if(pg)
+801005e2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801005e5:	83 c4 10             	add    $0x10,%esp
+801005e8:	85 c0                	test   %eax,%eax
+801005ea:	0f 84 7c fd ff ff    	je     8010036c <bfind+0x6c>
+    kfree(pg);
+801005f0:	83 ec 0c             	sub    $0xc,%esp
+801005f3:	ff 75 d4             	push   -0x2c(%ebp)
+801005f6:	e8 b5 2f 00 00       	call   801035b0 <kfree>
+801005fb:	83 c4 10             	add    $0x10,%esp
+}
+801005fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100601:	89 d8                	mov    %ebx,%eax
+80100603:	5b                   	pop    %ebx
+80100604:	5e                   	pop    %esi
+80100605:	5f                   	pop    %edi
+80100606:	5d                   	pop    %ebp
+80100607:	c3                   	ret
+      for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+80100608:	83 c2 58             	add    $0x58,%edx
+          *pp = b->hnext;
+8010060b:	8b 4b 58             	mov    0x58(%ebx),%ecx
+8010060e:	89 0a                	mov    %ecx,(%edx)
+          break;
+80100610:	e9 4c ff ff ff       	jmp    80100561 <bfind+0x261>
+      for(pp = &bk->head; *pp; pp = &(*pp)->hnext){
+80100615:	81 c2 a0 34 14 80    	add    $0x801434a0,%edx
+8010061b:	eb ee                	jmp    8010060b <bfind+0x30b>
+    release(&bcache.lock);
+8010061d:	83 ec 0c             	sub    $0xc,%esp
+80100620:	68 00 f0 10 80       	push   $0x8010f000
+80100625:	e8 56 69 00 00       	call   80106f80 <release>
+8010062a:	83 c4 10             	add    $0x10,%esp
+      panic("bget: no buffers");
+8010062d:	83 ec 0c             	sub    $0xc,%esp
+80100630:	68 20 b4 10 80       	push   $0x8010b420
+80100635:	e8 86 05 00 00       	call   80100bc0 <panic>
+8010063a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80100640 <binit>:
+{
+80100640:	55                   	push   %ebp
+80100641:	89 e5                	mov    %esp,%ebp
+80100643:	53                   	push   %ebx
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+80100644:	bb 6c 34 14 80       	mov    $0x8014346c,%ebx
+{
+80100649:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&bcache.lock, "bcache");
+8010064c:	68 31 b4 10 80       	push   $0x8010b431
+80100651:	68 00 f0 10 80       	push   $0x8010f000
+80100656:	e8 e5 66 00 00       	call   80106d40 <initlock>
+  initlock(&bcache.evictlock, "bcache.evict");
+8010065b:	58                   	pop    %eax
+8010065c:	5a                   	pop    %edx
+8010065d:	68 38 b4 10 80       	push   $0x8010b438
+80100662:	68 34 f0 10 80       	push   $0x8010f034
+80100667:	e8 d4 66 00 00       	call   80106d40 <initlock>
+8010066c:	83 c4 10             	add    $0x10,%esp
+8010066f:	90                   	nop
+    initlock(&bk->lock, "bcache.bucket");
+80100670:	83 ec 08             	sub    $0x8,%esp
+80100673:	68 45 b4 10 80       	push   $0x8010b445
+80100678:	53                   	push   %ebx
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+80100679:	83 c3 38             	add    $0x38,%ebx
+    initlock(&bk->lock, "bcache.bucket");
+8010067c:	e8 bf 66 00 00       	call   80106d40 <initlock>
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+80100681:	83 c4 10             	add    $0x10,%esp
+80100684:	81 fb f4 15 15 80    	cmp    $0x801515f4,%ebx
+8010068a:	75 e4                	jne    80100670 <binit+0x30>
+  bcache.head.prev = &bcache.head;
+8010068c:	c7 05 44 16 15 80 f4 	movl   $0x801515f4,0x80151644
+80100693:	15 15 80 
+  bcache.head.next = &bcache.head;
+80100696:	bb 74 f0 10 80       	mov    $0x8010f074,%ebx
+8010069b:	c7 05 48 16 15 80 f4 	movl   $0x801515f4,0x80151648
+801006a2:	15 15 80 
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801006a5:	8d 76 00             	lea    0x0(%esi),%esi
+    initsleeplock(&b->lock, "buffer");
+801006a8:	83 ec 08             	sub    $0x8,%esp
+    b->blockno = NOBLOCK;
+801006ab:	c7 43 fc ff ff ff ff 	movl   $0xffffffff,-0x4(%ebx)
+    initsleeplock(&b->lock, "buffer");
+801006b2:	68 53 b4 10 80       	push   $0x8010b453
+801006b7:	53                   	push   %ebx
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801006b8:	83 c3 68             	add    $0x68,%ebx
+    initsleeplock(&b->lock, "buffer");
+801006bb:	e8 70 65 00 00       	call   80106c30 <initsleeplock>
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801006c0:	83 c4 10             	add    $0x10,%esp
+801006c3:	81 fb 74 30 14 80    	cmp    $0x80143074,%ebx
+801006c9:	75 dd                	jne    801006a8 <binit+0x68>
+801006cb:	bb 00 20 15 80       	mov    $0x80152000,%ebx
+    bgrow(floorpage[i]);
+801006d0:	89 d8                	mov    %ebx,%eax
+  for(i = 0; i < NBFLOOR; i++)
+801006d2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    bgrow(floorpage[i]);
+801006d8:	e8 63 f9 ff ff       	call   80100040 <bgrow>
+  for(i = 0; i < NBFLOOR; i++)
+801006dd:	81 fb 00 a0 15 80    	cmp    $0x8015a000,%ebx
+801006e3:	75 eb                	jne    801006d0 <binit+0x90>
+}
+801006e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801006e8:	c9                   	leave
+801006e9:	c3                   	ret
+801006ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801006f0 <bshrink>:
+{
+801006f0:	55                   	push   %ebp
+801006f1:	89 e5                	mov    %esp,%ebp
+801006f3:	57                   	push   %edi
+801006f4:	56                   	push   %esi
+801006f5:	53                   	push   %ebx
+801006f6:	83 ec 48             	sub    $0x48,%esp
+  acquire(&bcache.evictlock);
+801006f9:	68 34 f0 10 80       	push   $0x8010f034
+801006fe:	e8 5d 66 00 00       	call   80106d60 <acquire>
+  for(i = NBFLOOR; i < NBPAGE && nfreed < n && nfreed < NELEM(freed); i++){
+80100703:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80100706:	83 c4 10             	add    $0x10,%esp
+80100709:	85 c9                	test   %ecx,%ecx
+8010070b:	0f 8e aa 01 00 00    	jle    801008bb <bshrink+0x1cb>
+80100711:	bb a8 0d 11 80       	mov    $0x80110da8,%ebx
+  nfreed = 0;
+80100716:	31 c9                	xor    %ecx,%ecx
+  for(i = NBFLOOR; i < NBPAGE && nfreed < n && nfreed < NELEM(freed); i++){
+80100718:	be 08 00 00 00       	mov    $0x8,%esi
+8010071d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(bcache.page[i] == 0)
+80100720:	8b 04 b5 68 30 14 80 	mov    -0x7febcf98(,%esi,4),%eax
+    e = &bcache.buf[(i+1)*BPERPAGE];
+80100727:	83 c6 01             	add    $0x1,%esi
+    if(bcache.page[i] == 0)
+8010072a:	85 c0                	test   %eax,%eax
+8010072c:	74 21                	je     8010074f <bshrink+0x5f>
+    for(b = &bcache.buf[i*BPERPAGE]; b < e && idle; b++)
+8010072e:	8d bb c0 fc ff ff    	lea    -0x340(%ebx),%edi
+80100734:	81 fb 3f 03 00 00    	cmp    $0x33f,%ebx
+8010073a:	0f 86 60 01 00 00    	jbe    801008a0 <bshrink+0x1b0>
+80100740:	89 f8                	mov    %edi,%eax
+80100742:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      idle = b->refcnt == 0 && (b->flags & B_DIRTY) == 0;
+80100748:	8b 50 4c             	mov    0x4c(%eax),%edx
+8010074b:	85 d2                	test   %edx,%edx
+8010074d:	74 29                	je     80100778 <bshrink+0x88>
+  for(i = NBFLOOR; i < NBPAGE && nfreed < n && nfreed < NELEM(freed); i++){
+8010074f:	39 4d 08             	cmp    %ecx,0x8(%ebp)
+80100752:	0f 8e 2e 01 00 00    	jle    80100886 <bshrink+0x196>
+80100758:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+8010075e:	0f 8f 22 01 00 00    	jg     80100886 <bshrink+0x196>
+80100764:	81 c3 40 03 00 00    	add    $0x340,%ebx
+8010076a:	89 cf                	mov    %ecx,%edi
+8010076c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+{
+80100770:	89 f9                	mov    %edi,%ecx
+80100772:	eb ac                	jmp    80100720 <bshrink+0x30>
+80100774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      idle = b->refcnt == 0 && (b->flags & B_DIRTY) == 0;
+80100778:	8b 10                	mov    (%eax),%edx
+    for(b = &bcache.buf[i*BPERPAGE]; b < e && idle; b++)
+8010077a:	83 c0 68             	add    $0x68,%eax
+      idle = b->refcnt == 0 && (b->flags & B_DIRTY) == 0;
+8010077d:	83 e2 04             	and    $0x4,%edx
+    for(b = &bcache.buf[i*BPERPAGE]; b < e && idle; b++)
+80100780:	39 d8                	cmp    %ebx,%eax
+80100782:	73 06                	jae    8010078a <bshrink+0x9a>
+80100784:	85 d2                	test   %edx,%edx
+80100786:	74 c0                	je     80100748 <bshrink+0x58>
+80100788:	eb c5                	jmp    8010074f <bshrink+0x5f>
+    if(!idle)
+8010078a:	85 d2                	test   %edx,%edx
+8010078c:	75 c1                	jne    8010074f <bshrink+0x5f>
+    for(b = &bcache.buf[i*BPERPAGE]; b < e; b++)
+8010078e:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+80100791:	89 fe                	mov    %edi,%esi
+80100793:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+80100796:	eb 0f                	jmp    801007a7 <bshrink+0xb7>
+80100798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010079f:	90                   	nop
+801007a0:	83 c6 68             	add    $0x68,%esi
+801007a3:	39 de                	cmp    %ebx,%esi
+801007a5:	73 19                	jae    801007c0 <bshrink+0xd0>
+      if(!bforget(b))
+801007a7:	89 f0                	mov    %esi,%eax
+801007a9:	e8 72 f9 ff ff       	call   80100120 <bforget>
+801007ae:	85 c0                	test   %eax,%eax
+801007b0:	75 ee                	jne    801007a0 <bshrink+0xb0>
+    if(b < e)
+801007b2:	89 f2                	mov    %esi,%edx
+801007b4:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+801007b7:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+801007ba:	39 da                	cmp    %ebx,%edx
+801007bc:	72 91                	jb     8010074f <bshrink+0x5f>
+801007be:	eb 06                	jmp    801007c6 <bshrink+0xd6>
+801007c0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+801007c3:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+    acquire(&bcache.lock);
+801007c6:	83 ec 0c             	sub    $0xc,%esp
+801007c9:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+801007cc:	68 00 f0 10 80       	push   $0x8010f000
+801007d1:	e8 8a 65 00 00       	call   80106d60 <acquire>
+    for(b = &bcache.buf[i*BPERPAGE]; b < e; b++){
+801007d6:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+    acquire(&bcache.lock);
+801007d9:	83 c4 10             	add    $0x10,%esp
+801007dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      b->next->prev = b->prev;
+801007e0:	8b 57 54             	mov    0x54(%edi),%edx
+801007e3:	8b 47 50             	mov    0x50(%edi),%eax
+    for(b = &bcache.buf[i*BPERPAGE]; b < e; b++){
+801007e6:	83 c7 68             	add    $0x68,%edi
+      b->next->prev = b->prev;
+801007e9:	89 42 50             	mov    %eax,0x50(%edx)
+      b->prev->next = b->next;
+801007ec:	8b 57 ec             	mov    -0x14(%edi),%edx
+801007ef:	89 50 54             	mov    %edx,0x54(%eax)
+      b->data = 0;
+801007f2:	c7 47 fc 00 00 00 00 	movl   $0x0,-0x4(%edi)
+    for(b = &bcache.buf[i*BPERPAGE]; b < e; b++){
+801007f9:	39 df                	cmp    %ebx,%edi
+801007fb:	72 e3                	jb     801007e0 <bshrink+0xf0>
+    release(&bcache.lock);
+801007fd:	83 ec 0c             	sub    $0xc,%esp
+80100800:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+80100803:	68 00 f0 10 80       	push   $0x8010f000
+80100808:	e8 73 67 00 00       	call   80106f80 <release>
+    freed[nfreed++] = bcache.page[i];
+8010080d:	8b 04 b5 64 30 14 80 	mov    -0x7febcf9c(,%esi,4),%eax
+80100814:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  for(i = NBFLOOR; i < NBPAGE && nfreed < n && nfreed < NELEM(freed); i++){
+80100817:	83 c4 10             	add    $0x10,%esp
+    bcache.page[i] = 0;
+8010081a:	c7 04 b5 64 30 14 80 	movl   $0x0,-0x7febcf9c(,%esi,4)
+80100821:	00 00 00 00 
+    freed[nfreed++] = bcache.page[i];
+80100825:	89 44 8d c8          	mov    %eax,-0x38(%ebp,%ecx,4)
+80100829:	8d 79 01             	lea    0x1(%ecx),%edi
+    bcache.npage--;
+8010082c:	83 2d 68 34 14 80 01 	subl   $0x1,0x80143468
+  for(i = NBFLOOR; i < NBPAGE && nfreed < n && nfreed < NELEM(freed); i++){
+80100833:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+80100839:	7f 4d                	jg     80100888 <bshrink+0x198>
+8010083b:	39 7d 08             	cmp    %edi,0x8(%ebp)
+8010083e:	7e 48                	jle    80100888 <bshrink+0x198>
+80100840:	81 c3 40 03 00 00    	add    $0x340,%ebx
+80100846:	83 ff 08             	cmp    $0x8,%edi
+80100849:	0f 85 21 ff ff ff    	jne    80100770 <bshrink+0x80>
+  release(&bcache.evictlock);
+8010084f:	83 ec 0c             	sub    $0xc,%esp
+80100852:	68 34 f0 10 80       	push   $0x8010f034
+80100857:	e8 24 67 00 00       	call   80106f80 <release>
+8010085c:	83 c4 10             	add    $0x10,%esp
+8010085f:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+80100862:	8d 34 bb             	lea    (%ebx,%edi,4),%esi
+80100865:	8d 76 00             	lea    0x0(%esi),%esi
+    kfree(freed[i]);
+80100868:	83 ec 0c             	sub    $0xc,%esp
+8010086b:	ff 33                	push   (%ebx)
+  for(i = 0; i < nfreed; i++)
+8010086d:	83 c3 04             	add    $0x4,%ebx
+    kfree(freed[i]);
+80100870:	e8 3b 2d 00 00       	call   801035b0 <kfree>
+  for(i = 0; i < nfreed; i++)
+80100875:	83 c4 10             	add    $0x10,%esp
+80100878:	39 f3                	cmp    %esi,%ebx
+8010087a:	75 ec                	jne    80100868 <bshrink+0x178>
+}
+8010087c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010087f:	89 f8                	mov    %edi,%eax
+80100881:	5b                   	pop    %ebx
+80100882:	5e                   	pop    %esi
+80100883:	5f                   	pop    %edi
+80100884:	5d                   	pop    %ebp
+80100885:	c3                   	ret
+  for(i = NBFLOOR; i < NBPAGE && nfreed < n && nfreed < NELEM(freed); i++){
+80100886:	89 cf                	mov    %ecx,%edi
+  release(&bcache.evictlock);
+80100888:	83 ec 0c             	sub    $0xc,%esp
+8010088b:	68 34 f0 10 80       	push   $0x8010f034
+80100890:	e8 eb 66 00 00       	call   80106f80 <release>
+  for(i = 0; i < nfreed; i++)
+80100895:	83 c4 10             	add    $0x10,%esp
+80100898:	85 ff                	test   %edi,%edi
+8010089a:	75 c3                	jne    8010085f <bshrink+0x16f>
+8010089c:	eb de                	jmp    8010087c <bshrink+0x18c>
+8010089e:	66 90                	xchg   %ax,%ax
+    acquire(&bcache.lock);
+801008a0:	83 ec 0c             	sub    $0xc,%esp
+801008a3:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+801008a6:	68 00 f0 10 80       	push   $0x8010f000
+801008ab:	e8 b0 64 00 00       	call   80106d60 <acquire>
+    for(b = &bcache.buf[i*BPERPAGE]; b < e; b++){
+801008b0:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+    acquire(&bcache.lock);
+801008b3:	83 c4 10             	add    $0x10,%esp
+801008b6:	e9 42 ff ff ff       	jmp    801007fd <bshrink+0x10d>
+  release(&bcache.evictlock);
+801008bb:	83 ec 0c             	sub    $0xc,%esp
+  nfreed = 0;
+801008be:	31 ff                	xor    %edi,%edi
+  release(&bcache.evictlock);
+801008c0:	68 34 f0 10 80       	push   $0x8010f034
+801008c5:	e8 b6 66 00 00       	call   80106f80 <release>
+801008ca:	83 c4 10             	add    $0x10,%esp
+801008cd:	eb ad                	jmp    8010087c <bshrink+0x18c>
+801008cf:	90                   	nop
+
+801008d0 <bread>:
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+801008d0:	55                   	push   %ebp
+801008d1:	89 e5                	mov    %esp,%ebp
+801008d3:	53                   	push   %ebx
+  b = bfind(dev, blockno, &fresh);
+801008d4:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+{
+801008d7:	83 ec 14             	sub    $0x14,%esp
+  b = bfind(dev, blockno, &fresh);
+801008da:	8b 55 0c             	mov    0xc(%ebp),%edx
+801008dd:	8b 45 08             	mov    0x8(%ebp),%eax
+801008e0:	e8 1b fa ff ff       	call   80100300 <bfind>
+  acquiresleep(&b->lock);
+801008e5:	83 ec 0c             	sub    $0xc,%esp
+  b = bfind(dev, blockno, &fresh);
+801008e8:	89 c3                	mov    %eax,%ebx
+  acquiresleep(&b->lock);
+801008ea:	83 c0 0c             	add    $0xc,%eax
+801008ed:	50                   	push   %eax
+801008ee:	e8 7d 63 00 00       	call   80106c70 <acquiresleep>
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if(!(b->flags & B_VALID)) {
+801008f3:	83 c4 10             	add    $0x10,%esp
+801008f6:	f6 03 02             	testb  $0x2,(%ebx)
+801008f9:	75 25                	jne    80100920 <bread+0x50>
+    statinc(ST_BMISS);
+801008fb:	83 ec 0c             	sub    $0xc,%esp
+801008fe:	6a 03                	push   $0x3
+80100900:	e8 fb 68 00 00       	call   80107200 <statinc>
+    iderw(b);
+80100905:	89 1c 24             	mov    %ebx,(%esp)
+80100908:	e8 53 29 00 00       	call   80103260 <iderw>
+  } else
+    statinc(ST_BHIT);
+  return b;
+}
+8010090d:	89 d8                	mov    %ebx,%eax
+8010090f:	83 c4 10             	add    $0x10,%esp
+80100912:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100915:	c9                   	leave
+80100916:	c3                   	ret
+80100917:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010091e:	66 90                	xchg   %ax,%ax
+    statinc(ST_BHIT);
+80100920:	83 ec 0c             	sub    $0xc,%esp
+80100923:	6a 02                	push   $0x2
+80100925:	e8 d6 68 00 00       	call   80107200 <statinc>
+}
+8010092a:	89 d8                	mov    %ebx,%eax
+    statinc(ST_BHIT);
+8010092c:	83 c4 10             	add    $0x10,%esp
+}
+8010092f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100932:	c9                   	leave
+80100933:	c3                   	ret
+80100934:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010093b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010093f:	90                   	nop
+
+80100940 <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+80100940:	55                   	push   %ebp
+80100941:	89 e5                	mov    %esp,%ebp
+80100943:	53                   	push   %ebx
+80100944:	83 ec 10             	sub    $0x10,%esp
+80100947:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+8010094a:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010094d:	50                   	push   %eax
+8010094e:	e8 bd 63 00 00       	call   80106d10 <holdingsleep>
+80100953:	83 c4 10             	add    $0x10,%esp
+80100956:	85 c0                	test   %eax,%eax
+80100958:	74 0f                	je     80100969 <bwrite+0x29>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+8010095a:	83 0b 04             	orl    $0x4,(%ebx)
+  iderw(b);
+8010095d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80100960:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100963:	c9                   	leave
+  iderw(b);
+80100964:	e9 f7 28 00 00       	jmp    80103260 <iderw>
+    panic("bwrite");
+80100969:	83 ec 0c             	sub    $0xc,%esp
+8010096c:	68 5a b4 10 80       	push   $0x8010b45a
+80100971:	e8 4a 02 00 00       	call   80100bc0 <panic>
+80100976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010097d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100980 <breada>:
+// of the same block may lock it first (making us sleep here) and
+// read it in; then there is nothing left to do.
+// ideintr() hands the buffer back through bdone().
+void
+breada(uint dev, uint blockno)
+{
+80100980:	55                   	push   %ebp
+80100981:	89 e5                	mov    %esp,%ebp
+80100983:	56                   	push   %esi
+80100984:	53                   	push   %ebx
+  struct buf *b;
+  int fresh;
+
+  b = bfind(dev, blockno, &fresh);
+80100985:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+{
+80100988:	83 ec 10             	sub    $0x10,%esp
+  b = bfind(dev, blockno, &fresh);
+8010098b:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010098e:	8b 45 08             	mov    0x8(%ebp),%eax
+80100991:	e8 6a f9 ff ff       	call   80100300 <bfind>
+80100996:	89 c3                	mov    %eax,%ebx
+  if(!fresh){
+80100998:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010099b:	85 c0                	test   %eax,%eax
+8010099d:	74 3d                	je     801009dc <breada+0x5c>
+    bput(b);
+    return;
+  }
+  acquiresleep(&b->lock);
+8010099f:	83 ec 0c             	sub    $0xc,%esp
+801009a2:	8d 73 0c             	lea    0xc(%ebx),%esi
+801009a5:	56                   	push   %esi
+801009a6:	e8 c5 62 00 00       	call   80106c70 <acquiresleep>
+  if(b->flags & B_VALID){
+801009ab:	8b 03                	mov    (%ebx),%eax
+801009ad:	83 c4 10             	add    $0x10,%esp
+801009b0:	a8 02                	test   $0x2,%al
+801009b2:	75 1c                	jne    801009d0 <breada+0x50>
+    releasesleep(&b->lock);
+    bput(b);
+    return;
+  }
+  b->flags |= B_ASYNC;
+801009b4:	83 c8 08             	or     $0x8,%eax
+801009b7:	89 03                	mov    %eax,(%ebx)
+  iderw(b);
+801009b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+801009bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801009bf:	5b                   	pop    %ebx
+801009c0:	5e                   	pop    %esi
+801009c1:	5d                   	pop    %ebp
+  iderw(b);
+801009c2:	e9 99 28 00 00       	jmp    80103260 <iderw>
+801009c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801009ce:	66 90                	xchg   %ax,%ax
+    releasesleep(&b->lock);
+801009d0:	83 ec 0c             	sub    $0xc,%esp
+801009d3:	56                   	push   %esi
+801009d4:	e8 f7 62 00 00       	call   80106cd0 <releasesleep>
+    bput(b);
+801009d9:	83 c4 10             	add    $0x10,%esp
+}
+801009dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    bput(b);
+801009df:	89 d8                	mov    %ebx,%eax
+}
+801009e1:	5b                   	pop    %ebx
+801009e2:	5e                   	pop    %esi
+801009e3:	5d                   	pop    %ebp
+    bput(b);
+801009e4:	e9 07 f8 ff ff       	jmp    801001f0 <bput>
+801009e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801009f0 <bdone>:
+
+// Finish an asynchronous read started by breada().
+// Called by the disk driver, possibly from an interrupt.
+void
+bdone(struct buf *b)
+{
+801009f0:	55                   	push   %ebp
+801009f1:	89 e5                	mov    %esp,%ebp
+801009f3:	53                   	push   %ebx
+801009f4:	83 ec 10             	sub    $0x10,%esp
+801009f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  b->flags &= ~B_ASYNC;
+  releasesleep(&b->lock);
+801009fa:	8d 43 0c             	lea    0xc(%ebx),%eax
+  b->flags &= ~B_ASYNC;
+801009fd:	83 23 f7             	andl   $0xfffffff7,(%ebx)
+  releasesleep(&b->lock);
+80100a00:	50                   	push   %eax
+80100a01:	e8 ca 62 00 00       	call   80106cd0 <releasesleep>
+  bput(b);
+80100a06:	83 c4 10             	add    $0x10,%esp
+80100a09:	89 d8                	mov    %ebx,%eax
+}
+80100a0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100a0e:	c9                   	leave
+  bput(b);
+80100a0f:	e9 dc f7 ff ff       	jmp    801001f0 <bput>
+80100a14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100a1f:	90                   	nop
+
+80100a20 <brelse>:
+
+// Release a locked buffer.
+// Move to the head of the MRU list.
+void
+brelse(struct buf *b)
+{
+80100a20:	55                   	push   %ebp
+80100a21:	89 e5                	mov    %esp,%ebp
+80100a23:	56                   	push   %esi
+80100a24:	53                   	push   %ebx
+80100a25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+80100a28:	8d 73 0c             	lea    0xc(%ebx),%esi
+80100a2b:	83 ec 0c             	sub    $0xc,%esp
+80100a2e:	56                   	push   %esi
+80100a2f:	e8 dc 62 00 00       	call   80106d10 <holdingsleep>
+80100a34:	83 c4 10             	add    $0x10,%esp
+80100a37:	85 c0                	test   %eax,%eax
+80100a39:	74 19                	je     80100a54 <brelse+0x34>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+80100a3b:	83 ec 0c             	sub    $0xc,%esp
+80100a3e:	56                   	push   %esi
+80100a3f:	e8 8c 62 00 00       	call   80106cd0 <releasesleep>
+  bput(b);
+80100a44:	83 c4 10             	add    $0x10,%esp
+}
+80100a47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  bput(b);
+80100a4a:	89 d8                	mov    %ebx,%eax
+}
+80100a4c:	5b                   	pop    %ebx
+80100a4d:	5e                   	pop    %esi
+80100a4e:	5d                   	pop    %ebp
+  bput(b);
+80100a4f:	e9 9c f7 ff ff       	jmp    801001f0 <bput>
+    panic("brelse");
+80100a54:	83 ec 0c             	sub    $0xc,%esp
+80100a57:	68 61 b4 10 80       	push   $0x8010b461
+80100a5c:	e8 5f 01 00 00       	call   80100bc0 <panic>
+80100a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100a6f:	90                   	nop
+
+80100a70 <bdrop>:
+
+// Forget every cached block nobody is using, so that the next
+// reads go to the disk.  Used to benchmark cold reads.
+void
+bdrop(void)
+{
+80100a70:	55                   	push   %ebp
+80100a71:	89 e5                	mov    %esp,%ebp
+80100a73:	53                   	push   %ebx
+  struct buf *b;
+
+  acquire(&bcache.evictlock);
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++)
+80100a74:	bb 68 f0 10 80       	mov    $0x8010f068,%ebx
+{
+80100a79:	83 ec 10             	sub    $0x10,%esp
+  acquire(&bcache.evictlock);
+80100a7c:	68 34 f0 10 80       	push   $0x8010f034
+80100a81:	e8 da 62 00 00       	call   80106d60 <acquire>
+80100a86:	83 c4 10             	add    $0x10,%esp
+80100a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(b->data)
+80100a90:	8b 43 64             	mov    0x64(%ebx),%eax
+80100a93:	85 c0                	test   %eax,%eax
+80100a95:	74 07                	je     80100a9e <bdrop+0x2e>
+      bforget(b);
+80100a97:	89 d8                	mov    %ebx,%eax
+80100a99:	e8 82 f6 ff ff       	call   80100120 <bforget>
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++)
+80100a9e:	83 c3 68             	add    $0x68,%ebx
+80100aa1:	81 fb 68 30 14 80    	cmp    $0x80143068,%ebx
+80100aa7:	75 e7                	jne    80100a90 <bdrop+0x20>
+  release(&bcache.evictlock);
+80100aa9:	83 ec 0c             	sub    $0xc,%esp
+80100aac:	68 34 f0 10 80       	push   $0x8010f034
+80100ab1:	e8 ca 64 00 00       	call   80106f80 <release>
+}
+80100ab6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100ab9:	83 c4 10             	add    $0x10,%esp
+80100abc:	c9                   	leave
+80100abd:	c3                   	ret
+80100abe:	66 90                	xchg   %ax,%ax
+
+80100ac0 <consoleread>:
+  }
+}
+
+int
+consoleread(struct inode *ip, char *dst, uint off, int n)
+{
+80100ac0:	55                   	push   %ebp
+80100ac1:	89 e5                	mov    %esp,%ebp
+80100ac3:	57                   	push   %edi
+80100ac4:	56                   	push   %esi
+80100ac5:	53                   	push   %ebx
+80100ac6:	83 ec 18             	sub    $0x18,%esp
+80100ac9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+80100acc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  uint target;
+  int c;
+
+  iunlock(ip);
+80100acf:	ff 75 08             	push   0x8(%ebp)
+  target = n;
+80100ad2:	89 df                	mov    %ebx,%edi
+  iunlock(ip);
+80100ad4:	e8 b7 17 00 00       	call   80102290 <iunlock>
+  acquire(&cons.lock);
+80100ad9:	c7 04 24 a0 a0 15 80 	movl   $0x8015a0a0,(%esp)
+80100ae0:	e8 7b 62 00 00       	call   80106d60 <acquire>
+  while(n > 0){
+80100ae5:	83 c4 10             	add    $0x10,%esp
+80100ae8:	85 db                	test   %ebx,%ebx
+80100aea:	0f 8e 94 00 00 00    	jle    80100b84 <consoleread+0xc4>
+    while(input.r == input.w){
+80100af0:	a1 80 a0 15 80       	mov    0x8015a080,%eax
+80100af5:	39 05 84 a0 15 80    	cmp    %eax,0x8015a084
+80100afb:	74 25                	je     80100b22 <consoleread+0x62>
+80100afd:	eb 59                	jmp    80100b58 <consoleread+0x98>
+80100aff:	90                   	nop
+      if(proc->killed){
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+80100b00:	83 ec 08             	sub    $0x8,%esp
+80100b03:	68 a0 a0 15 80       	push   $0x8015a0a0
+80100b08:	68 80 a0 15 80       	push   $0x8015a080
+80100b0d:	e8 fe 59 00 00       	call   80106510 <sleep>
+    while(input.r == input.w){
+80100b12:	a1 80 a0 15 80       	mov    0x8015a080,%eax
+80100b17:	83 c4 10             	add    $0x10,%esp
+80100b1a:	3b 05 84 a0 15 80    	cmp    0x8015a084,%eax
+80100b20:	75 36                	jne    80100b58 <consoleread+0x98>
+      if(proc->killed){
+80100b22:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80100b28:	8b 48 68             	mov    0x68(%eax),%ecx
+80100b2b:	85 c9                	test   %ecx,%ecx
+80100b2d:	74 d1                	je     80100b00 <consoleread+0x40>
+        release(&cons.lock);
+80100b2f:	83 ec 0c             	sub    $0xc,%esp
+80100b32:	68 a0 a0 15 80       	push   $0x8015a0a0
+80100b37:	e8 44 64 00 00       	call   80106f80 <release>
+        ilock(ip);
+80100b3c:	5a                   	pop    %edx
+80100b3d:	ff 75 08             	push   0x8(%ebp)
+80100b40:	e8 7b 16 00 00       	call   801021c0 <ilock>
+        return -1;
+80100b45:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+80100b48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return -1;
+80100b4b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80100b50:	5b                   	pop    %ebx
+80100b51:	5e                   	pop    %esi
+80100b52:	5f                   	pop    %edi
+80100b53:	5d                   	pop    %ebp
+80100b54:	c3                   	ret
+80100b55:	8d 76 00             	lea    0x0(%esi),%esi
+    c = input.buf[input.r++ % INPUT_BUF];
+80100b58:	8d 50 01             	lea    0x1(%eax),%edx
+80100b5b:	89 15 80 a0 15 80    	mov    %edx,0x8015a080
+80100b61:	89 c2                	mov    %eax,%edx
+80100b63:	83 e2 7f             	and    $0x7f,%edx
+80100b66:	0f be 8a 00 a0 15 80 	movsbl -0x7fea6000(%edx),%ecx
+    if(c == C('D')){  // EOF
+80100b6d:	80 f9 04             	cmp    $0x4,%cl
+80100b70:	74 37                	je     80100ba9 <consoleread+0xe9>
+    *dst++ = c;
+80100b72:	83 c6 01             	add    $0x1,%esi
+    --n;
+80100b75:	83 eb 01             	sub    $0x1,%ebx
+    *dst++ = c;
+80100b78:	88 4e ff             	mov    %cl,-0x1(%esi)
+    if(c == '\n')
+80100b7b:	83 f9 0a             	cmp    $0xa,%ecx
+80100b7e:	0f 85 64 ff ff ff    	jne    80100ae8 <consoleread+0x28>
+  release(&cons.lock);
+80100b84:	83 ec 0c             	sub    $0xc,%esp
+80100b87:	68 a0 a0 15 80       	push   $0x8015a0a0
+80100b8c:	e8 ef 63 00 00       	call   80106f80 <release>
+  ilock(ip);
+80100b91:	58                   	pop    %eax
+80100b92:	ff 75 08             	push   0x8(%ebp)
+80100b95:	e8 26 16 00 00       	call   801021c0 <ilock>
+  return target - n;
+80100b9a:	89 f8                	mov    %edi,%eax
+80100b9c:	83 c4 10             	add    $0x10,%esp
+}
+80100b9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return target - n;
+80100ba2:	29 d8                	sub    %ebx,%eax
+}
+80100ba4:	5b                   	pop    %ebx
+80100ba5:	5e                   	pop    %esi
+80100ba6:	5f                   	pop    %edi
+80100ba7:	5d                   	pop    %ebp
+80100ba8:	c3                   	ret
+      if(n < target){
+80100ba9:	39 fb                	cmp    %edi,%ebx
+80100bab:	73 d7                	jae    80100b84 <consoleread+0xc4>
+        input.r--;
+80100bad:	a3 80 a0 15 80       	mov    %eax,0x8015a080
+80100bb2:	eb d0                	jmp    80100b84 <consoleread+0xc4>
+80100bb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100bbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100bbf:	90                   	nop
+
+80100bc0 <panic>:
+{
+80100bc0:	55                   	push   %ebp
+80100bc1:	89 e5                	mov    %esp,%ebp
+80100bc3:	56                   	push   %esi
+80100bc4:	53                   	push   %ebx
+80100bc5:	83 ec 38             	sub    $0x38,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100bc8:	fa                   	cli
+  cprintf("cpu with apicid %d: panic: ", cpu->apicid);
+80100bc9:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  getcallerpcs(&s, pcs);
+80100bcf:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+80100bd2:	8d 75 f8             	lea    -0x8(%ebp),%esi
+  cons.locking = 0;
+80100bd5:	c7 05 d4 a0 15 80 00 	movl   $0x0,0x8015a0d4
+80100bdc:	00 00 00 
+  cprintf("cpu with apicid %d: panic: ", cpu->apicid);
+80100bdf:	0f b6 00             	movzbl (%eax),%eax
+80100be2:	50                   	push   %eax
+80100be3:	68 68 b4 10 80       	push   $0x8010b468
+80100be8:	e8 03 03 00 00       	call   80100ef0 <cprintf>
+  cprintf(s);
+80100bed:	58                   	pop    %eax
+80100bee:	ff 75 08             	push   0x8(%ebp)
+80100bf1:	e8 fa 02 00 00       	call   80100ef0 <cprintf>
+  cprintf("\n");
+80100bf6:	c7 04 24 92 b9 10 80 	movl   $0x8010b992,(%esp)
+80100bfd:	e8 ee 02 00 00       	call   80100ef0 <cprintf>
+  getcallerpcs(&s, pcs);
+80100c02:	8d 45 08             	lea    0x8(%ebp),%eax
+80100c05:	5a                   	pop    %edx
+80100c06:	59                   	pop    %ecx
+80100c07:	53                   	push   %ebx
+80100c08:	50                   	push   %eax
+80100c09:	e8 52 62 00 00       	call   80106e60 <getcallerpcs>
+  for(i=0; i<10; i++)
+80100c0e:	83 c4 10             	add    $0x10,%esp
+80100c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    cprintf(" %p", pcs[i]);
+80100c18:	83 ec 08             	sub    $0x8,%esp
+80100c1b:	ff 33                	push   (%ebx)
+  for(i=0; i<10; i++)
+80100c1d:	83 c3 04             	add    $0x4,%ebx
+    cprintf(" %p", pcs[i]);
+80100c20:	68 84 b4 10 80       	push   $0x8010b484
+80100c25:	e8 c6 02 00 00       	call   80100ef0 <cprintf>
+  for(i=0; i<10; i++)
+80100c2a:	83 c4 10             	add    $0x10,%esp
+80100c2d:	39 f3                	cmp    %esi,%ebx
+80100c2f:	75 e7                	jne    80100c18 <panic+0x58>
+  panicked = 1; // freeze other CPU
+80100c31:	c7 05 d8 a0 15 80 01 	movl   $0x1,0x8015a0d8
+80100c38:	00 00 00 
+  for(;;)
+80100c3b:	eb fe                	jmp    80100c3b <panic+0x7b>
+80100c3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100c40 <consputc.part.0>:
+consputc(int c)
+80100c40:	55                   	push   %ebp
+80100c41:	89 e5                	mov    %esp,%ebp
+80100c43:	57                   	push   %edi
+80100c44:	56                   	push   %esi
+80100c45:	53                   	push   %ebx
+80100c46:	83 ec 1c             	sub    $0x1c,%esp
+  if(c == BACKSPACE){
+80100c49:	3d 00 01 00 00       	cmp    $0x100,%eax
+80100c4e:	0f 84 cc 00 00 00    	je     80100d20 <consputc.part.0+0xe0>
+    uartputc(c);
+80100c54:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100c57:	bf d4 03 00 00       	mov    $0x3d4,%edi
+80100c5c:	89 c3                	mov    %eax,%ebx
+80100c5e:	50                   	push   %eax
+80100c5f:	e8 8c 8c 00 00       	call   801098f0 <uartputc>
+80100c64:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100c69:	89 fa                	mov    %edi,%edx
+80100c6b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100c6c:	be d5 03 00 00       	mov    $0x3d5,%esi
+80100c71:	89 f2                	mov    %esi,%edx
+80100c73:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100c74:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100c77:	89 fa                	mov    %edi,%edx
+80100c79:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100c7e:	c1 e1 08             	shl    $0x8,%ecx
+80100c81:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100c82:	89 f2                	mov    %esi,%edx
+80100c84:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100c85:	0f b6 c0             	movzbl %al,%eax
+  if(c == '\n')
+80100c88:	83 c4 10             	add    $0x10,%esp
+  pos |= inb(CRTPORT+1);
+80100c8b:	09 c8                	or     %ecx,%eax
+  if(c == '\n')
+80100c8d:	83 fb 0a             	cmp    $0xa,%ebx
+80100c90:	75 76                	jne    80100d08 <consputc.part.0+0xc8>
+    pos += 80 - pos%80;
+80100c92:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80100c97:	f7 e2                	mul    %edx
+80100c99:	c1 ea 06             	shr    $0x6,%edx
+80100c9c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+80100c9f:	c1 e0 04             	shl    $0x4,%eax
+80100ca2:	8d 70 50             	lea    0x50(%eax),%esi
+  if(pos < 0 || pos > 25*80)
+80100ca5:	81 fe d0 07 00 00    	cmp    $0x7d0,%esi
+80100cab:	0f 8f 2f 01 00 00    	jg     80100de0 <consputc.part.0+0x1a0>
+  if((pos/80) >= 24){  // Scroll up.
+80100cb1:	81 fe 7f 07 00 00    	cmp    $0x77f,%esi
+80100cb7:	0f 8f c3 00 00 00    	jg     80100d80 <consputc.part.0+0x140>
+  outb(CRTPORT+1, pos>>8);
+80100cbd:	89 f0                	mov    %esi,%eax
+  crt[pos] = ' ' | 0x0700;
+80100cbf:	8d b4 36 00 80 0b 80 	lea    -0x7ff48000(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+80100cc6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  outb(CRTPORT+1, pos>>8);
+80100cc9:	0f b6 fc             	movzbl %ah,%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100ccc:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+80100cd1:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100cd6:	89 da                	mov    %ebx,%edx
+80100cd8:	ee                   	out    %al,(%dx)
+80100cd9:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+80100cde:	89 f8                	mov    %edi,%eax
+80100ce0:	89 ca                	mov    %ecx,%edx
+80100ce2:	ee                   	out    %al,(%dx)
+80100ce3:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100ce8:	89 da                	mov    %ebx,%edx
+80100cea:	ee                   	out    %al,(%dx)
+80100ceb:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+80100cef:	89 ca                	mov    %ecx,%edx
+80100cf1:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+80100cf2:	b8 20 07 00 00       	mov    $0x720,%eax
+80100cf7:	66 89 06             	mov    %ax,(%esi)
+}
+80100cfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100cfd:	5b                   	pop    %ebx
+80100cfe:	5e                   	pop    %esi
+80100cff:	5f                   	pop    %edi
+80100d00:	5d                   	pop    %ebp
+80100d01:	c3                   	ret
+80100d02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+80100d08:	0f b6 db             	movzbl %bl,%ebx
+80100d0b:	8d 70 01             	lea    0x1(%eax),%esi
+80100d0e:	80 cf 07             	or     $0x7,%bh
+80100d11:	66 89 9c 00 00 80 0b 	mov    %bx,-0x7ff48000(%eax,%eax,1)
+80100d18:	80 
+80100d19:	eb 8a                	jmp    80100ca5 <consputc.part.0+0x65>
+80100d1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100d1f:	90                   	nop
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+80100d20:	83 ec 0c             	sub    $0xc,%esp
+80100d23:	be d4 03 00 00       	mov    $0x3d4,%esi
+80100d28:	6a 08                	push   $0x8
+80100d2a:	e8 c1 8b 00 00       	call   801098f0 <uartputc>
+80100d2f:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+80100d36:	e8 b5 8b 00 00       	call   801098f0 <uartputc>
+80100d3b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100d42:	e8 a9 8b 00 00       	call   801098f0 <uartputc>
+80100d47:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100d4c:	89 f2                	mov    %esi,%edx
+80100d4e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100d4f:	bb d5 03 00 00       	mov    $0x3d5,%ebx
+80100d54:	89 da                	mov    %ebx,%edx
+80100d56:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100d57:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100d5a:	89 f2                	mov    %esi,%edx
+80100d5c:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100d61:	c1 e1 08             	shl    $0x8,%ecx
+80100d64:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100d65:	89 da                	mov    %ebx,%edx
+80100d67:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100d68:	0f b6 f0             	movzbl %al,%esi
+    if(pos > 0) --pos;
+80100d6b:	83 c4 10             	add    $0x10,%esp
+80100d6e:	09 ce                	or     %ecx,%esi
+80100d70:	74 5e                	je     80100dd0 <consputc.part.0+0x190>
+80100d72:	83 ee 01             	sub    $0x1,%esi
+80100d75:	e9 2b ff ff ff       	jmp    80100ca5 <consputc.part.0+0x65>
+80100d7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100d80:	83 ec 04             	sub    $0x4,%esp
+    pos -= 80;
+80100d83:	8d 5e b0             	lea    -0x50(%esi),%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100d86:	8d b4 36 60 7f 0b 80 	lea    -0x7ff480a0(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+80100d8d:	bf 07 00 00 00       	mov    $0x7,%edi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100d92:	68 60 0e 00 00       	push   $0xe60
+80100d97:	68 a0 80 0b 80       	push   $0x800b80a0
+80100d9c:	68 00 80 0b 80       	push   $0x800b8000
+80100da1:	e8 2a 65 00 00       	call   801072d0 <memmove>
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100da6:	b8 80 07 00 00       	mov    $0x780,%eax
+80100dab:	83 c4 0c             	add    $0xc,%esp
+80100dae:	29 d8                	sub    %ebx,%eax
+80100db0:	01 c0                	add    %eax,%eax
+80100db2:	50                   	push   %eax
+80100db3:	6a 00                	push   $0x0
+80100db5:	56                   	push   %esi
+80100db6:	e8 85 64 00 00       	call   80107240 <memset>
+  outb(CRTPORT+1, pos);
+80100dbb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+80100dbe:	83 c4 10             	add    $0x10,%esp
+80100dc1:	e9 06 ff ff ff       	jmp    80100ccc <consputc.part.0+0x8c>
+80100dc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100dcd:	8d 76 00             	lea    0x0(%esi),%esi
+80100dd0:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+80100dd4:	be 00 80 0b 80       	mov    $0x800b8000,%esi
+80100dd9:	31 ff                	xor    %edi,%edi
+80100ddb:	e9 ec fe ff ff       	jmp    80100ccc <consputc.part.0+0x8c>
+    panic("pos under/overflow");
+80100de0:	83 ec 0c             	sub    $0xc,%esp
+80100de3:	68 88 b4 10 80       	push   $0x8010b488
+80100de8:	e8 d3 fd ff ff       	call   80100bc0 <panic>
+80100ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100df0 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+80100df0:	55                   	push   %ebp
+80100df1:	89 e5                	mov    %esp,%ebp
+80100df3:	57                   	push   %edi
+80100df4:	56                   	push   %esi
+80100df5:	53                   	push   %ebx
+80100df6:	83 ec 18             	sub    $0x18,%esp
+80100df9:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+80100dfc:	ff 75 08             	push   0x8(%ebp)
+80100dff:	e8 8c 14 00 00       	call   80102290 <iunlock>
+  acquire(&cons.lock);
+80100e04:	c7 04 24 a0 a0 15 80 	movl   $0x8015a0a0,(%esp)
+80100e0b:	e8 50 5f 00 00       	call   80106d60 <acquire>
+  for(i = 0; i < n; i++)
+80100e10:	83 c4 10             	add    $0x10,%esp
+80100e13:	85 f6                	test   %esi,%esi
+80100e15:	7e 25                	jle    80100e3c <consolewrite+0x4c>
+80100e17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+80100e1a:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+  if(panicked){
+80100e1d:	8b 15 d8 a0 15 80    	mov    0x8015a0d8,%edx
+    consputc(buf[i] & 0xff);
+80100e23:	0f b6 03             	movzbl (%ebx),%eax
+  if(panicked){
+80100e26:	85 d2                	test   %edx,%edx
+80100e28:	74 06                	je     80100e30 <consolewrite+0x40>
+  asm volatile("cli");
+80100e2a:	fa                   	cli
+    for(;;)
+80100e2b:	eb fe                	jmp    80100e2b <consolewrite+0x3b>
+80100e2d:	8d 76 00             	lea    0x0(%esi),%esi
+80100e30:	e8 0b fe ff ff       	call   80100c40 <consputc.part.0>
+  for(i = 0; i < n; i++)
+80100e35:	83 c3 01             	add    $0x1,%ebx
+80100e38:	39 df                	cmp    %ebx,%edi
+80100e3a:	75 e1                	jne    80100e1d <consolewrite+0x2d>
+  release(&cons.lock);
+80100e3c:	83 ec 0c             	sub    $0xc,%esp
+80100e3f:	68 a0 a0 15 80       	push   $0x8015a0a0
+80100e44:	e8 37 61 00 00       	call   80106f80 <release>
+  ilock(ip);
+80100e49:	58                   	pop    %eax
+80100e4a:	ff 75 08             	push   0x8(%ebp)
+80100e4d:	e8 6e 13 00 00       	call   801021c0 <ilock>
+
+  return n;
+}
+80100e52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100e55:	89 f0                	mov    %esi,%eax
+80100e57:	5b                   	pop    %ebx
+80100e58:	5e                   	pop    %esi
+80100e59:	5f                   	pop    %edi
+80100e5a:	5d                   	pop    %ebp
+80100e5b:	c3                   	ret
+80100e5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100e60 <printint>:
+{
+80100e60:	55                   	push   %ebp
+80100e61:	89 e5                	mov    %esp,%ebp
+80100e63:	57                   	push   %edi
+80100e64:	56                   	push   %esi
+80100e65:	89 c6                	mov    %eax,%esi
+80100e67:	53                   	push   %ebx
+80100e68:	89 d3                	mov    %edx,%ebx
+80100e6a:	83 ec 2c             	sub    $0x2c,%esp
+  if(sign && (sign = xx < 0))
+80100e6d:	85 c9                	test   %ecx,%ecx
+80100e6f:	74 04                	je     80100e75 <printint+0x15>
+80100e71:	85 c0                	test   %eax,%eax
+80100e73:	78 63                	js     80100ed8 <printint+0x78>
+    x = xx;
+80100e75:	89 f1                	mov    %esi,%ecx
+80100e77:	31 c0                	xor    %eax,%eax
+  i = 0;
+80100e79:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80100e7c:	31 f6                	xor    %esi,%esi
+80100e7e:	66 90                	xchg   %ax,%ax
+    buf[i++] = digits[x % base];
+80100e80:	89 c8                	mov    %ecx,%eax
+80100e82:	31 d2                	xor    %edx,%edx
+80100e84:	89 f7                	mov    %esi,%edi
+80100e86:	f7 f3                	div    %ebx
+80100e88:	8d 76 01             	lea    0x1(%esi),%esi
+80100e8b:	0f b6 92 b4 b4 10 80 	movzbl -0x7fef4b4c(%edx),%edx
+80100e92:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+80100e96:	89 ca                	mov    %ecx,%edx
+80100e98:	89 c1                	mov    %eax,%ecx
+80100e9a:	39 da                	cmp    %ebx,%edx
+80100e9c:	73 e2                	jae    80100e80 <printint+0x20>
+  if(sign)
+80100e9e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100ea1:	85 c0                	test   %eax,%eax
+80100ea3:	74 07                	je     80100eac <printint+0x4c>
+    buf[i++] = '-';
+80100ea5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+80100eaa:	89 f7                	mov    %esi,%edi
+80100eac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+80100eaf:	01 df                	add    %ebx,%edi
+  if(panicked){
+80100eb1:	8b 15 d8 a0 15 80    	mov    0x8015a0d8,%edx
+    consputc(buf[i]);
+80100eb7:	0f be 07             	movsbl (%edi),%eax
+  if(panicked){
+80100eba:	85 d2                	test   %edx,%edx
+80100ebc:	74 0a                	je     80100ec8 <printint+0x68>
+80100ebe:	fa                   	cli
+    for(;;)
+80100ebf:	eb fe                	jmp    80100ebf <printint+0x5f>
+80100ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100ec8:	e8 73 fd ff ff       	call   80100c40 <consputc.part.0>
+  while(--i >= 0)
+80100ecd:	8d 47 ff             	lea    -0x1(%edi),%eax
+80100ed0:	39 df                	cmp    %ebx,%edi
+80100ed2:	74 0c                	je     80100ee0 <printint+0x80>
+80100ed4:	89 c7                	mov    %eax,%edi
+80100ed6:	eb d9                	jmp    80100eb1 <printint+0x51>
+80100ed8:	89 c8                	mov    %ecx,%eax
+    x = -xx;
+80100eda:	89 f1                	mov    %esi,%ecx
+80100edc:	f7 d9                	neg    %ecx
+80100ede:	eb 99                	jmp    80100e79 <printint+0x19>
+}
+80100ee0:	83 c4 2c             	add    $0x2c,%esp
+80100ee3:	5b                   	pop    %ebx
+80100ee4:	5e                   	pop    %esi
+80100ee5:	5f                   	pop    %edi
+80100ee6:	5d                   	pop    %ebp
+80100ee7:	c3                   	ret
+80100ee8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100eef:	90                   	nop
+
+80100ef0 <cprintf>:
+{
+80100ef0:	55                   	push   %ebp
+80100ef1:	89 e5                	mov    %esp,%ebp
+80100ef3:	57                   	push   %edi
+80100ef4:	56                   	push   %esi
+80100ef5:	53                   	push   %ebx
+80100ef6:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+80100ef9:	8b 3d d4 a0 15 80    	mov    0x8015a0d4,%edi
+  if (fmt == 0)
+80100eff:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(locking)
+80100f02:	85 ff                	test   %edi,%edi
+80100f04:	0f 85 36 01 00 00    	jne    80101040 <cprintf+0x150>
+  if (fmt == 0)
+80100f0a:	85 f6                	test   %esi,%esi
+80100f0c:	0f 84 e0 01 00 00    	je     801010f2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100f12:	0f b6 06             	movzbl (%esi),%eax
+80100f15:	85 c0                	test   %eax,%eax
+80100f17:	74 6b                	je     80100f84 <cprintf+0x94>
+  argp = (uint*)(void*)(&fmt + 1);
+80100f19:	8d 55 0c             	lea    0xc(%ebp),%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100f1c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80100f1f:	31 db                	xor    %ebx,%ebx
+80100f21:	89 d7                	mov    %edx,%edi
+    if(c != '%'){
+80100f23:	83 f8 25             	cmp    $0x25,%eax
+80100f26:	0f 85 dc 00 00 00    	jne    80101008 <cprintf+0x118>
+    c = fmt[++i] & 0xff;
+80100f2c:	83 c3 01             	add    $0x1,%ebx
+80100f2f:	0f b6 0c 1e          	movzbl (%esi,%ebx,1),%ecx
+    if(c == 0)
+80100f33:	85 c9                	test   %ecx,%ecx
+80100f35:	74 42                	je     80100f79 <cprintf+0x89>
+    switch(c){
+80100f37:	83 f9 70             	cmp    $0x70,%ecx
+80100f3a:	0f 84 99 00 00 00    	je     80100fd9 <cprintf+0xe9>
+80100f40:	7f 4e                	jg     80100f90 <cprintf+0xa0>
+80100f42:	83 f9 25             	cmp    $0x25,%ecx
+80100f45:	0f 84 cd 00 00 00    	je     80101018 <cprintf+0x128>
+80100f4b:	83 f9 64             	cmp    $0x64,%ecx
+80100f4e:	0f 85 24 01 00 00    	jne    80101078 <cprintf+0x188>
+      printint(*argp++, 10, 1);
+80100f54:	8d 47 04             	lea    0x4(%edi),%eax
+80100f57:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100f5c:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100f61:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100f64:	8b 07                	mov    (%edi),%eax
+80100f66:	e8 f5 fe ff ff       	call   80100e60 <printint>
+80100f6b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100f6e:	83 c3 01             	add    $0x1,%ebx
+80100f71:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100f75:	85 c0                	test   %eax,%eax
+80100f77:	75 aa                	jne    80100f23 <cprintf+0x33>
+80100f79:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  if(locking)
+80100f7c:	85 ff                	test   %edi,%edi
+80100f7e:	0f 85 df 00 00 00    	jne    80101063 <cprintf+0x173>
+}
+80100f84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100f87:	5b                   	pop    %ebx
+80100f88:	5e                   	pop    %esi
+80100f89:	5f                   	pop    %edi
+80100f8a:	5d                   	pop    %ebp
+80100f8b:	c3                   	ret
+80100f8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100f90:	83 f9 73             	cmp    $0x73,%ecx
+80100f93:	75 3b                	jne    80100fd0 <cprintf+0xe0>
+      if((s = (char*)*argp++) == 0)
+80100f95:	8b 17                	mov    (%edi),%edx
+80100f97:	8d 47 04             	lea    0x4(%edi),%eax
+80100f9a:	85 d2                	test   %edx,%edx
+80100f9c:	0f 85 0e 01 00 00    	jne    801010b0 <cprintf+0x1c0>
+80100fa2:	b9 28 00 00 00       	mov    $0x28,%ecx
+        s = "(null)";
+80100fa7:	bf 9b b4 10 80       	mov    $0x8010b49b,%edi
+80100fac:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80100faf:	89 fb                	mov    %edi,%ebx
+80100fb1:	89 f7                	mov    %esi,%edi
+80100fb3:	89 c6                	mov    %eax,%esi
+80100fb5:	0f be c1             	movsbl %cl,%eax
+  if(panicked){
+80100fb8:	8b 15 d8 a0 15 80    	mov    0x8015a0d8,%edx
+80100fbe:	85 d2                	test   %edx,%edx
+80100fc0:	0f 84 fe 00 00 00    	je     801010c4 <cprintf+0x1d4>
+80100fc6:	fa                   	cli
+    for(;;)
+80100fc7:	eb fe                	jmp    80100fc7 <cprintf+0xd7>
+80100fc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100fd0:	83 f9 78             	cmp    $0x78,%ecx
+80100fd3:	0f 85 9f 00 00 00    	jne    80101078 <cprintf+0x188>
+      printint(*argp++, 16, 0);
+80100fd9:	8d 47 04             	lea    0x4(%edi),%eax
+80100fdc:	31 c9                	xor    %ecx,%ecx
+80100fde:	ba 10 00 00 00       	mov    $0x10,%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100fe3:	83 c3 01             	add    $0x1,%ebx
+      printint(*argp++, 16, 0);
+80100fe6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100fe9:	8b 07                	mov    (%edi),%eax
+80100feb:	e8 70 fe ff ff       	call   80100e60 <printint>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100ff0:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+      printint(*argp++, 16, 0);
+80100ff4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100ff7:	85 c0                	test   %eax,%eax
+80100ff9:	0f 85 24 ff ff ff    	jne    80100f23 <cprintf+0x33>
+80100fff:	e9 75 ff ff ff       	jmp    80100f79 <cprintf+0x89>
+80101004:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(panicked){
+80101008:	8b 0d d8 a0 15 80    	mov    0x8015a0d8,%ecx
+8010100e:	85 c9                	test   %ecx,%ecx
+80101010:	74 15                	je     80101027 <cprintf+0x137>
+80101012:	fa                   	cli
+    for(;;)
+80101013:	eb fe                	jmp    80101013 <cprintf+0x123>
+80101015:	8d 76 00             	lea    0x0(%esi),%esi
+  if(panicked){
+80101018:	8b 0d d8 a0 15 80    	mov    0x8015a0d8,%ecx
+8010101e:	85 c9                	test   %ecx,%ecx
+80101020:	75 7e                	jne    801010a0 <cprintf+0x1b0>
+80101022:	b8 25 00 00 00       	mov    $0x25,%eax
+80101027:	e8 14 fc ff ff       	call   80100c40 <consputc.part.0>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010102c:	83 c3 01             	add    $0x1,%ebx
+8010102f:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80101033:	85 c0                	test   %eax,%eax
+80101035:	0f 85 e8 fe ff ff    	jne    80100f23 <cprintf+0x33>
+8010103b:	e9 39 ff ff ff       	jmp    80100f79 <cprintf+0x89>
+    acquire(&cons.lock);
+80101040:	83 ec 0c             	sub    $0xc,%esp
+80101043:	68 a0 a0 15 80       	push   $0x8015a0a0
+80101048:	e8 13 5d 00 00       	call   80106d60 <acquire>
+  if (fmt == 0)
+8010104d:	83 c4 10             	add    $0x10,%esp
+80101050:	85 f6                	test   %esi,%esi
+80101052:	0f 84 9a 00 00 00    	je     801010f2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80101058:	0f b6 06             	movzbl (%esi),%eax
+8010105b:	85 c0                	test   %eax,%eax
+8010105d:	0f 85 b6 fe ff ff    	jne    80100f19 <cprintf+0x29>
+    release(&cons.lock);
+80101063:	83 ec 0c             	sub    $0xc,%esp
+80101066:	68 a0 a0 15 80       	push   $0x8015a0a0
+8010106b:	e8 10 5f 00 00       	call   80106f80 <release>
+80101070:	83 c4 10             	add    $0x10,%esp
+80101073:	e9 0c ff ff ff       	jmp    80100f84 <cprintf+0x94>
+  if(panicked){
+80101078:	8b 15 d8 a0 15 80    	mov    0x8015a0d8,%edx
+8010107e:	85 d2                	test   %edx,%edx
+80101080:	75 26                	jne    801010a8 <cprintf+0x1b8>
+80101082:	b8 25 00 00 00       	mov    $0x25,%eax
+80101087:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010108a:	e8 b1 fb ff ff       	call   80100c40 <consputc.part.0>
+8010108f:	a1 d8 a0 15 80       	mov    0x8015a0d8,%eax
+80101094:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80101097:	85 c0                	test   %eax,%eax
+80101099:	74 4b                	je     801010e6 <cprintf+0x1f6>
+8010109b:	fa                   	cli
+    for(;;)
+8010109c:	eb fe                	jmp    8010109c <cprintf+0x1ac>
+8010109e:	66 90                	xchg   %ax,%ax
+801010a0:	fa                   	cli
+801010a1:	eb fe                	jmp    801010a1 <cprintf+0x1b1>
+801010a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801010a7:	90                   	nop
+801010a8:	fa                   	cli
+801010a9:	eb fe                	jmp    801010a9 <cprintf+0x1b9>
+801010ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801010af:	90                   	nop
+      for(; *s; s++)
+801010b0:	0f b6 0a             	movzbl (%edx),%ecx
+      if((s = (char*)*argp++) == 0)
+801010b3:	89 d7                	mov    %edx,%edi
+      for(; *s; s++)
+801010b5:	84 c9                	test   %cl,%cl
+801010b7:	0f 85 ef fe ff ff    	jne    80100fac <cprintf+0xbc>
+      if((s = (char*)*argp++) == 0)
+801010bd:	89 c7                	mov    %eax,%edi
+801010bf:	e9 aa fe ff ff       	jmp    80100f6e <cprintf+0x7e>
+801010c4:	e8 77 fb ff ff       	call   80100c40 <consputc.part.0>
+      for(; *s; s++)
+801010c9:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+801010cd:	83 c3 01             	add    $0x1,%ebx
+801010d0:	84 c0                	test   %al,%al
+801010d2:	0f 85 e0 fe ff ff    	jne    80100fb8 <cprintf+0xc8>
+      if((s = (char*)*argp++) == 0)
+801010d8:	89 f0                	mov    %esi,%eax
+801010da:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+801010dd:	89 fe                	mov    %edi,%esi
+801010df:	89 c7                	mov    %eax,%edi
+801010e1:	e9 88 fe ff ff       	jmp    80100f6e <cprintf+0x7e>
+801010e6:	89 c8                	mov    %ecx,%eax
+801010e8:	e8 53 fb ff ff       	call   80100c40 <consputc.part.0>
+801010ed:	e9 7c fe ff ff       	jmp    80100f6e <cprintf+0x7e>
+    panic("null fmt");
+801010f2:	83 ec 0c             	sub    $0xc,%esp
+801010f5:	68 a2 b4 10 80       	push   $0x8010b4a2
+801010fa:	e8 c1 fa ff ff       	call   80100bc0 <panic>
+801010ff:	90                   	nop
+
+80101100 <consoleintr>:
+{
+80101100:	55                   	push   %ebp
+80101101:	89 e5                	mov    %esp,%ebp
+80101103:	57                   	push   %edi
+80101104:	56                   	push   %esi
+  int c, doprocdump = 0;
+80101105:	31 f6                	xor    %esi,%esi
+{
+80101107:	53                   	push   %ebx
+80101108:	83 ec 18             	sub    $0x18,%esp
+8010110b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&cons.lock);
+8010110e:	68 a0 a0 15 80       	push   $0x8015a0a0
+80101113:	e8 48 5c 00 00       	call   80106d60 <acquire>
+  while((c = getc()) >= 0){
+80101118:	83 c4 10             	add    $0x10,%esp
+8010111b:	eb 1a                	jmp    80101137 <consoleintr+0x37>
+8010111d:	8d 76 00             	lea    0x0(%esi),%esi
+    switch(c){
+80101120:	83 fb 08             	cmp    $0x8,%ebx
+80101123:	0f 84 d7 00 00 00    	je     80101200 <consoleintr+0x100>
+80101129:	83 fb 10             	cmp    $0x10,%ebx
+8010112c:	0f 85 2d 01 00 00    	jne    8010125f <consoleintr+0x15f>
+80101132:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+80101137:	ff d7                	call   *%edi
+80101139:	89 c3                	mov    %eax,%ebx
+8010113b:	85 c0                	test   %eax,%eax
+8010113d:	0f 88 e5 00 00 00    	js     80101228 <consoleintr+0x128>
+    switch(c){
+80101143:	83 fb 15             	cmp    $0x15,%ebx
+80101146:	74 7a                	je     801011c2 <consoleintr+0xc2>
+80101148:	7e d6                	jle    80101120 <consoleintr+0x20>
+8010114a:	83 fb 7f             	cmp    $0x7f,%ebx
+8010114d:	0f 84 ad 00 00 00    	je     80101200 <consoleintr+0x100>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80101153:	a1 88 a0 15 80       	mov    0x8015a088,%eax
+80101158:	89 c2                	mov    %eax,%edx
+8010115a:	2b 15 80 a0 15 80    	sub    0x8015a080,%edx
+80101160:	83 fa 7f             	cmp    $0x7f,%edx
+80101163:	77 d2                	ja     80101137 <consoleintr+0x37>
+  if(panicked){
+80101165:	8b 15 d8 a0 15 80    	mov    0x8015a0d8,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+8010116b:	8d 48 01             	lea    0x1(%eax),%ecx
+8010116e:	83 e0 7f             	and    $0x7f,%eax
+80101171:	89 0d 88 a0 15 80    	mov    %ecx,0x8015a088
+80101177:	88 98 00 a0 15 80    	mov    %bl,-0x7fea6000(%eax)
+  if(panicked){
+8010117d:	85 d2                	test   %edx,%edx
+8010117f:	0f 85 47 01 00 00    	jne    801012cc <consoleintr+0x1cc>
+80101185:	89 d8                	mov    %ebx,%eax
+80101187:	e8 b4 fa ff ff       	call   80100c40 <consputc.part.0>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+8010118c:	83 fb 0a             	cmp    $0xa,%ebx
+8010118f:	0f 84 18 01 00 00    	je     801012ad <consoleintr+0x1ad>
+80101195:	83 fb 04             	cmp    $0x4,%ebx
+80101198:	0f 84 0f 01 00 00    	je     801012ad <consoleintr+0x1ad>
+8010119e:	a1 80 a0 15 80       	mov    0x8015a080,%eax
+801011a3:	83 e8 80             	sub    $0xffffff80,%eax
+801011a6:	39 05 88 a0 15 80    	cmp    %eax,0x8015a088
+801011ac:	75 89                	jne    80101137 <consoleintr+0x37>
+801011ae:	e9 ff 00 00 00       	jmp    801012b2 <consoleintr+0x1b2>
+801011b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801011b7:	90                   	nop
+801011b8:	b8 00 01 00 00       	mov    $0x100,%eax
+801011bd:	e8 7e fa ff ff       	call   80100c40 <consputc.part.0>
+      while(input.e != input.w &&
+801011c2:	a1 88 a0 15 80       	mov    0x8015a088,%eax
+801011c7:	3b 05 84 a0 15 80    	cmp    0x8015a084,%eax
+801011cd:	0f 84 64 ff ff ff    	je     80101137 <consoleintr+0x37>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+801011d3:	83 e8 01             	sub    $0x1,%eax
+801011d6:	89 c2                	mov    %eax,%edx
+801011d8:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+801011db:	80 ba 00 a0 15 80 0a 	cmpb   $0xa,-0x7fea6000(%edx)
+801011e2:	0f 84 4f ff ff ff    	je     80101137 <consoleintr+0x37>
+  if(panicked){
+801011e8:	8b 15 d8 a0 15 80    	mov    0x8015a0d8,%edx
+        input.e--;
+801011ee:	a3 88 a0 15 80       	mov    %eax,0x8015a088
+  if(panicked){
+801011f3:	85 d2                	test   %edx,%edx
+801011f5:	74 c1                	je     801011b8 <consoleintr+0xb8>
+801011f7:	fa                   	cli
+    for(;;)
+801011f8:	eb fe                	jmp    801011f8 <consoleintr+0xf8>
+801011fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(input.e != input.w){
+80101200:	a1 88 a0 15 80       	mov    0x8015a088,%eax
+80101205:	3b 05 84 a0 15 80    	cmp    0x8015a084,%eax
+8010120b:	0f 84 26 ff ff ff    	je     80101137 <consoleintr+0x37>
+        input.e--;
+80101211:	83 e8 01             	sub    $0x1,%eax
+80101214:	a3 88 a0 15 80       	mov    %eax,0x8015a088
+  if(panicked){
+80101219:	a1 d8 a0 15 80       	mov    0x8015a0d8,%eax
+8010121e:	85 c0                	test   %eax,%eax
+80101220:	74 22                	je     80101244 <consoleintr+0x144>
+80101222:	fa                   	cli
+    for(;;)
+80101223:	eb fe                	jmp    80101223 <consoleintr+0x123>
+80101225:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&cons.lock);
+80101228:	83 ec 0c             	sub    $0xc,%esp
+8010122b:	68 a0 a0 15 80       	push   $0x8015a0a0
+80101230:	e8 4b 5d 00 00       	call   80106f80 <release>
+  if(doprocdump) {
+80101235:	83 c4 10             	add    $0x10,%esp
+80101238:	85 f6                	test   %esi,%esi
+8010123a:	75 17                	jne    80101253 <consoleintr+0x153>
+}
+8010123c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010123f:	5b                   	pop    %ebx
+80101240:	5e                   	pop    %esi
+80101241:	5f                   	pop    %edi
+80101242:	5d                   	pop    %ebp
+80101243:	c3                   	ret
+80101244:	b8 00 01 00 00       	mov    $0x100,%eax
+80101249:	e8 f2 f9 ff ff       	call   80100c40 <consputc.part.0>
+8010124e:	e9 e4 fe ff ff       	jmp    80101137 <consoleintr+0x37>
+80101253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101256:	5b                   	pop    %ebx
+80101257:	5e                   	pop    %esi
+80101258:	5f                   	pop    %edi
+80101259:	5d                   	pop    %ebp
+    procdump();  // now call procdump() wo. cons.lock held
+8010125a:	e9 11 59 00 00       	jmp    80106b70 <procdump>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+8010125f:	85 db                	test   %ebx,%ebx
+80101261:	0f 84 d0 fe ff ff    	je     80101137 <consoleintr+0x37>
+80101267:	a1 88 a0 15 80       	mov    0x8015a088,%eax
+8010126c:	89 c2                	mov    %eax,%edx
+8010126e:	2b 15 80 a0 15 80    	sub    0x8015a080,%edx
+80101274:	83 fa 7f             	cmp    $0x7f,%edx
+80101277:	0f 87 ba fe ff ff    	ja     80101137 <consoleintr+0x37>
+        input.buf[input.e++ % INPUT_BUF] = c;
+8010127d:	8d 48 01             	lea    0x1(%eax),%ecx
+  if(panicked){
+80101280:	8b 15 d8 a0 15 80    	mov    0x8015a0d8,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80101286:	83 e0 7f             	and    $0x7f,%eax
+        c = (c == '\r') ? '\n' : c;
+80101289:	83 fb 0d             	cmp    $0xd,%ebx
+8010128c:	0f 85 df fe ff ff    	jne    80101171 <consoleintr+0x71>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80101292:	89 0d 88 a0 15 80    	mov    %ecx,0x8015a088
+80101298:	c6 80 00 a0 15 80 0a 	movb   $0xa,-0x7fea6000(%eax)
+  if(panicked){
+8010129f:	85 d2                	test   %edx,%edx
+801012a1:	75 29                	jne    801012cc <consoleintr+0x1cc>
+801012a3:	b8 0a 00 00 00       	mov    $0xa,%eax
+801012a8:	e8 93 f9 ff ff       	call   80100c40 <consputc.part.0>
+          input.w = input.e;
+801012ad:	a1 88 a0 15 80       	mov    0x8015a088,%eax
+          wakeup(&input.r);
+801012b2:	83 ec 0c             	sub    $0xc,%esp
+          input.w = input.e;
+801012b5:	a3 84 a0 15 80       	mov    %eax,0x8015a084
+          wakeup(&input.r);
+801012ba:	68 80 a0 15 80       	push   $0x8015a080
+801012bf:	e8 1c 54 00 00       	call   801066e0 <wakeup>
+801012c4:	83 c4 10             	add    $0x10,%esp
+801012c7:	e9 6b fe ff ff       	jmp    80101137 <consoleintr+0x37>
+801012cc:	fa                   	cli
+    for(;;)
+801012cd:	eb fe                	jmp    801012cd <consoleintr+0x1cd>
+801012cf:	90                   	nop
+
+801012d0 <consoleinit>:
+
+void
+consoleinit(void)
+{
+801012d0:	55                   	push   %ebp
+801012d1:	89 e5                	mov    %esp,%ebp
+801012d3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+801012d6:	68 ab b4 10 80       	push   $0x8010b4ab
+801012db:	68 a0 a0 15 80       	push   $0x8015a0a0
+801012e0:	e8 5b 5a 00 00       	call   80106d40 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+801012e5:	c7 05 8c aa 15 80 f0 	movl   $0x80100df0,0x8015aa8c
+801012ec:	0d 10 80 
+  devsw[CONSOLE].read = consoleread;
+801012ef:	c7 05 88 aa 15 80 c0 	movl   $0x80100ac0,0x8015aa88
+801012f6:	0a 10 80 
+  cons.locking = 1;
+801012f9:	c7 05 d4 a0 15 80 01 	movl   $0x1,0x8015a0d4
+80101300:	00 00 00 
+
+  picenable(IRQ_KBD);
+80101303:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+8010130a:	e8 91 3f 00 00       	call   801052a0 <picenable>
+  ioapicenable(IRQ_KBD, 0);
+8010130f:	58                   	pop    %eax
+80101310:	5a                   	pop    %edx
+80101311:	6a 00                	push   $0x0
+80101313:	6a 01                	push   $0x1
+80101315:	e8 66 21 00 00       	call   80103480 <ioapicenable>
+}
+8010131a:	83 c4 10             	add    $0x10,%esp
+8010131d:	c9                   	leave
+8010131e:	c3                   	ret
+8010131f:	90                   	nop
+
+80101320 <exec>:
+#include "x86.h"
+#include "elf.h"
+
+int
+exec(char *path, char **argv)
+{
+80101320:	55                   	push   %ebp
+80101321:	89 e5                	mov    %esp,%ebp
+80101323:	57                   	push   %edi
+80101324:	56                   	push   %esi
+80101325:	53                   	push   %ebx
+80101326:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+8010132c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct inode *ip, *exe, *oldexe;
+  struct proghdr ph;
+  struct execseg seg[NEXECSEG];
+  pde_t *pgdir, *oldpgdir;
+
+  begin_op();
+8010132f:	e8 6c 34 00 00       	call   801047a0 <begin_op>
+
+  if((ip = namei(path)) == 0){
+80101334:	83 ec 0c             	sub    $0xc,%esp
+80101337:	ff 75 08             	push   0x8(%ebp)
+8010133a:	e8 c1 18 00 00       	call   80102c00 <namei>
+8010133f:	83 c4 10             	add    $0x10,%esp
+80101342:	89 85 b0 fe ff ff    	mov    %eax,-0x150(%ebp)
+80101348:	85 c0                	test   %eax,%eax
+8010134a:	0f 84 14 04 00 00    	je     80101764 <exec+0x444>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+80101350:	8b 9d b0 fe ff ff    	mov    -0x150(%ebp),%ebx
+80101356:	83 ec 0c             	sub    $0xc,%esp
+80101359:	53                   	push   %ebx
+8010135a:	e8 61 0e 00 00       	call   801021c0 <ilock>
+  pgdir = 0;
+  exe = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) < sizeof(elf))
+8010135f:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+80101365:	6a 34                	push   $0x34
+80101367:	6a 00                	push   $0x0
+80101369:	50                   	push   %eax
+8010136a:	53                   	push   %ebx
+8010136b:	e8 70 11 00 00       	call   801024e0 <readi>
+80101370:	83 c4 20             	add    $0x20,%esp
+80101373:	83 f8 33             	cmp    $0x33,%eax
+80101376:	0f 86 9b 03 00 00    	jbe    80101717 <exec+0x3f7>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+8010137c:	81 bd e4 fe ff ff 7f 	cmpl   $0x464c457f,-0x11c(%ebp)
+80101383:	45 4c 46 
+80101386:	0f 85 8b 03 00 00    	jne    80101717 <exec+0x3f7>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+8010138c:	e8 4f 95 00 00       	call   8010a8e0 <setupkvm>
+80101391:	89 85 a4 fe ff ff    	mov    %eax,-0x15c(%ebp)
+80101397:	85 c0                	test   %eax,%eax
+80101399:	0f 84 78 03 00 00    	je     80101717 <exec+0x3f7>
+  // Note where the program's segments go.  Nothing is read
+  // yet: pgfault() reads each page in when it is first touched,
+  // so the process keeps a reference to the executable.
+  sz = 0;
+  nseg = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010139f:	66 83 bd 10 ff ff ff 	cmpw   $0x0,-0xf0(%ebp)
+801013a6:	00 
+801013a7:	8b 9d 00 ff ff ff    	mov    -0x100(%ebp),%ebx
+801013ad:	0f 84 7f 03 00 00    	je     80101732 <exec+0x412>
+801013b3:	31 f6                	xor    %esi,%esi
+801013b5:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  sz = 0;
+801013b8:	c7 85 ac fe ff ff 00 	movl   $0x0,-0x154(%ebp)
+801013bf:	00 00 00 
+801013c2:	89 f7                	mov    %esi,%edi
+  nseg = 0;
+801013c4:	c7 85 b4 fe ff ff 00 	movl   $0x0,-0x14c(%ebp)
+801013cb:	00 00 00 
+801013ce:	e9 b3 00 00 00       	jmp    80101486 <exec+0x166>
+801013d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801013d7:	90                   	nop
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+801013d8:	83 bd c4 fe ff ff 01 	cmpl   $0x1,-0x13c(%ebp)
+801013df:	0f 85 90 00 00 00    	jne    80101475 <exec+0x155>
+      continue;
+    if(ph.memsz < ph.filesz)
+801013e5:	8b 95 d4 fe ff ff    	mov    -0x12c(%ebp),%edx
+801013eb:	8b 85 d8 fe ff ff    	mov    -0x128(%ebp),%eax
+801013f1:	89 95 a8 fe ff ff    	mov    %edx,-0x158(%ebp)
+801013f7:	39 d0                	cmp    %edx,%eax
+801013f9:	0f 82 a8 00 00 00    	jb     801014a7 <exec+0x187>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr || ph.vaddr + ph.memsz > KERNBASE)
+801013ff:	8b 95 cc fe ff ff    	mov    -0x134(%ebp),%edx
+80101405:	89 c6                	mov    %eax,%esi
+80101407:	01 d6                	add    %edx,%esi
+80101409:	0f 82 98 00 00 00    	jb     801014a7 <exec+0x187>
+8010140f:	81 fe 00 00 00 80    	cmp    $0x80000000,%esi
+80101415:	0f 87 8c 00 00 00    	ja     801014a7 <exec+0x187>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0)
+      goto bad;
+    if(nseg == NEXECSEG)
+8010141b:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+80101421:	0f 85 80 00 00 00    	jne    801014a7 <exec+0x187>
+80101427:	8b 8d b4 fe ff ff    	mov    -0x14c(%ebp),%ecx
+8010142d:	83 f9 04             	cmp    $0x4,%ecx
+80101430:	74 75                	je     801014a7 <exec+0x187>
+      goto bad;
+    seg[nseg].va = ph.vaddr;
+80101432:	c1 e1 04             	shl    $0x4,%ecx
+    seg[nseg].off = ph.off;
+    seg[nseg].filesz = ph.filesz;
+    seg[nseg].memsz = ph.memsz;
+    nseg++;
+80101435:	83 85 b4 fe ff ff 01 	addl   $0x1,-0x14c(%ebp)
+    seg[nseg].memsz = ph.memsz;
+8010143c:	89 84 0d 24 ff ff ff 	mov    %eax,-0xdc(%ebp,%ecx,1)
+80101443:	8b 85 ac fe ff ff    	mov    -0x154(%ebp),%eax
+    seg[nseg].va = ph.vaddr;
+80101449:	89 94 0d 18 ff ff ff 	mov    %edx,-0xe8(%ebp,%ecx,1)
+    seg[nseg].off = ph.off;
+80101450:	8b 95 c8 fe ff ff    	mov    -0x138(%ebp),%edx
+80101456:	39 f0                	cmp    %esi,%eax
+80101458:	89 94 0d 1c ff ff ff 	mov    %edx,-0xe4(%ebp,%ecx,1)
+    seg[nseg].filesz = ph.filesz;
+8010145f:	0f 43 f0             	cmovae %eax,%esi
+80101462:	8b 95 a8 fe ff ff    	mov    -0x158(%ebp),%edx
+80101468:	89 b5 ac fe ff ff    	mov    %esi,-0x154(%ebp)
+8010146e:	89 94 0d 20 ff ff ff 	mov    %edx,-0xe0(%ebp,%ecx,1)
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101475:	0f b7 85 10 ff ff ff 	movzwl -0xf0(%ebp),%eax
+8010147c:	83 c7 01             	add    $0x1,%edi
+8010147f:	83 c3 20             	add    $0x20,%ebx
+80101482:	39 f8                	cmp    %edi,%eax
+80101484:	7e 5a                	jle    801014e0 <exec+0x1c0>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80101486:	8d 85 c4 fe ff ff    	lea    -0x13c(%ebp),%eax
+8010148c:	6a 20                	push   $0x20
+8010148e:	53                   	push   %ebx
+8010148f:	50                   	push   %eax
+80101490:	ff b5 b0 fe ff ff    	push   -0x150(%ebp)
+80101496:	e8 45 10 00 00       	call   801024e0 <readi>
+8010149b:	83 c4 10             	add    $0x10,%esp
+8010149e:	83 f8 20             	cmp    $0x20,%eax
+801014a1:	0f 84 31 ff ff ff    	je     801013d8 <exec+0xb8>
+  }
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+801014a7:	83 ec 0c             	sub    $0xc,%esp
+801014aa:	ff b5 a4 fe ff ff    	push   -0x15c(%ebp)
+801014b0:	e8 3b 98 00 00       	call   8010acf0 <freevm>
+  if(ip){
+    iunlockput(ip);
+801014b5:	58                   	pop    %eax
+801014b6:	ff b5 b0 fe ff ff    	push   -0x150(%ebp)
+801014bc:	e8 7f 0f 00 00       	call   80102440 <iunlockput>
+    end_op();
+801014c1:	e8 8a 33 00 00       	call   80104850 <end_op>
+801014c6:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801014c9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    begin_op();
+    iput(exe);
+    end_op();
+  }
+  return -1;
+}
+801014ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801014d1:	5b                   	pop    %ebx
+801014d2:	5e                   	pop    %esi
+801014d3:	5f                   	pop    %edi
+801014d4:	5d                   	pop    %ebp
+801014d5:	c3                   	ret
+801014d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014dd:	8d 76 00             	lea    0x0(%esi),%esi
+  sz = PGROUNDUP(sz);
+801014e0:	8b b5 ac fe ff ff    	mov    -0x154(%ebp),%esi
+801014e6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801014e9:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+801014ef:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+801014f5:	8d 9e 00 20 00 00    	lea    0x2000(%esi),%ebx
+  idenywrite(ip);
+801014fb:	83 ec 0c             	sub    $0xc,%esp
+801014fe:	ff b5 b0 fe ff ff    	push   -0x150(%ebp)
+80101504:	e8 37 0c 00 00       	call   80102140 <idenywrite>
+  iunlock(ip);
+80101509:	59                   	pop    %ecx
+8010150a:	ff b5 b0 fe ff ff    	push   -0x150(%ebp)
+80101510:	e8 7b 0d 00 00       	call   80102290 <iunlock>
+  end_op();
+80101515:	e8 36 33 00 00       	call   80104850 <end_op>
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+8010151a:	83 c4 0c             	add    $0xc,%esp
+8010151d:	53                   	push   %ebx
+8010151e:	56                   	push   %esi
+8010151f:	8b b5 a4 fe ff ff    	mov    -0x15c(%ebp),%esi
+80101525:	56                   	push   %esi
+80101526:	e8 85 96 00 00       	call   8010abb0 <allocuvm>
+8010152b:	83 c4 10             	add    $0x10,%esp
+8010152e:	89 85 ac fe ff ff    	mov    %eax,-0x154(%ebp)
+80101534:	89 c3                	mov    %eax,%ebx
+80101536:	85 c0                	test   %eax,%eax
+80101538:	74 78                	je     801015b2 <exec+0x292>
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+8010153a:	83 ec 08             	sub    $0x8,%esp
+8010153d:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+80101543:	50                   	push   %eax
+80101544:	56                   	push   %esi
+  for(argc = 0; argv[argc]; argc++) {
+80101545:	31 f6                	xor    %esi,%esi
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80101547:	e8 24 98 00 00       	call   8010ad70 <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+8010154c:	8b 17                	mov    (%edi),%edx
+8010154e:	83 c4 10             	add    $0x10,%esp
+80101551:	85 d2                	test   %edx,%edx
+80101553:	75 29                	jne    8010157e <exec+0x25e>
+80101555:	e9 ee 01 00 00       	jmp    80101748 <exec+0x428>
+8010155a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101560:	8d 46 01             	lea    0x1(%esi),%eax
+    ustack[3+argc] = sp;
+80101563:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+8010156a:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+  for(argc = 0; argv[argc]; argc++) {
+80101570:	8b 14 87             	mov    (%edi,%eax,4),%edx
+80101573:	85 d2                	test   %edx,%edx
+80101575:	74 75                	je     801015ec <exec+0x2cc>
+    if(argc >= MAXARG)
+80101577:	83 f8 20             	cmp    $0x20,%eax
+8010157a:	74 36                	je     801015b2 <exec+0x292>
+  for(argc = 0; argv[argc]; argc++) {
+8010157c:	89 c6                	mov    %eax,%esi
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+8010157e:	83 ec 0c             	sub    $0xc,%esp
+80101581:	52                   	push   %edx
+80101582:	e8 a9 5e 00 00       	call   80107430 <strlen>
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80101587:	5a                   	pop    %edx
+80101588:	ff 34 b7             	push   (%edi,%esi,4)
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+8010158b:	29 c3                	sub    %eax,%ebx
+8010158d:	83 eb 01             	sub    $0x1,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80101590:	e8 9b 5e 00 00       	call   80107430 <strlen>
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80101595:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80101598:	83 c0 01             	add    $0x1,%eax
+8010159b:	50                   	push   %eax
+8010159c:	ff 34 b7             	push   (%edi,%esi,4)
+8010159f:	53                   	push   %ebx
+801015a0:	ff b5 a4 fe ff ff    	push   -0x15c(%ebp)
+801015a6:	e8 45 9d 00 00       	call   8010b2f0 <copyout>
+801015ab:	83 c4 20             	add    $0x20,%esp
+801015ae:	85 c0                	test   %eax,%eax
+801015b0:	79 ae                	jns    80101560 <exec+0x240>
+    freevm(pgdir);
+801015b2:	83 ec 0c             	sub    $0xc,%esp
+801015b5:	ff b5 a4 fe ff ff    	push   -0x15c(%ebp)
+801015bb:	e8 30 97 00 00       	call   8010acf0 <freevm>
+    iallowwrite(exe);
+801015c0:	8b bd b0 fe ff ff    	mov    -0x150(%ebp),%edi
+    freevm(pgdir);
+801015c6:	83 c4 10             	add    $0x10,%esp
+    iallowwrite(exe);
+801015c9:	83 ec 0c             	sub    $0xc,%esp
+801015cc:	57                   	push   %edi
+801015cd:	e8 9e 0b 00 00       	call   80102170 <iallowwrite>
+    begin_op();
+801015d2:	e8 c9 31 00 00       	call   801047a0 <begin_op>
+    iput(exe);
+801015d7:	89 3c 24             	mov    %edi,(%esp)
+801015da:	e8 01 0d 00 00       	call   801022e0 <iput>
+    end_op();
+801015df:	e8 6c 32 00 00       	call   80104850 <end_op>
+801015e4:	83 c4 10             	add    $0x10,%esp
+801015e7:	e9 dd fe ff ff       	jmp    801014c9 <exec+0x1a9>
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+801015ec:	8d 14 b5 08 00 00 00 	lea    0x8(,%esi,4),%edx
+  ustack[3+argc] = 0;
+801015f3:	8d 7e 04             	lea    0x4(%esi),%edi
+  sp -= (3+argc+1) * 4;
+801015f6:	8d 72 0c             	lea    0xc(%edx),%esi
+  ustack[1] = argc;
+801015f9:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+801015ff:	89 d8                	mov    %ebx,%eax
+  sp -= (3+argc+1) * 4;
+80101601:	29 f3                	sub    %esi,%ebx
+  ustack[3+argc] = 0;
+80101603:	c7 84 bd 58 ff ff ff 	movl   $0x0,-0xa8(%ebp,%edi,4)
+8010160a:	00 00 00 00 
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+8010160e:	29 d0                	sub    %edx,%eax
+  ustack[0] = 0xffffffff;  // fake return PC
+80101610:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80101617:	ff ff ff 
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+8010161a:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80101620:	56                   	push   %esi
+80101621:	51                   	push   %ecx
+80101622:	53                   	push   %ebx
+80101623:	ff b5 a4 fe ff ff    	push   -0x15c(%ebp)
+80101629:	e8 c2 9c 00 00       	call   8010b2f0 <copyout>
+8010162e:	83 c4 10             	add    $0x10,%esp
+80101631:	85 c0                	test   %eax,%eax
+80101633:	0f 88 79 ff ff ff    	js     801015b2 <exec+0x292>
+  for(last=s=path; *s; s++)
+80101639:	8b 45 08             	mov    0x8(%ebp),%eax
+8010163c:	8b 55 08             	mov    0x8(%ebp),%edx
+8010163f:	0f b6 00             	movzbl (%eax),%eax
+80101642:	84 c0                	test   %al,%al
+80101644:	74 19                	je     8010165f <exec+0x33f>
+80101646:	89 d1                	mov    %edx,%ecx
+80101648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010164f:	90                   	nop
+      last = s+1;
+80101650:	83 c1 01             	add    $0x1,%ecx
+80101653:	3c 2f                	cmp    $0x2f,%al
+  for(last=s=path; *s; s++)
+80101655:	0f b6 01             	movzbl (%ecx),%eax
+      last = s+1;
+80101658:	0f 44 d1             	cmove  %ecx,%edx
+  for(last=s=path; *s; s++)
+8010165b:	84 c0                	test   %al,%al
+8010165d:	75 f1                	jne    80101650 <exec+0x330>
+  safestrcpy(proc->name, last, sizeof(proc->name));
+8010165f:	83 ec 04             	sub    $0x4,%esp
+80101662:	6a 10                	push   $0x10
+80101664:	52                   	push   %edx
+80101665:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+8010166b:	05 b0 00 00 00       	add    $0xb0,%eax
+80101670:	50                   	push   %eax
+80101671:	e8 7a 5d 00 00       	call   801073f0 <safestrcpy>
+  oldpgdir = proc->pgdir;
+80101676:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  proc->pgdir = pgdir;
+8010167c:	8b 95 a4 fe ff ff    	mov    -0x15c(%ebp),%edx
+  memmove(proc->seg, seg, sizeof(seg));
+80101682:	83 c4 0c             	add    $0xc,%esp
+  oldpgdir = proc->pgdir;
+80101685:	8b 78 38             	mov    0x38(%eax),%edi
+  proc->pgdir = pgdir;
+80101688:	89 50 38             	mov    %edx,0x38(%eax)
+  memmove(proc->seg, seg, sizeof(seg));
+8010168b:	05 c8 00 00 00       	add    $0xc8,%eax
+  proc->sz = sz;
+80101690:	8b 95 ac fe ff ff    	mov    -0x154(%ebp),%edx
+  oldexe = proc->exe;
+80101696:	8b 70 fc             	mov    -0x4(%eax),%esi
+  proc->sz = sz;
+80101699:	89 90 6c ff ff ff    	mov    %edx,-0x94(%eax)
+  proc->exe = exe;
+8010169f:	8b 95 b0 fe ff ff    	mov    -0x150(%ebp),%edx
+801016a5:	89 50 fc             	mov    %edx,-0x4(%eax)
+  memmove(proc->seg, seg, sizeof(seg));
+801016a8:	8d 95 18 ff ff ff    	lea    -0xe8(%ebp),%edx
+801016ae:	6a 40                	push   $0x40
+801016b0:	52                   	push   %edx
+801016b1:	50                   	push   %eax
+801016b2:	e8 19 5c 00 00       	call   801072d0 <memmove>
+  proc->nseg = nseg;
+801016b7:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+801016bd:	8b 95 b4 fe ff ff    	mov    -0x14c(%ebp),%edx
+  proc->tf->eip = elf.entry;  // main
+801016c3:	8b 8d fc fe ff ff    	mov    -0x104(%ebp),%ecx
+  proc->nseg = nseg;
+801016c9:	89 90 08 01 00 00    	mov    %edx,0x108(%eax)
+  proc->tf->eip = elf.entry;  // main
+801016cf:	8b 50 5c             	mov    0x5c(%eax),%edx
+801016d2:	89 4a 38             	mov    %ecx,0x38(%edx)
+  proc->tf->esp = sp;
+801016d5:	8b 50 5c             	mov    0x5c(%eax),%edx
+801016d8:	89 5a 44             	mov    %ebx,0x44(%edx)
+  switchuvm(proc);
+801016db:	89 04 24             	mov    %eax,(%esp)
+801016de:	e8 6d 93 00 00       	call   8010aa50 <switchuvm>
+  freevm(oldpgdir);
+801016e3:	89 3c 24             	mov    %edi,(%esp)
+801016e6:	e8 05 96 00 00       	call   8010acf0 <freevm>
+  if(oldexe){
+801016eb:	83 c4 10             	add    $0x10,%esp
+801016ee:	85 f6                	test   %esi,%esi
+801016f0:	74 1e                	je     80101710 <exec+0x3f0>
+    iallowwrite(oldexe);
+801016f2:	83 ec 0c             	sub    $0xc,%esp
+801016f5:	56                   	push   %esi
+801016f6:	e8 75 0a 00 00       	call   80102170 <iallowwrite>
+    begin_op();
+801016fb:	e8 a0 30 00 00       	call   801047a0 <begin_op>
+    iput(oldexe);
+80101700:	89 34 24             	mov    %esi,(%esp)
+80101703:	e8 d8 0b 00 00       	call   801022e0 <iput>
+    end_op();
+80101708:	e8 43 31 00 00       	call   80104850 <end_op>
+8010170d:	83 c4 10             	add    $0x10,%esp
+  return 0;
+80101710:	31 c0                	xor    %eax,%eax
+80101712:	e9 b7 fd ff ff       	jmp    801014ce <exec+0x1ae>
+    iunlockput(ip);
+80101717:	83 ec 0c             	sub    $0xc,%esp
+8010171a:	ff b5 b0 fe ff ff    	push   -0x150(%ebp)
+80101720:	e8 1b 0d 00 00       	call   80102440 <iunlockput>
+    end_op();
+80101725:	e8 26 31 00 00       	call   80104850 <end_op>
+8010172a:	83 c4 10             	add    $0x10,%esp
+8010172d:	e9 97 fd ff ff       	jmp    801014c9 <exec+0x1a9>
+  nseg = 0;
+80101732:	c7 85 b4 fe ff ff 00 	movl   $0x0,-0x14c(%ebp)
+80101739:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010173c:	bb 00 20 00 00       	mov    $0x2000,%ebx
+80101741:	31 f6                	xor    %esi,%esi
+80101743:	e9 b3 fd ff ff       	jmp    801014fb <exec+0x1db>
+  for(argc = 0; argv[argc]; argc++) {
+80101748:	be 10 00 00 00       	mov    $0x10,%esi
+8010174d:	ba 04 00 00 00       	mov    $0x4,%edx
+80101752:	bf 03 00 00 00       	mov    $0x3,%edi
+80101757:	31 c0                	xor    %eax,%eax
+80101759:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+8010175f:	e9 95 fe ff ff       	jmp    801015f9 <exec+0x2d9>
+    end_op();
+80101764:	e8 e7 30 00 00       	call   80104850 <end_op>
+    return -1;
+80101769:	e9 5b fd ff ff       	jmp    801014c9 <exec+0x1a9>
+8010176e:	66 90                	xchg   %ax,%ax
+
+80101770 <fileinit>:
+  struct file file[NFILE];
+} ftable;
+
+void
+fileinit(void)
+{
+80101770:	55                   	push   %ebp
+80101771:	89 e5                	mov    %esp,%ebp
+80101773:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80101776:	68 c5 b4 10 80       	push   $0x8010b4c5
+8010177b:	68 e0 a0 15 80       	push   $0x8015a0e0
+80101780:	e8 bb 55 00 00       	call   80106d40 <initlock>
+}
+80101785:	83 c4 10             	add    $0x10,%esp
+80101788:	c9                   	leave
+80101789:	c3                   	ret
+8010178a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101790 <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+80101790:	55                   	push   %ebp
+80101791:	89 e5                	mov    %esp,%ebp
+80101793:	53                   	push   %ebx
+  struct file *f;
+
+  acquire(&ftable.lock);
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80101794:	bb 14 a1 15 80       	mov    $0x8015a114,%ebx
+{
+80101799:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ftable.lock);
+8010179c:	68 e0 a0 15 80       	push   $0x8015a0e0
+801017a1:	e8 ba 55 00 00       	call   80106d60 <acquire>
+801017a6:	83 c4 10             	add    $0x10,%esp
+801017a9:	eb 10                	jmp    801017bb <filealloc+0x2b>
+801017ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801017af:	90                   	nop
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+801017b0:	83 c3 18             	add    $0x18,%ebx
+801017b3:	81 fb 74 aa 15 80    	cmp    $0x8015aa74,%ebx
+801017b9:	74 25                	je     801017e0 <filealloc+0x50>
+    if(f->ref == 0){
+801017bb:	8b 43 04             	mov    0x4(%ebx),%eax
+801017be:	85 c0                	test   %eax,%eax
+801017c0:	75 ee                	jne    801017b0 <filealloc+0x20>
+      f->ref = 1;
+      release(&ftable.lock);
+801017c2:	83 ec 0c             	sub    $0xc,%esp
+      f->ref = 1;
+801017c5:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+      release(&ftable.lock);
+801017cc:	68 e0 a0 15 80       	push   $0x8015a0e0
+801017d1:	e8 aa 57 00 00       	call   80106f80 <release>
+      return f;
+    }
+  }
+  release(&ftable.lock);
+  return 0;
+}
+801017d6:	89 d8                	mov    %ebx,%eax
+      return f;
+801017d8:	83 c4 10             	add    $0x10,%esp
+}
+801017db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801017de:	c9                   	leave
+801017df:	c3                   	ret
+  release(&ftable.lock);
+801017e0:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+801017e3:	31 db                	xor    %ebx,%ebx
+  release(&ftable.lock);
+801017e5:	68 e0 a0 15 80       	push   $0x8015a0e0
+801017ea:	e8 91 57 00 00       	call   80106f80 <release>
+}
+801017ef:	89 d8                	mov    %ebx,%eax
+  return 0;
+801017f1:	83 c4 10             	add    $0x10,%esp
+}
+801017f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801017f7:	c9                   	leave
+801017f8:	c3                   	ret
+801017f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101800 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80101800:	55                   	push   %ebp
+80101801:	89 e5                	mov    %esp,%ebp
+80101803:	53                   	push   %ebx
+80101804:	83 ec 10             	sub    $0x10,%esp
+80101807:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+8010180a:	68 e0 a0 15 80       	push   $0x8015a0e0
+8010180f:	e8 4c 55 00 00       	call   80106d60 <acquire>
+  if(f->ref < 1)
+80101814:	8b 43 04             	mov    0x4(%ebx),%eax
+80101817:	83 c4 10             	add    $0x10,%esp
+8010181a:	85 c0                	test   %eax,%eax
+8010181c:	7e 1a                	jle    80101838 <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+8010181e:	83 c0 01             	add    $0x1,%eax
+  release(&ftable.lock);
+80101821:	83 ec 0c             	sub    $0xc,%esp
+  f->ref++;
+80101824:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80101827:	68 e0 a0 15 80       	push   $0x8015a0e0
+8010182c:	e8 4f 57 00 00       	call   80106f80 <release>
+  return f;
+}
+80101831:	89 d8                	mov    %ebx,%eax
+80101833:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101836:	c9                   	leave
+80101837:	c3                   	ret
+    panic("filedup");
+80101838:	83 ec 0c             	sub    $0xc,%esp
+8010183b:	68 cc b4 10 80       	push   $0x8010b4cc
+80101840:	e8 7b f3 ff ff       	call   80100bc0 <panic>
+80101845:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010184c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101850 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+80101850:	55                   	push   %ebp
+80101851:	89 e5                	mov    %esp,%ebp
+80101853:	57                   	push   %edi
+80101854:	56                   	push   %esi
+80101855:	53                   	push   %ebx
+80101856:	83 ec 28             	sub    $0x28,%esp
+80101859:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+8010185c:	68 e0 a0 15 80       	push   $0x8015a0e0
+80101861:	e8 fa 54 00 00       	call   80106d60 <acquire>
+  if(f->ref < 1)
+80101866:	8b 53 04             	mov    0x4(%ebx),%edx
+80101869:	83 c4 10             	add    $0x10,%esp
+8010186c:	85 d2                	test   %edx,%edx
+8010186e:	0f 8e a5 00 00 00    	jle    80101919 <fileclose+0xc9>
+    panic("fileclose");
+  if(--f->ref > 0){
+80101874:	83 ea 01             	sub    $0x1,%edx
+80101877:	89 53 04             	mov    %edx,0x4(%ebx)
+8010187a:	75 44                	jne    801018c0 <fileclose+0x70>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+8010187c:	0f b6 43 09          	movzbl 0x9(%ebx),%eax
+  f->ref = 0;
+  f->type = FD_NONE;
+  release(&ftable.lock);
+80101880:	83 ec 0c             	sub    $0xc,%esp
+  ff = *f;
+80101883:	8b 3b                	mov    (%ebx),%edi
+  f->type = FD_NONE;
+80101885:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  ff = *f;
+8010188b:	8b 73 0c             	mov    0xc(%ebx),%esi
+8010188e:	88 45 e7             	mov    %al,-0x19(%ebp)
+80101891:	8b 43 10             	mov    0x10(%ebx),%eax
+80101894:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  release(&ftable.lock);
+80101897:	68 e0 a0 15 80       	push   $0x8015a0e0
+8010189c:	e8 df 56 00 00       	call   80106f80 <release>
+
+  if(ff.type == FD_PIPE)
+801018a1:	83 c4 10             	add    $0x10,%esp
+801018a4:	83 ff 01             	cmp    $0x1,%edi
+801018a7:	74 57                	je     80101900 <fileclose+0xb0>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+801018a9:	83 ff 02             	cmp    $0x2,%edi
+801018ac:	74 2a                	je     801018d8 <fileclose+0x88>
+    begin_op();
+    iput(ff.ip);
+    end_op();
+  }
+}
+801018ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801018b1:	5b                   	pop    %ebx
+801018b2:	5e                   	pop    %esi
+801018b3:	5f                   	pop    %edi
+801018b4:	5d                   	pop    %ebp
+801018b5:	c3                   	ret
+801018b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801018bd:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&ftable.lock);
+801018c0:	c7 45 08 e0 a0 15 80 	movl   $0x8015a0e0,0x8(%ebp)
+}
+801018c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801018ca:	5b                   	pop    %ebx
+801018cb:	5e                   	pop    %esi
+801018cc:	5f                   	pop    %edi
+801018cd:	5d                   	pop    %ebp
+    release(&ftable.lock);
+801018ce:	e9 ad 56 00 00       	jmp    80106f80 <release>
+801018d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801018d7:	90                   	nop
+    begin_op();
+801018d8:	e8 c3 2e 00 00       	call   801047a0 <begin_op>
+    iput(ff.ip);
+801018dd:	83 ec 0c             	sub    $0xc,%esp
+801018e0:	ff 75 e0             	push   -0x20(%ebp)
+801018e3:	e8 f8 09 00 00       	call   801022e0 <iput>
+    end_op();
+801018e8:	83 c4 10             	add    $0x10,%esp
+}
+801018eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801018ee:	5b                   	pop    %ebx
+801018ef:	5e                   	pop    %esi
+801018f0:	5f                   	pop    %edi
+801018f1:	5d                   	pop    %ebp
+    end_op();
+801018f2:	e9 59 2f 00 00       	jmp    80104850 <end_op>
+801018f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801018fe:	66 90                	xchg   %ax,%ax
+    pipeclose(ff.pipe, ff.writable);
+80101900:	0f be 5d e7          	movsbl -0x19(%ebp),%ebx
+80101904:	83 ec 08             	sub    $0x8,%esp
+80101907:	53                   	push   %ebx
+80101908:	56                   	push   %esi
+80101909:	e8 52 3b 00 00       	call   80105460 <pipeclose>
+8010190e:	83 c4 10             	add    $0x10,%esp
+}
+80101911:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101914:	5b                   	pop    %ebx
+80101915:	5e                   	pop    %esi
+80101916:	5f                   	pop    %edi
+80101917:	5d                   	pop    %ebp
+80101918:	c3                   	ret
+    panic("fileclose");
+80101919:	83 ec 0c             	sub    $0xc,%esp
+8010191c:	68 d4 b4 10 80       	push   $0x8010b4d4
+80101921:	e8 9a f2 ff ff       	call   80100bc0 <panic>
+80101926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010192d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101930 <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+80101930:	55                   	push   %ebp
+80101931:	89 e5                	mov    %esp,%ebp
+80101933:	53                   	push   %ebx
+80101934:	83 ec 04             	sub    $0x4,%esp
+80101937:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+8010193a:	83 3b 02             	cmpl   $0x2,(%ebx)
+8010193d:	75 31                	jne    80101970 <filestat+0x40>
+    ilock(f->ip);
+8010193f:	83 ec 0c             	sub    $0xc,%esp
+80101942:	ff 73 10             	push   0x10(%ebx)
+80101945:	e8 76 08 00 00       	call   801021c0 <ilock>
+    stati(f->ip, st);
+8010194a:	58                   	pop    %eax
+8010194b:	5a                   	pop    %edx
+8010194c:	ff 75 0c             	push   0xc(%ebp)
+8010194f:	ff 73 10             	push   0x10(%ebx)
+80101952:	e8 39 0b 00 00       	call   80102490 <stati>
+    iunlock(f->ip);
+80101957:	59                   	pop    %ecx
+80101958:	ff 73 10             	push   0x10(%ebx)
+8010195b:	e8 30 09 00 00       	call   80102290 <iunlock>
+    return 0;
+  }
+  return -1;
+}
+80101960:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80101963:	83 c4 10             	add    $0x10,%esp
+80101966:	31 c0                	xor    %eax,%eax
+}
+80101968:	c9                   	leave
+80101969:	c3                   	ret
+8010196a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101970:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+80101973:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80101978:	c9                   	leave
+80101979:	c3                   	ret
+8010197a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101980 <fileread>:
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+80101980:	55                   	push   %ebp
+80101981:	89 e5                	mov    %esp,%ebp
+80101983:	57                   	push   %edi
+80101984:	56                   	push   %esi
+80101985:	53                   	push   %ebx
+80101986:	83 ec 0c             	sub    $0xc,%esp
+80101989:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010198c:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010198f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int r;
+
+  if(f->readable == 0)
+80101992:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+80101996:	74 60                	je     801019f8 <fileread+0x78>
+    return -1;
+  if(f->type == FD_PIPE)
+80101998:	8b 03                	mov    (%ebx),%eax
+8010199a:	83 f8 01             	cmp    $0x1,%eax
+8010199d:	74 41                	je     801019e0 <fileread+0x60>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+8010199f:	83 f8 02             	cmp    $0x2,%eax
+801019a2:	75 5b                	jne    801019ff <fileread+0x7f>
+    ilock(f->ip);
+801019a4:	83 ec 0c             	sub    $0xc,%esp
+801019a7:	ff 73 10             	push   0x10(%ebx)
+801019aa:	e8 11 08 00 00       	call   801021c0 <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+801019af:	57                   	push   %edi
+801019b0:	ff 73 14             	push   0x14(%ebx)
+801019b3:	56                   	push   %esi
+801019b4:	ff 73 10             	push   0x10(%ebx)
+801019b7:	e8 24 0b 00 00       	call   801024e0 <readi>
+801019bc:	83 c4 20             	add    $0x20,%esp
+801019bf:	89 c6                	mov    %eax,%esi
+801019c1:	85 c0                	test   %eax,%eax
+801019c3:	7e 03                	jle    801019c8 <fileread+0x48>
+      f->off += r;
+801019c5:	01 43 14             	add    %eax,0x14(%ebx)
+    iunlock(f->ip);
+801019c8:	83 ec 0c             	sub    $0xc,%esp
+801019cb:	ff 73 10             	push   0x10(%ebx)
+801019ce:	e8 bd 08 00 00       	call   80102290 <iunlock>
+    return r;
+801019d3:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+801019d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801019d9:	89 f0                	mov    %esi,%eax
+801019db:	5b                   	pop    %ebx
+801019dc:	5e                   	pop    %esi
+801019dd:	5f                   	pop    %edi
+801019de:	5d                   	pop    %ebp
+801019df:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+801019e0:	8b 43 0c             	mov    0xc(%ebx),%eax
+801019e3:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+801019e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801019e9:	5b                   	pop    %ebx
+801019ea:	5e                   	pop    %esi
+801019eb:	5f                   	pop    %edi
+801019ec:	5d                   	pop    %ebp
+    return piperead(f->pipe, addr, n);
+801019ed:	e9 2e 3c 00 00       	jmp    80105620 <piperead>
+801019f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+801019f8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801019fd:	eb d7                	jmp    801019d6 <fileread+0x56>
+  panic("fileread");
+801019ff:	83 ec 0c             	sub    $0xc,%esp
+80101a02:	68 de b4 10 80       	push   $0x8010b4de
+80101a07:	e8 b4 f1 ff ff       	call   80100bc0 <panic>
+80101a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101a10 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+80101a10:	55                   	push   %ebp
+80101a11:	89 e5                	mov    %esp,%ebp
+80101a13:	57                   	push   %edi
+80101a14:	56                   	push   %esi
+80101a15:	53                   	push   %ebx
+80101a16:	83 ec 1c             	sub    $0x1c,%esp
+80101a19:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101a1c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80101a1f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80101a22:	8b 45 10             	mov    0x10(%ebp),%eax
+  int r;
+
+  if(f->writable == 0)
+80101a25:	80 7b 09 00          	cmpb   $0x0,0x9(%ebx)
+{
+80101a29:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(f->writable == 0)
+80101a2c:	0f 84 bb 00 00 00    	je     80101aed <filewrite+0xdd>
+    return -1;
+  if(f->type == FD_PIPE)
+80101a32:	8b 03                	mov    (%ebx),%eax
+80101a34:	83 f8 01             	cmp    $0x1,%eax
+80101a37:	0f 84 bf 00 00 00    	je     80101afc <filewrite+0xec>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+80101a3d:	83 f8 02             	cmp    $0x2,%eax
+80101a40:	0f 85 c8 00 00 00    	jne    80101b0e <filewrite+0xfe>
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((LOGSIZE-1-1-2) / 2) * 512;
+    int i = 0;
+    while(i < n){
+80101a46:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    int i = 0;
+80101a49:	31 f6                	xor    %esi,%esi
+    while(i < n){
+80101a4b:	85 c0                	test   %eax,%eax
+80101a4d:	7f 30                	jg     80101a7f <filewrite+0x6f>
+80101a4f:	e9 94 00 00 00       	jmp    80101ae8 <filewrite+0xd8>
+80101a54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        n1 = max;
+
+      begin_op();
+      ilock(f->ip);
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+        f->off += r;
+80101a58:	01 43 14             	add    %eax,0x14(%ebx)
+      iunlock(f->ip);
+80101a5b:	83 ec 0c             	sub    $0xc,%esp
+        f->off += r;
+80101a5e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+80101a61:	ff 73 10             	push   0x10(%ebx)
+80101a64:	e8 27 08 00 00       	call   80102290 <iunlock>
+      end_op();
+80101a69:	e8 e2 2d 00 00       	call   80104850 <end_op>
+
+      if(r < 0)
+        break;
+      if(r != n1)
+80101a6e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101a71:	83 c4 10             	add    $0x10,%esp
+80101a74:	39 c7                	cmp    %eax,%edi
+80101a76:	75 5c                	jne    80101ad4 <filewrite+0xc4>
+        panic("short filewrite");
+      i += r;
+80101a78:	01 fe                	add    %edi,%esi
+    while(i < n){
+80101a7a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+80101a7d:	7e 69                	jle    80101ae8 <filewrite+0xd8>
+      int n1 = n - i;
+80101a7f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if(n1 > max)
+80101a82:	b8 00 1a 00 00       	mov    $0x1a00,%eax
+      int n1 = n - i;
+80101a87:	29 f7                	sub    %esi,%edi
+      if(n1 > max)
+80101a89:	39 c7                	cmp    %eax,%edi
+80101a8b:	0f 4f f8             	cmovg  %eax,%edi
+      begin_op();
+80101a8e:	e8 0d 2d 00 00       	call   801047a0 <begin_op>
+      ilock(f->ip);
+80101a93:	83 ec 0c             	sub    $0xc,%esp
+80101a96:	ff 73 10             	push   0x10(%ebx)
+80101a99:	e8 22 07 00 00       	call   801021c0 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+80101a9e:	57                   	push   %edi
+80101a9f:	ff 73 14             	push   0x14(%ebx)
+80101aa2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101aa5:	01 f0                	add    %esi,%eax
+80101aa7:	50                   	push   %eax
+80101aa8:	ff 73 10             	push   0x10(%ebx)
+80101aab:	e8 f0 0b 00 00       	call   801026a0 <writei>
+80101ab0:	83 c4 20             	add    $0x20,%esp
+80101ab3:	85 c0                	test   %eax,%eax
+80101ab5:	7f a1                	jg     80101a58 <filewrite+0x48>
+80101ab7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+80101aba:	83 ec 0c             	sub    $0xc,%esp
+80101abd:	ff 73 10             	push   0x10(%ebx)
+80101ac0:	e8 cb 07 00 00       	call   80102290 <iunlock>
+      end_op();
+80101ac5:	e8 86 2d 00 00       	call   80104850 <end_op>
+      if(r < 0)
+80101aca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101acd:	83 c4 10             	add    $0x10,%esp
+80101ad0:	85 c0                	test   %eax,%eax
+80101ad2:	75 14                	jne    80101ae8 <filewrite+0xd8>
+        panic("short filewrite");
+80101ad4:	83 ec 0c             	sub    $0xc,%esp
+80101ad7:	68 e7 b4 10 80       	push   $0x8010b4e7
+80101adc:	e8 df f0 ff ff       	call   80100bc0 <panic>
+80101ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+    return i == n ? n : -1;
+80101ae8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+80101aeb:	74 05                	je     80101af2 <filewrite+0xe2>
+    return -1;
+80101aed:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  }
+  panic("filewrite");
+}
+80101af2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101af5:	89 f0                	mov    %esi,%eax
+80101af7:	5b                   	pop    %ebx
+80101af8:	5e                   	pop    %esi
+80101af9:	5f                   	pop    %edi
+80101afa:	5d                   	pop    %ebp
+80101afb:	c3                   	ret
+    return pipewrite(f->pipe, addr, n);
+80101afc:	8b 43 0c             	mov    0xc(%ebx),%eax
+80101aff:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101b02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101b05:	5b                   	pop    %ebx
+80101b06:	5e                   	pop    %esi
+80101b07:	5f                   	pop    %edi
+80101b08:	5d                   	pop    %ebp
+    return pipewrite(f->pipe, addr, n);
+80101b09:	e9 f2 39 00 00       	jmp    80105500 <pipewrite>
+  panic("filewrite");
+80101b0e:	83 ec 0c             	sub    $0xc,%esp
+80101b11:	68 ed b4 10 80       	push   $0x8010b4ed
+80101b16:	e8 a5 f0 ff ff       	call   80100bc0 <panic>
+80101b1b:	66 90                	xchg   %ax,%ax
+80101b1d:	66 90                	xchg   %ax,%ax
+80101b1f:	90                   	nop
+
+80101b20 <balloc>:
+// Blocks.
+
+// Allocate a zeroed disk block.
+static uint
+balloc(uint dev)
+{
+80101b20:	55                   	push   %ebp
+80101b21:	89 e5                	mov    %esp,%ebp
+80101b23:	57                   	push   %edi
+80101b24:	56                   	push   %esi
+80101b25:	53                   	push   %ebx
+80101b26:	83 ec 1c             	sub    $0x1c,%esp
+  int b, bi, m;
+  struct buf *bp;
+
+  bp = 0;
+  for(b = 0; b < sb.size; b += BPB){
+80101b29:	8b 0d a0 c9 15 80    	mov    0x8015c9a0,%ecx
+{
+80101b2f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+80101b32:	85 c9                	test   %ecx,%ecx
+80101b34:	0f 84 8d 00 00 00    	je     80101bc7 <balloc+0xa7>
+80101b3a:	31 ff                	xor    %edi,%edi
+    bp = bread(dev, BBLOCK(b, sb));
+80101b3c:	89 f8                	mov    %edi,%eax
+80101b3e:	83 ec 08             	sub    $0x8,%esp
+80101b41:	89 fe                	mov    %edi,%esi
+80101b43:	c1 f8 0c             	sar    $0xc,%eax
+80101b46:	03 05 b8 c9 15 80    	add    0x8015c9b8,%eax
+80101b4c:	50                   	push   %eax
+80101b4d:	ff 75 dc             	push   -0x24(%ebp)
+80101b50:	e8 7b ed ff ff       	call   801008d0 <bread>
+80101b55:	89 7d d8             	mov    %edi,-0x28(%ebp)
+80101b58:	83 c4 10             	add    $0x10,%esp
+80101b5b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+80101b5e:	a1 a0 c9 15 80       	mov    0x8015c9a0,%eax
+80101b63:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101b66:	31 c0                	xor    %eax,%eax
+80101b68:	eb 33                	jmp    80101b9d <balloc+0x7d>
+80101b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      m = 1 << (bi % 8);
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80101b70:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101b73:	89 c2                	mov    %eax,%edx
+      m = 1 << (bi % 8);
+80101b75:	89 c1                	mov    %eax,%ecx
+80101b77:	bb 01 00 00 00       	mov    $0x1,%ebx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80101b7c:	c1 fa 03             	sar    $0x3,%edx
+      m = 1 << (bi % 8);
+80101b7f:	83 e1 07             	and    $0x7,%ecx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80101b82:	03 57 64             	add    0x64(%edi),%edx
+      m = 1 << (bi % 8);
+80101b85:	d3 e3                	shl    %cl,%ebx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80101b87:	0f b6 3a             	movzbl (%edx),%edi
+80101b8a:	89 f9                	mov    %edi,%ecx
+80101b8c:	85 df                	test   %ebx,%edi
+80101b8e:	74 48                	je     80101bd8 <balloc+0xb8>
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+80101b90:	83 c0 01             	add    $0x1,%eax
+80101b93:	83 c6 01             	add    $0x1,%esi
+80101b96:	3d 00 10 00 00       	cmp    $0x1000,%eax
+80101b9b:	74 07                	je     80101ba4 <balloc+0x84>
+80101b9d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80101ba0:	39 fe                	cmp    %edi,%esi
+80101ba2:	72 cc                	jb     80101b70 <balloc+0x50>
+        brelse(bp);
+        bzero(dev, b + bi);
+        return b + bi;
+      }
+    }
+    brelse(bp);
+80101ba4:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80101ba7:	83 ec 0c             	sub    $0xc,%esp
+80101baa:	ff 75 e4             	push   -0x1c(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+80101bad:	81 c7 00 10 00 00    	add    $0x1000,%edi
+    brelse(bp);
+80101bb3:	e8 68 ee ff ff       	call   80100a20 <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+80101bb8:	83 c4 10             	add    $0x10,%esp
+80101bbb:	3b 3d a0 c9 15 80    	cmp    0x8015c9a0,%edi
+80101bc1:	0f 82 75 ff ff ff    	jb     80101b3c <balloc+0x1c>
+  }
+  panic("balloc: out of blocks");
+80101bc7:	83 ec 0c             	sub    $0xc,%esp
+80101bca:	68 f7 b4 10 80       	push   $0x8010b4f7
+80101bcf:	e8 ec ef ff ff       	call   80100bc0 <panic>
+80101bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bp->data[bi/8] |= m;  // Mark block in use.
+80101bd8:	09 d9                	or     %ebx,%ecx
+        log_write(bp);
+80101bda:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101bdd:	83 ec 0c             	sub    $0xc,%esp
+        bp->data[bi/8] |= m;  // Mark block in use.
+80101be0:	88 0a                	mov    %cl,(%edx)
+        log_write(bp);
+80101be2:	53                   	push   %ebx
+80101be3:	e8 f8 2c 00 00       	call   801048e0 <log_write>
+        brelse(bp);
+80101be8:	89 1c 24             	mov    %ebx,(%esp)
+80101beb:	e8 30 ee ff ff       	call   80100a20 <brelse>
+  bp = bread(dev, bno);
+80101bf0:	58                   	pop    %eax
+80101bf1:	5a                   	pop    %edx
+80101bf2:	56                   	push   %esi
+80101bf3:	ff 75 dc             	push   -0x24(%ebp)
+80101bf6:	e8 d5 ec ff ff       	call   801008d0 <bread>
+  memset(bp->data, 0, BSIZE);
+80101bfb:	83 c4 0c             	add    $0xc,%esp
+80101bfe:	68 00 02 00 00       	push   $0x200
+  bp = bread(dev, bno);
+80101c03:	89 c3                	mov    %eax,%ebx
+  memset(bp->data, 0, BSIZE);
+80101c05:	6a 00                	push   $0x0
+80101c07:	ff 70 64             	push   0x64(%eax)
+80101c0a:	e8 31 56 00 00       	call   80107240 <memset>
+  log_write(bp);
+80101c0f:	89 1c 24             	mov    %ebx,(%esp)
+80101c12:	e8 c9 2c 00 00       	call   801048e0 <log_write>
+  brelse(bp);
+80101c17:	89 1c 24             	mov    %ebx,(%esp)
+80101c1a:	e8 01 ee ff ff       	call   80100a20 <brelse>
+}
+80101c1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c22:	89 f0                	mov    %esi,%eax
+80101c24:	5b                   	pop    %ebx
+80101c25:	5e                   	pop    %esi
+80101c26:	5f                   	pop    %edi
+80101c27:	5d                   	pop    %ebp
+80101c28:	c3                   	ret
+80101c29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101c30 <iget>:
+// Find the inode with number inum on device dev
+// and return the in-memory copy. Does not lock
+// the inode and does not read it from disk.
+static struct inode*
+iget(uint dev, uint inum)
+{
+80101c30:	55                   	push   %ebp
+80101c31:	89 e5                	mov    %esp,%ebp
+80101c33:	57                   	push   %edi
+80101c34:	89 c7                	mov    %eax,%edi
+80101c36:	56                   	push   %esi
+  struct inode *ip, *empty;
+
+  acquire(&icache.lock);
+
+  // Is the inode already cached?
+  empty = 0;
+80101c37:	31 f6                	xor    %esi,%esi
+{
+80101c39:	53                   	push   %ebx
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101c3a:	bb 14 ab 15 80       	mov    $0x8015ab14,%ebx
+{
+80101c3f:	83 ec 28             	sub    $0x28,%esp
+80101c42:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquire(&icache.lock);
+80101c45:	68 e0 aa 15 80       	push   $0x8015aae0
+80101c4a:	e8 11 51 00 00       	call   80106d60 <acquire>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101c4f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  acquire(&icache.lock);
+80101c52:	83 c4 10             	add    $0x10,%esp
+80101c55:	eb 1f                	jmp    80101c76 <iget+0x46>
+80101c57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101c5e:	66 90                	xchg   %ax,%ax
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101c60:	39 3b                	cmp    %edi,(%ebx)
+80101c62:	0f 84 88 00 00 00    	je     80101cf0 <iget+0xc0>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101c68:	81 c3 9c 00 00 00    	add    $0x9c,%ebx
+80101c6e:	81 fb 8c c9 15 80    	cmp    $0x8015c98c,%ebx
+80101c74:	74 2a                	je     80101ca0 <iget+0x70>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101c76:	8b 43 08             	mov    0x8(%ebx),%eax
+80101c79:	85 c0                	test   %eax,%eax
+80101c7b:	7f e3                	jg     80101c60 <iget+0x30>
+      ip->ref++;
+      release(&icache.lock);
+      return ip;
+    }
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+80101c7d:	85 f6                	test   %esi,%esi
+80101c7f:	75 e7                	jne    80101c68 <iget+0x38>
+80101c81:	85 c0                	test   %eax,%eax
+80101c83:	0f 85 ad 00 00 00    	jne    80101d36 <iget+0x106>
+80101c89:	89 de                	mov    %ebx,%esi
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101c8b:	81 c3 9c 00 00 00    	add    $0x9c,%ebx
+80101c91:	81 fb 8c c9 15 80    	cmp    $0x8015c98c,%ebx
+80101c97:	75 dd                	jne    80101c76 <iget+0x46>
+80101c99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      empty = ip;
+  }
+
+  // Recycle an inode cache entry.
+  if(empty == 0)
+80101ca0:	85 f6                	test   %esi,%esi
+80101ca2:	0f 84 ac 00 00 00    	je     80101d54 <iget+0x124>
+    panic("iget: no inodes");
+
+  ip = empty;
+  if(ip->flags & I_PCACHE)
+80101ca8:	f6 46 4c 04          	testb  $0x4,0x4c(%esi)
+80101cac:	75 6d                	jne    80101d1b <iget+0xeb>
+  ip->ref = 1;
+  ip->flags = 0;
+  ip->nexec = 0;
+  ip->ranext = 0;
+  ip->raend = 0;
+  release(&icache.lock);
+80101cae:	83 ec 0c             	sub    $0xc,%esp
+  ip->dev = dev;
+80101cb1:	89 3e                	mov    %edi,(%esi)
+  ip->inum = inum;
+80101cb3:	89 56 04             	mov    %edx,0x4(%esi)
+  ip->ref = 1;
+80101cb6:	c7 46 08 01 00 00 00 	movl   $0x1,0x8(%esi)
+  ip->flags = 0;
+80101cbd:	c7 46 4c 00 00 00 00 	movl   $0x0,0x4c(%esi)
+  ip->nexec = 0;
+80101cc4:	c7 46 58 00 00 00 00 	movl   $0x0,0x58(%esi)
+  ip->ranext = 0;
+80101ccb:	c7 46 50 00 00 00 00 	movl   $0x0,0x50(%esi)
+  ip->raend = 0;
+80101cd2:	c7 46 54 00 00 00 00 	movl   $0x0,0x54(%esi)
+  release(&icache.lock);
+80101cd9:	68 e0 aa 15 80       	push   $0x8015aae0
+80101cde:	e8 9d 52 00 00       	call   80106f80 <release>
+
+  return ip;
+80101ce3:	83 c4 10             	add    $0x10,%esp
+}
+80101ce6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101ce9:	89 f0                	mov    %esi,%eax
+80101ceb:	5b                   	pop    %ebx
+80101cec:	5e                   	pop    %esi
+80101ced:	5f                   	pop    %edi
+80101cee:	5d                   	pop    %ebp
+80101cef:	c3                   	ret
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101cf0:	39 53 04             	cmp    %edx,0x4(%ebx)
+80101cf3:	0f 85 6f ff ff ff    	jne    80101c68 <iget+0x38>
+      ip->ref++;
+80101cf9:	83 c0 01             	add    $0x1,%eax
+      release(&icache.lock);
+80101cfc:	83 ec 0c             	sub    $0xc,%esp
+      return ip;
+80101cff:	89 de                	mov    %ebx,%esi
+      ip->ref++;
+80101d01:	89 43 08             	mov    %eax,0x8(%ebx)
+      release(&icache.lock);
+80101d04:	68 e0 aa 15 80       	push   $0x8015aae0
+80101d09:	e8 72 52 00 00       	call   80106f80 <release>
+      return ip;
+80101d0e:	83 c4 10             	add    $0x10,%esp
+}
+80101d11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101d14:	89 f0                	mov    %esi,%eax
+80101d16:	5b                   	pop    %ebx
+80101d17:	5e                   	pop    %esi
+80101d18:	5f                   	pop    %edi
+80101d19:	5d                   	pop    %ebp
+80101d1a:	c3                   	ret
+80101d1b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    pcinval(ip->dev, ip->inum);  // a later write could not find them
+80101d1e:	83 ec 08             	sub    $0x8,%esp
+80101d21:	ff 76 04             	push   0x4(%esi)
+80101d24:	ff 36                	push   (%esi)
+80101d26:	e8 65 34 00 00       	call   80105190 <pcinval>
+80101d2b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101d2e:	83 c4 10             	add    $0x10,%esp
+80101d31:	e9 78 ff ff ff       	jmp    80101cae <iget+0x7e>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101d36:	81 c3 9c 00 00 00    	add    $0x9c,%ebx
+80101d3c:	81 fb 8c c9 15 80    	cmp    $0x8015c98c,%ebx
+80101d42:	74 10                	je     80101d54 <iget+0x124>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101d44:	8b 43 08             	mov    0x8(%ebx),%eax
+80101d47:	85 c0                	test   %eax,%eax
+80101d49:	0f 8f 11 ff ff ff    	jg     80101c60 <iget+0x30>
+80101d4f:	e9 2d ff ff ff       	jmp    80101c81 <iget+0x51>
+    panic("iget: no inodes");
+80101d54:	83 ec 0c             	sub    $0xc,%esp
+80101d57:	68 0d b5 10 80       	push   $0x8010b50d
+80101d5c:	e8 5f ee ff ff       	call   80100bc0 <panic>
+80101d61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101d68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101d6f:	90                   	nop
+
+80101d70 <bmap>:
+
+// Return the disk block address of the nth block in inode ip.
+// If there is no such block, bmap allocates one.
+static uint
+bmap(struct inode *ip, uint bn)
+{
+80101d70:	55                   	push   %ebp
+80101d71:	89 e5                	mov    %esp,%ebp
+80101d73:	57                   	push   %edi
+80101d74:	56                   	push   %esi
+80101d75:	89 c6                	mov    %eax,%esi
+80101d77:	53                   	push   %ebx
+80101d78:	83 ec 1c             	sub    $0x1c,%esp
+  uint addr, *a;
+  struct buf *bp;
+
+  if(bn < NDIRECT){
+80101d7b:	83 fa 0b             	cmp    $0xb,%edx
+80101d7e:	0f 86 8c 00 00 00    	jbe    80101e10 <bmap+0xa0>
+    if((addr = ip->addrs[bn]) == 0)
+      ip->addrs[bn] = addr = balloc(ip->dev);
+    return addr;
+  }
+  bn -= NDIRECT;
+80101d84:	8d 5a f4             	lea    -0xc(%edx),%ebx
+
+  if(bn < NINDIRECT){
+80101d87:	83 fb 7f             	cmp    $0x7f,%ebx
+80101d8a:	0f 87 a2 00 00 00    	ja     80101e32 <bmap+0xc2>
+    // Load indirect block, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT]) == 0)
+80101d90:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+80101d96:	85 c0                	test   %eax,%eax
+80101d98:	74 5e                	je     80101df8 <bmap+0x88>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+    bp = bread(ip->dev, addr);
+80101d9a:	83 ec 08             	sub    $0x8,%esp
+80101d9d:	50                   	push   %eax
+80101d9e:	ff 36                	push   (%esi)
+80101da0:	e8 2b eb ff ff       	call   801008d0 <bread>
+    a = (uint*)bp->data;
+    if((addr = a[bn]) == 0){
+80101da5:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+80101da8:	89 c2                	mov    %eax,%edx
+    if((addr = a[bn]) == 0){
+80101daa:	8b 40 64             	mov    0x64(%eax),%eax
+80101dad:	8d 1c 98             	lea    (%eax,%ebx,4),%ebx
+80101db0:	8b 3b                	mov    (%ebx),%edi
+80101db2:	85 ff                	test   %edi,%edi
+80101db4:	74 1a                	je     80101dd0 <bmap+0x60>
+      a[bn] = addr = balloc(ip->dev);
+      log_write(bp);
+    }
+    brelse(bp);
+80101db6:	83 ec 0c             	sub    $0xc,%esp
+80101db9:	52                   	push   %edx
+80101dba:	e8 61 ec ff ff       	call   80100a20 <brelse>
+80101dbf:	83 c4 10             	add    $0x10,%esp
+    return addr;
+  }
+
+  panic("bmap: out of range");
+}
+80101dc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101dc5:	89 f8                	mov    %edi,%eax
+80101dc7:	5b                   	pop    %ebx
+80101dc8:	5e                   	pop    %esi
+80101dc9:	5f                   	pop    %edi
+80101dca:	5d                   	pop    %ebp
+80101dcb:	c3                   	ret
+80101dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      a[bn] = addr = balloc(ip->dev);
+80101dd0:	8b 06                	mov    (%esi),%eax
+80101dd2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80101dd5:	e8 46 fd ff ff       	call   80101b20 <balloc>
+      log_write(bp);
+80101dda:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101ddd:	83 ec 0c             	sub    $0xc,%esp
+      a[bn] = addr = balloc(ip->dev);
+80101de0:	89 03                	mov    %eax,(%ebx)
+80101de2:	89 c7                	mov    %eax,%edi
+      log_write(bp);
+80101de4:	52                   	push   %edx
+80101de5:	e8 f6 2a 00 00       	call   801048e0 <log_write>
+80101dea:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101ded:	83 c4 10             	add    $0x10,%esp
+80101df0:	eb c4                	jmp    80101db6 <bmap+0x46>
+80101df2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+80101df8:	8b 06                	mov    (%esi),%eax
+80101dfa:	e8 21 fd ff ff       	call   80101b20 <balloc>
+80101dff:	89 86 98 00 00 00    	mov    %eax,0x98(%esi)
+80101e05:	eb 93                	jmp    80101d9a <bmap+0x2a>
+80101e07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101e0e:	66 90                	xchg   %ax,%ax
+    if((addr = ip->addrs[bn]) == 0)
+80101e10:	8d 5a 18             	lea    0x18(%edx),%ebx
+80101e13:	8b 7c 98 08          	mov    0x8(%eax,%ebx,4),%edi
+80101e17:	85 ff                	test   %edi,%edi
+80101e19:	75 a7                	jne    80101dc2 <bmap+0x52>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+80101e1b:	8b 00                	mov    (%eax),%eax
+80101e1d:	e8 fe fc ff ff       	call   80101b20 <balloc>
+80101e22:	89 44 9e 08          	mov    %eax,0x8(%esi,%ebx,4)
+80101e26:	89 c7                	mov    %eax,%edi
+}
+80101e28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101e2b:	5b                   	pop    %ebx
+80101e2c:	89 f8                	mov    %edi,%eax
+80101e2e:	5e                   	pop    %esi
+80101e2f:	5f                   	pop    %edi
+80101e30:	5d                   	pop    %ebp
+80101e31:	c3                   	ret
+  panic("bmap: out of range");
+80101e32:	83 ec 0c             	sub    $0xc,%esp
+80101e35:	68 1d b5 10 80       	push   $0x8010b51d
+80101e3a:	e8 81 ed ff ff       	call   80100bc0 <panic>
+80101e3f:	90                   	nop
+
+80101e40 <bfree>:
+{
+80101e40:	55                   	push   %ebp
+80101e41:	89 e5                	mov    %esp,%ebp
+80101e43:	57                   	push   %edi
+80101e44:	56                   	push   %esi
+80101e45:	89 c6                	mov    %eax,%esi
+80101e47:	53                   	push   %ebx
+80101e48:	89 d3                	mov    %edx,%ebx
+80101e4a:	83 ec 14             	sub    $0x14,%esp
+  bp = bread(dev, 1);
+80101e4d:	6a 01                	push   $0x1
+80101e4f:	50                   	push   %eax
+80101e50:	e8 7b ea ff ff       	call   801008d0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80101e55:	83 c4 0c             	add    $0xc,%esp
+80101e58:	6a 24                	push   $0x24
+  bp = bread(dev, 1);
+80101e5a:	89 c7                	mov    %eax,%edi
+  memmove(sb, bp->data, sizeof(*sb));
+80101e5c:	ff 70 64             	push   0x64(%eax)
+80101e5f:	68 a0 c9 15 80       	push   $0x8015c9a0
+80101e64:	e8 67 54 00 00       	call   801072d0 <memmove>
+  brelse(bp);
+80101e69:	89 3c 24             	mov    %edi,(%esp)
+80101e6c:	e8 af eb ff ff       	call   80100a20 <brelse>
+  bp = bread(dev, BBLOCK(b, sb));
+80101e71:	58                   	pop    %eax
+80101e72:	89 d8                	mov    %ebx,%eax
+80101e74:	5a                   	pop    %edx
+80101e75:	c1 e8 0c             	shr    $0xc,%eax
+80101e78:	03 05 b8 c9 15 80    	add    0x8015c9b8,%eax
+80101e7e:	50                   	push   %eax
+80101e7f:	56                   	push   %esi
+80101e80:	e8 4b ea ff ff       	call   801008d0 <bread>
+  m = 1 << (bi % 8);
+80101e85:	89 d9                	mov    %ebx,%ecx
+  if((bp->data[bi/8] & m) == 0)
+80101e87:	c1 fb 03             	sar    $0x3,%ebx
+80101e8a:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+80101e8d:	89 c6                	mov    %eax,%esi
+  m = 1 << (bi % 8);
+80101e8f:	83 e1 07             	and    $0x7,%ecx
+80101e92:	b8 01 00 00 00       	mov    $0x1,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101e97:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+80101e9d:	03 5e 64             	add    0x64(%esi),%ebx
+  m = 1 << (bi % 8);
+80101ea0:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101ea2:	0f b6 0b             	movzbl (%ebx),%ecx
+80101ea5:	85 c1                	test   %eax,%ecx
+80101ea7:	74 22                	je     80101ecb <bfree+0x8b>
+  bp->data[bi/8] &= ~m;
+80101ea9:	f7 d0                	not    %eax
+  log_write(bp);
+80101eab:	83 ec 0c             	sub    $0xc,%esp
+  bp->data[bi/8] &= ~m;
+80101eae:	21 c8                	and    %ecx,%eax
+80101eb0:	88 03                	mov    %al,(%ebx)
+  log_write(bp);
+80101eb2:	56                   	push   %esi
+80101eb3:	e8 28 2a 00 00       	call   801048e0 <log_write>
+  brelse(bp);
+80101eb8:	89 34 24             	mov    %esi,(%esp)
+80101ebb:	e8 60 eb ff ff       	call   80100a20 <brelse>
+}
+80101ec0:	83 c4 10             	add    $0x10,%esp
+80101ec3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101ec6:	5b                   	pop    %ebx
+80101ec7:	5e                   	pop    %esi
+80101ec8:	5f                   	pop    %edi
+80101ec9:	5d                   	pop    %ebp
+80101eca:	c3                   	ret
+    panic("freeing free block");
+80101ecb:	83 ec 0c             	sub    $0xc,%esp
+80101ece:	68 30 b5 10 80       	push   $0x8010b530
+80101ed3:	e8 e8 ec ff ff       	call   80100bc0 <panic>
+80101ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101edf:	90                   	nop
+
+80101ee0 <readsb>:
+{
+80101ee0:	55                   	push   %ebp
+80101ee1:	89 e5                	mov    %esp,%ebp
+80101ee3:	56                   	push   %esi
+80101ee4:	53                   	push   %ebx
+80101ee5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  bp = bread(dev, 1);
+80101ee8:	83 ec 08             	sub    $0x8,%esp
+80101eeb:	6a 01                	push   $0x1
+80101eed:	ff 75 08             	push   0x8(%ebp)
+80101ef0:	e8 db e9 ff ff       	call   801008d0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80101ef5:	83 c4 0c             	add    $0xc,%esp
+80101ef8:	6a 24                	push   $0x24
+  bp = bread(dev, 1);
+80101efa:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80101efc:	ff 70 64             	push   0x64(%eax)
+80101eff:	56                   	push   %esi
+80101f00:	e8 cb 53 00 00       	call   801072d0 <memmove>
+  brelse(bp);
+80101f05:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80101f08:	83 c4 10             	add    $0x10,%esp
+}
+80101f0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101f0e:	5b                   	pop    %ebx
+80101f0f:	5e                   	pop    %esi
+80101f10:	5d                   	pop    %ebp
+  brelse(bp);
+80101f11:	e9 0a eb ff ff       	jmp    80100a20 <brelse>
+80101f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101f1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101f20 <iinit>:
+{
+80101f20:	55                   	push   %ebp
+80101f21:	89 e5                	mov    %esp,%ebp
+80101f23:	53                   	push   %ebx
+80101f24:	bb 20 ab 15 80       	mov    $0x8015ab20,%ebx
+80101f29:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&icache.lock, "icache");
+80101f2c:	68 43 b5 10 80       	push   $0x8010b543
+80101f31:	68 e0 aa 15 80       	push   $0x8015aae0
+80101f36:	e8 05 4e 00 00       	call   80106d40 <initlock>
+  for(i = 0; i < NINODE; i++) {
+80101f3b:	83 c4 10             	add    $0x10,%esp
+80101f3e:	66 90                	xchg   %ax,%ax
+    initsleeplock(&icache.inode[i].lock, "inode");
+80101f40:	83 ec 08             	sub    $0x8,%esp
+80101f43:	68 4a b5 10 80       	push   $0x8010b54a
+80101f48:	53                   	push   %ebx
+  for(i = 0; i < NINODE; i++) {
+80101f49:	81 c3 9c 00 00 00    	add    $0x9c,%ebx
+    initsleeplock(&icache.inode[i].lock, "inode");
+80101f4f:	e8 dc 4c 00 00       	call   80106c30 <initsleeplock>
+  for(i = 0; i < NINODE; i++) {
+80101f54:	83 c4 10             	add    $0x10,%esp
+80101f57:	81 fb 98 c9 15 80    	cmp    $0x8015c998,%ebx
+80101f5d:	75 e1                	jne    80101f40 <iinit+0x20>
+  bp = bread(dev, 1);
+80101f5f:	83 ec 08             	sub    $0x8,%esp
+80101f62:	6a 01                	push   $0x1
+80101f64:	ff 75 08             	push   0x8(%ebp)
+80101f67:	e8 64 e9 ff ff       	call   801008d0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80101f6c:	83 c4 0c             	add    $0xc,%esp
+80101f6f:	6a 24                	push   $0x24
+  bp = bread(dev, 1);
+80101f71:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80101f73:	ff 70 64             	push   0x64(%eax)
+80101f76:	68 a0 c9 15 80       	push   $0x8015c9a0
+80101f7b:	e8 50 53 00 00       	call   801072d0 <memmove>
+  brelse(bp);
+80101f80:	89 1c 24             	mov    %ebx,(%esp)
+80101f83:	e8 98 ea ff ff       	call   80100a20 <brelse>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80101f88:	ff 35 b8 c9 15 80    	push   0x8015c9b8
+80101f8e:	ff 35 b4 c9 15 80    	push   0x8015c9b4
+80101f94:	ff 35 b0 c9 15 80    	push   0x8015c9b0
+80101f9a:	ff 35 ac c9 15 80    	push   0x8015c9ac
+80101fa0:	ff 35 a8 c9 15 80    	push   0x8015c9a8
+80101fa6:	ff 35 a4 c9 15 80    	push   0x8015c9a4
+80101fac:	ff 35 a0 c9 15 80    	push   0x8015c9a0
+80101fb2:	68 ac b5 10 80       	push   $0x8010b5ac
+80101fb7:	e8 34 ef ff ff       	call   80100ef0 <cprintf>
+}
+80101fbc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101fbf:	83 c4 30             	add    $0x30,%esp
+80101fc2:	c9                   	leave
+80101fc3:	c3                   	ret
+80101fc4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101fcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101fcf:	90                   	nop
+
+80101fd0 <ialloc>:
+{
+80101fd0:	55                   	push   %ebp
+80101fd1:	89 e5                	mov    %esp,%ebp
+80101fd3:	57                   	push   %edi
+80101fd4:	56                   	push   %esi
+80101fd5:	53                   	push   %ebx
+80101fd6:	83 ec 1c             	sub    $0x1c,%esp
+80101fd9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101fdc:	83 3d a8 c9 15 80 01 	cmpl   $0x1,0x8015c9a8
+{
+80101fe3:	8b 75 08             	mov    0x8(%ebp),%esi
+80101fe6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101fe9:	0f 86 94 00 00 00    	jbe    80102083 <ialloc+0xb3>
+80101fef:	bf 01 00 00 00       	mov    $0x1,%edi
+80101ff4:	eb 21                	jmp    80102017 <ialloc+0x47>
+80101ff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101ffd:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(bp);
+80102000:	83 ec 0c             	sub    $0xc,%esp
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102003:	83 c7 01             	add    $0x1,%edi
+    brelse(bp);
+80102006:	50                   	push   %eax
+80102007:	e8 14 ea ff ff       	call   80100a20 <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+8010200c:	83 c4 10             	add    $0x10,%esp
+8010200f:	3b 3d a8 c9 15 80    	cmp    0x8015c9a8,%edi
+80102015:	73 6c                	jae    80102083 <ialloc+0xb3>
+    bp = bread(dev, IBLOCK(inum, sb));
+80102017:	89 f8                	mov    %edi,%eax
+80102019:	83 ec 08             	sub    $0x8,%esp
+    dip = (struct dinode*)bp->data + inum%IPB;
+8010201c:	89 fb                	mov    %edi,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+8010201e:	c1 e8 03             	shr    $0x3,%eax
+80102021:	03 05 b4 c9 15 80    	add    0x8015c9b4,%eax
+    dip = (struct dinode*)bp->data + inum%IPB;
+80102027:	83 e3 07             	and    $0x7,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+8010202a:	50                   	push   %eax
+    dip = (struct dinode*)bp->data + inum%IPB;
+8010202b:	c1 e3 06             	shl    $0x6,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+8010202e:	56                   	push   %esi
+8010202f:	e8 9c e8 ff ff       	call   801008d0 <bread>
+    if(dip->type == 0){  // a free inode
+80102034:	83 c4 10             	add    $0x10,%esp
+    dip = (struct dinode*)bp->data + inum%IPB;
+80102037:	03 58 64             	add    0x64(%eax),%ebx
+    if(dip->type == 0){  // a free inode
+8010203a:	66 83 3b 00          	cmpw   $0x0,(%ebx)
+8010203e:	75 c0                	jne    80102000 <ialloc+0x30>
+      memset(dip, 0, sizeof(*dip));
+80102040:	83 ec 04             	sub    $0x4,%esp
+80102043:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102046:	6a 40                	push   $0x40
+80102048:	6a 00                	push   $0x0
+8010204a:	53                   	push   %ebx
+8010204b:	e8 f0 51 00 00       	call   80107240 <memset>
+      dip->type = type;
+80102050:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+      log_write(bp);   // mark it allocated on the disk
+80102054:	8b 55 e0             	mov    -0x20(%ebp),%edx
+      dip->type = type;
+80102057:	66 89 03             	mov    %ax,(%ebx)
+      log_write(bp);   // mark it allocated on the disk
+8010205a:	89 14 24             	mov    %edx,(%esp)
+8010205d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80102060:	e8 7b 28 00 00       	call   801048e0 <log_write>
+      brelse(bp);
+80102065:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102068:	89 14 24             	mov    %edx,(%esp)
+8010206b:	e8 b0 e9 ff ff       	call   80100a20 <brelse>
+      return iget(dev, inum);
+80102070:	83 c4 10             	add    $0x10,%esp
+}
+80102073:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return iget(dev, inum);
+80102076:	89 fa                	mov    %edi,%edx
+}
+80102078:	5b                   	pop    %ebx
+      return iget(dev, inum);
+80102079:	89 f0                	mov    %esi,%eax
+}
+8010207b:	5e                   	pop    %esi
+8010207c:	5f                   	pop    %edi
+8010207d:	5d                   	pop    %ebp
+      return iget(dev, inum);
+8010207e:	e9 ad fb ff ff       	jmp    80101c30 <iget>
+  panic("ialloc: no inodes");
+80102083:	83 ec 0c             	sub    $0xc,%esp
+80102086:	68 50 b5 10 80       	push   $0x8010b550
+8010208b:	e8 30 eb ff ff       	call   80100bc0 <panic>
+
+80102090 <iupdate>:
+{
+80102090:	55                   	push   %ebp
+80102091:	89 e5                	mov    %esp,%ebp
+80102093:	56                   	push   %esi
+80102094:	53                   	push   %ebx
+80102095:	8b 75 08             	mov    0x8(%ebp),%esi
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102098:	8b 46 04             	mov    0x4(%esi),%eax
+8010209b:	83 ec 08             	sub    $0x8,%esp
+8010209e:	c1 e8 03             	shr    $0x3,%eax
+801020a1:	03 05 b4 c9 15 80    	add    0x8015c9b4,%eax
+801020a7:	50                   	push   %eax
+801020a8:	ff 36                	push   (%esi)
+801020aa:	e8 21 e8 ff ff       	call   801008d0 <bread>
+  dip->type = ip->type;
+801020af:	0f b7 56 5c          	movzwl 0x5c(%esi),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801020b3:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801020b6:	89 c3                	mov    %eax,%ebx
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+801020b8:	8b 46 04             	mov    0x4(%esi),%eax
+801020bb:	83 e0 07             	and    $0x7,%eax
+801020be:	c1 e0 06             	shl    $0x6,%eax
+801020c1:	03 43 64             	add    0x64(%ebx),%eax
+  dip->type = ip->type;
+801020c4:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+801020c7:	0f b7 56 5e          	movzwl 0x5e(%esi),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801020cb:	83 c0 0c             	add    $0xc,%eax
+  dip->major = ip->major;
+801020ce:	66 89 50 f6          	mov    %dx,-0xa(%eax)
+  dip->minor = ip->minor;
+801020d2:	0f b7 56 60          	movzwl 0x60(%esi),%edx
+801020d6:	66 89 50 f8          	mov    %dx,-0x8(%eax)
+  dip->nlink = ip->nlink;
+801020da:	0f b7 56 62          	movzwl 0x62(%esi),%edx
+801020de:	66 89 50 fa          	mov    %dx,-0x6(%eax)
+  dip->size = ip->size;
+801020e2:	8b 56 64             	mov    0x64(%esi),%edx
+801020e5:	89 50 fc             	mov    %edx,-0x4(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801020e8:	8d 56 68             	lea    0x68(%esi),%edx
+801020eb:	6a 34                	push   $0x34
+801020ed:	52                   	push   %edx
+801020ee:	50                   	push   %eax
+801020ef:	e8 dc 51 00 00       	call   801072d0 <memmove>
+  log_write(bp);
+801020f4:	89 1c 24             	mov    %ebx,(%esp)
+801020f7:	e8 e4 27 00 00       	call   801048e0 <log_write>
+  brelse(bp);
+801020fc:	89 5d 08             	mov    %ebx,0x8(%ebp)
+801020ff:	83 c4 10             	add    $0x10,%esp
+}
+80102102:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102105:	5b                   	pop    %ebx
+80102106:	5e                   	pop    %esi
+80102107:	5d                   	pop    %ebp
+  brelse(bp);
+80102108:	e9 13 e9 ff ff       	jmp    80100a20 <brelse>
+8010210d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102110 <idup>:
+{
+80102110:	55                   	push   %ebp
+80102111:	89 e5                	mov    %esp,%ebp
+80102113:	53                   	push   %ebx
+80102114:	83 ec 10             	sub    $0x10,%esp
+80102117:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+8010211a:	68 e0 aa 15 80       	push   $0x8015aae0
+8010211f:	e8 3c 4c 00 00       	call   80106d60 <acquire>
+  ip->ref++;
+80102124:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+80102128:	c7 04 24 e0 aa 15 80 	movl   $0x8015aae0,(%esp)
+8010212f:	e8 4c 4e 00 00       	call   80106f80 <release>
+}
+80102134:	89 d8                	mov    %ebx,%eax
+80102136:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102139:	c9                   	leave
+8010213a:	c3                   	ret
+8010213b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010213f:	90                   	nop
+
+80102140 <idenywrite>:
+{
+80102140:	55                   	push   %ebp
+80102141:	89 e5                	mov    %esp,%ebp
+80102143:	53                   	push   %ebx
+80102144:	83 ec 10             	sub    $0x10,%esp
+80102147:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+8010214a:	68 e0 aa 15 80       	push   $0x8015aae0
+8010214f:	e8 0c 4c 00 00       	call   80106d60 <acquire>
+  ip->nexec++;
+80102154:	83 43 58 01          	addl   $0x1,0x58(%ebx)
+  release(&icache.lock);
+80102158:	83 c4 10             	add    $0x10,%esp
+}
+8010215b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&icache.lock);
+8010215e:	c7 45 08 e0 aa 15 80 	movl   $0x8015aae0,0x8(%ebp)
+}
+80102165:	c9                   	leave
+  release(&icache.lock);
+80102166:	e9 15 4e 00 00       	jmp    80106f80 <release>
+8010216b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010216f:	90                   	nop
+
+80102170 <iallowwrite>:
+{
+80102170:	55                   	push   %ebp
+80102171:	89 e5                	mov    %esp,%ebp
+80102173:	53                   	push   %ebx
+80102174:	83 ec 10             	sub    $0x10,%esp
+80102177:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+8010217a:	68 e0 aa 15 80       	push   $0x8015aae0
+8010217f:	e8 dc 4b 00 00       	call   80106d60 <acquire>
+  if(ip->nexec <= 0)
+80102184:	8b 43 58             	mov    0x58(%ebx),%eax
+80102187:	83 c4 10             	add    $0x10,%esp
+8010218a:	85 c0                	test   %eax,%eax
+8010218c:	7e 16                	jle    801021a4 <iallowwrite+0x34>
+  ip->nexec--;
+8010218e:	83 e8 01             	sub    $0x1,%eax
+80102191:	89 43 58             	mov    %eax,0x58(%ebx)
+}
+80102194:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&icache.lock);
+80102197:	c7 45 08 e0 aa 15 80 	movl   $0x8015aae0,0x8(%ebp)
+}
+8010219e:	c9                   	leave
+  release(&icache.lock);
+8010219f:	e9 dc 4d 00 00       	jmp    80106f80 <release>
+    panic("iallowwrite");
+801021a4:	83 ec 0c             	sub    $0xc,%esp
+801021a7:	68 62 b5 10 80       	push   $0x8010b562
+801021ac:	e8 0f ea ff ff       	call   80100bc0 <panic>
+801021b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801021b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801021bf:	90                   	nop
+
+801021c0 <ilock>:
+{
+801021c0:	55                   	push   %ebp
+801021c1:	89 e5                	mov    %esp,%ebp
+801021c3:	56                   	push   %esi
+801021c4:	53                   	push   %ebx
+801021c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+801021c8:	85 db                	test   %ebx,%ebx
+801021ca:	0f 84 b3 00 00 00    	je     80102283 <ilock+0xc3>
+801021d0:	8b 43 08             	mov    0x8(%ebx),%eax
+801021d3:	85 c0                	test   %eax,%eax
+801021d5:	0f 8e a8 00 00 00    	jle    80102283 <ilock+0xc3>
+  acquiresleep(&ip->lock);
+801021db:	83 ec 0c             	sub    $0xc,%esp
+801021de:	8d 43 0c             	lea    0xc(%ebx),%eax
+801021e1:	50                   	push   %eax
+801021e2:	e8 89 4a 00 00       	call   80106c70 <acquiresleep>
+  if(!(ip->flags & I_VALID)){
+801021e7:	83 c4 10             	add    $0x10,%esp
+801021ea:	f6 43 4c 02          	testb  $0x2,0x4c(%ebx)
+801021ee:	74 10                	je     80102200 <ilock+0x40>
+}
+801021f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801021f3:	5b                   	pop    %ebx
+801021f4:	5e                   	pop    %esi
+801021f5:	5d                   	pop    %ebp
+801021f6:	c3                   	ret
+801021f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801021fe:	66 90                	xchg   %ax,%ax
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102200:	8b 43 04             	mov    0x4(%ebx),%eax
+80102203:	83 ec 08             	sub    $0x8,%esp
+80102206:	c1 e8 03             	shr    $0x3,%eax
+80102209:	03 05 b4 c9 15 80    	add    0x8015c9b4,%eax
+8010220f:	50                   	push   %eax
+80102210:	ff 33                	push   (%ebx)
+80102212:	e8 b9 e6 ff ff       	call   801008d0 <bread>
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102217:	83 c4 0c             	add    $0xc,%esp
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+8010221a:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+8010221c:	8b 43 04             	mov    0x4(%ebx),%eax
+8010221f:	83 e0 07             	and    $0x7,%eax
+80102222:	c1 e0 06             	shl    $0x6,%eax
+80102225:	03 46 64             	add    0x64(%esi),%eax
+    ip->type = dip->type;
+80102228:	0f b7 10             	movzwl (%eax),%edx
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+8010222b:	83 c0 0c             	add    $0xc,%eax
+    ip->type = dip->type;
+8010222e:	66 89 53 5c          	mov    %dx,0x5c(%ebx)
+    ip->major = dip->major;
+80102232:	0f b7 50 f6          	movzwl -0xa(%eax),%edx
+80102236:	66 89 53 5e          	mov    %dx,0x5e(%ebx)
+    ip->minor = dip->minor;
+8010223a:	0f b7 50 f8          	movzwl -0x8(%eax),%edx
+8010223e:	66 89 53 60          	mov    %dx,0x60(%ebx)
+    ip->nlink = dip->nlink;
+80102242:	0f b7 50 fa          	movzwl -0x6(%eax),%edx
+80102246:	66 89 53 62          	mov    %dx,0x62(%ebx)
+    ip->size = dip->size;
+8010224a:	8b 50 fc             	mov    -0x4(%eax),%edx
+8010224d:	89 53 64             	mov    %edx,0x64(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102250:	6a 34                	push   $0x34
+80102252:	50                   	push   %eax
+80102253:	8d 43 68             	lea    0x68(%ebx),%eax
+80102256:	50                   	push   %eax
+80102257:	e8 74 50 00 00       	call   801072d0 <memmove>
+    brelse(bp);
+8010225c:	89 34 24             	mov    %esi,(%esp)
+8010225f:	e8 bc e7 ff ff       	call   80100a20 <brelse>
+    ip->flags |= I_VALID;
+80102264:	83 4b 4c 02          	orl    $0x2,0x4c(%ebx)
+    if(ip->type == 0)
+80102268:	83 c4 10             	add    $0x10,%esp
+8010226b:	66 83 7b 5c 00       	cmpw   $0x0,0x5c(%ebx)
+80102270:	0f 85 7a ff ff ff    	jne    801021f0 <ilock+0x30>
+      panic("ilock: no type");
+80102276:	83 ec 0c             	sub    $0xc,%esp
+80102279:	68 74 b5 10 80       	push   $0x8010b574
+8010227e:	e8 3d e9 ff ff       	call   80100bc0 <panic>
+    panic("ilock");
+80102283:	83 ec 0c             	sub    $0xc,%esp
+80102286:	68 6e b5 10 80       	push   $0x8010b56e
+8010228b:	e8 30 e9 ff ff       	call   80100bc0 <panic>
+
+80102290 <iunlock>:
+{
+80102290:	55                   	push   %ebp
+80102291:	89 e5                	mov    %esp,%ebp
+80102293:	56                   	push   %esi
+80102294:	53                   	push   %ebx
+80102295:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102298:	85 db                	test   %ebx,%ebx
+8010229a:	74 28                	je     801022c4 <iunlock+0x34>
+8010229c:	83 ec 0c             	sub    $0xc,%esp
+8010229f:	8d 73 0c             	lea    0xc(%ebx),%esi
+801022a2:	56                   	push   %esi
+801022a3:	e8 68 4a 00 00       	call   80106d10 <holdingsleep>
+801022a8:	83 c4 10             	add    $0x10,%esp
+801022ab:	85 c0                	test   %eax,%eax
+801022ad:	74 15                	je     801022c4 <iunlock+0x34>
+801022af:	8b 43 08             	mov    0x8(%ebx),%eax
+801022b2:	85 c0                	test   %eax,%eax
+801022b4:	7e 0e                	jle    801022c4 <iunlock+0x34>
+  releasesleep(&ip->lock);
+801022b6:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+801022b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801022bc:	5b                   	pop    %ebx
+801022bd:	5e                   	pop    %esi
+801022be:	5d                   	pop    %ebp
+  releasesleep(&ip->lock);
+801022bf:	e9 0c 4a 00 00       	jmp    80106cd0 <releasesleep>
+    panic("iunlock");
+801022c4:	83 ec 0c             	sub    $0xc,%esp
+801022c7:	68 83 b5 10 80       	push   $0x8010b583
+801022cc:	e8 ef e8 ff ff       	call   80100bc0 <panic>
+801022d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801022d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801022df:	90                   	nop
+
+801022e0 <iput>:
+{
+801022e0:	55                   	push   %ebp
+801022e1:	89 e5                	mov    %esp,%ebp
+801022e3:	57                   	push   %edi
+801022e4:	56                   	push   %esi
+801022e5:	53                   	push   %ebx
+801022e6:	83 ec 28             	sub    $0x28,%esp
+801022e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  acquire(&icache.lock);
+801022ec:	68 e0 aa 15 80       	push   $0x8015aae0
+801022f1:	e8 6a 4a 00 00       	call   80106d60 <acquire>
+  if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
+801022f6:	8b 46 08             	mov    0x8(%esi),%eax
+801022f9:	83 c4 10             	add    $0x10,%esp
+801022fc:	83 f8 01             	cmp    $0x1,%eax
+801022ff:	74 1f                	je     80102320 <iput+0x40>
+  ip->ref--;
+80102301:	83 e8 01             	sub    $0x1,%eax
+80102304:	89 46 08             	mov    %eax,0x8(%esi)
+  release(&icache.lock);
+80102307:	c7 45 08 e0 aa 15 80 	movl   $0x8015aae0,0x8(%ebp)
+}
+8010230e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102311:	5b                   	pop    %ebx
+80102312:	5e                   	pop    %esi
+80102313:	5f                   	pop    %edi
+80102314:	5d                   	pop    %ebp
+  release(&icache.lock);
+80102315:	e9 66 4c 00 00       	jmp    80106f80 <release>
+8010231a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
+80102320:	f6 46 4c 02          	testb  $0x2,0x4c(%esi)
+80102324:	74 db                	je     80102301 <iput+0x21>
+80102326:	66 83 7e 62 00       	cmpw   $0x0,0x62(%esi)
+8010232b:	75 d4                	jne    80102301 <iput+0x21>
+    release(&icache.lock);
+8010232d:	83 ec 0c             	sub    $0xc,%esp
+80102330:	68 e0 aa 15 80       	push   $0x8015aae0
+80102335:	e8 46 4c 00 00       	call   80106f80 <release>
+{
+  int i, j;
+  struct buf *bp;
+  uint *a;
+
+  if(ip->flags & I_PCACHE){
+8010233a:	83 c4 10             	add    $0x10,%esp
+8010233d:	f6 46 4c 04          	testb  $0x4,0x4c(%esi)
+80102341:	0f 85 af 00 00 00    	jne    801023f6 <iput+0x116>
+80102347:	8d 5e 68             	lea    0x68(%esi),%ebx
+8010234a:	8d be 98 00 00 00    	lea    0x98(%esi),%edi
+80102350:	eb 0d                	jmp    8010235f <iput+0x7f>
+80102352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pcinval(ip->dev, ip->inum);
+    ip->flags &= ~I_PCACHE;
+  }
+
+  for(i = 0; i < NDIRECT; i++){
+80102358:	83 c3 04             	add    $0x4,%ebx
+8010235b:	39 fb                	cmp    %edi,%ebx
+8010235d:	74 19                	je     80102378 <iput+0x98>
+    if(ip->addrs[i]){
+8010235f:	8b 13                	mov    (%ebx),%edx
+80102361:	85 d2                	test   %edx,%edx
+80102363:	74 f3                	je     80102358 <iput+0x78>
+      bfree(ip->dev, ip->addrs[i]);
+80102365:	8b 06                	mov    (%esi),%eax
+80102367:	e8 d4 fa ff ff       	call   80101e40 <bfree>
+      ip->addrs[i] = 0;
+8010236c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+80102372:	eb e4                	jmp    80102358 <iput+0x78>
+80102374:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  if(ip->addrs[NDIRECT]){
+80102378:	8b 86 98 00 00 00    	mov    0x98(%esi),%eax
+8010237e:	85 c0                	test   %eax,%eax
+80102380:	75 3c                	jne    801023be <iput+0xde>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+    ip->addrs[NDIRECT] = 0;
+  }
+
+  ip->size = 0;
+  iupdate(ip);
+80102382:	83 ec 0c             	sub    $0xc,%esp
+  ip->size = 0;
+80102385:	c7 46 64 00 00 00 00 	movl   $0x0,0x64(%esi)
+  iupdate(ip);
+8010238c:	56                   	push   %esi
+8010238d:	e8 fe fc ff ff       	call   80102090 <iupdate>
+    ip->type = 0;
+80102392:	31 c0                	xor    %eax,%eax
+80102394:	66 89 46 5c          	mov    %ax,0x5c(%esi)
+    iupdate(ip);
+80102398:	89 34 24             	mov    %esi,(%esp)
+8010239b:	e8 f0 fc ff ff       	call   80102090 <iupdate>
+    acquire(&icache.lock);
+801023a0:	c7 04 24 e0 aa 15 80 	movl   $0x8015aae0,(%esp)
+801023a7:	e8 b4 49 00 00       	call   80106d60 <acquire>
+    ip->flags = 0;
+801023ac:	c7 46 4c 00 00 00 00 	movl   $0x0,0x4c(%esi)
+  ip->ref--;
+801023b3:	8b 46 08             	mov    0x8(%esi),%eax
+801023b6:	83 c4 10             	add    $0x10,%esp
+801023b9:	e9 43 ff ff ff       	jmp    80102301 <iput+0x21>
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+801023be:	83 ec 08             	sub    $0x8,%esp
+801023c1:	50                   	push   %eax
+801023c2:	ff 36                	push   (%esi)
+801023c4:	e8 07 e5 ff ff       	call   801008d0 <bread>
+801023c9:	83 c4 10             	add    $0x10,%esp
+801023cc:	8b 58 64             	mov    0x64(%eax),%ebx
+801023cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(j = 0; j < NINDIRECT; j++){
+801023d2:	8d bb 00 02 00 00    	lea    0x200(%ebx),%edi
+801023d8:	eb 0d                	jmp    801023e7 <iput+0x107>
+801023da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801023e0:	83 c3 04             	add    $0x4,%ebx
+801023e3:	39 df                	cmp    %ebx,%edi
+801023e5:	74 28                	je     8010240f <iput+0x12f>
+      if(a[j])
+801023e7:	8b 13                	mov    (%ebx),%edx
+801023e9:	85 d2                	test   %edx,%edx
+801023eb:	74 f3                	je     801023e0 <iput+0x100>
+        bfree(ip->dev, a[j]);
+801023ed:	8b 06                	mov    (%esi),%eax
+801023ef:	e8 4c fa ff ff       	call   80101e40 <bfree>
+801023f4:	eb ea                	jmp    801023e0 <iput+0x100>
+    pcinval(ip->dev, ip->inum);
+801023f6:	83 ec 08             	sub    $0x8,%esp
+801023f9:	ff 76 04             	push   0x4(%esi)
+801023fc:	ff 36                	push   (%esi)
+801023fe:	e8 8d 2d 00 00       	call   80105190 <pcinval>
+    ip->flags &= ~I_PCACHE;
+80102403:	83 66 4c fb          	andl   $0xfffffffb,0x4c(%esi)
+80102407:	83 c4 10             	add    $0x10,%esp
+8010240a:	e9 38 ff ff ff       	jmp    80102347 <iput+0x67>
+    brelse(bp);
+8010240f:	83 ec 0c             	sub    $0xc,%esp
+80102412:	ff 75 e4             	push   -0x1c(%ebp)
+80102415:	e8 06 e6 ff ff       	call   80100a20 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+8010241a:	8b 96 98 00 00 00    	mov    0x98(%esi),%edx
+80102420:	8b 06                	mov    (%esi),%eax
+80102422:	e8 19 fa ff ff       	call   80101e40 <bfree>
+    ip->addrs[NDIRECT] = 0;
+80102427:	83 c4 10             	add    $0x10,%esp
+8010242a:	c7 86 98 00 00 00 00 	movl   $0x0,0x98(%esi)
+80102431:	00 00 00 
+80102434:	e9 49 ff ff ff       	jmp    80102382 <iput+0xa2>
+80102439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102440 <iunlockput>:
+{
+80102440:	55                   	push   %ebp
+80102441:	89 e5                	mov    %esp,%ebp
+80102443:	56                   	push   %esi
+80102444:	53                   	push   %ebx
+80102445:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102448:	85 db                	test   %ebx,%ebx
+8010244a:	74 34                	je     80102480 <iunlockput+0x40>
+8010244c:	83 ec 0c             	sub    $0xc,%esp
+8010244f:	8d 73 0c             	lea    0xc(%ebx),%esi
+80102452:	56                   	push   %esi
+80102453:	e8 b8 48 00 00       	call   80106d10 <holdingsleep>
+80102458:	83 c4 10             	add    $0x10,%esp
+8010245b:	85 c0                	test   %eax,%eax
+8010245d:	74 21                	je     80102480 <iunlockput+0x40>
+8010245f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102462:	85 c0                	test   %eax,%eax
+80102464:	7e 1a                	jle    80102480 <iunlockput+0x40>
+  releasesleep(&ip->lock);
+80102466:	83 ec 0c             	sub    $0xc,%esp
+80102469:	56                   	push   %esi
+8010246a:	e8 61 48 00 00       	call   80106cd0 <releasesleep>
+  iput(ip);
+8010246f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80102472:	83 c4 10             	add    $0x10,%esp
+}
+80102475:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102478:	5b                   	pop    %ebx
+80102479:	5e                   	pop    %esi
+8010247a:	5d                   	pop    %ebp
+  iput(ip);
+8010247b:	e9 60 fe ff ff       	jmp    801022e0 <iput>
+    panic("iunlock");
+80102480:	83 ec 0c             	sub    $0xc,%esp
+80102483:	68 83 b5 10 80       	push   $0x8010b583
+80102488:	e8 33 e7 ff ff       	call   80100bc0 <panic>
+8010248d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102490 <stati>:
+}
+
+// Copy stat information from inode.
+void
+stati(struct inode *ip, struct stat *st)
+{
+80102490:	55                   	push   %ebp
+80102491:	89 e5                	mov    %esp,%ebp
+80102493:	8b 55 08             	mov    0x8(%ebp),%edx
+80102496:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80102499:	8b 0a                	mov    (%edx),%ecx
+8010249b:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+8010249e:	8b 4a 04             	mov    0x4(%edx),%ecx
+801024a1:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+801024a4:	0f b7 4a 5c          	movzwl 0x5c(%edx),%ecx
+801024a8:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+801024ab:	0f b7 4a 62          	movzwl 0x62(%edx),%ecx
+801024af:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+801024b3:	8b 52 64             	mov    0x64(%edx),%edx
+801024b6:	89 50 10             	mov    %edx,0x10(%eax)
+}
+801024b9:	5d                   	pop    %ebp
+801024ba:	c3                   	ret
+801024bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801024bf:	90                   	nop
+
+801024c0 <setreadahead>:
+static int rawindow = RAWINDOW;
+
+// Set the read-ahead window, returning the old one.
+int
+setreadahead(int n)
+{
+801024c0:	55                   	push   %ebp
+  int old;
+
+  old = rawindow;
+801024c1:	8b 15 00 c0 10 80    	mov    0x8010c000,%edx
+{
+801024c7:	89 e5                	mov    %esp,%ebp
+801024c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(n >= 0)
+801024cc:	85 c0                	test   %eax,%eax
+801024ce:	78 05                	js     801024d5 <setreadahead+0x15>
+    rawindow = n;
+801024d0:	a3 00 c0 10 80       	mov    %eax,0x8010c000
+  return old;
+}
+801024d5:	89 d0                	mov    %edx,%eax
+801024d7:	5d                   	pop    %ebp
+801024d8:	c3                   	ret
+801024d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801024e0 <readi>:
+//PAGEBREAK!
+// Read data from inode.
+// Caller must hold ip->lock.
+int
+readi(struct inode *ip, char *dst, uint off, uint n)
+{
+801024e0:	55                   	push   %ebp
+801024e1:	89 e5                	mov    %esp,%ebp
+801024e3:	57                   	push   %edi
+801024e4:	56                   	push   %esi
+801024e5:	53                   	push   %ebx
+801024e6:	83 ec 2c             	sub    $0x2c,%esp
+801024e9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801024ec:	8b 45 08             	mov    0x8(%ebp),%eax
+801024ef:	8b 75 10             	mov    0x10(%ebp),%esi
+801024f2:	89 7d e0             	mov    %edi,-0x20(%ebp)
+801024f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  uint tot, m, bn;
+  int seq;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+801024f8:	66 83 78 5c 03       	cmpw   $0x3,0x5c(%eax)
+{
+801024fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80102500:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  if(ip->type == T_DEV){
+80102503:	0f 84 ef 00 00 00    	je     801025f8 <readi+0x118>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+      return -1;
+    return devsw[ip->major].read(ip, dst, off, n);
+  }
+
+  if(off > ip->size || off + n < off)
+80102509:	8b 55 d8             	mov    -0x28(%ebp),%edx
+8010250c:	8b 42 64             	mov    0x64(%edx),%eax
+8010250f:	39 f0                	cmp    %esi,%eax
+80102511:	0f 82 7a 01 00 00    	jb     80102691 <readi+0x1b1>
+80102517:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010251a:	31 d2                	xor    %edx,%edx
+8010251c:	01 f1                	add    %esi,%ecx
+8010251e:	0f 92 c2             	setb   %dl
+80102521:	89 d7                	mov    %edx,%edi
+80102523:	0f 82 68 01 00 00    	jb     80102691 <readi+0x1b1>
+    n = ip->size - off;
+
+  // A read that starts where the last one stopped, or inside
+  // the block it stopped in, is sequential.
+  bn = off/BSIZE;
+  seq = bn == ip->ranext || bn + 1 == ip->ranext;
+80102529:	8b 55 d8             	mov    -0x28(%ebp),%edx
+    n = ip->size - off;
+8010252c:	89 c3                	mov    %eax,%ebx
+8010252e:	29 f3                	sub    %esi,%ebx
+80102530:	39 c8                	cmp    %ecx,%eax
+  bn = off/BSIZE;
+80102532:	89 f0                	mov    %esi,%eax
+    n = ip->size - off;
+80102534:	0f 43 5d e4          	cmovae -0x1c(%ebp),%ebx
+  seq = bn == ip->ranext || bn + 1 == ip->ranext;
+80102538:	8b 4a 50             	mov    0x50(%edx),%ecx
+  bn = off/BSIZE;
+8010253b:	c1 e8 09             	shr    $0x9,%eax
+    n = ip->size - off;
+8010253e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  seq = bn == ip->ranext || bn + 1 == ip->ranext;
+80102541:	bb 01 00 00 00       	mov    $0x1,%ebx
+80102546:	39 c8                	cmp    %ecx,%eax
+80102548:	74 10                	je     8010255a <readi+0x7a>
+8010254a:	83 c0 01             	add    $0x1,%eax
+8010254d:	39 c1                	cmp    %eax,%ecx
+8010254f:	74 09                	je     8010255a <readi+0x7a>
+  if(!seq)
+    ip->raend = 0;
+80102551:	c7 42 54 00 00 00 00 	movl   $0x0,0x54(%edx)
+  seq = bn == ip->ranext || bn + 1 == ip->ranext;
+80102558:	31 db                	xor    %ebx,%ebx
+
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+8010255a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010255d:	85 c0                	test   %eax,%eax
+8010255f:	0f 84 84 00 00 00    	je     801025e9 <readi+0x109>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102565:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+80102568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010256f:	90                   	nop
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102570:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+80102573:	89 f2                	mov    %esi,%edx
+80102575:	c1 ea 09             	shr    $0x9,%edx
+80102578:	89 d8                	mov    %ebx,%eax
+8010257a:	e8 f1 f7 ff ff       	call   80101d70 <bmap>
+8010257f:	83 ec 08             	sub    $0x8,%esp
+80102582:	50                   	push   %eax
+80102583:	ff 33                	push   (%ebx)
+80102585:	e8 46 e3 ff ff       	call   801008d0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+8010258a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010258d:	b9 00 02 00 00       	mov    $0x200,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102592:	89 c2                	mov    %eax,%edx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102594:	89 f0                	mov    %esi,%eax
+80102596:	25 ff 01 00 00       	and    $0x1ff,%eax
+8010259b:	29 fb                	sub    %edi,%ebx
+8010259d:	29 c1                	sub    %eax,%ecx
+8010259f:	39 d9                	cmp    %ebx,%ecx
+801025a1:	0f 46 d9             	cmovbe %ecx,%ebx
+    for (int j = 0; j < min(m, 10); j++) {
+      cprintf("%x ", bp->data[off%BSIZE+j]);
+    }
+    cprintf("\n");
+    */
+    memmove(dst, bp->data + off%BSIZE, m);
+801025a4:	83 c4 0c             	add    $0xc,%esp
+801025a7:	53                   	push   %ebx
+801025a8:	03 42 64             	add    0x64(%edx),%eax
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+801025ab:	01 df                	add    %ebx,%edi
+801025ad:	01 de                	add    %ebx,%esi
+    memmove(dst, bp->data + off%BSIZE, m);
+801025af:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801025b2:	50                   	push   %eax
+801025b3:	ff 75 e0             	push   -0x20(%ebp)
+801025b6:	e8 15 4d 00 00       	call   801072d0 <memmove>
+    brelse(bp);
+801025bb:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801025be:	89 14 24             	mov    %edx,(%esp)
+801025c1:	e8 5a e4 ff ff       	call   80100a20 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+801025c6:	01 5d e0             	add    %ebx,-0x20(%ebp)
+801025c9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801025cc:	83 c4 10             	add    $0x10,%esp
+801025cf:	39 df                	cmp    %ebx,%edi
+801025d1:	72 9d                	jb     80102570 <readi+0x90>
+  }
+  if(n > 0){
+    ip->ranext = (off + BSIZE - 1) / BSIZE;
+801025d3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801025d6:	81 c6 ff 01 00 00    	add    $0x1ff,%esi
+801025dc:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+801025df:	c1 ee 09             	shr    $0x9,%esi
+801025e2:	89 70 50             	mov    %esi,0x50(%eax)
+    if(seq)
+801025e5:	85 db                	test   %ebx,%ebx
+801025e7:	75 37                	jne    80102620 <readi+0x140>
+      readahead(ip, ip->ranext);
+  }
+  return n;
+801025e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+}
+801025ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801025ef:	5b                   	pop    %ebx
+801025f0:	5e                   	pop    %esi
+801025f1:	5f                   	pop    %edi
+801025f2:	5d                   	pop    %ebp
+801025f3:	c3                   	ret
+801025f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+801025f8:	0f bf 40 5e          	movswl 0x5e(%eax),%eax
+801025fc:	66 83 f8 09          	cmp    $0x9,%ax
+80102600:	0f 87 8b 00 00 00    	ja     80102691 <readi+0x1b1>
+80102606:	8b 04 c5 80 aa 15 80 	mov    -0x7fea5580(,%eax,8),%eax
+8010260d:	85 c0                	test   %eax,%eax
+8010260f:	0f 84 7c 00 00 00    	je     80102691 <readi+0x1b1>
+}
+80102615:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102618:	5b                   	pop    %ebx
+80102619:	5e                   	pop    %esi
+8010261a:	5f                   	pop    %edi
+8010261b:	5d                   	pop    %ebp
+    return devsw[ip->major].read(ip, dst, off, n);
+8010261c:	ff e0                	jmp    *%eax
+8010261e:	66 90                	xchg   %ax,%ax
+  if(rawindow == 0 || ip->raend > bn + rawindow/2)
+80102620:	8b 1d 00 c0 10 80    	mov    0x8010c000,%ebx
+80102626:	85 db                	test   %ebx,%ebx
+80102628:	74 bf                	je     801025e9 <readi+0x109>
+8010262a:	8b 48 54             	mov    0x54(%eax),%ecx
+8010262d:	89 c7                	mov    %eax,%edi
+8010262f:	89 d8                	mov    %ebx,%eax
+80102631:	c1 e8 1f             	shr    $0x1f,%eax
+80102634:	01 d8                	add    %ebx,%eax
+80102636:	d1 f8                	sar    %eax
+80102638:	01 f0                	add    %esi,%eax
+8010263a:	39 c8                	cmp    %ecx,%eax
+8010263c:	72 ab                	jb     801025e9 <readi+0x109>
+  if(end > (ip->size + BSIZE - 1) / BSIZE)
+8010263e:	89 f8                	mov    %edi,%eax
+80102640:	8b 7f 64             	mov    0x64(%edi),%edi
+  end = bn + rawindow;
+80102643:	01 f3                	add    %esi,%ebx
+  if(end > (ip->size + BSIZE - 1) / BSIZE)
+80102645:	89 7d e0             	mov    %edi,-0x20(%ebp)
+80102648:	81 c7 ff 01 00 00    	add    $0x1ff,%edi
+8010264e:	c1 ef 09             	shr    $0x9,%edi
+80102651:	39 df                	cmp    %ebx,%edi
+80102653:	0f 47 fb             	cmova  %ebx,%edi
+  for(b = ip->raend > bn ? ip->raend : bn; b < end; b++)
+80102656:	39 ce                	cmp    %ecx,%esi
+80102658:	0f 42 f1             	cmovb  %ecx,%esi
+8010265b:	39 fe                	cmp    %edi,%esi
+8010265d:	73 27                	jae    80102686 <readi+0x1a6>
+8010265f:	89 c3                	mov    %eax,%ebx
+80102661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    breada(ip->dev, bmap(ip, b));
+80102668:	89 f2                	mov    %esi,%edx
+8010266a:	89 d8                	mov    %ebx,%eax
+  for(b = ip->raend > bn ? ip->raend : bn; b < end; b++)
+8010266c:	83 c6 01             	add    $0x1,%esi
+    breada(ip->dev, bmap(ip, b));
+8010266f:	e8 fc f6 ff ff       	call   80101d70 <bmap>
+80102674:	83 ec 08             	sub    $0x8,%esp
+80102677:	50                   	push   %eax
+80102678:	ff 33                	push   (%ebx)
+8010267a:	e8 01 e3 ff ff       	call   80100980 <breada>
+  for(b = ip->raend > bn ? ip->raend : bn; b < end; b++)
+8010267f:	83 c4 10             	add    $0x10,%esp
+80102682:	39 f7                	cmp    %esi,%edi
+80102684:	75 e2                	jne    80102668 <readi+0x188>
+  ip->raend = end;
+80102686:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80102689:	89 78 54             	mov    %edi,0x54(%eax)
+8010268c:	e9 58 ff ff ff       	jmp    801025e9 <readi+0x109>
+      return -1;
+80102691:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102696:	e9 51 ff ff ff       	jmp    801025ec <readi+0x10c>
+8010269b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010269f:	90                   	nop
+
+801026a0 <writei>:
+
+// PAGEBREAK!
+// Write data to inode.
+int
+writei(struct inode *ip, char *src, uint off, uint n)
+{
+801026a0:	55                   	push   %ebp
+801026a1:	89 e5                	mov    %esp,%ebp
+801026a3:	57                   	push   %edi
+801026a4:	56                   	push   %esi
+801026a5:	53                   	push   %ebx
+801026a6:	83 ec 1c             	sub    $0x1c,%esp
+801026a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+801026ac:	8b 55 08             	mov    0x8(%ebp),%edx
+801026af:	8b 7d 10             	mov    0x10(%ebp),%edi
+801026b2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801026b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+801026b8:	66 83 7a 5c 03       	cmpw   $0x3,0x5c(%edx)
+{
+801026bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(ip->type == T_DEV){
+801026c0:	0f 84 fa 00 00 00    	je     801027c0 <writei+0x120>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+      return -1;
+    return devsw[ip->major].write(ip, src, n);
+  }
+
+  if(ip->nexec > 0)
+801026c6:	8b 4a 58             	mov    0x58(%edx),%ecx
+801026c9:	85 c9                	test   %ecx,%ecx
+801026cb:	0f 8f 28 01 00 00    	jg     801027f9 <writei+0x159>
+    return -1;   // a process is running it
+  if(off > ip->size || off + n < off)
+801026d1:	39 7a 64             	cmp    %edi,0x64(%edx)
+801026d4:	0f 82 1f 01 00 00    	jb     801027f9 <writei+0x159>
+801026da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801026dd:	31 c9                	xor    %ecx,%ecx
+801026df:	01 f8                	add    %edi,%eax
+801026e1:	0f 92 c1             	setb   %cl
+    return -1;
+  if(off + n > MAXFILE*BSIZE)
+801026e4:	3d 00 18 01 00       	cmp    $0x11800,%eax
+801026e9:	0f 87 0a 01 00 00    	ja     801027f9 <writei+0x159>
+801026ef:	85 c9                	test   %ecx,%ecx
+801026f1:	0f 85 02 01 00 00    	jne    801027f9 <writei+0x159>
+    return -1;
+  if(ip->flags & I_PCACHE){
+801026f7:	f6 42 4c 04          	testb  $0x4,0x4c(%edx)
+801026fb:	0f 85 9f 00 00 00    	jne    801027a0 <writei+0x100>
+    pcinval(ip->dev, ip->inum);
+    ip->flags &= ~I_PCACHE;
+  }
+
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80102701:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102704:	85 c0                	test   %eax,%eax
+80102706:	0f 84 88 00 00 00    	je     80102794 <writei+0xf4>
+8010270c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102713:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80102716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010271d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102720:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80102723:	89 fa                	mov    %edi,%edx
+80102725:	c1 ea 09             	shr    $0x9,%edx
+80102728:	89 f0                	mov    %esi,%eax
+8010272a:	e8 41 f6 ff ff       	call   80101d70 <bmap>
+8010272f:	83 ec 08             	sub    $0x8,%esp
+80102732:	50                   	push   %eax
+80102733:	ff 36                	push   (%esi)
+80102735:	e8 96 e1 ff ff       	call   801008d0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+8010273a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010273d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102740:	b9 00 02 00 00       	mov    $0x200,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102745:	89 c6                	mov    %eax,%esi
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102747:	89 f8                	mov    %edi,%eax
+80102749:	25 ff 01 00 00       	and    $0x1ff,%eax
+8010274e:	29 d3                	sub    %edx,%ebx
+80102750:	29 c1                	sub    %eax,%ecx
+80102752:	39 d9                	cmp    %ebx,%ecx
+80102754:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+80102757:	83 c4 0c             	add    $0xc,%esp
+8010275a:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+8010275b:	01 df                	add    %ebx,%edi
+    memmove(bp->data + off%BSIZE, src, m);
+8010275d:	ff 75 dc             	push   -0x24(%ebp)
+80102760:	03 46 64             	add    0x64(%esi),%eax
+80102763:	50                   	push   %eax
+80102764:	e8 67 4b 00 00       	call   801072d0 <memmove>
+    log_write(bp);
+80102769:	89 34 24             	mov    %esi,(%esp)
+8010276c:	e8 6f 21 00 00       	call   801048e0 <log_write>
+    brelse(bp);
+80102771:	89 34 24             	mov    %esi,(%esp)
+80102774:	e8 a7 e2 ff ff       	call   80100a20 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80102779:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+8010277c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010277f:	83 c4 10             	add    $0x10,%esp
+80102782:	01 5d dc             	add    %ebx,-0x24(%ebp)
+80102785:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102788:	39 d8                	cmp    %ebx,%eax
+8010278a:	72 94                	jb     80102720 <writei+0x80>
+  }
+
+  if(n > 0 && off > ip->size){
+8010278c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+8010278f:	39 7a 64             	cmp    %edi,0x64(%edx)
+80102792:	72 54                	jb     801027e8 <writei+0x148>
+    ip->size = off;
+    iupdate(ip);
+  }
+  return n;
+80102794:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+80102797:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010279a:	5b                   	pop    %ebx
+8010279b:	5e                   	pop    %esi
+8010279c:	5f                   	pop    %edi
+8010279d:	5d                   	pop    %ebp
+8010279e:	c3                   	ret
+8010279f:	90                   	nop
+    pcinval(ip->dev, ip->inum);
+801027a0:	83 ec 08             	sub    $0x8,%esp
+801027a3:	ff 72 04             	push   0x4(%edx)
+801027a6:	ff 32                	push   (%edx)
+801027a8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801027ab:	e8 e0 29 00 00       	call   80105190 <pcinval>
+    ip->flags &= ~I_PCACHE;
+801027b0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801027b3:	83 c4 10             	add    $0x10,%esp
+801027b6:	83 62 4c fb          	andl   $0xfffffffb,0x4c(%edx)
+801027ba:	e9 42 ff ff ff       	jmp    80102701 <writei+0x61>
+801027bf:	90                   	nop
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+801027c0:	0f bf 42 5e          	movswl 0x5e(%edx),%eax
+801027c4:	66 83 f8 09          	cmp    $0x9,%ax
+801027c8:	77 2f                	ja     801027f9 <writei+0x159>
+801027ca:	8b 04 c5 84 aa 15 80 	mov    -0x7fea557c(,%eax,8),%eax
+801027d1:	85 c0                	test   %eax,%eax
+801027d3:	74 24                	je     801027f9 <writei+0x159>
+    return devsw[ip->major].write(ip, src, n);
+801027d5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801027d8:	89 7d 10             	mov    %edi,0x10(%ebp)
+}
+801027db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801027de:	5b                   	pop    %ebx
+801027df:	5e                   	pop    %esi
+801027e0:	5f                   	pop    %edi
+801027e1:	5d                   	pop    %ebp
+    return devsw[ip->major].write(ip, src, n);
+801027e2:	ff e0                	jmp    *%eax
+801027e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iupdate(ip);
+801027e8:	83 ec 0c             	sub    $0xc,%esp
+    ip->size = off;
+801027eb:	89 7a 64             	mov    %edi,0x64(%edx)
+    iupdate(ip);
+801027ee:	52                   	push   %edx
+801027ef:	e8 9c f8 ff ff       	call   80102090 <iupdate>
+801027f4:	83 c4 10             	add    $0x10,%esp
+801027f7:	eb 9b                	jmp    80102794 <writei+0xf4>
+      return -1;
+801027f9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801027fe:	eb 97                	jmp    80102797 <writei+0xf7>
+
+80102800 <namecmp>:
+//PAGEBREAK!
+// Directories
+
+int
+namecmp(const char *s, const char *t)
+{
+80102800:	55                   	push   %ebp
+80102801:	89 e5                	mov    %esp,%ebp
+80102803:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+80102806:	6a 0e                	push   $0xe
+80102808:	ff 75 0c             	push   0xc(%ebp)
+8010280b:	ff 75 08             	push   0x8(%ebp)
+8010280e:	e8 2d 4b 00 00       	call   80107340 <strncmp>
+}
+80102813:	c9                   	leave
+80102814:	c3                   	ret
+80102815:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010281c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102820 <dirlookup>:
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+80102820:	55                   	push   %ebp
+80102821:	89 e5                	mov    %esp,%ebp
+80102823:	57                   	push   %edi
+80102824:	56                   	push   %esi
+80102825:	53                   	push   %ebx
+80102826:	83 ec 1c             	sub    $0x1c,%esp
+80102829:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint off, inum;
+  struct dirent de;
+
+  if(dp->type != T_DIR)
+8010282c:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+80102831:	0f 85 85 00 00 00    	jne    801028bc <dirlookup+0x9c>
+    panic("dirlookup not DIR");
+
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80102837:	8b 53 64             	mov    0x64(%ebx),%edx
+8010283a:	31 ff                	xor    %edi,%edi
+8010283c:	8d 75 d8             	lea    -0x28(%ebp),%esi
+8010283f:	85 d2                	test   %edx,%edx
+80102841:	74 3e                	je     80102881 <dirlookup+0x61>
+80102843:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102847:	90                   	nop
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80102848:	6a 10                	push   $0x10
+8010284a:	57                   	push   %edi
+8010284b:	56                   	push   %esi
+8010284c:	53                   	push   %ebx
+8010284d:	e8 8e fc ff ff       	call   801024e0 <readi>
+80102852:	83 c4 10             	add    $0x10,%esp
+80102855:	83 f8 10             	cmp    $0x10,%eax
+80102858:	75 55                	jne    801028af <dirlookup+0x8f>
+      panic("dirlink read");
+    if(de.inum == 0)
+8010285a:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010285f:	74 18                	je     80102879 <dirlookup+0x59>
+  return strncmp(s, t, DIRSIZ);
+80102861:	83 ec 04             	sub    $0x4,%esp
+80102864:	8d 45 da             	lea    -0x26(%ebp),%eax
+80102867:	6a 0e                	push   $0xe
+80102869:	50                   	push   %eax
+8010286a:	ff 75 0c             	push   0xc(%ebp)
+8010286d:	e8 ce 4a 00 00       	call   80107340 <strncmp>
+      continue;
+    if(namecmp(name, de.name) == 0){
+80102872:	83 c4 10             	add    $0x10,%esp
+80102875:	85 c0                	test   %eax,%eax
+80102877:	74 17                	je     80102890 <dirlookup+0x70>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80102879:	83 c7 10             	add    $0x10,%edi
+8010287c:	3b 7b 64             	cmp    0x64(%ebx),%edi
+8010287f:	72 c7                	jb     80102848 <dirlookup+0x28>
+      return iget(dp->dev, inum);
+    }
+  }
+
+  return 0;
+}
+80102881:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80102884:	31 c0                	xor    %eax,%eax
+}
+80102886:	5b                   	pop    %ebx
+80102887:	5e                   	pop    %esi
+80102888:	5f                   	pop    %edi
+80102889:	5d                   	pop    %ebp
+8010288a:	c3                   	ret
+8010288b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010288f:	90                   	nop
+      if(poff)
+80102890:	8b 45 10             	mov    0x10(%ebp),%eax
+80102893:	85 c0                	test   %eax,%eax
+80102895:	74 05                	je     8010289c <dirlookup+0x7c>
+        *poff = off;
+80102897:	8b 45 10             	mov    0x10(%ebp),%eax
+8010289a:	89 38                	mov    %edi,(%eax)
+      inum = de.inum;
+8010289c:	0f b7 55 d8          	movzwl -0x28(%ebp),%edx
+      return iget(dp->dev, inum);
+801028a0:	8b 03                	mov    (%ebx),%eax
+801028a2:	e8 89 f3 ff ff       	call   80101c30 <iget>
+}
+801028a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801028aa:	5b                   	pop    %ebx
+801028ab:	5e                   	pop    %esi
+801028ac:	5f                   	pop    %edi
+801028ad:	5d                   	pop    %ebp
+801028ae:	c3                   	ret
+      panic("dirlink read");
+801028af:	83 ec 0c             	sub    $0xc,%esp
+801028b2:	68 9d b5 10 80       	push   $0x8010b59d
+801028b7:	e8 04 e3 ff ff       	call   80100bc0 <panic>
+    panic("dirlookup not DIR");
+801028bc:	83 ec 0c             	sub    $0xc,%esp
+801028bf:	68 8b b5 10 80       	push   $0x8010b58b
+801028c4:	e8 f7 e2 ff ff       	call   80100bc0 <panic>
+801028c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801028d0 <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+801028d0:	55                   	push   %ebp
+801028d1:	89 e5                	mov    %esp,%ebp
+801028d3:	57                   	push   %edi
+801028d4:	56                   	push   %esi
+801028d5:	53                   	push   %ebx
+801028d6:	89 c3                	mov    %eax,%ebx
+801028d8:	83 ec 1c             	sub    $0x1c,%esp
+  struct inode *ip, *next;
+
+  if(*path == '/')
+801028db:	80 38 2f             	cmpb   $0x2f,(%eax)
+{
+801028de:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801028e1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(*path == '/')
+801028e4:	0f 84 74 01 00 00    	je     80102a5e <namex+0x18e>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(proc->cwd);
+801028ea:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  acquire(&icache.lock);
+801028f0:	83 ec 0c             	sub    $0xc,%esp
+    ip = idup(proc->cwd);
+801028f3:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+  acquire(&icache.lock);
+801028f9:	68 e0 aa 15 80       	push   $0x8015aae0
+801028fe:	e8 5d 44 00 00       	call   80106d60 <acquire>
+  ip->ref++;
+80102903:	83 46 08 01          	addl   $0x1,0x8(%esi)
+  release(&icache.lock);
+80102907:	c7 04 24 e0 aa 15 80 	movl   $0x8015aae0,(%esp)
+8010290e:	e8 6d 46 00 00       	call   80106f80 <release>
+80102913:	83 c4 10             	add    $0x10,%esp
+80102916:	eb 0b                	jmp    80102923 <namex+0x53>
+80102918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010291f:	90                   	nop
+    path++;
+80102920:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80102923:	0f b6 03             	movzbl (%ebx),%eax
+80102926:	3c 2f                	cmp    $0x2f,%al
+80102928:	74 f6                	je     80102920 <namex+0x50>
+  if(*path == 0)
+8010292a:	84 c0                	test   %al,%al
+8010292c:	0f 84 0e 01 00 00    	je     80102a40 <namex+0x170>
+  while(*path != '/' && *path != 0)
+80102932:	0f b6 03             	movzbl (%ebx),%eax
+80102935:	84 c0                	test   %al,%al
+80102937:	0f 84 18 01 00 00    	je     80102a55 <namex+0x185>
+8010293d:	89 df                	mov    %ebx,%edi
+8010293f:	3c 2f                	cmp    $0x2f,%al
+80102941:	0f 84 0e 01 00 00    	je     80102a55 <namex+0x185>
+80102947:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010294e:	66 90                	xchg   %ax,%ax
+80102950:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+    path++;
+80102954:	83 c7 01             	add    $0x1,%edi
+  while(*path != '/' && *path != 0)
+80102957:	3c 2f                	cmp    $0x2f,%al
+80102959:	74 04                	je     8010295f <namex+0x8f>
+8010295b:	84 c0                	test   %al,%al
+8010295d:	75 f1                	jne    80102950 <namex+0x80>
+  len = path - s;
+8010295f:	89 f8                	mov    %edi,%eax
+80102961:	29 d8                	sub    %ebx,%eax
+  if(len >= DIRSIZ)
+80102963:	83 f8 0d             	cmp    $0xd,%eax
+80102966:	0f 8e ac 00 00 00    	jle    80102a18 <namex+0x148>
+    memmove(name, s, DIRSIZ);
+8010296c:	83 ec 04             	sub    $0x4,%esp
+8010296f:	6a 0e                	push   $0xe
+80102971:	53                   	push   %ebx
+    path++;
+80102972:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, DIRSIZ);
+80102974:	ff 75 e4             	push   -0x1c(%ebp)
+80102977:	e8 54 49 00 00       	call   801072d0 <memmove>
+8010297c:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+8010297f:	80 3f 2f             	cmpb   $0x2f,(%edi)
+80102982:	75 0c                	jne    80102990 <namex+0xc0>
+80102984:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+80102988:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+8010298b:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+8010298e:	74 f8                	je     80102988 <namex+0xb8>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+80102990:	83 ec 0c             	sub    $0xc,%esp
+80102993:	56                   	push   %esi
+80102994:	e8 27 f8 ff ff       	call   801021c0 <ilock>
+    if(ip->type != T_DIR){
+80102999:	83 c4 10             	add    $0x10,%esp
+8010299c:	66 83 7e 5c 01       	cmpw   $0x1,0x5c(%esi)
+801029a1:	0f 85 cd 00 00 00    	jne    80102a74 <namex+0x1a4>
+      iunlockput(ip);
+      return 0;
+    }
+    if(nameiparent && *path == '\0'){
+801029a7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801029aa:	85 c0                	test   %eax,%eax
+801029ac:	74 09                	je     801029b7 <namex+0xe7>
+801029ae:	80 3b 00             	cmpb   $0x0,(%ebx)
+801029b1:	0f 84 34 01 00 00    	je     80102aeb <namex+0x21b>
+      // Stop one level early.
+      iunlock(ip);
+      return ip;
+    }
+    if((next = dirlookup(ip, name, 0)) == 0){
+801029b7:	83 ec 04             	sub    $0x4,%esp
+801029ba:	6a 00                	push   $0x0
+801029bc:	ff 75 e4             	push   -0x1c(%ebp)
+801029bf:	56                   	push   %esi
+801029c0:	e8 5b fe ff ff       	call   80102820 <dirlookup>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801029c5:	8d 56 0c             	lea    0xc(%esi),%edx
+    if((next = dirlookup(ip, name, 0)) == 0){
+801029c8:	83 c4 10             	add    $0x10,%esp
+801029cb:	89 c7                	mov    %eax,%edi
+801029cd:	85 c0                	test   %eax,%eax
+801029cf:	0f 84 e1 00 00 00    	je     80102ab6 <namex+0x1e6>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801029d5:	83 ec 0c             	sub    $0xc,%esp
+801029d8:	52                   	push   %edx
+801029d9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+801029dc:	e8 2f 43 00 00       	call   80106d10 <holdingsleep>
+801029e1:	83 c4 10             	add    $0x10,%esp
+801029e4:	85 c0                	test   %eax,%eax
+801029e6:	0f 84 3f 01 00 00    	je     80102b2b <namex+0x25b>
+801029ec:	8b 56 08             	mov    0x8(%esi),%edx
+801029ef:	85 d2                	test   %edx,%edx
+801029f1:	0f 8e 34 01 00 00    	jle    80102b2b <namex+0x25b>
+  releasesleep(&ip->lock);
+801029f7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801029fa:	83 ec 0c             	sub    $0xc,%esp
+801029fd:	52                   	push   %edx
+801029fe:	e8 cd 42 00 00       	call   80106cd0 <releasesleep>
+  iput(ip);
+80102a03:	89 34 24             	mov    %esi,(%esp)
+80102a06:	89 fe                	mov    %edi,%esi
+80102a08:	e8 d3 f8 ff ff       	call   801022e0 <iput>
+80102a0d:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80102a10:	e9 0e ff ff ff       	jmp    80102923 <namex+0x53>
+80102a15:	8d 76 00             	lea    0x0(%esi),%esi
+    name[len] = 0;
+80102a18:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102a1b:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+    memmove(name, s, len);
+80102a1e:	83 ec 04             	sub    $0x4,%esp
+80102a21:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80102a24:	50                   	push   %eax
+80102a25:	53                   	push   %ebx
+    name[len] = 0;
+80102a26:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, len);
+80102a28:	ff 75 e4             	push   -0x1c(%ebp)
+80102a2b:	e8 a0 48 00 00       	call   801072d0 <memmove>
+    name[len] = 0;
+80102a30:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80102a33:	83 c4 10             	add    $0x10,%esp
+80102a36:	c6 02 00             	movb   $0x0,(%edx)
+80102a39:	e9 41 ff ff ff       	jmp    8010297f <namex+0xaf>
+80102a3e:	66 90                	xchg   %ax,%ax
+      return 0;
+    }
+    iunlockput(ip);
+    ip = next;
+  }
+  if(nameiparent){
+80102a40:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102a43:	85 c0                	test   %eax,%eax
+80102a45:	0f 85 d0 00 00 00    	jne    80102b1b <namex+0x24b>
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+80102a4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102a4e:	89 f0                	mov    %esi,%eax
+80102a50:	5b                   	pop    %ebx
+80102a51:	5e                   	pop    %esi
+80102a52:	5f                   	pop    %edi
+80102a53:	5d                   	pop    %ebp
+80102a54:	c3                   	ret
+  while(*path != '/' && *path != 0)
+80102a55:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102a58:	89 df                	mov    %ebx,%edi
+80102a5a:	31 c0                	xor    %eax,%eax
+80102a5c:	eb c0                	jmp    80102a1e <namex+0x14e>
+    ip = iget(ROOTDEV, ROOTINO);
+80102a5e:	ba 01 00 00 00       	mov    $0x1,%edx
+80102a63:	b8 01 00 00 00       	mov    $0x1,%eax
+80102a68:	e8 c3 f1 ff ff       	call   80101c30 <iget>
+80102a6d:	89 c6                	mov    %eax,%esi
+80102a6f:	e9 af fe ff ff       	jmp    80102923 <namex+0x53>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102a74:	83 ec 0c             	sub    $0xc,%esp
+80102a77:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80102a7a:	53                   	push   %ebx
+80102a7b:	e8 90 42 00 00       	call   80106d10 <holdingsleep>
+80102a80:	83 c4 10             	add    $0x10,%esp
+80102a83:	85 c0                	test   %eax,%eax
+80102a85:	0f 84 a0 00 00 00    	je     80102b2b <namex+0x25b>
+80102a8b:	8b 46 08             	mov    0x8(%esi),%eax
+80102a8e:	85 c0                	test   %eax,%eax
+80102a90:	0f 8e 95 00 00 00    	jle    80102b2b <namex+0x25b>
+  releasesleep(&ip->lock);
+80102a96:	83 ec 0c             	sub    $0xc,%esp
+80102a99:	53                   	push   %ebx
+80102a9a:	e8 31 42 00 00       	call   80106cd0 <releasesleep>
+  iput(ip);
+80102a9f:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+80102aa2:	31 f6                	xor    %esi,%esi
+  iput(ip);
+80102aa4:	e8 37 f8 ff ff       	call   801022e0 <iput>
+      return 0;
+80102aa9:	83 c4 10             	add    $0x10,%esp
+}
+80102aac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102aaf:	89 f0                	mov    %esi,%eax
+80102ab1:	5b                   	pop    %ebx
+80102ab2:	5e                   	pop    %esi
+80102ab3:	5f                   	pop    %edi
+80102ab4:	5d                   	pop    %ebp
+80102ab5:	c3                   	ret
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102ab6:	83 ec 0c             	sub    $0xc,%esp
+80102ab9:	52                   	push   %edx
+80102aba:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80102abd:	e8 4e 42 00 00       	call   80106d10 <holdingsleep>
+80102ac2:	83 c4 10             	add    $0x10,%esp
+80102ac5:	85 c0                	test   %eax,%eax
+80102ac7:	74 62                	je     80102b2b <namex+0x25b>
+80102ac9:	8b 4e 08             	mov    0x8(%esi),%ecx
+80102acc:	85 c9                	test   %ecx,%ecx
+80102ace:	7e 5b                	jle    80102b2b <namex+0x25b>
+  releasesleep(&ip->lock);
+80102ad0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102ad3:	83 ec 0c             	sub    $0xc,%esp
+80102ad6:	52                   	push   %edx
+80102ad7:	e8 f4 41 00 00       	call   80106cd0 <releasesleep>
+  iput(ip);
+80102adc:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+80102adf:	31 f6                	xor    %esi,%esi
+  iput(ip);
+80102ae1:	e8 fa f7 ff ff       	call   801022e0 <iput>
+      return 0;
+80102ae6:	83 c4 10             	add    $0x10,%esp
+80102ae9:	eb c1                	jmp    80102aac <namex+0x1dc>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102aeb:	83 ec 0c             	sub    $0xc,%esp
+80102aee:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80102af1:	53                   	push   %ebx
+80102af2:	e8 19 42 00 00       	call   80106d10 <holdingsleep>
+80102af7:	83 c4 10             	add    $0x10,%esp
+80102afa:	85 c0                	test   %eax,%eax
+80102afc:	74 2d                	je     80102b2b <namex+0x25b>
+80102afe:	8b 7e 08             	mov    0x8(%esi),%edi
+80102b01:	85 ff                	test   %edi,%edi
+80102b03:	7e 26                	jle    80102b2b <namex+0x25b>
+  releasesleep(&ip->lock);
+80102b05:	83 ec 0c             	sub    $0xc,%esp
+80102b08:	53                   	push   %ebx
+80102b09:	e8 c2 41 00 00       	call   80106cd0 <releasesleep>
+}
+80102b0e:	83 c4 10             	add    $0x10,%esp
+}
+80102b11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102b14:	89 f0                	mov    %esi,%eax
+80102b16:	5b                   	pop    %ebx
+80102b17:	5e                   	pop    %esi
+80102b18:	5f                   	pop    %edi
+80102b19:	5d                   	pop    %ebp
+80102b1a:	c3                   	ret
+    iput(ip);
+80102b1b:	83 ec 0c             	sub    $0xc,%esp
+80102b1e:	56                   	push   %esi
+      return 0;
+80102b1f:	31 f6                	xor    %esi,%esi
+    iput(ip);
+80102b21:	e8 ba f7 ff ff       	call   801022e0 <iput>
+    return 0;
+80102b26:	83 c4 10             	add    $0x10,%esp
+80102b29:	eb 81                	jmp    80102aac <namex+0x1dc>
+    panic("iunlock");
+80102b2b:	83 ec 0c             	sub    $0xc,%esp
+80102b2e:	68 83 b5 10 80       	push   $0x8010b583
+80102b33:	e8 88 e0 ff ff       	call   80100bc0 <panic>
+80102b38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102b3f:	90                   	nop
+
+80102b40 <dirlink>:
+{
+80102b40:	55                   	push   %ebp
+80102b41:	89 e5                	mov    %esp,%ebp
+80102b43:	57                   	push   %edi
+80102b44:	56                   	push   %esi
+80102b45:	53                   	push   %ebx
+80102b46:	83 ec 20             	sub    $0x20,%esp
+80102b49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80102b4c:	6a 00                	push   $0x0
+80102b4e:	ff 75 0c             	push   0xc(%ebp)
+80102b51:	53                   	push   %ebx
+80102b52:	e8 c9 fc ff ff       	call   80102820 <dirlookup>
+80102b57:	83 c4 10             	add    $0x10,%esp
+80102b5a:	85 c0                	test   %eax,%eax
+80102b5c:	75 67                	jne    80102bc5 <dirlink+0x85>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80102b5e:	8b 7b 64             	mov    0x64(%ebx),%edi
+80102b61:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80102b64:	85 ff                	test   %edi,%edi
+80102b66:	74 29                	je     80102b91 <dirlink+0x51>
+80102b68:	31 ff                	xor    %edi,%edi
+80102b6a:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80102b6d:	eb 09                	jmp    80102b78 <dirlink+0x38>
+80102b6f:	90                   	nop
+80102b70:	83 c7 10             	add    $0x10,%edi
+80102b73:	3b 7b 64             	cmp    0x64(%ebx),%edi
+80102b76:	73 19                	jae    80102b91 <dirlink+0x51>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80102b78:	6a 10                	push   $0x10
+80102b7a:	57                   	push   %edi
+80102b7b:	56                   	push   %esi
+80102b7c:	53                   	push   %ebx
+80102b7d:	e8 5e f9 ff ff       	call   801024e0 <readi>
+80102b82:	83 c4 10             	add    $0x10,%esp
+80102b85:	83 f8 10             	cmp    $0x10,%eax
+80102b88:	75 4e                	jne    80102bd8 <dirlink+0x98>
+    if(de.inum == 0)
+80102b8a:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80102b8f:	75 df                	jne    80102b70 <dirlink+0x30>
+  strncpy(de.name, name, DIRSIZ);
+80102b91:	83 ec 04             	sub    $0x4,%esp
+80102b94:	8d 45 da             	lea    -0x26(%ebp),%eax
+80102b97:	6a 0e                	push   $0xe
+80102b99:	ff 75 0c             	push   0xc(%ebp)
+80102b9c:	50                   	push   %eax
+80102b9d:	e8 ee 47 00 00       	call   80107390 <strncpy>
+  de.inum = inum;
+80102ba2:	8b 45 10             	mov    0x10(%ebp),%eax
+80102ba5:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80102ba9:	6a 10                	push   $0x10
+80102bab:	57                   	push   %edi
+80102bac:	56                   	push   %esi
+80102bad:	53                   	push   %ebx
+80102bae:	e8 ed fa ff ff       	call   801026a0 <writei>
+80102bb3:	83 c4 20             	add    $0x20,%esp
+80102bb6:	83 f8 10             	cmp    $0x10,%eax
+80102bb9:	75 2a                	jne    80102be5 <dirlink+0xa5>
+  return 0;
+80102bbb:	31 c0                	xor    %eax,%eax
+}
+80102bbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102bc0:	5b                   	pop    %ebx
+80102bc1:	5e                   	pop    %esi
+80102bc2:	5f                   	pop    %edi
+80102bc3:	5d                   	pop    %ebp
+80102bc4:	c3                   	ret
+    iput(ip);
+80102bc5:	83 ec 0c             	sub    $0xc,%esp
+80102bc8:	50                   	push   %eax
+80102bc9:	e8 12 f7 ff ff       	call   801022e0 <iput>
+    return -1;
+80102bce:	83 c4 10             	add    $0x10,%esp
+80102bd1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102bd6:	eb e5                	jmp    80102bbd <dirlink+0x7d>
+      panic("dirlink read");
+80102bd8:	83 ec 0c             	sub    $0xc,%esp
+80102bdb:	68 9d b5 10 80       	push   $0x8010b59d
+80102be0:	e8 db df ff ff       	call   80100bc0 <panic>
+    panic("dirlink");
+80102be5:	83 ec 0c             	sub    $0xc,%esp
+80102be8:	68 6e bc 10 80       	push   $0x8010bc6e
+80102bed:	e8 ce df ff ff       	call   80100bc0 <panic>
+80102bf2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102bf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102c00 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80102c00:	55                   	push   %ebp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80102c01:	31 d2                	xor    %edx,%edx
+{
+80102c03:	89 e5                	mov    %esp,%ebp
+80102c05:	83 ec 18             	sub    $0x18,%esp
+  return namex(path, 0, name);
+80102c08:	8b 45 08             	mov    0x8(%ebp),%eax
+80102c0b:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+80102c0e:	e8 bd fc ff ff       	call   801028d0 <namex>
+}
+80102c13:	c9                   	leave
+80102c14:	c3                   	ret
+80102c15:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102c20 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80102c20:	55                   	push   %ebp
+  return namex(path, 1, name);
+80102c21:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+80102c26:	89 e5                	mov    %esp,%ebp
+  return namex(path, 1, name);
+80102c28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80102c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+80102c2e:	5d                   	pop    %ebp
+  return namex(path, 1, name);
+80102c2f:	e9 9c fc ff ff       	jmp    801028d0 <namex>
+80102c34:	66 90                	xchg   %ax,%ax
+80102c36:	66 90                	xchg   %ax,%ax
+80102c38:	66 90                	xchg   %ax,%ax
+80102c3a:	66 90                	xchg   %ax,%ax
+80102c3c:	66 90                	xchg   %ax,%ax
+80102c3e:	66 90                	xchg   %ax,%ax
+
+80102c40 <ideinsert>:
+
+// Insert b into idepending in sector order.
+// Caller must hold idelock.
+static void
+ideinsert(struct buf *b)
+{
+80102c40:	55                   	push   %ebp
+80102c41:	89 e5                	mov    %esp,%ebp
+80102c43:	57                   	push   %edi
+80102c44:	56                   	push   %esi
+80102c45:	53                   	push   %ebx
+80102c46:	89 c3                	mov    %eax,%ebx
+  struct buf **pp;
+
+  if(!holdingsleep(&b->lock))
+80102c48:	83 c0 0c             	add    $0xc,%eax
+{
+80102c4b:	83 ec 18             	sub    $0x18,%esp
+  if(!holdingsleep(&b->lock))
+80102c4e:	50                   	push   %eax
+80102c4f:	e8 bc 40 00 00       	call   80106d10 <holdingsleep>
+80102c54:	83 c4 10             	add    $0x10,%esp
+80102c57:	85 c0                	test   %eax,%eax
+80102c59:	0f 84 8c 00 00 00    	je     80102ceb <ideinsert+0xab>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+80102c5f:	8b 03                	mov    (%ebx),%eax
+80102c61:	83 e0 06             	and    $0x6,%eax
+80102c64:	83 f8 02             	cmp    $0x2,%eax
+80102c67:	74 75                	je     80102cde <ideinsert+0x9e>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && !havedisk1)
+80102c69:	8b 4b 04             	mov    0x4(%ebx),%ecx
+80102c6c:	85 c9                	test   %ecx,%ecx
+80102c6e:	75 58                	jne    80102cc8 <ideinsert+0x88>
+    panic("iderw: ide disk 1 not present");
+
+  for(pp=&idepending; *pp && idebefore(*pp, b->dev, b->blockno); pp=&(*pp)->qnext)  //DOC:insert-queue
+80102c70:	a1 0c e1 15 80       	mov    0x8015e10c,%eax
+80102c75:	be 0c e1 15 80       	mov    $0x8015e10c,%esi
+80102c7a:	85 c0                	test   %eax,%eax
+80102c7c:	74 13                	je     80102c91 <ideinsert+0x51>
+80102c7e:	8b 7b 08             	mov    0x8(%ebx),%edi
+80102c81:	be 0c e1 15 80       	mov    $0x8015e10c,%esi
+  return b->dev < dev || (b->dev == dev && b->blockno < blockno);
+80102c86:	8b 50 04             	mov    0x4(%eax),%edx
+80102c89:	39 ca                	cmp    %ecx,%edx
+80102c8b:	72 2b                	jb     80102cb8 <ideinsert+0x78>
+80102c8d:	39 d1                	cmp    %edx,%ecx
+80102c8f:	74 1f                	je     80102cb0 <ideinsert+0x70>
+    ;
+  b->qnext = *pp;
+  *pp = b;
+  statinc(ST_IDERW);
+80102c91:	83 ec 0c             	sub    $0xc,%esp
+  b->qnext = *pp;
+80102c94:	89 43 5c             	mov    %eax,0x5c(%ebx)
+  *pp = b;
+80102c97:	89 1e                	mov    %ebx,(%esi)
+  statinc(ST_IDERW);
+80102c99:	6a 05                	push   $0x5
+80102c9b:	e8 60 45 00 00       	call   80107200 <statinc>
+#ifdef IODEADLINE
+  b->deadline = ticks + ((b->flags & B_DIRTY) ? IDEWRITEEXPIRE : IDEREADEXPIRE);
+#endif
+}
+80102ca0:	83 c4 10             	add    $0x10,%esp
+80102ca3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102ca6:	5b                   	pop    %ebx
+80102ca7:	5e                   	pop    %esi
+80102ca8:	5f                   	pop    %edi
+80102ca9:	5d                   	pop    %ebp
+80102caa:	c3                   	ret
+80102cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102caf:	90                   	nop
+  return b->dev < dev || (b->dev == dev && b->blockno < blockno);
+80102cb0:	39 78 08             	cmp    %edi,0x8(%eax)
+80102cb3:	73 dc                	jae    80102c91 <ideinsert+0x51>
+80102cb5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(pp=&idepending; *pp && idebefore(*pp, b->dev, b->blockno); pp=&(*pp)->qnext)  //DOC:insert-queue
+80102cb8:	8d 70 5c             	lea    0x5c(%eax),%esi
+80102cbb:	8b 40 5c             	mov    0x5c(%eax),%eax
+80102cbe:	85 c0                	test   %eax,%eax
+80102cc0:	75 c4                	jne    80102c86 <ideinsert+0x46>
+80102cc2:	eb cd                	jmp    80102c91 <ideinsert+0x51>
+80102cc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->dev != 0 && !havedisk1)
+80102cc8:	a1 00 d0 15 80       	mov    0x8015d000,%eax
+80102ccd:	85 c0                	test   %eax,%eax
+80102ccf:	75 9f                	jne    80102c70 <ideinsert+0x30>
+    panic("iderw: ide disk 1 not present");
+80102cd1:	83 ec 0c             	sub    $0xc,%esp
+80102cd4:	68 2a b6 10 80       	push   $0x8010b62a
+80102cd9:	e8 e2 de ff ff       	call   80100bc0 <panic>
+    panic("iderw: nothing to do");
+80102cde:	83 ec 0c             	sub    $0xc,%esp
+80102ce1:	68 15 b6 10 80       	push   $0x8010b615
+80102ce6:	e8 d5 de ff ff       	call   80100bc0 <panic>
+    panic("iderw: buf not locked");
+80102ceb:	83 ec 0c             	sub    $0xc,%esp
+80102cee:	68 ff b5 10 80       	push   $0x8010b5ff
+80102cf3:	e8 c8 de ff ff       	call   80100bc0 <panic>
+80102cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102cff:	90                   	nop
+
+80102d00 <idedispatch.part.0>:
+idedispatch(void)
+80102d00:	55                   	push   %ebp
+80102d01:	89 e5                	mov    %esp,%ebp
+80102d03:	57                   	push   %edi
+80102d04:	56                   	push   %esi
+80102d05:	53                   	push   %ebx
+80102d06:	83 ec 1c             	sub    $0x1c,%esp
+    for(pp = &idepending; *pp; pp = &(*pp)->qnext)
+80102d09:	8b 1d 0c e1 15 80    	mov    0x8015e10c,%ebx
+80102d0f:	85 db                	test   %ebx,%ebx
+80102d11:	0f 84 6f 01 00 00    	je     80102e86 <idedispatch.part.0+0x186>
+      if(!idebefore(*pp, idedev, ideblock))
+80102d17:	8b 35 04 e1 15 80    	mov    0x8015e104,%esi
+80102d1d:	8b 0d 08 e1 15 80    	mov    0x8015e108,%ecx
+    for(pp = &idepending; *pp; pp = &(*pp)->qnext)
+80102d23:	89 d8                	mov    %ebx,%eax
+80102d25:	bf 0c e1 15 80       	mov    $0x8015e10c,%edi
+  return b->dev < dev || (b->dev == dev && b->blockno < blockno);
+80102d2a:	8b 50 04             	mov    0x4(%eax),%edx
+80102d2d:	39 ca                	cmp    %ecx,%edx
+80102d2f:	0f 82 43 01 00 00    	jb     80102e78 <idedispatch.part.0+0x178>
+80102d35:	39 d1                	cmp    %edx,%ecx
+80102d37:	0f 84 2b 01 00 00    	je     80102e68 <idedispatch.part.0+0x168>
+  b = last = *pp;
+80102d3d:	8b 1f                	mov    (%edi),%ebx
+80102d3f:	89 d8                	mov    %ebx,%eax
+  for(n = 1; n < IDEMAXRUN && last->qnext; n++){
+80102d41:	b9 01 00 00 00       	mov    $0x1,%ecx
+80102d46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102d4d:	8d 76 00             	lea    0x0(%esi),%esi
+80102d50:	89 c6                	mov    %eax,%esi
+80102d52:	8b 40 5c             	mov    0x5c(%eax),%eax
+80102d55:	85 c0                	test   %eax,%eax
+80102d57:	0f 84 e3 01 00 00    	je     80102f40 <idedispatch.part.0+0x240>
+    if(last->qnext->dev != b->dev ||
+80102d5d:	8b 53 04             	mov    0x4(%ebx),%edx
+80102d60:	39 50 04             	cmp    %edx,0x4(%eax)
+80102d63:	75 21                	jne    80102d86 <idedispatch.part.0+0x86>
+       last->qnext->blockno != last->blockno + 1 ||
+80102d65:	8b 56 08             	mov    0x8(%esi),%edx
+80102d68:	83 c2 01             	add    $0x1,%edx
+    if(last->qnext->dev != b->dev ||
+80102d6b:	39 50 08             	cmp    %edx,0x8(%eax)
+80102d6e:	75 16                	jne    80102d86 <idedispatch.part.0+0x86>
+       (last->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+80102d70:	8b 10                	mov    (%eax),%edx
+80102d72:	33 13                	xor    (%ebx),%edx
+       last->qnext->blockno != last->blockno + 1 ||
+80102d74:	83 e2 04             	and    $0x4,%edx
+80102d77:	75 0d                	jne    80102d86 <idedispatch.part.0+0x86>
+  for(n = 1; n < IDEMAXRUN && last->qnext; n++){
+80102d79:	83 c1 01             	add    $0x1,%ecx
+80102d7c:	83 f9 20             	cmp    $0x20,%ecx
+80102d7f:	75 cf                	jne    80102d50 <idedispatch.part.0+0x50>
+80102d81:	89 c6                	mov    %eax,%esi
+  *pp = last->qnext;
+80102d83:	8b 40 5c             	mov    0x5c(%eax),%eax
+80102d86:	89 07                	mov    %eax,(%edi)
+  idedev = last->dev;
+80102d88:	8b 46 04             	mov    0x4(%esi),%eax
+  last->qnext = 0;
+80102d8b:	c7 46 5c 00 00 00 00 	movl   $0x0,0x5c(%esi)
+  idedev = last->dev;
+80102d92:	a3 08 e1 15 80       	mov    %eax,0x8015e108
+  ideblock = last->blockno + 1;
+80102d97:	8b 46 08             	mov    0x8(%esi),%eax
+  idequeue = b;
+80102d9a:	89 1d 10 e1 15 80    	mov    %ebx,0x8015e110
+  ideblock = last->blockno + 1;
+80102da0:	83 c0 01             	add    $0x1,%eax
+80102da3:	a3 04 e1 15 80       	mov    %eax,0x8015e104
+  if(b->blockno + n > DISKSIZE)
+80102da8:	8b 43 08             	mov    0x8(%ebx),%eax
+80102dab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102dae:	01 c8                	add    %ecx,%eax
+80102db0:	3d e8 23 00 00       	cmp    $0x23e8,%eax
+80102db5:	0f 87 c0 01 00 00    	ja     80102f7b <idedispatch.part.0+0x27b>
+  if(bmbase){
+80102dbb:	0f b7 05 00 e1 15 80 	movzwl 0x8015e100,%eax
+80102dc2:	66 89 45 e6          	mov    %ax,-0x1a(%ebp)
+80102dc6:	66 85 c0             	test   %ax,%ax
+80102dc9:	0f 85 c1 00 00 00    	jne    80102e90 <idedispatch.part.0+0x190>
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+80102dcf:	8b 3b                	mov    (%ebx),%edi
+80102dd1:	83 e7 04             	and    $0x4,%edi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102dd4:	be f7 01 00 00       	mov    $0x1f7,%esi
+80102dd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102de0:	89 f2                	mov    %esi,%edx
+80102de2:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102de3:	83 e0 c0             	and    $0xffffffc0,%eax
+80102de6:	3c 40                	cmp    $0x40,%al
+80102de8:	75 f6                	jne    80102de0 <idedispatch.part.0+0xe0>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102dea:	31 c0                	xor    %eax,%eax
+80102dec:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80102df1:	ee                   	out    %al,(%dx)
+80102df2:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80102df7:	89 c8                	mov    %ecx,%eax
+80102df9:	ee                   	out    %al,(%dx)
+80102dfa:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80102dfd:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80102e02:	89 c8                	mov    %ecx,%eax
+80102e04:	ee                   	out    %al,(%dx)
+  outb(0x1f4, (sector >> 8) & 0xff);
+80102e05:	89 c8                	mov    %ecx,%eax
+80102e07:	ba f4 01 00 00       	mov    $0x1f4,%edx
+80102e0c:	c1 f8 08             	sar    $0x8,%eax
+80102e0f:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+80102e10:	89 c8                	mov    %ecx,%eax
+80102e12:	ba f5 01 00 00       	mov    $0x1f5,%edx
+80102e17:	c1 f8 10             	sar    $0x10,%eax
+80102e1a:	ee                   	out    %al,(%dx)
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+80102e1b:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+80102e1f:	c1 f9 18             	sar    $0x18,%ecx
+80102e22:	89 ca                	mov    %ecx,%edx
+80102e24:	c1 e0 04             	shl    $0x4,%eax
+80102e27:	83 e2 0f             	and    $0xf,%edx
+80102e2a:	83 e0 10             	and    $0x10,%eax
+80102e2d:	09 d0                	or     %edx,%eax
+80102e2f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102e34:	83 c8 e0             	or     $0xffffffe0,%eax
+80102e37:	ee                   	out    %al,(%dx)
+  if(bmbase){
+80102e38:	0f b7 4d e6          	movzwl -0x1a(%ebp),%ecx
+80102e3c:	66 85 c9             	test   %cx,%cx
+80102e3f:	0f 84 c3 00 00 00    	je     80102f08 <idedispatch.part.0+0x208>
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+80102e45:	83 ff 01             	cmp    $0x1,%edi
+80102e48:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102e4d:	19 c0                	sbb    %eax,%eax
+80102e4f:	83 e0 fe             	and    $0xfffffffe,%eax
+80102e52:	83 e8 36             	sub    $0x36,%eax
+80102e55:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102e56:	89 ca                	mov    %ecx,%edx
+80102e58:	ec                   	in     (%dx),%al
+    outb(bmbase + BM_CMD, inb(bmbase + BM_CMD) | BM_START);
+80102e59:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102e5c:	ee                   	out    %al,(%dx)
+}
+80102e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102e60:	5b                   	pop    %ebx
+80102e61:	5e                   	pop    %esi
+80102e62:	5f                   	pop    %edi
+80102e63:	5d                   	pop    %ebp
+80102e64:	c3                   	ret
+80102e65:	8d 76 00             	lea    0x0(%esi),%esi
+  return b->dev < dev || (b->dev == dev && b->blockno < blockno);
+80102e68:	39 70 08             	cmp    %esi,0x8(%eax)
+80102e6b:	0f 83 cc fe ff ff    	jae    80102d3d <idedispatch.part.0+0x3d>
+80102e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    for(pp = &idepending; *pp; pp = &(*pp)->qnext)
+80102e78:	8d 78 5c             	lea    0x5c(%eax),%edi
+80102e7b:	8b 40 5c             	mov    0x5c(%eax),%eax
+80102e7e:	85 c0                	test   %eax,%eax
+80102e80:	0f 85 a4 fe ff ff    	jne    80102d2a <idedispatch.part.0+0x2a>
+      pp = &idepending;   // wrap around
+80102e86:	bf 0c e1 15 80       	mov    $0x8015e10c,%edi
+80102e8b:	e9 af fe ff ff       	jmp    80102d3f <idedispatch.part.0+0x3f>
+      prdt[i].flags = (i == n-1) ? PRD_EOT : 0;
+80102e90:	8d 79 ff             	lea    -0x1(%ecx),%edi
+80102e93:	89 de                	mov    %ebx,%esi
+    for(i = 0, p = b; i < n; i++, p = p->qnext){
+80102e95:	31 c0                	xor    %eax,%eax
+80102e97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e9e:	66 90                	xchg   %ax,%ax
+      prdt[i].addr = V2P(p->data);
+80102ea0:	8b 56 64             	mov    0x64(%esi),%edx
+80102ea3:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+80102ea9:	89 14 c5 00 e0 15 80 	mov    %edx,-0x7fea2000(,%eax,8)
+      prdt[i].count = BSIZE;
+80102eb0:	ba 00 02 00 00       	mov    $0x200,%edx
+80102eb5:	66 89 14 c5 04 e0 15 	mov    %dx,-0x7fea1ffc(,%eax,8)
+80102ebc:	80 
+      prdt[i].flags = (i == n-1) ? PRD_EOT : 0;
+80102ebd:	31 d2                	xor    %edx,%edx
+80102ebf:	39 f8                	cmp    %edi,%eax
+80102ec1:	0f 94 c2             	sete   %dl
+80102ec4:	c1 e2 0f             	shl    $0xf,%edx
+80102ec7:	66 89 14 c5 06 e0 15 	mov    %dx,-0x7fea1ffa(,%eax,8)
+80102ece:	80 
+    for(i = 0, p = b; i < n; i++, p = p->qnext){
+80102ecf:	83 c0 01             	add    $0x1,%eax
+80102ed2:	8b 76 5c             	mov    0x5c(%esi),%esi
+80102ed5:	39 c8                	cmp    %ecx,%eax
+80102ed7:	75 c7                	jne    80102ea0 <idedispatch.part.0+0x1a0>
+    outl(bmbase + BM_PRDT, V2P(prdt));
+80102ed9:	0f b7 75 e6          	movzwl -0x1a(%ebp),%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102edd:	b8 00 e0 15 00       	mov    $0x15e000,%eax
+80102ee2:	8d 56 04             	lea    0x4(%esi),%edx
+80102ee5:	ef                   	out    %eax,(%dx)
+    outb(bmbase + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_READ);
+80102ee6:	8b 3b                	mov    (%ebx),%edi
+80102ee8:	31 c0                	xor    %eax,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102eea:	89 f2                	mov    %esi,%edx
+80102eec:	83 e7 04             	and    $0x4,%edi
+80102eef:	0f 94 c0             	sete   %al
+80102ef2:	c1 e0 03             	shl    $0x3,%eax
+80102ef5:	ee                   	out    %al,(%dx)
+    outb(bmbase + BM_STATUS, inb(bmbase + BM_STATUS) | BM_ERR | BM_INTR);
+80102ef6:	83 c2 02             	add    $0x2,%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102ef9:	ec                   	in     (%dx),%al
+80102efa:	83 c8 06             	or     $0x6,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102efd:	ee                   	out    %al,(%dx)
+}
+80102efe:	e9 d1 fe ff ff       	jmp    80102dd4 <idedispatch.part.0+0xd4>
+80102f03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102f07:	90                   	nop
+  } else if(b->flags & B_DIRTY){
+80102f08:	85 ff                	test   %edi,%edi
+80102f0a:	74 24                	je     80102f30 <idedispatch.part.0+0x230>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f0c:	b8 30 00 00 00       	mov    $0x30,%eax
+80102f11:	89 f2                	mov    %esi,%edx
+80102f13:	ee                   	out    %al,(%dx)
+  asm volatile("cld; rep outsl" :
+80102f14:	b9 80 00 00 00       	mov    $0x80,%ecx
+80102f19:	8b 73 64             	mov    0x64(%ebx),%esi
+80102f1c:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80102f21:	fc                   	cld
+80102f22:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+}
+80102f24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102f27:	5b                   	pop    %ebx
+80102f28:	5e                   	pop    %esi
+80102f29:	5f                   	pop    %edi
+80102f2a:	5d                   	pop    %ebp
+80102f2b:	c3                   	ret
+80102f2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f30:	b8 20 00 00 00       	mov    $0x20,%eax
+80102f35:	89 f2                	mov    %esi,%edx
+80102f37:	ee                   	out    %al,(%dx)
+80102f38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102f3b:	5b                   	pop    %ebx
+80102f3c:	5e                   	pop    %esi
+80102f3d:	5f                   	pop    %edi
+80102f3e:	5d                   	pop    %ebp
+80102f3f:	c3                   	ret
+  *pp = last->qnext;
+80102f40:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  idedev = last->dev;
+80102f46:	8b 46 04             	mov    0x4(%esi),%eax
+  last->qnext = 0;
+80102f49:	c7 46 5c 00 00 00 00 	movl   $0x0,0x5c(%esi)
+  idedev = last->dev;
+80102f50:	a3 08 e1 15 80       	mov    %eax,0x8015e108
+  ideblock = last->blockno + 1;
+80102f55:	8b 46 08             	mov    0x8(%esi),%eax
+  idequeue = b;
+80102f58:	89 1d 10 e1 15 80    	mov    %ebx,0x8015e110
+  ideblock = last->blockno + 1;
+80102f5e:	83 c0 01             	add    $0x1,%eax
+80102f61:	a3 04 e1 15 80       	mov    %eax,0x8015e104
+  if(b == 0)
+80102f66:	85 db                	test   %ebx,%ebx
+80102f68:	0f 85 3a fe ff ff    	jne    80102da8 <idedispatch.part.0+0xa8>
+    panic("idestart");
+80102f6e:	83 ec 0c             	sub    $0xc,%esp
+80102f71:	68 48 b6 10 80       	push   $0x8010b648
+80102f76:	e8 45 dc ff ff       	call   80100bc0 <panic>
+    panic("incorrect blockno");
+80102f7b:	83 ec 0c             	sub    $0xc,%esp
+80102f7e:	68 51 b6 10 80       	push   $0x8010b651
+80102f83:	e8 38 dc ff ff       	call   80100bc0 <panic>
+80102f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102f8f:	90                   	nop
+
+80102f90 <ideinit>:
+{
+80102f90:	55                   	push   %ebp
+80102f91:	89 e5                	mov    %esp,%ebp
+80102f93:	53                   	push   %ebx
+80102f94:	83 ec 1c             	sub    $0x1c,%esp
+  initlock(&idelock, "ide");
+80102f97:	68 63 b6 10 80       	push   $0x8010b663
+80102f9c:	68 20 e1 15 80       	push   $0x8015e120
+80102fa1:	e8 9a 3d 00 00       	call   80106d40 <initlock>
+  picenable(IRQ_IDE);
+80102fa6:	c7 04 24 0e 00 00 00 	movl   $0xe,(%esp)
+80102fad:	e8 ee 22 00 00       	call   801052a0 <picenable>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+80102fb2:	58                   	pop    %eax
+80102fb3:	a1 84 e9 17 80       	mov    0x8017e984,%eax
+80102fb8:	5a                   	pop    %edx
+80102fb9:	83 e8 01             	sub    $0x1,%eax
+80102fbc:	50                   	push   %eax
+80102fbd:	6a 0e                	push   $0xe
+80102fbf:	e8 bc 04 00 00       	call   80103480 <ioapicenable>
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102fc4:	83 c4 10             	add    $0x10,%esp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102fc7:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+80102fcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102fd0:	89 ca                	mov    %ecx,%edx
+80102fd2:	ec                   	in     (%dx),%al
+80102fd3:	83 e0 c0             	and    $0xffffffc0,%eax
+80102fd6:	3c 40                	cmp    $0x40,%al
+80102fd8:	75 f6                	jne    80102fd0 <ideinit+0x40>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102fda:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+80102fdf:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102fe4:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102fe5:	89 ca                	mov    %ecx,%edx
+80102fe7:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80102fe8:	84 c0                	test   %al,%al
+80102fea:	75 1e                	jne    8010300a <ideinit+0x7a>
+80102fec:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+80102ff1:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102ff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102ffd:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i=0; i<1000; i++){
+80103000:	83 e9 01             	sub    $0x1,%ecx
+80103003:	74 0f                	je     80103014 <ideinit+0x84>
+80103005:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80103006:	84 c0                	test   %al,%al
+80103008:	74 f6                	je     80103000 <ideinit+0x70>
+      havedisk1 = 1;
+8010300a:	c7 05 00 d0 15 80 01 	movl   $0x1,0x8015d000
+80103011:	00 00 00 
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103014:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80103019:	ba f6 01 00 00       	mov    $0x1f6,%edx
+8010301e:	ee                   	out    %al,(%dx)
+  if(!IDEDMA || !pcifind(0x01, 0x01, &tag))  // mass storage, IDE
+8010301f:	83 ec 04             	sub    $0x4,%esp
+80103022:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80103025:	50                   	push   %eax
+80103026:	6a 01                	push   $0x1
+80103028:	6a 01                	push   $0x1
+8010302a:	e8 61 1e 00 00       	call   80104e90 <pcifind>
+8010302f:	83 c4 10             	add    $0x10,%esp
+80103032:	85 c0                	test   %eax,%eax
+80103034:	75 0a                	jne    80103040 <ideinit+0xb0>
+}
+80103036:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103039:	c9                   	leave
+8010303a:	c3                   	ret
+8010303b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010303f:	90                   	nop
+  if(!(pciread(tag, 0x08) & 0x8000))  // programming interface
+80103040:	83 ec 08             	sub    $0x8,%esp
+80103043:	6a 08                	push   $0x8
+80103045:	ff 75 f4             	push   -0xc(%ebp)
+80103048:	e8 e3 1d 00 00       	call   80104e30 <pciread>
+8010304d:	83 c4 10             	add    $0x10,%esp
+80103050:	f6 c4 80             	test   $0x80,%ah
+80103053:	74 e1                	je     80103036 <ideinit+0xa6>
+  bar = pciread(tag, 0x20);           // BAR4
+80103055:	83 ec 08             	sub    $0x8,%esp
+80103058:	6a 20                	push   $0x20
+8010305a:	ff 75 f4             	push   -0xc(%ebp)
+8010305d:	e8 ce 1d 00 00       	call   80104e30 <pciread>
+  if(!(bar & 1) || (bar & ~3) == 0)   // not an assigned I/O range
+80103062:	83 c4 10             	add    $0x10,%esp
+  bar = pciread(tag, 0x20);           // BAR4
+80103065:	89 c3                	mov    %eax,%ebx
+  if(!(bar & 1) || (bar & ~3) == 0)   // not an assigned I/O range
+80103067:	a8 01                	test   $0x1,%al
+80103069:	74 cb                	je     80103036 <ideinit+0xa6>
+8010306b:	83 f8 03             	cmp    $0x3,%eax
+8010306e:	76 c6                	jbe    80103036 <ideinit+0xa6>
+  pciwrite(tag, 0x04, (pciread(tag, 0x04) & 0xffff) | 0x5);
+80103070:	83 ec 08             	sub    $0x8,%esp
+  bmbase = bar & 0xfffc;
+80103073:	83 e3 fc             	and    $0xfffffffc,%ebx
+  pciwrite(tag, 0x04, (pciread(tag, 0x04) & 0xffff) | 0x5);
+80103076:	6a 04                	push   $0x4
+80103078:	ff 75 f4             	push   -0xc(%ebp)
+8010307b:	e8 b0 1d 00 00       	call   80104e30 <pciread>
+80103080:	83 c4 0c             	add    $0xc,%esp
+80103083:	0f b7 c0             	movzwl %ax,%eax
+80103086:	83 c8 05             	or     $0x5,%eax
+80103089:	50                   	push   %eax
+8010308a:	6a 04                	push   $0x4
+8010308c:	ff 75 f4             	push   -0xc(%ebp)
+8010308f:	e8 cc 1d 00 00       	call   80104e60 <pciwrite>
+  bmbase = bar & 0xfffc;
+80103094:	66 89 1d 00 e1 15 80 	mov    %bx,0x8015e100
+8010309b:	83 c4 10             	add    $0x10,%esp
+8010309e:	eb 96                	jmp    80103036 <ideinit+0xa6>
+
+801030a0 <ideintr>:
+{
+801030a0:	55                   	push   %ebp
+801030a1:	89 e5                	mov    %esp,%ebp
+801030a3:	57                   	push   %edi
+801030a4:	56                   	push   %esi
+801030a5:	53                   	push   %ebx
+801030a6:	83 ec 28             	sub    $0x28,%esp
+  acquire(&idelock);
+801030a9:	68 20 e1 15 80       	push   $0x8015e120
+801030ae:	e8 ad 3c 00 00       	call   80106d60 <acquire>
+  if((b = idequeue) == 0){
+801030b3:	8b 1d 10 e1 15 80    	mov    0x8015e110,%ebx
+801030b9:	83 c4 10             	add    $0x10,%esp
+801030bc:	85 db                	test   %ebx,%ebx
+801030be:	0f 84 9e 00 00 00    	je     80103162 <ideintr+0xc2>
+  if(bmbase){
+801030c4:	0f b7 0d 00 e1 15 80 	movzwl 0x8015e100,%ecx
+801030cb:	66 85 c9             	test   %cx,%cx
+801030ce:	0f 85 ac 00 00 00    	jne    80103180 <ideintr+0xe0>
+    idequeue = b->qnext;
+801030d4:	8b 43 5c             	mov    0x5c(%ebx),%eax
+    if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+801030d7:	8b 3b                	mov    (%ebx),%edi
+    idequeue = b->qnext;
+801030d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801030dc:	a3 10 e1 15 80       	mov    %eax,0x8015e110
+    if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+801030e1:	f7 c7 04 00 00 00    	test   $0x4,%edi
+801030e7:	75 32                	jne    8010311b <ideintr+0x7b>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801030e9:	ba f7 01 00 00       	mov    $0x1f7,%edx
+801030ee:	66 90                	xchg   %ax,%ax
+801030f0:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+801030f1:	89 c6                	mov    %eax,%esi
+801030f3:	83 e6 c0             	and    $0xffffffc0,%esi
+801030f6:	89 f1                	mov    %esi,%ecx
+801030f8:	80 f9 40             	cmp    $0x40,%cl
+801030fb:	75 f3                	jne    801030f0 <ideintr+0x50>
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+801030fd:	a8 21                	test   $0x21,%al
+801030ff:	75 1a                	jne    8010311b <ideintr+0x7b>
+  asm volatile("cld; rep insl" :
+80103101:	8b 7b 64             	mov    0x64(%ebx),%edi
+80103104:	b9 80 00 00 00       	mov    $0x80,%ecx
+80103109:	ba f0 01 00 00       	mov    $0x1f0,%edx
+8010310e:	fc                   	cld
+8010310f:	f3 6d                	rep insl (%dx),%es:(%edi)
+    if(idequeue != 0 && (idequeue->flags & B_DIRTY)){
+80103111:	a1 10 e1 15 80       	mov    0x8015e110,%eax
+  b->flags |= B_VALID;
+80103116:	8b 3b                	mov    (%ebx),%edi
+    if(idequeue != 0 && (idequeue->flags & B_DIRTY)){
+80103118:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010311b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010311e:	85 c0                	test   %eax,%eax
+80103120:	74 09                	je     8010312b <ideintr+0x8b>
+80103122:	f6 00 04             	testb  $0x4,(%eax)
+80103125:	0f 85 fd 00 00 00    	jne    80103228 <ideintr+0x188>
+  b->flags &= ~B_DIRTY;
+8010312b:	89 f8                	mov    %edi,%eax
+8010312d:	83 e0 fb             	and    $0xfffffffb,%eax
+80103130:	83 c8 02             	or     $0x2,%eax
+  if(b->flags & B_ASYNC)
+80103133:	83 e7 08             	and    $0x8,%edi
+  b->flags &= ~B_DIRTY;
+80103136:	89 03                	mov    %eax,(%ebx)
+  if(b->flags & B_ASYNC)
+80103138:	0f 84 d2 00 00 00    	je     80103210 <ideintr+0x170>
+    bdone(b);
+8010313e:	83 ec 0c             	sub    $0xc,%esp
+80103141:	53                   	push   %ebx
+80103142:	e8 a9 d8 ff ff       	call   801009f0 <bdone>
+80103147:	83 c4 10             	add    $0x10,%esp
+  if(idequeue == 0)
+8010314a:	8b 15 10 e1 15 80    	mov    0x8015e110,%edx
+80103150:	85 d2                	test   %edx,%edx
+80103152:	75 0e                	jne    80103162 <ideintr+0xc2>
+  if(idepending == 0)
+80103154:	a1 0c e1 15 80       	mov    0x8015e10c,%eax
+80103159:	85 c0                	test   %eax,%eax
+8010315b:	74 05                	je     80103162 <ideintr+0xc2>
+8010315d:	e8 9e fb ff ff       	call   80102d00 <idedispatch.part.0>
+    release(&idelock);
+80103162:	83 ec 0c             	sub    $0xc,%esp
+80103165:	68 20 e1 15 80       	push   $0x8015e120
+8010316a:	e8 11 3e 00 00       	call   80106f80 <release>
+}
+8010316f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103172:	5b                   	pop    %ebx
+80103173:	5e                   	pop    %esi
+80103174:	5f                   	pop    %edi
+80103175:	5d                   	pop    %ebp
+80103176:	c3                   	ret
+80103177:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010317e:	66 90                	xchg   %ax,%ax
+    st = inb(bmbase + BM_STATUS);
+80103180:	8d 79 02             	lea    0x2(%ecx),%edi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103183:	89 fa                	mov    %edi,%edx
+80103185:	ec                   	in     (%dx),%al
+80103186:	89 c6                	mov    %eax,%esi
+80103188:	89 ca                	mov    %ecx,%edx
+8010318a:	ec                   	in     (%dx),%al
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010318b:	83 e0 fe             	and    $0xfffffffe,%eax
+8010318e:	ee                   	out    %al,(%dx)
+8010318f:	89 f0                	mov    %esi,%eax
+80103191:	89 fa                	mov    %edi,%edx
+80103193:	83 c8 06             	or     $0x6,%eax
+80103196:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103197:	ba f7 01 00 00       	mov    $0x1f7,%edx
+8010319c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801031a0:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+801031a1:	89 c1                	mov    %eax,%ecx
+801031a3:	83 e1 c0             	and    $0xffffffc0,%ecx
+801031a6:	80 f9 40             	cmp    $0x40,%cl
+801031a9:	75 f5                	jne    801031a0 <ideintr+0x100>
+    if(idewait(1) < 0 || (st & BM_ERR))
+801031ab:	83 e6 02             	and    $0x2,%esi
+801031ae:	83 e0 21             	and    $0x21,%eax
+801031b1:	89 f2                	mov    %esi,%edx
+801031b3:	08 c2                	or     %al,%dl
+801031b5:	0f 85 95 00 00 00    	jne    80103250 <ideintr+0x1b0>
+    idequeue = 0;
+801031bb:	c7 05 10 e1 15 80 00 	movl   $0x0,0x8015e110
+801031c2:	00 00 00 
+    for(; b; b = next){
+801031c5:	eb 1d                	jmp    801031e4 <ideintr+0x144>
+801031c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801031ce:	66 90                	xchg   %ax,%ax
+    bdone(b);
+801031d0:	83 ec 0c             	sub    $0xc,%esp
+801031d3:	50                   	push   %eax
+801031d4:	e8 17 d8 ff ff       	call   801009f0 <bdone>
+801031d9:	83 c4 10             	add    $0x10,%esp
+    for(; b; b = next){
+801031dc:	85 db                	test   %ebx,%ebx
+801031de:	0f 84 66 ff ff ff    	je     8010314a <ideintr+0xaa>
+      next = b->qnext;
+801031e4:	89 d8                	mov    %ebx,%eax
+801031e6:	8b 5b 5c             	mov    0x5c(%ebx),%ebx
+  b->flags |= B_VALID;
+801031e9:	8b 08                	mov    (%eax),%ecx
+  b->flags &= ~B_DIRTY;
+801031eb:	89 ca                	mov    %ecx,%edx
+801031ed:	83 e2 fb             	and    $0xfffffffb,%edx
+801031f0:	83 ca 02             	or     $0x2,%edx
+  if(b->flags & B_ASYNC)
+801031f3:	83 e1 08             	and    $0x8,%ecx
+  b->flags &= ~B_DIRTY;
+801031f6:	89 10                	mov    %edx,(%eax)
+  if(b->flags & B_ASYNC)
+801031f8:	75 d6                	jne    801031d0 <ideintr+0x130>
+    wakeup(b);
+801031fa:	83 ec 0c             	sub    $0xc,%esp
+801031fd:	50                   	push   %eax
+801031fe:	e8 dd 34 00 00       	call   801066e0 <wakeup>
+80103203:	83 c4 10             	add    $0x10,%esp
+80103206:	eb d4                	jmp    801031dc <ideintr+0x13c>
+80103208:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010320f:	90                   	nop
+80103210:	83 ec 0c             	sub    $0xc,%esp
+80103213:	53                   	push   %ebx
+80103214:	e8 c7 34 00 00       	call   801066e0 <wakeup>
+80103219:	83 c4 10             	add    $0x10,%esp
+8010321c:	e9 29 ff ff ff       	jmp    8010314a <ideintr+0xaa>
+80103221:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103228:	ba f7 01 00 00       	mov    $0x1f7,%edx
+8010322d:	8d 76 00             	lea    0x0(%esi),%esi
+80103230:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80103231:	83 e0 c0             	and    $0xffffffc0,%eax
+80103234:	3c 40                	cmp    $0x40,%al
+80103236:	75 f8                	jne    80103230 <ideintr+0x190>
+  asm volatile("cld; rep outsl" :
+80103238:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010323b:	b9 80 00 00 00       	mov    $0x80,%ecx
+80103240:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80103245:	8b 70 64             	mov    0x64(%eax),%esi
+80103248:	fc                   	cld
+80103249:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+}
+8010324b:	e9 db fe ff ff       	jmp    8010312b <ideintr+0x8b>
+      panic("ideintr: dma error");
+80103250:	83 ec 0c             	sub    $0xc,%esp
+80103253:	68 67 b6 10 80       	push   $0x8010b667
+80103258:	e8 63 d9 ff ff       	call   80100bc0 <panic>
+8010325d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103260 <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+80103260:	55                   	push   %ebp
+80103261:	89 e5                	mov    %esp,%ebp
+80103263:	53                   	push   %ebx
+80103264:	83 ec 10             	sub    $0x10,%esp
+80103267:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&idelock);  //DOC:acquire-lock
+8010326a:	68 20 e1 15 80       	push   $0x8015e120
+8010326f:	e8 ec 3a 00 00       	call   80106d60 <acquire>
+
+  ideinsert(b);
+80103274:	89 d8                	mov    %ebx,%eax
+80103276:	e8 c5 f9 ff ff       	call   80102c40 <ideinsert>
+
+  // Start disk if necessary.
+  if(idequeue == 0)
+8010327b:	8b 15 10 e1 15 80    	mov    0x8015e110,%edx
+80103281:	83 c4 10             	add    $0x10,%esp
+80103284:	85 d2                	test   %edx,%edx
+80103286:	74 48                	je     801032d0 <iderw+0x70>
+    idedispatch();
+
+  // Wait for request to finish, unless it is a read-ahead.
+  if(b->flags & B_ASYNC){
+80103288:	8b 03                	mov    (%ebx),%eax
+8010328a:	a8 08                	test   $0x8,%al
+8010328c:	75 2d                	jne    801032bb <iderw+0x5b>
+    release(&idelock);
+    return;
+  }
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+8010328e:	83 e0 06             	and    $0x6,%eax
+80103291:	83 f8 02             	cmp    $0x2,%eax
+80103294:	74 25                	je     801032bb <iderw+0x5b>
+80103296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010329d:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(b, &idelock);
+801032a0:	83 ec 08             	sub    $0x8,%esp
+801032a3:	68 20 e1 15 80       	push   $0x8015e120
+801032a8:	53                   	push   %ebx
+801032a9:	e8 62 32 00 00       	call   80106510 <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+801032ae:	8b 03                	mov    (%ebx),%eax
+801032b0:	83 c4 10             	add    $0x10,%esp
+801032b3:	83 e0 06             	and    $0x6,%eax
+801032b6:	83 f8 02             	cmp    $0x2,%eax
+801032b9:	75 e5                	jne    801032a0 <iderw+0x40>
+    release(&idelock);
+801032bb:	c7 45 08 20 e1 15 80 	movl   $0x8015e120,0x8(%ebp)
+  }
+
+  release(&idelock);
+}
+801032c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801032c5:	c9                   	leave
+    release(&idelock);
+801032c6:	e9 b5 3c 00 00       	jmp    80106f80 <release>
+801032cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801032cf:	90                   	nop
+  if(idepending == 0)
+801032d0:	a1 0c e1 15 80       	mov    0x8015e10c,%eax
+801032d5:	85 c0                	test   %eax,%eax
+801032d7:	74 af                	je     80103288 <iderw+0x28>
+801032d9:	e8 22 fa ff ff       	call   80102d00 <idedispatch.part.0>
+801032de:	eb a8                	jmp    80103288 <iderw+0x28>
+
+801032e0 <iderwv>:
+// Sync the n bufs in bv with disk together, so that runs of
+// consecutive blocks among them go to the disk as one command.
+// Returns when all are done.
+void
+iderwv(struct buf **bv, int n)
+{
+801032e0:	55                   	push   %ebp
+801032e1:	89 e5                	mov    %esp,%ebp
+801032e3:	57                   	push   %edi
+801032e4:	56                   	push   %esi
+801032e5:	53                   	push   %ebx
+801032e6:	83 ec 28             	sub    $0x28,%esp
+801032e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+801032ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801032ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801032f2:	89 c6                	mov    %eax,%esi
+  int i;
+
+  acquire(&idelock);
+801032f4:	68 20 e1 15 80       	push   $0x8015e120
+801032f9:	e8 62 3a 00 00       	call   80106d60 <acquire>
+  for(i = 0; i < n; i++)
+801032fe:	83 c4 10             	add    $0x10,%esp
+80103301:	85 f6                	test   %esi,%esi
+80103303:	7e 66                	jle    8010336b <iderwv+0x8b>
+80103305:	31 ff                	xor    %edi,%edi
+80103307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010330e:	66 90                	xchg   %ax,%ax
+    ideinsert(bv[i]);
+80103310:	8b 04 bb             	mov    (%ebx,%edi,4),%eax
+80103313:	89 fe                	mov    %edi,%esi
+  for(i = 0; i < n; i++)
+80103315:	8d 7f 01             	lea    0x1(%edi),%edi
+    ideinsert(bv[i]);
+80103318:	e8 23 f9 ff ff       	call   80102c40 <ideinsert>
+  for(i = 0; i < n; i++)
+8010331d:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+80103320:	75 ee                	jne    80103310 <iderwv+0x30>
+  if(idequeue == 0)
+80103322:	8b 15 10 e1 15 80    	mov    0x8015e110,%edx
+80103328:	85 d2                	test   %edx,%edx
+8010332a:	74 5c                	je     80103388 <iderwv+0xa8>
+    idedispatch();
+  for(i = 0; i < n; i++){
+8010332c:	31 ff                	xor    %edi,%edi
+8010332e:	66 90                	xchg   %ax,%ax
+    while((bv[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+80103330:	8b 13                	mov    (%ebx),%edx
+80103332:	8b 02                	mov    (%edx),%eax
+80103334:	83 e0 06             	and    $0x6,%eax
+80103337:	83 f8 02             	cmp    $0x2,%eax
+8010333a:	74 21                	je     8010335d <iderwv+0x7d>
+8010333c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      sleep(bv[i], &idelock);
+80103340:	83 ec 08             	sub    $0x8,%esp
+80103343:	68 20 e1 15 80       	push   $0x8015e120
+80103348:	52                   	push   %edx
+80103349:	e8 c2 31 00 00       	call   80106510 <sleep>
+    while((bv[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+8010334e:	8b 13                	mov    (%ebx),%edx
+80103350:	83 c4 10             	add    $0x10,%esp
+80103353:	8b 02                	mov    (%edx),%eax
+80103355:	83 e0 06             	and    $0x6,%eax
+80103358:	83 f8 02             	cmp    $0x2,%eax
+8010335b:	75 e3                	jne    80103340 <iderwv+0x60>
+  for(i = 0; i < n; i++){
+8010335d:	8d 47 01             	lea    0x1(%edi),%eax
+80103360:	83 c3 04             	add    $0x4,%ebx
+80103363:	39 fe                	cmp    %edi,%esi
+80103365:	74 0e                	je     80103375 <iderwv+0x95>
+80103367:	89 c7                	mov    %eax,%edi
+80103369:	eb c5                	jmp    80103330 <iderwv+0x50>
+  if(idequeue == 0)
+8010336b:	8b 1d 10 e1 15 80    	mov    0x8015e110,%ebx
+80103371:	85 db                	test   %ebx,%ebx
+80103373:	74 23                	je     80103398 <iderwv+0xb8>
+  }
+  release(&idelock);
+80103375:	c7 45 08 20 e1 15 80 	movl   $0x8015e120,0x8(%ebp)
+}
+8010337c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010337f:	5b                   	pop    %ebx
+80103380:	5e                   	pop    %esi
+80103381:	5f                   	pop    %edi
+80103382:	5d                   	pop    %ebp
+  release(&idelock);
+80103383:	e9 f8 3b 00 00       	jmp    80106f80 <release>
+  if(idepending == 0)
+80103388:	a1 0c e1 15 80       	mov    0x8015e10c,%eax
+8010338d:	85 c0                	test   %eax,%eax
+8010338f:	74 9b                	je     8010332c <iderwv+0x4c>
+80103391:	e8 6a f9 ff ff       	call   80102d00 <idedispatch.part.0>
+  for(i = 0; i < n; i++){
+80103396:	eb 94                	jmp    8010332c <iderwv+0x4c>
+  if(idepending == 0)
+80103398:	8b 0d 0c e1 15 80    	mov    0x8015e10c,%ecx
+8010339e:	85 c9                	test   %ecx,%ecx
+801033a0:	74 d3                	je     80103375 <iderwv+0x95>
+801033a2:	e8 59 f9 ff ff       	call   80102d00 <idedispatch.part.0>
+  for(i = 0; i < n; i++){
+801033a7:	eb cc                	jmp    80103375 <iderwv+0x95>
+801033a9:	66 90                	xchg   %ax,%ax
+801033ab:	66 90                	xchg   %ax,%ax
+801033ad:	66 90                	xchg   %ax,%ax
+801033af:	90                   	nop
+
+801033b0 <ioapicinit>:
+void
+ioapicinit(void)
+{
+  int i, id, maxintr;
+
+  if(!ismp)
+801033b0:	a1 88 e9 17 80       	mov    0x8017e988,%eax
+801033b5:	85 c0                	test   %eax,%eax
+801033b7:	0f 84 b3 00 00 00    	je     80103470 <ioapicinit+0xc0>
+{
+801033bd:	55                   	push   %ebp
+801033be:	89 e5                	mov    %esp,%ebp
+801033c0:	56                   	push   %esi
+801033c1:	53                   	push   %ebx
+    return;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+801033c2:	c7 05 54 e1 15 80 00 	movl   $0xfec00000,0x8015e154
+801033c9:	00 c0 fe 
+  ioapic->reg = reg;
+801033cc:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+801033d3:	00 00 00 
+  return ioapic->data;
+801033d6:	8b 15 54 e1 15 80    	mov    0x8015e154,%edx
+801033dc:	8b 72 10             	mov    0x10(%edx),%esi
+  ioapic->reg = reg;
+801033df:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  return ioapic->data;
+801033e5:	8b 1d 54 e1 15 80    	mov    0x8015e154,%ebx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  id = ioapicread(REG_ID) >> 24;
+  if(id != ioapicid)
+801033eb:	0f b6 15 80 e9 17 80 	movzbl 0x8017e980,%edx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+801033f2:	c1 ee 10             	shr    $0x10,%esi
+801033f5:	89 f0                	mov    %esi,%eax
+801033f7:	0f b6 f0             	movzbl %al,%esi
+  return ioapic->data;
+801033fa:	8b 43 10             	mov    0x10(%ebx),%eax
+  id = ioapicread(REG_ID) >> 24;
+801033fd:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+80103400:	39 c2                	cmp    %eax,%edx
+80103402:	75 4c                	jne    80103450 <ioapicinit+0xa0>
+{
+80103404:	ba 10 00 00 00       	mov    $0x10,%edx
+80103409:	31 c0                	xor    %eax,%eax
+8010340b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010340f:	90                   	nop
+  ioapic->reg = reg;
+80103410:	89 13                	mov    %edx,(%ebx)
+80103412:	8d 48 20             	lea    0x20(%eax),%ecx
+  ioapic->data = data;
+80103415:	8b 1d 54 e1 15 80    	mov    0x8015e154,%ebx
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+8010341b:	83 c0 01             	add    $0x1,%eax
+8010341e:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+  ioapic->data = data;
+80103424:	89 4b 10             	mov    %ecx,0x10(%ebx)
+  ioapic->reg = reg;
+80103427:	8d 4a 01             	lea    0x1(%edx),%ecx
+  for(i = 0; i <= maxintr; i++){
+8010342a:	83 c2 02             	add    $0x2,%edx
+  ioapic->reg = reg;
+8010342d:	89 0b                	mov    %ecx,(%ebx)
+  ioapic->data = data;
+8010342f:	8b 1d 54 e1 15 80    	mov    0x8015e154,%ebx
+80103435:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  for(i = 0; i <= maxintr; i++){
+8010343c:	39 c6                	cmp    %eax,%esi
+8010343e:	7d d0                	jge    80103410 <ioapicinit+0x60>
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+  }
+}
+80103440:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103443:	5b                   	pop    %ebx
+80103444:	5e                   	pop    %esi
+80103445:	5d                   	pop    %ebp
+80103446:	c3                   	ret
+80103447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010344e:	66 90                	xchg   %ax,%ax
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+80103450:	83 ec 0c             	sub    $0xc,%esp
+80103453:	68 7c b6 10 80       	push   $0x8010b67c
+80103458:	e8 93 da ff ff       	call   80100ef0 <cprintf>
+  ioapic->reg = reg;
+8010345d:	8b 1d 54 e1 15 80    	mov    0x8015e154,%ebx
+80103463:	83 c4 10             	add    $0x10,%esp
+80103466:	eb 9c                	jmp    80103404 <ioapicinit+0x54>
+80103468:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010346f:	90                   	nop
+80103470:	c3                   	ret
+80103471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010347f:	90                   	nop
+
+80103480 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+80103480:	55                   	push   %ebp
+  if(!ismp)
+80103481:	8b 15 88 e9 17 80    	mov    0x8017e988,%edx
+{
+80103487:	89 e5                	mov    %esp,%ebp
+80103489:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!ismp)
+8010348c:	85 d2                	test   %edx,%edx
+8010348e:	74 2b                	je     801034bb <ioapicenable+0x3b>
+  ioapic->reg = reg;
+80103490:	8b 0d 54 e1 15 80    	mov    0x8015e154,%ecx
+    return;
+
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+80103496:	8d 50 20             	lea    0x20(%eax),%edx
+80103499:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+  ioapic->reg = reg;
+8010349d:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+8010349f:	8b 0d 54 e1 15 80    	mov    0x8015e154,%ecx
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+801034a5:	83 c0 01             	add    $0x1,%eax
+  ioapic->data = data;
+801034a8:	89 51 10             	mov    %edx,0x10(%ecx)
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+801034ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ioapic->reg = reg;
+801034ae:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+801034b0:	a1 54 e1 15 80       	mov    0x8015e154,%eax
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+801034b5:	c1 e2 18             	shl    $0x18,%edx
+  ioapic->data = data;
+801034b8:	89 50 10             	mov    %edx,0x10(%eax)
+}
+801034bb:	5d                   	pop    %ebp
+801034bc:	c3                   	ret
+801034bd:	66 90                	xchg   %ax,%ax
+801034bf:	90                   	nop
+
+801034c0 <kget>:
+#endif
+
+// Take a page from this CPU's magazine, or 0.
+static char*
+kget(void)
+{
+801034c0:	55                   	push   %ebp
+801034c1:	89 e5                	mov    %esp,%ebp
+801034c3:	57                   	push   %edi
+801034c4:	56                   	push   %esi
+801034c5:	53                   	push   %ebx
+801034c6:	83 ec 0c             	sub    $0xc,%esp
+  struct kmag *m;
+  char *v;
+
+  pushcli();
+801034c9:	e8 32 3a 00 00       	call   80106f00 <pushcli>
+  m = &kmag[cpu - cpus];
+801034ce:	65 8b 1d 00 00 00 00 	mov    %gs:0x0,%ebx
+801034d5:	81 eb c0 e9 17 80    	sub    $0x8017e9c0,%ebx
+801034db:	c1 fb 08             	sar    $0x8,%ebx
+  if(m->n == 0)
+801034de:	69 f3 04 01 00 00    	imul   $0x104,%ebx,%esi
+801034e4:	8b 86 c0 a1 17 80    	mov    -0x7fe85e40(%esi),%eax
+801034ea:	85 c0                	test   %eax,%eax
+801034ec:	74 3a                	je     80103528 <kget+0x68>
+    krefill(m);
+  v = m->n > 0 ? m->page[--m->n] : 0;
+801034ee:	31 f6                	xor    %esi,%esi
+801034f0:	85 c0                	test   %eax,%eax
+801034f2:	7e 1f                	jle    80103513 <kget+0x53>
+801034f4:	69 d3 04 01 00 00    	imul   $0x104,%ebx,%edx
+801034fa:	83 e8 01             	sub    $0x1,%eax
+801034fd:	89 82 c0 a1 17 80    	mov    %eax,-0x7fe85e40(%edx)
+80103503:	89 da                	mov    %ebx,%edx
+80103505:	c1 e2 06             	shl    $0x6,%edx
+80103508:	01 da                	add    %ebx,%edx
+8010350a:	01 d0                	add    %edx,%eax
+8010350c:	8b 34 85 c4 a1 17 80 	mov    -0x7fe85e3c(,%eax,4),%esi
+  popcli();
+80103513:	e8 18 3a 00 00       	call   80106f30 <popcli>
+  return v;
+}
+80103518:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010351b:	89 f0                	mov    %esi,%eax
+8010351d:	5b                   	pop    %ebx
+8010351e:	5e                   	pop    %esi
+8010351f:	5f                   	pop    %edi
+80103520:	5d                   	pop    %ebp
+80103521:	c3                   	ret
+80103522:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  acquire(&kmem.lock);
+80103528:	83 ec 0c             	sub    $0xc,%esp
+8010352b:	68 60 e1 15 80       	push   $0x8015e160
+80103530:	e8 2b 38 00 00       	call   80106d60 <acquire>
+  while(m->n < KMAGSIZE/2 && (r = kmem.freelist) != 0){
+80103535:	8b 86 c0 a1 17 80    	mov    -0x7fe85e40(%esi),%eax
+8010353b:	83 c4 10             	add    $0x10,%esp
+8010353e:	83 f8 1f             	cmp    $0x1f,%eax
+80103541:	7f 41                	jg     80103584 <kget+0xc4>
+80103543:	8b 15 98 e1 15 80    	mov    0x8015e198,%edx
+80103549:	8b 0d 9c e1 15 80    	mov    0x8015e19c,%ecx
+8010354f:	83 c0 01             	add    $0x1,%eax
+80103552:	eb 2c                	jmp    80103580 <kget+0xc0>
+80103554:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    kmem.freelist = r->next;
+80103558:	8b 3a                	mov    (%edx),%edi
+    kmem.nfree--;
+8010355a:	83 e9 01             	sub    $0x1,%ecx
+    m->page[m->n++] = (char*)r;
+8010355d:	89 86 c0 a1 17 80    	mov    %eax,-0x7fe85e40(%esi)
+80103563:	89 94 86 c0 a1 17 80 	mov    %edx,-0x7fe85e40(%esi,%eax,4)
+  while(m->n < KMAGSIZE/2 && (r = kmem.freelist) != 0){
+8010356a:	83 c0 01             	add    $0x1,%eax
+    kmem.freelist = r->next;
+8010356d:	89 3d 98 e1 15 80    	mov    %edi,0x8015e198
+    kmem.nfree--;
+80103573:	89 0d 9c e1 15 80    	mov    %ecx,0x8015e19c
+  while(m->n < KMAGSIZE/2 && (r = kmem.freelist) != 0){
+80103579:	83 f8 21             	cmp    $0x21,%eax
+8010357c:	74 06                	je     80103584 <kget+0xc4>
+8010357e:	89 fa                	mov    %edi,%edx
+80103580:	85 d2                	test   %edx,%edx
+80103582:	75 d4                	jne    80103558 <kget+0x98>
+  release(&kmem.lock);
+80103584:	83 ec 0c             	sub    $0xc,%esp
+80103587:	68 60 e1 15 80       	push   $0x8015e160
+8010358c:	e8 ef 39 00 00       	call   80106f80 <release>
+  v = m->n > 0 ? m->page[--m->n] : 0;
+80103591:	69 c3 04 01 00 00    	imul   $0x104,%ebx,%eax
+}
+80103597:	83 c4 10             	add    $0x10,%esp
+  v = m->n > 0 ? m->page[--m->n] : 0;
+8010359a:	8b 80 c0 a1 17 80    	mov    -0x7fe85e40(%eax),%eax
+}
+801035a0:	e9 49 ff ff ff       	jmp    801034ee <kget+0x2e>
+801035a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801035ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801035b0 <kfree>:
+{
+801035b0:	55                   	push   %ebp
+801035b1:	89 e5                	mov    %esp,%ebp
+801035b3:	57                   	push   %edi
+801035b4:	56                   	push   %esi
+801035b5:	53                   	push   %ebx
+801035b6:	83 ec 1c             	sub    $0x1c,%esp
+801035b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+801035bc:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+801035c2:	0f 85 52 01 00 00    	jne    8010371a <kfree+0x16a>
+801035c8:	81 fb 90 33 1a 80    	cmp    $0x801a3390,%ebx
+801035ce:	0f 82 46 01 00 00    	jb     8010371a <kfree+0x16a>
+801035d4:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+801035da:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+801035df:	0f 87 35 01 00 00    	ja     8010371a <kfree+0x16a>
+  if(KREF(v) > 1 && __sync_sub_and_fetch(&KREF(v), 1) > 0)
+801035e5:	c1 e8 0c             	shr    $0xc,%eax
+801035e8:	66 83 bc 00 c0 e1 15 	cmpw   $0x1,-0x7fea1e40(%eax,%eax,1)
+801035ef:	80 01 
+801035f1:	77 35                	ja     80103628 <kfree+0x78>
+  if(kmem.use_lock){
+801035f3:	8b 0d 94 e1 15 80    	mov    0x8015e194,%ecx
+  KREF(v) = 0;
+801035f9:	31 d2                	xor    %edx,%edx
+801035fb:	66 89 94 00 c0 e1 15 	mov    %dx,-0x7fea1e40(%eax,%eax,1)
+80103602:	80 
+  if(kmem.use_lock){
+80103603:	85 c9                	test   %ecx,%ecx
+80103605:	75 39                	jne    80103640 <kfree+0x90>
+  r->next = kmem.freelist;
+80103607:	a1 98 e1 15 80       	mov    0x8015e198,%eax
+8010360c:	89 03                	mov    %eax,(%ebx)
+  kmem.nfree++;
+8010360e:	83 05 9c e1 15 80 01 	addl   $0x1,0x8015e19c
+  kmem.freelist = r;
+80103615:	89 1d 98 e1 15 80    	mov    %ebx,0x8015e198
+}
+8010361b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010361e:	5b                   	pop    %ebx
+8010361f:	5e                   	pop    %esi
+80103620:	5f                   	pop    %edi
+80103621:	5d                   	pop    %ebp
+80103622:	c3                   	ret
+80103623:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103627:	90                   	nop
+  if(KREF(v) > 1 && __sync_sub_and_fetch(&KREF(v), 1) > 0)
+80103628:	66 f0 83 ac 00 c0 e1 	lock subw $0x1,-0x7fea1e40(%eax,%eax,1)
+8010362f:	15 80 01 
+80103632:	74 bf                	je     801035f3 <kfree+0x43>
+80103634:	eb e5                	jmp    8010361b <kfree+0x6b>
+80103636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010363d:	8d 76 00             	lea    0x0(%esi),%esi
+    pushcli();
+80103640:	e8 bb 38 00 00       	call   80106f00 <pushcli>
+    m = &kmag[cpu - cpus];
+80103645:	65 8b 35 00 00 00 00 	mov    %gs:0x0,%esi
+8010364c:	81 ee c0 e9 17 80    	sub    $0x8017e9c0,%esi
+80103652:	c1 fe 08             	sar    $0x8,%esi
+    if(m->n == KMAGSIZE)
+80103655:	69 fe 04 01 00 00    	imul   $0x104,%esi,%edi
+8010365b:	8b 97 c0 a1 17 80    	mov    -0x7fe85e40(%edi),%edx
+80103661:	83 fa 40             	cmp    $0x40,%edx
+80103664:	74 32                	je     80103698 <kfree+0xe8>
+    m->page[m->n++] = v;
+80103666:	69 c6 04 01 00 00    	imul   $0x104,%esi,%eax
+8010366c:	8d 4a 01             	lea    0x1(%edx),%ecx
+8010366f:	89 88 c0 a1 17 80    	mov    %ecx,-0x7fe85e40(%eax)
+80103675:	89 f0                	mov    %esi,%eax
+80103677:	c1 e0 06             	shl    $0x6,%eax
+8010367a:	01 f0                	add    %esi,%eax
+8010367c:	01 d0                	add    %edx,%eax
+8010367e:	89 1c 85 c4 a1 17 80 	mov    %ebx,-0x7fe85e3c(,%eax,4)
+}
+80103685:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103688:	5b                   	pop    %ebx
+80103689:	5e                   	pop    %esi
+8010368a:	5f                   	pop    %edi
+8010368b:	5d                   	pop    %ebp
+    popcli();
+8010368c:	e9 9f 38 00 00       	jmp    80106f30 <popcli>
+80103691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  acquire(&kmem.lock);
+80103698:	83 ec 0c             	sub    $0xc,%esp
+8010369b:	68 60 e1 15 80       	push   $0x8015e160
+801036a0:	e8 bb 36 00 00       	call   80106d60 <acquire>
+    r = (struct run*)m->page[--m->n];
+801036a5:	89 f1                	mov    %esi,%ecx
+  while(m->n > KMAGSIZE/2){
+801036a7:	8b 87 c0 a1 17 80    	mov    -0x7fe85e40(%edi),%eax
+801036ad:	83 c4 10             	add    $0x10,%esp
+    r = (struct run*)m->page[--m->n];
+801036b0:	c1 e1 06             	shl    $0x6,%ecx
+    r->next = kmem.freelist;
+801036b3:	8b 15 98 e1 15 80    	mov    0x8015e198,%edx
+    r = (struct run*)m->page[--m->n];
+801036b9:	01 f1                	add    %esi,%ecx
+801036bb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  while(m->n > KMAGSIZE/2){
+801036be:	83 f8 20             	cmp    $0x20,%eax
+801036c1:	7e 36                	jle    801036f9 <kfree+0x149>
+801036c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801036c7:	90                   	nop
+    r = (struct run*)m->page[--m->n];
+801036c8:	89 d1                	mov    %edx,%ecx
+801036ca:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801036cd:	83 e8 01             	sub    $0x1,%eax
+801036d0:	89 87 c0 a1 17 80    	mov    %eax,-0x7fe85e40(%edi)
+801036d6:	01 d0                	add    %edx,%eax
+801036d8:	8b 14 85 c4 a1 17 80 	mov    -0x7fe85e3c(,%eax,4),%edx
+    r->next = kmem.freelist;
+801036df:	89 0a                	mov    %ecx,(%edx)
+  while(m->n > KMAGSIZE/2){
+801036e1:	8b 87 c0 a1 17 80    	mov    -0x7fe85e40(%edi),%eax
+    kmem.nfree++;
+801036e7:	83 05 9c e1 15 80 01 	addl   $0x1,0x8015e19c
+  while(m->n > KMAGSIZE/2){
+801036ee:	83 f8 20             	cmp    $0x20,%eax
+801036f1:	7f d5                	jg     801036c8 <kfree+0x118>
+801036f3:	89 15 98 e1 15 80    	mov    %edx,0x8015e198
+  release(&kmem.lock);
+801036f9:	83 ec 0c             	sub    $0xc,%esp
+801036fc:	68 60 e1 15 80       	push   $0x8015e160
+80103701:	e8 7a 38 00 00       	call   80106f80 <release>
+    m->page[m->n++] = v;
+80103706:	69 c6 04 01 00 00    	imul   $0x104,%esi,%eax
+}
+8010370c:	83 c4 10             	add    $0x10,%esp
+    m->page[m->n++] = v;
+8010370f:	8b 90 c0 a1 17 80    	mov    -0x7fe85e40(%eax),%edx
+}
+80103715:	e9 4c ff ff ff       	jmp    80103666 <kfree+0xb6>
+    panic("kfree");
+8010371a:	83 ec 0c             	sub    $0xc,%esp
+8010371d:	68 ae b6 10 80       	push   $0x8010b6ae
+80103722:	e8 99 d4 ff ff       	call   80100bc0 <panic>
+80103727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010372e:	66 90                	xchg   %ax,%ax
+
+80103730 <freerange>:
+{
+80103730:	55                   	push   %ebp
+80103731:	89 e5                	mov    %esp,%ebp
+80103733:	56                   	push   %esi
+80103734:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80103735:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80103738:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+8010373b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80103741:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103747:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010374d:	39 de                	cmp    %ebx,%esi
+8010374f:	72 23                	jb     80103774 <freerange+0x44>
+80103751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+80103758:	83 ec 0c             	sub    $0xc,%esp
+8010375b:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103761:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80103767:	50                   	push   %eax
+80103768:	e8 43 fe ff ff       	call   801035b0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+8010376d:	83 c4 10             	add    $0x10,%esp
+80103770:	39 de                	cmp    %ebx,%esi
+80103772:	73 e4                	jae    80103758 <freerange+0x28>
+}
+80103774:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103777:	5b                   	pop    %ebx
+80103778:	5e                   	pop    %esi
+80103779:	5d                   	pop    %ebp
+8010377a:	c3                   	ret
+8010377b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010377f:	90                   	nop
+
+80103780 <kinit2>:
+{
+80103780:	55                   	push   %ebp
+80103781:	89 e5                	mov    %esp,%ebp
+80103783:	56                   	push   %esi
+80103784:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80103785:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80103788:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+8010378b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80103791:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103797:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010379d:	39 de                	cmp    %ebx,%esi
+8010379f:	72 23                	jb     801037c4 <kinit2+0x44>
+801037a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+801037a8:	83 ec 0c             	sub    $0xc,%esp
+801037ab:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801037b1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+801037b7:	50                   	push   %eax
+801037b8:	e8 f3 fd ff ff       	call   801035b0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801037bd:	83 c4 10             	add    $0x10,%esp
+801037c0:	39 de                	cmp    %ebx,%esi
+801037c2:	73 e4                	jae    801037a8 <kinit2+0x28>
+  kmem.use_lock = 1;
+801037c4:	c7 05 94 e1 15 80 01 	movl   $0x1,0x8015e194
+801037cb:	00 00 00 
+}
+801037ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801037d1:	5b                   	pop    %ebx
+801037d2:	5e                   	pop    %esi
+801037d3:	5d                   	pop    %ebp
+801037d4:	c3                   	ret
+801037d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801037dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801037e0 <kinit1>:
+{
+801037e0:	55                   	push   %ebp
+801037e1:	89 e5                	mov    %esp,%ebp
+801037e3:	56                   	push   %esi
+801037e4:	53                   	push   %ebx
+801037e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  initlock(&kmem.lock, "kmem");
+801037e8:	83 ec 08             	sub    $0x8,%esp
+801037eb:	68 b4 b6 10 80       	push   $0x8010b6b4
+801037f0:	68 60 e1 15 80       	push   $0x8015e160
+801037f5:	e8 46 35 00 00       	call   80106d40 <initlock>
+  p = (char*)PGROUNDUP((uint)vstart);
+801037fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801037fd:	83 c4 10             	add    $0x10,%esp
+  kmem.use_lock = 0;
+80103800:	c7 05 94 e1 15 80 00 	movl   $0x0,0x8015e194
+80103807:	00 00 00 
+  p = (char*)PGROUNDUP((uint)vstart);
+8010380a:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80103810:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103816:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010381c:	39 de                	cmp    %ebx,%esi
+8010381e:	72 1c                	jb     8010383c <kinit1+0x5c>
+    kfree(p);
+80103820:	83 ec 0c             	sub    $0xc,%esp
+80103823:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103829:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+8010382f:	50                   	push   %eax
+80103830:	e8 7b fd ff ff       	call   801035b0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103835:	83 c4 10             	add    $0x10,%esp
+80103838:	39 de                	cmp    %ebx,%esi
+8010383a:	73 e4                	jae    80103820 <kinit1+0x40>
+}
+8010383c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010383f:	5b                   	pop    %ebx
+80103840:	5e                   	pop    %esi
+80103841:	5d                   	pop    %ebp
+80103842:	c3                   	ret
+80103843:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010384a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103850 <kalloc>:
+// When memory runs out, use the zeroed pages, then ask the
+// buffer cache and the page cache to give some back, and last
+// wait for kswapd to swap some user pages out.
+char*
+kalloc(void)
+{
+80103850:	55                   	push   %ebp
+80103851:	89 e5                	mov    %esp,%ebp
+80103853:	53                   	push   %ebx
+80103854:	83 ec 04             	sub    $0x4,%esp
+  struct run *r;
+  char *v;
+
+  if(!kmem.use_lock){
+80103857:	8b 1d 94 e1 15 80    	mov    0x8015e194,%ebx
+8010385d:	85 db                	test   %ebx,%ebx
+8010385f:	0f 84 bb 00 00 00    	je     80103920 <kalloc+0xd0>
+80103865:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+    return (char*)r;
+  }
+
+  for(;;){
+    if((v = kget()) != 0 || (v = kzget()) != 0){
+80103868:	e8 53 fc ff ff       	call   801034c0 <kget>
+8010386d:	89 c3                	mov    %eax,%ebx
+8010386f:	85 c0                	test   %eax,%eax
+80103871:	75 3e                	jne    801038b1 <kalloc+0x61>
+  acquire(&kmem.lock);
+80103873:	83 ec 0c             	sub    $0xc,%esp
+80103876:	68 60 e1 15 80       	push   $0x8015e160
+8010387b:	e8 e0 34 00 00       	call   80106d60 <acquire>
+  r = kmem.zeroed;
+80103880:	8b 1d a0 e1 15 80    	mov    0x8015e1a0,%ebx
+  if(r){
+80103886:	83 c4 10             	add    $0x10,%esp
+80103889:	85 db                	test   %ebx,%ebx
+8010388b:	74 43                	je     801038d0 <kalloc+0x80>
+    kmem.zeroed = r->next;
+8010388d:	8b 03                	mov    (%ebx),%eax
+  release(&kmem.lock);
+8010388f:	83 ec 0c             	sub    $0xc,%esp
+    kmem.nzeroed--;
+80103892:	83 2d a4 e1 15 80 01 	subl   $0x1,0x8015e1a4
+    kmem.zeroed = r->next;
+80103899:	a3 a0 e1 15 80       	mov    %eax,0x8015e1a0
+    r->next = 0;
+8010389e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  release(&kmem.lock);
+801038a4:	68 60 e1 15 80       	push   $0x8015e160
+801038a9:	e8 d2 36 00 00       	call   80106f80 <release>
+801038ae:	83 c4 10             	add    $0x10,%esp
+#ifdef KALLOC_DEBUG
+      kcheck(v);
+#endif
+      KREF(v) = 1;
+801038b1:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+801038b7:	ba 01 00 00 00       	mov    $0x1,%edx
+801038bc:	c1 e8 0c             	shr    $0xc,%eax
+801038bf:	66 89 94 00 c0 e1 15 	mov    %dx,-0x7fea1e40(%eax,%eax,1)
+801038c6:	80 
+      return v;
+    }
+    if(bshrink(1) == 0 && pcshrink(1) == 0 && swapwait() == 0)
+      return 0;
+  }
+}
+801038c7:	89 d8                	mov    %ebx,%eax
+801038c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801038cc:	c9                   	leave
+801038cd:	c3                   	ret
+801038ce:	66 90                	xchg   %ax,%ax
+  release(&kmem.lock);
+801038d0:	83 ec 0c             	sub    $0xc,%esp
+801038d3:	68 60 e1 15 80       	push   $0x8015e160
+801038d8:	e8 a3 36 00 00       	call   80106f80 <release>
+    if(bshrink(1) == 0 && pcshrink(1) == 0 && swapwait() == 0)
+801038dd:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+801038e4:	e8 07 ce ff ff       	call   801006f0 <bshrink>
+801038e9:	83 c4 10             	add    $0x10,%esp
+801038ec:	85 c0                	test   %eax,%eax
+801038ee:	0f 85 74 ff ff ff    	jne    80103868 <kalloc+0x18>
+801038f4:	83 ec 0c             	sub    $0xc,%esp
+801038f7:	6a 01                	push   $0x1
+801038f9:	e8 12 19 00 00       	call   80105210 <pcshrink>
+801038fe:	83 c4 10             	add    $0x10,%esp
+80103901:	85 c0                	test   %eax,%eax
+80103903:	0f 85 5f ff ff ff    	jne    80103868 <kalloc+0x18>
+80103909:	e8 32 41 00 00       	call   80107a40 <swapwait>
+8010390e:	85 c0                	test   %eax,%eax
+80103910:	0f 85 52 ff ff ff    	jne    80103868 <kalloc+0x18>
+80103916:	eb af                	jmp    801038c7 <kalloc+0x77>
+80103918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010391f:	90                   	nop
+    r = kmem.freelist;
+80103920:	8b 1d 98 e1 15 80    	mov    0x8015e198,%ebx
+    if(r){
+80103926:	85 db                	test   %ebx,%ebx
+80103928:	74 9d                	je     801038c7 <kalloc+0x77>
+      kmem.freelist = r->next;
+8010392a:	8b 03                	mov    (%ebx),%eax
+      KREF(r) = 1;
+8010392c:	b9 01 00 00 00       	mov    $0x1,%ecx
+      kmem.nfree--;
+80103931:	83 2d 9c e1 15 80 01 	subl   $0x1,0x8015e19c
+      kmem.freelist = r->next;
+80103938:	a3 98 e1 15 80       	mov    %eax,0x8015e198
+      KREF(r) = 1;
+8010393d:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80103943:	c1 e8 0c             	shr    $0xc,%eax
+80103946:	66 89 8c 00 c0 e1 15 	mov    %cx,-0x7fea1e40(%eax,%eax,1)
+8010394d:	80 
+}
+8010394e:	89 d8                	mov    %ebx,%eax
+80103950:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103953:	c9                   	leave
+80103954:	c3                   	ret
+80103955:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010395c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103960 <kzalloc>:
+
+// Allocate a page of zeros.
+char*
+kzalloc(void)
+{
+80103960:	55                   	push   %ebp
+80103961:	89 e5                	mov    %esp,%ebp
+80103963:	53                   	push   %ebx
+80103964:	83 ec 04             	sub    $0x4,%esp
+  char *v;
+
+#ifndef KALLOC_DEBUG
+  if(kmem.use_lock && (v = kzget()) != 0){
+80103967:	8b 0d 94 e1 15 80    	mov    0x8015e194,%ecx
+8010396d:	85 c9                	test   %ecx,%ecx
+8010396f:	74 6f                	je     801039e0 <kzalloc+0x80>
+  acquire(&kmem.lock);
+80103971:	83 ec 0c             	sub    $0xc,%esp
+80103974:	68 60 e1 15 80       	push   $0x8015e160
+80103979:	e8 e2 33 00 00       	call   80106d60 <acquire>
+  r = kmem.zeroed;
+8010397e:	8b 1d a0 e1 15 80    	mov    0x8015e1a0,%ebx
+  if(r){
+80103984:	83 c4 10             	add    $0x10,%esp
+80103987:	85 db                	test   %ebx,%ebx
+80103989:	74 45                	je     801039d0 <kzalloc+0x70>
+    kmem.zeroed = r->next;
+8010398b:	8b 03                	mov    (%ebx),%eax
+  release(&kmem.lock);
+8010398d:	83 ec 0c             	sub    $0xc,%esp
+    kmem.nzeroed--;
+80103990:	83 2d a4 e1 15 80 01 	subl   $0x1,0x8015e1a4
+    kmem.zeroed = r->next;
+80103997:	a3 a0 e1 15 80       	mov    %eax,0x8015e1a0
+    r->next = 0;
+8010399c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  release(&kmem.lock);
+801039a2:	68 60 e1 15 80       	push   $0x8015e160
+801039a7:	e8 d4 35 00 00       	call   80106f80 <release>
+    KREF(v) = 1;
+801039ac:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+801039b2:	ba 01 00 00 00       	mov    $0x1,%edx
+    return v;
+801039b7:	83 c4 10             	add    $0x10,%esp
+    KREF(v) = 1;
+801039ba:	c1 e8 0c             	shr    $0xc,%eax
+801039bd:	66 89 94 00 c0 e1 15 	mov    %dx,-0x7fea1e40(%eax,%eax,1)
+801039c4:	80 
+  }
+#endif
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+801039c5:	89 d8                	mov    %ebx,%eax
+801039c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801039ca:	c9                   	leave
+801039cb:	c3                   	ret
+801039cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  release(&kmem.lock);
+801039d0:	83 ec 0c             	sub    $0xc,%esp
+801039d3:	68 60 e1 15 80       	push   $0x8015e160
+801039d8:	e8 a3 35 00 00       	call   80106f80 <release>
+801039dd:	83 c4 10             	add    $0x10,%esp
+  if((v = kalloc()) != 0)
+801039e0:	e8 6b fe ff ff       	call   80103850 <kalloc>
+801039e5:	89 c3                	mov    %eax,%ebx
+801039e7:	85 c0                	test   %eax,%eax
+801039e9:	74 da                	je     801039c5 <kzalloc+0x65>
+    memset(v, 0, PGSIZE);
+801039eb:	83 ec 04             	sub    $0x4,%esp
+801039ee:	68 00 10 00 00       	push   $0x1000
+801039f3:	6a 00                	push   $0x0
+801039f5:	50                   	push   %eax
+801039f6:	e8 45 38 00 00       	call   80107240 <memset>
+}
+801039fb:	89 d8                	mov    %ebx,%eax
+    memset(v, 0, PGSIZE);
+801039fd:	83 c4 10             	add    $0x10,%esp
+}
+80103a00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103a03:	c9                   	leave
+80103a04:	c3                   	ret
+80103a05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103a10 <kzeroidle>:
+#ifdef KALLOC_DEBUG
+  return 0;
+#else
+  struct run *r;
+
+  if(!kmem.use_lock || kmem.nzeroed >= KZEROPAGES)
+80103a10:	a1 94 e1 15 80       	mov    0x8015e194,%eax
+80103a15:	85 c0                	test   %eax,%eax
+80103a17:	74 09                	je     80103a22 <kzeroidle+0x12>
+80103a19:	83 3d a4 e1 15 80 3f 	cmpl   $0x3f,0x8015e1a4
+80103a20:	7e 06                	jle    80103a28 <kzeroidle+0x18>
+    return 0;
+80103a22:	31 c0                	xor    %eax,%eax
+  kmem.zeroed = r;
+  kmem.nzeroed++;
+  release(&kmem.lock);
+  return 1;
+#endif
+}
+80103a24:	c3                   	ret
+80103a25:	8d 76 00             	lea    0x0(%esi),%esi
+{
+80103a28:	55                   	push   %ebp
+80103a29:	89 e5                	mov    %esp,%ebp
+80103a2b:	53                   	push   %ebx
+80103a2c:	83 ec 04             	sub    $0x4,%esp
+  if((r = (struct run*)kget()) == 0)
+80103a2f:	e8 8c fa ff ff       	call   801034c0 <kget>
+80103a34:	89 c3                	mov    %eax,%ebx
+    return 0;
+80103a36:	31 c0                	xor    %eax,%eax
+  if((r = (struct run*)kget()) == 0)
+80103a38:	85 db                	test   %ebx,%ebx
+80103a3a:	74 44                	je     80103a80 <kzeroidle+0x70>
+  memset(r, 0, PGSIZE);
+80103a3c:	83 ec 04             	sub    $0x4,%esp
+80103a3f:	68 00 10 00 00       	push   $0x1000
+80103a44:	6a 00                	push   $0x0
+80103a46:	53                   	push   %ebx
+80103a47:	e8 f4 37 00 00       	call   80107240 <memset>
+  acquire(&kmem.lock);
+80103a4c:	c7 04 24 60 e1 15 80 	movl   $0x8015e160,(%esp)
+80103a53:	e8 08 33 00 00       	call   80106d60 <acquire>
+  r->next = kmem.zeroed;
+80103a58:	a1 a0 e1 15 80       	mov    0x8015e1a0,%eax
+80103a5d:	89 03                	mov    %eax,(%ebx)
+  kmem.zeroed = r;
+80103a5f:	89 1d a0 e1 15 80    	mov    %ebx,0x8015e1a0
+  kmem.nzeroed++;
+80103a65:	83 05 a4 e1 15 80 01 	addl   $0x1,0x8015e1a4
+  release(&kmem.lock);
+80103a6c:	c7 04 24 60 e1 15 80 	movl   $0x8015e160,(%esp)
+80103a73:	e8 08 35 00 00       	call   80106f80 <release>
+  return 1;
+80103a78:	83 c4 10             	add    $0x10,%esp
+80103a7b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80103a80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103a83:	c9                   	leave
+80103a84:	c3                   	ret
+80103a85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103a90 <kdup>:
+
+// Add a reference to page v, which is shared copy-on-write.
+void
+kdup(char *v)
+{
+80103a90:	55                   	push   %ebp
+80103a91:	89 e5                	mov    %esp,%ebp
+  __sync_add_and_fetch(&KREF(v), 1);
+80103a93:	8b 45 08             	mov    0x8(%ebp),%eax
+80103a96:	05 00 00 00 80       	add    $0x80000000,%eax
+80103a9b:	c1 e8 0c             	shr    $0xc,%eax
+80103a9e:	66 f0 83 84 00 c0 e1 	lock addw $0x1,-0x7fea1e40(%eax,%eax,1)
+80103aa5:	15 80 01 
+}
+80103aa8:	5d                   	pop    %ebp
+80103aa9:	c3                   	ret
+80103aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103ab0 <krefcnt>:
+
+// Number of references to page v.
+int
+krefcnt(char *v)
+{
+80103ab0:	55                   	push   %ebp
+80103ab1:	89 e5                	mov    %esp,%ebp
+  return KREF(v);
+80103ab3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+80103ab6:	5d                   	pop    %ebp
+  return KREF(v);
+80103ab7:	05 00 00 00 80       	add    $0x80000000,%eax
+80103abc:	c1 e8 0c             	shr    $0xc,%eax
+80103abf:	0f b7 84 00 c0 e1 15 	movzwl -0x7fea1e40(%eax,%eax,1),%eax
+80103ac6:	80 
+}
+80103ac7:	c3                   	ret
+80103ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103acf:	90                   	nop
+
+80103ad0 <kfreepages>:
+kfreepages(void)
+{
+  int i, n;
+
+  n = kmem.nfree + kmem.nzeroed;
+  for(i = 0; i < ncpu; i++)
+80103ad0:	8b 0d 84 e9 17 80    	mov    0x8017e984,%ecx
+  n = kmem.nfree + kmem.nzeroed;
+80103ad6:	a1 a4 e1 15 80       	mov    0x8015e1a4,%eax
+80103adb:	03 05 9c e1 15 80    	add    0x8015e19c,%eax
+  for(i = 0; i < ncpu; i++)
+80103ae1:	85 c9                	test   %ecx,%ecx
+80103ae3:	7e 1f                	jle    80103b04 <kfreepages+0x34>
+80103ae5:	69 c9 04 01 00 00    	imul   $0x104,%ecx,%ecx
+80103aeb:	ba c0 a1 17 80       	mov    $0x8017a1c0,%edx
+80103af0:	01 d1                	add    %edx,%ecx
+80103af2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    n += kmag[i].n;
+80103af8:	03 02                	add    (%edx),%eax
+  for(i = 0; i < ncpu; i++)
+80103afa:	81 c2 04 01 00 00    	add    $0x104,%edx
+80103b00:	39 ca                	cmp    %ecx,%edx
+80103b02:	75 f4                	jne    80103af8 <kfreepages+0x28>
+  return n;
+}
+80103b04:	c3                   	ret
+80103b05:	66 90                	xchg   %ax,%ax
+80103b07:	66 90                	xchg   %ax,%ax
+80103b09:	66 90                	xchg   %ax,%ax
+80103b0b:	66 90                	xchg   %ax,%ax
+80103b0d:	66 90                	xchg   %ax,%ax
+80103b0f:	90                   	nop
+
+80103b10 <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103b10:	ba 64 00 00 00       	mov    $0x64,%edx
+80103b15:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80103b16:	a8 01                	test   $0x1,%al
+80103b18:	0f 84 c2 00 00 00    	je     80103be0 <kbdgetc+0xd0>
+{
+80103b1e:	55                   	push   %ebp
+80103b1f:	ba 60 00 00 00       	mov    $0x60,%edx
+80103b24:	89 e5                	mov    %esp,%ebp
+80103b26:	53                   	push   %ebx
+80103b27:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+
+  if(data == 0xE0){
+    shift |= E0ESC;
+80103b28:	8b 1d e0 a9 17 80    	mov    0x8017a9e0,%ebx
+  data = inb(KBDATAP);
+80103b2e:	0f b6 c8             	movzbl %al,%ecx
+  if(data == 0xE0){
+80103b31:	3c e0                	cmp    $0xe0,%al
+80103b33:	74 5b                	je     80103b90 <kbdgetc+0x80>
+    return 0;
+  } else if(data & 0x80){
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+80103b35:	89 da                	mov    %ebx,%edx
+80103b37:	83 e2 40             	and    $0x40,%edx
+  } else if(data & 0x80){
+80103b3a:	84 c0                	test   %al,%al
+80103b3c:	78 6a                	js     80103ba8 <kbdgetc+0x98>
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+80103b3e:	85 d2                	test   %edx,%edx
+80103b40:	74 09                	je     80103b4b <kbdgetc+0x3b>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80103b42:	83 c8 80             	or     $0xffffff80,%eax
+    shift &= ~E0ESC;
+80103b45:	83 e3 bf             	and    $0xffffffbf,%ebx
+    data |= 0x80;
+80103b48:	0f b6 c8             	movzbl %al,%ecx
+  }
+
+  shift |= shiftcode[data];
+80103b4b:	0f b6 91 e0 b7 10 80 	movzbl -0x7fef4820(%ecx),%edx
+  shift ^= togglecode[data];
+80103b52:	0f b6 81 e0 b6 10 80 	movzbl -0x7fef4920(%ecx),%eax
+  shift |= shiftcode[data];
+80103b59:	09 da                	or     %ebx,%edx
+  shift ^= togglecode[data];
+80103b5b:	31 c2                	xor    %eax,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80103b5d:	89 d0                	mov    %edx,%eax
+  shift ^= togglecode[data];
+80103b5f:	89 15 e0 a9 17 80    	mov    %edx,0x8017a9e0
+  c = charcode[shift & (CTL | SHIFT)][data];
+80103b65:	83 e0 03             	and    $0x3,%eax
+  if(shift & CAPSLOCK){
+80103b68:	83 e2 08             	and    $0x8,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80103b6b:	8b 04 85 c0 b6 10 80 	mov    -0x7fef4940(,%eax,4),%eax
+80103b72:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80103b76:	74 0b                	je     80103b83 <kbdgetc+0x73>
+    if('a' <= c && c <= 'z')
+80103b78:	8d 50 9f             	lea    -0x61(%eax),%edx
+80103b7b:	83 fa 19             	cmp    $0x19,%edx
+80103b7e:	77 48                	ja     80103bc8 <kbdgetc+0xb8>
+      c += 'A' - 'a';
+80103b80:	83 e8 20             	sub    $0x20,%eax
+    else if('A' <= c && c <= 'Z')
+      c += 'a' - 'A';
+  }
+  return c;
+}
+80103b83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103b86:	c9                   	leave
+80103b87:	c3                   	ret
+80103b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103b8f:	90                   	nop
+    shift |= E0ESC;
+80103b90:	89 d8                	mov    %ebx,%eax
+80103b92:	83 c8 40             	or     $0x40,%eax
+    shift &= ~(shiftcode[data] | E0ESC);
+80103b95:	a3 e0 a9 17 80       	mov    %eax,0x8017a9e0
+    return 0;
+80103b9a:	31 c0                	xor    %eax,%eax
+}
+80103b9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103b9f:	c9                   	leave
+80103ba0:	c3                   	ret
+80103ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    data = (shift & E0ESC ? data : data & 0x7F);
+80103ba8:	83 e0 7f             	and    $0x7f,%eax
+80103bab:	85 d2                	test   %edx,%edx
+80103bad:	0f 44 c8             	cmove  %eax,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80103bb0:	0f b6 81 e0 b7 10 80 	movzbl -0x7fef4820(%ecx),%eax
+80103bb7:	83 c8 40             	or     $0x40,%eax
+80103bba:	0f b6 c0             	movzbl %al,%eax
+80103bbd:	f7 d0                	not    %eax
+80103bbf:	21 d8                	and    %ebx,%eax
+    return 0;
+80103bc1:	eb d2                	jmp    80103b95 <kbdgetc+0x85>
+80103bc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103bc7:	90                   	nop
+    else if('A' <= c && c <= 'Z')
+80103bc8:	8d 48 bf             	lea    -0x41(%eax),%ecx
+      c += 'a' - 'A';
+80103bcb:	8d 50 20             	lea    0x20(%eax),%edx
+}
+80103bce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103bd1:	c9                   	leave
+      c += 'a' - 'A';
+80103bd2:	83 f9 1a             	cmp    $0x1a,%ecx
+80103bd5:	0f 42 c2             	cmovb  %edx,%eax
+}
+80103bd8:	c3                   	ret
+80103bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80103be0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80103be5:	c3                   	ret
+80103be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103bed:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103bf0 <kbdintr>:
+
+void
+kbdintr(void)
+{
+80103bf0:	55                   	push   %ebp
+80103bf1:	89 e5                	mov    %esp,%ebp
+80103bf3:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+80103bf6:	68 10 3b 10 80       	push   $0x80103b10
+80103bfb:	e8 00 d5 ff ff       	call   80101100 <consoleintr>
+}
+80103c00:	83 c4 10             	add    $0x10,%esp
+80103c03:	c9                   	leave
+80103c04:	c3                   	ret
+80103c05:	66 90                	xchg   %ax,%ax
+80103c07:	66 90                	xchg   %ax,%ax
+80103c09:	66 90                	xchg   %ax,%ax
+80103c0b:	66 90                	xchg   %ax,%ax
+80103c0d:	66 90                	xchg   %ax,%ax
+80103c0f:	90                   	nop
+
+80103c10 <lapicinit>:
+//PAGEBREAK!
+
+void
+lapicinit(void)
+{
+  if(!lapic)
+80103c10:	a1 e4 a9 17 80       	mov    0x8017a9e4,%eax
+80103c15:	85 c0                	test   %eax,%eax
+80103c17:	0f 84 cb 00 00 00    	je     80103ce8 <lapicinit+0xd8>
+  lapic[index] = value;
+80103c1d:	c7 80 f0 00 00 00 3f 	movl   $0x13f,0xf0(%eax)
+80103c24:	01 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103c27:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103c2a:	c7 80 e0 03 00 00 0b 	movl   $0xb,0x3e0(%eax)
+80103c31:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103c34:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103c37:	c7 80 20 03 00 00 20 	movl   $0x20020,0x320(%eax)
+80103c3e:	00 02 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103c41:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103c44:	c7 80 80 03 00 00 80 	movl   $0x989680,0x380(%eax)
+80103c4b:	96 98 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103c4e:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103c51:	c7 80 50 03 00 00 00 	movl   $0x10000,0x350(%eax)
+80103c58:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103c5b:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103c5e:	c7 80 60 03 00 00 00 	movl   $0x10000,0x360(%eax)
+80103c65:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103c68:	8b 50 20             	mov    0x20(%eax),%edx
+  lapicw(LINT0, MASKED);
+  lapicw(LINT1, MASKED);
+
+  // Disable performance counter overflow interrupts
+  // on machines that provide that interrupt entry.
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+80103c6b:	8b 50 30             	mov    0x30(%eax),%edx
+80103c6e:	c1 ea 10             	shr    $0x10,%edx
+80103c71:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80103c77:	75 77                	jne    80103cf0 <lapicinit+0xe0>
+  lapic[index] = value;
+80103c79:	c7 80 70 03 00 00 33 	movl   $0x33,0x370(%eax)
+80103c80:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103c83:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103c86:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+80103c8d:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103c90:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103c93:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+80103c9a:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103c9d:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103ca0:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80103ca7:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103caa:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103cad:	c7 80 10 03 00 00 00 	movl   $0x0,0x310(%eax)
+80103cb4:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103cb7:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103cba:	c7 80 00 03 00 00 00 	movl   $0x88500,0x300(%eax)
+80103cc1:	85 08 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103cc4:	8b 50 20             	mov    0x20(%eax),%edx
+80103cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103cce:	66 90                	xchg   %ax,%ax
+  lapicw(EOI, 0);
+
+  // Send an Init Level De-Assert to synchronise arbitration ID's.
+  lapicw(ICRHI, 0);
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+  while(lapic[ICRLO] & DELIVS)
+80103cd0:	8b 90 00 03 00 00    	mov    0x300(%eax),%edx
+80103cd6:	80 e6 10             	and    $0x10,%dh
+80103cd9:	75 f5                	jne    80103cd0 <lapicinit+0xc0>
+  lapic[index] = value;
+80103cdb:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+80103ce2:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103ce5:	8b 40 20             	mov    0x20(%eax),%eax
+    ;
+
+  // Enable interrupts on the APIC (but not on the processor).
+  lapicw(TPR, 0);
+}
+80103ce8:	c3                   	ret
+80103ce9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  lapic[index] = value;
+80103cf0:	c7 80 40 03 00 00 00 	movl   $0x10000,0x340(%eax)
+80103cf7:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103cfa:	8b 50 20             	mov    0x20(%eax),%edx
+}
+80103cfd:	e9 77 ff ff ff       	jmp    80103c79 <lapicinit+0x69>
+80103d02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103d10 <cpunum>:
+
+int
+cpunum(void)
+{
+80103d10:	55                   	push   %ebp
+80103d11:	89 e5                	mov    %esp,%ebp
+80103d13:	53                   	push   %ebx
+80103d14:	83 ec 04             	sub    $0x4,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80103d17:	9c                   	pushf
+80103d18:	58                   	pop    %eax
+  // Cannot call cpu when interrupts are enabled:
+  // result not guaranteed to last long enough to be used!
+  // Would prefer to panic but even printing is chancy here:
+  // almost everything, including cprintf and panic, calls cpu,
+  // often indirectly through acquire and release.
+  if(readeflags()&FL_IF){
+80103d19:	f6 c4 02             	test   $0x2,%ah
+80103d1c:	74 12                	je     80103d30 <cpunum+0x20>
+    static int n;
+    if(n++ == 0)
+80103d1e:	a1 e8 a9 17 80       	mov    0x8017a9e8,%eax
+80103d23:	8d 50 01             	lea    0x1(%eax),%edx
+80103d26:	89 15 e8 a9 17 80    	mov    %edx,0x8017a9e8
+80103d2c:	85 c0                	test   %eax,%eax
+80103d2e:	74 40                	je     80103d70 <cpunum+0x60>
+      cprintf("cpu called from %x with interrupts enabled\n",
+        __builtin_return_address(0));
+  }
+
+  if (!lapic)
+80103d30:	a1 e4 a9 17 80       	mov    0x8017a9e4,%eax
+80103d35:	85 c0                	test   %eax,%eax
+80103d37:	74 53                	je     80103d8c <cpunum+0x7c>
+    return 0;
+
+  apicid = lapic[ID] >> 24;
+80103d39:	8b 48 20             	mov    0x20(%eax),%ecx
+  for (i = 0; i < ncpu; ++i) {
+80103d3c:	8b 1d 84 e9 17 80    	mov    0x8017e984,%ebx
+  apicid = lapic[ID] >> 24;
+80103d42:	c1 e9 18             	shr    $0x18,%ecx
+  for (i = 0; i < ncpu; ++i) {
+80103d45:	85 db                	test   %ebx,%ebx
+80103d47:	7e 4a                	jle    80103d93 <cpunum+0x83>
+80103d49:	31 c0                	xor    %eax,%eax
+80103d4b:	eb 0a                	jmp    80103d57 <cpunum+0x47>
+80103d4d:	8d 76 00             	lea    0x0(%esi),%esi
+80103d50:	83 c0 01             	add    $0x1,%eax
+80103d53:	39 d8                	cmp    %ebx,%eax
+80103d55:	74 3c                	je     80103d93 <cpunum+0x83>
+    if (cpus[i].apicid == apicid)
+80103d57:	89 c2                	mov    %eax,%edx
+80103d59:	c1 e2 08             	shl    $0x8,%edx
+80103d5c:	0f b6 92 c0 e9 17 80 	movzbl -0x7fe81640(%edx),%edx
+80103d63:	39 ca                	cmp    %ecx,%edx
+80103d65:	75 e9                	jne    80103d50 <cpunum+0x40>
+      return i;
+  }
+  panic("unknown apicid\n");
+}
+80103d67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103d6a:	c9                   	leave
+80103d6b:	c3                   	ret
+80103d6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      cprintf("cpu called from %x with interrupts enabled\n",
+80103d70:	83 ec 08             	sub    $0x8,%esp
+80103d73:	ff 75 04             	push   0x4(%ebp)
+80103d76:	68 e0 b8 10 80       	push   $0x8010b8e0
+80103d7b:	e8 70 d1 ff ff       	call   80100ef0 <cprintf>
+  if (!lapic)
+80103d80:	a1 e4 a9 17 80       	mov    0x8017a9e4,%eax
+      cprintf("cpu called from %x with interrupts enabled\n",
+80103d85:	83 c4 10             	add    $0x10,%esp
+  if (!lapic)
+80103d88:	85 c0                	test   %eax,%eax
+80103d8a:	75 ad                	jne    80103d39 <cpunum+0x29>
+}
+80103d8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80103d8f:	31 c0                	xor    %eax,%eax
+}
+80103d91:	c9                   	leave
+80103d92:	c3                   	ret
+  panic("unknown apicid\n");
+80103d93:	83 ec 0c             	sub    $0xc,%esp
+80103d96:	68 0c b9 10 80       	push   $0x8010b90c
+80103d9b:	e8 20 ce ff ff       	call   80100bc0 <panic>
+
+80103da0 <lapiceoi>:
+
+// Acknowledge interrupt.
+void
+lapiceoi(void)
+{
+  if(lapic)
+80103da0:	a1 e4 a9 17 80       	mov    0x8017a9e4,%eax
+80103da5:	85 c0                	test   %eax,%eax
+80103da7:	74 0d                	je     80103db6 <lapiceoi+0x16>
+  lapic[index] = value;
+80103da9:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80103db0:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103db3:	8b 40 20             	mov    0x20(%eax),%eax
+    lapicw(EOI, 0);
+}
+80103db6:	c3                   	ret
+80103db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103dbe:	66 90                	xchg   %ax,%ax
+
+80103dc0 <microdelay>:
+// Spin for a given number of microseconds.
+// On real hardware would want to tune this dynamically.
+void
+microdelay(int us)
+{
+}
+80103dc0:	c3                   	ret
+80103dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103dcf:	90                   	nop
+
+80103dd0 <lapicstartap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapicstartap(uchar apicid, uint addr)
+{
+80103dd0:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103dd1:	b8 0f 00 00 00       	mov    $0xf,%eax
+80103dd6:	ba 70 00 00 00       	mov    $0x70,%edx
+80103ddb:	89 e5                	mov    %esp,%ebp
+80103ddd:	53                   	push   %ebx
+80103dde:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103de1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80103de4:	ee                   	out    %al,(%dx)
+80103de5:	b8 0a 00 00 00       	mov    $0xa,%eax
+80103dea:	ba 71 00 00 00       	mov    $0x71,%edx
+80103def:	ee                   	out    %al,(%dx)
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(CMOS_PORT, 0xF);  // offset 0xF is shutdown code
+  outb(CMOS_PORT+1, 0x0A);
+  wrv = (ushort*)P2V((0x40<<4 | 0x67));  // Warm reset vector
+  wrv[0] = 0;
+80103df0:	31 c0                	xor    %eax,%eax
+  lapic[index] = value;
+80103df2:	c1 e3 18             	shl    $0x18,%ebx
+  wrv[0] = 0;
+80103df5:	66 a3 67 04 00 80    	mov    %ax,0x80000467
+  wrv[1] = addr >> 4;
+80103dfb:	89 c8                	mov    %ecx,%eax
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  // Bochs complains about the second one.  Too bad for Bochs.
+  for(i = 0; i < 2; i++){
+    lapicw(ICRHI, apicid<<24);
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80103dfd:	c1 e9 0c             	shr    $0xc,%ecx
+  lapic[index] = value;
+80103e00:	89 da                	mov    %ebx,%edx
+  wrv[1] = addr >> 4;
+80103e02:	c1 e8 04             	shr    $0x4,%eax
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80103e05:	80 cd 06             	or     $0x6,%ch
+  wrv[1] = addr >> 4;
+80103e08:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapic[index] = value;
+80103e0e:	a1 e4 a9 17 80       	mov    0x8017a9e4,%eax
+80103e13:	89 98 10 03 00 00    	mov    %ebx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103e19:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103e1c:	c7 80 00 03 00 00 00 	movl   $0xc500,0x300(%eax)
+80103e23:	c5 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103e26:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103e29:	c7 80 00 03 00 00 00 	movl   $0x8500,0x300(%eax)
+80103e30:	85 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103e33:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103e36:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103e3c:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103e3f:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103e45:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103e48:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103e4e:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103e51:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103e57:	8b 40 20             	mov    0x20(%eax),%eax
+    microdelay(200);
+  }
+}
+80103e5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103e5d:	c9                   	leave
+80103e5e:	c3                   	ret
+80103e5f:	90                   	nop
+
+80103e60 <cmostime>:
+  r->year   = cmos_read(YEAR);
+}
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void cmostime(struct rtcdate *r)
+{
+80103e60:	55                   	push   %ebp
+80103e61:	b8 0b 00 00 00       	mov    $0xb,%eax
+80103e66:	ba 70 00 00 00       	mov    $0x70,%edx
+80103e6b:	89 e5                	mov    %esp,%ebp
+80103e6d:	57                   	push   %edi
+80103e6e:	56                   	push   %esi
+80103e6f:	53                   	push   %ebx
+80103e70:	83 ec 4c             	sub    $0x4c,%esp
+80103e73:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103e74:	ba 71 00 00 00       	mov    $0x71,%edx
+80103e79:	ec                   	in     (%dx),%al
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+
+  bcd = (sb & (1 << 2)) == 0;
+80103e7a:	83 e0 04             	and    $0x4,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103e7d:	bf 70 00 00 00       	mov    $0x70,%edi
+80103e82:	88 45 b3             	mov    %al,-0x4d(%ebp)
+80103e85:	8d 76 00             	lea    0x0(%esi),%esi
+80103e88:	31 c0                	xor    %eax,%eax
+80103e8a:	89 fa                	mov    %edi,%edx
+80103e8c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103e8d:	b9 71 00 00 00       	mov    $0x71,%ecx
+80103e92:	89 ca                	mov    %ecx,%edx
+80103e94:	ec                   	in     (%dx),%al
+80103e95:	88 45 b7             	mov    %al,-0x49(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103e98:	89 fa                	mov    %edi,%edx
+80103e9a:	b8 02 00 00 00       	mov    $0x2,%eax
+80103e9f:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103ea0:	89 ca                	mov    %ecx,%edx
+80103ea2:	ec                   	in     (%dx),%al
+80103ea3:	88 45 b6             	mov    %al,-0x4a(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103ea6:	89 fa                	mov    %edi,%edx
+80103ea8:	b8 04 00 00 00       	mov    $0x4,%eax
+80103ead:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103eae:	89 ca                	mov    %ecx,%edx
+80103eb0:	ec                   	in     (%dx),%al
+80103eb1:	88 45 b5             	mov    %al,-0x4b(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103eb4:	89 fa                	mov    %edi,%edx
+80103eb6:	b8 07 00 00 00       	mov    $0x7,%eax
+80103ebb:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103ebc:	89 ca                	mov    %ecx,%edx
+80103ebe:	ec                   	in     (%dx),%al
+80103ebf:	88 45 b4             	mov    %al,-0x4c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103ec2:	89 fa                	mov    %edi,%edx
+80103ec4:	b8 08 00 00 00       	mov    $0x8,%eax
+80103ec9:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103eca:	89 ca                	mov    %ecx,%edx
+80103ecc:	ec                   	in     (%dx),%al
+80103ecd:	89 c6                	mov    %eax,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103ecf:	89 fa                	mov    %edi,%edx
+80103ed1:	b8 09 00 00 00       	mov    $0x9,%eax
+80103ed6:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103ed7:	89 ca                	mov    %ecx,%edx
+80103ed9:	ec                   	in     (%dx),%al
+80103eda:	0f b6 d8             	movzbl %al,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103edd:	89 fa                	mov    %edi,%edx
+80103edf:	b8 0a 00 00 00       	mov    $0xa,%eax
+80103ee4:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103ee5:	89 ca                	mov    %ecx,%edx
+80103ee7:	ec                   	in     (%dx),%al
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80103ee8:	84 c0                	test   %al,%al
+80103eea:	78 9c                	js     80103e88 <cmostime+0x28>
+  return inb(CMOS_RETURN);
+80103eec:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+80103ef0:	89 f2                	mov    %esi,%edx
+80103ef2:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+80103ef5:	0f b6 f2             	movzbl %dl,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103ef8:	89 fa                	mov    %edi,%edx
+80103efa:	89 45 b8             	mov    %eax,-0x48(%ebp)
+80103efd:	0f b6 45 b6          	movzbl -0x4a(%ebp),%eax
+80103f01:	89 75 c8             	mov    %esi,-0x38(%ebp)
+80103f04:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80103f07:	0f b6 45 b5          	movzbl -0x4b(%ebp),%eax
+80103f0b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+80103f0e:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+80103f12:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+80103f15:	31 c0                	xor    %eax,%eax
+80103f17:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103f18:	89 ca                	mov    %ecx,%edx
+80103f1a:	ec                   	in     (%dx),%al
+80103f1b:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103f1e:	89 fa                	mov    %edi,%edx
+80103f20:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80103f23:	b8 02 00 00 00       	mov    $0x2,%eax
+80103f28:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103f29:	89 ca                	mov    %ecx,%edx
+80103f2b:	ec                   	in     (%dx),%al
+80103f2c:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103f2f:	89 fa                	mov    %edi,%edx
+80103f31:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80103f34:	b8 04 00 00 00       	mov    $0x4,%eax
+80103f39:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103f3a:	89 ca                	mov    %ecx,%edx
+80103f3c:	ec                   	in     (%dx),%al
+80103f3d:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103f40:	89 fa                	mov    %edi,%edx
+80103f42:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80103f45:	b8 07 00 00 00       	mov    $0x7,%eax
+80103f4a:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103f4b:	89 ca                	mov    %ecx,%edx
+80103f4d:	ec                   	in     (%dx),%al
+80103f4e:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103f51:	89 fa                	mov    %edi,%edx
+80103f53:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80103f56:	b8 08 00 00 00       	mov    $0x8,%eax
+80103f5b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103f5c:	89 ca                	mov    %ecx,%edx
+80103f5e:	ec                   	in     (%dx),%al
+80103f5f:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103f62:	89 fa                	mov    %edi,%edx
+80103f64:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80103f67:	b8 09 00 00 00       	mov    $0x9,%eax
+80103f6c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103f6d:	89 ca                	mov    %ecx,%edx
+80103f6f:	ec                   	in     (%dx),%al
+80103f70:	0f b6 c0             	movzbl %al,%eax
+        continue;
+    fill_rtcdate(&t2);
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80103f73:	83 ec 04             	sub    $0x4,%esp
+  return inb(CMOS_RETURN);
+80103f76:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80103f79:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80103f7c:	6a 18                	push   $0x18
+80103f7e:	50                   	push   %eax
+80103f7f:	8d 45 b8             	lea    -0x48(%ebp),%eax
+80103f82:	50                   	push   %eax
+80103f83:	e8 f8 32 00 00       	call   80107280 <memcmp>
+80103f88:	83 c4 10             	add    $0x10,%esp
+80103f8b:	85 c0                	test   %eax,%eax
+80103f8d:	0f 85 f5 fe ff ff    	jne    80103e88 <cmostime+0x28>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80103f93:	0f b6 75 b3          	movzbl -0x4d(%ebp),%esi
+80103f97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103f9a:	89 f0                	mov    %esi,%eax
+80103f9c:	84 c0                	test   %al,%al
+80103f9e:	75 78                	jne    80104018 <cmostime+0x1b8>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80103fa0:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80103fa3:	89 c2                	mov    %eax,%edx
+80103fa5:	83 e0 0f             	and    $0xf,%eax
+80103fa8:	c1 ea 04             	shr    $0x4,%edx
+80103fab:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103fae:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103fb1:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    CONV(minute);
+80103fb4:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80103fb7:	89 c2                	mov    %eax,%edx
+80103fb9:	83 e0 0f             	and    $0xf,%eax
+80103fbc:	c1 ea 04             	shr    $0x4,%edx
+80103fbf:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103fc2:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103fc5:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    CONV(hour  );
+80103fc8:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80103fcb:	89 c2                	mov    %eax,%edx
+80103fcd:	83 e0 0f             	and    $0xf,%eax
+80103fd0:	c1 ea 04             	shr    $0x4,%edx
+80103fd3:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103fd6:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103fd9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    CONV(day   );
+80103fdc:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+80103fdf:	89 c2                	mov    %eax,%edx
+80103fe1:	83 e0 0f             	and    $0xf,%eax
+80103fe4:	c1 ea 04             	shr    $0x4,%edx
+80103fe7:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103fea:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103fed:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    CONV(month );
+80103ff0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80103ff3:	89 c2                	mov    %eax,%edx
+80103ff5:	83 e0 0f             	and    $0xf,%eax
+80103ff8:	c1 ea 04             	shr    $0x4,%edx
+80103ffb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103ffe:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104001:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    CONV(year  );
+80104004:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80104007:	89 c2                	mov    %eax,%edx
+80104009:	83 e0 0f             	and    $0xf,%eax
+8010400c:	c1 ea 04             	shr    $0x4,%edx
+8010400f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104012:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104015:	89 45 cc             	mov    %eax,-0x34(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+80104018:	8b 45 b8             	mov    -0x48(%ebp),%eax
+8010401b:	89 03                	mov    %eax,(%ebx)
+8010401d:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80104020:	89 43 04             	mov    %eax,0x4(%ebx)
+80104023:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80104026:	89 43 08             	mov    %eax,0x8(%ebx)
+80104029:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010402c:	89 43 0c             	mov    %eax,0xc(%ebx)
+8010402f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80104032:	89 43 10             	mov    %eax,0x10(%ebx)
+80104035:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80104038:	89 43 14             	mov    %eax,0x14(%ebx)
+  r->year += 2000;
+8010403b:	81 43 14 d0 07 00 00 	addl   $0x7d0,0x14(%ebx)
+}
+80104042:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104045:	5b                   	pop    %ebx
+80104046:	5e                   	pop    %esi
+80104047:	5f                   	pop    %edi
+80104048:	5d                   	pop    %ebp
+80104049:	c3                   	ret
+8010404a:	66 90                	xchg   %ax,%ax
+8010404c:	66 90                	xchg   %ax,%ax
+8010404e:	66 90                	xchg   %ax,%ax
+
+80104050 <logd>:
+// The log daemon: commit the open transaction once it has been
+// open COMMITTICKS, or begin_op() has run out of log space, and
+// no FS system call is running.
+static void
+logd(void)
+{
+80104050:	55                   	push   %ebp
+80104051:	89 e5                	mov    %esp,%ebp
+80104053:	57                   	push   %edi
+80104054:	56                   	push   %esi
+80104055:	53                   	push   %ebx
+80104056:	81 ec 88 00 00 00    	sub    $0x88,%esp
+  acquire(&log.lock);
+8010405c:	68 00 aa 17 80       	push   $0x8017aa00
+80104061:	e8 fa 2c 00 00       	call   80106d60 <acquire>
+80104066:	83 c4 10             	add    $0x10,%esp
+80104069:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(;;){
+    if(log.lh.n > 0 && ticks - log.opened >= COMMITTICKS)
+80104070:	a1 58 aa 17 80       	mov    0x8017aa58,%eax
+80104075:	85 c0                	test   %eax,%eax
+80104077:	0f 8e eb 03 00 00    	jle    80104468 <logd+0x418>
+8010407d:	a1 20 1b 1a 80       	mov    0x801a1b20,%eax
+80104082:	2b 05 4c aa 17 80    	sub    0x8017aa4c,%eax
+80104088:	83 f8 04             	cmp    $0x4,%eax
+8010408b:	0f 86 3f 04 00 00    	jbe    801044d0 <logd+0x480>
+      log.wanted = 1;
+80104091:	c7 05 44 aa 17 80 01 	movl   $0x1,0x8017aa44
+80104098:	00 00 00 
+    if(log.wanted && log.outstanding == 0){
+8010409b:	8b 3d 3c aa 17 80    	mov    0x8017aa3c,%edi
+801040a1:	85 ff                	test   %edi,%edi
+801040a3:	0f 85 f7 03 00 00    	jne    801044a0 <logd+0x450>
+  log.committing = 1;
+  log.wanted = 0;
+  log.clh = log.lh;
+  log.lh.n = 0;
+  seq = log.seq++;
+  statinc(ST_COMMIT);
+801040a9:	83 ec 0c             	sub    $0xc,%esp
+  log.clh = log.lh;
+801040ac:	b9 1f 00 00 00       	mov    $0x1f,%ecx
+801040b1:	bf d4 aa 17 80       	mov    $0x8017aad4,%edi
+  release(&log.lock);
+  for (tail = 0; tail < log.clh.n; tail++) {
+801040b6:	31 db                	xor    %ebx,%ebx
+  log.committing = 1;
+801040b8:	c7 05 40 aa 17 80 01 	movl   $0x1,0x8017aa40
+801040bf:	00 00 00 
+  log.clh = log.lh;
+801040c2:	be 58 aa 17 80       	mov    $0x8017aa58,%esi
+801040c7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  statinc(ST_COMMIT);
+801040c9:	6a 04                	push   $0x4
+  seq = log.seq++;
+801040cb:	8b 3d 50 aa 17 80    	mov    0x8017aa50,%edi
+  log.wanted = 0;
+801040d1:	c7 05 44 aa 17 80 00 	movl   $0x0,0x8017aa44
+801040d8:	00 00 00 
+  log.lh.n = 0;
+801040db:	c7 05 58 aa 17 80 00 	movl   $0x0,0x8017aa58
+801040e2:	00 00 00 
+  seq = log.seq++;
+801040e5:	8d 47 01             	lea    0x1(%edi),%eax
+801040e8:	a3 50 aa 17 80       	mov    %eax,0x8017aa50
+  statinc(ST_COMMIT);
+801040ed:	e8 0e 31 00 00       	call   80107200 <statinc>
+  release(&log.lock);
+801040f2:	c7 04 24 00 aa 17 80 	movl   $0x8017aa00,(%esp)
+801040f9:	e8 82 2e 00 00       	call   80106f80 <release>
+  for (tail = 0; tail < log.clh.n; tail++) {
+801040fe:	8b 35 d4 aa 17 80    	mov    0x8017aad4,%esi
+80104104:	83 c4 10             	add    $0x10,%esp
+80104107:	85 f6                	test   %esi,%esi
+80104109:	7e 4d                	jle    80104158 <logd+0x108>
+8010410b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010410f:	90                   	nop
+    b = bread(log.dev, log.clh.block[tail]);
+80104110:	83 ec 08             	sub    $0x8,%esp
+80104113:	ff 34 9d d8 aa 17 80 	push   -0x7fe85528(,%ebx,4)
+8010411a:	ff 35 48 aa 17 80    	push   0x8017aa48
+80104120:	e8 ab c7 ff ff       	call   801008d0 <bread>
+    memmove(logdata[tail], b->data, BSIZE);
+80104125:	83 c4 0c             	add    $0xc,%esp
+80104128:	68 00 02 00 00       	push   $0x200
+    b = bread(log.dev, log.clh.block[tail]);
+8010412d:	89 c6                	mov    %eax,%esi
+    memmove(logdata[tail], b->data, BSIZE);
+8010412f:	ff 70 64             	push   0x64(%eax)
+80104132:	89 d8                	mov    %ebx,%eax
+  for (tail = 0; tail < log.clh.n; tail++) {
+80104134:	83 c3 01             	add    $0x1,%ebx
+    memmove(logdata[tail], b->data, BSIZE);
+80104137:	c1 e0 09             	shl    $0x9,%eax
+8010413a:	05 60 ab 17 80       	add    $0x8017ab60,%eax
+8010413f:	50                   	push   %eax
+80104140:	e8 8b 31 00 00       	call   801072d0 <memmove>
+    brelse(b);
+80104145:	89 34 24             	mov    %esi,(%esp)
+80104148:	e8 d3 c8 ff ff       	call   80100a20 <brelse>
+  for (tail = 0; tail < log.clh.n; tail++) {
+8010414d:	83 c4 10             	add    $0x10,%esp
+80104150:	3b 1d d4 aa 17 80    	cmp    0x8017aad4,%ebx
+80104156:	7c b8                	jl     80104110 <logd+0xc0>
+  }
+  acquire(&log.lock);
+80104158:	83 ec 0c             	sub    $0xc,%esp
+  for (tail = 0; tail < log.clh.n; tail++)
+8010415b:	31 db                	xor    %ebx,%ebx
+  acquire(&log.lock);
+8010415d:	68 00 aa 17 80       	push   $0x8017aa00
+80104162:	e8 f9 2b 00 00       	call   80106d60 <acquire>
+  log.committing = 0;
+  wakeup(&log);
+80104167:	c7 04 24 00 aa 17 80 	movl   $0x8017aa00,(%esp)
+  log.committing = 0;
+8010416e:	c7 05 40 aa 17 80 00 	movl   $0x0,0x8017aa40
+80104175:	00 00 00 
+  wakeup(&log);
+80104178:	e8 63 25 00 00       	call   801066e0 <wakeup>
+  release(&log.lock);
+8010417d:	c7 04 24 00 aa 17 80 	movl   $0x8017aa00,(%esp)
+80104184:	e8 f7 2d 00 00       	call   80106f80 <release>
+  for (tail = 0; tail < log.clh.n; tail++)
+80104189:	a1 d4 aa 17 80       	mov    0x8017aad4,%eax
+8010418e:	83 c4 10             	add    $0x10,%esp
+80104191:	85 c0                	test   %eax,%eax
+80104193:	0f 8e 96 03 00 00    	jle    8010452f <logd+0x4df>
+80104199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  memset(&b, 0, sizeof(b));
+801041a0:	83 ec 04             	sub    $0x4,%esp
+801041a3:	8d 45 80             	lea    -0x80(%ebp),%eax
+    logrw(log.start+tail+1, logdata[tail], 1);  // write the log
+801041a6:	8b 35 34 aa 17 80    	mov    0x8017aa34,%esi
+  memset(&b, 0, sizeof(b));
+801041ac:	6a 68                	push   $0x68
+801041ae:	6a 00                	push   $0x0
+    logrw(log.start+tail+1, logdata[tail], 1);  // write the log
+801041b0:	01 de                	add    %ebx,%esi
+  memset(&b, 0, sizeof(b));
+801041b2:	50                   	push   %eax
+    logrw(log.start+tail+1, logdata[tail], 1);  // write the log
+801041b3:	83 c6 01             	add    $0x1,%esi
+  memset(&b, 0, sizeof(b));
+801041b6:	e8 85 30 00 00       	call   80107240 <memset>
+  initsleeplock(&b.lock, "logbuf");
+801041bb:	58                   	pop    %eax
+801041bc:	8d 45 8c             	lea    -0x74(%ebp),%eax
+801041bf:	5a                   	pop    %edx
+801041c0:	68 1c b9 10 80       	push   $0x8010b91c
+801041c5:	50                   	push   %eax
+801041c6:	e8 65 2a 00 00       	call   80106c30 <initsleeplock>
+  b.dev = log.dev;
+801041cb:	a1 48 aa 17 80       	mov    0x8017aa48,%eax
+  b.blockno = blockno;
+801041d0:	89 75 88             	mov    %esi,-0x78(%ebp)
+  b.flags = write ? B_DIRTY : 0;
+801041d3:	c7 45 80 04 00 00 00 	movl   $0x4,-0x80(%ebp)
+  b.dev = log.dev;
+801041da:	89 45 84             	mov    %eax,-0x7c(%ebp)
+    logrw(log.start+tail+1, logdata[tail], 1);  // write the log
+801041dd:	89 d8                	mov    %ebx,%eax
+  for (tail = 0; tail < log.clh.n; tail++)
+801041df:	83 c3 01             	add    $0x1,%ebx
+    logrw(log.start+tail+1, logdata[tail], 1);  // write the log
+801041e2:	c1 e0 09             	shl    $0x9,%eax
+801041e5:	05 60 ab 17 80       	add    $0x8017ab60,%eax
+801041ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  acquiresleep(&b.lock);
+801041ed:	8d 45 8c             	lea    -0x74(%ebp),%eax
+801041f0:	89 04 24             	mov    %eax,(%esp)
+801041f3:	e8 78 2a 00 00       	call   80106c70 <acquiresleep>
+  iderw(&b);
+801041f8:	8d 45 80             	lea    -0x80(%ebp),%eax
+801041fb:	89 04 24             	mov    %eax,(%esp)
+801041fe:	e8 5d f0 ff ff       	call   80103260 <iderw>
+  releasesleep(&b.lock);
+80104203:	8d 45 8c             	lea    -0x74(%ebp),%eax
+80104206:	89 04 24             	mov    %eax,(%esp)
+80104209:	e8 c2 2a 00 00       	call   80106cd0 <releasesleep>
+  for (tail = 0; tail < log.clh.n; tail++)
+8010420e:	8b 15 d4 aa 17 80    	mov    0x8017aad4,%edx
+80104214:	83 c4 10             	add    $0x10,%esp
+80104217:	39 d3                	cmp    %edx,%ebx
+80104219:	7c 85                	jl     801041a0 <logd+0x150>
+  hb->n = log.clh.n;
+8010421b:	89 15 60 e7 17 80    	mov    %edx,0x8017e760
+  for (i = 0; i < log.clh.n; i++) {
+80104221:	31 c0                	xor    %eax,%eax
+80104223:	85 d2                	test   %edx,%edx
+80104225:	7e 1e                	jle    80104245 <logd+0x1f5>
+80104227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010422e:	66 90                	xchg   %ax,%ax
+    hb->block[i] = log.clh.block[i];
+80104230:	8b 0c 85 d8 aa 17 80 	mov    -0x7fe85528(,%eax,4),%ecx
+80104237:	89 0c 85 64 e7 17 80 	mov    %ecx,-0x7fe8189c(,%eax,4)
+  for (i = 0; i < log.clh.n; i++) {
+8010423e:	83 c0 01             	add    $0x1,%eax
+80104241:	39 d0                	cmp    %edx,%eax
+80104243:	75 eb                	jne    80104230 <logd+0x1e0>
+  memset(&b, 0, sizeof(b));
+80104245:	83 ec 04             	sub    $0x4,%esp
+80104248:	8d 45 80             	lea    -0x80(%ebp),%eax
+  logrw(log.start, loghead, 1);
+8010424b:	8b 1d 34 aa 17 80    	mov    0x8017aa34,%ebx
+  memset(&b, 0, sizeof(b));
+80104251:	6a 68                	push   $0x68
+80104253:	6a 00                	push   $0x0
+80104255:	50                   	push   %eax
+80104256:	e8 e5 2f 00 00       	call   80107240 <memset>
+  initsleeplock(&b.lock, "logbuf");
+8010425b:	8d 45 8c             	lea    -0x74(%ebp),%eax
+8010425e:	59                   	pop    %ecx
+8010425f:	5e                   	pop    %esi
+80104260:	68 1c b9 10 80       	push   $0x8010b91c
+80104265:	50                   	push   %eax
+80104266:	e8 c5 29 00 00       	call   80106c30 <initsleeplock>
+  b.dev = log.dev;
+8010426b:	a1 48 aa 17 80       	mov    0x8017aa48,%eax
+  b.blockno = blockno;
+80104270:	89 5d 88             	mov    %ebx,-0x78(%ebp)
+  for (tail = 0; tail < log.clh.n; tail++)
+80104273:	31 db                	xor    %ebx,%ebx
+  b.data = data;
+80104275:	c7 45 e4 60 e7 17 80 	movl   $0x8017e760,-0x1c(%ebp)
+  b.dev = log.dev;
+8010427c:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  acquiresleep(&b.lock);
+8010427f:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  b.flags = write ? B_DIRTY : 0;
+80104282:	c7 45 80 04 00 00 00 	movl   $0x4,-0x80(%ebp)
+  acquiresleep(&b.lock);
+80104289:	89 04 24             	mov    %eax,(%esp)
+8010428c:	e8 df 29 00 00       	call   80106c70 <acquiresleep>
+  iderw(&b);
+80104291:	8d 45 80             	lea    -0x80(%ebp),%eax
+80104294:	89 04 24             	mov    %eax,(%esp)
+80104297:	e8 c4 ef ff ff       	call   80103260 <iderw>
+  releasesleep(&b.lock);
+8010429c:	8d 45 8c             	lea    -0x74(%ebp),%eax
+8010429f:	89 04 24             	mov    %eax,(%esp)
+801042a2:	e8 29 2a 00 00       	call   80106cd0 <releasesleep>
+  for (tail = 0; tail < log.clh.n; tail++)
+801042a7:	a1 d4 aa 17 80       	mov    0x8017aad4,%eax
+801042ac:	83 c4 10             	add    $0x10,%esp
+801042af:	85 c0                	test   %eax,%eax
+801042b1:	0f 8e 08 01 00 00    	jle    801043bf <logd+0x36f>
+801042b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801042be:	66 90                	xchg   %ax,%ax
+  memset(&b, 0, sizeof(b));
+801042c0:	83 ec 04             	sub    $0x4,%esp
+801042c3:	8d 45 80             	lea    -0x80(%ebp),%eax
+    logrw(log.clh.block[tail], logdata[tail], 1);  // write dst to disk
+801042c6:	8b 34 9d d8 aa 17 80 	mov    -0x7fe85528(,%ebx,4),%esi
+  memset(&b, 0, sizeof(b));
+801042cd:	6a 68                	push   $0x68
+801042cf:	6a 00                	push   $0x0
+801042d1:	50                   	push   %eax
+801042d2:	e8 69 2f 00 00       	call   80107240 <memset>
+  initsleeplock(&b.lock, "logbuf");
+801042d7:	59                   	pop    %ecx
+801042d8:	58                   	pop    %eax
+801042d9:	8d 45 8c             	lea    -0x74(%ebp),%eax
+801042dc:	68 1c b9 10 80       	push   $0x8010b91c
+801042e1:	50                   	push   %eax
+801042e2:	e8 49 29 00 00       	call   80106c30 <initsleeplock>
+  b.dev = log.dev;
+801042e7:	a1 48 aa 17 80       	mov    0x8017aa48,%eax
+  b.blockno = blockno;
+801042ec:	89 75 88             	mov    %esi,-0x78(%ebp)
+  b.flags = write ? B_DIRTY : 0;
+801042ef:	c7 45 80 04 00 00 00 	movl   $0x4,-0x80(%ebp)
+  b.dev = log.dev;
+801042f6:	89 45 84             	mov    %eax,-0x7c(%ebp)
+    logrw(log.clh.block[tail], logdata[tail], 1);  // write dst to disk
+801042f9:	89 d8                	mov    %ebx,%eax
+  for (tail = 0; tail < log.clh.n; tail++)
+801042fb:	83 c3 01             	add    $0x1,%ebx
+    logrw(log.clh.block[tail], logdata[tail], 1);  // write dst to disk
+801042fe:	c1 e0 09             	shl    $0x9,%eax
+80104301:	05 60 ab 17 80       	add    $0x8017ab60,%eax
+80104306:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  acquiresleep(&b.lock);
+80104309:	8d 45 8c             	lea    -0x74(%ebp),%eax
+8010430c:	89 04 24             	mov    %eax,(%esp)
+8010430f:	e8 5c 29 00 00       	call   80106c70 <acquiresleep>
+  iderw(&b);
+80104314:	8d 45 80             	lea    -0x80(%ebp),%eax
+80104317:	89 04 24             	mov    %eax,(%esp)
+8010431a:	e8 41 ef ff ff       	call   80103260 <iderw>
+  releasesleep(&b.lock);
+8010431f:	8d 45 8c             	lea    -0x74(%ebp),%eax
+80104322:	89 04 24             	mov    %eax,(%esp)
+80104325:	e8 a6 29 00 00       	call   80106cd0 <releasesleep>
+  for (tail = 0; tail < log.clh.n; tail++)
+8010432a:	a1 d4 aa 17 80       	mov    0x8017aad4,%eax
+8010432f:	83 c4 10             	add    $0x10,%esp
+80104332:	39 c3                	cmp    %eax,%ebx
+80104334:	7c 8a                	jl     801042c0 <logd+0x270>
+  for (tail = 0; tail < log.clh.n; tail++) {
+80104336:	85 c0                	test   %eax,%eax
+80104338:	0f 8e 81 00 00 00    	jle    801043bf <logd+0x36f>
+8010433e:	31 f6                	xor    %esi,%esi
+    b = bread(log.dev, log.clh.block[tail]);
+80104340:	83 ec 08             	sub    $0x8,%esp
+80104343:	ff 34 b5 d8 aa 17 80 	push   -0x7fe85528(,%esi,4)
+8010434a:	ff 35 48 aa 17 80    	push   0x8017aa48
+80104350:	e8 7b c5 ff ff       	call   801008d0 <bread>
+    acquire(&log.lock);
+80104355:	c7 04 24 00 aa 17 80 	movl   $0x8017aa00,(%esp)
+    b = bread(log.dev, log.clh.block[tail]);
+8010435c:	89 c3                	mov    %eax,%ebx
+    acquire(&log.lock);
+8010435e:	e8 fd 29 00 00       	call   80106d60 <acquire>
+    for (i = 0; i < log.lh.n; i++)
+80104363:	8b 15 58 aa 17 80    	mov    0x8017aa58,%edx
+80104369:	83 c4 10             	add    $0x10,%esp
+8010436c:	85 d2                	test   %edx,%edx
+8010436e:	0f 8e b4 01 00 00    	jle    80104528 <logd+0x4d8>
+      if (log.lh.block[i] == b->blockno)
+80104374:	8b 4b 08             	mov    0x8(%ebx),%ecx
+    for (i = 0; i < log.lh.n; i++)
+80104377:	31 c0                	xor    %eax,%eax
+80104379:	eb 10                	jmp    8010438b <logd+0x33b>
+8010437b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010437f:	90                   	nop
+80104380:	83 c0 01             	add    $0x1,%eax
+80104383:	39 d0                	cmp    %edx,%eax
+80104385:	0f 84 35 01 00 00    	je     801044c0 <logd+0x470>
+      if (log.lh.block[i] == b->blockno)
+8010438b:	39 0c 85 5c aa 17 80 	cmp    %ecx,-0x7fe855a4(,%eax,4)
+80104392:	75 ec                	jne    80104380 <logd+0x330>
+    if (i == log.lh.n)
+80104394:	39 d0                	cmp    %edx,%eax
+80104396:	0f 84 24 01 00 00    	je     801044c0 <logd+0x470>
+    release(&log.lock);
+8010439c:	83 ec 0c             	sub    $0xc,%esp
+  for (tail = 0; tail < log.clh.n; tail++) {
+8010439f:	83 c6 01             	add    $0x1,%esi
+    release(&log.lock);
+801043a2:	68 00 aa 17 80       	push   $0x8017aa00
+801043a7:	e8 d4 2b 00 00       	call   80106f80 <release>
+    brelse(b);
+801043ac:	89 1c 24             	mov    %ebx,(%esp)
+801043af:	e8 6c c6 ff ff       	call   80100a20 <brelse>
+  for (tail = 0; tail < log.clh.n; tail++) {
+801043b4:	83 c4 10             	add    $0x10,%esp
+801043b7:	3b 35 d4 aa 17 80    	cmp    0x8017aad4,%esi
+801043bd:	7c 81                	jl     80104340 <logd+0x2f0>
+  memset(&b, 0, sizeof(b));
+801043bf:	83 ec 04             	sub    $0x4,%esp
+801043c2:	8d 45 80             	lea    -0x80(%ebp),%eax
+  logrw(log.start, loghead, 1);
+801043c5:	8b 1d 34 aa 17 80    	mov    0x8017aa34,%ebx
+
+  write_log();     // Write modified blocks from snapshot to log
+  write_head();    // Write header to disk -- the real commit
+  install_trans(); // Now install writes to home locations
+  unpin();
+  log.clh.n = 0;
+801043cb:	c7 05 d4 aa 17 80 00 	movl   $0x0,0x8017aad4
+801043d2:	00 00 00 
+  memset(&b, 0, sizeof(b));
+801043d5:	6a 68                	push   $0x68
+801043d7:	6a 00                	push   $0x0
+801043d9:	50                   	push   %eax
+  hb->n = log.clh.n;
+801043da:	c7 05 60 e7 17 80 00 	movl   $0x0,0x8017e760
+801043e1:	00 00 00 
+  memset(&b, 0, sizeof(b));
+801043e4:	e8 57 2e 00 00       	call   80107240 <memset>
+  initsleeplock(&b.lock, "logbuf");
+801043e9:	58                   	pop    %eax
+801043ea:	8d 45 8c             	lea    -0x74(%ebp),%eax
+801043ed:	5a                   	pop    %edx
+801043ee:	68 1c b9 10 80       	push   $0x8010b91c
+801043f3:	50                   	push   %eax
+801043f4:	e8 37 28 00 00       	call   80106c30 <initsleeplock>
+  b.dev = log.dev;
+801043f9:	a1 48 aa 17 80       	mov    0x8017aa48,%eax
+  b.blockno = blockno;
+801043fe:	89 5d 88             	mov    %ebx,-0x78(%ebp)
+  b.data = data;
+80104401:	c7 45 e4 60 e7 17 80 	movl   $0x8017e760,-0x1c(%ebp)
+  b.dev = log.dev;
+80104408:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  acquiresleep(&b.lock);
+8010440b:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  b.flags = write ? B_DIRTY : 0;
+8010440e:	c7 45 80 04 00 00 00 	movl   $0x4,-0x80(%ebp)
+  acquiresleep(&b.lock);
+80104415:	89 04 24             	mov    %eax,(%esp)
+80104418:	e8 53 28 00 00       	call   80106c70 <acquiresleep>
+  iderw(&b);
+8010441d:	8d 45 80             	lea    -0x80(%ebp),%eax
+80104420:	89 04 24             	mov    %eax,(%esp)
+80104423:	e8 38 ee ff ff       	call   80103260 <iderw>
+  releasesleep(&b.lock);
+80104428:	8d 45 8c             	lea    -0x74(%ebp),%eax
+8010442b:	89 04 24             	mov    %eax,(%esp)
+8010442e:	e8 9d 28 00 00       	call   80106cd0 <releasesleep>
+  write_head();    // Erase the transaction from the log
+
+  acquire(&log.lock);
+80104433:	c7 04 24 00 aa 17 80 	movl   $0x8017aa00,(%esp)
+8010443a:	e8 21 29 00 00       	call   80106d60 <acquire>
+  log.done = seq;
+  wakeup(&log.done);
+8010443f:	c7 04 24 54 aa 17 80 	movl   $0x8017aa54,(%esp)
+  log.done = seq;
+80104446:	89 3d 54 aa 17 80    	mov    %edi,0x8017aa54
+  wakeup(&log.done);
+8010444c:	e8 8f 22 00 00       	call   801066e0 <wakeup>
+    if(log.lh.n > 0 && ticks - log.opened >= COMMITTICKS)
+80104451:	a1 58 aa 17 80       	mov    0x8017aa58,%eax
+}
+80104456:	83 c4 10             	add    $0x10,%esp
+    if(log.lh.n > 0 && ticks - log.opened >= COMMITTICKS)
+80104459:	85 c0                	test   %eax,%eax
+8010445b:	0f 8f 1c fc ff ff    	jg     8010407d <logd+0x2d>
+80104461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(log.wanted && log.outstanding == 0){
+80104468:	a1 44 aa 17 80       	mov    0x8017aa44,%eax
+8010446d:	85 c0                	test   %eax,%eax
+8010446f:	74 2f                	je     801044a0 <logd+0x450>
+80104471:	a1 3c aa 17 80       	mov    0x8017aa3c,%eax
+80104476:	85 c0                	test   %eax,%eax
+80104478:	75 26                	jne    801044a0 <logd+0x450>
+        log.wanted = 0;
+8010447a:	c7 05 44 aa 17 80 00 	movl   $0x0,0x8017aa44
+80104481:	00 00 00 
+        wakeup(&log);
+80104484:	83 ec 0c             	sub    $0xc,%esp
+80104487:	68 00 aa 17 80       	push   $0x8017aa00
+8010448c:	e8 4f 22 00 00       	call   801066e0 <wakeup>
+80104491:	83 c4 10             	add    $0x10,%esp
+80104494:	e9 d7 fb ff ff       	jmp    80104070 <logd+0x20>
+80104499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      sleep(&log.lh, &log.lock);
+801044a0:	83 ec 08             	sub    $0x8,%esp
+801044a3:	68 00 aa 17 80       	push   $0x8017aa00
+801044a8:	68 58 aa 17 80       	push   $0x8017aa58
+801044ad:	e8 5e 20 00 00       	call   80106510 <sleep>
+801044b2:	83 c4 10             	add    $0x10,%esp
+801044b5:	e9 b6 fb ff ff       	jmp    80104070 <logd+0x20>
+801044ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      b->flags &= ~B_DIRTY;
+801044c0:	83 23 fb             	andl   $0xfffffffb,(%ebx)
+801044c3:	e9 d4 fe ff ff       	jmp    8010439c <logd+0x34c>
+801044c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801044cf:	90                   	nop
+    if(log.wanted && log.outstanding == 0){
+801044d0:	8b 0d 44 aa 17 80    	mov    0x8017aa44,%ecx
+801044d6:	85 c9                	test   %ecx,%ecx
+801044d8:	0f 85 bd fb ff ff    	jne    8010409b <logd+0x4b>
+      release(&log.lock);
+801044de:	83 ec 0c             	sub    $0xc,%esp
+801044e1:	68 00 aa 17 80       	push   $0x8017aa00
+801044e6:	e8 95 2a 00 00       	call   80106f80 <release>
+      acquire(&tickslock);
+801044eb:	c7 04 24 40 1b 1a 80 	movl   $0x801a1b40,(%esp)
+801044f2:	e8 69 28 00 00       	call   80106d60 <acquire>
+      sleep(&ticks, &tickslock);
+801044f7:	58                   	pop    %eax
+801044f8:	5a                   	pop    %edx
+801044f9:	68 40 1b 1a 80       	push   $0x801a1b40
+801044fe:	68 20 1b 1a 80       	push   $0x801a1b20
+80104503:	e8 08 20 00 00       	call   80106510 <sleep>
+      release(&tickslock);
+80104508:	c7 04 24 40 1b 1a 80 	movl   $0x801a1b40,(%esp)
+8010450f:	e8 6c 2a 00 00       	call   80106f80 <release>
+      acquire(&log.lock);
+80104514:	c7 04 24 00 aa 17 80 	movl   $0x8017aa00,(%esp)
+8010451b:	e8 40 28 00 00       	call   80106d60 <acquire>
+80104520:	83 c4 10             	add    $0x10,%esp
+80104523:	e9 48 fb ff ff       	jmp    80104070 <logd+0x20>
+    for (i = 0; i < log.lh.n; i++)
+80104528:	31 c0                	xor    %eax,%eax
+8010452a:	e9 65 fe ff ff       	jmp    80104394 <logd+0x344>
+  hb->n = log.clh.n;
+8010452f:	a3 60 e7 17 80       	mov    %eax,0x8017e760
+  for (i = 0; i < log.clh.n; i++) {
+80104534:	e9 0c fd ff ff       	jmp    80104245 <logd+0x1f5>
+80104539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104540 <initlog>:
+{
+80104540:	55                   	push   %ebp
+80104541:	89 e5                	mov    %esp,%ebp
+80104543:	57                   	push   %edi
+80104544:	56                   	push   %esi
+  memset(&b, 0, sizeof(b));
+80104545:	8d 7d 80             	lea    -0x80(%ebp),%edi
+{
+80104548:	53                   	push   %ebx
+80104549:	81 ec b4 00 00 00    	sub    $0xb4,%esp
+8010454f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+80104552:	68 23 b9 10 80       	push   $0x8010b923
+80104557:	68 00 aa 17 80       	push   $0x8017aa00
+8010455c:	e8 df 27 00 00       	call   80106d40 <initlock>
+  readsb(dev, &sb);
+80104561:	58                   	pop    %eax
+80104562:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+80104568:	5a                   	pop    %edx
+80104569:	50                   	push   %eax
+8010456a:	53                   	push   %ebx
+8010456b:	e8 70 d9 ff ff       	call   80101ee0 <readsb>
+  log.start = sb.logstart;
+80104570:	8b b5 6c ff ff ff    	mov    -0x94(%ebp),%esi
+  memset(&b, 0, sizeof(b));
+80104576:	83 c4 0c             	add    $0xc,%esp
+  log.size = sb.nlog;
+80104579:	8b 85 68 ff ff ff    	mov    -0x98(%ebp),%eax
+  log.dev = dev;
+8010457f:	89 1d 48 aa 17 80    	mov    %ebx,0x8017aa48
+  log.start = sb.logstart;
+80104585:	89 35 34 aa 17 80    	mov    %esi,0x8017aa34
+  log.size = sb.nlog;
+8010458b:	a3 38 aa 17 80       	mov    %eax,0x8017aa38
+  log.seq = 1;
+80104590:	c7 05 50 aa 17 80 01 	movl   $0x1,0x8017aa50
+80104597:	00 00 00 
+  memset(&b, 0, sizeof(b));
+8010459a:	6a 68                	push   $0x68
+8010459c:	6a 00                	push   $0x0
+8010459e:	57                   	push   %edi
+8010459f:	e8 9c 2c 00 00       	call   80107240 <memset>
+  initsleeplock(&b.lock, "logbuf");
+801045a4:	59                   	pop    %ecx
+801045a5:	5b                   	pop    %ebx
+801045a6:	8d 5d 8c             	lea    -0x74(%ebp),%ebx
+801045a9:	68 1c b9 10 80       	push   $0x8010b91c
+801045ae:	53                   	push   %ebx
+801045af:	e8 7c 26 00 00       	call   80106c30 <initsleeplock>
+  b.dev = log.dev;
+801045b4:	a1 48 aa 17 80       	mov    0x8017aa48,%eax
+  b.blockno = blockno;
+801045b9:	89 75 88             	mov    %esi,-0x78(%ebp)
+  b.data = data;
+801045bc:	c7 45 e4 60 e7 17 80 	movl   $0x8017e760,-0x1c(%ebp)
+  b.dev = log.dev;
+801045c3:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  b.flags = write ? B_DIRTY : 0;
+801045c6:	c7 45 80 00 00 00 00 	movl   $0x0,-0x80(%ebp)
+  acquiresleep(&b.lock);
+801045cd:	89 1c 24             	mov    %ebx,(%esp)
+801045d0:	e8 9b 26 00 00       	call   80106c70 <acquiresleep>
+  iderw(&b);
+801045d5:	89 3c 24             	mov    %edi,(%esp)
+801045d8:	e8 83 ec ff ff       	call   80103260 <iderw>
+  releasesleep(&b.lock);
+801045dd:	89 1c 24             	mov    %ebx,(%esp)
+801045e0:	e8 eb 26 00 00       	call   80106cd0 <releasesleep>
+  log.clh.n = lh->n;
+801045e5:	8b 0d 60 e7 17 80    	mov    0x8017e760,%ecx
+  for (i = 0; i < log.clh.n; i++) {
+801045eb:	83 c4 10             	add    $0x10,%esp
+  log.clh.n = lh->n;
+801045ee:	89 0d d4 aa 17 80    	mov    %ecx,0x8017aad4
+  for (i = 0; i < log.clh.n; i++) {
+801045f4:	85 c9                	test   %ecx,%ecx
+801045f6:	0f 8e 16 01 00 00    	jle    80104712 <initlog+0x1d2>
+801045fc:	31 c0                	xor    %eax,%eax
+801045fe:	66 90                	xchg   %ax,%ax
+    log.clh.block[i] = lh->block[i];
+80104600:	8b 14 85 64 e7 17 80 	mov    -0x7fe8189c(,%eax,4),%edx
+80104607:	89 14 85 d8 aa 17 80 	mov    %edx,-0x7fe85528(,%eax,4)
+  for (i = 0; i < log.clh.n; i++) {
+8010460e:	83 c0 01             	add    $0x1,%eax
+80104611:	39 c1                	cmp    %eax,%ecx
+80104613:	75 eb                	jne    80104600 <initlog+0xc0>
+  for (tail = 0; tail < log.clh.n; tail++)
+80104615:	31 f6                	xor    %esi,%esi
+80104617:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010461e:	66 90                	xchg   %ax,%ax
+    logrw(log.start+tail+1, logdata[tail], 0);  // read log block
+80104620:	a1 34 aa 17 80       	mov    0x8017aa34,%eax
+  memset(&b, 0, sizeof(b));
+80104625:	83 ec 04             	sub    $0x4,%esp
+    logrw(log.start+tail+1, logdata[tail], 0);  // read log block
+80104628:	01 f0                	add    %esi,%eax
+8010462a:	83 c0 01             	add    $0x1,%eax
+8010462d:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  memset(&b, 0, sizeof(b));
+80104633:	6a 68                	push   $0x68
+80104635:	6a 00                	push   $0x0
+80104637:	57                   	push   %edi
+80104638:	e8 03 2c 00 00       	call   80107240 <memset>
+  initsleeplock(&b.lock, "logbuf");
+8010463d:	59                   	pop    %ecx
+8010463e:	58                   	pop    %eax
+8010463f:	68 1c b9 10 80       	push   $0x8010b91c
+80104644:	53                   	push   %ebx
+80104645:	e8 e6 25 00 00       	call   80106c30 <initsleeplock>
+  b.dev = log.dev;
+8010464a:	a1 48 aa 17 80       	mov    0x8017aa48,%eax
+  b.flags = write ? B_DIRTY : 0;
+8010464f:	c7 45 80 00 00 00 00 	movl   $0x0,-0x80(%ebp)
+  b.dev = log.dev;
+80104656:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  b.blockno = blockno;
+80104659:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+8010465f:	89 45 88             	mov    %eax,-0x78(%ebp)
+    logrw(log.start+tail+1, logdata[tail], 0);  // read log block
+80104662:	89 f0                	mov    %esi,%eax
+  for (tail = 0; tail < log.clh.n; tail++)
+80104664:	83 c6 01             	add    $0x1,%esi
+    logrw(log.start+tail+1, logdata[tail], 0);  // read log block
+80104667:	c1 e0 09             	shl    $0x9,%eax
+8010466a:	05 60 ab 17 80       	add    $0x8017ab60,%eax
+8010466f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  acquiresleep(&b.lock);
+80104672:	89 1c 24             	mov    %ebx,(%esp)
+80104675:	e8 f6 25 00 00       	call   80106c70 <acquiresleep>
+  iderw(&b);
+8010467a:	89 3c 24             	mov    %edi,(%esp)
+8010467d:	e8 de eb ff ff       	call   80103260 <iderw>
+  releasesleep(&b.lock);
+80104682:	89 1c 24             	mov    %ebx,(%esp)
+80104685:	e8 46 26 00 00       	call   80106cd0 <releasesleep>
+  for (tail = 0; tail < log.clh.n; tail++)
+8010468a:	a1 d4 aa 17 80       	mov    0x8017aad4,%eax
+8010468f:	83 c4 10             	add    $0x10,%esp
+80104692:	39 c6                	cmp    %eax,%esi
+80104694:	7c 8a                	jl     80104620 <initlog+0xe0>
+  for (tail = 0; tail < log.clh.n; tail++)
+80104696:	85 c0                	test   %eax,%eax
+80104698:	7e 78                	jle    80104712 <initlog+0x1d2>
+8010469a:	31 f6                	xor    %esi,%esi
+8010469c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    logrw(log.clh.block[tail], logdata[tail], 1);  // write dst to disk
+801046a0:	8b 14 b5 d8 aa 17 80 	mov    -0x7fe85528(,%esi,4),%edx
+  memset(&b, 0, sizeof(b));
+801046a7:	83 ec 04             	sub    $0x4,%esp
+    logrw(log.clh.block[tail], logdata[tail], 1);  // write dst to disk
+801046aa:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+  memset(&b, 0, sizeof(b));
+801046b0:	6a 68                	push   $0x68
+801046b2:	6a 00                	push   $0x0
+801046b4:	57                   	push   %edi
+801046b5:	e8 86 2b 00 00       	call   80107240 <memset>
+  initsleeplock(&b.lock, "logbuf");
+801046ba:	58                   	pop    %eax
+801046bb:	5a                   	pop    %edx
+801046bc:	68 1c b9 10 80       	push   $0x8010b91c
+801046c1:	53                   	push   %ebx
+801046c2:	e8 69 25 00 00       	call   80106c30 <initsleeplock>
+  b.dev = log.dev;
+801046c7:	a1 48 aa 17 80       	mov    0x8017aa48,%eax
+  b.blockno = blockno;
+801046cc:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  b.flags = write ? B_DIRTY : 0;
+801046d2:	c7 45 80 04 00 00 00 	movl   $0x4,-0x80(%ebp)
+  b.dev = log.dev;
+801046d9:	89 45 84             	mov    %eax,-0x7c(%ebp)
+    logrw(log.clh.block[tail], logdata[tail], 1);  // write dst to disk
+801046dc:	89 f0                	mov    %esi,%eax
+  for (tail = 0; tail < log.clh.n; tail++)
+801046de:	83 c6 01             	add    $0x1,%esi
+    logrw(log.clh.block[tail], logdata[tail], 1);  // write dst to disk
+801046e1:	c1 e0 09             	shl    $0x9,%eax
+  b.blockno = blockno;
+801046e4:	89 55 88             	mov    %edx,-0x78(%ebp)
+    logrw(log.clh.block[tail], logdata[tail], 1);  // write dst to disk
+801046e7:	05 60 ab 17 80       	add    $0x8017ab60,%eax
+801046ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  acquiresleep(&b.lock);
+801046ef:	89 1c 24             	mov    %ebx,(%esp)
+801046f2:	e8 79 25 00 00       	call   80106c70 <acquiresleep>
+  iderw(&b);
+801046f7:	89 3c 24             	mov    %edi,(%esp)
+801046fa:	e8 61 eb ff ff       	call   80103260 <iderw>
+  releasesleep(&b.lock);
+801046ff:	89 1c 24             	mov    %ebx,(%esp)
+80104702:	e8 c9 25 00 00       	call   80106cd0 <releasesleep>
+  for (tail = 0; tail < log.clh.n; tail++)
+80104707:	83 c4 10             	add    $0x10,%esp
+8010470a:	3b 35 d4 aa 17 80    	cmp    0x8017aad4,%esi
+80104710:	7c 8e                	jl     801046a0 <initlog+0x160>
+  memset(&b, 0, sizeof(b));
+80104712:	83 ec 04             	sub    $0x4,%esp
+  logrw(log.start, loghead, 1);
+80104715:	8b 35 34 aa 17 80    	mov    0x8017aa34,%esi
+  log.clh.n = 0;
+8010471b:	c7 05 d4 aa 17 80 00 	movl   $0x0,0x8017aad4
+80104722:	00 00 00 
+  hb->n = log.clh.n;
+80104725:	c7 05 60 e7 17 80 00 	movl   $0x0,0x8017e760
+8010472c:	00 00 00 
+  memset(&b, 0, sizeof(b));
+8010472f:	6a 68                	push   $0x68
+80104731:	6a 00                	push   $0x0
+80104733:	57                   	push   %edi
+80104734:	e8 07 2b 00 00       	call   80107240 <memset>
+  initsleeplock(&b.lock, "logbuf");
+80104739:	58                   	pop    %eax
+8010473a:	5a                   	pop    %edx
+8010473b:	68 1c b9 10 80       	push   $0x8010b91c
+80104740:	53                   	push   %ebx
+80104741:	e8 ea 24 00 00       	call   80106c30 <initsleeplock>
+  b.dev = log.dev;
+80104746:	a1 48 aa 17 80       	mov    0x8017aa48,%eax
+  b.blockno = blockno;
+8010474b:	89 75 88             	mov    %esi,-0x78(%ebp)
+  b.data = data;
+8010474e:	c7 45 e4 60 e7 17 80 	movl   $0x8017e760,-0x1c(%ebp)
+  b.dev = log.dev;
+80104755:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  b.flags = write ? B_DIRTY : 0;
+80104758:	c7 45 80 04 00 00 00 	movl   $0x4,-0x80(%ebp)
+  acquiresleep(&b.lock);
+8010475f:	89 1c 24             	mov    %ebx,(%esp)
+80104762:	e8 09 25 00 00       	call   80106c70 <acquiresleep>
+  iderw(&b);
+80104767:	89 3c 24             	mov    %edi,(%esp)
+8010476a:	e8 f1 ea ff ff       	call   80103260 <iderw>
+  releasesleep(&b.lock);
+8010476f:	89 1c 24             	mov    %ebx,(%esp)
+80104772:	e8 59 25 00 00       	call   80106cd0 <releasesleep>
+  kthread("logd", logd);
+80104777:	59                   	pop    %ecx
+80104778:	5b                   	pop    %ebx
+80104779:	68 50 40 10 80       	push   $0x80104050
+8010477e:	68 27 b9 10 80       	push   $0x8010b927
+80104783:	e8 28 15 00 00       	call   80105cb0 <kthread>
+}
+80104788:	83 c4 10             	add    $0x10,%esp
+8010478b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010478e:	5b                   	pop    %ebx
+8010478f:	5e                   	pop    %esi
+80104790:	5f                   	pop    %edi
+80104791:	5d                   	pop    %ebp
+80104792:	c3                   	ret
+80104793:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010479a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801047a0 <begin_op>:
+{
+801047a0:	55                   	push   %ebp
+801047a1:	89 e5                	mov    %esp,%ebp
+801047a3:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+801047a6:	68 00 aa 17 80       	push   $0x8017aa00
+801047ab:	e8 b0 25 00 00       	call   80106d60 <acquire>
+801047b0:	83 c4 10             	add    $0x10,%esp
+801047b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801047b7:	90                   	nop
+    if(log.committing || log.wanted){
+801047b8:	a1 40 aa 17 80       	mov    0x8017aa40,%eax
+801047bd:	0b 05 44 aa 17 80    	or     0x8017aa44,%eax
+801047c3:	75 51                	jne    80104816 <begin_op+0x76>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+801047c5:	a1 3c aa 17 80       	mov    0x8017aa3c,%eax
+801047ca:	8b 15 58 aa 17 80    	mov    0x8017aa58,%edx
+801047d0:	83 c0 01             	add    $0x1,%eax
+801047d3:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+801047d6:	8d 14 4a             	lea    (%edx,%ecx,2),%edx
+801047d9:	83 fa 1e             	cmp    $0x1e,%edx
+801047dc:	7e 52                	jle    80104830 <begin_op+0x90>
+      log.wanted = 1;
+801047de:	c7 05 44 aa 17 80 01 	movl   $0x1,0x8017aa44
+801047e5:	00 00 00 
+      wakeup(&log.lh);
+801047e8:	83 ec 0c             	sub    $0xc,%esp
+801047eb:	68 58 aa 17 80       	push   $0x8017aa58
+801047f0:	e8 eb 1e 00 00       	call   801066e0 <wakeup>
+      sleep(&log, &log.lock);
+801047f5:	58                   	pop    %eax
+801047f6:	5a                   	pop    %edx
+801047f7:	68 00 aa 17 80       	push   $0x8017aa00
+801047fc:	68 00 aa 17 80       	push   $0x8017aa00
+80104801:	e8 0a 1d 00 00       	call   80106510 <sleep>
+    if(log.committing || log.wanted){
+80104806:	a1 40 aa 17 80       	mov    0x8017aa40,%eax
+8010480b:	83 c4 10             	add    $0x10,%esp
+8010480e:	0b 05 44 aa 17 80    	or     0x8017aa44,%eax
+80104814:	74 af                	je     801047c5 <begin_op+0x25>
+      sleep(&log, &log.lock);
+80104816:	83 ec 08             	sub    $0x8,%esp
+80104819:	68 00 aa 17 80       	push   $0x8017aa00
+8010481e:	68 00 aa 17 80       	push   $0x8017aa00
+80104823:	e8 e8 1c 00 00       	call   80106510 <sleep>
+80104828:	83 c4 10             	add    $0x10,%esp
+8010482b:	eb 8b                	jmp    801047b8 <begin_op+0x18>
+8010482d:	8d 76 00             	lea    0x0(%esi),%esi
+      release(&log.lock);
+80104830:	83 ec 0c             	sub    $0xc,%esp
+      log.outstanding += 1;
+80104833:	a3 3c aa 17 80       	mov    %eax,0x8017aa3c
+      release(&log.lock);
+80104838:	68 00 aa 17 80       	push   $0x8017aa00
+8010483d:	e8 3e 27 00 00       	call   80106f80 <release>
+}
+80104842:	83 c4 10             	add    $0x10,%esp
+80104845:	c9                   	leave
+80104846:	c3                   	ret
+80104847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010484e:	66 90                	xchg   %ax,%ax
+
+80104850 <end_op>:
+{
+80104850:	55                   	push   %ebp
+80104851:	89 e5                	mov    %esp,%ebp
+80104853:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80104856:	68 00 aa 17 80       	push   $0x8017aa00
+8010485b:	e8 00 25 00 00       	call   80106d60 <acquire>
+  log.outstanding -= 1;
+80104860:	a1 3c aa 17 80       	mov    0x8017aa3c,%eax
+  if(log.committing)
+80104865:	8b 15 40 aa 17 80    	mov    0x8017aa40,%edx
+8010486b:	83 c4 10             	add    $0x10,%esp
+  log.outstanding -= 1;
+8010486e:	83 e8 01             	sub    $0x1,%eax
+80104871:	a3 3c aa 17 80       	mov    %eax,0x8017aa3c
+  if(log.committing)
+80104876:	85 d2                	test   %edx,%edx
+80104878:	75 4a                	jne    801048c4 <end_op+0x74>
+  if(log.outstanding == 0 && (log.wanted || (COMMITTICKS == 0 && log.lh.n > 0))){
+8010487a:	85 c0                	test   %eax,%eax
+8010487c:	75 09                	jne    80104887 <end_op+0x37>
+8010487e:	a1 44 aa 17 80       	mov    0x8017aa44,%eax
+80104883:	85 c0                	test   %eax,%eax
+80104885:	75 21                	jne    801048a8 <end_op+0x58>
+  wakeup(&log);
+80104887:	83 ec 0c             	sub    $0xc,%esp
+8010488a:	68 00 aa 17 80       	push   $0x8017aa00
+8010488f:	e8 4c 1e 00 00       	call   801066e0 <wakeup>
+  release(&log.lock);
+80104894:	c7 04 24 00 aa 17 80 	movl   $0x8017aa00,(%esp)
+8010489b:	e8 e0 26 00 00       	call   80106f80 <release>
+}
+801048a0:	83 c4 10             	add    $0x10,%esp
+801048a3:	c9                   	leave
+801048a4:	c3                   	ret
+801048a5:	8d 76 00             	lea    0x0(%esi),%esi
+    log.wanted = 1;
+801048a8:	c7 05 44 aa 17 80 01 	movl   $0x1,0x8017aa44
+801048af:	00 00 00 
+    wakeup(&log.lh);
+801048b2:	83 ec 0c             	sub    $0xc,%esp
+801048b5:	68 58 aa 17 80       	push   $0x8017aa58
+801048ba:	e8 21 1e 00 00       	call   801066e0 <wakeup>
+801048bf:	83 c4 10             	add    $0x10,%esp
+801048c2:	eb c3                	jmp    80104887 <end_op+0x37>
+    panic("log.committing");
+801048c4:	83 ec 0c             	sub    $0xc,%esp
+801048c7:	68 2c b9 10 80       	push   $0x8010b92c
+801048cc:	e8 ef c2 ff ff       	call   80100bc0 <panic>
+801048d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801048d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801048df:	90                   	nop
+
+801048e0 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+801048e0:	55                   	push   %ebp
+801048e1:	89 e5                	mov    %esp,%ebp
+801048e3:	53                   	push   %ebx
+801048e4:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+801048e7:	8b 15 58 aa 17 80    	mov    0x8017aa58,%edx
+{
+801048ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+801048f0:	83 fa 1d             	cmp    $0x1d,%edx
+801048f3:	0f 8f b9 00 00 00    	jg     801049b2 <log_write+0xd2>
+801048f9:	a1 38 aa 17 80       	mov    0x8017aa38,%eax
+801048fe:	83 e8 01             	sub    $0x1,%eax
+80104901:	39 c2                	cmp    %eax,%edx
+80104903:	0f 8d a9 00 00 00    	jge    801049b2 <log_write+0xd2>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80104909:	a1 3c aa 17 80       	mov    0x8017aa3c,%eax
+8010490e:	85 c0                	test   %eax,%eax
+80104910:	0f 8e a9 00 00 00    	jle    801049bf <log_write+0xdf>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+80104916:	83 ec 0c             	sub    $0xc,%esp
+80104919:	68 00 aa 17 80       	push   $0x8017aa00
+8010491e:	e8 3d 24 00 00       	call   80106d60 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+80104923:	8b 15 58 aa 17 80    	mov    0x8017aa58,%edx
+80104929:	83 c4 10             	add    $0x10,%esp
+8010492c:	85 d2                	test   %edx,%edx
+8010492e:	7e 52                	jle    80104982 <log_write+0xa2>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80104930:	8b 4b 08             	mov    0x8(%ebx),%ecx
+  for (i = 0; i < log.lh.n; i++) {
+80104933:	31 c0                	xor    %eax,%eax
+80104935:	eb 10                	jmp    80104947 <log_write+0x67>
+80104937:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010493e:	66 90                	xchg   %ax,%ax
+80104940:	83 c0 01             	add    $0x1,%eax
+80104943:	39 c2                	cmp    %eax,%edx
+80104945:	74 29                	je     80104970 <log_write+0x90>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80104947:	39 0c 85 5c aa 17 80 	cmp    %ecx,-0x7fe855a4(,%eax,4)
+8010494e:	75 f0                	jne    80104940 <log_write+0x60>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+80104950:	89 0c 85 5c aa 17 80 	mov    %ecx,-0x7fe855a4(,%eax,4)
+  if (i == log.lh.n){
+80104957:	39 c2                	cmp    %eax,%edx
+80104959:	74 1c                	je     80104977 <log_write+0x97>
+      // Start the commit interval.
+      log.opened = ticks;
+      wakeup(&log.lh);
+    }
+  }
+  b->flags |= B_DIRTY; // prevent eviction
+8010495b:	83 0b 04             	orl    $0x4,(%ebx)
+  release(&log.lock);
+}
+8010495e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&log.lock);
+80104961:	c7 45 08 00 aa 17 80 	movl   $0x8017aa00,0x8(%ebp)
+}
+80104968:	c9                   	leave
+  release(&log.lock);
+80104969:	e9 12 26 00 00       	jmp    80106f80 <release>
+8010496e:	66 90                	xchg   %ax,%ax
+  log.lh.block[i] = b->blockno;
+80104970:	89 0c 95 5c aa 17 80 	mov    %ecx,-0x7fe855a4(,%edx,4)
+    if (log.lh.n++ == 0){
+80104977:	83 c2 01             	add    $0x1,%edx
+8010497a:	89 15 58 aa 17 80    	mov    %edx,0x8017aa58
+80104980:	eb d9                	jmp    8010495b <log_write+0x7b>
+  log.lh.block[i] = b->blockno;
+80104982:	8b 43 08             	mov    0x8(%ebx),%eax
+80104985:	a3 5c aa 17 80       	mov    %eax,0x8017aa5c
+  if (i == log.lh.n){
+8010498a:	75 cf                	jne    8010495b <log_write+0x7b>
+      log.opened = ticks;
+8010498c:	a1 20 1b 1a 80       	mov    0x801a1b20,%eax
+      wakeup(&log.lh);
+80104991:	83 ec 0c             	sub    $0xc,%esp
+    if (log.lh.n++ == 0){
+80104994:	c7 05 58 aa 17 80 01 	movl   $0x1,0x8017aa58
+8010499b:	00 00 00 
+      log.opened = ticks;
+8010499e:	a3 4c aa 17 80       	mov    %eax,0x8017aa4c
+      wakeup(&log.lh);
+801049a3:	68 58 aa 17 80       	push   $0x8017aa58
+801049a8:	e8 33 1d 00 00       	call   801066e0 <wakeup>
+801049ad:	83 c4 10             	add    $0x10,%esp
+801049b0:	eb a9                	jmp    8010495b <log_write+0x7b>
+    panic("too big a transaction");
+801049b2:	83 ec 0c             	sub    $0xc,%esp
+801049b5:	68 3b b9 10 80       	push   $0x8010b93b
+801049ba:	e8 01 c2 ff ff       	call   80100bc0 <panic>
+    panic("log_write outside of trans");
+801049bf:	83 ec 0c             	sub    $0xc,%esp
+801049c2:	68 51 b9 10 80       	push   $0x8010b951
+801049c7:	e8 f4 c1 ff ff       	call   80100bc0 <panic>
+801049cc:	66 90                	xchg   %ax,%ax
+801049ce:	66 90                	xchg   %ax,%ax
+
+801049d0 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+801049d0:	55                   	push   %ebp
+801049d1:	89 e5                	mov    %esp,%ebp
+801049d3:	83 ec 08             	sub    $0x8,%esp
+  cprintf("cpu%d: starting\n", cpunum());
+801049d6:	e8 35 f3 ff ff       	call   80103d10 <cpunum>
+801049db:	83 ec 08             	sub    $0x8,%esp
+801049de:	50                   	push   %eax
+801049df:	68 6c b9 10 80       	push   $0x8010b96c
+801049e4:	e8 07 c5 ff ff       	call   80100ef0 <cprintf>
+  idtinit();       // load idt register
+801049e9:	e8 02 4b 00 00       	call   801094f0 <idtinit>
+  xchg(&cpu->started, 1); // tell startothers() we're up
+801049ee:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+801049f4:	8d 90 a8 00 00 00    	lea    0xa8(%eax),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+801049fa:	b8 01 00 00 00       	mov    $0x1,%eax
+801049ff:	f0 87 02             	lock xchg %eax,(%edx)
+  scheduler();     // start running processes
+80104a02:	e8 09 16 00 00       	call   80106010 <scheduler>
+80104a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104a0e:	66 90                	xchg   %ax,%ax
+
+80104a10 <mpenter>:
+{
+80104a10:	55                   	push   %ebp
+80104a11:	89 e5                	mov    %esp,%ebp
+80104a13:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80104a16:	e8 25 60 00 00       	call   8010aa40 <switchkvm>
+  seginit();
+80104a1b:	e8 e0 5d 00 00       	call   8010a800 <seginit>
+  lapicinit();
+80104a20:	e8 eb f1 ff ff       	call   80103c10 <lapicinit>
+  mpmain();
+80104a25:	e8 a6 ff ff ff       	call   801049d0 <mpmain>
+80104a2a:	66 90                	xchg   %ax,%ax
+80104a2c:	66 90                	xchg   %ax,%ax
+80104a2e:	66 90                	xchg   %ax,%ax
+
+80104a30 <main>:
+{
+80104a30:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80104a34:	83 e4 f0             	and    $0xfffffff0,%esp
+80104a37:	ff 71 fc             	push   -0x4(%ecx)
+80104a3a:	55                   	push   %ebp
+80104a3b:	89 e5                	mov    %esp,%ebp
+80104a3d:	53                   	push   %ebx
+80104a3e:	51                   	push   %ecx
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+80104a3f:	83 ec 08             	sub    $0x8,%esp
+80104a42:	68 00 00 40 80       	push   $0x80400000
+80104a47:	68 90 33 1a 80       	push   $0x801a3390
+80104a4c:	e8 8f ed ff ff       	call   801037e0 <kinit1>
+  kvmalloc();      // kernel page table
+80104a51:	e8 ca 5f 00 00       	call   8010aa20 <kvmalloc>
+  mpinit();        // detect other processors
+80104a56:	e8 c5 01 00 00       	call   80104c20 <mpinit>
+  lapicinit();     // interrupt controller
+80104a5b:	e8 b0 f1 ff ff       	call   80103c10 <lapicinit>
+  seginit();       // segment descriptors
+80104a60:	e8 9b 5d 00 00       	call   8010a800 <seginit>
+  cprintf("\ncpu%d: starting xv6\n\n", cpunum());
+80104a65:	e8 a6 f2 ff ff       	call   80103d10 <cpunum>
+80104a6a:	5a                   	pop    %edx
+80104a6b:	59                   	pop    %ecx
+80104a6c:	50                   	push   %eax
+80104a6d:	68 7d b9 10 80       	push   $0x8010b97d
+80104a72:	e8 79 c4 ff ff       	call   80100ef0 <cprintf>
+  picinit();       // another interrupt controller
+80104a77:	e8 54 08 00 00       	call   801052d0 <picinit>
+  ioapicinit();    // another interrupt controller
+80104a7c:	e8 2f e9 ff ff       	call   801033b0 <ioapicinit>
+  consoleinit();   // console hardware
+80104a81:	e8 4a c8 ff ff       	call   801012d0 <consoleinit>
+  uartinit();      // serial port
+80104a86:	e8 65 4d 00 00       	call   801097f0 <uartinit>
+  pinit();         // process table
+80104a8b:	e8 60 10 00 00       	call   80105af0 <pinit>
+  tvinit();        // trap vectors
+80104a90:	e8 db 49 00 00       	call   80109470 <tvinit>
+  binit();         // buffer cache
+80104a95:	e8 a6 bb ff ff       	call   80100640 <binit>
+  pcinit();        // page cache
+80104a9a:	e8 f1 04 00 00       	call   80104f90 <pcinit>
+  traceinit();     // system call trace buffers
+80104a9f:	e8 ec 44 00 00       	call   80108f90 <traceinit>
+  statsinit();     // event counters device
+80104aa4:	e8 87 27 00 00       	call   80107230 <statsinit>
+  fileinit();      // file table
+80104aa9:	e8 c2 cc ff ff       	call   80101770 <fileinit>
+  ideinit();       // disk
+80104aae:	e8 dd e4 ff ff       	call   80102f90 <ideinit>
+  if(!ismp)
+80104ab3:	8b 1d 88 e9 17 80    	mov    0x8017e988,%ebx
+80104ab9:	83 c4 10             	add    $0x10,%esp
+80104abc:	85 db                	test   %ebx,%ebx
+80104abe:	0f 84 c8 00 00 00    	je     80104b8c <main+0x15c>
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+80104ac4:	83 ec 04             	sub    $0x4,%esp
+80104ac7:	68 8e 00 00 00       	push   $0x8e
+80104acc:	68 8c e4 10 80       	push   $0x8010e48c
+80104ad1:	68 00 70 00 80       	push   $0x80007000
+80104ad6:	e8 f5 27 00 00       	call   801072d0 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+80104adb:	a1 84 e9 17 80       	mov    0x8017e984,%eax
+80104ae0:	83 c4 10             	add    $0x10,%esp
+80104ae3:	c1 e0 08             	shl    $0x8,%eax
+80104ae6:	05 c0 e9 17 80       	add    $0x8017e9c0,%eax
+80104aeb:	3d c0 e9 17 80       	cmp    $0x8017e9c0,%eax
+80104af0:	76 7e                	jbe    80104b70 <main+0x140>
+80104af2:	bb c0 e9 17 80       	mov    $0x8017e9c0,%ebx
+80104af7:	eb 1e                	jmp    80104b17 <main+0xe7>
+80104af9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104b00:	a1 84 e9 17 80       	mov    0x8017e984,%eax
+80104b05:	81 c3 00 01 00 00    	add    $0x100,%ebx
+80104b0b:	c1 e0 08             	shl    $0x8,%eax
+80104b0e:	05 c0 e9 17 80       	add    $0x8017e9c0,%eax
+80104b13:	39 c3                	cmp    %eax,%ebx
+80104b15:	73 59                	jae    80104b70 <main+0x140>
+    if(c == cpus+cpunum())  // We've started already.
+80104b17:	e8 f4 f1 ff ff       	call   80103d10 <cpunum>
+80104b1c:	c1 e0 08             	shl    $0x8,%eax
+80104b1f:	05 c0 e9 17 80       	add    $0x8017e9c0,%eax
+80104b24:	39 c3                	cmp    %eax,%ebx
+80104b26:	74 d8                	je     80104b00 <main+0xd0>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+80104b28:	e8 23 ed ff ff       	call   80103850 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+    *(void**)(code-8) = mpenter;
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+
+    lapicstartap(c->apicid, V2P(code));
+80104b2d:	83 ec 08             	sub    $0x8,%esp
+    *(void**)(code-8) = mpenter;
+80104b30:	c7 05 f8 6f 00 80 10 	movl   $0x80104a10,0x80006ff8
+80104b37:	4a 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80104b3a:	c7 05 f4 6f 00 80 00 	movl   $0x10d000,0x80006ff4
+80104b41:	d0 10 00 
+    *(void**)(code-4) = stack + KSTACKSIZE;
+80104b44:	05 00 10 00 00       	add    $0x1000,%eax
+80104b49:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    lapicstartap(c->apicid, V2P(code));
+80104b4e:	68 00 70 00 00       	push   $0x7000
+80104b53:	0f b6 03             	movzbl (%ebx),%eax
+80104b56:	50                   	push   %eax
+80104b57:	e8 74 f2 ff ff       	call   80103dd0 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+80104b5c:	83 c4 10             	add    $0x10,%esp
+80104b5f:	90                   	nop
+80104b60:	8b 83 a8 00 00 00    	mov    0xa8(%ebx),%eax
+80104b66:	85 c0                	test   %eax,%eax
+80104b68:	74 f6                	je     80104b60 <main+0x130>
+80104b6a:	eb 94                	jmp    80104b00 <main+0xd0>
+80104b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+80104b70:	83 ec 08             	sub    $0x8,%esp
+80104b73:	68 00 00 00 8e       	push   $0x8e000000
+80104b78:	68 00 00 40 80       	push   $0x80400000
+80104b7d:	e8 fe eb ff ff       	call   80103780 <kinit2>
+  userinit();      // first user process
+80104b82:	e8 d9 0f 00 00       	call   80105b60 <userinit>
+  mpmain();        // finish this processor's setup
+80104b87:	e8 44 fe ff ff       	call   801049d0 <mpmain>
+    timerinit();   // uniprocessor timer
+80104b8c:	e8 ff 42 00 00       	call   80108e90 <timerinit>
+80104b91:	e9 2e ff ff ff       	jmp    80104ac4 <main+0x94>
+80104b96:	66 90                	xchg   %ax,%ax
+80104b98:	66 90                	xchg   %ax,%ax
+80104b9a:	66 90                	xchg   %ax,%ax
+80104b9c:	66 90                	xchg   %ax,%ax
+80104b9e:	66 90                	xchg   %ax,%ax
+
+80104ba0 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80104ba0:	55                   	push   %ebp
+80104ba1:	89 e5                	mov    %esp,%ebp
+80104ba3:	57                   	push   %edi
+80104ba4:	56                   	push   %esi
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80104ba5:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+{
+80104bab:	53                   	push   %ebx
+  e = addr+len;
+80104bac:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+{
+80104baf:	83 ec 0c             	sub    $0xc,%esp
+  for(p = addr; p < e; p += sizeof(struct mp))
+80104bb2:	39 de                	cmp    %ebx,%esi
+80104bb4:	72 10                	jb     80104bc6 <mpsearch1+0x26>
+80104bb6:	eb 50                	jmp    80104c08 <mpsearch1+0x68>
+80104bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104bbf:	90                   	nop
+80104bc0:	89 fe                	mov    %edi,%esi
+80104bc2:	39 df                	cmp    %ebx,%edi
+80104bc4:	73 42                	jae    80104c08 <mpsearch1+0x68>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104bc6:	83 ec 04             	sub    $0x4,%esp
+80104bc9:	8d 7e 10             	lea    0x10(%esi),%edi
+80104bcc:	6a 04                	push   $0x4
+80104bce:	68 94 b9 10 80       	push   $0x8010b994
+80104bd3:	56                   	push   %esi
+80104bd4:	e8 a7 26 00 00       	call   80107280 <memcmp>
+80104bd9:	83 c4 10             	add    $0x10,%esp
+80104bdc:	85 c0                	test   %eax,%eax
+80104bde:	75 e0                	jne    80104bc0 <mpsearch1+0x20>
+80104be0:	89 f2                	mov    %esi,%edx
+80104be2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sum += addr[i];
+80104be8:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+80104beb:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+80104bee:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80104bf0:	39 fa                	cmp    %edi,%edx
+80104bf2:	75 f4                	jne    80104be8 <mpsearch1+0x48>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104bf4:	84 c0                	test   %al,%al
+80104bf6:	75 c8                	jne    80104bc0 <mpsearch1+0x20>
+      return (struct mp*)p;
+  return 0;
+}
+80104bf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104bfb:	89 f0                	mov    %esi,%eax
+80104bfd:	5b                   	pop    %ebx
+80104bfe:	5e                   	pop    %esi
+80104bff:	5f                   	pop    %edi
+80104c00:	5d                   	pop    %ebp
+80104c01:	c3                   	ret
+80104c02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104c08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80104c0b:	31 f6                	xor    %esi,%esi
+}
+80104c0d:	5b                   	pop    %ebx
+80104c0e:	89 f0                	mov    %esi,%eax
+80104c10:	5e                   	pop    %esi
+80104c11:	5f                   	pop    %edi
+80104c12:	5d                   	pop    %ebp
+80104c13:	c3                   	ret
+80104c14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104c1f:	90                   	nop
+
+80104c20 <mpinit>:
+  return conf;
+}
+
+void
+mpinit(void)
+{
+80104c20:	55                   	push   %ebp
+80104c21:	89 e5                	mov    %esp,%ebp
+80104c23:	57                   	push   %edi
+80104c24:	56                   	push   %esi
+80104c25:	53                   	push   %ebx
+80104c26:	83 ec 1c             	sub    $0x1c,%esp
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80104c29:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80104c30:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80104c37:	c1 e0 08             	shl    $0x8,%eax
+80104c3a:	09 d0                	or     %edx,%eax
+80104c3c:	c1 e0 04             	shl    $0x4,%eax
+80104c3f:	75 1b                	jne    80104c5c <mpinit+0x3c>
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80104c41:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80104c48:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+80104c4f:	c1 e0 08             	shl    $0x8,%eax
+80104c52:	09 d0                	or     %edx,%eax
+80104c54:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+80104c57:	2d 00 04 00 00       	sub    $0x400,%eax
+    if((mp = mpsearch1(p, 1024)))
+80104c5c:	ba 00 04 00 00       	mov    $0x400,%edx
+80104c61:	e8 3a ff ff ff       	call   80104ba0 <mpsearch1>
+80104c66:	89 c3                	mov    %eax,%ebx
+80104c68:	85 c0                	test   %eax,%eax
+80104c6a:	0f 84 68 01 00 00    	je     80104dd8 <mpinit+0x1b8>
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80104c70:	8b 73 04             	mov    0x4(%ebx),%esi
+80104c73:	85 f6                	test   %esi,%esi
+80104c75:	0f 84 e2 00 00 00    	je     80104d5d <mpinit+0x13d>
+  if(memcmp(conf, "PCMP", 4) != 0)
+80104c7b:	83 ec 04             	sub    $0x4,%esp
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+80104c7e:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80104c84:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+80104c87:	6a 04                	push   $0x4
+80104c89:	68 99 b9 10 80       	push   $0x8010b999
+80104c8e:	50                   	push   %eax
+80104c8f:	e8 ec 25 00 00       	call   80107280 <memcmp>
+80104c94:	83 c4 10             	add    $0x10,%esp
+80104c97:	89 c2                	mov    %eax,%edx
+80104c99:	85 c0                	test   %eax,%eax
+80104c9b:	0f 85 bc 00 00 00    	jne    80104d5d <mpinit+0x13d>
+  if(conf->version != 1 && conf->version != 4)
+80104ca1:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+80104ca8:	3c 01                	cmp    $0x1,%al
+80104caa:	74 08                	je     80104cb4 <mpinit+0x94>
+80104cac:	3c 04                	cmp    $0x4,%al
+80104cae:	0f 85 a9 00 00 00    	jne    80104d5d <mpinit+0x13d>
+  if(sum((uchar*)conf, conf->length) != 0)
+80104cb4:	0f b7 be 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edi
+  for(i=0; i<len; i++)
+80104cbb:	66 85 ff             	test   %di,%di
+80104cbe:	74 20                	je     80104ce0 <mpinit+0xc0>
+80104cc0:	89 f0                	mov    %esi,%eax
+80104cc2:	01 f7                	add    %esi,%edi
+80104cc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    sum += addr[i];
+80104cc8:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+  for(i=0; i<len; i++)
+80104ccf:	83 c0 01             	add    $0x1,%eax
+    sum += addr[i];
+80104cd2:	01 ca                	add    %ecx,%edx
+  for(i=0; i<len; i++)
+80104cd4:	39 c7                	cmp    %eax,%edi
+80104cd6:	75 f0                	jne    80104cc8 <mpinit+0xa8>
+  if(sum((uchar*)conf, conf->length) != 0)
+80104cd8:	84 d2                	test   %dl,%dl
+80104cda:	0f 85 7d 00 00 00    	jne    80104d5d <mpinit+0x13d>
+  struct mpproc *proc;
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+    return;
+  ismp = 1;
+80104ce0:	c7 05 88 e9 17 80 01 	movl   $0x1,0x8017e988
+80104ce7:	00 00 00 
+  lapic = (uint*)conf->lapicaddr;
+80104cea:	8b 86 24 00 00 80    	mov    -0x7fffffdc(%esi),%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104cf0:	8d 96 2c 00 00 80    	lea    -0x7fffffd4(%esi),%edx
+  lapic = (uint*)conf->lapicaddr;
+80104cf6:	a3 e4 a9 17 80       	mov    %eax,0x8017a9e4
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104cfb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104cfe:	0f b7 8e 04 00 00 80 	movzwl -0x7ffffffc(%esi),%ecx
+80104d05:	01 c8                	add    %ecx,%eax
+80104d07:	89 c1                	mov    %eax,%ecx
+80104d09:	39 c2                	cmp    %eax,%edx
+80104d0b:	72 0e                	jb     80104d1b <mpinit+0xfb>
+80104d0d:	eb 33                	jmp    80104d42 <mpinit+0x122>
+80104d0f:	90                   	nop
+    switch(*p){
+80104d10:	84 c0                	test   %al,%al
+80104d12:	74 6c                	je     80104d80 <mpinit+0x160>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80104d14:	83 c2 08             	add    $0x8,%edx
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104d17:	39 ca                	cmp    %ecx,%edx
+80104d19:	73 1e                	jae    80104d39 <mpinit+0x119>
+    switch(*p){
+80104d1b:	0f b6 02             	movzbl (%edx),%eax
+80104d1e:	3c 02                	cmp    $0x2,%al
+80104d20:	74 46                	je     80104d68 <mpinit+0x148>
+80104d22:	76 ec                	jbe    80104d10 <mpinit+0xf0>
+80104d24:	83 e8 03             	sub    $0x3,%eax
+80104d27:	3c 01                	cmp    $0x1,%al
+80104d29:	76 e9                	jbe    80104d14 <mpinit+0xf4>
+      continue;
+    default:
+      ismp = 0;
+80104d2b:	c7 05 88 e9 17 80 00 	movl   $0x0,0x8017e988
+80104d32:	00 00 00 
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104d35:	39 ca                	cmp    %ecx,%edx
+80104d37:	72 e2                	jb     80104d1b <mpinit+0xfb>
+      break;
+    }
+  }
+  if(!ismp){
+80104d39:	a1 88 e9 17 80       	mov    0x8017e988,%eax
+80104d3e:	85 c0                	test   %eax,%eax
+80104d40:	74 6e                	je     80104db0 <mpinit+0x190>
+    lapic = 0;
+    ioapicid = 0;
+    return;
+  }
+
+  if(mp->imcrp){
+80104d42:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+80104d46:	74 15                	je     80104d5d <mpinit+0x13d>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104d48:	b8 70 00 00 00       	mov    $0x70,%eax
+80104d4d:	ba 22 00 00 00       	mov    $0x22,%edx
+80104d52:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104d53:	ba 23 00 00 00       	mov    $0x23,%edx
+80104d58:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+80104d59:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104d5c:	ee                   	out    %al,(%dx)
+  }
+}
+80104d5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104d60:	5b                   	pop    %ebx
+80104d61:	5e                   	pop    %esi
+80104d62:	5f                   	pop    %edi
+80104d63:	5d                   	pop    %ebp
+80104d64:	c3                   	ret
+80104d65:	8d 76 00             	lea    0x0(%esi),%esi
+      ioapicid = ioapic->apicno;
+80104d68:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      p += sizeof(struct mpioapic);
+80104d6c:	83 c2 08             	add    $0x8,%edx
+      ioapicid = ioapic->apicno;
+80104d6f:	a2 80 e9 17 80       	mov    %al,0x8017e980
+      continue;
+80104d74:	eb a1                	jmp    80104d17 <mpinit+0xf7>
+80104d76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104d7d:	8d 76 00             	lea    0x0(%esi),%esi
+      if(ncpu < NCPU) {
+80104d80:	8b 35 84 e9 17 80    	mov    0x8017e984,%esi
+80104d86:	83 fe 07             	cmp    $0x7,%esi
+80104d89:	7f 18                	jg     80104da3 <mpinit+0x183>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80104d8b:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+80104d8f:	89 f7                	mov    %esi,%edi
+        ncpu++;
+80104d91:	83 c6 01             	add    $0x1,%esi
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80104d94:	c1 e7 08             	shl    $0x8,%edi
+        ncpu++;
+80104d97:	89 35 84 e9 17 80    	mov    %esi,0x8017e984
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80104d9d:	88 87 c0 e9 17 80    	mov    %al,-0x7fe81640(%edi)
+      p += sizeof(struct mpproc);
+80104da3:	83 c2 14             	add    $0x14,%edx
+      continue;
+80104da6:	e9 6c ff ff ff       	jmp    80104d17 <mpinit+0xf7>
+80104dab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104daf:	90                   	nop
+    ncpu = 1;
+80104db0:	c7 05 84 e9 17 80 01 	movl   $0x1,0x8017e984
+80104db7:	00 00 00 
+    lapic = 0;
+80104dba:	c7 05 e4 a9 17 80 00 	movl   $0x0,0x8017a9e4
+80104dc1:	00 00 00 
+    ioapicid = 0;
+80104dc4:	c6 05 80 e9 17 80 00 	movb   $0x0,0x8017e980
+}
+80104dcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104dce:	5b                   	pop    %ebx
+80104dcf:	5e                   	pop    %esi
+80104dd0:	5f                   	pop    %edi
+80104dd1:	5d                   	pop    %ebp
+80104dd2:	c3                   	ret
+80104dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104dd7:	90                   	nop
+{
+80104dd8:	bb 00 00 0f 80       	mov    $0x800f0000,%ebx
+80104ddd:	eb 0f                	jmp    80104dee <mpinit+0x1ce>
+80104ddf:	90                   	nop
+  for(p = addr; p < e; p += sizeof(struct mp))
+80104de0:	89 f3                	mov    %esi,%ebx
+80104de2:	81 fe 00 00 10 80    	cmp    $0x80100000,%esi
+80104de8:	0f 84 6f ff ff ff    	je     80104d5d <mpinit+0x13d>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104dee:	83 ec 04             	sub    $0x4,%esp
+80104df1:	8d 73 10             	lea    0x10(%ebx),%esi
+80104df4:	6a 04                	push   $0x4
+80104df6:	68 94 b9 10 80       	push   $0x8010b994
+80104dfb:	53                   	push   %ebx
+80104dfc:	e8 7f 24 00 00       	call   80107280 <memcmp>
+80104e01:	83 c4 10             	add    $0x10,%esp
+80104e04:	85 c0                	test   %eax,%eax
+80104e06:	75 d8                	jne    80104de0 <mpinit+0x1c0>
+80104e08:	89 da                	mov    %ebx,%edx
+80104e0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sum += addr[i];
+80104e10:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+80104e13:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+80104e16:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80104e18:	39 f2                	cmp    %esi,%edx
+80104e1a:	75 f4                	jne    80104e10 <mpinit+0x1f0>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104e1c:	84 c0                	test   %al,%al
+80104e1e:	75 c0                	jne    80104de0 <mpinit+0x1c0>
+80104e20:	e9 4b fe ff ff       	jmp    80104c70 <mpinit+0x50>
+80104e25:	66 90                	xchg   %ax,%ax
+80104e27:	66 90                	xchg   %ax,%ax
+80104e29:	66 90                	xchg   %ax,%ax
+80104e2b:	66 90                	xchg   %ax,%ax
+80104e2d:	66 90                	xchg   %ax,%ax
+80104e2f:	90                   	nop
+
+80104e30 <pciread>:
+}
+
+// Read the 32-bit configuration register at offset off.
+uint
+pciread(uint tag, int off)
+{
+80104e30:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104e31:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104e36:	89 e5                	mov    %esp,%ebp
+  outl(PCI_CONFADDR, 0x80000000 | tag | (off & 0xfc));
+80104e38:	8b 45 0c             	mov    0xc(%ebp),%eax
+80104e3b:	25 fc 00 00 00       	and    $0xfc,%eax
+80104e40:	0b 45 08             	or     0x8(%ebp),%eax
+80104e43:	0d 00 00 00 80       	or     $0x80000000,%eax
+80104e48:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104e49:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104e4e:	ed                   	in     (%dx),%eax
+  return inl(PCI_CONFDATA);
+}
+80104e4f:	5d                   	pop    %ebp
+80104e50:	c3                   	ret
+80104e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104e58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104e5f:	90                   	nop
+
+80104e60 <pciwrite>:
+
+void
+pciwrite(uint tag, int off, uint v)
+{
+80104e60:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104e61:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104e66:	89 e5                	mov    %esp,%ebp
+  outl(PCI_CONFADDR, 0x80000000 | tag | (off & 0xfc));
+80104e68:	8b 45 0c             	mov    0xc(%ebp),%eax
+80104e6b:	25 fc 00 00 00       	and    $0xfc,%eax
+80104e70:	0b 45 08             	or     0x8(%ebp),%eax
+80104e73:	0d 00 00 00 80       	or     $0x80000000,%eax
+80104e78:	ef                   	out    %eax,(%dx)
+80104e79:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104e7e:	8b 45 10             	mov    0x10(%ebp),%eax
+80104e81:	ef                   	out    %eax,(%dx)
+  outl(PCI_CONFDATA, v);
+}
+80104e82:	5d                   	pop    %ebp
+80104e83:	c3                   	ret
+80104e84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104e8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104e8f:	90                   	nop
+
+80104e90 <pcifind>:
+
+// Find the first function of the given class and subclass on
+// bus 0 and store its tag in *tagp.  Returns 0 if there is none.
+int
+pcifind(int class, int subclass, uint *tagp)
+{
+80104e90:	55                   	push   %ebp
+80104e91:	89 e5                	mov    %esp,%ebp
+80104e93:	57                   	push   %edi
+80104e94:	bf f8 0c 00 00       	mov    $0xcf8,%edi
+80104e99:	56                   	push   %esi
+80104e9a:	53                   	push   %ebx
+80104e9b:	83 ec 08             	sub    $0x8,%esp
+    for(func = 0; func < nfunc; func++){
+      tag = pcitag(0, dev, func);
+      if((pciread(tag, PCI_ID) & 0xffff) == 0xffff)
+        continue;   // no such device
+      if(func == 0 && (pciread(tag, PCI_HEADER) & 0x800000))
+        nfunc = 8;  // multi-function device
+80104e9e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    nfunc = 1;
+80104ea5:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+    for(func = 0; func < nfunc; func++){
+80104eac:	31 db                	xor    %ebx,%ebx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104eae:	be fc 0c 00 00       	mov    $0xcfc,%esi
+80104eb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104eb7:	90                   	nop
+      tag = pcitag(0, dev, func);
+80104eb8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80104ebb:	89 d9                	mov    %ebx,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104ebd:	89 fa                	mov    %edi,%edx
+80104ebf:	c1 e1 08             	shl    $0x8,%ecx
+80104ec2:	09 c1                	or     %eax,%ecx
+80104ec4:	89 c8                	mov    %ecx,%eax
+80104ec6:	0d 00 00 00 80       	or     $0x80000000,%eax
+80104ecb:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104ecc:	89 f2                	mov    %esi,%edx
+80104ece:	ed                   	in     (%dx),%eax
+      if((pciread(tag, PCI_ID) & 0xffff) == 0xffff)
+80104ecf:	0f b7 c0             	movzwl %ax,%eax
+80104ed2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+80104ed7:	74 5e                	je     80104f37 <pcifind+0xa7>
+      if(func == 0 && (pciread(tag, PCI_HEADER) & 0x800000))
+80104ed9:	85 db                	test   %ebx,%ebx
+80104edb:	75 43                	jne    80104f20 <pcifind+0x90>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104edd:	89 c8                	mov    %ecx,%eax
+80104edf:	89 fa                	mov    %edi,%edx
+80104ee1:	0d 0c 00 00 80       	or     $0x8000000c,%eax
+80104ee6:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104ee7:	89 f2                	mov    %esi,%edx
+80104ee9:	ed                   	in     (%dx),%eax
+80104eea:	a9 00 00 80 00       	test   $0x800000,%eax
+80104eef:	74 2f                	je     80104f20 <pcifind+0x90>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104ef1:	89 c8                	mov    %ecx,%eax
+80104ef3:	89 fa                	mov    %edi,%edx
+80104ef5:	0d 08 00 00 80       	or     $0x80000008,%eax
+80104efa:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104efb:	89 f2                	mov    %esi,%edx
+80104efd:	ed                   	in     (%dx),%eax
+      c = pciread(tag, PCI_CLASS);
+      if((c >> 24) == class && ((c >> 16) & 0xff) == subclass){
+80104efe:	89 c2                	mov    %eax,%edx
+80104f00:	c1 ea 18             	shr    $0x18,%edx
+80104f03:	3b 55 08             	cmp    0x8(%ebp),%edx
+80104f06:	74 60                	je     80104f68 <pcifind+0xd8>
+        nfunc = 8;  // multi-function device
+80104f08:	c7 45 ec 08 00 00 00 	movl   $0x8,-0x14(%ebp)
+    for(func = 0; func < nfunc; func++){
+80104f0f:	bb 01 00 00 00       	mov    $0x1,%ebx
+80104f14:	eb a2                	jmp    80104eb8 <pcifind+0x28>
+80104f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104f1d:	8d 76 00             	lea    0x0(%esi),%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104f20:	89 c8                	mov    %ecx,%eax
+80104f22:	89 fa                	mov    %edi,%edx
+80104f24:	0d 08 00 00 80       	or     $0x80000008,%eax
+80104f29:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104f2a:	89 f2                	mov    %esi,%edx
+80104f2c:	ed                   	in     (%dx),%eax
+      if((c >> 24) == class && ((c >> 16) & 0xff) == subclass){
+80104f2d:	89 c2                	mov    %eax,%edx
+80104f2f:	c1 ea 18             	shr    $0x18,%edx
+80104f32:	3b 55 08             	cmp    0x8(%ebp),%edx
+80104f35:	74 38                	je     80104f6f <pcifind+0xdf>
+    for(func = 0; func < nfunc; func++){
+80104f37:	83 c3 01             	add    $0x1,%ebx
+80104f3a:	39 5d ec             	cmp    %ebx,-0x14(%ebp)
+80104f3d:	0f 8f 75 ff ff ff    	jg     80104eb8 <pcifind+0x28>
+  for(dev = 0; dev < 32; dev++){
+80104f43:	81 45 f0 00 08 00 00 	addl   $0x800,-0x10(%ebp)
+80104f4a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80104f4d:	3d 00 00 01 00       	cmp    $0x10000,%eax
+80104f52:	0f 85 4d ff ff ff    	jne    80104ea5 <pcifind+0x15>
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+80104f58:	83 c4 08             	add    $0x8,%esp
+  return 0;
+80104f5b:	31 c0                	xor    %eax,%eax
+}
+80104f5d:	5b                   	pop    %ebx
+80104f5e:	5e                   	pop    %esi
+80104f5f:	5f                   	pop    %edi
+80104f60:	5d                   	pop    %ebp
+80104f61:	c3                   	ret
+80104f62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        nfunc = 8;  // multi-function device
+80104f68:	c7 45 ec 08 00 00 00 	movl   $0x8,-0x14(%ebp)
+      if((c >> 24) == class && ((c >> 16) & 0xff) == subclass){
+80104f6f:	c1 e8 10             	shr    $0x10,%eax
+80104f72:	0f b6 c0             	movzbl %al,%eax
+80104f75:	3b 45 0c             	cmp    0xc(%ebp),%eax
+80104f78:	75 bd                	jne    80104f37 <pcifind+0xa7>
+        *tagp = tag;
+80104f7a:	8b 45 10             	mov    0x10(%ebp),%eax
+80104f7d:	89 08                	mov    %ecx,(%eax)
+}
+80104f7f:	83 c4 08             	add    $0x8,%esp
+        return 1;
+80104f82:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80104f87:	5b                   	pop    %ebx
+80104f88:	5e                   	pop    %esi
+80104f89:	5f                   	pop    %edi
+80104f8a:	5d                   	pop    %ebp
+80104f8b:	c3                   	ret
+80104f8c:	66 90                	xchg   %ax,%ax
+80104f8e:	66 90                	xchg   %ax,%ax
+
+80104f90 <pcinit>:
+  int hand;     // next entry to consider for replacement
+} pcache;
+
+void
+pcinit(void)
+{
+80104f90:	55                   	push   %ebp
+80104f91:	89 e5                	mov    %esp,%ebp
+80104f93:	83 ec 10             	sub    $0x10,%esp
+  initlock(&pcache.lock, "pcache");
+80104f96:	68 9e b9 10 80       	push   $0x8010b99e
+80104f9b:	68 c0 f1 17 80       	push   $0x8017f1c0
+80104fa0:	e8 9b 1d 00 00       	call   80106d40 <initlock>
+}
+80104fa5:	83 c4 10             	add    $0x10,%esp
+80104fa8:	c9                   	leave
+80104fa9:	c3                   	ret
+80104faa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104fb0 <pcget>:
+
+// Return the cached page holding offset off of inode (dev, inum)
+// with a reference for the caller, or 0 if it is not cached.
+char*
+pcget(uint dev, uint inum, uint off)
+{
+80104fb0:	55                   	push   %ebp
+80104fb1:	89 e5                	mov    %esp,%ebp
+80104fb3:	57                   	push   %edi
+80104fb4:	56                   	push   %esi
+80104fb5:	53                   	push   %ebx
+80104fb6:	83 ec 18             	sub    $0x18,%esp
+80104fb9:	8b 75 08             	mov    0x8(%ebp),%esi
+80104fbc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct pcentry *e;
+  char *page;
+
+  page = 0;
+  acquire(&pcache.lock);
+80104fbf:	68 c0 f1 17 80       	push   $0x8017f1c0
+80104fc4:	e8 97 1d 00 00       	call   80106d60 <acquire>
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+80104fc9:	8b 55 10             	mov    0x10(%ebp),%edx
+  acquire(&pcache.lock);
+80104fcc:	83 c4 10             	add    $0x10,%esp
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+80104fcf:	b8 f4 f1 17 80       	mov    $0x8017f1f4,%eax
+80104fd4:	eb 14                	jmp    80104fea <pcget+0x3a>
+80104fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104fdd:	8d 76 00             	lea    0x0(%esi),%esi
+80104fe0:	83 c0 10             	add    $0x10,%eax
+80104fe3:	3d f4 11 18 80       	cmp    $0x801811f4,%eax
+80104fe8:	74 23                	je     8010500d <pcget+0x5d>
+    if(e->page && e->dev == dev && e->inum == inum && e->off == off){
+80104fea:	8b 58 0c             	mov    0xc(%eax),%ebx
+80104fed:	85 db                	test   %ebx,%ebx
+80104fef:	74 ef                	je     80104fe0 <pcget+0x30>
+80104ff1:	39 30                	cmp    %esi,(%eax)
+80104ff3:	75 eb                	jne    80104fe0 <pcget+0x30>
+80104ff5:	39 78 04             	cmp    %edi,0x4(%eax)
+80104ff8:	75 e6                	jne    80104fe0 <pcget+0x30>
+80104ffa:	39 50 08             	cmp    %edx,0x8(%eax)
+80104ffd:	75 e1                	jne    80104fe0 <pcget+0x30>
+      page = e->page;
+      kdup(page);
+80104fff:	83 ec 0c             	sub    $0xc,%esp
+80105002:	53                   	push   %ebx
+80105003:	e8 88 ea ff ff       	call   80103a90 <kdup>
+      break;
+80105008:	83 c4 10             	add    $0x10,%esp
+8010500b:	eb 02                	jmp    8010500f <pcget+0x5f>
+  page = 0;
+8010500d:	31 db                	xor    %ebx,%ebx
+    }
+  }
+  release(&pcache.lock);
+8010500f:	83 ec 0c             	sub    $0xc,%esp
+80105012:	68 c0 f1 17 80       	push   $0x8017f1c0
+80105017:	e8 64 1f 00 00       	call   80106f80 <release>
+  return page;
+}
+8010501c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010501f:	89 d8                	mov    %ebx,%eax
+80105021:	5b                   	pop    %ebx
+80105022:	5e                   	pop    %esi
+80105023:	5f                   	pop    %edi
+80105024:	5d                   	pop    %ebp
+80105025:	c3                   	ret
+80105026:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010502d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105030 <pcput>:
+// a reference to it, 0 if there was no room or it is cached
+// already.  Caller must hold the inode's lock, so the file
+// cannot change before the page is in the cache.
+int
+pcput(uint dev, uint inum, uint off, char *page)
+{
+80105030:	55                   	push   %ebp
+80105031:	89 e5                	mov    %esp,%ebp
+80105033:	57                   	push   %edi
+80105034:	56                   	push   %esi
+80105035:	53                   	push   %ebx
+  struct pcentry *e, *free;
+  char *old;
+  int i;
+
+  old = 0;
+  free = 0;
+80105036:	31 db                	xor    %ebx,%ebx
+{
+80105038:	83 ec 18             	sub    $0x18,%esp
+8010503b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&pcache.lock);
+8010503e:	68 c0 f1 17 80       	push   $0x8017f1c0
+80105043:	e8 18 1d 00 00       	call   80106d60 <acquire>
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+80105048:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010504b:	8b 55 10             	mov    0x10(%ebp),%edx
+  acquire(&pcache.lock);
+8010504e:	83 c4 10             	add    $0x10,%esp
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+80105051:	b8 f4 f1 17 80       	mov    $0x8017f1f4,%eax
+80105056:	eb 1a                	jmp    80105072 <pcput+0x42>
+80105058:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010505f:	90                   	nop
+    if(e->page == 0){
+      if(free == 0)
+        free = e;
+    } else if(e->dev == dev && e->inum == inum && e->off == off){
+80105060:	39 38                	cmp    %edi,(%eax)
+80105062:	0f 84 a0 00 00 00    	je     80105108 <pcput+0xd8>
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+80105068:	83 c0 10             	add    $0x10,%eax
+8010506b:	3d f4 11 18 80       	cmp    $0x801811f4,%eax
+80105070:	74 16                	je     80105088 <pcput+0x58>
+    if(e->page == 0){
+80105072:	8b 70 0c             	mov    0xc(%eax),%esi
+80105075:	85 f6                	test   %esi,%esi
+80105077:	75 e7                	jne    80105060 <pcput+0x30>
+      if(free == 0)
+80105079:	85 db                	test   %ebx,%ebx
+8010507b:	0f 44 d8             	cmove  %eax,%ebx
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+8010507e:	83 c0 10             	add    $0x10,%eax
+80105081:	3d f4 11 18 80       	cmp    $0x801811f4,%eax
+80105086:	75 ea                	jne    80105072 <pcput+0x42>
+      release(&pcache.lock);
+      return 0;
+    }
+  }
+  // Full: replace the next page no process maps, clock order.
+  for(i = 0; free == 0 && i < NPCACHE; i++){
+80105088:	85 db                	test   %ebx,%ebx
+8010508a:	0f 85 ef 00 00 00    	jne    8010517f <pcput+0x14f>
+80105090:	89 7d 08             	mov    %edi,0x8(%ebp)
+80105093:	be 00 02 00 00       	mov    $0x200,%esi
+80105098:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+8010509b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010509f:	90                   	nop
+    e = &pcache.e[pcache.hand];
+801050a0:	8b 15 f4 11 18 80    	mov    0x801811f4,%edx
+    pcache.hand = (pcache.hand + 1) % NPCACHE;
+    if(krefcnt(e->page) == 1){
+801050a6:	83 ec 0c             	sub    $0xc,%esp
+    pcache.hand = (pcache.hand + 1) % NPCACHE;
+801050a9:	8d 42 01             	lea    0x1(%edx),%eax
+    if(krefcnt(e->page) == 1){
+801050ac:	83 c2 03             	add    $0x3,%edx
+    pcache.hand = (pcache.hand + 1) % NPCACHE;
+801050af:	89 c1                	mov    %eax,%ecx
+    if(krefcnt(e->page) == 1){
+801050b1:	c1 e2 04             	shl    $0x4,%edx
+    pcache.hand = (pcache.hand + 1) % NPCACHE;
+801050b4:	c1 f9 1f             	sar    $0x1f,%ecx
+    if(krefcnt(e->page) == 1){
+801050b7:	89 d3                	mov    %edx,%ebx
+801050b9:	8d ba c0 f1 17 80    	lea    -0x7fe80e40(%edx),%edi
+    pcache.hand = (pcache.hand + 1) % NPCACHE;
+801050bf:	c1 e9 17             	shr    $0x17,%ecx
+801050c2:	01 c8                	add    %ecx,%eax
+801050c4:	25 ff 01 00 00       	and    $0x1ff,%eax
+801050c9:	29 c8                	sub    %ecx,%eax
+801050cb:	a3 f4 11 18 80       	mov    %eax,0x801811f4
+    if(krefcnt(e->page) == 1){
+801050d0:	ff b2 d0 f1 17 80    	push   -0x7fe80e30(%edx)
+801050d6:	e8 d5 e9 ff ff       	call   80103ab0 <krefcnt>
+801050db:	83 c4 10             	add    $0x10,%esp
+801050de:	83 f8 01             	cmp    $0x1,%eax
+801050e1:	74 3d                	je     80105120 <pcput+0xf0>
+  for(i = 0; free == 0 && i < NPCACHE; i++){
+801050e3:	83 ee 01             	sub    $0x1,%esi
+801050e6:	75 b8                	jne    801050a0 <pcput+0x70>
+    free->dev = dev;
+    free->inum = inum;
+    free->off = off;
+    free->page = page;
+  }
+  release(&pcache.lock);
+801050e8:	83 ec 0c             	sub    $0xc,%esp
+801050eb:	68 c0 f1 17 80       	push   $0x8017f1c0
+801050f0:	e8 8b 1e 00 00       	call   80106f80 <release>
+801050f5:	83 c4 10             	add    $0x10,%esp
+  if(old)
+    kfree(old);
+  return free != 0;
+}
+801050f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  release(&pcache.lock);
+801050fb:	31 c0                	xor    %eax,%eax
+}
+801050fd:	5b                   	pop    %ebx
+801050fe:	5e                   	pop    %esi
+801050ff:	5f                   	pop    %edi
+80105100:	5d                   	pop    %ebp
+80105101:	c3                   	ret
+80105102:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(e->dev == dev && e->inum == inum && e->off == off){
+80105108:	39 48 04             	cmp    %ecx,0x4(%eax)
+8010510b:	0f 85 57 ff ff ff    	jne    80105068 <pcput+0x38>
+80105111:	39 50 08             	cmp    %edx,0x8(%eax)
+80105114:	0f 85 4e ff ff ff    	jne    80105068 <pcput+0x38>
+8010511a:	eb cc                	jmp    801050e8 <pcput+0xb8>
+8010511c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    e = &pcache.e[pcache.hand];
+80105120:	89 fe                	mov    %edi,%esi
+80105122:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80105125:	8b 7d 08             	mov    0x8(%ebp),%edi
+80105128:	81 c3 c4 f1 17 80    	add    $0x8017f1c4,%ebx
+      old = e->page;
+8010512e:	8b 76 10             	mov    0x10(%esi),%esi
+    kdup(page);
+80105131:	83 ec 0c             	sub    $0xc,%esp
+80105134:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+80105137:	ff 75 14             	push   0x14(%ebp)
+8010513a:	e8 51 e9 ff ff       	call   80103a90 <kdup>
+    free->off = off;
+8010513f:	8b 45 10             	mov    0x10(%ebp),%eax
+    free->inum = inum;
+80105142:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    free->dev = dev;
+80105145:	89 3b                	mov    %edi,(%ebx)
+    free->off = off;
+80105147:	89 43 08             	mov    %eax,0x8(%ebx)
+    free->page = page;
+8010514a:	8b 45 14             	mov    0x14(%ebp),%eax
+    free->inum = inum;
+8010514d:	89 4b 04             	mov    %ecx,0x4(%ebx)
+    free->page = page;
+80105150:	89 43 0c             	mov    %eax,0xc(%ebx)
+  release(&pcache.lock);
+80105153:	c7 04 24 c0 f1 17 80 	movl   $0x8017f1c0,(%esp)
+8010515a:	e8 21 1e 00 00       	call   80106f80 <release>
+  if(old)
+8010515f:	83 c4 10             	add    $0x10,%esp
+80105162:	85 f6                	test   %esi,%esi
+80105164:	74 0c                	je     80105172 <pcput+0x142>
+    kfree(old);
+80105166:	83 ec 0c             	sub    $0xc,%esp
+80105169:	56                   	push   %esi
+8010516a:	e8 41 e4 ff ff       	call   801035b0 <kfree>
+8010516f:	83 c4 10             	add    $0x10,%esp
+}
+80105172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  old = 0;
+80105175:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+8010517a:	5b                   	pop    %ebx
+8010517b:	5e                   	pop    %esi
+8010517c:	5f                   	pop    %edi
+8010517d:	5d                   	pop    %ebp
+8010517e:	c3                   	ret
+  old = 0;
+8010517f:	31 f6                	xor    %esi,%esi
+80105181:	eb ae                	jmp    80105131 <pcput+0x101>
+80105183:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010518a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105190 <pcinval>:
+
+// Forget the cached pages of inode (dev, inum).
+void
+pcinval(uint dev, uint inum)
+{
+80105190:	55                   	push   %ebp
+80105191:	89 e5                	mov    %esp,%ebp
+80105193:	57                   	push   %edi
+80105194:	56                   	push   %esi
+80105195:	53                   	push   %ebx
+  struct pcentry *e;
+
+  acquire(&pcache.lock);
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+80105196:	bb f4 f1 17 80       	mov    $0x8017f1f4,%ebx
+{
+8010519b:	83 ec 18             	sub    $0x18,%esp
+8010519e:	8b 75 08             	mov    0x8(%ebp),%esi
+801051a1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  acquire(&pcache.lock);
+801051a4:	68 c0 f1 17 80       	push   $0x8017f1c0
+801051a9:	e8 b2 1b 00 00       	call   80106d60 <acquire>
+801051ae:	83 c4 10             	add    $0x10,%esp
+801051b1:	eb 10                	jmp    801051c3 <pcinval+0x33>
+801051b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801051b7:	90                   	nop
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+801051b8:	83 c3 10             	add    $0x10,%ebx
+801051bb:	81 fb f4 11 18 80    	cmp    $0x801811f4,%ebx
+801051c1:	74 2e                	je     801051f1 <pcinval+0x61>
+    if(e->page && e->dev == dev && e->inum == inum){
+801051c3:	8b 43 0c             	mov    0xc(%ebx),%eax
+801051c6:	85 c0                	test   %eax,%eax
+801051c8:	74 ee                	je     801051b8 <pcinval+0x28>
+801051ca:	39 33                	cmp    %esi,(%ebx)
+801051cc:	75 ea                	jne    801051b8 <pcinval+0x28>
+801051ce:	39 7b 04             	cmp    %edi,0x4(%ebx)
+801051d1:	75 e5                	jne    801051b8 <pcinval+0x28>
+      kfree(e->page);
+801051d3:	83 ec 0c             	sub    $0xc,%esp
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+801051d6:	83 c3 10             	add    $0x10,%ebx
+      kfree(e->page);
+801051d9:	50                   	push   %eax
+801051da:	e8 d1 e3 ff ff       	call   801035b0 <kfree>
+      e->page = 0;
+801051df:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+801051e6:	83 c4 10             	add    $0x10,%esp
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+801051e9:	81 fb f4 11 18 80    	cmp    $0x801811f4,%ebx
+801051ef:	75 d2                	jne    801051c3 <pcinval+0x33>
+    }
+  }
+  release(&pcache.lock);
+801051f1:	c7 45 08 c0 f1 17 80 	movl   $0x8017f1c0,0x8(%ebp)
+}
+801051f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801051fb:	5b                   	pop    %ebx
+801051fc:	5e                   	pop    %esi
+801051fd:	5f                   	pop    %edi
+801051fe:	5d                   	pop    %ebp
+  release(&pcache.lock);
+801051ff:	e9 7c 1d 00 00       	jmp    80106f80 <release>
+80105204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010520b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010520f:	90                   	nop
+
+80105210 <pcshrink>:
+// Free up to n cached pages that no process maps.
+// Called by kalloc() when it runs out of memory.
+// Returns pages freed.
+int
+pcshrink(int n)
+{
+80105210:	55                   	push   %ebp
+80105211:	89 e5                	mov    %esp,%ebp
+80105213:	57                   	push   %edi
+80105214:	56                   	push   %esi
+  struct pcentry *e;
+  int nfreed;
+
+  nfreed = 0;
+80105215:	31 f6                	xor    %esi,%esi
+{
+80105217:	53                   	push   %ebx
+80105218:	83 ec 18             	sub    $0x18,%esp
+8010521b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&pcache.lock);
+8010521e:	68 c0 f1 17 80       	push   $0x8017f1c0
+80105223:	e8 38 1b 00 00       	call   80106d60 <acquire>
+  for(e = pcache.e; e < &pcache.e[NPCACHE] && nfreed < n; e++){
+80105228:	83 c4 10             	add    $0x10,%esp
+8010522b:	85 ff                	test   %edi,%edi
+8010522d:	7e 57                	jle    80105286 <pcshrink+0x76>
+8010522f:	bb f4 f1 17 80       	mov    $0x8017f1f4,%ebx
+80105234:	eb 19                	jmp    8010524f <pcshrink+0x3f>
+80105236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010523d:	8d 76 00             	lea    0x0(%esi),%esi
+80105240:	83 c3 10             	add    $0x10,%ebx
+80105243:	39 fe                	cmp    %edi,%esi
+80105245:	7d 3f                	jge    80105286 <pcshrink+0x76>
+80105247:	81 fb f4 11 18 80    	cmp    $0x801811f4,%ebx
+8010524d:	73 37                	jae    80105286 <pcshrink+0x76>
+    if(e->page && krefcnt(e->page) == 1){
+8010524f:	8b 43 0c             	mov    0xc(%ebx),%eax
+80105252:	85 c0                	test   %eax,%eax
+80105254:	74 ea                	je     80105240 <pcshrink+0x30>
+80105256:	83 ec 0c             	sub    $0xc,%esp
+80105259:	50                   	push   %eax
+8010525a:	e8 51 e8 ff ff       	call   80103ab0 <krefcnt>
+8010525f:	83 c4 10             	add    $0x10,%esp
+80105262:	83 f8 01             	cmp    $0x1,%eax
+80105265:	75 d9                	jne    80105240 <pcshrink+0x30>
+      kfree(e->page);
+80105267:	83 ec 0c             	sub    $0xc,%esp
+8010526a:	ff 73 0c             	push   0xc(%ebx)
+      e->page = 0;
+      nfreed++;
+8010526d:	83 c6 01             	add    $0x1,%esi
+  for(e = pcache.e; e < &pcache.e[NPCACHE] && nfreed < n; e++){
+80105270:	83 c3 10             	add    $0x10,%ebx
+      kfree(e->page);
+80105273:	e8 38 e3 ff ff       	call   801035b0 <kfree>
+      e->page = 0;
+80105278:	c7 43 fc 00 00 00 00 	movl   $0x0,-0x4(%ebx)
+      nfreed++;
+8010527f:	83 c4 10             	add    $0x10,%esp
+  for(e = pcache.e; e < &pcache.e[NPCACHE] && nfreed < n; e++){
+80105282:	39 fe                	cmp    %edi,%esi
+80105284:	7c c1                	jl     80105247 <pcshrink+0x37>
+    }
+  }
+  release(&pcache.lock);
+80105286:	83 ec 0c             	sub    $0xc,%esp
+80105289:	68 c0 f1 17 80       	push   $0x8017f1c0
+8010528e:	e8 ed 1c 00 00       	call   80106f80 <release>
+  return nfreed;
+}
+80105293:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105296:	89 f0                	mov    %esi,%eax
+80105298:	5b                   	pop    %ebx
+80105299:	5e                   	pop    %esi
+8010529a:	5f                   	pop    %edi
+8010529b:	5d                   	pop    %ebp
+8010529c:	c3                   	ret
+8010529d:	66 90                	xchg   %ax,%ax
+8010529f:	90                   	nop
+
+801052a0 <picenable>:
+  outb(IO_PIC2+1, mask >> 8);
+}
+
+void
+picenable(int irq)
+{
+801052a0:	55                   	push   %ebp
+  picsetmask(irqmask & ~(1<<irq));
+801052a1:	0f b7 05 00 e0 10 80 	movzwl 0x8010e000,%eax
+{
+801052a8:	89 e5                	mov    %esp,%ebp
+  picsetmask(irqmask & ~(1<<irq));
+801052aa:	8b 55 08             	mov    0x8(%ebp),%edx
+801052ad:	0f b3 d0             	btr    %edx,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801052b0:	ba 21 00 00 00       	mov    $0x21,%edx
+  irqmask = mask;
+801052b5:	66 a3 00 e0 10 80    	mov    %ax,0x8010e000
+801052bb:	ee                   	out    %al,(%dx)
+801052bc:	ba a1 00 00 00       	mov    $0xa1,%edx
+  outb(IO_PIC2+1, mask >> 8);
+801052c1:	66 c1 e8 08          	shr    $0x8,%ax
+801052c5:	ee                   	out    %al,(%dx)
+}
+801052c6:	5d                   	pop    %ebp
+801052c7:	c3                   	ret
+801052c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801052cf:	90                   	nop
+
+801052d0 <picinit>:
+
+// Initialize the 8259A interrupt controllers.
+void
+picinit(void)
+{
+801052d0:	55                   	push   %ebp
+801052d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801052d6:	89 e5                	mov    %esp,%ebp
+801052d8:	57                   	push   %edi
+801052d9:	56                   	push   %esi
+801052da:	53                   	push   %ebx
+801052db:	bb 21 00 00 00       	mov    $0x21,%ebx
+801052e0:	89 da                	mov    %ebx,%edx
+801052e2:	ee                   	out    %al,(%dx)
+801052e3:	b9 a1 00 00 00       	mov    $0xa1,%ecx
+801052e8:	89 ca                	mov    %ecx,%edx
+801052ea:	ee                   	out    %al,(%dx)
+801052eb:	be 11 00 00 00       	mov    $0x11,%esi
+801052f0:	ba 20 00 00 00       	mov    $0x20,%edx
+801052f5:	89 f0                	mov    %esi,%eax
+801052f7:	ee                   	out    %al,(%dx)
+801052f8:	b8 20 00 00 00       	mov    $0x20,%eax
+801052fd:	89 da                	mov    %ebx,%edx
+801052ff:	ee                   	out    %al,(%dx)
+80105300:	b8 04 00 00 00       	mov    $0x4,%eax
+80105305:	ee                   	out    %al,(%dx)
+80105306:	bf 03 00 00 00       	mov    $0x3,%edi
+8010530b:	89 f8                	mov    %edi,%eax
+8010530d:	ee                   	out    %al,(%dx)
+8010530e:	ba a0 00 00 00       	mov    $0xa0,%edx
+80105313:	89 f0                	mov    %esi,%eax
+80105315:	ee                   	out    %al,(%dx)
+80105316:	b8 28 00 00 00       	mov    $0x28,%eax
+8010531b:	89 ca                	mov    %ecx,%edx
+8010531d:	ee                   	out    %al,(%dx)
+8010531e:	b8 02 00 00 00       	mov    $0x2,%eax
+80105323:	ee                   	out    %al,(%dx)
+80105324:	89 f8                	mov    %edi,%eax
+80105326:	ee                   	out    %al,(%dx)
+80105327:	bf 68 00 00 00       	mov    $0x68,%edi
+8010532c:	ba 20 00 00 00       	mov    $0x20,%edx
+80105331:	89 f8                	mov    %edi,%eax
+80105333:	ee                   	out    %al,(%dx)
+80105334:	be 0a 00 00 00       	mov    $0xa,%esi
+80105339:	89 f0                	mov    %esi,%eax
+8010533b:	ee                   	out    %al,(%dx)
+8010533c:	ba a0 00 00 00       	mov    $0xa0,%edx
+80105341:	89 f8                	mov    %edi,%eax
+80105343:	ee                   	out    %al,(%dx)
+80105344:	89 f0                	mov    %esi,%eax
+80105346:	ee                   	out    %al,(%dx)
+  outb(IO_PIC1, 0x0a);             // read IRR by default
+
+  outb(IO_PIC2, 0x68);             // OCW3
+  outb(IO_PIC2, 0x0a);             // OCW3
+
+  if(irqmask != 0xFFFF)
+80105347:	0f b7 05 00 e0 10 80 	movzwl 0x8010e000,%eax
+8010534e:	66 83 f8 ff          	cmp    $0xffff,%ax
+80105352:	74 0a                	je     8010535e <picinit+0x8e>
+80105354:	89 da                	mov    %ebx,%edx
+80105356:	ee                   	out    %al,(%dx)
+  outb(IO_PIC2+1, mask >> 8);
+80105357:	66 c1 e8 08          	shr    $0x8,%ax
+8010535b:	89 ca                	mov    %ecx,%edx
+8010535d:	ee                   	out    %al,(%dx)
+    picsetmask(irqmask);
+}
+8010535e:	5b                   	pop    %ebx
+8010535f:	5e                   	pop    %esi
+80105360:	5f                   	pop    %edi
+80105361:	5d                   	pop    %ebp
+80105362:	c3                   	ret
+80105363:	66 90                	xchg   %ax,%ax
+80105365:	66 90                	xchg   %ax,%ax
+80105367:	66 90                	xchg   %ax,%ax
+80105369:	66 90                	xchg   %ax,%ax
+8010536b:	66 90                	xchg   %ax,%ax
+8010536d:	66 90                	xchg   %ax,%ax
+8010536f:	90                   	nop
+
+80105370 <pipealloc>:
+  int writeopen;  // write fd is still open
+};
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+80105370:	55                   	push   %ebp
+80105371:	89 e5                	mov    %esp,%ebp
+80105373:	57                   	push   %edi
+80105374:	56                   	push   %esi
+80105375:	53                   	push   %ebx
+80105376:	83 ec 0c             	sub    $0xc,%esp
+80105379:	8b 75 08             	mov    0x8(%ebp),%esi
+8010537c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct pipe *p;
+
+  p = 0;
+  *f0 = *f1 = 0;
+8010537f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+80105385:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+8010538b:	e8 00 c4 ff ff       	call   80101790 <filealloc>
+80105390:	89 06                	mov    %eax,(%esi)
+80105392:	85 c0                	test   %eax,%eax
+80105394:	0f 84 a5 00 00 00    	je     8010543f <pipealloc+0xcf>
+8010539a:	e8 f1 c3 ff ff       	call   80101790 <filealloc>
+8010539f:	89 07                	mov    %eax,(%edi)
+801053a1:	85 c0                	test   %eax,%eax
+801053a3:	0f 84 84 00 00 00    	je     8010542d <pipealloc+0xbd>
+    goto bad;
+  if((p = (struct pipe*)kalloc()) == 0)
+801053a9:	e8 a2 e4 ff ff       	call   80103850 <kalloc>
+801053ae:	89 c3                	mov    %eax,%ebx
+801053b0:	85 c0                	test   %eax,%eax
+801053b2:	0f 84 a0 00 00 00    	je     80105458 <pipealloc+0xe8>
+    goto bad;
+  p->readopen = 1;
+801053b8:	c7 80 3c 02 00 00 01 	movl   $0x1,0x23c(%eax)
+801053bf:	00 00 00 
+  p->writeopen = 1;
+  p->nwrite = 0;
+  p->nread = 0;
+  initlock(&p->lock, "pipe");
+801053c2:	83 ec 08             	sub    $0x8,%esp
+  p->writeopen = 1;
+801053c5:	c7 80 40 02 00 00 01 	movl   $0x1,0x240(%eax)
+801053cc:	00 00 00 
+  p->nwrite = 0;
+801053cf:	c7 80 38 02 00 00 00 	movl   $0x0,0x238(%eax)
+801053d6:	00 00 00 
+  p->nread = 0;
+801053d9:	c7 80 34 02 00 00 00 	movl   $0x0,0x234(%eax)
+801053e0:	00 00 00 
+  initlock(&p->lock, "pipe");
+801053e3:	68 a5 b9 10 80       	push   $0x8010b9a5
+801053e8:	50                   	push   %eax
+801053e9:	e8 52 19 00 00       	call   80106d40 <initlock>
+  (*f0)->type = FD_PIPE;
+801053ee:	8b 06                	mov    (%esi),%eax
+  (*f0)->pipe = p;
+  (*f1)->type = FD_PIPE;
+  (*f1)->readable = 0;
+  (*f1)->writable = 1;
+  (*f1)->pipe = p;
+  return 0;
+801053f0:	83 c4 10             	add    $0x10,%esp
+  (*f0)->type = FD_PIPE;
+801053f3:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+801053f9:	8b 06                	mov    (%esi),%eax
+801053fb:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+801053ff:	8b 06                	mov    (%esi),%eax
+80105401:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+80105405:	8b 06                	mov    (%esi),%eax
+80105407:	89 58 0c             	mov    %ebx,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+8010540a:	8b 07                	mov    (%edi),%eax
+8010540c:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+80105412:	8b 07                	mov    (%edi),%eax
+80105414:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+80105418:	8b 07                	mov    (%edi),%eax
+8010541a:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+8010541e:	8b 07                	mov    (%edi),%eax
+80105420:	89 58 0c             	mov    %ebx,0xc(%eax)
+  return 0;
+80105423:	31 c0                	xor    %eax,%eax
+  if(*f0)
+    fileclose(*f0);
+  if(*f1)
+    fileclose(*f1);
+  return -1;
+}
+80105425:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105428:	5b                   	pop    %ebx
+80105429:	5e                   	pop    %esi
+8010542a:	5f                   	pop    %edi
+8010542b:	5d                   	pop    %ebp
+8010542c:	c3                   	ret
+  if(*f0)
+8010542d:	8b 06                	mov    (%esi),%eax
+8010542f:	85 c0                	test   %eax,%eax
+80105431:	74 1e                	je     80105451 <pipealloc+0xe1>
+    fileclose(*f0);
+80105433:	83 ec 0c             	sub    $0xc,%esp
+80105436:	50                   	push   %eax
+80105437:	e8 14 c4 ff ff       	call   80101850 <fileclose>
+8010543c:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+8010543f:	8b 07                	mov    (%edi),%eax
+80105441:	85 c0                	test   %eax,%eax
+80105443:	74 0c                	je     80105451 <pipealloc+0xe1>
+    fileclose(*f1);
+80105445:	83 ec 0c             	sub    $0xc,%esp
+80105448:	50                   	push   %eax
+80105449:	e8 02 c4 ff ff       	call   80101850 <fileclose>
+8010544e:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80105451:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105456:	eb cd                	jmp    80105425 <pipealloc+0xb5>
+  if(*f0)
+80105458:	8b 06                	mov    (%esi),%eax
+8010545a:	85 c0                	test   %eax,%eax
+8010545c:	75 d5                	jne    80105433 <pipealloc+0xc3>
+8010545e:	eb df                	jmp    8010543f <pipealloc+0xcf>
+
+80105460 <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+80105460:	55                   	push   %ebp
+80105461:	89 e5                	mov    %esp,%ebp
+80105463:	56                   	push   %esi
+80105464:	53                   	push   %ebx
+80105465:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80105468:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&p->lock);
+8010546b:	83 ec 0c             	sub    $0xc,%esp
+8010546e:	53                   	push   %ebx
+8010546f:	e8 ec 18 00 00       	call   80106d60 <acquire>
+  if(writable){
+80105474:	83 c4 10             	add    $0x10,%esp
+80105477:	85 f6                	test   %esi,%esi
+80105479:	74 65                	je     801054e0 <pipeclose+0x80>
+    p->writeopen = 0;
+    wakeup(&p->nread);
+8010547b:	83 ec 0c             	sub    $0xc,%esp
+8010547e:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+    p->writeopen = 0;
+80105484:	c7 83 40 02 00 00 00 	movl   $0x0,0x240(%ebx)
+8010548b:	00 00 00 
+    wakeup(&p->nread);
+8010548e:	50                   	push   %eax
+8010548f:	e8 4c 12 00 00       	call   801066e0 <wakeup>
+80105494:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+80105497:	8b 93 3c 02 00 00    	mov    0x23c(%ebx),%edx
+8010549d:	85 d2                	test   %edx,%edx
+8010549f:	75 0a                	jne    801054ab <pipeclose+0x4b>
+801054a1:	8b 83 40 02 00 00    	mov    0x240(%ebx),%eax
+801054a7:	85 c0                	test   %eax,%eax
+801054a9:	74 15                	je     801054c0 <pipeclose+0x60>
+    release(&p->lock);
+    kfree((char*)p);
+  } else
+    release(&p->lock);
+801054ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+801054ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801054b1:	5b                   	pop    %ebx
+801054b2:	5e                   	pop    %esi
+801054b3:	5d                   	pop    %ebp
+    release(&p->lock);
+801054b4:	e9 c7 1a 00 00       	jmp    80106f80 <release>
+801054b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&p->lock);
+801054c0:	83 ec 0c             	sub    $0xc,%esp
+801054c3:	53                   	push   %ebx
+801054c4:	e8 b7 1a 00 00       	call   80106f80 <release>
+    kfree((char*)p);
+801054c9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+801054cc:	83 c4 10             	add    $0x10,%esp
+}
+801054cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801054d2:	5b                   	pop    %ebx
+801054d3:	5e                   	pop    %esi
+801054d4:	5d                   	pop    %ebp
+    kfree((char*)p);
+801054d5:	e9 d6 e0 ff ff       	jmp    801035b0 <kfree>
+801054da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wakeup(&p->nwrite);
+801054e0:	83 ec 0c             	sub    $0xc,%esp
+801054e3:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+    p->readopen = 0;
+801054e9:	c7 83 3c 02 00 00 00 	movl   $0x0,0x23c(%ebx)
+801054f0:	00 00 00 
+    wakeup(&p->nwrite);
+801054f3:	50                   	push   %eax
+801054f4:	e8 e7 11 00 00       	call   801066e0 <wakeup>
+801054f9:	83 c4 10             	add    $0x10,%esp
+801054fc:	eb 99                	jmp    80105497 <pipeclose+0x37>
+801054fe:	66 90                	xchg   %ax,%ax
+
+80105500 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+80105500:	55                   	push   %ebp
+80105501:	89 e5                	mov    %esp,%ebp
+80105503:	57                   	push   %edi
+80105504:	56                   	push   %esi
+80105505:	53                   	push   %ebx
+80105506:	83 ec 28             	sub    $0x28,%esp
+80105509:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010550c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+8010550f:	53                   	push   %ebx
+80105510:	e8 4b 18 00 00       	call   80106d60 <acquire>
+  for(i = 0; i < n; i++){
+80105515:	83 c4 10             	add    $0x10,%esp
+80105518:	85 ff                	test   %edi,%edi
+8010551a:	0f 8e ce 00 00 00    	jle    801055ee <pipewrite+0xee>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80105520:	8b 83 38 02 00 00    	mov    0x238(%ebx),%eax
+80105526:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80105529:	89 7d 10             	mov    %edi,0x10(%ebp)
+8010552c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010552f:	8d 34 39             	lea    (%ecx,%edi,1),%esi
+80105532:	89 75 e0             	mov    %esi,-0x20(%ebp)
+      if(p->readopen == 0 || proc->killed){
+        release(&p->lock);
+        return -1;
+      }
+      wakeup(&p->nread);
+80105535:	8d b3 34 02 00 00    	lea    0x234(%ebx),%esi
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+8010553b:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80105541:	8d bb 38 02 00 00    	lea    0x238(%ebx),%edi
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80105547:	8d 90 00 02 00 00    	lea    0x200(%eax),%edx
+8010554d:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+80105550:	0f 85 b6 00 00 00    	jne    8010560c <pipewrite+0x10c>
+80105556:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80105559:	eb 3e                	jmp    80105599 <pipewrite+0x99>
+8010555b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010555f:	90                   	nop
+      if(p->readopen == 0 || proc->killed){
+80105560:	65 8b 15 04 00 00 00 	mov    %gs:0x4,%edx
+80105567:	8b 4a 68             	mov    0x68(%edx),%ecx
+8010556a:	85 c9                	test   %ecx,%ecx
+8010556c:	75 35                	jne    801055a3 <pipewrite+0xa3>
+      wakeup(&p->nread);
+8010556e:	83 ec 0c             	sub    $0xc,%esp
+80105571:	56                   	push   %esi
+80105572:	e8 69 11 00 00       	call   801066e0 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80105577:	58                   	pop    %eax
+80105578:	5a                   	pop    %edx
+80105579:	53                   	push   %ebx
+8010557a:	57                   	push   %edi
+8010557b:	e8 90 0f 00 00       	call   80106510 <sleep>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80105580:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+80105586:	8b 93 38 02 00 00    	mov    0x238(%ebx),%edx
+8010558c:	83 c4 10             	add    $0x10,%esp
+8010558f:	8d 88 00 02 00 00    	lea    0x200(%eax),%ecx
+80105595:	39 ca                	cmp    %ecx,%edx
+80105597:	75 27                	jne    801055c0 <pipewrite+0xc0>
+      if(p->readopen == 0 || proc->killed){
+80105599:	8b 83 3c 02 00 00    	mov    0x23c(%ebx),%eax
+8010559f:	85 c0                	test   %eax,%eax
+801055a1:	75 bd                	jne    80105560 <pipewrite+0x60>
+        release(&p->lock);
+801055a3:	83 ec 0c             	sub    $0xc,%esp
+801055a6:	53                   	push   %ebx
+801055a7:	e8 d4 19 00 00       	call   80106f80 <release>
+        return -1;
+801055ac:	83 c4 10             	add    $0x10,%esp
+801055af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  release(&p->lock);
+  return n;
+}
+801055b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801055b7:	5b                   	pop    %ebx
+801055b8:	5e                   	pop    %esi
+801055b9:	5f                   	pop    %edi
+801055ba:	5d                   	pop    %ebp
+801055bb:	c3                   	ret
+801055bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801055c0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+801055c3:	8d 42 01             	lea    0x1(%edx),%eax
+801055c6:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+  for(i = 0; i < n; i++){
+801055cc:	83 c1 01             	add    $0x1,%ecx
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+801055cf:	89 83 38 02 00 00    	mov    %eax,0x238(%ebx)
+801055d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801055d8:	0f b6 41 ff          	movzbl -0x1(%ecx),%eax
+801055dc:	88 44 13 34          	mov    %al,0x34(%ebx,%edx,1)
+  for(i = 0; i < n; i++){
+801055e0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801055e3:	39 c1                	cmp    %eax,%ecx
+801055e5:	0f 85 50 ff ff ff    	jne    8010553b <pipewrite+0x3b>
+801055eb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+801055ee:	83 ec 0c             	sub    $0xc,%esp
+801055f1:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+801055f7:	50                   	push   %eax
+801055f8:	e8 e3 10 00 00       	call   801066e0 <wakeup>
+  release(&p->lock);
+801055fd:	89 1c 24             	mov    %ebx,(%esp)
+80105600:	e8 7b 19 00 00       	call   80106f80 <release>
+  return n;
+80105605:	83 c4 10             	add    $0x10,%esp
+80105608:	89 f8                	mov    %edi,%eax
+8010560a:	eb a8                	jmp    801055b4 <pipewrite+0xb4>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+8010560c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010560f:	eb b2                	jmp    801055c3 <pipewrite+0xc3>
+80105611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105618:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010561f:	90                   	nop
+
+80105620 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+80105620:	55                   	push   %ebp
+80105621:	89 e5                	mov    %esp,%ebp
+80105623:	57                   	push   %edi
+80105624:	56                   	push   %esi
+80105625:	53                   	push   %ebx
+80105626:	83 ec 18             	sub    $0x18,%esp
+80105629:	8b 75 08             	mov    0x8(%ebp),%esi
+8010562c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+8010562f:	56                   	push   %esi
+80105630:	8d 9e 34 02 00 00    	lea    0x234(%esi),%ebx
+80105636:	e8 25 17 00 00       	call   80106d60 <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+8010563b:	8b 86 34 02 00 00    	mov    0x234(%esi),%eax
+80105641:	83 c4 10             	add    $0x10,%esp
+80105644:	39 86 38 02 00 00    	cmp    %eax,0x238(%esi)
+8010564a:	74 31                	je     8010567d <piperead+0x5d>
+8010564c:	eb 39                	jmp    80105687 <piperead+0x67>
+8010564e:	66 90                	xchg   %ax,%ax
+    if(proc->killed){
+80105650:	65 8b 15 04 00 00 00 	mov    %gs:0x4,%edx
+80105657:	8b 4a 68             	mov    0x68(%edx),%ecx
+8010565a:	85 c9                	test   %ecx,%ecx
+8010565c:	0f 85 8e 00 00 00    	jne    801056f0 <piperead+0xd0>
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80105662:	83 ec 08             	sub    $0x8,%esp
+80105665:	56                   	push   %esi
+80105666:	53                   	push   %ebx
+80105667:	e8 a4 0e 00 00       	call   80106510 <sleep>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+8010566c:	8b 86 38 02 00 00    	mov    0x238(%esi),%eax
+80105672:	83 c4 10             	add    $0x10,%esp
+80105675:	39 86 34 02 00 00    	cmp    %eax,0x234(%esi)
+8010567b:	75 0a                	jne    80105687 <piperead+0x67>
+8010567d:	8b 86 40 02 00 00    	mov    0x240(%esi),%eax
+80105683:	85 c0                	test   %eax,%eax
+80105685:	75 c9                	jne    80105650 <piperead+0x30>
+  }
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80105687:	8b 55 10             	mov    0x10(%ebp),%edx
+8010568a:	31 db                	xor    %ebx,%ebx
+8010568c:	85 d2                	test   %edx,%edx
+8010568e:	7f 27                	jg     801056b7 <piperead+0x97>
+80105690:	eb 33                	jmp    801056c5 <piperead+0xa5>
+80105692:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(p->nread == p->nwrite)
+      break;
+    addr[i] = p->data[p->nread++ % PIPESIZE];
+80105698:	8d 4a 01             	lea    0x1(%edx),%ecx
+8010569b:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+801056a1:	89 8e 34 02 00 00    	mov    %ecx,0x234(%esi)
+801056a7:	0f b6 54 16 34       	movzbl 0x34(%esi,%edx,1),%edx
+801056ac:	88 14 1f             	mov    %dl,(%edi,%ebx,1)
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+801056af:	83 c3 01             	add    $0x1,%ebx
+801056b2:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+801056b5:	74 0e                	je     801056c5 <piperead+0xa5>
+    if(p->nread == p->nwrite)
+801056b7:	8b 96 34 02 00 00    	mov    0x234(%esi),%edx
+801056bd:	3b 96 38 02 00 00    	cmp    0x238(%esi),%edx
+801056c3:	75 d3                	jne    80105698 <piperead+0x78>
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+801056c5:	83 ec 0c             	sub    $0xc,%esp
+801056c8:	8d 96 38 02 00 00    	lea    0x238(%esi),%edx
+801056ce:	52                   	push   %edx
+801056cf:	e8 0c 10 00 00       	call   801066e0 <wakeup>
+  release(&p->lock);
+801056d4:	89 34 24             	mov    %esi,(%esp)
+801056d7:	e8 a4 18 00 00       	call   80106f80 <release>
+  return i;
+801056dc:	83 c4 10             	add    $0x10,%esp
+}
+801056df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801056e2:	89 d8                	mov    %ebx,%eax
+801056e4:	5b                   	pop    %ebx
+801056e5:	5e                   	pop    %esi
+801056e6:	5f                   	pop    %edi
+801056e7:	5d                   	pop    %ebp
+801056e8:	c3                   	ret
+801056e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      release(&p->lock);
+801056f0:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+801056f3:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      release(&p->lock);
+801056f8:	56                   	push   %esi
+801056f9:	e8 82 18 00 00       	call   80106f80 <release>
+      return -1;
+801056fe:	83 c4 10             	add    $0x10,%esp
+}
+80105701:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105704:	89 d8                	mov    %ebx,%eax
+80105706:	5b                   	pop    %ebx
+80105707:	5e                   	pop    %esi
+80105708:	5f                   	pop    %edi
+80105709:	5d                   	pop    %ebp
+8010570a:	c3                   	ret
+8010570b:	66 90                	xchg   %ax,%ax
+8010570d:	66 90                	xchg   %ax,%ax
+8010570f:	90                   	nop
+
+80105710 <kthreadret>:
+
+// A new kernel thread's first scheduling by scheduler()
+// will swtch here, instead of to forkret.
+static void
+kthreadret(void)
+{
+80105710:	55                   	push   %ebp
+80105711:	89 e5                	mov    %esp,%ebp
+80105713:	83 ec 14             	sub    $0x14,%esp
+  // Still holding proc->lock from scheduler.
+  release(&proc->lock);
+80105716:	65 ff 35 04 00 00 00 	push   %gs:0x4
+8010571d:	e8 5e 18 00 00       	call   80106f80 <release>
+  proc->kfn();
+80105722:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80105728:	ff 90 c0 00 00 00    	call   *0xc0(%eax)
+  panic("kthread returned");
+8010572e:	c7 04 24 aa b9 10 80 	movl   $0x8010b9aa,(%esp)
+80105735:	e8 86 b4 ff ff       	call   80100bc0 <panic>
+8010573a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105740 <allocproc>:
+{
+80105740:	55                   	push   %ebp
+80105741:	89 e5                	mov    %esp,%ebp
+80105743:	53                   	push   %ebx
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80105744:	bb 34 12 18 80       	mov    $0x80181234,%ebx
+{
+80105749:	83 ec 04             	sub    $0x4,%esp
+8010574c:	eb 20                	jmp    8010576e <allocproc+0x2e>
+8010574e:	66 90                	xchg   %ax,%ax
+    release(&p->lock);
+80105750:	83 ec 0c             	sub    $0xc,%esp
+80105753:	53                   	push   %ebx
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80105754:	81 c3 34 01 00 00    	add    $0x134,%ebx
+    release(&p->lock);
+8010575a:	e8 21 18 00 00       	call   80106f80 <release>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+8010575f:	83 c4 10             	add    $0x10,%esp
+80105762:	81 fb 34 5f 18 80    	cmp    $0x80185f34,%ebx
+80105768:	0f 84 fd 00 00 00    	je     8010586b <allocproc+0x12b>
+    acquire(&p->lock);
+8010576e:	83 ec 0c             	sub    $0xc,%esp
+80105771:	53                   	push   %ebx
+80105772:	e8 e9 15 00 00       	call   80106d60 <acquire>
+    if(p->state == UNUSED)
+80105777:	8b 43 40             	mov    0x40(%ebx),%eax
+8010577a:	83 c4 10             	add    $0x10,%esp
+8010577d:	85 c0                	test   %eax,%eax
+8010577f:	75 cf                	jne    80105750 <allocproc+0x10>
+  release(&p->lock);
+80105781:	83 ec 0c             	sub    $0xc,%esp
+  p->state = EMBRYO;
+80105784:	c7 43 40 01 00 00 00 	movl   $0x1,0x40(%ebx)
+  p->nice = NICEDEFAULT;
+8010578b:	c7 83 20 01 00 00 03 	movl   $0x3,0x120(%ebx)
+80105792:	00 00 00 
+  p->pass = 0;
+80105795:	c7 83 24 01 00 00 00 	movl   $0x0,0x124(%ebx)
+8010579c:	00 00 00 
+  release(&p->lock);
+8010579f:	53                   	push   %ebx
+801057a0:	e8 db 17 00 00       	call   80106f80 <release>
+  acquire(&ptable.lock);
+801057a5:	c7 04 24 00 12 18 80 	movl   $0x80181200,(%esp)
+801057ac:	e8 af 15 00 00       	call   80106d60 <acquire>
+  p->pid = nextpid++;
+801057b1:	a1 08 e0 10 80       	mov    0x8010e008,%eax
+801057b6:	8d 50 01             	lea    0x1(%eax),%edx
+801057b9:	89 43 44             	mov    %eax,0x44(%ebx)
+801057bc:	89 15 08 e0 10 80    	mov    %edx,0x8010e008
+  release(&ptable.lock);
+801057c2:	c7 04 24 00 12 18 80 	movl   $0x80181200,(%esp)
+801057c9:	e8 b2 17 00 00       	call   80106f80 <release>
+  p->tracemask = 0;
+801057ce:	c7 43 48 00 00 00 00 	movl   $0x0,0x48(%ebx)
+801057d5:	c7 43 4c 00 00 00 00 	movl   $0x0,0x4c(%ebx)
+  p->tracewhen = TRACE_ANY;
+801057dc:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+  p->callstat = 0;
+801057e3:	c7 43 54 00 00 00 00 	movl   $0x0,0x54(%ebx)
+  if((p->kstack = kalloc()) == 0){
+801057ea:	e8 61 e0 ff ff       	call   80103850 <kalloc>
+801057ef:	83 c4 10             	add    $0x10,%esp
+801057f2:	89 43 3c             	mov    %eax,0x3c(%ebx)
+801057f5:	85 c0                	test   %eax,%eax
+801057f7:	74 6b                	je     80105864 <allocproc+0x124>
+  sp -= sizeof *p->tf;
+801057f9:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  memset(p->context, 0, sizeof *p->context);
+801057ff:	83 ec 04             	sub    $0x4,%esp
+  sp -= sizeof *p->context;
+80105802:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  sp -= sizeof *p->tf;
+80105807:	89 53 5c             	mov    %edx,0x5c(%ebx)
+  *(uint*)sp = (uint)trapret;
+8010580a:	c7 40 14 5f 94 10 80 	movl   $0x8010945f,0x14(%eax)
+  p->context = (struct context*)sp;
+80105811:	89 43 60             	mov    %eax,0x60(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+80105814:	6a 14                	push   $0x14
+80105816:	6a 00                	push   $0x0
+80105818:	50                   	push   %eax
+80105819:	e8 22 1a 00 00       	call   80107240 <memset>
+  p->context->eip = (uint)forkret;
+8010581e:	8b 43 60             	mov    0x60(%ebx),%eax
+  return p;
+80105821:	83 c4 10             	add    $0x10,%esp
+  p->context->eip = (uint)forkret;
+80105824:	c7 40 10 80 58 10 80 	movl   $0x80105880,0x10(%eax)
+}
+8010582b:	89 d8                	mov    %ebx,%eax
+  p->kfn = 0;
+8010582d:	c7 83 c0 00 00 00 00 	movl   $0x0,0xc0(%ebx)
+80105834:	00 00 00 
+  p->exe = 0;
+80105837:	c7 83 c4 00 00 00 00 	movl   $0x0,0xc4(%ebx)
+8010583e:	00 00 00 
+  p->nseg = 0;
+80105841:	c7 83 08 01 00 00 00 	movl   $0x0,0x108(%ebx)
+80105848:	00 00 00 
+  p->swappable = 0;
+8010584b:	c7 83 0c 01 00 00 00 	movl   $0x0,0x10c(%ebx)
+80105852:	00 00 00 
+  p->tlbcpu = -1;
+80105855:	c7 83 10 01 00 00 ff 	movl   $0xffffffff,0x110(%ebx)
+8010585c:	ff ff ff 
+}
+8010585f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105862:	c9                   	leave
+80105863:	c3                   	ret
+    p->state = UNUSED;
+80105864:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+  return 0;
+8010586b:	31 db                	xor    %ebx,%ebx
+}
+8010586d:	89 d8                	mov    %ebx,%eax
+8010586f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105872:	c9                   	leave
+80105873:	c3                   	ret
+80105874:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010587b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010587f:	90                   	nop
+
+80105880 <forkret>:
+
+// A fork child's very first scheduling by scheduler()
+// will swtch here.  "Return" to user space.
+void
+forkret(void)
+{
+80105880:	55                   	push   %ebp
+80105881:	89 e5                	mov    %esp,%ebp
+80105883:	83 ec 14             	sub    $0x14,%esp
+  static int first = 1;
+  // Still holding proc->lock from scheduler.
+  release(&proc->lock);
+80105886:	65 ff 35 04 00 00 00 	push   %gs:0x4
+8010588d:	e8 ee 16 00 00       	call   80106f80 <release>
+
+  if (first) {
+80105892:	a1 04 e0 10 80       	mov    0x8010e004,%eax
+80105897:	83 c4 10             	add    $0x10,%esp
+8010589a:	85 c0                	test   %eax,%eax
+8010589c:	75 02                	jne    801058a0 <forkret+0x20>
+    initlog(ROOTDEV);
+    swapinit(ROOTDEV);
+  }
+
+  // Return to "caller", actually trapret (see allocproc).
+}
+8010589e:	c9                   	leave
+8010589f:	c3                   	ret
+    first = 0;
+801058a0:	c7 05 04 e0 10 80 00 	movl   $0x0,0x8010e004
+801058a7:	00 00 00 
+    iinit(ROOTDEV);
+801058aa:	83 ec 0c             	sub    $0xc,%esp
+801058ad:	6a 01                	push   $0x1
+801058af:	e8 6c c6 ff ff       	call   80101f20 <iinit>
+    initlog(ROOTDEV);
+801058b4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+801058bb:	e8 80 ec ff ff       	call   80104540 <initlog>
+    swapinit(ROOTDEV);
+801058c0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+801058c7:	e8 d4 1e 00 00       	call   801077a0 <swapinit>
+}
+801058cc:	83 c4 10             	add    $0x10,%esp
+801058cf:	c9                   	leave
+801058d0:	c3                   	ret
+801058d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801058d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801058df:	90                   	nop
+
+801058e0 <rqfix>:
+{
+801058e0:	55                   	push   %ebp
+801058e1:	89 e5                	mov    %esp,%ebp
+801058e3:	57                   	push   %edi
+801058e4:	56                   	push   %esi
+  while(i > 0 && PASSLESS(rq->heap[i], rq->heap[(i-1)/2])){
+801058e5:	89 d6                	mov    %edx,%esi
+{
+801058e7:	53                   	push   %ebx
+801058e8:	83 ec 0c             	sub    $0xc,%esp
+  while(i > 0 && PASSLESS(rq->heap[i], rq->heap[(i-1)/2])){
+801058eb:	85 d2                	test   %edx,%edx
+801058ed:	7e 6a                	jle    80105959 <rqfix+0x79>
+801058ef:	8d 3c 95 00 00 00 00 	lea    0x0(,%edx,4),%edi
+801058f6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+801058f9:	89 7d f0             	mov    %edi,-0x10(%ebp)
+801058fc:	eb 25                	jmp    80105923 <rqfix+0x43>
+801058fe:	66 90                	xchg   %ax,%ax
+  rq->heap[i] = rq->heap[j];
+80105900:	89 59 34             	mov    %ebx,0x34(%ecx)
+  rq->heap[i]->rqidx = i;
+80105903:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  rq->heap[j] = p;
+80105906:	89 70 34             	mov    %esi,0x34(%eax)
+  rq->heap[i]->rqidx = i;
+80105909:	8b 49 34             	mov    0x34(%ecx),%ecx
+8010590c:	89 99 1c 01 00 00    	mov    %ebx,0x11c(%ecx)
+  rq->heap[j]->rqidx = j;
+80105912:	8b 40 34             	mov    0x34(%eax),%eax
+80105915:	89 90 1c 01 00 00    	mov    %edx,0x11c(%eax)
+  while(i > 0 && PASSLESS(rq->heap[i], rq->heap[(i-1)/2])){
+8010591b:	85 d2                	test   %edx,%edx
+8010591d:	0f 84 dd 00 00 00    	je     80105a00 <rqfix+0x120>
+80105923:	8b 45 e8             	mov    -0x18(%ebp),%eax
+80105926:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+80105929:	89 55 ec             	mov    %edx,-0x14(%ebp)
+8010592c:	8d 52 ff             	lea    -0x1(%edx),%edx
+8010592f:	d1 fa                	sar    %edx
+80105931:	8d 3c 95 00 00 00 00 	lea    0x0(,%edx,4),%edi
+80105938:	01 c1                	add    %eax,%ecx
+8010593a:	01 f8                	add    %edi,%eax
+8010593c:	8b 71 34             	mov    0x34(%ecx),%esi
+8010593f:	89 7d f0             	mov    %edi,-0x10(%ebp)
+80105942:	8b 58 34             	mov    0x34(%eax),%ebx
+80105945:	8b bb 24 01 00 00    	mov    0x124(%ebx),%edi
+8010594b:	39 be 24 01 00 00    	cmp    %edi,0x124(%esi)
+80105951:	78 ad                	js     80105900 <rqfix+0x20>
+80105953:	8b 75 ec             	mov    -0x14(%ebp),%esi
+80105956:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    if(c >= rq->n)
+80105959:	8b 90 34 01 00 00    	mov    0x134(%eax),%edx
+    c = 2*i + 1;
+8010595f:	8d 4c 36 01          	lea    0x1(%esi,%esi,1),%ecx
+    if(c >= rq->n)
+80105963:	39 ca                	cmp    %ecx,%edx
+80105965:	0f 8e 8d 00 00 00    	jle    801059f8 <rqfix+0x118>
+8010596b:	89 75 f0             	mov    %esi,-0x10(%ebp)
+8010596e:	eb 5f                	jmp    801059cf <rqfix+0xef>
+    if(c+1 < rq->n && PASSLESS(rq->heap[c+1], rq->heap[c]))
+80105970:	8b 7c 90 34          	mov    0x34(%eax,%edx,4),%edi
+80105974:	39 b7 24 01 00 00    	cmp    %esi,0x124(%edi)
+8010597a:	0f 48 b7 24 01 00 00 	cmovs  0x124(%edi),%esi
+80105981:	0f 48 df             	cmovs  %edi,%ebx
+80105984:	0f 49 d1             	cmovns %ecx,%edx
+80105987:	89 75 ec             	mov    %esi,-0x14(%ebp)
+    if(!PASSLESS(rq->heap[c], rq->heap[i]))
+8010598a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+8010598d:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+80105990:	8b 75 ec             	mov    -0x14(%ebp),%esi
+80105993:	8b 79 34             	mov    0x34(%ecx),%edi
+80105996:	3b b7 24 01 00 00    	cmp    0x124(%edi),%esi
+8010599c:	79 5a                	jns    801059f8 <rqfix+0x118>
+  rq->heap[i] = rq->heap[j];
+8010599e:	89 59 34             	mov    %ebx,0x34(%ecx)
+  rq->heap[j] = p;
+801059a1:	8d 5a 0c             	lea    0xc(%edx),%ebx
+  rq->heap[i]->rqidx = i;
+801059a4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  rq->heap[j] = p;
+801059a7:	89 7c 98 04          	mov    %edi,0x4(%eax,%ebx,4)
+  rq->heap[i]->rqidx = i;
+801059ab:	8b 49 34             	mov    0x34(%ecx),%ecx
+801059ae:	89 b1 1c 01 00 00    	mov    %esi,0x11c(%ecx)
+  rq->heap[j]->rqidx = j;
+801059b4:	8b 4c 98 04          	mov    0x4(%eax,%ebx,4),%ecx
+801059b8:	89 91 1c 01 00 00    	mov    %edx,0x11c(%ecx)
+    if(c >= rq->n)
+801059be:	8b 98 34 01 00 00    	mov    0x134(%eax),%ebx
+    c = 2*i + 1;
+801059c4:	8d 4c 12 01          	lea    0x1(%edx,%edx,1),%ecx
+    if(c >= rq->n)
+801059c8:	39 cb                	cmp    %ecx,%ebx
+801059ca:	7e 2c                	jle    801059f8 <rqfix+0x118>
+    i = c;
+801059cc:	89 55 f0             	mov    %edx,-0x10(%ebp)
+    if(c+1 < rq->n && PASSLESS(rq->heap[c+1], rq->heap[c]))
+801059cf:	8b 5c 88 34          	mov    0x34(%eax,%ecx,4),%ebx
+801059d3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+801059d6:	8b b8 34 01 00 00    	mov    0x134(%eax),%edi
+801059dc:	8b b3 24 01 00 00    	mov    0x124(%ebx),%esi
+801059e2:	8d 54 12 02          	lea    0x2(%edx,%edx,1),%edx
+801059e6:	89 75 ec             	mov    %esi,-0x14(%ebp)
+801059e9:	39 fa                	cmp    %edi,%edx
+801059eb:	7c 83                	jl     80105970 <rqfix+0x90>
+801059ed:	89 ca                	mov    %ecx,%edx
+801059ef:	eb 99                	jmp    8010598a <rqfix+0xaa>
+801059f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+801059f8:	83 c4 0c             	add    $0xc,%esp
+801059fb:	5b                   	pop    %ebx
+801059fc:	5e                   	pop    %esi
+801059fd:	5f                   	pop    %edi
+801059fe:	5d                   	pop    %ebp
+801059ff:	c3                   	ret
+  while(i > 0 && PASSLESS(rq->heap[i], rq->heap[(i-1)/2])){
+80105a00:	8b 45 e8             	mov    -0x18(%ebp),%eax
+80105a03:	31 f6                	xor    %esi,%esi
+80105a05:	e9 4f ff ff ff       	jmp    80105959 <rqfix+0x79>
+80105a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105a10 <setrunnable>:
+{
+80105a10:	55                   	push   %ebp
+80105a11:	89 e5                	mov    %esp,%ebp
+80105a13:	57                   	push   %edi
+80105a14:	56                   	push   %esi
+80105a15:	53                   	push   %ebx
+80105a16:	89 c3                	mov    %eax,%ebx
+80105a18:	83 ec 18             	sub    $0x18,%esp
+  if(!holding(&p->lock))
+80105a1b:	50                   	push   %eax
+80105a1c:	e8 af 14 00 00       	call   80106ed0 <holding>
+80105a21:	83 c4 10             	add    $0x10,%esp
+80105a24:	85 c0                	test   %eax,%eax
+80105a26:	0f 84 a9 00 00 00    	je     80105ad5 <setrunnable+0xc5>
+  if(p->state == RUNNING){
+80105a2c:	83 7b 40 04          	cmpl   $0x4,0x40(%ebx)
+80105a30:	75 1a                	jne    80105a4c <setrunnable+0x3c>
+    p->pass += STRIDE(p);
+80105a32:	8b 8b 20 01 00 00    	mov    0x120(%ebx),%ecx
+80105a38:	b8 00 10 00 00       	mov    $0x1000,%eax
+80105a3d:	31 d2                	xor    %edx,%edx
+80105a3f:	f7 3c 8d cc ba 10 80 	idivl  -0x7fef4534(,%ecx,4)
+80105a46:	01 83 24 01 00 00    	add    %eax,0x124(%ebx)
+  rqpush(&runq[p->rqcpu], p);
+80105a4c:	8b bb 14 01 00 00    	mov    0x114(%ebx),%edi
+  acquire(&rq->lock);
+80105a52:	83 ec 0c             	sub    $0xc,%esp
+  p->state = RUNNABLE;
+80105a55:	c7 43 40 03 00 00 00 	movl   $0x3,0x40(%ebx)
+  rqpush(&runq[p->rqcpu], p);
+80105a5c:	69 f7 3c 01 00 00    	imul   $0x13c,%edi,%esi
+80105a62:	81 c6 40 5f 18 80    	add    $0x80185f40,%esi
+  acquire(&rq->lock);
+80105a68:	56                   	push   %esi
+80105a69:	e8 f2 12 00 00       	call   80106d60 <acquire>
+  if((int)(p->pass - rq->vtime) < 0)
+80105a6e:	8b 86 38 01 00 00    	mov    0x138(%esi),%eax
+80105a74:	83 c4 10             	add    $0x10,%esp
+80105a77:	39 83 24 01 00 00    	cmp    %eax,0x124(%ebx)
+80105a7d:	79 06                	jns    80105a85 <setrunnable+0x75>
+    p->pass = rq->vtime;
+80105a7f:	89 83 24 01 00 00    	mov    %eax,0x124(%ebx)
+  p->rqidx = rq->n;
+80105a85:	69 c7 3c 01 00 00    	imul   $0x13c,%edi,%eax
+  rq->heap[rq->n++] = p;
+80105a8b:	6b ff 4f             	imul   $0x4f,%edi,%edi
+  p->rqidx = rq->n;
+80105a8e:	8b 90 74 60 18 80    	mov    -0x7fe79f8c(%eax),%edx
+80105a94:	89 93 1c 01 00 00    	mov    %edx,0x11c(%ebx)
+  rq->heap[rq->n++] = p;
+80105a9a:	8b 90 74 60 18 80    	mov    -0x7fe79f8c(%eax),%edx
+80105aa0:	8d 4a 01             	lea    0x1(%edx),%ecx
+80105aa3:	89 88 74 60 18 80    	mov    %ecx,-0x7fe79f8c(%eax)
+80105aa9:	8d 44 3a 0c          	lea    0xc(%edx,%edi,1),%eax
+80105aad:	89 1c 85 44 5f 18 80 	mov    %ebx,-0x7fe7a0bc(,%eax,4)
+  rqfix(rq, p->rqidx);
+80105ab4:	8b 93 1c 01 00 00    	mov    0x11c(%ebx),%edx
+80105aba:	89 f0                	mov    %esi,%eax
+80105abc:	e8 1f fe ff ff       	call   801058e0 <rqfix>
+  release(&rq->lock);
+80105ac1:	83 ec 0c             	sub    $0xc,%esp
+80105ac4:	56                   	push   %esi
+80105ac5:	e8 b6 14 00 00       	call   80106f80 <release>
+}
+80105aca:	83 c4 10             	add    $0x10,%esp
+80105acd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105ad0:	5b                   	pop    %ebx
+80105ad1:	5e                   	pop    %esi
+80105ad2:	5f                   	pop    %edi
+80105ad3:	5d                   	pop    %ebp
+80105ad4:	c3                   	ret
+    panic("setrunnable");
+80105ad5:	83 ec 0c             	sub    $0xc,%esp
+80105ad8:	68 bb b9 10 80       	push   $0x8010b9bb
+80105add:	e8 de b0 ff ff       	call   80100bc0 <panic>
+80105ae2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105af0 <pinit>:
+{
+80105af0:	55                   	push   %ebp
+80105af1:	89 e5                	mov    %esp,%ebp
+80105af3:	53                   	push   %ebx
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80105af4:	bb 34 12 18 80       	mov    $0x80181234,%ebx
+{
+80105af9:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&ptable.lock, "ptable");
+80105afc:	68 c7 b9 10 80       	push   $0x8010b9c7
+80105b01:	68 00 12 18 80       	push   $0x80181200
+80105b06:	e8 35 12 00 00       	call   80106d40 <initlock>
+80105b0b:	83 c4 10             	add    $0x10,%esp
+80105b0e:	66 90                	xchg   %ax,%ax
+    initlock(&p->lock, "proc");
+80105b10:	83 ec 08             	sub    $0x8,%esp
+80105b13:	68 ce b9 10 80       	push   $0x8010b9ce
+80105b18:	53                   	push   %ebx
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80105b19:	81 c3 34 01 00 00    	add    $0x134,%ebx
+    initlock(&p->lock, "proc");
+80105b1f:	e8 1c 12 00 00       	call   80106d40 <initlock>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80105b24:	83 c4 10             	add    $0x10,%esp
+80105b27:	81 fb 34 5f 18 80    	cmp    $0x80185f34,%ebx
+80105b2d:	75 e1                	jne    80105b10 <pinit+0x20>
+  for(rq = runq; rq < &runq[NCPU]; rq++)
+80105b2f:	bb 40 5f 18 80       	mov    $0x80185f40,%ebx
+80105b34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    initlock(&rq->lock, "runq");
+80105b38:	83 ec 08             	sub    $0x8,%esp
+80105b3b:	68 d3 b9 10 80       	push   $0x8010b9d3
+80105b40:	53                   	push   %ebx
+  for(rq = runq; rq < &runq[NCPU]; rq++)
+80105b41:	81 c3 3c 01 00 00    	add    $0x13c,%ebx
+    initlock(&rq->lock, "runq");
+80105b47:	e8 f4 11 00 00       	call   80106d40 <initlock>
+  for(rq = runq; rq < &runq[NCPU]; rq++)
+80105b4c:	83 c4 10             	add    $0x10,%esp
+80105b4f:	81 fb 20 69 18 80    	cmp    $0x80186920,%ebx
+80105b55:	75 e1                	jne    80105b38 <pinit+0x48>
+}
+80105b57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105b5a:	c9                   	leave
+80105b5b:	c3                   	ret
+80105b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105b60 <userinit>:
+{
+80105b60:	55                   	push   %ebp
+80105b61:	89 e5                	mov    %esp,%ebp
+80105b63:	57                   	push   %edi
+80105b64:	56                   	push   %esi
+80105b65:	53                   	push   %ebx
+80105b66:	83 ec 0c             	sub    $0xc,%esp
+  p = allocproc();
+80105b69:	e8 d2 fb ff ff       	call   80105740 <allocproc>
+80105b6e:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+80105b70:	a3 34 5f 18 80       	mov    %eax,0x80185f34
+  if((p->pgdir = setupkvm()) == 0)
+80105b75:	e8 66 4d 00 00       	call   8010a8e0 <setupkvm>
+80105b7a:	89 43 38             	mov    %eax,0x38(%ebx)
+80105b7d:	85 c0                	test   %eax,%eax
+80105b7f:	0f 84 16 01 00 00    	je     80105c9b <userinit+0x13b>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80105b85:	83 ec 04             	sub    $0x4,%esp
+80105b88:	68 2c 00 00 00       	push   $0x2c
+80105b8d:	68 60 e4 10 80       	push   $0x8010e460
+80105b92:	50                   	push   %eax
+80105b93:	e8 a8 4f 00 00       	call   8010ab40 <inituvm>
+  memset(p->tf, 0, sizeof(*p->tf));
+80105b98:	83 c4 0c             	add    $0xc,%esp
+  p->sz = PGSIZE;
+80105b9b:	c7 43 34 00 10 00 00 	movl   $0x1000,0x34(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+80105ba2:	6a 4c                	push   $0x4c
+80105ba4:	6a 00                	push   $0x0
+80105ba6:	ff 73 5c             	push   0x5c(%ebx)
+80105ba9:	e8 92 16 00 00       	call   80107240 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80105bae:	8b 43 5c             	mov    0x5c(%ebx),%eax
+80105bb1:	ba 23 00 00 00       	mov    $0x23,%edx
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80105bb6:	83 c4 0c             	add    $0xc,%esp
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105bb9:	b9 2b 00 00 00       	mov    $0x2b,%ecx
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80105bbe:	66 89 50 3c          	mov    %dx,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105bc2:	8b 43 5c             	mov    0x5c(%ebx),%eax
+80105bc5:	66 89 48 2c          	mov    %cx,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80105bc9:	8b 43 5c             	mov    0x5c(%ebx),%eax
+80105bcc:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105bd0:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80105bd4:	8b 43 5c             	mov    0x5c(%ebx),%eax
+80105bd7:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105bdb:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80105bdf:	8b 43 5c             	mov    0x5c(%ebx),%eax
+80105be2:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80105be9:	8b 43 5c             	mov    0x5c(%ebx),%eax
+80105bec:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80105bf3:	8b 43 5c             	mov    0x5c(%ebx),%eax
+80105bf6:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80105bfd:	8d 83 b0 00 00 00    	lea    0xb0(%ebx),%eax
+80105c03:	6a 10                	push   $0x10
+80105c05:	68 f1 b9 10 80       	push   $0x8010b9f1
+80105c0a:	50                   	push   %eax
+80105c0b:	e8 e0 17 00 00       	call   801073f0 <safestrcpy>
+  p->cwd = namei("/");
+80105c10:	c7 04 24 fa b9 10 80 	movl   $0x8010b9fa,(%esp)
+80105c17:	e8 e4 cf ff ff       	call   80102c00 <namei>
+80105c1c:	89 83 ac 00 00 00    	mov    %eax,0xac(%ebx)
+  acquire(&p->lock);
+80105c22:	89 1c 24             	mov    %ebx,(%esp)
+80105c25:	e8 36 11 00 00       	call   80106d60 <acquire>
+  best = cpu - cpus;
+80105c2a:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+  for(i = 0; i < ncpu; i++)
+80105c31:	8b 3d 84 e9 17 80    	mov    0x8017e984,%edi
+80105c37:	83 c4 10             	add    $0x10,%esp
+  best = cpu - cpus;
+80105c3a:	81 e9 c0 e9 17 80    	sub    $0x8017e9c0,%ecx
+80105c40:	c1 f9 08             	sar    $0x8,%ecx
+  for(i = 0; i < ncpu; i++)
+80105c43:	85 ff                	test   %edi,%edi
+80105c45:	7e 33                	jle    80105c7a <userinit+0x11a>
+80105c47:	31 c0                	xor    %eax,%eax
+80105c49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(runq[i].n < runq[best].n)
+80105c50:	69 d0 3c 01 00 00    	imul   $0x13c,%eax,%edx
+80105c56:	8b b2 74 60 18 80    	mov    -0x7fe79f8c(%edx),%esi
+80105c5c:	69 d1 3c 01 00 00    	imul   $0x13c,%ecx,%edx
+80105c62:	81 c2 40 5f 18 80    	add    $0x80185f40,%edx
+80105c68:	8b 92 34 01 00 00    	mov    0x134(%edx),%edx
+80105c6e:	39 d6                	cmp    %edx,%esi
+80105c70:	0f 4c c8             	cmovl  %eax,%ecx
+  for(i = 0; i < ncpu; i++)
+80105c73:	83 c0 01             	add    $0x1,%eax
+80105c76:	39 c7                	cmp    %eax,%edi
+80105c78:	75 d6                	jne    80105c50 <userinit+0xf0>
+  p->rqcpu = leastloaded();
+80105c7a:	89 8b 14 01 00 00    	mov    %ecx,0x114(%ebx)
+  setrunnable(p);
+80105c80:	89 d8                	mov    %ebx,%eax
+80105c82:	e8 89 fd ff ff       	call   80105a10 <setrunnable>
+  release(&p->lock);
+80105c87:	83 ec 0c             	sub    $0xc,%esp
+80105c8a:	53                   	push   %ebx
+80105c8b:	e8 f0 12 00 00       	call   80106f80 <release>
+}
+80105c90:	83 c4 10             	add    $0x10,%esp
+80105c93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105c96:	5b                   	pop    %ebx
+80105c97:	5e                   	pop    %esi
+80105c98:	5f                   	pop    %edi
+80105c99:	5d                   	pop    %ebp
+80105c9a:	c3                   	ret
+    panic("userinit: out of memory?");
+80105c9b:	83 ec 0c             	sub    $0xc,%esp
+80105c9e:	68 d8 b9 10 80       	push   $0x8010b9d8
+80105ca3:	e8 18 af ff ff       	call   80100bc0 <panic>
+80105ca8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105caf:	90                   	nop
+
+80105cb0 <kthread>:
+{
+80105cb0:	55                   	push   %ebp
+80105cb1:	89 e5                	mov    %esp,%ebp
+80105cb3:	57                   	push   %edi
+80105cb4:	56                   	push   %esi
+80105cb5:	53                   	push   %ebx
+80105cb6:	83 ec 0c             	sub    $0xc,%esp
+80105cb9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80105cbc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+80105cbf:	e8 7c fa ff ff       	call   80105740 <allocproc>
+80105cc4:	85 c0                	test   %eax,%eax
+80105cc6:	0f 84 ba 00 00 00    	je     80105d86 <kthread+0xd6>
+80105ccc:	89 c6                	mov    %eax,%esi
+80105cce:	e8 0d 4c 00 00       	call   8010a8e0 <setupkvm>
+80105cd3:	89 46 38             	mov    %eax,0x38(%esi)
+80105cd6:	85 c0                	test   %eax,%eax
+80105cd8:	0f 84 a8 00 00 00    	je     80105d86 <kthread+0xd6>
+  p->context->eip = (uint)kthreadret;
+80105cde:	8b 46 60             	mov    0x60(%esi),%eax
+  safestrcpy(p->name, name, sizeof(p->name));
+80105ce1:	83 ec 04             	sub    $0x4,%esp
+  p->kfn = fn;
+80105ce4:	89 be c0 00 00 00    	mov    %edi,0xc0(%esi)
+  p->sz = 0;
+80105cea:	c7 46 34 00 00 00 00 	movl   $0x0,0x34(%esi)
+  p->parent = 0;
+80105cf1:	c7 46 58 00 00 00 00 	movl   $0x0,0x58(%esi)
+  p->cwd = 0;
+80105cf8:	c7 86 ac 00 00 00 00 	movl   $0x0,0xac(%esi)
+80105cff:	00 00 00 
+  p->context->eip = (uint)kthreadret;
+80105d02:	c7 40 10 10 57 10 80 	movl   $0x80105710,0x10(%eax)
+  safestrcpy(p->name, name, sizeof(p->name));
+80105d09:	8d 86 b0 00 00 00    	lea    0xb0(%esi),%eax
+80105d0f:	6a 10                	push   $0x10
+80105d11:	53                   	push   %ebx
+80105d12:	50                   	push   %eax
+80105d13:	e8 d8 16 00 00       	call   801073f0 <safestrcpy>
+  acquire(&p->lock);
+80105d18:	89 34 24             	mov    %esi,(%esp)
+80105d1b:	e8 40 10 00 00       	call   80106d60 <acquire>
+  best = cpu - cpus;
+80105d20:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+  for(i = 0; i < ncpu; i++)
+80105d27:	8b 3d 84 e9 17 80    	mov    0x8017e984,%edi
+80105d2d:	83 c4 10             	add    $0x10,%esp
+  best = cpu - cpus;
+80105d30:	81 e9 c0 e9 17 80    	sub    $0x8017e9c0,%ecx
+80105d36:	c1 f9 08             	sar    $0x8,%ecx
+  for(i = 0; i < ncpu; i++)
+80105d39:	85 ff                	test   %edi,%edi
+80105d3b:	7e 2d                	jle    80105d6a <kthread+0xba>
+80105d3d:	31 c0                	xor    %eax,%eax
+80105d3f:	90                   	nop
+    if(runq[i].n < runq[best].n)
+80105d40:	69 d0 3c 01 00 00    	imul   $0x13c,%eax,%edx
+80105d46:	8b 9a 74 60 18 80    	mov    -0x7fe79f8c(%edx),%ebx
+80105d4c:	69 d1 3c 01 00 00    	imul   $0x13c,%ecx,%edx
+80105d52:	81 c2 40 5f 18 80    	add    $0x80185f40,%edx
+80105d58:	8b 92 34 01 00 00    	mov    0x134(%edx),%edx
+80105d5e:	39 d3                	cmp    %edx,%ebx
+80105d60:	0f 4c c8             	cmovl  %eax,%ecx
+  for(i = 0; i < ncpu; i++)
+80105d63:	83 c0 01             	add    $0x1,%eax
+80105d66:	39 c7                	cmp    %eax,%edi
+80105d68:	75 d6                	jne    80105d40 <kthread+0x90>
+  p->rqcpu = leastloaded();
+80105d6a:	89 8e 14 01 00 00    	mov    %ecx,0x114(%esi)
+  setrunnable(p);
+80105d70:	89 f0                	mov    %esi,%eax
+80105d72:	e8 99 fc ff ff       	call   80105a10 <setrunnable>
+  release(&p->lock);
+80105d77:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80105d7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105d7d:	5b                   	pop    %ebx
+80105d7e:	5e                   	pop    %esi
+80105d7f:	5f                   	pop    %edi
+80105d80:	5d                   	pop    %ebp
+  release(&p->lock);
+80105d81:	e9 fa 11 00 00       	jmp    80106f80 <release>
+    panic("kthread");
+80105d86:	83 ec 0c             	sub    $0xc,%esp
+80105d89:	68 fc b9 10 80       	push   $0x8010b9fc
+80105d8e:	e8 2d ae ff ff       	call   80100bc0 <panic>
+80105d93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105da0 <growproc>:
+{
+80105da0:	55                   	push   %ebp
+80105da1:	89 e5                	mov    %esp,%ebp
+80105da3:	53                   	push   %ebx
+80105da4:	83 ec 04             	sub    $0x4,%esp
+  sz = proc->sz;
+80105da7:	65 8b 0d 04 00 00 00 	mov    %gs:0x4,%ecx
+{
+80105dae:	8b 55 08             	mov    0x8(%ebp),%edx
+  sz = proc->sz;
+80105db1:	8b 41 34             	mov    0x34(%ecx),%eax
+  if(n > 0){
+80105db4:	85 d2                	test   %edx,%edx
+80105db6:	7e 30                	jle    80105de8 <growproc+0x48>
+    if(sz + n < sz || sz + n > KERNBASE)
+80105db8:	31 db                	xor    %ebx,%ebx
+80105dba:	01 c2                	add    %eax,%edx
+80105dbc:	0f 92 c3             	setb   %bl
+80105dbf:	89 d0                	mov    %edx,%eax
+80105dc1:	81 fa 00 00 00 80    	cmp    $0x80000000,%edx
+80105dc7:	77 47                	ja     80105e10 <growproc+0x70>
+80105dc9:	85 db                	test   %ebx,%ebx
+80105dcb:	75 43                	jne    80105e10 <growproc+0x70>
+  switchuvm(proc);
+80105dcd:	83 ec 0c             	sub    $0xc,%esp
+  proc->sz = sz;
+80105dd0:	89 41 34             	mov    %eax,0x34(%ecx)
+  switchuvm(proc);
+80105dd3:	51                   	push   %ecx
+80105dd4:	e8 77 4c 00 00       	call   8010aa50 <switchuvm>
+  return 0;
+80105dd9:	83 c4 10             	add    $0x10,%esp
+80105ddc:	31 c0                	xor    %eax,%eax
+}
+80105dde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105de1:	c9                   	leave
+80105de2:	c3                   	ret
+80105de3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105de7:	90                   	nop
+  } else if(n < 0){
+80105de8:	74 e3                	je     80105dcd <growproc+0x2d>
+    if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
+80105dea:	83 ec 04             	sub    $0x4,%esp
+80105ded:	01 c2                	add    %eax,%edx
+80105def:	52                   	push   %edx
+80105df0:	50                   	push   %eax
+80105df1:	ff 71 38             	push   0x38(%ecx)
+80105df4:	e8 c7 4e 00 00       	call   8010acc0 <deallocuvm>
+80105df9:	83 c4 10             	add    $0x10,%esp
+80105dfc:	85 c0                	test   %eax,%eax
+80105dfe:	74 10                	je     80105e10 <growproc+0x70>
+  proc->sz = sz;
+80105e00:	65 8b 0d 04 00 00 00 	mov    %gs:0x4,%ecx
+80105e07:	eb c4                	jmp    80105dcd <growproc+0x2d>
+80105e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      return -1;
+80105e10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105e15:	eb c7                	jmp    80105dde <growproc+0x3e>
+80105e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105e1e:	66 90                	xchg   %ax,%ax
+
+80105e20 <fork>:
+{
+80105e20:	55                   	push   %ebp
+80105e21:	89 e5                	mov    %esp,%ebp
+80105e23:	57                   	push   %edi
+80105e24:	56                   	push   %esi
+80105e25:	53                   	push   %ebx
+80105e26:	83 ec 1c             	sub    $0x1c,%esp
+  if((np = allocproc()) == 0){
+80105e29:	e8 12 f9 ff ff       	call   80105740 <allocproc>
+80105e2e:	85 c0                	test   %eax,%eax
+80105e30:	0f 84 c6 01 00 00    	je     80105ffc <fork+0x1dc>
+80105e36:	89 c3                	mov    %eax,%ebx
+  if((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0){
+80105e38:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80105e3e:	83 ec 08             	sub    $0x8,%esp
+80105e41:	ff 70 34             	push   0x34(%eax)
+80105e44:	ff 70 38             	push   0x38(%eax)
+80105e47:	e8 74 4f 00 00       	call   8010adc0 <copyuvm>
+80105e4c:	83 c4 10             	add    $0x10,%esp
+80105e4f:	89 43 38             	mov    %eax,0x38(%ebx)
+80105e52:	85 c0                	test   %eax,%eax
+80105e54:	0f 84 86 01 00 00    	je     80105fe0 <fork+0x1c0>
+  np->sz = proc->sz;
+80105e5a:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  *np->tf = *proc->tf;
+80105e60:	8b 7b 5c             	mov    0x5c(%ebx),%edi
+80105e63:	b9 13 00 00 00       	mov    $0x13,%ecx
+  np->sz = proc->sz;
+80105e68:	8b 50 34             	mov    0x34(%eax),%edx
+  np->parent = proc;
+80105e6b:	89 43 58             	mov    %eax,0x58(%ebx)
+  np->sz = proc->sz;
+80105e6e:	89 53 34             	mov    %edx,0x34(%ebx)
+  *np->tf = *proc->tf;
+80105e71:	8b 70 5c             	mov    0x5c(%eax),%esi
+80105e74:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 0; i < NOFILE; i++)
+80105e76:	31 f6                	xor    %esi,%esi
+  np->tf->eax = 0;
+80105e78:	8b 53 5c             	mov    0x5c(%ebx),%edx
+80105e7b:	c7 42 1c 00 00 00 00 	movl   $0x0,0x1c(%edx)
+  for(i = 0; i < NOFILE; i++)
+80105e82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(proc->ofile[i])
+80105e88:	8b 54 b0 6c          	mov    0x6c(%eax,%esi,4),%edx
+80105e8c:	85 d2                	test   %edx,%edx
+80105e8e:	74 16                	je     80105ea6 <fork+0x86>
+      np->ofile[i] = filedup(proc->ofile[i]);
+80105e90:	83 ec 0c             	sub    $0xc,%esp
+80105e93:	52                   	push   %edx
+80105e94:	e8 67 b9 ff ff       	call   80101800 <filedup>
+  np->cwd = idup(proc->cwd);
+80105e99:	83 c4 10             	add    $0x10,%esp
+      np->ofile[i] = filedup(proc->ofile[i]);
+80105e9c:	89 44 b3 6c          	mov    %eax,0x6c(%ebx,%esi,4)
+  np->cwd = idup(proc->cwd);
+80105ea0:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  for(i = 0; i < NOFILE; i++)
+80105ea6:	83 c6 01             	add    $0x1,%esi
+80105ea9:	83 fe 10             	cmp    $0x10,%esi
+80105eac:	75 da                	jne    80105e88 <fork+0x68>
+  np->cwd = idup(proc->cwd);
+80105eae:	83 ec 0c             	sub    $0xc,%esp
+80105eb1:	ff b0 ac 00 00 00    	push   0xac(%eax)
+80105eb7:	e8 54 c2 ff ff       	call   80102110 <idup>
+  if(proc->exe){
+80105ebc:	83 c4 10             	add    $0x10,%esp
+  np->cwd = idup(proc->cwd);
+80105ebf:	89 83 ac 00 00 00    	mov    %eax,0xac(%ebx)
+  if(proc->exe){
+80105ec5:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80105ecb:	8b 90 c4 00 00 00    	mov    0xc4(%eax),%edx
+80105ed1:	85 d2                	test   %edx,%edx
+80105ed3:	74 20                	je     80105ef5 <fork+0xd5>
+    np->exe = idup(proc->exe);
+80105ed5:	83 ec 0c             	sub    $0xc,%esp
+80105ed8:	52                   	push   %edx
+80105ed9:	e8 32 c2 ff ff       	call   80102110 <idup>
+80105ede:	89 83 c4 00 00 00    	mov    %eax,0xc4(%ebx)
+    idenywrite(np->exe);
+80105ee4:	89 04 24             	mov    %eax,(%esp)
+80105ee7:	e8 54 c2 ff ff       	call   80102140 <idenywrite>
+  memmove(np->seg, proc->seg, sizeof(proc->seg));
+80105eec:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80105ef2:	83 c4 10             	add    $0x10,%esp
+80105ef5:	83 ec 04             	sub    $0x4,%esp
+80105ef8:	05 c8 00 00 00       	add    $0xc8,%eax
+80105efd:	6a 40                	push   $0x40
+80105eff:	50                   	push   %eax
+80105f00:	8d 83 c8 00 00 00    	lea    0xc8(%ebx),%eax
+80105f06:	50                   	push   %eax
+80105f07:	e8 c4 13 00 00       	call   801072d0 <memmove>
+  np->nseg = proc->nseg;
+80105f0c:	65 8b 0d 04 00 00 00 	mov    %gs:0x4,%ecx
+  safestrcpy(np->name, proc->name, sizeof(proc->name));
+80105f13:	83 c4 0c             	add    $0xc,%esp
+  np->nseg = proc->nseg;
+80105f16:	8b 81 08 01 00 00    	mov    0x108(%ecx),%eax
+  safestrcpy(np->name, proc->name, sizeof(proc->name));
+80105f1c:	81 c1 b0 00 00 00    	add    $0xb0,%ecx
+  np->nseg = proc->nseg;
+80105f22:	89 83 08 01 00 00    	mov    %eax,0x108(%ebx)
+  np->nice = proc->nice;
+80105f28:	8b 41 70             	mov    0x70(%ecx),%eax
+80105f2b:	89 83 20 01 00 00    	mov    %eax,0x120(%ebx)
+  np->pass = proc->pass;
+80105f31:	8b 41 74             	mov    0x74(%ecx),%eax
+80105f34:	89 83 24 01 00 00    	mov    %eax,0x124(%ebx)
+  np->tracemask = proc->tracemask;
+80105f3a:	8b 41 98             	mov    -0x68(%ecx),%eax
+80105f3d:	8b 51 9c             	mov    -0x64(%ecx),%edx
+80105f40:	89 43 48             	mov    %eax,0x48(%ebx)
+80105f43:	89 53 4c             	mov    %edx,0x4c(%ebx)
+  np->tracewhen = proc->tracewhen;
+80105f46:	8b 41 a0             	mov    -0x60(%ecx),%eax
+80105f49:	89 43 50             	mov    %eax,0x50(%ebx)
+  safestrcpy(np->name, proc->name, sizeof(proc->name));
+80105f4c:	8d 83 b0 00 00 00    	lea    0xb0(%ebx),%eax
+80105f52:	6a 10                	push   $0x10
+80105f54:	51                   	push   %ecx
+80105f55:	50                   	push   %eax
+80105f56:	e8 95 14 00 00       	call   801073f0 <safestrcpy>
+  pid = np->pid;
+80105f5b:	8b 73 44             	mov    0x44(%ebx),%esi
+  acquire(&np->lock);
+80105f5e:	89 1c 24             	mov    %ebx,(%esp)
+80105f61:	e8 fa 0d 00 00       	call   80106d60 <acquire>
+  best = cpu - cpus;
+80105f66:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+  for(i = 0; i < ncpu; i++)
+80105f6d:	8b 3d 84 e9 17 80    	mov    0x8017e984,%edi
+80105f73:	83 c4 10             	add    $0x10,%esp
+  best = cpu - cpus;
+80105f76:	81 e9 c0 e9 17 80    	sub    $0x8017e9c0,%ecx
+80105f7c:	c1 f9 08             	sar    $0x8,%ecx
+  for(i = 0; i < ncpu; i++)
+80105f7f:	85 ff                	test   %edi,%edi
+80105f81:	7e 3a                	jle    80105fbd <fork+0x19d>
+80105f83:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80105f86:	31 c0                	xor    %eax,%eax
+80105f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105f8f:	90                   	nop
+    if(runq[i].n < runq[best].n)
+80105f90:	69 d0 3c 01 00 00    	imul   $0x13c,%eax,%edx
+80105f96:	8b 9a 74 60 18 80    	mov    -0x7fe79f8c(%edx),%ebx
+80105f9c:	69 d1 3c 01 00 00    	imul   $0x13c,%ecx,%edx
+80105fa2:	81 c2 40 5f 18 80    	add    $0x80185f40,%edx
+80105fa8:	8b 92 34 01 00 00    	mov    0x134(%edx),%edx
+80105fae:	39 d3                	cmp    %edx,%ebx
+80105fb0:	0f 4c c8             	cmovl  %eax,%ecx
+  for(i = 0; i < ncpu; i++)
+80105fb3:	83 c0 01             	add    $0x1,%eax
+80105fb6:	39 c7                	cmp    %eax,%edi
+80105fb8:	75 d6                	jne    80105f90 <fork+0x170>
+80105fba:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  np->rqcpu = leastloaded();
+80105fbd:	89 8b 14 01 00 00    	mov    %ecx,0x114(%ebx)
+  setrunnable(np);
+80105fc3:	89 d8                	mov    %ebx,%eax
+80105fc5:	e8 46 fa ff ff       	call   80105a10 <setrunnable>
+  release(&np->lock);
+80105fca:	83 ec 0c             	sub    $0xc,%esp
+80105fcd:	53                   	push   %ebx
+80105fce:	e8 ad 0f 00 00       	call   80106f80 <release>
+  return pid;
+80105fd3:	83 c4 10             	add    $0x10,%esp
+}
+80105fd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105fd9:	89 f0                	mov    %esi,%eax
+80105fdb:	5b                   	pop    %ebx
+80105fdc:	5e                   	pop    %esi
+80105fdd:	5f                   	pop    %edi
+80105fde:	5d                   	pop    %ebp
+80105fdf:	c3                   	ret
+    kfree(np->kstack);
+80105fe0:	83 ec 0c             	sub    $0xc,%esp
+80105fe3:	ff 73 3c             	push   0x3c(%ebx)
+80105fe6:	e8 c5 d5 ff ff       	call   801035b0 <kfree>
+    np->kstack = 0;
+80105feb:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+    return -1;
+80105ff2:	83 c4 10             	add    $0x10,%esp
+    np->state = UNUSED;
+80105ff5:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+    return -1;
+80105ffc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80106001:	eb d3                	jmp    80105fd6 <fork+0x1b6>
+80106003:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010600a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106010 <scheduler>:
+{
+80106010:	55                   	push   %ebp
+80106011:	89 e5                	mov    %esp,%ebp
+80106013:	57                   	push   %edi
+80106014:	56                   	push   %esi
+80106015:	53                   	push   %ebx
+80106016:	83 ec 2c             	sub    $0x2c,%esp
+  rq = &runq[cpu - cpus];
+80106019:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+8010601f:	2d c0 e9 17 80       	sub    $0x8017e9c0,%eax
+80106024:	c1 f8 08             	sar    $0x8,%eax
+80106027:	69 d0 3c 01 00 00    	imul   $0x13c,%eax,%edx
+    rq->heap[i] = rq->heap[rq->n];
+8010602d:	6b c0 4f             	imul   $0x4f,%eax,%eax
+  rq = &runq[cpu - cpus];
+80106030:	8d b2 40 5f 18 80    	lea    -0x7fe7a0c0(%edx),%esi
+80106036:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    rq->heap[i] = rq->heap[rq->n];
+80106039:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010603c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  asm volatile("sti");
+80106040:	fb                   	sti
+    if(rq->n > 0)
+80106041:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106044:	8b 80 34 01 00 00    	mov    0x134(%eax),%eax
+8010604a:	85 c0                	test   %eax,%eax
+8010604c:	0f 8e 56 01 00 00    	jle    801061a8 <scheduler+0x198>
+  acquire(&rq->lock);
+80106052:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80106055:	83 ec 0c             	sub    $0xc,%esp
+80106058:	56                   	push   %esi
+80106059:	e8 02 0d 00 00       	call   80106d60 <acquire>
+  if(rq->n > 0){
+8010605e:	8b 86 34 01 00 00    	mov    0x134(%esi),%eax
+80106064:	83 c4 10             	add    $0x10,%esp
+80106067:	85 c0                	test   %eax,%eax
+80106069:	0f 8e e1 02 00 00    	jle    80106350 <scheduler+0x340>
+  p = rq->heap[i];
+8010606f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  rq->n--;
+80106072:	8b 87 34 01 00 00    	mov    0x134(%edi),%eax
+  p = rq->heap[i];
+80106078:	8b 5f 34             	mov    0x34(%edi),%ebx
+  rq->n--;
+8010607b:	83 e8 01             	sub    $0x1,%eax
+8010607e:	89 87 34 01 00 00    	mov    %eax,0x134(%edi)
+  if(i != rq->n){
+80106084:	8b 87 34 01 00 00    	mov    0x134(%edi),%eax
+8010608a:	85 c0                	test   %eax,%eax
+8010608c:	74 2a                	je     801060b8 <scheduler+0xa8>
+    rq->heap[i] = rq->heap[rq->n];
+8010608e:	8b 87 34 01 00 00    	mov    0x134(%edi),%eax
+80106094:	8b 75 dc             	mov    -0x24(%ebp),%esi
+    rqfix(rq, i);
+80106097:	31 d2                	xor    %edx,%edx
+    rq->heap[i] = rq->heap[rq->n];
+80106099:	8d 44 30 0c          	lea    0xc(%eax,%esi,1),%eax
+8010609d:	8b 04 85 44 5f 18 80 	mov    -0x7fe7a0bc(,%eax,4),%eax
+801060a4:	89 47 34             	mov    %eax,0x34(%edi)
+    rq->heap[i]->rqidx = i;
+801060a7:	c7 80 1c 01 00 00 00 	movl   $0x0,0x11c(%eax)
+801060ae:	00 00 00 
+    rqfix(rq, i);
+801060b1:	89 f8                	mov    %edi,%eax
+801060b3:	e8 28 f8 ff ff       	call   801058e0 <rqfix>
+    rq->vtime = p->pass;
+801060b8:	8b 83 24 01 00 00    	mov    0x124(%ebx),%eax
+801060be:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  release(&rq->lock);
+801060c1:	83 ec 0c             	sub    $0xc,%esp
+    rq->vtime = p->pass;
+801060c4:	89 86 38 01 00 00    	mov    %eax,0x138(%esi)
+  release(&rq->lock);
+801060ca:	56                   	push   %esi
+801060cb:	e8 b0 0e 00 00       	call   80106f80 <release>
+801060d0:	83 c4 10             	add    $0x10,%esp
+    if(p->rqcpu != cpu - cpus)
+801060d3:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+801060d9:	2d c0 e9 17 80       	sub    $0x8017e9c0,%eax
+801060de:	c1 f8 08             	sar    $0x8,%eax
+801060e1:	39 83 14 01 00 00    	cmp    %eax,0x114(%ebx)
+801060e7:	74 0f                	je     801060f8 <scheduler+0xe8>
+      p->pass = rq->vtime;  // stolen: rebase onto this CPU's virtual time
+801060e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801060ec:	8b 80 38 01 00 00    	mov    0x138(%eax),%eax
+801060f2:	89 83 24 01 00 00    	mov    %eax,0x124(%ebx)
+    acquire(&p->lock);
+801060f8:	83 ec 0c             	sub    $0xc,%esp
+801060fb:	53                   	push   %ebx
+801060fc:	e8 5f 0c 00 00       	call   80106d60 <acquire>
+    p->rqcpu = cpu - cpus;
+80106101:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+    if(cpu->pgdir != p->pgdir || p->tlbcpu != cpu - cpus)
+80106107:	8b 73 38             	mov    0x38(%ebx),%esi
+8010610a:	83 c4 10             	add    $0x10,%esp
+    proc = p;
+8010610d:	65 89 1d 04 00 00 00 	mov    %ebx,%gs:0x4
+    p->swappable = 0;
+80106114:	c7 83 0c 01 00 00 00 	movl   $0x0,0x10c(%ebx)
+8010611b:	00 00 00 
+    p->rqcpu = cpu - cpus;
+8010611e:	89 c1                	mov    %eax,%ecx
+80106120:	81 e9 c0 e9 17 80    	sub    $0x8017e9c0,%ecx
+80106126:	c1 f9 08             	sar    $0x8,%ecx
+80106129:	89 8b 14 01 00 00    	mov    %ecx,0x114(%ebx)
+    if(cpu->pgdir != p->pgdir || p->tlbcpu != cpu - cpus)
+8010612f:	39 b0 b4 00 00 00    	cmp    %esi,0xb4(%eax)
+80106135:	0f 84 fd 01 00 00    	je     80106338 <scheduler+0x328>
+      switchuvm(p);
+8010613b:	83 ec 0c             	sub    $0xc,%esp
+8010613e:	53                   	push   %ebx
+8010613f:	e8 0c 49 00 00       	call   8010aa50 <switchuvm>
+    p->tlbcpu = cpu - cpus;
+80106144:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+8010614a:	83 c4 10             	add    $0x10,%esp
+8010614d:	89 c2                	mov    %eax,%edx
+8010614f:	81 ea c0 e9 17 80    	sub    $0x8017e9c0,%edx
+80106155:	c1 fa 08             	sar    $0x8,%edx
+    swtch(&cpu->scheduler, p->context);
+80106158:	83 ec 08             	sub    $0x8,%esp
+    p->tlbcpu = cpu - cpus;
+8010615b:	89 93 10 01 00 00    	mov    %edx,0x110(%ebx)
+    p->state = RUNNING;
+80106161:	c7 43 40 04 00 00 00 	movl   $0x4,0x40(%ebx)
+    cpu->stat[ST_CSWITCH]++;
+80106168:	83 80 c0 00 00 00 01 	addl   $0x1,0xc0(%eax)
+    swtch(&cpu->scheduler, p->context);
+8010616f:	83 c0 04             	add    $0x4,%eax
+80106172:	ff 73 60             	push   0x60(%ebx)
+80106175:	50                   	push   %eax
+80106176:	e8 ba 19 00 00       	call   80107b35 <swtch>
+    p->lastrun = ticks;
+8010617b:	a1 20 1b 1a 80       	mov    0x801a1b20,%eax
+    proc = 0;
+80106180:	65 c7 05 04 00 00 00 	movl   $0x0,%gs:0x4
+80106187:	00 00 00 00 
+    p->lastrun = ticks;
+8010618b:	89 83 18 01 00 00    	mov    %eax,0x118(%ebx)
+    release(&p->lock);
+80106191:	89 1c 24             	mov    %ebx,(%esp)
+80106194:	e8 e7 0d 00 00       	call   80106f80 <release>
+80106199:	83 c4 10             	add    $0x10,%esp
+8010619c:	e9 9f fe ff ff       	jmp    80106040 <scheduler+0x30>
+801061a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < ncpu; i++){
+801061a8:	8b 35 84 e9 17 80    	mov    0x8017e984,%esi
+801061ae:	85 f6                	test   %esi,%esi
+801061b0:	0f 8e 71 01 00 00    	jle    80106327 <scheduler+0x317>
+    if(&cpus[i] == cpu || runq[i].n < 2)
+801061b6:	65 8b 3d 00 00 00 00 	mov    %gs:0x0,%edi
+  busiest = -1;
+801061bd:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  for(i = 0; i < ncpu; i++){
+801061c2:	31 c0                	xor    %eax,%eax
+801061c4:	eb 2e                	jmp    801061f4 <scheduler+0x1e4>
+801061c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801061cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(busiest < 0 || runq[i].n > runq[busiest].n)
+801061d0:	8b 8a 34 01 00 00    	mov    0x134(%edx),%ecx
+801061d6:	69 d3 3c 01 00 00    	imul   $0x13c,%ebx,%edx
+801061dc:	81 c2 40 5f 18 80    	add    $0x80185f40,%edx
+801061e2:	8b 92 34 01 00 00    	mov    0x134(%edx),%edx
+801061e8:	39 d1                	cmp    %edx,%ecx
+801061ea:	0f 4f d8             	cmovg  %eax,%ebx
+  for(i = 0; i < ncpu; i++){
+801061ed:	83 c0 01             	add    $0x1,%eax
+801061f0:	39 f0                	cmp    %esi,%eax
+801061f2:	74 33                	je     80106227 <scheduler+0x217>
+    if(&cpus[i] == cpu || runq[i].n < 2)
+801061f4:	89 c2                	mov    %eax,%edx
+801061f6:	c1 e2 08             	shl    $0x8,%edx
+801061f9:	81 c2 c0 e9 17 80    	add    $0x8017e9c0,%edx
+801061ff:	39 d7                	cmp    %edx,%edi
+80106201:	74 ea                	je     801061ed <scheduler+0x1dd>
+80106203:	69 d0 3c 01 00 00    	imul   $0x13c,%eax,%edx
+80106209:	8b 8a 74 60 18 80    	mov    -0x7fe79f8c(%edx),%ecx
+8010620f:	81 c2 40 5f 18 80    	add    $0x80185f40,%edx
+80106215:	83 f9 01             	cmp    $0x1,%ecx
+80106218:	7e d3                	jle    801061ed <scheduler+0x1dd>
+    if(busiest < 0 || runq[i].n > runq[busiest].n)
+8010621a:	85 db                	test   %ebx,%ebx
+8010621c:	79 b2                	jns    801061d0 <scheduler+0x1c0>
+8010621e:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < ncpu; i++){
+80106220:	83 c0 01             	add    $0x1,%eax
+80106223:	39 f0                	cmp    %esi,%eax
+80106225:	75 cd                	jne    801061f4 <scheduler+0x1e4>
+  if(busiest < 0)
+80106227:	85 db                	test   %ebx,%ebx
+80106229:	0f 88 f8 00 00 00    	js     80106327 <scheduler+0x317>
+  return rqsteal(&runq[busiest]);
+8010622f:	69 f3 3c 01 00 00    	imul   $0x13c,%ebx,%esi
+  acquire(&rq->lock);
+80106235:	83 ec 0c             	sub    $0xc,%esp
+  return rqsteal(&runq[busiest]);
+80106238:	8d be 40 5f 18 80    	lea    -0x7fe7a0c0(%esi),%edi
+  acquire(&rq->lock);
+8010623e:	57                   	push   %edi
+8010623f:	e8 1c 0b 00 00       	call   80106d60 <acquire>
+  for(i = 0; i < rq->n; i++){
+80106244:	8b 87 34 01 00 00    	mov    0x134(%edi),%eax
+8010624a:	83 c4 10             	add    $0x10,%esp
+8010624d:	85 c0                	test   %eax,%eax
+8010624f:	0f 8e b7 01 00 00    	jle    8010640c <scheduler+0x3fc>
+80106255:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+    if(ticks - rq->heap[i]->lastrun >= MIGRATETICKS)
+80106258:	8b 0d 20 1b 1a 80    	mov    0x801a1b20,%ecx
+  for(i = 0; i < rq->n; i++){
+8010625e:	31 d2                	xor    %edx,%edx
+80106260:	eb 13                	jmp    80106275 <scheduler+0x265>
+80106262:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80106268:	8b 87 34 01 00 00    	mov    0x134(%edi),%eax
+8010626e:	83 c2 01             	add    $0x1,%edx
+80106271:	39 c2                	cmp    %eax,%edx
+80106273:	7d 14                	jge    80106289 <scheduler+0x279>
+    if(ticks - rq->heap[i]->lastrun >= MIGRATETICKS)
+80106275:	8b 84 96 74 5f 18 80 	mov    -0x7fe7a08c(%esi,%edx,4),%eax
+8010627c:	89 cb                	mov    %ecx,%ebx
+8010627e:	2b 98 18 01 00 00    	sub    0x118(%eax),%ebx
+80106284:	83 fb 01             	cmp    $0x1,%ebx
+80106287:	76 df                	jbe    80106268 <scheduler+0x258>
+80106289:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  if(i == rq->n && rq->n > 2){
+8010628c:	69 c3 3c 01 00 00    	imul   $0x13c,%ebx,%eax
+80106292:	05 40 5f 18 80       	add    $0x80185f40,%eax
+80106297:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010629a:	8b 80 34 01 00 00    	mov    0x134(%eax),%eax
+801062a0:	39 d0                	cmp    %edx,%eax
+801062a2:	0f 84 e8 00 00 00    	je     80106390 <scheduler+0x380>
+  if(i < rq->n)
+801062a8:	69 c3 3c 01 00 00    	imul   $0x13c,%ebx,%eax
+801062ae:	05 40 5f 18 80       	add    $0x80185f40,%eax
+801062b3:	8b 88 34 01 00 00    	mov    0x134(%eax),%ecx
+801062b9:	39 d1                	cmp    %edx,%ecx
+801062bb:	0f 8e af 00 00 00    	jle    80106370 <scheduler+0x360>
+  p = rq->heap[i];
+801062c1:	6b f3 4f             	imul   $0x4f,%ebx,%esi
+801062c4:	8d 4c 32 0c          	lea    0xc(%edx,%esi,1),%ecx
+801062c8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+801062cb:	8b 1c 8d 44 5f 18 80 	mov    -0x7fe7a0bc(,%ecx,4),%ebx
+  rq->n--;
+801062d2:	8b 88 34 01 00 00    	mov    0x134(%eax),%ecx
+801062d8:	83 e9 01             	sub    $0x1,%ecx
+801062db:	89 88 34 01 00 00    	mov    %ecx,0x134(%eax)
+  if(i != rq->n){
+801062e1:	8b 88 34 01 00 00    	mov    0x134(%eax),%ecx
+801062e7:	39 ca                	cmp    %ecx,%edx
+801062e9:	74 28                	je     80106313 <scheduler+0x303>
+    rq->heap[i] = rq->heap[rq->n];
+801062eb:	8b 80 34 01 00 00    	mov    0x134(%eax),%eax
+801062f1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801062f4:	8d 44 30 0c          	lea    0xc(%eax,%esi,1),%eax
+801062f8:	8b 04 85 44 5f 18 80 	mov    -0x7fe7a0bc(,%eax,4),%eax
+801062ff:	89 04 8d 44 5f 18 80 	mov    %eax,-0x7fe7a0bc(,%ecx,4)
+    rq->heap[i]->rqidx = i;
+80106306:	89 90 1c 01 00 00    	mov    %edx,0x11c(%eax)
+    rqfix(rq, i);
+8010630c:	89 f8                	mov    %edi,%eax
+8010630e:	e8 cd f5 ff ff       	call   801058e0 <rqfix>
+  release(&rq->lock);
+80106313:	83 ec 0c             	sub    $0xc,%esp
+80106316:	57                   	push   %edi
+80106317:	e8 64 0c 00 00       	call   80106f80 <release>
+    if(p == 0){
+8010631c:	83 c4 10             	add    $0x10,%esp
+8010631f:	85 db                	test   %ebx,%ebx
+80106321:	0f 85 ac fd ff ff    	jne    801060d3 <scheduler+0xc3>
+      kzeroidle();  // nothing to run; get ahead on zeroing pages
+80106327:	e8 e4 d6 ff ff       	call   80103a10 <kzeroidle>
+      continue;
+8010632c:	e9 0f fd ff ff       	jmp    80106040 <scheduler+0x30>
+80106331:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(cpu->pgdir != p->pgdir || p->tlbcpu != cpu - cpus)
+80106338:	8b 93 10 01 00 00    	mov    0x110(%ebx),%edx
+8010633e:	39 d1                	cmp    %edx,%ecx
+80106340:	0f 85 f5 fd ff ff    	jne    8010613b <scheduler+0x12b>
+80106346:	e9 0d fe ff ff       	jmp    80106158 <scheduler+0x148>
+8010634b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010634f:	90                   	nop
+  release(&rq->lock);
+80106350:	83 ec 0c             	sub    $0xc,%esp
+80106353:	ff 75 e4             	push   -0x1c(%ebp)
+80106356:	e8 25 0c 00 00       	call   80106f80 <release>
+8010635b:	83 c4 10             	add    $0x10,%esp
+      kzeroidle();  // nothing to run; get ahead on zeroing pages
+8010635e:	e8 ad d6 ff ff       	call   80103a10 <kzeroidle>
+      continue;
+80106363:	e9 d8 fc ff ff       	jmp    80106040 <scheduler+0x30>
+80106368:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010636f:	90                   	nop
+  release(&rq->lock);
+80106370:	83 ec 0c             	sub    $0xc,%esp
+80106373:	57                   	push   %edi
+80106374:	e8 07 0c 00 00       	call   80106f80 <release>
+80106379:	83 c4 10             	add    $0x10,%esp
+      kzeroidle();  // nothing to run; get ahead on zeroing pages
+8010637c:	e8 8f d6 ff ff       	call   80103a10 <kzeroidle>
+      continue;
+80106381:	e9 ba fc ff ff       	jmp    80106040 <scheduler+0x30>
+80106386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010638d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(i == rq->n && rq->n > 2){
+80106390:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80106393:	8b 81 34 01 00 00    	mov    0x134(%ecx),%eax
+80106399:	83 f8 02             	cmp    $0x2,%eax
+8010639c:	0f 8e 06 ff ff ff    	jle    801062a8 <scheduler+0x298>
+    i = rq->n / 2;
+801063a2:	8b 91 34 01 00 00    	mov    0x134(%ecx),%edx
+    for(j = i + 1; j < rq->n; j++)
+801063a8:	8b 89 34 01 00 00    	mov    0x134(%ecx),%ecx
+    i = rq->n / 2;
+801063ae:	89 d0                	mov    %edx,%eax
+801063b0:	c1 e8 1f             	shr    $0x1f,%eax
+801063b3:	01 c2                	add    %eax,%edx
+801063b5:	d1 fa                	sar    %edx
+    for(j = i + 1; j < rq->n; j++)
+801063b7:	8d 42 01             	lea    0x1(%edx),%eax
+801063ba:	39 c8                	cmp    %ecx,%eax
+801063bc:	0f 8d e6 fe ff ff    	jge    801062a8 <scheduler+0x298>
+      if(PASSLESS(rq->heap[i], rq->heap[j]))
+801063c2:	6b cb 4f             	imul   $0x4f,%ebx,%ecx
+801063c5:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+801063c8:	89 7d d8             	mov    %edi,-0x28(%ebp)
+801063cb:	89 cf                	mov    %ecx,%edi
+801063cd:	8d 76 00             	lea    0x0(%esi),%esi
+801063d0:	8d 4c 3a 0c          	lea    0xc(%edx,%edi,1),%ecx
+801063d4:	8b 1c 8d 44 5f 18 80 	mov    -0x7fe7a0bc(,%ecx,4),%ebx
+801063db:	8b 8c 86 74 5f 18 80 	mov    -0x7fe7a08c(%esi,%eax,4),%ecx
+801063e2:	8b 89 24 01 00 00    	mov    0x124(%ecx),%ecx
+801063e8:	39 8b 24 01 00 00    	cmp    %ecx,0x124(%ebx)
+    for(j = i + 1; j < rq->n; j++)
+801063ee:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      if(PASSLESS(rq->heap[i], rq->heap[j]))
+801063f1:	0f 48 d0             	cmovs  %eax,%edx
+    for(j = i + 1; j < rq->n; j++)
+801063f4:	83 c0 01             	add    $0x1,%eax
+801063f7:	8b 89 34 01 00 00    	mov    0x134(%ecx),%ecx
+801063fd:	39 c1                	cmp    %eax,%ecx
+801063ff:	7f cf                	jg     801063d0 <scheduler+0x3c0>
+80106401:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80106404:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80106407:	e9 9c fe ff ff       	jmp    801062a8 <scheduler+0x298>
+  for(i = 0; i < rq->n; i++){
+8010640c:	31 d2                	xor    %edx,%edx
+8010640e:	e9 79 fe ff ff       	jmp    8010628c <scheduler+0x27c>
+80106413:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010641a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106420 <sched>:
+{
+80106420:	55                   	push   %ebp
+80106421:	89 e5                	mov    %esp,%ebp
+80106423:	53                   	push   %ebx
+80106424:	83 ec 10             	sub    $0x10,%esp
+  if(!holding(&proc->lock))
+80106427:	65 ff 35 04 00 00 00 	push   %gs:0x4
+8010642e:	e8 9d 0a 00 00       	call   80106ed0 <holding>
+80106433:	83 c4 10             	add    $0x10,%esp
+80106436:	85 c0                	test   %eax,%eax
+80106438:	74 4c                	je     80106486 <sched+0x66>
+  if(cpu->ncli != 1)
+8010643a:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+80106441:	83 ba ac 00 00 00 01 	cmpl   $0x1,0xac(%edx)
+80106448:	75 63                	jne    801064ad <sched+0x8d>
+  if(proc->state == RUNNING)
+8010644a:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80106450:	83 78 40 04          	cmpl   $0x4,0x40(%eax)
+80106454:	74 4a                	je     801064a0 <sched+0x80>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106456:	9c                   	pushf
+80106457:	59                   	pop    %ecx
+  if(readeflags()&FL_IF)
+80106458:	80 e5 02             	and    $0x2,%ch
+8010645b:	75 36                	jne    80106493 <sched+0x73>
+  swtch(&proc->context, cpu->scheduler);
+8010645d:	83 ec 08             	sub    $0x8,%esp
+80106460:	83 c0 60             	add    $0x60,%eax
+  intena = cpu->intena;
+80106463:	8b 9a b0 00 00 00    	mov    0xb0(%edx),%ebx
+  swtch(&proc->context, cpu->scheduler);
+80106469:	ff 72 04             	push   0x4(%edx)
+8010646c:	50                   	push   %eax
+8010646d:	e8 c3 16 00 00       	call   80107b35 <swtch>
+  cpu->intena = intena;
+80106472:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+}
+80106478:	83 c4 10             	add    $0x10,%esp
+  cpu->intena = intena;
+8010647b:	89 98 b0 00 00 00    	mov    %ebx,0xb0(%eax)
+}
+80106481:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106484:	c9                   	leave
+80106485:	c3                   	ret
+    panic("sched proc->lock");
+80106486:	83 ec 0c             	sub    $0xc,%esp
+80106489:	68 04 ba 10 80       	push   $0x8010ba04
+8010648e:	e8 2d a7 ff ff       	call   80100bc0 <panic>
+    panic("sched interruptible");
+80106493:	83 ec 0c             	sub    $0xc,%esp
+80106496:	68 2f ba 10 80       	push   $0x8010ba2f
+8010649b:	e8 20 a7 ff ff       	call   80100bc0 <panic>
+    panic("sched running");
+801064a0:	83 ec 0c             	sub    $0xc,%esp
+801064a3:	68 21 ba 10 80       	push   $0x8010ba21
+801064a8:	e8 13 a7 ff ff       	call   80100bc0 <panic>
+    panic("sched locks");
+801064ad:	83 ec 0c             	sub    $0xc,%esp
+801064b0:	68 15 ba 10 80       	push   $0x8010ba15
+801064b5:	e8 06 a7 ff ff       	call   80100bc0 <panic>
+801064ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801064c0 <yield>:
+{
+801064c0:	55                   	push   %ebp
+801064c1:	89 e5                	mov    %esp,%ebp
+801064c3:	83 ec 14             	sub    $0x14,%esp
+  acquire(&proc->lock);  //DOC: yieldlock
+801064c6:	65 ff 35 04 00 00 00 	push   %gs:0x4
+801064cd:	e8 8e 08 00 00       	call   80106d60 <acquire>
+  setrunnable(proc);
+801064d2:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+801064d8:	e8 33 f5 ff ff       	call   80105a10 <setrunnable>
+  sched();
+801064dd:	e8 3e ff ff ff       	call   80106420 <sched>
+  release(&proc->lock);
+801064e2:	58                   	pop    %eax
+801064e3:	65 ff 35 04 00 00 00 	push   %gs:0x4
+801064ea:	e8 91 0a 00 00       	call   80106f80 <release>
+}
+801064ef:	83 c4 10             	add    $0x10,%esp
+801064f2:	c9                   	leave
+801064f3:	c3                   	ret
+801064f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801064fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801064ff:	90                   	nop
+
+80106500 <timeslice>:
+}
+80106500:	b8 01 00 00 00       	mov    $0x1,%eax
+80106505:	c3                   	ret
+80106506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010650d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106510 <sleep>:
+
+// Atomically release lock and sleep on chan.
+// Reacquires lock when awakened.
+void
+sleep(void *chan, struct spinlock *lk)
+{
+80106510:	55                   	push   %ebp
+80106511:	89 e5                	mov    %esp,%ebp
+80106513:	56                   	push   %esi
+80106514:	53                   	push   %ebx
+  if(proc == 0)
+80106515:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+{
+8010651b:	8b 75 08             	mov    0x8(%ebp),%esi
+8010651e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(proc == 0)
+80106521:	85 c0                	test   %eax,%eax
+80106523:	74 50                	je     80106575 <sleep+0x65>
+    panic("sleep");
+
+  if(lk == 0)
+80106525:	85 db                	test   %ebx,%ebx
+80106527:	74 59                	je     80106582 <sleep+0x72>
+  // change p->state and then call sched.
+  // Once we hold proc->lock, we can be
+  // guaranteed that we won't miss any wakeup
+  // (wakeup locks each p->lock it looks at),
+  // so it's okay to release lk.
+  acquire(&proc->lock);  //DOC: sleeplock1
+80106529:	83 ec 0c             	sub    $0xc,%esp
+8010652c:	50                   	push   %eax
+8010652d:	e8 2e 08 00 00       	call   80106d60 <acquire>
+  release(lk);
+80106532:	89 1c 24             	mov    %ebx,(%esp)
+80106535:	e8 46 0a 00 00       	call   80106f80 <release>
+
+  // Go to sleep.
+  proc->chan = chan;
+8010653a:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80106540:	89 70 64             	mov    %esi,0x64(%eax)
+  proc->state = SLEEPING;
+80106543:	c7 40 40 02 00 00 00 	movl   $0x2,0x40(%eax)
+  sched();
+8010654a:	e8 d1 fe ff ff       	call   80106420 <sched>
+
+  // Tidy up.
+  proc->chan = 0;
+8010654f:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80106555:	c7 40 64 00 00 00 00 	movl   $0x0,0x64(%eax)
+
+  // Reacquire original lock.
+  release(&proc->lock);  //DOC: sleeplock2
+8010655c:	89 04 24             	mov    %eax,(%esp)
+8010655f:	e8 1c 0a 00 00       	call   80106f80 <release>
+  acquire(lk);
+80106564:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80106567:	83 c4 10             	add    $0x10,%esp
+}
+8010656a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010656d:	5b                   	pop    %ebx
+8010656e:	5e                   	pop    %esi
+8010656f:	5d                   	pop    %ebp
+  acquire(lk);
+80106570:	e9 eb 07 00 00       	jmp    80106d60 <acquire>
+    panic("sleep");
+80106575:	83 ec 0c             	sub    $0xc,%esp
+80106578:	68 43 ba 10 80       	push   $0x8010ba43
+8010657d:	e8 3e a6 ff ff       	call   80100bc0 <panic>
+    panic("sleep without lk");
+80106582:	83 ec 0c             	sub    $0xc,%esp
+80106585:	68 49 ba 10 80       	push   $0x8010ba49
+8010658a:	e8 31 a6 ff ff       	call   80100bc0 <panic>
+8010658f:	90                   	nop
+
+80106590 <wait>:
+{
+80106590:	55                   	push   %ebp
+80106591:	89 e5                	mov    %esp,%ebp
+80106593:	56                   	push   %esi
+80106594:	53                   	push   %ebx
+  acquire(&ptable.lock);
+80106595:	83 ec 0c             	sub    $0xc,%esp
+80106598:	68 00 12 18 80       	push   $0x80181200
+8010659d:	e8 be 07 00 00       	call   80106d60 <acquire>
+801065a2:	83 c4 10             	add    $0x10,%esp
+    havekids = 0;
+801065a5:	31 c0                	xor    %eax,%eax
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801065a7:	bb 34 12 18 80       	mov    $0x80181234,%ebx
+801065ac:	eb 10                	jmp    801065be <wait+0x2e>
+801065ae:	66 90                	xchg   %ax,%ax
+801065b0:	81 c3 34 01 00 00    	add    $0x134,%ebx
+801065b6:	81 fb 34 5f 18 80    	cmp    $0x80185f34,%ebx
+801065bc:	74 3d                	je     801065fb <wait+0x6b>
+      if(p->parent != proc)
+801065be:	65 8b 15 04 00 00 00 	mov    %gs:0x4,%edx
+801065c5:	39 53 58             	cmp    %edx,0x58(%ebx)
+801065c8:	75 e6                	jne    801065b0 <wait+0x20>
+      acquire(&p->lock);
+801065ca:	83 ec 0c             	sub    $0xc,%esp
+801065cd:	53                   	push   %ebx
+801065ce:	e8 8d 07 00 00       	call   80106d60 <acquire>
+      if(p->state == ZOMBIE){
+801065d3:	83 c4 10             	add    $0x10,%esp
+801065d6:	83 7b 40 05          	cmpl   $0x5,0x40(%ebx)
+801065da:	74 5c                	je     80106638 <wait+0xa8>
+      release(&p->lock);
+801065dc:	83 ec 0c             	sub    $0xc,%esp
+801065df:	53                   	push   %ebx
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801065e0:	81 c3 34 01 00 00    	add    $0x134,%ebx
+      release(&p->lock);
+801065e6:	e8 95 09 00 00       	call   80106f80 <release>
+801065eb:	83 c4 10             	add    $0x10,%esp
+      havekids = 1;
+801065ee:	b8 01 00 00 00       	mov    $0x1,%eax
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801065f3:	81 fb 34 5f 18 80    	cmp    $0x80185f34,%ebx
+801065f9:	75 c3                	jne    801065be <wait+0x2e>
+    if(!havekids || proc->killed){
+801065fb:	85 c0                	test   %eax,%eax
+801065fd:	0f 84 9d 00 00 00    	je     801066a0 <wait+0x110>
+80106603:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80106609:	8b 50 68             	mov    0x68(%eax),%edx
+8010660c:	85 d2                	test   %edx,%edx
+8010660e:	0f 85 8c 00 00 00    	jne    801066a0 <wait+0x110>
+    proc->swappable = 1;
+80106614:	c7 80 0c 01 00 00 01 	movl   $0x1,0x10c(%eax)
+8010661b:	00 00 00 
+    sleep(proc, &ptable.lock);  //DOC: wait-sleep
+8010661e:	83 ec 08             	sub    $0x8,%esp
+80106621:	68 00 12 18 80       	push   $0x80181200
+80106626:	50                   	push   %eax
+80106627:	e8 e4 fe ff ff       	call   80106510 <sleep>
+    havekids = 0;
+8010662c:	83 c4 10             	add    $0x10,%esp
+8010662f:	e9 71 ff ff ff       	jmp    801065a5 <wait+0x15>
+80106634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        tracereap(p);
+80106638:	83 ec 0c             	sub    $0xc,%esp
+        pid = p->pid;
+8010663b:	8b 73 44             	mov    0x44(%ebx),%esi
+        tracereap(p);
+8010663e:	53                   	push   %ebx
+8010663f:	e8 ec 2c 00 00       	call   80109330 <tracereap>
+        kfree(p->kstack);
+80106644:	59                   	pop    %ecx
+80106645:	ff 73 3c             	push   0x3c(%ebx)
+80106648:	e8 63 cf ff ff       	call   801035b0 <kfree>
+        p->kstack = 0;
+8010664d:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+        freevm(p->pgdir);
+80106654:	58                   	pop    %eax
+80106655:	ff 73 38             	push   0x38(%ebx)
+80106658:	e8 93 46 00 00       	call   8010acf0 <freevm>
+        p->pid = 0;
+8010665d:	c7 43 44 00 00 00 00 	movl   $0x0,0x44(%ebx)
+        p->parent = 0;
+80106664:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+        p->name[0] = 0;
+8010666b:	c6 83 b0 00 00 00 00 	movb   $0x0,0xb0(%ebx)
+        p->killed = 0;
+80106672:	c7 43 68 00 00 00 00 	movl   $0x0,0x68(%ebx)
+        p->state = UNUSED;
+80106679:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+        release(&p->lock);
+80106680:	89 1c 24             	mov    %ebx,(%esp)
+80106683:	e8 f8 08 00 00       	call   80106f80 <release>
+        release(&ptable.lock);
+80106688:	c7 04 24 00 12 18 80 	movl   $0x80181200,(%esp)
+8010668f:	e8 ec 08 00 00       	call   80106f80 <release>
+        return pid;
+80106694:	83 c4 10             	add    $0x10,%esp
+}
+80106697:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010669a:	89 f0                	mov    %esi,%eax
+8010669c:	5b                   	pop    %ebx
+8010669d:	5e                   	pop    %esi
+8010669e:	5d                   	pop    %ebp
+8010669f:	c3                   	ret
+      release(&ptable.lock);
+801066a0:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+801066a3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+      release(&ptable.lock);
+801066a8:	68 00 12 18 80       	push   $0x80181200
+801066ad:	e8 ce 08 00 00       	call   80106f80 <release>
+      return -1;
+801066b2:	83 c4 10             	add    $0x10,%esp
+801066b5:	eb e0                	jmp    80106697 <wait+0x107>
+801066b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801066be:	66 90                	xchg   %ax,%ax
+
+801066c0 <procslot>:
+
+// Slot i of the process table, for kswapd's sweep over the
+// processes.  Caller must lock it before looking inside.
+struct proc*
+procslot(int i)
+{
+801066c0:	55                   	push   %ebp
+801066c1:	89 e5                	mov    %esp,%ebp
+  return &ptable.proc[i];
+801066c3:	69 45 08 34 01 00 00 	imul   $0x134,0x8(%ebp),%eax
+}
+801066ca:	5d                   	pop    %ebp
+  return &ptable.proc[i];
+801066cb:	05 34 12 18 80       	add    $0x80181234,%eax
+}
+801066d0:	c3                   	ret
+801066d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801066d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801066df:	90                   	nop
+
+801066e0 <wakeup>:
+// Wake up all processes sleeping on chan and queue them
+// on the run queue of the CPU they last ran on.
+// Must be called without any p->lock held.
+void
+wakeup(void *chan)
+{
+801066e0:	55                   	push   %ebp
+801066e1:	89 e5                	mov    %esp,%ebp
+801066e3:	56                   	push   %esi
+801066e4:	53                   	push   %ebx
+  struct proc *p;
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801066e5:	bb 34 12 18 80       	mov    $0x80181234,%ebx
+{
+801066ea:	8b 75 08             	mov    0x8(%ebp),%esi
+801066ed:	eb 1b                	jmp    8010670a <wakeup+0x2a>
+801066ef:	90                   	nop
+    if(p == proc)
+      continue;
+    acquire(&p->lock);
+    if(p->state == SLEEPING && p->chan == chan)
+      setrunnable(p);
+    release(&p->lock);
+801066f0:	83 ec 0c             	sub    $0xc,%esp
+801066f3:	53                   	push   %ebx
+801066f4:	e8 87 08 00 00       	call   80106f80 <release>
+801066f9:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801066fc:	81 c3 34 01 00 00    	add    $0x134,%ebx
+80106702:	81 fb 34 5f 18 80    	cmp    $0x80185f34,%ebx
+80106708:	74 2e                	je     80106738 <wakeup+0x58>
+    if(p == proc)
+8010670a:	65 39 1d 04 00 00 00 	cmp    %ebx,%gs:0x4
+80106711:	74 e9                	je     801066fc <wakeup+0x1c>
+    acquire(&p->lock);
+80106713:	83 ec 0c             	sub    $0xc,%esp
+80106716:	53                   	push   %ebx
+80106717:	e8 44 06 00 00       	call   80106d60 <acquire>
+    if(p->state == SLEEPING && p->chan == chan)
+8010671c:	83 c4 10             	add    $0x10,%esp
+8010671f:	83 7b 40 02          	cmpl   $0x2,0x40(%ebx)
+80106723:	75 cb                	jne    801066f0 <wakeup+0x10>
+80106725:	39 73 64             	cmp    %esi,0x64(%ebx)
+80106728:	75 c6                	jne    801066f0 <wakeup+0x10>
+      setrunnable(p);
+8010672a:	89 d8                	mov    %ebx,%eax
+8010672c:	e8 df f2 ff ff       	call   80105a10 <setrunnable>
+80106731:	eb bd                	jmp    801066f0 <wakeup+0x10>
+80106733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106737:	90                   	nop
+  }
+}
+80106738:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010673b:	5b                   	pop    %ebx
+8010673c:	5e                   	pop    %esi
+8010673d:	5d                   	pop    %ebp
+8010673e:	c3                   	ret
+8010673f:	90                   	nop
+
+80106740 <exit>:
+{
+80106740:	55                   	push   %ebp
+  if(proc == initproc)
+80106741:	65 8b 15 04 00 00 00 	mov    %gs:0x4,%edx
+{
+80106748:	89 e5                	mov    %esp,%ebp
+8010674a:	56                   	push   %esi
+8010674b:	53                   	push   %ebx
+8010674c:	31 db                	xor    %ebx,%ebx
+  if(proc == initproc)
+8010674e:	3b 15 34 5f 18 80    	cmp    0x80185f34,%edx
+80106754:	0f 84 51 01 00 00    	je     801068ab <exit+0x16b>
+8010675a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(proc->ofile[fd]){
+80106760:	8d 73 18             	lea    0x18(%ebx),%esi
+80106763:	8b 44 b2 0c          	mov    0xc(%edx,%esi,4),%eax
+80106767:	85 c0                	test   %eax,%eax
+80106769:	74 1b                	je     80106786 <exit+0x46>
+      fileclose(proc->ofile[fd]);
+8010676b:	83 ec 0c             	sub    $0xc,%esp
+8010676e:	50                   	push   %eax
+8010676f:	e8 dc b0 ff ff       	call   80101850 <fileclose>
+      proc->ofile[fd] = 0;
+80106774:	65 8b 15 04 00 00 00 	mov    %gs:0x4,%edx
+8010677b:	83 c4 10             	add    $0x10,%esp
+8010677e:	c7 44 b2 0c 00 00 00 	movl   $0x0,0xc(%edx,%esi,4)
+80106785:	00 
+  for(fd = 0; fd < NOFILE; fd++){
+80106786:	83 c3 01             	add    $0x1,%ebx
+80106789:	83 fb 10             	cmp    $0x10,%ebx
+8010678c:	75 d2                	jne    80106760 <exit+0x20>
+  if(proc->exe)
+8010678e:	8b 82 c4 00 00 00    	mov    0xc4(%edx),%eax
+80106794:	85 c0                	test   %eax,%eax
+80106796:	74 0c                	je     801067a4 <exit+0x64>
+    iallowwrite(proc->exe);
+80106798:	83 ec 0c             	sub    $0xc,%esp
+8010679b:	50                   	push   %eax
+8010679c:	e8 cf b9 ff ff       	call   80102170 <iallowwrite>
+801067a1:	83 c4 10             	add    $0x10,%esp
+  begin_op();
+801067a4:	e8 f7 df ff ff       	call   801047a0 <begin_op>
+  iput(proc->cwd);
+801067a9:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+801067af:	83 ec 0c             	sub    $0xc,%esp
+801067b2:	ff b0 ac 00 00 00    	push   0xac(%eax)
+801067b8:	e8 23 bb ff ff       	call   801022e0 <iput>
+  if(proc->exe)
+801067bd:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+801067c3:	83 c4 10             	add    $0x10,%esp
+801067c6:	8b 80 c4 00 00 00    	mov    0xc4(%eax),%eax
+801067cc:	85 c0                	test   %eax,%eax
+801067ce:	74 0c                	je     801067dc <exit+0x9c>
+    iput(proc->exe);
+801067d0:	83 ec 0c             	sub    $0xc,%esp
+801067d3:	50                   	push   %eax
+801067d4:	e8 07 bb ff ff       	call   801022e0 <iput>
+801067d9:	83 c4 10             	add    $0x10,%esp
+  end_op();
+801067dc:	e8 6f e0 ff ff       	call   80104850 <end_op>
+  proc->cwd = 0;
+801067e1:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  acquire(&ptable.lock);
+801067e7:	83 ec 0c             	sub    $0xc,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801067ea:	bb 34 12 18 80       	mov    $0x80181234,%ebx
+  proc->cwd = 0;
+801067ef:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+801067f6:	00 00 00 
+  proc->exe = 0;
+801067f9:	c7 80 c4 00 00 00 00 	movl   $0x0,0xc4(%eax)
+80106800:	00 00 00 
+  acquire(&ptable.lock);
+80106803:	68 00 12 18 80       	push   $0x80181200
+80106808:	e8 53 05 00 00       	call   80106d60 <acquire>
+  wakeup(proc->parent);
+8010680d:	58                   	pop    %eax
+8010680e:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80106814:	ff 70 58             	push   0x58(%eax)
+80106817:	e8 c4 fe ff ff       	call   801066e0 <wakeup>
+    if(p->parent == proc){
+8010681c:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80106822:	83 c4 10             	add    $0x10,%esp
+80106825:	eb 17                	jmp    8010683e <exit+0xfe>
+80106827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010682e:	66 90                	xchg   %ax,%ax
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106830:	81 c3 34 01 00 00    	add    $0x134,%ebx
+80106836:	81 fb 34 5f 18 80    	cmp    $0x80185f34,%ebx
+8010683c:	74 3a                	je     80106878 <exit+0x138>
+    if(p->parent == proc){
+8010683e:	39 43 58             	cmp    %eax,0x58(%ebx)
+80106841:	75 ed                	jne    80106830 <exit+0xf0>
+      p->parent = initproc;
+80106843:	8b 15 34 5f 18 80    	mov    0x80185f34,%edx
+      if(p->state == ZOMBIE)
+80106849:	83 7b 40 05          	cmpl   $0x5,0x40(%ebx)
+      p->parent = initproc;
+8010684d:	89 53 58             	mov    %edx,0x58(%ebx)
+      if(p->state == ZOMBIE)
+80106850:	75 de                	jne    80106830 <exit+0xf0>
+        wakeup(initproc);
+80106852:	83 ec 0c             	sub    $0xc,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106855:	81 c3 34 01 00 00    	add    $0x134,%ebx
+        wakeup(initproc);
+8010685b:	52                   	push   %edx
+8010685c:	e8 7f fe ff ff       	call   801066e0 <wakeup>
+  acquire(&proc->lock);
+80106861:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80106867:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+8010686a:	81 fb 34 5f 18 80    	cmp    $0x80185f34,%ebx
+80106870:	75 cc                	jne    8010683e <exit+0xfe>
+80106872:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  acquire(&proc->lock);
+80106878:	83 ec 0c             	sub    $0xc,%esp
+8010687b:	50                   	push   %eax
+8010687c:	e8 df 04 00 00       	call   80106d60 <acquire>
+  proc->state = ZOMBIE;
+80106881:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80106887:	c7 40 40 05 00 00 00 	movl   $0x5,0x40(%eax)
+  release(&ptable.lock);
+8010688e:	c7 04 24 00 12 18 80 	movl   $0x80181200,(%esp)
+80106895:	e8 e6 06 00 00       	call   80106f80 <release>
+  sched();
+8010689a:	e8 81 fb ff ff       	call   80106420 <sched>
+  panic("zombie exit");
+8010689f:	c7 04 24 67 ba 10 80 	movl   $0x8010ba67,(%esp)
+801068a6:	e8 15 a3 ff ff       	call   80100bc0 <panic>
+    panic("init exiting");
+801068ab:	83 ec 0c             	sub    $0xc,%esp
+801068ae:	68 5a ba 10 80       	push   $0x8010ba5a
+801068b3:	e8 08 a3 ff ff       	call   80100bc0 <panic>
+801068b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801068bf:	90                   	nop
+
+801068c0 <kill>:
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+int
+kill(int pid)
+{
+801068c0:	55                   	push   %ebp
+801068c1:	89 e5                	mov    %esp,%ebp
+801068c3:	56                   	push   %esi
+801068c4:	53                   	push   %ebx
+  struct proc *p;
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801068c5:	bb 34 12 18 80       	mov    $0x80181234,%ebx
+{
+801068ca:	8b 75 08             	mov    0x8(%ebp),%esi
+801068cd:	eb 1b                	jmp    801068ea <kill+0x2a>
+801068cf:	90                   	nop
+      if(p->state == SLEEPING)
+        setrunnable(p);
+      release(&p->lock);
+      return 0;
+    }
+    release(&p->lock);
+801068d0:	83 ec 0c             	sub    $0xc,%esp
+801068d3:	53                   	push   %ebx
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801068d4:	81 c3 34 01 00 00    	add    $0x134,%ebx
+    release(&p->lock);
+801068da:	e8 a1 06 00 00       	call   80106f80 <release>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801068df:	83 c4 10             	add    $0x10,%esp
+801068e2:	81 fb 34 5f 18 80    	cmp    $0x80185f34,%ebx
+801068e8:	74 36                	je     80106920 <kill+0x60>
+    acquire(&p->lock);
+801068ea:	83 ec 0c             	sub    $0xc,%esp
+801068ed:	53                   	push   %ebx
+801068ee:	e8 6d 04 00 00       	call   80106d60 <acquire>
+    if(p->pid == pid){
+801068f3:	83 c4 10             	add    $0x10,%esp
+801068f6:	39 73 44             	cmp    %esi,0x44(%ebx)
+801068f9:	75 d5                	jne    801068d0 <kill+0x10>
+      if(p->state == SLEEPING)
+801068fb:	83 7b 40 02          	cmpl   $0x2,0x40(%ebx)
+      p->killed = 1;
+801068ff:	c7 43 68 01 00 00 00 	movl   $0x1,0x68(%ebx)
+      if(p->state == SLEEPING)
+80106906:	74 28                	je     80106930 <kill+0x70>
+      release(&p->lock);
+80106908:	83 ec 0c             	sub    $0xc,%esp
+8010690b:	53                   	push   %ebx
+8010690c:	e8 6f 06 00 00       	call   80106f80 <release>
+      return 0;
+80106911:	83 c4 10             	add    $0x10,%esp
+  }
+  return -1;
+}
+80106914:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+80106917:	31 c0                	xor    %eax,%eax
+}
+80106919:	5b                   	pop    %ebx
+8010691a:	5e                   	pop    %esi
+8010691b:	5d                   	pop    %ebp
+8010691c:	c3                   	ret
+8010691d:	8d 76 00             	lea    0x0(%esi),%esi
+80106920:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return -1;
+80106923:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106928:	5b                   	pop    %ebx
+80106929:	5e                   	pop    %esi
+8010692a:	5d                   	pop    %ebp
+8010692b:	c3                   	ret
+8010692c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        setrunnable(p);
+80106930:	89 d8                	mov    %ebx,%eax
+80106932:	e8 d9 f0 ff ff       	call   80105a10 <setrunnable>
+80106937:	eb cf                	jmp    80106908 <kill+0x48>
+80106939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106940 <setnice>:
+// Set the nice level of the process with the given pid and
+// return its old level, or -1 if there is no such process.
+// The new weight applies from the process's next dispatch.
+int
+setnice(int pid, int nice)
+{
+80106940:	55                   	push   %ebp
+80106941:	89 e5                	mov    %esp,%ebp
+80106943:	57                   	push   %edi
+80106944:	56                   	push   %esi
+80106945:	53                   	push   %ebx
+80106946:	83 ec 0c             	sub    $0xc,%esp
+80106949:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010694c:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *p;
+  int old;
+
+  if(nice < NICEMIN || nice > NICEMAX)
+8010694f:	8d 47 ff             	lea    -0x1(%edi),%eax
+80106952:	83 f8 04             	cmp    $0x4,%eax
+80106955:	77 70                	ja     801069c7 <setnice+0x87>
+    panic("setnice");
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106957:	bb 34 12 18 80       	mov    $0x80181234,%ebx
+8010695c:	eb 1c                	jmp    8010697a <setnice+0x3a>
+8010695e:	66 90                	xchg   %ax,%ax
+      old = p->nice;
+      p->nice = nice;
+      release(&p->lock);
+      return old;
+    }
+    release(&p->lock);
+80106960:	83 ec 0c             	sub    $0xc,%esp
+80106963:	53                   	push   %ebx
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106964:	81 c3 34 01 00 00    	add    $0x134,%ebx
+    release(&p->lock);
+8010696a:	e8 11 06 00 00       	call   80106f80 <release>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+8010696f:	83 c4 10             	add    $0x10,%esp
+80106972:	81 fb 34 5f 18 80    	cmp    $0x80185f34,%ebx
+80106978:	74 3e                	je     801069b8 <setnice+0x78>
+    acquire(&p->lock);
+8010697a:	83 ec 0c             	sub    $0xc,%esp
+8010697d:	53                   	push   %ebx
+8010697e:	e8 dd 03 00 00       	call   80106d60 <acquire>
+    if(p->pid == pid && p->state != UNUSED){
+80106983:	83 c4 10             	add    $0x10,%esp
+80106986:	39 73 44             	cmp    %esi,0x44(%ebx)
+80106989:	75 d5                	jne    80106960 <setnice+0x20>
+8010698b:	8b 43 40             	mov    0x40(%ebx),%eax
+8010698e:	85 c0                	test   %eax,%eax
+80106990:	74 ce                	je     80106960 <setnice+0x20>
+      release(&p->lock);
+80106992:	83 ec 0c             	sub    $0xc,%esp
+      old = p->nice;
+80106995:	8b b3 20 01 00 00    	mov    0x120(%ebx),%esi
+      p->nice = nice;
+8010699b:	89 bb 20 01 00 00    	mov    %edi,0x120(%ebx)
+      release(&p->lock);
+801069a1:	53                   	push   %ebx
+801069a2:	e8 d9 05 00 00       	call   80106f80 <release>
+      return old;
+801069a7:	83 c4 10             	add    $0x10,%esp
+  }
+  return -1;
+}
+801069aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801069ad:	89 f0                	mov    %esi,%eax
+801069af:	5b                   	pop    %ebx
+801069b0:	5e                   	pop    %esi
+801069b1:	5f                   	pop    %edi
+801069b2:	5d                   	pop    %ebp
+801069b3:	c3                   	ret
+801069b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801069b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return -1;
+801069bb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+}
+801069c0:	5b                   	pop    %ebx
+801069c1:	89 f0                	mov    %esi,%eax
+801069c3:	5e                   	pop    %esi
+801069c4:	5f                   	pop    %edi
+801069c5:	5d                   	pop    %ebp
+801069c6:	c3                   	ret
+    panic("setnice");
+801069c7:	83 ec 0c             	sub    $0xc,%esp
+801069ca:	68 73 ba 10 80       	push   $0x8010ba73
+801069cf:	e8 ec a1 ff ff       	call   80100bc0 <panic>
+801069d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801069db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801069df:	90                   	nop
+
+801069e0 <settrace>:
+// the caller or -1 for the caller's parent (the shell running
+// strace).  Processes it creates from now on inherit the filter.
+// Returns 0, or -1 if there is no such process.
+int
+settrace(int pid, uint64 mask, int when)
+{
+801069e0:	55                   	push   %ebp
+801069e1:	89 e5                	mov    %esp,%ebp
+801069e3:	56                   	push   %esi
+801069e4:	53                   	push   %ebx
+801069e5:	83 ec 10             	sub    $0x10,%esp
+801069e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+801069eb:	8b 55 10             	mov    0x10(%ebp),%edx
+801069ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801069f1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+801069f4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  struct proc *p;
+
+  if(pid == 0)
+801069f7:	85 db                	test   %ebx,%ebx
+801069f9:	75 5d                	jne    80106a58 <settrace+0x78>
+    pid = proc->pid;
+801069fb:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80106a01:	8b 58 44             	mov    0x44(%eax),%ebx
+  else if(pid == -1){
+    acquire(&ptable.lock);
+    pid = proc->parent ? proc->parent->pid : 0;
+    release(&ptable.lock);
+  }
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106a04:	be 34 12 18 80       	mov    $0x80181234,%esi
+80106a09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    acquire(&p->lock);
+80106a10:	83 ec 0c             	sub    $0xc,%esp
+80106a13:	56                   	push   %esi
+80106a14:	e8 47 03 00 00       	call   80106d60 <acquire>
+    if(p->pid == pid && p->state != UNUSED && p->state != ZOMBIE){
+80106a19:	83 c4 10             	add    $0x10,%esp
+80106a1c:	39 5e 44             	cmp    %ebx,0x44(%esi)
+80106a1f:	75 0c                	jne    80106a2d <settrace+0x4d>
+80106a21:	8b 56 40             	mov    0x40(%esi),%edx
+80106a24:	83 fa 05             	cmp    $0x5,%edx
+80106a27:	74 04                	je     80106a2d <settrace+0x4d>
+80106a29:	85 d2                	test   %edx,%edx
+80106a2b:	75 6b                	jne    80106a98 <settrace+0xb8>
+      p->tracemask = mask;
+      p->tracewhen = when;
+      release(&p->lock);
+      return 0;
+    }
+    release(&p->lock);
+80106a2d:	83 ec 0c             	sub    $0xc,%esp
+80106a30:	56                   	push   %esi
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106a31:	81 c6 34 01 00 00    	add    $0x134,%esi
+    release(&p->lock);
+80106a37:	e8 44 05 00 00       	call   80106f80 <release>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106a3c:	83 c4 10             	add    $0x10,%esp
+80106a3f:	81 fe 34 5f 18 80    	cmp    $0x80185f34,%esi
+80106a45:	75 c9                	jne    80106a10 <settrace+0x30>
+  }
+  return -1;
+}
+80106a47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return -1;
+80106a4a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106a4f:	5b                   	pop    %ebx
+80106a50:	5e                   	pop    %esi
+80106a51:	5d                   	pop    %ebp
+80106a52:	c3                   	ret
+80106a53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106a57:	90                   	nop
+  else if(pid == -1){
+80106a58:	83 fb ff             	cmp    $0xffffffff,%ebx
+80106a5b:	75 a7                	jne    80106a04 <settrace+0x24>
+    acquire(&ptable.lock);
+80106a5d:	83 ec 0c             	sub    $0xc,%esp
+    pid = proc->parent ? proc->parent->pid : 0;
+80106a60:	31 db                	xor    %ebx,%ebx
+    acquire(&ptable.lock);
+80106a62:	68 00 12 18 80       	push   $0x80181200
+80106a67:	e8 f4 02 00 00       	call   80106d60 <acquire>
+    pid = proc->parent ? proc->parent->pid : 0;
+80106a6c:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80106a72:	83 c4 10             	add    $0x10,%esp
+80106a75:	8b 40 58             	mov    0x58(%eax),%eax
+80106a78:	85 c0                	test   %eax,%eax
+80106a7a:	74 03                	je     80106a7f <settrace+0x9f>
+80106a7c:	8b 58 44             	mov    0x44(%eax),%ebx
+    release(&ptable.lock);
+80106a7f:	83 ec 0c             	sub    $0xc,%esp
+80106a82:	68 00 12 18 80       	push   $0x80181200
+80106a87:	e8 f4 04 00 00       	call   80106f80 <release>
+80106a8c:	83 c4 10             	add    $0x10,%esp
+80106a8f:	e9 70 ff ff ff       	jmp    80106a04 <settrace+0x24>
+80106a94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      p->tracemask = mask;
+80106a98:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80106a9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      release(&p->lock);
+80106a9e:	83 ec 0c             	sub    $0xc,%esp
+      p->tracemask = mask;
+80106aa1:	89 56 4c             	mov    %edx,0x4c(%esi)
+      p->tracewhen = when;
+80106aa4:	8b 55 14             	mov    0x14(%ebp),%edx
+      p->tracemask = mask;
+80106aa7:	89 46 48             	mov    %eax,0x48(%esi)
+      p->tracewhen = when;
+80106aaa:	89 56 50             	mov    %edx,0x50(%esi)
+      release(&p->lock);
+80106aad:	56                   	push   %esi
+80106aae:	e8 cd 04 00 00       	call   80106f80 <release>
+      return 0;
+80106ab3:	83 c4 10             	add    $0x10,%esp
+}
+80106ab6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+80106ab9:	31 c0                	xor    %eax,%eax
+}
+80106abb:	5b                   	pop    %ebx
+80106abc:	5e                   	pop    %esi
+80106abd:	5d                   	pop    %ebp
+80106abe:	c3                   	ret
+80106abf:	90                   	nop
+
+80106ac0 <procstat>:
+
+// Copy the system call statistics of process pid into st, which
+// has room for NCALLSTAT.  Returns -1 if there is no such process.
+int
+procstat(int pid, struct callstat *st)
+{
+80106ac0:	55                   	push   %ebp
+80106ac1:	89 e5                	mov    %esp,%ebp
+80106ac3:	53                   	push   %ebx
+80106ac4:	83 ec 10             	sub    $0x10,%esp
+80106ac7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+80106aca:	68 00 12 18 80       	push   $0x80181200
+80106acf:	e8 8c 02 00 00       	call   80106d60 <acquire>
+80106ad4:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106ad7:	b8 34 12 18 80       	mov    $0x80181234,%eax
+80106adc:	eb 0e                	jmp    80106aec <procstat+0x2c>
+80106ade:	66 90                	xchg   %ax,%ax
+80106ae0:	05 34 01 00 00       	add    $0x134,%eax
+80106ae5:	3d 34 5f 18 80       	cmp    $0x80185f34,%eax
+80106aea:	74 44                	je     80106b30 <procstat+0x70>
+    if(p->pid == pid && p->state != UNUSED){
+80106aec:	39 58 44             	cmp    %ebx,0x44(%eax)
+80106aef:	75 ef                	jne    80106ae0 <procstat+0x20>
+80106af1:	8b 50 40             	mov    0x40(%eax),%edx
+80106af4:	85 d2                	test   %edx,%edx
+80106af6:	74 e8                	je     80106ae0 <procstat+0x20>
+      if(p->callstat)
+80106af8:	8b 40 54             	mov    0x54(%eax),%eax
+80106afb:	85 c0                	test   %eax,%eax
+80106afd:	74 4b                	je     80106b4a <procstat+0x8a>
+        memmove(st, p->callstat, NCALLSTAT*sizeof(*st));
+80106aff:	83 ec 04             	sub    $0x4,%esp
+80106b02:	68 c0 0f 00 00       	push   $0xfc0
+80106b07:	50                   	push   %eax
+80106b08:	ff 75 0c             	push   0xc(%ebp)
+80106b0b:	e8 c0 07 00 00       	call   801072d0 <memmove>
+80106b10:	83 c4 10             	add    $0x10,%esp
+      else
+        memset(st, 0, NCALLSTAT*sizeof(*st));
+      release(&ptable.lock);
+80106b13:	83 ec 0c             	sub    $0xc,%esp
+80106b16:	68 00 12 18 80       	push   $0x80181200
+80106b1b:	e8 60 04 00 00       	call   80106f80 <release>
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+80106b20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      return 0;
+80106b23:	83 c4 10             	add    $0x10,%esp
+80106b26:	31 c0                	xor    %eax,%eax
+}
+80106b28:	c9                   	leave
+80106b29:	c3                   	ret
+80106b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  release(&ptable.lock);
+80106b30:	83 ec 0c             	sub    $0xc,%esp
+80106b33:	68 00 12 18 80       	push   $0x80181200
+80106b38:	e8 43 04 00 00       	call   80106f80 <release>
+}
+80106b3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+80106b40:	83 c4 10             	add    $0x10,%esp
+80106b43:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80106b48:	c9                   	leave
+80106b49:	c3                   	ret
+        memset(st, 0, NCALLSTAT*sizeof(*st));
+80106b4a:	83 ec 04             	sub    $0x4,%esp
+80106b4d:	68 c0 0f 00 00       	push   $0xfc0
+80106b52:	6a 00                	push   $0x0
+80106b54:	ff 75 0c             	push   0xc(%ebp)
+80106b57:	e8 e4 06 00 00       	call   80107240 <memset>
+80106b5c:	83 c4 10             	add    $0x10,%esp
+80106b5f:	eb b2                	jmp    80106b13 <procstat+0x53>
+80106b61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106b6f:	90                   	nop
+
+80106b70 <procdump>:
+// Print a process listing to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+80106b70:	55                   	push   %ebp
+80106b71:	89 e5                	mov    %esp,%ebp
+80106b73:	57                   	push   %edi
+80106b74:	56                   	push   %esi
+80106b75:	8d 75 e8             	lea    -0x18(%ebp),%esi
+80106b78:	53                   	push   %ebx
+80106b79:	bb e4 12 18 80       	mov    $0x801812e4,%ebx
+80106b7e:	83 ec 3c             	sub    $0x3c,%esp
+80106b81:	eb 27                	jmp    80106baa <procdump+0x3a>
+80106b83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106b87:	90                   	nop
+    if(p->state == SLEEPING){
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+80106b88:	83 ec 0c             	sub    $0xc,%esp
+80106b8b:	68 92 b9 10 80       	push   $0x8010b992
+80106b90:	e8 5b a3 ff ff       	call   80100ef0 <cprintf>
+80106b95:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106b98:	81 c3 34 01 00 00    	add    $0x134,%ebx
+80106b9e:	81 fb e4 5f 18 80    	cmp    $0x80185fe4,%ebx
+80106ba4:	0f 84 7e 00 00 00    	je     80106c28 <procdump+0xb8>
+    if(p->state == UNUSED)
+80106baa:	8b 43 90             	mov    -0x70(%ebx),%eax
+80106bad:	85 c0                	test   %eax,%eax
+80106baf:	74 e7                	je     80106b98 <procdump+0x28>
+      state = "???";
+80106bb1:	ba 7b ba 10 80       	mov    $0x8010ba7b,%edx
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+80106bb6:	83 f8 05             	cmp    $0x5,%eax
+80106bb9:	77 11                	ja     80106bcc <procdump+0x5c>
+80106bbb:	8b 14 85 b4 ba 10 80 	mov    -0x7fef454c(,%eax,4),%edx
+      state = "???";
+80106bc2:	b8 7b ba 10 80       	mov    $0x8010ba7b,%eax
+80106bc7:	85 d2                	test   %edx,%edx
+80106bc9:	0f 44 d0             	cmove  %eax,%edx
+    cprintf("%d %s %s", p->pid, state, p->name);
+80106bcc:	53                   	push   %ebx
+80106bcd:	52                   	push   %edx
+80106bce:	ff 73 94             	push   -0x6c(%ebx)
+80106bd1:	68 7f ba 10 80       	push   $0x8010ba7f
+80106bd6:	e8 15 a3 ff ff       	call   80100ef0 <cprintf>
+    if(p->state == SLEEPING){
+80106bdb:	83 c4 10             	add    $0x10,%esp
+80106bde:	83 7b 90 02          	cmpl   $0x2,-0x70(%ebx)
+80106be2:	75 a4                	jne    80106b88 <procdump+0x18>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80106be4:	83 ec 08             	sub    $0x8,%esp
+80106be7:	8d 45 c0             	lea    -0x40(%ebp),%eax
+80106bea:	8d 7d c0             	lea    -0x40(%ebp),%edi
+80106bed:	50                   	push   %eax
+80106bee:	8b 43 b0             	mov    -0x50(%ebx),%eax
+80106bf1:	8b 40 0c             	mov    0xc(%eax),%eax
+80106bf4:	83 c0 08             	add    $0x8,%eax
+80106bf7:	50                   	push   %eax
+80106bf8:	e8 63 02 00 00       	call   80106e60 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106bfd:	83 c4 10             	add    $0x10,%esp
+80106c00:	8b 17                	mov    (%edi),%edx
+80106c02:	85 d2                	test   %edx,%edx
+80106c04:	74 82                	je     80106b88 <procdump+0x18>
+        cprintf(" %p", pc[i]);
+80106c06:	83 ec 08             	sub    $0x8,%esp
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106c09:	83 c7 04             	add    $0x4,%edi
+        cprintf(" %p", pc[i]);
+80106c0c:	52                   	push   %edx
+80106c0d:	68 84 b4 10 80       	push   $0x8010b484
+80106c12:	e8 d9 a2 ff ff       	call   80100ef0 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106c17:	83 c4 10             	add    $0x10,%esp
+80106c1a:	39 f7                	cmp    %esi,%edi
+80106c1c:	75 e2                	jne    80106c00 <procdump+0x90>
+80106c1e:	e9 65 ff ff ff       	jmp    80106b88 <procdump+0x18>
+80106c23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106c27:	90                   	nop
+  }
+80106c28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106c2b:	5b                   	pop    %ebx
+80106c2c:	5e                   	pop    %esi
+80106c2d:	5f                   	pop    %edi
+80106c2e:	5d                   	pop    %ebp
+80106c2f:	c3                   	ret
+
+80106c30 <initsleeplock>:
+#include "proc.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+80106c30:	55                   	push   %ebp
+80106c31:	89 e5                	mov    %esp,%ebp
+80106c33:	53                   	push   %ebx
+80106c34:	83 ec 0c             	sub    $0xc,%esp
+80106c37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+80106c3a:	68 e4 ba 10 80       	push   $0x8010bae4
+80106c3f:	8d 43 04             	lea    0x4(%ebx),%eax
+80106c42:	50                   	push   %eax
+80106c43:	e8 f8 00 00 00       	call   80106d40 <initlock>
+  lk->name = name;
+80106c48:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lk->locked = 0;
+80106c4b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+}
+80106c51:	83 c4 10             	add    $0x10,%esp
+  lk->pid = 0;
+80106c54:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  lk->name = name;
+80106c5b:	89 43 38             	mov    %eax,0x38(%ebx)
+}
+80106c5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106c61:	c9                   	leave
+80106c62:	c3                   	ret
+80106c63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106c70 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+80106c70:	55                   	push   %ebp
+80106c71:	89 e5                	mov    %esp,%ebp
+80106c73:	56                   	push   %esi
+80106c74:	53                   	push   %ebx
+80106c75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80106c78:	8d 73 04             	lea    0x4(%ebx),%esi
+80106c7b:	83 ec 0c             	sub    $0xc,%esp
+80106c7e:	56                   	push   %esi
+80106c7f:	e8 dc 00 00 00       	call   80106d60 <acquire>
+  while (lk->locked) {
+80106c84:	8b 13                	mov    (%ebx),%edx
+80106c86:	83 c4 10             	add    $0x10,%esp
+80106c89:	85 d2                	test   %edx,%edx
+80106c8b:	74 16                	je     80106ca3 <acquiresleep+0x33>
+80106c8d:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(lk, &lk->lk);
+80106c90:	83 ec 08             	sub    $0x8,%esp
+80106c93:	56                   	push   %esi
+80106c94:	53                   	push   %ebx
+80106c95:	e8 76 f8 ff ff       	call   80106510 <sleep>
+  while (lk->locked) {
+80106c9a:	8b 03                	mov    (%ebx),%eax
+80106c9c:	83 c4 10             	add    $0x10,%esp
+80106c9f:	85 c0                	test   %eax,%eax
+80106ca1:	75 ed                	jne    80106c90 <acquiresleep+0x20>
+  }
+  lk->locked = 1;
+80106ca3:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = proc->pid;
+80106ca9:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80106caf:	8b 40 44             	mov    0x44(%eax),%eax
+80106cb2:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&lk->lk);
+80106cb5:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80106cb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106cbb:	5b                   	pop    %ebx
+80106cbc:	5e                   	pop    %esi
+80106cbd:	5d                   	pop    %ebp
+  release(&lk->lk);
+80106cbe:	e9 bd 02 00 00       	jmp    80106f80 <release>
+80106cc3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106cd0 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80106cd0:	55                   	push   %ebp
+80106cd1:	89 e5                	mov    %esp,%ebp
+80106cd3:	56                   	push   %esi
+80106cd4:	53                   	push   %ebx
+80106cd5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80106cd8:	8d 73 04             	lea    0x4(%ebx),%esi
+80106cdb:	83 ec 0c             	sub    $0xc,%esp
+80106cde:	56                   	push   %esi
+80106cdf:	e8 7c 00 00 00       	call   80106d60 <acquire>
+  lk->locked = 0;
+80106ce4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+80106cea:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  wakeup(lk);
+80106cf1:	89 1c 24             	mov    %ebx,(%esp)
+80106cf4:	e8 e7 f9 ff ff       	call   801066e0 <wakeup>
+  release(&lk->lk);
+80106cf9:	89 75 08             	mov    %esi,0x8(%ebp)
+80106cfc:	83 c4 10             	add    $0x10,%esp
+}
+80106cff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106d02:	5b                   	pop    %ebx
+80106d03:	5e                   	pop    %esi
+80106d04:	5d                   	pop    %ebp
+  release(&lk->lk);
+80106d05:	e9 76 02 00 00       	jmp    80106f80 <release>
+80106d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106d10 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+80106d10:	55                   	push   %ebp
+80106d11:	89 e5                	mov    %esp,%ebp
+80106d13:	56                   	push   %esi
+80106d14:	53                   	push   %ebx
+80106d15:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  
+  acquire(&lk->lk);
+80106d18:	8d 5e 04             	lea    0x4(%esi),%ebx
+80106d1b:	83 ec 0c             	sub    $0xc,%esp
+80106d1e:	53                   	push   %ebx
+80106d1f:	e8 3c 00 00 00       	call   80106d60 <acquire>
+  r = lk->locked;
+80106d24:	8b 36                	mov    (%esi),%esi
+  release(&lk->lk);
+80106d26:	89 1c 24             	mov    %ebx,(%esp)
+80106d29:	e8 52 02 00 00       	call   80106f80 <release>
+  return r;
+}
+80106d2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106d31:	89 f0                	mov    %esi,%eax
+80106d33:	5b                   	pop    %ebx
+80106d34:	5e                   	pop    %esi
+80106d35:	5d                   	pop    %ebp
+80106d36:	c3                   	ret
+80106d37:	66 90                	xchg   %ax,%ax
+80106d39:	66 90                	xchg   %ax,%ax
+80106d3b:	66 90                	xchg   %ax,%ax
+80106d3d:	66 90                	xchg   %ax,%ax
+80106d3f:	90                   	nop
+
+80106d40 <initlock>:
+#include "spinlock.h"
+#include "proc.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80106d40:	55                   	push   %ebp
+80106d41:	89 e5                	mov    %esp,%ebp
+80106d43:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+80106d46:	8b 55 0c             	mov    0xc(%ebp),%edx
+  lk->locked = 0;
+80106d49:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->name = name;
+80106d4f:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->cpu = 0;
+80106d52:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+80106d59:	5d                   	pop    %ebp
+80106d5a:	c3                   	ret
+80106d5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106d5f:	90                   	nop
+
+80106d60 <acquire>:
+// Loops (spins) until the lock is acquired.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+acquire(struct spinlock *lk)
+{
+80106d60:	55                   	push   %ebp
+80106d61:	89 e5                	mov    %esp,%ebp
+80106d63:	53                   	push   %ebx
+80106d64:	83 ec 04             	sub    $0x4,%esp
+80106d67:	9c                   	pushf
+80106d68:	5a                   	pop    %edx
+  asm volatile("cli");
+80106d69:	fa                   	cli
+{
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(cpu->ncli == 0)
+80106d6a:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+80106d71:	8b 81 ac 00 00 00    	mov    0xac(%ecx),%eax
+80106d77:	85 c0                	test   %eax,%eax
+80106d79:	75 0c                	jne    80106d87 <acquire+0x27>
+    cpu->intena = eflags & FL_IF;
+80106d7b:	81 e2 00 02 00 00    	and    $0x200,%edx
+80106d81:	89 91 b0 00 00 00    	mov    %edx,0xb0(%ecx)
+  if(holding(lk))
+80106d87:	8b 55 08             	mov    0x8(%ebp),%edx
+  cpu->ncli += 1;
+80106d8a:	83 c0 01             	add    $0x1,%eax
+80106d8d:	89 81 ac 00 00 00    	mov    %eax,0xac(%ecx)
+  return lock->locked && lock->cpu == cpu;
+80106d93:	8b 02                	mov    (%edx),%eax
+80106d95:	85 c0                	test   %eax,%eax
+80106d97:	74 09                	je     80106da2 <acquire+0x42>
+80106d99:	39 4a 08             	cmp    %ecx,0x8(%edx)
+80106d9c:	0f 84 a6 00 00 00    	je     80106e48 <acquire+0xe8>
+  asm volatile("lock; xchgl %0, %1" :
+80106da2:	b8 01 00 00 00       	mov    $0x1,%eax
+80106da7:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+80106daa:	31 c9                	xor    %ecx,%ecx
+80106dac:	bb 01 00 00 00       	mov    $0x1,%ebx
+80106db1:	85 c0                	test   %eax,%eax
+80106db3:	74 22                	je     80106dd7 <acquire+0x77>
+80106db5:	8d 76 00             	lea    0x0(%esi),%esi
+80106db8:	8b 55 08             	mov    0x8(%ebp),%edx
+    spins++;
+80106dbb:	83 c1 01             	add    $0x1,%ecx
+80106dbe:	89 d8                	mov    %ebx,%eax
+80106dc0:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+80106dc3:	85 c0                	test   %eax,%eax
+80106dc5:	75 f1                	jne    80106db8 <acquire+0x58>
+  if(spins)
+80106dc7:	85 c9                	test   %ecx,%ecx
+80106dc9:	74 0c                	je     80106dd7 <acquire+0x77>
+    cpu->stat[ST_SPIN] += spins;  // interrupts are off: no statinc()
+80106dcb:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+80106dd1:	01 88 d8 00 00 00    	add    %ecx,0xd8(%eax)
+  __sync_synchronize();
+80106dd7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  for(i = 0; i < 10; i++){
+80106ddc:	31 d2                	xor    %edx,%edx
+  lk->cpu = cpu;
+80106dde:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+80106de4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80106de7:	89 41 08             	mov    %eax,0x8(%ecx)
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80106dea:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+80106df0:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+80106df5:	77 31                	ja     80106e28 <acquire+0xc8>
+  ebp = (uint*)v - 2;
+80106df7:	89 e8                	mov    %ebp,%eax
+80106df9:	eb 13                	jmp    80106e0e <acquire+0xae>
+80106dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106dff:	90                   	nop
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80106e00:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+80106e06:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80106e0c:	77 1a                	ja     80106e28 <acquire+0xc8>
+    pcs[i] = ebp[1];     // saved %eip
+80106e0e:	8b 58 04             	mov    0x4(%eax),%ebx
+80106e11:	89 5c 91 0c          	mov    %ebx,0xc(%ecx,%edx,4)
+  for(i = 0; i < 10; i++){
+80106e15:	83 c2 01             	add    $0x1,%edx
+    ebp = (uint*)ebp[0]; // saved %ebp
+80106e18:	8b 00                	mov    (%eax),%eax
+  for(i = 0; i < 10; i++){
+80106e1a:	83 fa 0a             	cmp    $0xa,%edx
+80106e1d:	75 e1                	jne    80106e00 <acquire+0xa0>
+}
+80106e1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106e22:	c9                   	leave
+80106e23:	c3                   	ret
+80106e24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106e28:	8d 44 91 0c          	lea    0xc(%ecx,%edx,4),%eax
+80106e2c:	83 c1 34             	add    $0x34,%ecx
+80106e2f:	90                   	nop
+    pcs[i] = 0;
+80106e30:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80106e36:	83 c0 04             	add    $0x4,%eax
+80106e39:	39 c1                	cmp    %eax,%ecx
+80106e3b:	75 f3                	jne    80106e30 <acquire+0xd0>
+}
+80106e3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106e40:	c9                   	leave
+80106e41:	c3                   	ret
+80106e42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    panic("acquire");
+80106e48:	83 ec 0c             	sub    $0xc,%esp
+80106e4b:	68 ef ba 10 80       	push   $0x8010baef
+80106e50:	e8 6b 9d ff ff       	call   80100bc0 <panic>
+80106e55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106e5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106e60 <getcallerpcs>:
+{
+80106e60:	55                   	push   %ebp
+80106e61:	89 e5                	mov    %esp,%ebp
+80106e63:	53                   	push   %ebx
+80106e64:	8b 45 08             	mov    0x8(%ebp),%eax
+80106e67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  ebp = (uint*)v - 2;
+80106e6a:	8d 50 f8             	lea    -0x8(%eax),%edx
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80106e6d:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+80106e72:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+  for(i = 0; i < 10; i++){
+80106e77:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80106e7c:	76 10                	jbe    80106e8e <getcallerpcs+0x2e>
+80106e7e:	eb 28                	jmp    80106ea8 <getcallerpcs+0x48>
+80106e80:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+80106e86:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80106e8c:	77 1a                	ja     80106ea8 <getcallerpcs+0x48>
+    pcs[i] = ebp[1];     // saved %eip
+80106e8e:	8b 5a 04             	mov    0x4(%edx),%ebx
+80106e91:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+  for(i = 0; i < 10; i++){
+80106e94:	83 c0 01             	add    $0x1,%eax
+    ebp = (uint*)ebp[0]; // saved %ebp
+80106e97:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+80106e99:	83 f8 0a             	cmp    $0xa,%eax
+80106e9c:	75 e2                	jne    80106e80 <getcallerpcs+0x20>
+}
+80106e9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106ea1:	c9                   	leave
+80106ea2:	c3                   	ret
+80106ea3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106ea7:	90                   	nop
+80106ea8:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+80106eab:	8d 51 28             	lea    0x28(%ecx),%edx
+80106eae:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80106eb0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80106eb6:	83 c0 04             	add    $0x4,%eax
+80106eb9:	39 d0                	cmp    %edx,%eax
+80106ebb:	75 f3                	jne    80106eb0 <getcallerpcs+0x50>
+}
+80106ebd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106ec0:	c9                   	leave
+80106ec1:	c3                   	ret
+80106ec2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106ec9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106ed0 <holding>:
+{
+80106ed0:	55                   	push   %ebp
+80106ed1:	89 e5                	mov    %esp,%ebp
+80106ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  return lock->locked && lock->cpu == cpu;
+80106ed6:	8b 02                	mov    (%edx),%eax
+80106ed8:	85 c0                	test   %eax,%eax
+80106eda:	74 14                	je     80106ef0 <holding+0x20>
+80106edc:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+80106ee2:	39 42 08             	cmp    %eax,0x8(%edx)
+80106ee5:	0f 94 c0             	sete   %al
+}
+80106ee8:	5d                   	pop    %ebp
+  return lock->locked && lock->cpu == cpu;
+80106ee9:	0f b6 c0             	movzbl %al,%eax
+}
+80106eec:	c3                   	ret
+80106eed:	8d 76 00             	lea    0x0(%esi),%esi
+80106ef0:	31 c0                	xor    %eax,%eax
+80106ef2:	5d                   	pop    %ebp
+80106ef3:	c3                   	ret
+80106ef4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106efb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106eff:	90                   	nop
+
+80106f00 <pushcli>:
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106f00:	9c                   	pushf
+80106f01:	59                   	pop    %ecx
+  asm volatile("cli");
+80106f02:	fa                   	cli
+  if(cpu->ncli == 0)
+80106f03:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+80106f0a:	8b 82 ac 00 00 00    	mov    0xac(%edx),%eax
+80106f10:	85 c0                	test   %eax,%eax
+80106f12:	75 0c                	jne    80106f20 <pushcli+0x20>
+    cpu->intena = eflags & FL_IF;
+80106f14:	81 e1 00 02 00 00    	and    $0x200,%ecx
+80106f1a:	89 8a b0 00 00 00    	mov    %ecx,0xb0(%edx)
+  cpu->ncli += 1;
+80106f20:	83 c0 01             	add    $0x1,%eax
+80106f23:	89 82 ac 00 00 00    	mov    %eax,0xac(%edx)
+}
+80106f29:	c3                   	ret
+80106f2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106f30 <popcli>:
+
+void
+popcli(void)
+{
+80106f30:	55                   	push   %ebp
+80106f31:	89 e5                	mov    %esp,%ebp
+80106f33:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106f36:	9c                   	pushf
+80106f37:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80106f38:	f6 c4 02             	test   $0x2,%ah
+80106f3b:	75 2c                	jne    80106f69 <popcli+0x39>
+    panic("popcli - interruptible");
+  if(--cpu->ncli < 0)
+80106f3d:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+80106f44:	83 aa ac 00 00 00 01 	subl   $0x1,0xac(%edx)
+80106f4b:	78 0f                	js     80106f5c <popcli+0x2c>
+    panic("popcli");
+  if(cpu->ncli == 0 && cpu->intena)
+80106f4d:	75 0b                	jne    80106f5a <popcli+0x2a>
+80106f4f:	8b 82 b0 00 00 00    	mov    0xb0(%edx),%eax
+80106f55:	85 c0                	test   %eax,%eax
+80106f57:	74 01                	je     80106f5a <popcli+0x2a>
+  asm volatile("sti");
+80106f59:	fb                   	sti
+    sti();
+}
+80106f5a:	c9                   	leave
+80106f5b:	c3                   	ret
+    panic("popcli");
+80106f5c:	83 ec 0c             	sub    $0xc,%esp
+80106f5f:	68 0e bb 10 80       	push   $0x8010bb0e
+80106f64:	e8 57 9c ff ff       	call   80100bc0 <panic>
+    panic("popcli - interruptible");
+80106f69:	83 ec 0c             	sub    $0xc,%esp
+80106f6c:	68 f7 ba 10 80       	push   $0x8010baf7
+80106f71:	e8 4a 9c ff ff       	call   80100bc0 <panic>
+80106f76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106f7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106f80 <release>:
+{
+80106f80:	55                   	push   %ebp
+80106f81:	89 e5                	mov    %esp,%ebp
+80106f83:	83 ec 08             	sub    $0x8,%esp
+80106f86:	8b 45 08             	mov    0x8(%ebp),%eax
+  return lock->locked && lock->cpu == cpu;
+80106f89:	8b 10                	mov    (%eax),%edx
+80106f8b:	85 d2                	test   %edx,%edx
+80106f8d:	74 0c                	je     80106f9b <release+0x1b>
+80106f8f:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+80106f96:	39 50 08             	cmp    %edx,0x8(%eax)
+80106f99:	74 15                	je     80106fb0 <release+0x30>
+    panic("release");
+80106f9b:	83 ec 0c             	sub    $0xc,%esp
+80106f9e:	68 15 bb 10 80       	push   $0x8010bb15
+80106fa3:	e8 18 9c ff ff       	call   80100bc0 <panic>
+80106fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106faf:	90                   	nop
+  lk->pcs[0] = 0;
+80106fb0:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  lk->cpu = 0;
+80106fb7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  __sync_synchronize();
+80106fbe:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80106fc3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+80106fc9:	c9                   	leave
+  popcli();
+80106fca:	e9 61 ff ff ff       	jmp    80106f30 <popcli>
+80106fcf:	90                   	nop
+
+80106fd0 <statsread>:
+// Up to 10 digits and a separator for each field.
+#define STATLINE ((NSTAT+1)*11)
+
+static int
+statsread(struct inode *ip, char *dst, uint off, int n)
+{
+80106fd0:	55                   	push   %ebp
+  while(*s)
+80106fd1:	b8 1d bb 10 80       	mov    $0x8010bb1d,%eax
+{
+80106fd6:	89 e5                	mov    %esp,%ebp
+80106fd8:	57                   	push   %edi
+80106fd9:	56                   	push   %esi
+  while(*s)
+80106fda:	8d 95 d0 fc ff ff    	lea    -0x330(%ebp),%edx
+{
+80106fe0:	53                   	push   %ebx
+  while(*s)
+80106fe1:	bb 63 00 00 00       	mov    $0x63,%ebx
+{
+80106fe6:	81 ec 5c 03 00 00    	sub    $0x35c,%esp
+80106fec:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80106fef:	90                   	nop
+    *p++ = *s++;
+80106ff0:	83 c0 01             	add    $0x1,%eax
+80106ff3:	88 1a                	mov    %bl,(%edx)
+80106ff5:	83 c2 01             	add    $0x1,%edx
+  while(*s)
+80106ff8:	0f b6 18             	movzbl (%eax),%ebx
+80106ffb:	84 db                	test   %bl,%bl
+80106ffd:	75 f1                	jne    80106ff0 <statsread+0x20>
+  char buf[(NCPU+1)*STATLINE], *p;
+  int c, i;
+
+  p = putstr(buf, "cpu");
+  for(i = 0; i < NSTAT; i++){
+80106fff:	31 f6                	xor    %esi,%esi
+80107001:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    *p++ = '\t';
+    p = putstr(p, statname[i]);
+80107008:	8b 1c b5 50 bb 10 80 	mov    -0x7fef44b0(,%esi,4),%ebx
+    *p++ = '\t';
+8010700f:	c6 02 09             	movb   $0x9,(%edx)
+80107012:	8d 42 01             	lea    0x1(%edx),%eax
+  while(*s)
+80107015:	0f b6 13             	movzbl (%ebx),%edx
+80107018:	84 d2                	test   %dl,%dl
+8010701a:	74 13                	je     8010702f <statsread+0x5f>
+8010701c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    *p++ = *s++;
+80107020:	83 c3 01             	add    $0x1,%ebx
+80107023:	88 10                	mov    %dl,(%eax)
+80107025:	83 c0 01             	add    $0x1,%eax
+  while(*s)
+80107028:	0f b6 13             	movzbl (%ebx),%edx
+8010702b:	84 d2                	test   %dl,%dl
+8010702d:	75 f1                	jne    80107020 <statsread+0x50>
+  for(i = 0; i < NSTAT; i++){
+8010702f:	83 c6 01             	add    $0x1,%esi
+80107032:	83 fe 07             	cmp    $0x7,%esi
+80107035:	74 04                	je     8010703b <statsread+0x6b>
+80107037:	89 c2                	mov    %eax,%edx
+80107039:	eb cd                	jmp    80107008 <statsread+0x38>
+  }
+  *p++ = '\n';
+8010703b:	c6 00 0a             	movb   $0xa,(%eax)
+8010703e:	8d 78 01             	lea    0x1(%eax),%edi
+  for(c = 0; c < ncpu; c++){
+80107041:	a1 84 e9 17 80       	mov    0x8017e984,%eax
+80107046:	89 85 a4 fc ff ff    	mov    %eax,-0x35c(%ebp)
+8010704c:	85 c0                	test   %eax,%eax
+8010704e:	0f 8e 5f 01 00 00    	jle    801071b3 <statsread+0x1e3>
+80107054:	c7 85 a8 fc ff ff 00 	movl   $0x0,-0x358(%ebp)
+8010705b:	00 00 00 
+    digits[i++] = '0' + x % 10;
+8010705e:	89 4d 10             	mov    %ecx,0x10(%ebp)
+80107061:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  i = 0;
+80107068:	89 bd b4 fc ff ff    	mov    %edi,-0x34c(%ebp)
+  for(c = 0; c < ncpu; c++){
+8010706e:	8b 8d a8 fc ff ff    	mov    -0x358(%ebp),%ecx
+  i = 0;
+80107074:	31 db                	xor    %ebx,%ebx
+80107076:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010707d:	8d 76 00             	lea    0x0(%esi),%esi
+    digits[i++] = '0' + x % 10;
+80107080:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+80107085:	89 de                	mov    %ebx,%esi
+80107087:	8d 5b 01             	lea    0x1(%ebx),%ebx
+8010708a:	f7 e1                	mul    %ecx
+8010708c:	89 c8                	mov    %ecx,%eax
+8010708e:	c1 ea 03             	shr    $0x3,%edx
+80107091:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+80107094:	01 ff                	add    %edi,%edi
+80107096:	29 f8                	sub    %edi,%eax
+80107098:	83 c0 30             	add    $0x30,%eax
+8010709b:	88 84 1d c5 fc ff ff 	mov    %al,-0x33b(%ebp,%ebx,1)
+  } while((x /= 10) != 0);
+801070a2:	89 c8                	mov    %ecx,%eax
+801070a4:	89 d1                	mov    %edx,%ecx
+801070a6:	83 f8 09             	cmp    $0x9,%eax
+801070a9:	77 d5                	ja     80107080 <statsread+0xb0>
+801070ab:	8b bd b4 fc ff ff    	mov    -0x34c(%ebp),%edi
+801070b1:	8d 85 c6 fc ff ff    	lea    -0x33a(%ebp),%eax
+801070b7:	01 f0                	add    %esi,%eax
+801070b9:	89 fa                	mov    %edi,%edx
+801070bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801070bf:	90                   	nop
+    *p++ = digits[i];
+801070c0:	0f b6 08             	movzbl (%eax),%ecx
+  while(--i >= 0)
+801070c3:	8d 9d c6 fc ff ff    	lea    -0x33a(%ebp),%ebx
+801070c9:	83 c2 01             	add    $0x1,%edx
+    *p++ = digits[i];
+801070cc:	88 4a ff             	mov    %cl,-0x1(%edx)
+  while(--i >= 0)
+801070cf:	89 c1                	mov    %eax,%ecx
+801070d1:	83 e8 01             	sub    $0x1,%eax
+801070d4:	39 cb                	cmp    %ecx,%ebx
+801070d6:	75 e8                	jne    801070c0 <statsread+0xf0>
+    *p++ = digits[i];
+801070d8:	8d 44 37 01          	lea    0x1(%edi,%esi,1),%eax
+    p = putuint(p, c);
+    for(i = 0; i < NSTAT; i++){
+801070dc:	8b b5 a8 fc ff ff    	mov    -0x358(%ebp),%esi
+801070e2:	31 ff                	xor    %edi,%edi
+801070e4:	c1 e6 08             	shl    $0x8,%esi
+801070e7:	89 b5 ac fc ff ff    	mov    %esi,-0x354(%ebp)
+801070ed:	8d 76 00             	lea    0x0(%esi),%esi
+      *p++ = '\t';
+801070f0:	8d 50 01             	lea    0x1(%eax),%edx
+801070f3:	c6 00 09             	movb   $0x9,(%eax)
+      p = putuint(p, cpus[c].stat[i]);
+801070f6:	8b 85 ac fc ff ff    	mov    -0x354(%ebp),%eax
+  i = 0;
+801070fc:	31 db                	xor    %ebx,%ebx
+801070fe:	89 95 b4 fc ff ff    	mov    %edx,-0x34c(%ebp)
+80107104:	89 bd b0 fc ff ff    	mov    %edi,-0x350(%ebp)
+      p = putuint(p, cpus[c].stat[i]);
+8010710a:	8b 8c b8 80 ea 17 80 	mov    -0x7fe81580(%eax,%edi,4),%ecx
+  i = 0;
+80107111:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    digits[i++] = '0' + x % 10;
+80107118:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+8010711d:	89 de                	mov    %ebx,%esi
+8010711f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+80107122:	f7 e1                	mul    %ecx
+80107124:	89 c8                	mov    %ecx,%eax
+80107126:	c1 ea 03             	shr    $0x3,%edx
+80107129:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+8010712c:	01 ff                	add    %edi,%edi
+8010712e:	29 f8                	sub    %edi,%eax
+80107130:	83 c0 30             	add    $0x30,%eax
+80107133:	88 84 1d c5 fc ff ff 	mov    %al,-0x33b(%ebp,%ebx,1)
+  } while((x /= 10) != 0);
+8010713a:	89 c8                	mov    %ecx,%eax
+8010713c:	89 d1                	mov    %edx,%ecx
+8010713e:	83 f8 09             	cmp    $0x9,%eax
+80107141:	77 d5                	ja     80107118 <statsread+0x148>
+80107143:	8b 95 b4 fc ff ff    	mov    -0x34c(%ebp),%edx
+80107149:	8d 85 c6 fc ff ff    	lea    -0x33a(%ebp),%eax
+8010714f:	8b bd b0 fc ff ff    	mov    -0x350(%ebp),%edi
+80107155:	01 f0                	add    %esi,%eax
+80107157:	89 d1                	mov    %edx,%ecx
+80107159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    *p++ = digits[i];
+80107160:	0f b6 18             	movzbl (%eax),%ebx
+  while(--i >= 0)
+80107163:	8d 95 c6 fc ff ff    	lea    -0x33a(%ebp),%edx
+80107169:	83 c1 01             	add    $0x1,%ecx
+    *p++ = digits[i];
+8010716c:	88 59 ff             	mov    %bl,-0x1(%ecx)
+  while(--i >= 0)
+8010716f:	89 c3                	mov    %eax,%ebx
+80107171:	83 e8 01             	sub    $0x1,%eax
+80107174:	39 da                	cmp    %ebx,%edx
+80107176:	75 e8                	jne    80107160 <statsread+0x190>
+    *p++ = digits[i];
+80107178:	8b 95 b4 fc ff ff    	mov    -0x34c(%ebp),%edx
+    for(i = 0; i < NSTAT; i++){
+8010717e:	83 c7 01             	add    $0x1,%edi
+    *p++ = digits[i];
+80107181:	8d 44 32 01          	lea    0x1(%edx,%esi,1),%eax
+    for(i = 0; i < NSTAT; i++){
+80107185:	83 ff 07             	cmp    $0x7,%edi
+80107188:	0f 85 62 ff ff ff    	jne    801070f0 <statsread+0x120>
+  for(c = 0; c < ncpu; c++){
+8010718e:	83 85 a8 fc ff ff 01 	addl   $0x1,-0x358(%ebp)
+    }
+    *p++ = '\n';
+80107195:	8d 7c 32 02          	lea    0x2(%edx,%esi,1),%edi
+  for(c = 0; c < ncpu; c++){
+80107199:	8b b5 a4 fc ff ff    	mov    -0x35c(%ebp),%esi
+    *p++ = '\n';
+8010719f:	c6 00 0a             	movb   $0xa,(%eax)
+  for(c = 0; c < ncpu; c++){
+801071a2:	8b 85 a8 fc ff ff    	mov    -0x358(%ebp),%eax
+801071a8:	39 f0                	cmp    %esi,%eax
+801071aa:	0f 85 b8 fe ff ff    	jne    80107068 <statsread+0x98>
+801071b0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  }
+
+  if(off >= p - buf)
+801071b3:	89 f8                	mov    %edi,%eax
+801071b5:	8d b5 d0 fc ff ff    	lea    -0x330(%ebp),%esi
+    return 0;
+801071bb:	31 db                	xor    %ebx,%ebx
+  if(off >= p - buf)
+801071bd:	29 f0                	sub    %esi,%eax
+801071bf:	39 c1                	cmp    %eax,%ecx
+801071c1:	73 23                	jae    801071e6 <statsread+0x216>
+  if(n > p - buf - off)
+801071c3:	8b 55 14             	mov    0x14(%ebp),%edx
+801071c6:	29 c8                	sub    %ecx,%eax
+801071c8:	89 d3                	mov    %edx,%ebx
+801071ca:	39 d0                	cmp    %edx,%eax
+801071cc:	72 22                	jb     801071f0 <statsread+0x220>
+    n = p - buf - off;
+  memmove(dst, buf + off, n);
+801071ce:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+801071d4:	83 ec 04             	sub    $0x4,%esp
+801071d7:	01 c8                	add    %ecx,%eax
+801071d9:	52                   	push   %edx
+801071da:	50                   	push   %eax
+801071db:	ff 75 0c             	push   0xc(%ebp)
+801071de:	e8 ed 00 00 00       	call   801072d0 <memmove>
+  return n;
+801071e3:	83 c4 10             	add    $0x10,%esp
+}
+801071e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801071e9:	89 d8                	mov    %ebx,%eax
+801071eb:	5b                   	pop    %ebx
+801071ec:	5e                   	pop    %esi
+801071ed:	5f                   	pop    %edi
+801071ee:	5d                   	pop    %ebp
+801071ef:	c3                   	ret
+    n = p - buf - off;
+801071f0:	89 c3                	mov    %eax,%ebx
+801071f2:	89 c2                	mov    %eax,%edx
+801071f4:	eb d8                	jmp    801071ce <statsread+0x1fe>
+801071f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801071fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107200 <statinc>:
+{
+80107200:	55                   	push   %ebp
+80107201:	89 e5                	mov    %esp,%ebp
+80107203:	53                   	push   %ebx
+80107204:	83 ec 04             	sub    $0x4,%esp
+80107207:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+8010720a:	e8 f1 fc ff ff       	call   80106f00 <pushcli>
+  cpu->stat[i]++;
+8010720f:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+80107215:	83 84 98 c0 00 00 00 	addl   $0x1,0xc0(%eax,%ebx,4)
+8010721c:	01 
+}
+8010721d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107220:	c9                   	leave
+  popcli();
+80107221:	e9 0a fd ff ff       	jmp    80106f30 <popcli>
+80107226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010722d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107230 <statsinit>:
+
+void
+statsinit(void)
+{
+  devsw[STATS].read = statsread;
+80107230:	c7 05 90 aa 15 80 d0 	movl   $0x80106fd0,0x8015aa90
+80107237:	6f 10 80 
+}
+8010723a:	c3                   	ret
+8010723b:	66 90                	xchg   %ax,%ax
+8010723d:	66 90                	xchg   %ax,%ax
+8010723f:	90                   	nop
+
+80107240 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80107240:	55                   	push   %ebp
+80107241:	89 e5                	mov    %esp,%ebp
+80107243:	57                   	push   %edi
+80107244:	8b 55 08             	mov    0x8(%ebp),%edx
+80107247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+8010724a:	89 d0                	mov    %edx,%eax
+8010724c:	09 c8                	or     %ecx,%eax
+8010724e:	a8 03                	test   $0x3,%al
+80107250:	75 1e                	jne    80107270 <memset+0x30>
+    c &= 0xFF;
+80107252:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+80107256:	c1 e9 02             	shr    $0x2,%ecx
+  asm volatile("cld; rep stosl" :
+80107259:	89 d7                	mov    %edx,%edi
+8010725b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+80107261:	fc                   	cld
+80107262:	f3 ab                	rep stos %eax,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+80107264:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80107267:	89 d0                	mov    %edx,%eax
+80107269:	c9                   	leave
+8010726a:	c3                   	ret
+8010726b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010726f:	90                   	nop
+  asm volatile("cld; rep stosb" :
+80107270:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107273:	89 d7                	mov    %edx,%edi
+80107275:	fc                   	cld
+80107276:	f3 aa                	rep stos %al,%es:(%edi)
+80107278:	8b 7d fc             	mov    -0x4(%ebp),%edi
+8010727b:	89 d0                	mov    %edx,%eax
+8010727d:	c9                   	leave
+8010727e:	c3                   	ret
+8010727f:	90                   	nop
+
+80107280 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80107280:	55                   	push   %ebp
+80107281:	89 e5                	mov    %esp,%ebp
+80107283:	56                   	push   %esi
+80107284:	53                   	push   %ebx
+80107285:	8b 75 10             	mov    0x10(%ebp),%esi
+80107288:	8b 55 08             	mov    0x8(%ebp),%edx
+8010728b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+8010728e:	85 f6                	test   %esi,%esi
+80107290:	74 2e                	je     801072c0 <memcmp+0x40>
+80107292:	01 c6                	add    %eax,%esi
+80107294:	eb 14                	jmp    801072aa <memcmp+0x2a>
+80107296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010729d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+801072a0:	83 c0 01             	add    $0x1,%eax
+801072a3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+801072a6:	39 f0                	cmp    %esi,%eax
+801072a8:	74 16                	je     801072c0 <memcmp+0x40>
+    if(*s1 != *s2)
+801072aa:	0f b6 0a             	movzbl (%edx),%ecx
+801072ad:	0f b6 18             	movzbl (%eax),%ebx
+801072b0:	38 d9                	cmp    %bl,%cl
+801072b2:	74 ec                	je     801072a0 <memcmp+0x20>
+      return *s1 - *s2;
+801072b4:	0f b6 c1             	movzbl %cl,%eax
+801072b7:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+801072b9:	5b                   	pop    %ebx
+801072ba:	5e                   	pop    %esi
+801072bb:	5d                   	pop    %ebp
+801072bc:	c3                   	ret
+801072bd:	8d 76 00             	lea    0x0(%esi),%esi
+801072c0:	5b                   	pop    %ebx
+  return 0;
+801072c1:	31 c0                	xor    %eax,%eax
+}
+801072c3:	5e                   	pop    %esi
+801072c4:	5d                   	pop    %ebp
+801072c5:	c3                   	ret
+801072c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801072cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801072d0 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+801072d0:	55                   	push   %ebp
+801072d1:	89 e5                	mov    %esp,%ebp
+801072d3:	57                   	push   %edi
+801072d4:	56                   	push   %esi
+801072d5:	8b 55 08             	mov    0x8(%ebp),%edx
+801072d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+801072db:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+801072de:	39 d6                	cmp    %edx,%esi
+801072e0:	73 26                	jae    80107308 <memmove+0x38>
+801072e2:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+801072e5:	39 ca                	cmp    %ecx,%edx
+801072e7:	73 1f                	jae    80107308 <memmove+0x38>
+    s += n;
+    d += n;
+    while(n-- > 0)
+801072e9:	85 c0                	test   %eax,%eax
+801072eb:	74 0f                	je     801072fc <memmove+0x2c>
+801072ed:	83 e8 01             	sub    $0x1,%eax
+      *--d = *--s;
+801072f0:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+801072f4:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    while(n-- > 0)
+801072f7:	83 e8 01             	sub    $0x1,%eax
+801072fa:	73 f4                	jae    801072f0 <memmove+0x20>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+
+  return dst;
+}
+801072fc:	5e                   	pop    %esi
+801072fd:	89 d0                	mov    %edx,%eax
+801072ff:	5f                   	pop    %edi
+80107300:	5d                   	pop    %ebp
+80107301:	c3                   	ret
+80107302:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    while(n-- > 0)
+80107308:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+8010730b:	89 d7                	mov    %edx,%edi
+8010730d:	85 c0                	test   %eax,%eax
+8010730f:	74 eb                	je     801072fc <memmove+0x2c>
+80107311:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      *d++ = *s++;
+80107318:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    while(n-- > 0)
+80107319:	39 ce                	cmp    %ecx,%esi
+8010731b:	75 fb                	jne    80107318 <memmove+0x48>
+}
+8010731d:	5e                   	pop    %esi
+8010731e:	89 d0                	mov    %edx,%eax
+80107320:	5f                   	pop    %edi
+80107321:	5d                   	pop    %ebp
+80107322:	c3                   	ret
+80107323:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010732a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107330 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+  return memmove(dst, src, n);
+80107330:	eb 9e                	jmp    801072d0 <memmove>
+80107332:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107340 <strncmp>:
+}
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80107340:	55                   	push   %ebp
+80107341:	89 e5                	mov    %esp,%ebp
+80107343:	53                   	push   %ebx
+80107344:	8b 55 10             	mov    0x10(%ebp),%edx
+80107347:	8b 45 08             	mov    0x8(%ebp),%eax
+8010734a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+8010734d:	85 d2                	test   %edx,%edx
+8010734f:	75 16                	jne    80107367 <strncmp+0x27>
+80107351:	eb 2d                	jmp    80107380 <strncmp+0x40>
+80107353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107357:	90                   	nop
+80107358:	3a 19                	cmp    (%ecx),%bl
+8010735a:	75 12                	jne    8010736e <strncmp+0x2e>
+    n--, p++, q++;
+8010735c:	83 c0 01             	add    $0x1,%eax
+8010735f:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+80107362:	83 ea 01             	sub    $0x1,%edx
+80107365:	74 19                	je     80107380 <strncmp+0x40>
+80107367:	0f b6 18             	movzbl (%eax),%ebx
+8010736a:	84 db                	test   %bl,%bl
+8010736c:	75 ea                	jne    80107358 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+8010736e:	0f b6 00             	movzbl (%eax),%eax
+80107371:	0f b6 11             	movzbl (%ecx),%edx
+}
+80107374:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107377:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+80107378:	29 d0                	sub    %edx,%eax
+}
+8010737a:	c3                   	ret
+8010737b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010737f:	90                   	nop
+80107380:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80107383:	31 c0                	xor    %eax,%eax
+}
+80107385:	c9                   	leave
+80107386:	c3                   	ret
+80107387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010738e:	66 90                	xchg   %ax,%ax
+
+80107390 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80107390:	55                   	push   %ebp
+80107391:	89 e5                	mov    %esp,%ebp
+80107393:	57                   	push   %edi
+80107394:	56                   	push   %esi
+80107395:	53                   	push   %ebx
+80107396:	8b 75 08             	mov    0x8(%ebp),%esi
+80107399:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+8010739c:	89 f0                	mov    %esi,%eax
+8010739e:	eb 15                	jmp    801073b5 <strncpy+0x25>
+801073a0:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+801073a4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801073a7:	83 c0 01             	add    $0x1,%eax
+801073aa:	0f b6 4f ff          	movzbl -0x1(%edi),%ecx
+801073ae:	88 48 ff             	mov    %cl,-0x1(%eax)
+801073b1:	84 c9                	test   %cl,%cl
+801073b3:	74 13                	je     801073c8 <strncpy+0x38>
+801073b5:	89 d3                	mov    %edx,%ebx
+801073b7:	83 ea 01             	sub    $0x1,%edx
+801073ba:	85 db                	test   %ebx,%ebx
+801073bc:	7f e2                	jg     801073a0 <strncpy+0x10>
+    ;
+  while(n-- > 0)
+    *s++ = 0;
+  return os;
+}
+801073be:	5b                   	pop    %ebx
+801073bf:	89 f0                	mov    %esi,%eax
+801073c1:	5e                   	pop    %esi
+801073c2:	5f                   	pop    %edi
+801073c3:	5d                   	pop    %ebp
+801073c4:	c3                   	ret
+801073c5:	8d 76 00             	lea    0x0(%esi),%esi
+  while(n-- > 0)
+801073c8:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+801073cb:	83 e9 01             	sub    $0x1,%ecx
+801073ce:	85 d2                	test   %edx,%edx
+801073d0:	74 ec                	je     801073be <strncpy+0x2e>
+801073d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *s++ = 0;
+801073d8:	83 c0 01             	add    $0x1,%eax
+801073db:	89 ca                	mov    %ecx,%edx
+801073dd:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+  while(n-- > 0)
+801073e1:	29 c2                	sub    %eax,%edx
+801073e3:	85 d2                	test   %edx,%edx
+801073e5:	7f f1                	jg     801073d8 <strncpy+0x48>
+}
+801073e7:	5b                   	pop    %ebx
+801073e8:	89 f0                	mov    %esi,%eax
+801073ea:	5e                   	pop    %esi
+801073eb:	5f                   	pop    %edi
+801073ec:	5d                   	pop    %ebp
+801073ed:	c3                   	ret
+801073ee:	66 90                	xchg   %ax,%ax
+
+801073f0 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+801073f0:	55                   	push   %ebp
+801073f1:	89 e5                	mov    %esp,%ebp
+801073f3:	56                   	push   %esi
+801073f4:	53                   	push   %ebx
+801073f5:	8b 55 10             	mov    0x10(%ebp),%edx
+801073f8:	8b 75 08             	mov    0x8(%ebp),%esi
+801073fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+801073fe:	85 d2                	test   %edx,%edx
+80107400:	7e 25                	jle    80107427 <safestrcpy+0x37>
+80107402:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+80107406:	89 f2                	mov    %esi,%edx
+80107408:	eb 16                	jmp    80107420 <safestrcpy+0x30>
+8010740a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80107410:	0f b6 08             	movzbl (%eax),%ecx
+80107413:	83 c0 01             	add    $0x1,%eax
+80107416:	83 c2 01             	add    $0x1,%edx
+80107419:	88 4a ff             	mov    %cl,-0x1(%edx)
+8010741c:	84 c9                	test   %cl,%cl
+8010741e:	74 04                	je     80107424 <safestrcpy+0x34>
+80107420:	39 d8                	cmp    %ebx,%eax
+80107422:	75 ec                	jne    80107410 <safestrcpy+0x20>
+    ;
+  *s = 0;
+80107424:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80107427:	89 f0                	mov    %esi,%eax
+80107429:	5b                   	pop    %ebx
+8010742a:	5e                   	pop    %esi
+8010742b:	5d                   	pop    %ebp
+8010742c:	c3                   	ret
+8010742d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107430 <strlen>:
+
+int
+strlen(const char *s)
+{
+80107430:	55                   	push   %ebp
+  int n;
+
+  for(n = 0; s[n]; n++)
+80107431:	31 c0                	xor    %eax,%eax
+{
+80107433:	89 e5                	mov    %esp,%ebp
+80107435:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+80107438:	80 3a 00             	cmpb   $0x0,(%edx)
+8010743b:	74 0c                	je     80107449 <strlen+0x19>
+8010743d:	8d 76 00             	lea    0x0(%esi),%esi
+80107440:	83 c0 01             	add    $0x1,%eax
+80107443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+80107447:	75 f7                	jne    80107440 <strlen+0x10>
+    ;
+  return n;
+}
+80107449:	5d                   	pop    %ebp
+8010744a:	c3                   	ret
+8010744b:	66 90                	xchg   %ax,%ax
+8010744d:	66 90                	xchg   %ax,%ax
+8010744f:	90                   	nop
+
+80107450 <swaprw>:
+
+// Read or write the page in slot straight from or to page,
+// all its blocks in one go.
+static void
+swaprw(int slot, char *page, int write)
+{
+80107450:	55                   	push   %ebp
+80107451:	89 e5                	mov    %esp,%ebp
+80107453:	57                   	push   %edi
+80107454:	89 c7                	mov    %eax,%edi
+80107456:	56                   	push   %esi
+80107457:	89 ce                	mov    %ecx,%esi
+80107459:	53                   	push   %ebx
+8010745a:	69 d9 80 03 00 00    	imul   $0x380,%ecx,%ebx
+80107460:	83 ec 48             	sub    $0x48,%esp
+  struct swapio *io;
+  struct buf *bv[PGSIZE/BSIZE];
+  int i;
+
+  io = &swapio[write != 0];
+  acquiresleep(&io->lock);
+80107463:	8d 83 80 75 18 80    	lea    -0x7fe78a80(%ebx),%eax
+{
+80107469:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  acquiresleep(&io->lock);
+8010746c:	89 45 b8             	mov    %eax,-0x48(%ebp)
+8010746f:	50                   	push   %eax
+80107470:	e8 fb f7 ff ff       	call   80106c70 <acquiresleep>
+  for(i = 0; i < PGSIZE/BSIZE; i++){
+    bv[i] = &io->b[i];
+    bv[i]->dev = swap.dev;
+    bv[i]->blockno = swap.start + slot*(PGSIZE/BSIZE) + i;
+80107475:	8d 04 fd 00 00 00 00 	lea    0x0(,%edi,8),%eax
+8010747c:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+8010747f:	83 c4 10             	add    $0x10,%esp
+80107482:	8d bb c0 75 18 80    	lea    -0x7fe78a40(%ebx),%edi
+80107488:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    bv[i]->data = (uchar*)page + i*BSIZE;
+    bv[i]->flags = write ? B_DIRTY : 0;
+8010748b:	8d 04 b5 00 00 00 00 	lea    0x0(,%esi,4),%eax
+  for(i = 0; i < PGSIZE/BSIZE; i++){
+80107492:	31 f6                	xor    %esi,%esi
+    bv[i]->flags = write ? B_DIRTY : 0;
+80107494:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80107497:	89 fb                	mov    %edi,%ebx
+80107499:	89 f8                	mov    %edi,%eax
+8010749b:	89 cf                	mov    %ecx,%edi
+8010749d:	8d 76 00             	lea    0x0(%esi),%esi
+    bv[i]->dev = swap.dev;
+801074a0:	8b 15 54 69 18 80    	mov    0x80186954,%edx
+    bv[i]->flags = write ? B_DIRTY : 0;
+801074a6:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+    bv[i]->qnext = 0;
+    acquiresleep(&bv[i]->lock);
+801074a9:	83 ec 0c             	sub    $0xc,%esp
+    bv[i]->data = (uchar*)page + i*BSIZE;
+801074ac:	89 7b 64             	mov    %edi,0x64(%ebx)
+    bv[i] = &io->b[i];
+801074af:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  for(i = 0; i < PGSIZE/BSIZE; i++){
+801074b3:	83 c3 68             	add    $0x68,%ebx
+801074b6:	81 c7 00 02 00 00    	add    $0x200,%edi
+    bv[i]->dev = swap.dev;
+801074bc:	89 53 9c             	mov    %edx,-0x64(%ebx)
+    bv[i]->blockno = swap.start + slot*(PGSIZE/BSIZE) + i;
+801074bf:	8b 55 c0             	mov    -0x40(%ebp),%edx
+801074c2:	03 15 58 69 18 80    	add    0x80186958,%edx
+    acquiresleep(&bv[i]->lock);
+801074c8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    bv[i]->blockno = swap.start + slot*(PGSIZE/BSIZE) + i;
+801074cb:	01 f2                	add    %esi,%edx
+    bv[i]->flags = write ? B_DIRTY : 0;
+801074cd:	89 4b 98             	mov    %ecx,-0x68(%ebx)
+  for(i = 0; i < PGSIZE/BSIZE; i++){
+801074d0:	83 c6 01             	add    $0x1,%esi
+    bv[i]->blockno = swap.start + slot*(PGSIZE/BSIZE) + i;
+801074d3:	89 53 a0             	mov    %edx,-0x60(%ebx)
+    acquiresleep(&bv[i]->lock);
+801074d6:	8d 50 0c             	lea    0xc(%eax),%edx
+    bv[i]->qnext = 0;
+801074d9:	c7 43 f4 00 00 00 00 	movl   $0x0,-0xc(%ebx)
+    acquiresleep(&bv[i]->lock);
+801074e0:	52                   	push   %edx
+801074e1:	e8 8a f7 ff ff       	call   80106c70 <acquiresleep>
+  for(i = 0; i < PGSIZE/BSIZE; i++){
+801074e6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+801074e9:	83 c4 10             	add    $0x10,%esp
+801074ec:	83 c0 68             	add    $0x68,%eax
+801074ef:	83 fe 08             	cmp    $0x8,%esi
+801074f2:	75 ac                	jne    801074a0 <swaprw+0x50>
+  }
+  iderwv(bv, PGSIZE/BSIZE);
+801074f4:	83 ec 08             	sub    $0x8,%esp
+801074f7:	8d 45 c8             	lea    -0x38(%ebp),%eax
+801074fa:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+801074fd:	6a 08                	push   $0x8
+801074ff:	8d 75 e8             	lea    -0x18(%ebp),%esi
+80107502:	50                   	push   %eax
+80107503:	e8 d8 bd ff ff       	call   801032e0 <iderwv>
+  for(i = 0; i < PGSIZE/BSIZE; i++)
+80107508:	83 c4 10             	add    $0x10,%esp
+8010750b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010750f:	90                   	nop
+    releasesleep(&bv[i]->lock);
+80107510:	8b 03                	mov    (%ebx),%eax
+80107512:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < PGSIZE/BSIZE; i++)
+80107515:	83 c3 04             	add    $0x4,%ebx
+    releasesleep(&bv[i]->lock);
+80107518:	83 c0 0c             	add    $0xc,%eax
+8010751b:	50                   	push   %eax
+8010751c:	e8 af f7 ff ff       	call   80106cd0 <releasesleep>
+  for(i = 0; i < PGSIZE/BSIZE; i++)
+80107521:	83 c4 10             	add    $0x10,%esp
+80107524:	39 de                	cmp    %ebx,%esi
+80107526:	75 e8                	jne    80107510 <swaprw+0xc0>
+  releasesleep(&io->lock);
+80107528:	83 ec 0c             	sub    $0xc,%esp
+8010752b:	ff 75 b8             	push   -0x48(%ebp)
+8010752e:	e8 9d f7 ff ff       	call   80106cd0 <releasesleep>
+}
+80107533:	83 c4 10             	add    $0x10,%esp
+80107536:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107539:	5b                   	pop    %ebx
+8010753a:	5e                   	pop    %esi
+8010753b:	5f                   	pop    %edi
+8010753c:	5d                   	pop    %ebp
+8010753d:	c3                   	ret
+8010753e:	66 90                	xchg   %ax,%ax
+
+80107540 <kswapd>:
+  return nv;
+}
+
+static void
+kswapd(void)
+{
+80107540:	55                   	push   %ebp
+80107541:	89 e5                	mov    %esp,%ebp
+80107543:	57                   	push   %edi
+80107544:	56                   	push   %esi
+80107545:	53                   	push   %ebx
+80107546:	81 ec 1c 01 00 00    	sub    $0x11c,%esp
+8010754c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  int n;
+
+  for(;;){
+    acquire(&swap.lock);
+80107550:	83 ec 0c             	sub    $0xc,%esp
+80107553:	68 20 69 18 80       	push   $0x80186920
+80107558:	e8 03 f8 ff ff       	call   80106d60 <acquire>
+    while(!swap.wanted)
+8010755d:	8b 1d 64 75 18 80    	mov    0x80187564,%ebx
+80107563:	83 c4 10             	add    $0x10,%esp
+80107566:	85 db                	test   %ebx,%ebx
+80107568:	0f 84 02 02 00 00    	je     80107770 <kswapd+0x230>
+      sleep(&swap.wanted, &swap.lock);
+    swap.wanted = 0;
+    release(&swap.lock);
+8010756e:	83 ec 0c             	sub    $0xc,%esp
+  for(visits = 0; nv < n && visits <= 2*NPROC; visits++){
+80107571:	31 db                	xor    %ebx,%ebx
+  nv = 0;
+80107573:	31 f6                	xor    %esi,%esi
+    swap.wanted = 0;
+80107575:	c7 05 64 75 18 80 00 	movl   $0x0,0x80187564
+8010757c:	00 00 00 
+    release(&swap.lock);
+8010757f:	68 20 69 18 80       	push   $0x80186920
+80107584:	e8 f7 f9 ff ff       	call   80106f80 <release>
+80107589:	83 c4 10             	add    $0x10,%esp
+8010758c:	eb 51                	jmp    801075df <kswapd+0x9f>
+8010758e:	66 90                	xchg   %ax,%ax
+    release(&p->lock);
+80107590:	83 ec 0c             	sub    $0xc,%esp
+80107593:	57                   	push   %edi
+80107594:	e8 e7 f9 ff ff       	call   80106f80 <release>
+  for(visits = 0; nv < n && visits <= 2*NPROC; visits++){
+80107599:	83 c4 10             	add    $0x10,%esp
+8010759c:	83 fe 1f             	cmp    $0x1f,%esi
+8010759f:	0f 9e c2             	setle  %dl
+      swap.hand = (swap.hand + 1) % NPROC;
+801075a2:	a1 70 75 18 80       	mov    0x80187570,%eax
+  for(visits = 0; nv < n && visits <= 2*NPROC; visits++){
+801075a7:	83 c3 01             	add    $0x1,%ebx
+      swap.handva = 0;
+801075aa:	c7 05 74 75 18 80 00 	movl   $0x0,0x80187574
+801075b1:	00 00 00 
+      swap.hand = (swap.hand + 1) % NPROC;
+801075b4:	83 c0 01             	add    $0x1,%eax
+801075b7:	89 c1                	mov    %eax,%ecx
+801075b9:	c1 f9 1f             	sar    $0x1f,%ecx
+801075bc:	c1 e9 1a             	shr    $0x1a,%ecx
+801075bf:	01 c8                	add    %ecx,%eax
+801075c1:	83 e0 3f             	and    $0x3f,%eax
+801075c4:	29 c8                	sub    %ecx,%eax
+801075c6:	a3 70 75 18 80       	mov    %eax,0x80187570
+  for(visits = 0; nv < n && visits <= 2*NPROC; visits++){
+801075cb:	81 fb 80 00 00 00    	cmp    $0x80,%ebx
+801075d1:	0f 8f d9 00 00 00    	jg     801076b0 <kswapd+0x170>
+801075d7:	84 d2                	test   %dl,%dl
+801075d9:	0f 84 d1 00 00 00    	je     801076b0 <kswapd+0x170>
+    p = procslot(swap.hand);
+801075df:	83 ec 0c             	sub    $0xc,%esp
+801075e2:	ff 35 70 75 18 80    	push   0x80187570
+801075e8:	e8 d3 f0 ff ff       	call   801066c0 <procslot>
+801075ed:	89 c7                	mov    %eax,%edi
+    acquire(&p->lock);
+801075ef:	89 04 24             	mov    %eax,(%esp)
+801075f2:	e8 69 f7 ff ff       	call   80106d60 <acquire>
+    if((p->state == RUNNABLE || p->state == SLEEPING) && p->swappable){
+801075f7:	8b 47 40             	mov    0x40(%edi),%eax
+801075fa:	83 c4 10             	add    $0x10,%esp
+801075fd:	83 e8 02             	sub    $0x2,%eax
+80107600:	83 f8 01             	cmp    $0x1,%eax
+80107603:	77 8b                	ja     80107590 <kswapd+0x50>
+80107605:	8b 97 0c 01 00 00    	mov    0x10c(%edi),%edx
+8010760b:	85 d2                	test   %edx,%edx
+8010760d:	74 81                	je     80107590 <kswapd+0x50>
+      nv += uvmswapout(p->pgdir, p->sz, &swap.handva,
+8010760f:	b9 20 00 00 00       	mov    $0x20,%ecx
+80107614:	83 ec 08             	sub    $0x8,%esp
+                       page + nv, slot + nv, n - nv);
+80107617:	8d 04 b5 00 00 00 00 	lea    0x0(,%esi,4),%eax
+      nv += uvmswapout(p->pgdir, p->sz, &swap.handva,
+8010761e:	29 f1                	sub    %esi,%ecx
+80107620:	8d 95 68 ff ff ff    	lea    -0x98(%ebp),%edx
+80107626:	51                   	push   %ecx
+80107627:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+8010762a:	8d 95 e8 fe ff ff    	lea    -0x118(%ebp),%edx
+80107630:	01 d0                	add    %edx,%eax
+80107632:	51                   	push   %ecx
+80107633:	50                   	push   %eax
+80107634:	68 74 75 18 80       	push   $0x80187574
+80107639:	ff 77 34             	push   0x34(%edi)
+8010763c:	ff 77 38             	push   0x38(%edi)
+8010763f:	e8 5c 3b 00 00       	call   8010b1a0 <uvmswapout>
+      more = swap.handva < p->sz;
+80107644:	8b 0d 74 75 18 80    	mov    0x80187574,%ecx
+8010764a:	83 c4 14             	add    $0x14,%esp
+      p->tlbcpu = -1;  // a CPU's TLB may still hold the old PTEs
+8010764d:	c7 87 10 01 00 00 ff 	movl   $0xffffffff,0x110(%edi)
+80107654:	ff ff ff 
+      nv += uvmswapout(p->pgdir, p->sz, &swap.handva,
+80107657:	01 c6                	add    %eax,%esi
+      more = swap.handva < p->sz;
+80107659:	8b 47 34             	mov    0x34(%edi),%eax
+8010765c:	89 8d e0 fe ff ff    	mov    %ecx,-0x120(%ebp)
+80107662:	39 c1                	cmp    %eax,%ecx
+80107664:	89 85 dc fe ff ff    	mov    %eax,-0x124(%ebp)
+8010766a:	0f 92 85 e4 fe ff ff 	setb   -0x11c(%ebp)
+    release(&p->lock);
+80107671:	57                   	push   %edi
+80107672:	e8 09 f9 ff ff       	call   80106f80 <release>
+    if(more && nv < n)
+80107677:	83 c4 10             	add    $0x10,%esp
+8010767a:	83 fe 1f             	cmp    $0x1f,%esi
+8010767d:	8b 8d e0 fe ff ff    	mov    -0x120(%ebp),%ecx
+80107683:	0f 9e c2             	setle  %dl
+80107686:	80 bd e4 fe ff ff 00 	cmpb   $0x0,-0x11c(%ebp)
+8010768d:	8b 85 dc fe ff ff    	mov    -0x124(%ebp),%eax
+80107693:	74 04                	je     80107699 <kswapd+0x159>
+80107695:	84 d2                	test   %dl,%dl
+80107697:	75 17                	jne    801076b0 <kswapd+0x170>
+    if(!more){
+80107699:	39 c1                	cmp    %eax,%ecx
+8010769b:	0f 83 01 ff ff ff    	jae    801075a2 <kswapd+0x62>
+  for(visits = 0; nv < n && visits <= 2*NPROC; visits++){
+801076a1:	83 c3 01             	add    $0x1,%ebx
+801076a4:	81 fb 80 00 00 00    	cmp    $0x80,%ebx
+801076aa:	0f 8e 27 ff ff ff    	jle    801075d7 <kswapd+0x97>
+  for(i = 0; i < nv; i++){
+801076b0:	31 db                	xor    %ebx,%ebx
+801076b2:	85 f6                	test   %esi,%esi
+801076b4:	7e 7a                	jle    80107730 <kswapd+0x1f0>
+801076b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801076bd:	8d 76 00             	lea    0x0(%esi),%esi
+    swaprw(slot[i], page[i], 1);
+801076c0:	8b 94 9d e8 fe ff ff 	mov    -0x118(%ebp,%ebx,4),%edx
+801076c7:	8b 84 9d 68 ff ff ff 	mov    -0x98(%ebp,%ebx,4),%eax
+801076ce:	b9 01 00 00 00       	mov    $0x1,%ecx
+801076d3:	e8 78 fd ff ff       	call   80107450 <swaprw>
+    acquire(&swap.lock);
+801076d8:	83 ec 0c             	sub    $0xc,%esp
+801076db:	68 20 69 18 80       	push   $0x80186920
+801076e0:	e8 7b f6 ff ff       	call   80106d60 <acquire>
+    swap.busy[slot[i]] = 0;
+801076e5:	8b 84 9d 68 ff ff ff 	mov    -0x98(%ebp,%ebx,4),%eax
+    release(&swap.lock);
+801076ec:	c7 04 24 20 69 18 80 	movl   $0x80186920,(%esp)
+    swap.busy[slot[i]] = 0;
+801076f3:	c6 80 60 71 18 80 00 	movb   $0x0,-0x7fe78ea0(%eax)
+    release(&swap.lock);
+801076fa:	e8 81 f8 ff ff       	call   80106f80 <release>
+    wakeup(&swap.busy[slot[i]]);
+801076ff:	8b 84 9d 68 ff ff ff 	mov    -0x98(%ebp,%ebx,4),%eax
+80107706:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+8010770c:	05 60 71 18 80       	add    $0x80187160,%eax
+80107711:	89 04 24             	mov    %eax,(%esp)
+80107714:	e8 c7 ef ff ff       	call   801066e0 <wakeup>
+    kfree(page[i]);
+80107719:	58                   	pop    %eax
+8010771a:	ff b4 9d e8 fe ff ff 	push   -0x118(%ebp,%ebx,4)
+  for(i = 0; i < nv; i++){
+80107721:	83 c3 01             	add    $0x1,%ebx
+    kfree(page[i]);
+80107724:	e8 87 be ff ff       	call   801035b0 <kfree>
+  for(i = 0; i < nv; i++){
+80107729:	83 c4 10             	add    $0x10,%esp
+8010772c:	39 f3                	cmp    %esi,%ebx
+8010772e:	75 90                	jne    801076c0 <kswapd+0x180>
+
+    n = swapout(SWAPBATCH);
+
+    acquire(&swap.lock);
+80107730:	83 ec 0c             	sub    $0xc,%esp
+80107733:	68 20 69 18 80       	push   $0x80186920
+80107738:	e8 23 f6 ff ff       	call   80106d60 <acquire>
+    swap.freed = n;
+    swap.passes++;
+    release(&swap.lock);
+8010773d:	c7 04 24 20 69 18 80 	movl   $0x80186920,(%esp)
+    swap.passes++;
+80107744:	83 05 68 75 18 80 01 	addl   $0x1,0x80187568
+    swap.freed = n;
+8010774b:	89 35 6c 75 18 80    	mov    %esi,0x8018756c
+    release(&swap.lock);
+80107751:	e8 2a f8 ff ff       	call   80106f80 <release>
+    wakeup(&swap.passes);
+80107756:	c7 04 24 68 75 18 80 	movl   $0x80187568,(%esp)
+8010775d:	e8 7e ef ff ff       	call   801066e0 <wakeup>
+    acquire(&swap.lock);
+80107762:	83 c4 10             	add    $0x10,%esp
+80107765:	e9 e6 fd ff ff       	jmp    80107550 <kswapd+0x10>
+8010776a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      sleep(&swap.wanted, &swap.lock);
+80107770:	83 ec 08             	sub    $0x8,%esp
+80107773:	68 20 69 18 80       	push   $0x80186920
+80107778:	68 64 75 18 80       	push   $0x80187564
+8010777d:	e8 8e ed ff ff       	call   80106510 <sleep>
+    while(!swap.wanted)
+80107782:	8b 0d 64 75 18 80    	mov    0x80187564,%ecx
+80107788:	83 c4 10             	add    $0x10,%esp
+8010778b:	85 c9                	test   %ecx,%ecx
+8010778d:	74 e1                	je     80107770 <kswapd+0x230>
+8010778f:	e9 da fd ff ff       	jmp    8010756e <kswapd+0x2e>
+80107794:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010779b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010779f:	90                   	nop
+
+801077a0 <swapinit>:
+{
+801077a0:	55                   	push   %ebp
+801077a1:	89 e5                	mov    %esp,%ebp
+801077a3:	57                   	push   %edi
+801077a4:	56                   	push   %esi
+801077a5:	53                   	push   %ebx
+801077a6:	bb cc 75 18 80       	mov    $0x801875cc,%ebx
+801077ab:	83 ec 44             	sub    $0x44,%esp
+801077ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  initlock(&swap.lock, "swap");
+801077b1:	68 6c bb 10 80       	push   $0x8010bb6c
+801077b6:	68 20 69 18 80       	push   $0x80186920
+801077bb:	e8 80 f5 ff ff       	call   80106d40 <initlock>
+    initsleeplock(&swapio[i].lock, "swapio");
+801077c0:	58                   	pop    %eax
+801077c1:	5a                   	pop    %edx
+801077c2:	68 71 bb 10 80       	push   $0x8010bb71
+801077c7:	68 80 75 18 80       	push   $0x80187580
+801077cc:	e8 5f f4 ff ff       	call   80106c30 <initsleeplock>
+    for(j = 0; j < PGSIZE/BSIZE; j++)
+801077d1:	83 c4 10             	add    $0x10,%esp
+801077d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      initsleeplock(&swapio[i].b[j].lock, "swapbuf");
+801077d8:	83 ec 08             	sub    $0x8,%esp
+801077db:	68 78 bb 10 80       	push   $0x8010bb78
+801077e0:	53                   	push   %ebx
+    for(j = 0; j < PGSIZE/BSIZE; j++)
+801077e1:	83 c3 68             	add    $0x68,%ebx
+      initsleeplock(&swapio[i].b[j].lock, "swapbuf");
+801077e4:	e8 47 f4 ff ff       	call   80106c30 <initsleeplock>
+    for(j = 0; j < PGSIZE/BSIZE; j++)
+801077e9:	83 c4 10             	add    $0x10,%esp
+801077ec:	81 fb 0c 79 18 80    	cmp    $0x8018790c,%ebx
+801077f2:	75 e4                	jne    801077d8 <swapinit+0x38>
+    initsleeplock(&swapio[i].lock, "swapio");
+801077f4:	83 ec 08             	sub    $0x8,%esp
+801077f7:	bb 4c 79 18 80       	mov    $0x8018794c,%ebx
+801077fc:	bf 8c 7c 18 80       	mov    $0x80187c8c,%edi
+80107801:	68 71 bb 10 80       	push   $0x8010bb71
+80107806:	68 00 79 18 80       	push   $0x80187900
+8010780b:	e8 20 f4 ff ff       	call   80106c30 <initsleeplock>
+    for(j = 0; j < PGSIZE/BSIZE; j++)
+80107810:	83 c4 10             	add    $0x10,%esp
+80107813:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107817:	90                   	nop
+      initsleeplock(&swapio[i].b[j].lock, "swapbuf");
+80107818:	83 ec 08             	sub    $0x8,%esp
+8010781b:	68 78 bb 10 80       	push   $0x8010bb78
+80107820:	53                   	push   %ebx
+    for(j = 0; j < PGSIZE/BSIZE; j++)
+80107821:	83 c3 68             	add    $0x68,%ebx
+      initsleeplock(&swapio[i].b[j].lock, "swapbuf");
+80107824:	e8 07 f4 ff ff       	call   80106c30 <initsleeplock>
+    for(j = 0; j < PGSIZE/BSIZE; j++)
+80107829:	83 c4 10             	add    $0x10,%esp
+8010782c:	39 df                	cmp    %ebx,%edi
+8010782e:	75 e8                	jne    80107818 <swapinit+0x78>
+  readsb(dev, &sb);
+80107830:	83 ec 08             	sub    $0x8,%esp
+80107833:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+80107836:	50                   	push   %eax
+80107837:	56                   	push   %esi
+80107838:	e8 a3 a6 ff ff       	call   80101ee0 <readsb>
+  if(sb.nswap == 0)
+8010783d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107840:	83 c4 10             	add    $0x10,%esp
+80107843:	85 c0                	test   %eax,%eax
+80107845:	74 33                	je     8010787a <swapinit+0xda>
+  swap.start = sb.swapstart;
+80107847:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  swap.dev = dev;
+8010784a:	89 35 54 69 18 80    	mov    %esi,0x80186954
+  swap.start = sb.swapstart;
+80107850:	89 15 58 69 18 80    	mov    %edx,0x80186958
+  swap.nslot = sb.nswap < NSWAPPAGE ? sb.nswap : NSWAPPAGE;
+80107856:	ba 00 04 00 00       	mov    $0x400,%edx
+8010785b:	39 d0                	cmp    %edx,%eax
+8010785d:	0f 47 c2             	cmova  %edx,%eax
+  kthread("kswapd", kswapd);
+80107860:	83 ec 08             	sub    $0x8,%esp
+  swap.nslot = sb.nswap < NSWAPPAGE ? sb.nswap : NSWAPPAGE;
+80107863:	a3 5c 69 18 80       	mov    %eax,0x8018695c
+  kthread("kswapd", kswapd);
+80107868:	68 40 75 10 80       	push   $0x80107540
+8010786d:	68 80 bb 10 80       	push   $0x8010bb80
+80107872:	e8 39 e4 ff ff       	call   80105cb0 <kthread>
+80107877:	83 c4 10             	add    $0x10,%esp
+}
+8010787a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010787d:	5b                   	pop    %ebx
+8010787e:	5e                   	pop    %esi
+8010787f:	5f                   	pop    %edi
+80107880:	5d                   	pop    %ebp
+80107881:	c3                   	ret
+80107882:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107889:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107890 <swapalloc>:
+{
+80107890:	55                   	push   %ebp
+80107891:	89 e5                	mov    %esp,%ebp
+80107893:	57                   	push   %edi
+80107894:	56                   	push   %esi
+80107895:	53                   	push   %ebx
+80107896:	83 ec 18             	sub    $0x18,%esp
+  acquire(&swap.lock);
+80107899:	68 20 69 18 80       	push   $0x80186920
+8010789e:	e8 bd f4 ff ff       	call   80106d60 <acquire>
+  for(i = 0; i < swap.nslot; i++){
+801078a3:	8b 35 5c 69 18 80    	mov    0x8018695c,%esi
+801078a9:	83 c4 10             	add    $0x10,%esp
+801078ac:	85 f6                	test   %esi,%esi
+801078ae:	7e 35                	jle    801078e5 <swapalloc+0x55>
+801078b0:	8b 0d 60 75 18 80    	mov    0x80187560,%ecx
+801078b6:	8d 3c 0e             	lea    (%esi,%ecx,1),%edi
+801078b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = (swap.next + i) % swap.nslot;
+801078c0:	89 c8                	mov    %ecx,%eax
+801078c2:	99                   	cltd
+801078c3:	f7 fe                	idiv   %esi
+    if(swap.ref[s] == 0 && !swap.busy[s]){
+801078c5:	66 83 bc 12 60 69 18 	cmpw   $0x0,-0x7fe796a0(%edx,%edx,1)
+801078cc:	80 00 
+    s = (swap.next + i) % swap.nslot;
+801078ce:	89 d3                	mov    %edx,%ebx
+    if(swap.ref[s] == 0 && !swap.busy[s]){
+801078d0:	8d 42 20             	lea    0x20(%edx),%eax
+801078d3:	75 09                	jne    801078de <swapalloc+0x4e>
+801078d5:	80 ba 60 71 18 80 00 	cmpb   $0x0,-0x7fe78ea0(%edx)
+801078dc:	74 2a                	je     80107908 <swapalloc+0x78>
+  for(i = 0; i < swap.nslot; i++){
+801078de:	83 c1 01             	add    $0x1,%ecx
+801078e1:	39 f9                	cmp    %edi,%ecx
+801078e3:	75 db                	jne    801078c0 <swapalloc+0x30>
+  release(&swap.lock);
+801078e5:	83 ec 0c             	sub    $0xc,%esp
+  return -1;
+801078e8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  release(&swap.lock);
+801078ed:	68 20 69 18 80       	push   $0x80186920
+801078f2:	e8 89 f6 ff ff       	call   80106f80 <release>
+  return -1;
+801078f7:	83 c4 10             	add    $0x10,%esp
+}
+801078fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801078fd:	89 d8                	mov    %ebx,%eax
+801078ff:	5b                   	pop    %ebx
+80107900:	5e                   	pop    %esi
+80107901:	5f                   	pop    %edi
+80107902:	5d                   	pop    %ebp
+80107903:	c3                   	ret
+80107904:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      swap.ref[s] = 1;
+80107908:	ba 01 00 00 00       	mov    $0x1,%edx
+      release(&swap.lock);
+8010790d:	83 ec 0c             	sub    $0xc,%esp
+      swap.busy[s] = 1;
+80107910:	c6 83 60 71 18 80 01 	movb   $0x1,-0x7fe78ea0(%ebx)
+      swap.ref[s] = 1;
+80107917:	66 89 94 00 20 69 18 	mov    %dx,-0x7fe796e0(%eax,%eax,1)
+8010791e:	80 
+      swap.next = (s + 1) % swap.nslot;
+8010791f:	8d 43 01             	lea    0x1(%ebx),%eax
+80107922:	99                   	cltd
+80107923:	f7 fe                	idiv   %esi
+80107925:	89 15 60 75 18 80    	mov    %edx,0x80187560
+      release(&swap.lock);
+8010792b:	68 20 69 18 80       	push   $0x80186920
+80107930:	e8 4b f6 ff ff       	call   80106f80 <release>
+      return s;
+80107935:	83 c4 10             	add    $0x10,%esp
+}
+80107938:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010793b:	89 d8                	mov    %ebx,%eax
+8010793d:	5b                   	pop    %ebx
+8010793e:	5e                   	pop    %esi
+8010793f:	5f                   	pop    %edi
+80107940:	5d                   	pop    %ebp
+80107941:	c3                   	ret
+80107942:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107950 <swapdup>:
+{
+80107950:	55                   	push   %ebp
+80107951:	89 e5                	mov    %esp,%ebp
+80107953:	53                   	push   %ebx
+80107954:	83 ec 10             	sub    $0x10,%esp
+80107957:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&swap.lock);
+8010795a:	68 20 69 18 80       	push   $0x80186920
+8010795f:	e8 fc f3 ff ff       	call   80106d60 <acquire>
+  release(&swap.lock);
+80107964:	83 c4 10             	add    $0x10,%esp
+  swap.ref[slot]++;
+80107967:	66 83 84 1b 60 69 18 	addw   $0x1,-0x7fe796a0(%ebx,%ebx,1)
+8010796e:	80 01 
+}
+80107970:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&swap.lock);
+80107973:	c7 45 08 20 69 18 80 	movl   $0x80186920,0x8(%ebp)
+}
+8010797a:	c9                   	leave
+  release(&swap.lock);
+8010797b:	e9 00 f6 ff ff       	jmp    80106f80 <release>
+
+80107980 <swapfree>:
+{
+80107980:	55                   	push   %ebp
+80107981:	89 e5                	mov    %esp,%ebp
+80107983:	53                   	push   %ebx
+80107984:	83 ec 10             	sub    $0x10,%esp
+80107987:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&swap.lock);
+8010798a:	68 20 69 18 80       	push   $0x80186920
+8010798f:	e8 cc f3 ff ff       	call   80106d60 <acquire>
+  if(swap.ref[slot] == 0)
+80107994:	8d 43 20             	lea    0x20(%ebx),%eax
+80107997:	83 c4 10             	add    $0x10,%esp
+8010799a:	0f b7 94 00 20 69 18 	movzwl -0x7fe796e0(%eax,%eax,1),%edx
+801079a1:	80 
+801079a2:	66 85 d2             	test   %dx,%dx
+801079a5:	74 1b                	je     801079c2 <swapfree+0x42>
+  swap.ref[slot]--;
+801079a7:	83 ea 01             	sub    $0x1,%edx
+801079aa:	66 89 94 00 20 69 18 	mov    %dx,-0x7fe796e0(%eax,%eax,1)
+801079b1:	80 
+}
+801079b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&swap.lock);
+801079b5:	c7 45 08 20 69 18 80 	movl   $0x80186920,0x8(%ebp)
+}
+801079bc:	c9                   	leave
+  release(&swap.lock);
+801079bd:	e9 be f5 ff ff       	jmp    80106f80 <release>
+    panic("swapfree");
+801079c2:	83 ec 0c             	sub    $0xc,%esp
+801079c5:	68 87 bb 10 80       	push   $0x8010bb87
+801079ca:	e8 f1 91 ff ff       	call   80100bc0 <panic>
+801079cf:	90                   	nop
+
+801079d0 <swapread>:
+{
+801079d0:	55                   	push   %ebp
+801079d1:	89 e5                	mov    %esp,%ebp
+801079d3:	57                   	push   %edi
+801079d4:	56                   	push   %esi
+801079d5:	53                   	push   %ebx
+801079d6:	83 ec 18             	sub    $0x18,%esp
+801079d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801079dc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  acquire(&swap.lock);
+801079df:	68 20 69 18 80       	push   $0x80186920
+801079e4:	8d b3 60 71 18 80    	lea    -0x7fe78ea0(%ebx),%esi
+801079ea:	e8 71 f3 ff ff       	call   80106d60 <acquire>
+  while(swap.busy[slot])
+801079ef:	83 c4 10             	add    $0x10,%esp
+801079f2:	80 bb 60 71 18 80 00 	cmpb   $0x0,-0x7fe78ea0(%ebx)
+801079f9:	74 1f                	je     80107a1a <swapread+0x4a>
+801079fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801079ff:	90                   	nop
+    sleep(&swap.busy[slot], &swap.lock);
+80107a00:	83 ec 08             	sub    $0x8,%esp
+80107a03:	68 20 69 18 80       	push   $0x80186920
+80107a08:	56                   	push   %esi
+80107a09:	e8 02 eb ff ff       	call   80106510 <sleep>
+  while(swap.busy[slot])
+80107a0e:	83 c4 10             	add    $0x10,%esp
+80107a11:	80 bb 60 71 18 80 00 	cmpb   $0x0,-0x7fe78ea0(%ebx)
+80107a18:	75 e6                	jne    80107a00 <swapread+0x30>
+  release(&swap.lock);
+80107a1a:	83 ec 0c             	sub    $0xc,%esp
+80107a1d:	68 20 69 18 80       	push   $0x80186920
+80107a22:	e8 59 f5 ff ff       	call   80106f80 <release>
+  swaprw(slot, page, 0);
+80107a27:	83 c4 10             	add    $0x10,%esp
+}
+80107a2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  swaprw(slot, page, 0);
+80107a2d:	89 fa                	mov    %edi,%edx
+80107a2f:	89 d8                	mov    %ebx,%eax
+80107a31:	31 c9                	xor    %ecx,%ecx
+}
+80107a33:	5b                   	pop    %ebx
+80107a34:	5e                   	pop    %esi
+80107a35:	5f                   	pop    %edi
+80107a36:	5d                   	pop    %ebp
+  swaprw(slot, page, 0);
+80107a37:	e9 14 fa ff ff       	jmp    80107450 <swaprw>
+80107a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107a40 <swapwait>:
+int
+swapwait(void)
+{
+  int pass, n, ncli;
+
+  if(swap.nslot == 0)
+80107a40:	8b 15 5c 69 18 80    	mov    0x8018695c,%edx
+80107a46:	85 d2                	test   %edx,%edx
+80107a48:	75 06                	jne    80107a50 <swapwait+0x10>
+    return 0;
+80107a4a:	31 c0                	xor    %eax,%eax
+  while(swap.passes == pass)
+    sleep(&swap.passes, &swap.lock);
+  n = swap.freed;
+  release(&swap.lock);
+  return n;
+}
+80107a4c:	c3                   	ret
+80107a4d:	8d 76 00             	lea    0x0(%esi),%esi
+{
+80107a50:	55                   	push   %ebp
+80107a51:	89 e5                	mov    %esp,%ebp
+80107a53:	57                   	push   %edi
+80107a54:	56                   	push   %esi
+80107a55:	53                   	push   %ebx
+80107a56:	83 ec 1c             	sub    $0x1c,%esp
+  pushcli();
+80107a59:	e8 a2 f4 ff ff       	call   80106f00 <pushcli>
+  ncli = cpu->ncli;
+80107a5e:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+80107a64:	8b b8 ac 00 00 00    	mov    0xac(%eax),%edi
+  popcli();
+80107a6a:	e8 c1 f4 ff ff       	call   80106f30 <popcli>
+  acquire(&swap.lock);
+80107a6f:	83 ec 0c             	sub    $0xc,%esp
+80107a72:	68 20 69 18 80       	push   $0x80186920
+80107a77:	e8 e4 f2 ff ff       	call   80106d60 <acquire>
+  n = !swap.wanted;
+80107a7c:	8b 35 64 75 18 80    	mov    0x80187564,%esi
+  pass = swap.passes;
+80107a82:	8b 1d 68 75 18 80    	mov    0x80187568,%ebx
+  swap.wanted = 1;
+80107a88:	c7 05 64 75 18 80 01 	movl   $0x1,0x80187564
+80107a8f:	00 00 00 
+  release(&swap.lock);
+80107a92:	c7 04 24 20 69 18 80 	movl   $0x80186920,(%esp)
+80107a99:	e8 e2 f4 ff ff       	call   80106f80 <release>
+  if(n)
+80107a9e:	83 c4 10             	add    $0x10,%esp
+80107aa1:	85 f6                	test   %esi,%esi
+80107aa3:	74 7b                	je     80107b20 <swapwait+0xe0>
+  if(proc == 0 || ncli > 1)
+80107aa5:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80107aab:	85 c0                	test   %eax,%eax
+80107aad:	74 05                	je     80107ab4 <swapwait+0x74>
+80107aaf:	83 ff 01             	cmp    $0x1,%edi
+80107ab2:	7e 0c                	jle    80107ac0 <swapwait+0x80>
+}
+80107ab4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+80107ab7:	31 c0                	xor    %eax,%eax
+}
+80107ab9:	5b                   	pop    %ebx
+80107aba:	5e                   	pop    %esi
+80107abb:	5f                   	pop    %edi
+80107abc:	5d                   	pop    %ebp
+80107abd:	c3                   	ret
+80107abe:	66 90                	xchg   %ax,%ax
+  acquire(&swap.lock);
+80107ac0:	83 ec 0c             	sub    $0xc,%esp
+80107ac3:	68 20 69 18 80       	push   $0x80186920
+80107ac8:	e8 93 f2 ff ff       	call   80106d60 <acquire>
+  while(swap.passes == pass)
+80107acd:	83 c4 10             	add    $0x10,%esp
+80107ad0:	3b 1d 68 75 18 80    	cmp    0x80187568,%ebx
+80107ad6:	75 25                	jne    80107afd <swapwait+0xbd>
+80107ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107adf:	90                   	nop
+    sleep(&swap.passes, &swap.lock);
+80107ae0:	83 ec 08             	sub    $0x8,%esp
+80107ae3:	68 20 69 18 80       	push   $0x80186920
+80107ae8:	68 68 75 18 80       	push   $0x80187568
+80107aed:	e8 1e ea ff ff       	call   80106510 <sleep>
+  while(swap.passes == pass)
+80107af2:	83 c4 10             	add    $0x10,%esp
+80107af5:	39 1d 68 75 18 80    	cmp    %ebx,0x80187568
+80107afb:	74 e3                	je     80107ae0 <swapwait+0xa0>
+  n = swap.freed;
+80107afd:	a1 6c 75 18 80       	mov    0x8018756c,%eax
+  release(&swap.lock);
+80107b02:	83 ec 0c             	sub    $0xc,%esp
+  n = swap.freed;
+80107b05:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  release(&swap.lock);
+80107b08:	68 20 69 18 80       	push   $0x80186920
+80107b0d:	e8 6e f4 ff ff       	call   80106f80 <release>
+  return n;
+80107b12:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107b15:	83 c4 10             	add    $0x10,%esp
+}
+80107b18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107b1b:	5b                   	pop    %ebx
+80107b1c:	5e                   	pop    %esi
+80107b1d:	5f                   	pop    %edi
+80107b1e:	5d                   	pop    %ebp
+80107b1f:	c3                   	ret
+    wakeup(&swap.wanted);
+80107b20:	83 ec 0c             	sub    $0xc,%esp
+80107b23:	68 64 75 18 80       	push   $0x80187564
+80107b28:	e8 b3 eb ff ff       	call   801066e0 <wakeup>
+80107b2d:	83 c4 10             	add    $0x10,%esp
+80107b30:	e9 70 ff ff ff       	jmp    80107aa5 <swapwait+0x65>
+
+80107b35 <swtch>:
+# Save current register context in old
+# and then load register context from new.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+80107b35:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+80107b39:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-save registers
+  pushl %ebp
+80107b3d:	55                   	push   %ebp
+  pushl %ebx
+80107b3e:	53                   	push   %ebx
+  pushl %esi
+80107b3f:	56                   	push   %esi
+  pushl %edi
+80107b40:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+80107b41:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+80107b43:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-save registers
+  popl %edi
+80107b45:	5f                   	pop    %edi
+  popl %esi
+80107b46:	5e                   	pop    %esi
+  popl %ebx
+80107b47:	5b                   	pop    %ebx
+  popl %ebp
+80107b48:	5d                   	pop    %ebp
+  ret
+80107b49:	c3                   	ret
+80107b4a:	66 90                	xchg   %ax,%ax
+80107b4c:	66 90                	xchg   %ax,%ax
+80107b4e:	66 90                	xchg   %ax,%ax
+
+80107b50 <argmem>:
+  return fetchint(proc->tf->esp + 4 + 4*n, ip);
+}
+
+static int
+argmem(int n, char **pp, int size, int write)
+{
+80107b50:	55                   	push   %ebp
+80107b51:	89 e5                	mov    %esp,%ebp
+80107b53:	57                   	push   %edi
+80107b54:	89 d7                	mov    %edx,%edi
+80107b56:	56                   	push   %esi
+80107b57:	89 c6                	mov    %eax,%esi
+80107b59:	53                   	push   %ebx
+80107b5a:	83 ec 0c             	sub    $0xc,%esp
+  return fetchint(proc->tf->esp + 4 + 4*n, ip);
+80107b5d:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80107b63:	8b 50 5c             	mov    0x5c(%eax),%edx
+  if(addr >= proc->sz || addr+4 > proc->sz)
+80107b66:	8b 40 34             	mov    0x34(%eax),%eax
+  return fetchint(proc->tf->esp + 4 + 4*n, ip);
+80107b69:	8b 52 44             	mov    0x44(%edx),%edx
+80107b6c:	8d 34 b2             	lea    (%edx,%esi,4),%esi
+80107b6f:	8d 56 04             	lea    0x4(%esi),%edx
+  if(addr >= proc->sz || addr+4 > proc->sz)
+80107b72:	39 c2                	cmp    %eax,%edx
+80107b74:	73 5a                	jae    80107bd0 <argmem+0x80>
+80107b76:	89 cb                	mov    %ecx,%ebx
+80107b78:	8d 4e 08             	lea    0x8(%esi),%ecx
+80107b7b:	39 c8                	cmp    %ecx,%eax
+80107b7d:	72 51                	jb     80107bd0 <argmem+0x80>
+  if(uvmprefault(addr, 4, 0) < 0)
+80107b7f:	83 ec 04             	sub    $0x4,%esp
+80107b82:	6a 00                	push   $0x0
+80107b84:	6a 04                	push   $0x4
+80107b86:	52                   	push   %edx
+80107b87:	e8 34 35 00 00       	call   8010b0c0 <uvmprefault>
+80107b8c:	83 c4 10             	add    $0x10,%esp
+80107b8f:	85 c0                	test   %eax,%eax
+80107b91:	78 3d                	js     80107bd0 <argmem+0x80>
+  *ip = *(int*)(addr);
+80107b93:	8b 76 04             	mov    0x4(%esi),%esi
+  int i;
+
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || (uint)i >= proc->sz || (uint)i+size > proc->sz)
+80107b96:	85 db                	test   %ebx,%ebx
+80107b98:	78 36                	js     80107bd0 <argmem+0x80>
+80107b9a:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80107ba0:	8b 40 34             	mov    0x34(%eax),%eax
+80107ba3:	39 c6                	cmp    %eax,%esi
+80107ba5:	73 29                	jae    80107bd0 <argmem+0x80>
+80107ba7:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+80107baa:	39 d0                	cmp    %edx,%eax
+80107bac:	72 22                	jb     80107bd0 <argmem+0x80>
+    return -1;
+  if(uvmprefault(i, size, write) < 0)
+80107bae:	83 ec 04             	sub    $0x4,%esp
+80107bb1:	ff 75 08             	push   0x8(%ebp)
+80107bb4:	53                   	push   %ebx
+80107bb5:	56                   	push   %esi
+80107bb6:	e8 05 35 00 00       	call   8010b0c0 <uvmprefault>
+80107bbb:	83 c4 10             	add    $0x10,%esp
+80107bbe:	85 c0                	test   %eax,%eax
+80107bc0:	78 0e                	js     80107bd0 <argmem+0x80>
+    return -1;
+  *pp = (char*)i;
+80107bc2:	89 37                	mov    %esi,(%edi)
+  return 0;
+80107bc4:	31 c0                	xor    %eax,%eax
+}
+80107bc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107bc9:	5b                   	pop    %ebx
+80107bca:	5e                   	pop    %esi
+80107bcb:	5f                   	pop    %edi
+80107bcc:	5d                   	pop    %ebp
+80107bcd:	c3                   	ret
+80107bce:	66 90                	xchg   %ax,%ax
+    return -1;
+80107bd0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107bd5:	eb ef                	jmp    80107bc6 <argmem+0x76>
+80107bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107bde:	66 90                	xchg   %ax,%ax
+
+80107be0 <fetchint>:
+{
+80107be0:	55                   	push   %ebp
+80107be1:	89 e5                	mov    %esp,%ebp
+80107be3:	53                   	push   %ebx
+80107be4:	83 ec 04             	sub    $0x4,%esp
+  if(addr >= proc->sz || addr+4 > proc->sz)
+80107be7:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+{
+80107bed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(addr >= proc->sz || addr+4 > proc->sz)
+80107bf0:	8b 40 34             	mov    0x34(%eax),%eax
+80107bf3:	39 c3                	cmp    %eax,%ebx
+80107bf5:	73 29                	jae    80107c20 <fetchint+0x40>
+80107bf7:	8d 53 04             	lea    0x4(%ebx),%edx
+80107bfa:	39 d0                	cmp    %edx,%eax
+80107bfc:	72 22                	jb     80107c20 <fetchint+0x40>
+  if(uvmprefault(addr, 4, 0) < 0)
+80107bfe:	83 ec 04             	sub    $0x4,%esp
+80107c01:	6a 00                	push   $0x0
+80107c03:	6a 04                	push   $0x4
+80107c05:	53                   	push   %ebx
+80107c06:	e8 b5 34 00 00       	call   8010b0c0 <uvmprefault>
+80107c0b:	83 c4 10             	add    $0x10,%esp
+80107c0e:	85 c0                	test   %eax,%eax
+80107c10:	78 0e                	js     80107c20 <fetchint+0x40>
+  *ip = *(int*)(addr);
+80107c12:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107c15:	8b 13                	mov    (%ebx),%edx
+80107c17:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107c19:	31 c0                	xor    %eax,%eax
+}
+80107c1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107c1e:	c9                   	leave
+80107c1f:	c3                   	ret
+    return -1;
+80107c20:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107c25:	eb f4                	jmp    80107c1b <fetchint+0x3b>
+80107c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107c2e:	66 90                	xchg   %ax,%ax
+
+80107c30 <fetchstr>:
+{
+80107c30:	55                   	push   %ebp
+80107c31:	89 e5                	mov    %esp,%ebp
+80107c33:	57                   	push   %edi
+80107c34:	56                   	push   %esi
+80107c35:	53                   	push   %ebx
+80107c36:	83 ec 0c             	sub    $0xc,%esp
+  if(addr >= proc->sz)
+80107c39:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+{
+80107c3f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80107c42:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(addr >= proc->sz)
+80107c45:	3b 58 34             	cmp    0x34(%eax),%ebx
+80107c48:	73 56                	jae    80107ca0 <fetchstr+0x70>
+  *pp = (char*)addr;
+80107c4a:	89 1e                	mov    %ebx,(%esi)
+  ep = (char*)proc->sz;
+80107c4c:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80107c52:	8b 78 34             	mov    0x34(%eax),%edi
+  for(s = *pp; s < ep; s++){
+80107c55:	39 fb                	cmp    %edi,%ebx
+80107c57:	73 47                	jae    80107ca0 <fetchstr+0x70>
+80107c59:	89 d8                	mov    %ebx,%eax
+80107c5b:	eb 0c                	jmp    80107c69 <fetchstr+0x39>
+80107c5d:	8d 76 00             	lea    0x0(%esi),%esi
+80107c60:	83 c3 01             	add    $0x1,%ebx
+80107c63:	39 fb                	cmp    %edi,%ebx
+80107c65:	73 39                	jae    80107ca0 <fetchstr+0x70>
+      return s - *pp;
+80107c67:	8b 06                	mov    (%esi),%eax
+    if((s == *pp || ((uint)s % PGSIZE) == 0) && uvmprefault((uint)s, 1, 0) < 0)
+80107c69:	39 d8                	cmp    %ebx,%eax
+80107c6b:	74 08                	je     80107c75 <fetchstr+0x45>
+80107c6d:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80107c73:	75 14                	jne    80107c89 <fetchstr+0x59>
+80107c75:	83 ec 04             	sub    $0x4,%esp
+80107c78:	6a 00                	push   $0x0
+80107c7a:	6a 01                	push   $0x1
+80107c7c:	53                   	push   %ebx
+80107c7d:	e8 3e 34 00 00       	call   8010b0c0 <uvmprefault>
+80107c82:	83 c4 10             	add    $0x10,%esp
+80107c85:	85 c0                	test   %eax,%eax
+80107c87:	78 17                	js     80107ca0 <fetchstr+0x70>
+    if(*s == 0)
+80107c89:	80 3b 00             	cmpb   $0x0,(%ebx)
+80107c8c:	75 d2                	jne    80107c60 <fetchstr+0x30>
+      return s - *pp;
+80107c8e:	89 d8                	mov    %ebx,%eax
+80107c90:	2b 06                	sub    (%esi),%eax
+}
+80107c92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107c95:	5b                   	pop    %ebx
+80107c96:	5e                   	pop    %esi
+80107c97:	5f                   	pop    %edi
+80107c98:	5d                   	pop    %ebp
+80107c99:	c3                   	ret
+80107c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107ca0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+80107ca3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107ca8:	5b                   	pop    %ebx
+80107ca9:	5e                   	pop    %esi
+80107caa:	5f                   	pop    %edi
+80107cab:	5d                   	pop    %ebp
+80107cac:	c3                   	ret
+80107cad:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107cb0 <argint>:
+{
+80107cb0:	55                   	push   %ebp
+80107cb1:	89 e5                	mov    %esp,%ebp
+80107cb3:	53                   	push   %ebx
+80107cb4:	83 ec 04             	sub    $0x4,%esp
+  return fetchint(proc->tf->esp + 4 + 4*n, ip);
+80107cb7:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80107cbd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80107cc0:	8b 50 5c             	mov    0x5c(%eax),%edx
+  if(addr >= proc->sz || addr+4 > proc->sz)
+80107cc3:	8b 40 34             	mov    0x34(%eax),%eax
+  return fetchint(proc->tf->esp + 4 + 4*n, ip);
+80107cc6:	8b 52 44             	mov    0x44(%edx),%edx
+80107cc9:	8d 1c 8a             	lea    (%edx,%ecx,4),%ebx
+80107ccc:	8d 53 04             	lea    0x4(%ebx),%edx
+  if(addr >= proc->sz || addr+4 > proc->sz)
+80107ccf:	39 c2                	cmp    %eax,%edx
+80107cd1:	73 2d                	jae    80107d00 <argint+0x50>
+80107cd3:	8d 4b 08             	lea    0x8(%ebx),%ecx
+80107cd6:	39 c8                	cmp    %ecx,%eax
+80107cd8:	72 26                	jb     80107d00 <argint+0x50>
+  if(uvmprefault(addr, 4, 0) < 0)
+80107cda:	83 ec 04             	sub    $0x4,%esp
+80107cdd:	6a 00                	push   $0x0
+80107cdf:	6a 04                	push   $0x4
+80107ce1:	52                   	push   %edx
+80107ce2:	e8 d9 33 00 00       	call   8010b0c0 <uvmprefault>
+80107ce7:	83 c4 10             	add    $0x10,%esp
+80107cea:	85 c0                	test   %eax,%eax
+80107cec:	78 12                	js     80107d00 <argint+0x50>
+  *ip = *(int*)(addr);
+80107cee:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107cf1:	8b 53 04             	mov    0x4(%ebx),%edx
+80107cf4:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107cf6:	31 c0                	xor    %eax,%eax
+}
+80107cf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107cfb:	c9                   	leave
+80107cfc:	c3                   	ret
+80107cfd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80107d00:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107d05:	eb f1                	jmp    80107cf8 <argint+0x48>
+80107d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d0e:	66 90                	xchg   %ax,%ax
+
+80107d10 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+80107d10:	55                   	push   %ebp
+80107d11:	89 e5                	mov    %esp,%ebp
+80107d13:	8b 45 08             	mov    0x8(%ebp),%eax
+  return argmem(n, pp, size, 0);
+80107d16:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80107d19:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+80107d20:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+80107d23:	5d                   	pop    %ebp
+  return argmem(n, pp, size, 0);
+80107d24:	e9 27 fe ff ff       	jmp    80107b50 <argmem>
+80107d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107d30 <argptrw>:
+// Like argptr(), for a block the kernel will write to: break
+// copy-on-write sharing now, since the kernel cannot take a
+// fault on it.
+int
+argptrw(int n, char **pp, int size)
+{
+80107d30:	55                   	push   %ebp
+80107d31:	89 e5                	mov    %esp,%ebp
+80107d33:	8b 45 08             	mov    0x8(%ebp),%eax
+  return argmem(n, pp, size, 1);
+80107d36:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80107d39:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+80107d40:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+80107d43:	5d                   	pop    %ebp
+  return argmem(n, pp, size, 1);
+80107d44:	e9 07 fe ff ff       	jmp    80107b50 <argmem>
+80107d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107d50 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80107d50:	55                   	push   %ebp
+80107d51:	89 e5                	mov    %esp,%ebp
+80107d53:	56                   	push   %esi
+80107d54:	53                   	push   %ebx
+  return fetchint(proc->tf->esp + 4 + 4*n, ip);
+80107d55:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80107d5b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+{
+80107d5e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  return fetchint(proc->tf->esp + 4 + 4*n, ip);
+80107d61:	8b 50 5c             	mov    0x5c(%eax),%edx
+  if(addr >= proc->sz || addr+4 > proc->sz)
+80107d64:	8b 40 34             	mov    0x34(%eax),%eax
+  return fetchint(proc->tf->esp + 4 + 4*n, ip);
+80107d67:	8b 52 44             	mov    0x44(%edx),%edx
+80107d6a:	8d 1c 8a             	lea    (%edx,%ecx,4),%ebx
+80107d6d:	8d 53 04             	lea    0x4(%ebx),%edx
+  if(addr >= proc->sz || addr+4 > proc->sz)
+80107d70:	39 c2                	cmp    %eax,%edx
+80107d72:	73 34                	jae    80107da8 <argstr+0x58>
+80107d74:	8d 4b 08             	lea    0x8(%ebx),%ecx
+80107d77:	39 c8                	cmp    %ecx,%eax
+80107d79:	72 2d                	jb     80107da8 <argstr+0x58>
+  if(uvmprefault(addr, 4, 0) < 0)
+80107d7b:	83 ec 04             	sub    $0x4,%esp
+80107d7e:	6a 00                	push   $0x0
+80107d80:	6a 04                	push   $0x4
+80107d82:	52                   	push   %edx
+80107d83:	e8 38 33 00 00       	call   8010b0c0 <uvmprefault>
+80107d88:	83 c4 10             	add    $0x10,%esp
+80107d8b:	85 c0                	test   %eax,%eax
+80107d8d:	78 19                	js     80107da8 <argstr+0x58>
+  int addr;
+  if(argint(n, &addr) < 0)
+    return -1;
+  return fetchstr(addr, pp);
+80107d8f:	89 75 0c             	mov    %esi,0xc(%ebp)
+80107d92:	8b 43 04             	mov    0x4(%ebx),%eax
+80107d95:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80107d98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107d9b:	5b                   	pop    %ebx
+80107d9c:	5e                   	pop    %esi
+80107d9d:	5d                   	pop    %ebp
+  return fetchstr(addr, pp);
+80107d9e:	e9 8d fe ff ff       	jmp    80107c30 <fetchstr>
+80107da3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107da7:	90                   	nop
+}
+80107da8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107dab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107db0:	5b                   	pop    %ebx
+80107db1:	5e                   	pop    %esi
+80107db2:	5d                   	pop    %ebp
+80107db3:	c3                   	ret
+80107db4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107dbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107dbf:	90                   	nop
+
+80107dc0 <syscall>:
+  return 0;
+}
+
+void
+syscall(void)
+{
+80107dc0:	55                   	push   %ebp
+80107dc1:	89 e5                	mov    %esp,%ebp
+80107dc3:	57                   	push   %edi
+80107dc4:	56                   	push   %esi
+80107dc5:	53                   	push   %ebx
+80107dc6:	83 ec 2c             	sub    $0x2c,%esp
+  int num, ret, traced;
+  uint64 t0;
+
+  num = proc->tf->eax;
+80107dc9:	65 8b 35 04 00 00 00 	mov    %gs:0x4,%esi
+80107dd0:	8b 46 5c             	mov    0x5c(%esi),%eax
+80107dd3:	8b 58 1c             	mov    0x1c(%eax),%ebx
+  if(num <= 0 || num >= NELEM(syscalls) || !syscalls[num]){
+80107dd6:	8d 43 ff             	lea    -0x1(%ebx),%eax
+80107dd9:	83 f8 20             	cmp    $0x20,%eax
+80107ddc:	0f 87 9e 00 00 00    	ja     80107e80 <syscall+0xc0>
+80107de2:	8b 3c 9d c0 bb 10 80 	mov    -0x7fef4440(,%ebx,4),%edi
+80107de9:	85 ff                	test   %edi,%edi
+80107deb:	0f 84 8f 00 00 00    	je     80107e80 <syscall+0xc0>
+    cprintf("%d %s: unknown sys call %d\n", proc->pid, proc->name, num);
+    proc->tf->eax = -1;
+    return;
+  }
+  traced = (proc->tracemask & TRACEBIT(num)) != 0;
+80107df1:	8b 56 4c             	mov    0x4c(%esi),%edx
+80107df4:	8b 46 48             	mov    0x48(%esi),%eax
+80107df7:	89 d9                	mov    %ebx,%ecx
+80107df9:	0f ad d0             	shrd   %cl,%edx,%eax
+80107dfc:	d3 ea                	shr    %cl,%edx
+80107dfe:	f6 c1 20             	test   $0x20,%cl
+80107e01:	74 02                	je     80107e05 <syscall+0x45>
+80107e03:	89 d0                	mov    %edx,%eax
+80107e05:	89 c1                	mov    %eax,%ecx
+80107e07:	83 e1 01             	and    $0x1,%ecx
+80107e0a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+
+  // exit() does not return: record it now, as a success.
+  if(traced && num == SYS_exit && tracematch(proc->tracewhen, 0))
+80107e0d:	83 fb 02             	cmp    $0x2,%ebx
+80107e10:	75 11                	jne    80107e23 <syscall+0x63>
+  traced = (proc->tracemask & TRACEBIT(num)) != 0;
+80107e12:	83 e0 01             	and    $0x1,%eax
+  if(traced && num == SYS_exit && tracematch(proc->tracewhen, 0))
+80107e15:	84 c0                	test   %al,%al
+80107e17:	74 0a                	je     80107e23 <syscall+0x63>
+  switch(when){
+80107e19:	83 7e 50 01          	cmpl   $0x1,0x50(%esi)
+80107e1d:	0f 86 8d 00 00 00    	jbe    80107eb0 <syscall+0xf0>
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+80107e23:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+80107e25:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80107e28:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    traceput(num, 0, 0);
+  t0 = rdtsc();
+  ret = syscalls[num]();
+80107e2b:	ff d7                	call   *%edi
+80107e2d:	89 c6                	mov    %eax,%esi
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+80107e2f:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+80107e31:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  tracecount(num, ret, rdtsc() - t0);
+80107e34:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80107e37:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80107e3a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80107e3d:	2b 45 e0             	sub    -0x20(%ebp),%eax
+80107e40:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+80107e43:	52                   	push   %edx
+80107e44:	50                   	push   %eax
+80107e45:	56                   	push   %esi
+80107e46:	53                   	push   %ebx
+80107e47:	e8 14 14 00 00       	call   80109260 <tracecount>
+  if(traced && tracematch(proc->tracewhen, ret))
+80107e4c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80107e4f:	83 c4 10             	add    $0x10,%esp
+80107e52:	83 c8 00             	or     $0x0,%eax
+80107e55:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80107e5b:	74 15                	je     80107e72 <syscall+0xb2>
+80107e5d:	8b 50 50             	mov    0x50(%eax),%edx
+  switch(when){
+80107e60:	83 fa 01             	cmp    $0x1,%edx
+80107e63:	0f 84 87 00 00 00    	je     80107ef0 <syscall+0x130>
+80107e69:	83 fa 02             	cmp    $0x2,%edx
+80107e6c:	74 62                	je     80107ed0 <syscall+0x110>
+80107e6e:	85 d2                	test   %edx,%edx
+80107e70:	74 62                	je     80107ed4 <syscall+0x114>
+    traceput(num, ret, TRACE_RET);
+  proc->tf->eax = ret;
+80107e72:	8b 40 5c             	mov    0x5c(%eax),%eax
+80107e75:	89 70 1c             	mov    %esi,0x1c(%eax)
+}
+80107e78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107e7b:	5b                   	pop    %ebx
+80107e7c:	5e                   	pop    %esi
+80107e7d:	5f                   	pop    %edi
+80107e7e:	5d                   	pop    %ebp
+80107e7f:	c3                   	ret
+    cprintf("%d %s: unknown sys call %d\n", proc->pid, proc->name, num);
+80107e80:	8d 86 b0 00 00 00    	lea    0xb0(%esi),%eax
+80107e86:	53                   	push   %ebx
+80107e87:	50                   	push   %eax
+80107e88:	ff 76 44             	push   0x44(%esi)
+80107e8b:	68 90 bb 10 80       	push   $0x8010bb90
+80107e90:	e8 5b 90 ff ff       	call   80100ef0 <cprintf>
+    proc->tf->eax = -1;
+80107e95:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+    return;
+80107e9b:	83 c4 10             	add    $0x10,%esp
+    proc->tf->eax = -1;
+80107e9e:	8b 40 5c             	mov    0x5c(%eax),%eax
+80107ea1:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+}
+80107ea8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107eab:	5b                   	pop    %ebx
+80107eac:	5e                   	pop    %esi
+80107ead:	5f                   	pop    %edi
+80107eae:	5d                   	pop    %ebp
+80107eaf:	c3                   	ret
+    traceput(num, 0, 0);
+80107eb0:	83 ec 04             	sub    $0x4,%esp
+80107eb3:	6a 00                	push   $0x0
+80107eb5:	6a 00                	push   $0x0
+80107eb7:	6a 02                	push   $0x2
+80107eb9:	e8 f2 10 00 00       	call   80108fb0 <traceput>
+80107ebe:	83 c4 10             	add    $0x10,%esp
+80107ec1:	e9 5d ff ff ff       	jmp    80107e23 <syscall+0x63>
+80107ec6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107ecd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(traced && tracematch(proc->tracewhen, ret))
+80107ed0:	85 f6                	test   %esi,%esi
+80107ed2:	79 9e                	jns    80107e72 <syscall+0xb2>
+    traceput(num, ret, TRACE_RET);
+80107ed4:	83 ec 04             	sub    $0x4,%esp
+80107ed7:	6a 01                	push   $0x1
+80107ed9:	56                   	push   %esi
+80107eda:	53                   	push   %ebx
+80107edb:	e8 d0 10 00 00       	call   80108fb0 <traceput>
+  proc->tf->eax = ret;
+80107ee0:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80107ee6:	83 c4 10             	add    $0x10,%esp
+80107ee9:	e9 84 ff ff ff       	jmp    80107e72 <syscall+0xb2>
+80107eee:	66 90                	xchg   %ax,%ax
+  if(traced && tracematch(proc->tracewhen, ret))
+80107ef0:	85 f6                	test   %esi,%esi
+80107ef2:	79 e0                	jns    80107ed4 <syscall+0x114>
+80107ef4:	e9 79 ff ff ff       	jmp    80107e72 <syscall+0xb2>
+80107ef9:	66 90                	xchg   %ax,%ax
+80107efb:	66 90                	xchg   %ax,%ax
+80107efd:	66 90                	xchg   %ax,%ax
+80107eff:	90                   	nop
+
+80107f00 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+80107f00:	55                   	push   %ebp
+80107f01:	89 e5                	mov    %esp,%ebp
+80107f03:	57                   	push   %edi
+80107f04:	56                   	push   %esi
+  uint off;
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+80107f05:	8d 7d da             	lea    -0x26(%ebp),%edi
+{
+80107f08:	53                   	push   %ebx
+80107f09:	83 ec 44             	sub    $0x44,%esp
+80107f0c:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+80107f0f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80107f12:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+80107f15:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+  if((dp = nameiparent(path, name)) == 0)
+80107f18:	57                   	push   %edi
+80107f19:	50                   	push   %eax
+80107f1a:	e8 01 ad ff ff       	call   80102c20 <nameiparent>
+80107f1f:	83 c4 10             	add    $0x10,%esp
+80107f22:	85 c0                	test   %eax,%eax
+80107f24:	74 5e                	je     80107f84 <create+0x84>
+    return 0;
+  ilock(dp);
+80107f26:	83 ec 0c             	sub    $0xc,%esp
+80107f29:	89 c3                	mov    %eax,%ebx
+80107f2b:	50                   	push   %eax
+80107f2c:	e8 8f a2 ff ff       	call   801021c0 <ilock>
+
+  if((ip = dirlookup(dp, name, &off)) != 0){
+80107f31:	83 c4 0c             	add    $0xc,%esp
+80107f34:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+80107f37:	50                   	push   %eax
+80107f38:	57                   	push   %edi
+80107f39:	53                   	push   %ebx
+80107f3a:	e8 e1 a8 ff ff       	call   80102820 <dirlookup>
+80107f3f:	83 c4 10             	add    $0x10,%esp
+80107f42:	89 c6                	mov    %eax,%esi
+80107f44:	85 c0                	test   %eax,%eax
+80107f46:	74 48                	je     80107f90 <create+0x90>
+    iunlockput(dp);
+80107f48:	83 ec 0c             	sub    $0xc,%esp
+80107f4b:	53                   	push   %ebx
+80107f4c:	e8 ef a4 ff ff       	call   80102440 <iunlockput>
+    ilock(ip);
+80107f51:	89 34 24             	mov    %esi,(%esp)
+80107f54:	e8 67 a2 ff ff       	call   801021c0 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+80107f59:	83 c4 10             	add    $0x10,%esp
+80107f5c:	66 83 7d c4 02       	cmpw   $0x2,-0x3c(%ebp)
+80107f61:	75 15                	jne    80107f78 <create+0x78>
+80107f63:	66 83 7e 5c 02       	cmpw   $0x2,0x5c(%esi)
+80107f68:	75 0e                	jne    80107f78 <create+0x78>
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+80107f6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107f6d:	89 f0                	mov    %esi,%eax
+80107f6f:	5b                   	pop    %ebx
+80107f70:	5e                   	pop    %esi
+80107f71:	5f                   	pop    %edi
+80107f72:	5d                   	pop    %ebp
+80107f73:	c3                   	ret
+80107f74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iunlockput(ip);
+80107f78:	83 ec 0c             	sub    $0xc,%esp
+80107f7b:	56                   	push   %esi
+80107f7c:	e8 bf a4 ff ff       	call   80102440 <iunlockput>
+    return 0;
+80107f81:	83 c4 10             	add    $0x10,%esp
+}
+80107f84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+80107f87:	31 f6                	xor    %esi,%esi
+}
+80107f89:	5b                   	pop    %ebx
+80107f8a:	89 f0                	mov    %esi,%eax
+80107f8c:	5e                   	pop    %esi
+80107f8d:	5f                   	pop    %edi
+80107f8e:	5d                   	pop    %ebp
+80107f8f:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80107f90:	0f bf 45 c4          	movswl -0x3c(%ebp),%eax
+80107f94:	83 ec 08             	sub    $0x8,%esp
+80107f97:	50                   	push   %eax
+80107f98:	ff 33                	push   (%ebx)
+80107f9a:	e8 31 a0 ff ff       	call   80101fd0 <ialloc>
+80107f9f:	83 c4 10             	add    $0x10,%esp
+80107fa2:	89 c6                	mov    %eax,%esi
+80107fa4:	85 c0                	test   %eax,%eax
+80107fa6:	0f 84 bc 00 00 00    	je     80108068 <create+0x168>
+  ilock(ip);
+80107fac:	83 ec 0c             	sub    $0xc,%esp
+80107faf:	50                   	push   %eax
+80107fb0:	e8 0b a2 ff ff       	call   801021c0 <ilock>
+  ip->major = major;
+80107fb5:	0f b7 45 c0          	movzwl -0x40(%ebp),%eax
+80107fb9:	66 89 46 5e          	mov    %ax,0x5e(%esi)
+  ip->minor = minor;
+80107fbd:	0f b7 45 bc          	movzwl -0x44(%ebp),%eax
+80107fc1:	66 89 46 60          	mov    %ax,0x60(%esi)
+  ip->nlink = 1;
+80107fc5:	b8 01 00 00 00       	mov    $0x1,%eax
+80107fca:	66 89 46 62          	mov    %ax,0x62(%esi)
+  iupdate(ip);
+80107fce:	89 34 24             	mov    %esi,(%esp)
+80107fd1:	e8 ba a0 ff ff       	call   80102090 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80107fd6:	83 c4 10             	add    $0x10,%esp
+80107fd9:	66 83 7d c4 01       	cmpw   $0x1,-0x3c(%ebp)
+80107fde:	74 30                	je     80108010 <create+0x110>
+  if(dirlink(dp, name, ip->inum) < 0)
+80107fe0:	83 ec 04             	sub    $0x4,%esp
+80107fe3:	ff 76 04             	push   0x4(%esi)
+80107fe6:	57                   	push   %edi
+80107fe7:	53                   	push   %ebx
+80107fe8:	e8 53 ab ff ff       	call   80102b40 <dirlink>
+80107fed:	83 c4 10             	add    $0x10,%esp
+80107ff0:	85 c0                	test   %eax,%eax
+80107ff2:	78 67                	js     8010805b <create+0x15b>
+  iunlockput(dp);
+80107ff4:	83 ec 0c             	sub    $0xc,%esp
+80107ff7:	53                   	push   %ebx
+80107ff8:	e8 43 a4 ff ff       	call   80102440 <iunlockput>
+  return ip;
+80107ffd:	83 c4 10             	add    $0x10,%esp
+}
+80108000:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108003:	89 f0                	mov    %esi,%eax
+80108005:	5b                   	pop    %ebx
+80108006:	5e                   	pop    %esi
+80108007:	5f                   	pop    %edi
+80108008:	5d                   	pop    %ebp
+80108009:	c3                   	ret
+8010800a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iupdate(dp);
+80108010:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink++;  // for ".."
+80108013:	66 83 43 62 01       	addw   $0x1,0x62(%ebx)
+    iupdate(dp);
+80108018:	53                   	push   %ebx
+80108019:	e8 72 a0 ff ff       	call   80102090 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+8010801e:	83 c4 0c             	add    $0xc,%esp
+80108021:	ff 76 04             	push   0x4(%esi)
+80108024:	68 64 bc 10 80       	push   $0x8010bc64
+80108029:	56                   	push   %esi
+8010802a:	e8 11 ab ff ff       	call   80102b40 <dirlink>
+8010802f:	83 c4 10             	add    $0x10,%esp
+80108032:	85 c0                	test   %eax,%eax
+80108034:	78 18                	js     8010804e <create+0x14e>
+80108036:	83 ec 04             	sub    $0x4,%esp
+80108039:	ff 73 04             	push   0x4(%ebx)
+8010803c:	68 63 bc 10 80       	push   $0x8010bc63
+80108041:	56                   	push   %esi
+80108042:	e8 f9 aa ff ff       	call   80102b40 <dirlink>
+80108047:	83 c4 10             	add    $0x10,%esp
+8010804a:	85 c0                	test   %eax,%eax
+8010804c:	79 92                	jns    80107fe0 <create+0xe0>
+      panic("create dots");
+8010804e:	83 ec 0c             	sub    $0xc,%esp
+80108051:	68 57 bc 10 80       	push   $0x8010bc57
+80108056:	e8 65 8b ff ff       	call   80100bc0 <panic>
+    panic("create: dirlink");
+8010805b:	83 ec 0c             	sub    $0xc,%esp
+8010805e:	68 66 bc 10 80       	push   $0x8010bc66
+80108063:	e8 58 8b ff ff       	call   80100bc0 <panic>
+    panic("create: ialloc");
+80108068:	83 ec 0c             	sub    $0xc,%esp
+8010806b:	68 48 bc 10 80       	push   $0x8010bc48
+80108070:	e8 4b 8b ff ff       	call   80100bc0 <panic>
+80108075:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010807c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108080 <sys_dup>:
+{
+80108080:	55                   	push   %ebp
+80108081:	89 e5                	mov    %esp,%ebp
+80108083:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108084:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108087:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(n, &fd) < 0)
+8010808a:	50                   	push   %eax
+8010808b:	6a 00                	push   $0x0
+8010808d:	e8 1e fc ff ff       	call   80107cb0 <argint>
+80108092:	83 c4 10             	add    $0x10,%esp
+80108095:	85 c0                	test   %eax,%eax
+80108097:	78 2f                	js     801080c8 <sys_dup+0x48>
+  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+80108099:	8b 55 f4             	mov    -0xc(%ebp),%edx
+8010809c:	83 fa 0f             	cmp    $0xf,%edx
+8010809f:	77 27                	ja     801080c8 <sys_dup+0x48>
+801080a1:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+801080a7:	8b 54 90 6c          	mov    0x6c(%eax,%edx,4),%edx
+801080ab:	85 d2                	test   %edx,%edx
+801080ad:	74 19                	je     801080c8 <sys_dup+0x48>
+  for(fd = 0; fd < NOFILE; fd++){
+801080af:	31 db                	xor    %ebx,%ebx
+801080b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(proc->ofile[fd] == 0){
+801080b8:	8b 4c 98 6c          	mov    0x6c(%eax,%ebx,4),%ecx
+801080bc:	85 c9                	test   %ecx,%ecx
+801080be:	74 18                	je     801080d8 <sys_dup+0x58>
+  for(fd = 0; fd < NOFILE; fd++){
+801080c0:	83 c3 01             	add    $0x1,%ebx
+801080c3:	83 fb 10             	cmp    $0x10,%ebx
+801080c6:	75 f0                	jne    801080b8 <sys_dup+0x38>
+    return -1;
+801080c8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+801080cd:	89 d8                	mov    %ebx,%eax
+801080cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801080d2:	c9                   	leave
+801080d3:	c3                   	ret
+801080d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  filedup(f);
+801080d8:	83 ec 0c             	sub    $0xc,%esp
+      proc->ofile[fd] = f;
+801080db:	89 54 98 6c          	mov    %edx,0x6c(%eax,%ebx,4)
+  filedup(f);
+801080df:	52                   	push   %edx
+801080e0:	e8 1b 97 ff ff       	call   80101800 <filedup>
+}
+801080e5:	89 d8                	mov    %ebx,%eax
+  return fd;
+801080e7:	83 c4 10             	add    $0x10,%esp
+}
+801080ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801080ed:	c9                   	leave
+801080ee:	c3                   	ret
+801080ef:	90                   	nop
+
+801080f0 <sys_read>:
+{
+801080f0:	55                   	push   %ebp
+801080f1:	89 e5                	mov    %esp,%ebp
+801080f3:	56                   	push   %esi
+801080f4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+801080f5:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+801080f8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+801080fb:	53                   	push   %ebx
+801080fc:	6a 00                	push   $0x0
+801080fe:	e8 ad fb ff ff       	call   80107cb0 <argint>
+80108103:	83 c4 10             	add    $0x10,%esp
+80108106:	85 c0                	test   %eax,%eax
+80108108:	78 5e                	js     80108168 <sys_read+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+8010810a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010810d:	83 f8 0f             	cmp    $0xf,%eax
+80108110:	77 56                	ja     80108168 <sys_read+0x78>
+80108112:	65 8b 15 04 00 00 00 	mov    %gs:0x4,%edx
+80108119:	8b 74 82 6c          	mov    0x6c(%edx,%eax,4),%esi
+8010811d:	85 f6                	test   %esi,%esi
+8010811f:	74 47                	je     80108168 <sys_read+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptrw(1, &p, n) < 0)
+80108121:	83 ec 08             	sub    $0x8,%esp
+80108124:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108127:	50                   	push   %eax
+80108128:	6a 02                	push   $0x2
+8010812a:	e8 81 fb ff ff       	call   80107cb0 <argint>
+8010812f:	83 c4 10             	add    $0x10,%esp
+80108132:	85 c0                	test   %eax,%eax
+80108134:	78 32                	js     80108168 <sys_read+0x78>
+80108136:	83 ec 04             	sub    $0x4,%esp
+80108139:	ff 75 f0             	push   -0x10(%ebp)
+8010813c:	53                   	push   %ebx
+8010813d:	6a 01                	push   $0x1
+8010813f:	e8 ec fb ff ff       	call   80107d30 <argptrw>
+80108144:	83 c4 10             	add    $0x10,%esp
+80108147:	85 c0                	test   %eax,%eax
+80108149:	78 1d                	js     80108168 <sys_read+0x78>
+  return fileread(f, p, n);
+8010814b:	83 ec 04             	sub    $0x4,%esp
+8010814e:	ff 75 f0             	push   -0x10(%ebp)
+80108151:	ff 75 f4             	push   -0xc(%ebp)
+80108154:	56                   	push   %esi
+80108155:	e8 26 98 ff ff       	call   80101980 <fileread>
+8010815a:	83 c4 10             	add    $0x10,%esp
+}
+8010815d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108160:	5b                   	pop    %ebx
+80108161:	5e                   	pop    %esi
+80108162:	5d                   	pop    %ebp
+80108163:	c3                   	ret
+80108164:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80108168:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010816d:	eb ee                	jmp    8010815d <sys_read+0x6d>
+8010816f:	90                   	nop
+
+80108170 <sys_write>:
+{
+80108170:	55                   	push   %ebp
+80108171:	89 e5                	mov    %esp,%ebp
+80108173:	56                   	push   %esi
+80108174:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108175:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80108178:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010817b:	53                   	push   %ebx
+8010817c:	6a 00                	push   $0x0
+8010817e:	e8 2d fb ff ff       	call   80107cb0 <argint>
+80108183:	83 c4 10             	add    $0x10,%esp
+80108186:	85 c0                	test   %eax,%eax
+80108188:	78 5e                	js     801081e8 <sys_write+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+8010818a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010818d:	83 f8 0f             	cmp    $0xf,%eax
+80108190:	77 56                	ja     801081e8 <sys_write+0x78>
+80108192:	65 8b 15 04 00 00 00 	mov    %gs:0x4,%edx
+80108199:	8b 74 82 6c          	mov    0x6c(%edx,%eax,4),%esi
+8010819d:	85 f6                	test   %esi,%esi
+8010819f:	74 47                	je     801081e8 <sys_write+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+801081a1:	83 ec 08             	sub    $0x8,%esp
+801081a4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801081a7:	50                   	push   %eax
+801081a8:	6a 02                	push   $0x2
+801081aa:	e8 01 fb ff ff       	call   80107cb0 <argint>
+801081af:	83 c4 10             	add    $0x10,%esp
+801081b2:	85 c0                	test   %eax,%eax
+801081b4:	78 32                	js     801081e8 <sys_write+0x78>
+801081b6:	83 ec 04             	sub    $0x4,%esp
+801081b9:	ff 75 f0             	push   -0x10(%ebp)
+801081bc:	53                   	push   %ebx
+801081bd:	6a 01                	push   $0x1
+801081bf:	e8 4c fb ff ff       	call   80107d10 <argptr>
+801081c4:	83 c4 10             	add    $0x10,%esp
+801081c7:	85 c0                	test   %eax,%eax
+801081c9:	78 1d                	js     801081e8 <sys_write+0x78>
+  return filewrite(f, p, n);
+801081cb:	83 ec 04             	sub    $0x4,%esp
+801081ce:	ff 75 f0             	push   -0x10(%ebp)
+801081d1:	ff 75 f4             	push   -0xc(%ebp)
+801081d4:	56                   	push   %esi
+801081d5:	e8 36 98 ff ff       	call   80101a10 <filewrite>
+801081da:	83 c4 10             	add    $0x10,%esp
+}
+801081dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801081e0:	5b                   	pop    %ebx
+801081e1:	5e                   	pop    %esi
+801081e2:	5d                   	pop    %ebp
+801081e3:	c3                   	ret
+801081e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+801081e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801081ed:	eb ee                	jmp    801081dd <sys_write+0x6d>
+801081ef:	90                   	nop
+
+801081f0 <sys_close>:
+{
+801081f0:	55                   	push   %ebp
+801081f1:	89 e5                	mov    %esp,%ebp
+801081f3:	83 ec 20             	sub    $0x20,%esp
+  if(argint(n, &fd) < 0)
+801081f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801081f9:	50                   	push   %eax
+801081fa:	6a 00                	push   $0x0
+801081fc:	e8 af fa ff ff       	call   80107cb0 <argint>
+80108201:	83 c4 10             	add    $0x10,%esp
+80108204:	85 c0                	test   %eax,%eax
+80108206:	78 38                	js     80108240 <sys_close+0x50>
+  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+80108208:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010820b:	83 f8 0f             	cmp    $0xf,%eax
+8010820e:	77 30                	ja     80108240 <sys_close+0x50>
+80108210:	65 8b 0d 04 00 00 00 	mov    %gs:0x4,%ecx
+80108217:	83 c0 18             	add    $0x18,%eax
+8010821a:	8b 54 81 0c          	mov    0xc(%ecx,%eax,4),%edx
+8010821e:	85 d2                	test   %edx,%edx
+80108220:	74 1e                	je     80108240 <sys_close+0x50>
+  fileclose(f);
+80108222:	83 ec 0c             	sub    $0xc,%esp
+  proc->ofile[fd] = 0;
+80108225:	c7 44 81 0c 00 00 00 	movl   $0x0,0xc(%ecx,%eax,4)
+8010822c:	00 
+  fileclose(f);
+8010822d:	52                   	push   %edx
+8010822e:	e8 1d 96 ff ff       	call   80101850 <fileclose>
+  return 0;
+80108233:	83 c4 10             	add    $0x10,%esp
+80108236:	31 c0                	xor    %eax,%eax
+}
+80108238:	c9                   	leave
+80108239:	c3                   	ret
+8010823a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80108240:	c9                   	leave
+    return -1;
+80108241:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108246:	c3                   	ret
+80108247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010824e:	66 90                	xchg   %ax,%ax
+
+80108250 <sys_fstat>:
+{
+80108250:	55                   	push   %ebp
+80108251:	89 e5                	mov    %esp,%ebp
+80108253:	56                   	push   %esi
+80108254:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108255:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80108258:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010825b:	53                   	push   %ebx
+8010825c:	6a 00                	push   $0x0
+8010825e:	e8 4d fa ff ff       	call   80107cb0 <argint>
+80108263:	83 c4 10             	add    $0x10,%esp
+80108266:	85 c0                	test   %eax,%eax
+80108268:	78 46                	js     801082b0 <sys_fstat+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+8010826a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010826d:	83 f8 0f             	cmp    $0xf,%eax
+80108270:	77 3e                	ja     801082b0 <sys_fstat+0x60>
+80108272:	65 8b 15 04 00 00 00 	mov    %gs:0x4,%edx
+80108279:	8b 74 82 6c          	mov    0x6c(%edx,%eax,4),%esi
+8010827d:	85 f6                	test   %esi,%esi
+8010827f:	74 2f                	je     801082b0 <sys_fstat+0x60>
+  if(argfd(0, 0, &f) < 0 || argptrw(1, (void*)&st, sizeof(*st)) < 0)
+80108281:	83 ec 04             	sub    $0x4,%esp
+80108284:	6a 14                	push   $0x14
+80108286:	53                   	push   %ebx
+80108287:	6a 01                	push   $0x1
+80108289:	e8 a2 fa ff ff       	call   80107d30 <argptrw>
+8010828e:	83 c4 10             	add    $0x10,%esp
+80108291:	85 c0                	test   %eax,%eax
+80108293:	78 1b                	js     801082b0 <sys_fstat+0x60>
+  return filestat(f, st);
+80108295:	83 ec 08             	sub    $0x8,%esp
+80108298:	ff 75 f4             	push   -0xc(%ebp)
+8010829b:	56                   	push   %esi
+8010829c:	e8 8f 96 ff ff       	call   80101930 <filestat>
+801082a1:	83 c4 10             	add    $0x10,%esp
+}
+801082a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801082a7:	5b                   	pop    %ebx
+801082a8:	5e                   	pop    %esi
+801082a9:	5d                   	pop    %ebp
+801082aa:	c3                   	ret
+801082ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801082af:	90                   	nop
+    return -1;
+801082b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801082b5:	eb ed                	jmp    801082a4 <sys_fstat+0x54>
+801082b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801082be:	66 90                	xchg   %ax,%ax
+
+801082c0 <sys_link>:
+{
+801082c0:	55                   	push   %ebp
+801082c1:	89 e5                	mov    %esp,%ebp
+801082c3:	57                   	push   %edi
+801082c4:	56                   	push   %esi
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+801082c5:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+801082c8:	53                   	push   %ebx
+801082c9:	83 ec 34             	sub    $0x34,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+801082cc:	50                   	push   %eax
+801082cd:	6a 00                	push   $0x0
+801082cf:	e8 7c fa ff ff       	call   80107d50 <argstr>
+801082d4:	83 c4 10             	add    $0x10,%esp
+801082d7:	85 c0                	test   %eax,%eax
+801082d9:	0f 88 fb 00 00 00    	js     801083da <sys_link+0x11a>
+801082df:	83 ec 08             	sub    $0x8,%esp
+801082e2:	8d 45 d0             	lea    -0x30(%ebp),%eax
+801082e5:	50                   	push   %eax
+801082e6:	6a 01                	push   $0x1
+801082e8:	e8 63 fa ff ff       	call   80107d50 <argstr>
+801082ed:	83 c4 10             	add    $0x10,%esp
+801082f0:	85 c0                	test   %eax,%eax
+801082f2:	0f 88 e2 00 00 00    	js     801083da <sys_link+0x11a>
+  begin_op();
+801082f8:	e8 a3 c4 ff ff       	call   801047a0 <begin_op>
+  if((ip = namei(old)) == 0){
+801082fd:	83 ec 0c             	sub    $0xc,%esp
+80108300:	ff 75 d4             	push   -0x2c(%ebp)
+80108303:	e8 f8 a8 ff ff       	call   80102c00 <namei>
+80108308:	83 c4 10             	add    $0x10,%esp
+8010830b:	89 c3                	mov    %eax,%ebx
+8010830d:	85 c0                	test   %eax,%eax
+8010830f:	0f 84 df 00 00 00    	je     801083f4 <sys_link+0x134>
+  ilock(ip);
+80108315:	83 ec 0c             	sub    $0xc,%esp
+80108318:	50                   	push   %eax
+80108319:	e8 a2 9e ff ff       	call   801021c0 <ilock>
+  if(ip->type == T_DIR){
+8010831e:	83 c4 10             	add    $0x10,%esp
+80108321:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+80108326:	0f 84 b5 00 00 00    	je     801083e1 <sys_link+0x121>
+  iupdate(ip);
+8010832c:	83 ec 0c             	sub    $0xc,%esp
+  ip->nlink++;
+8010832f:	66 83 43 62 01       	addw   $0x1,0x62(%ebx)
+  if((dp = nameiparent(new, name)) == 0)
+80108334:	8d 7d da             	lea    -0x26(%ebp),%edi
+  iupdate(ip);
+80108337:	53                   	push   %ebx
+80108338:	e8 53 9d ff ff       	call   80102090 <iupdate>
+  iunlock(ip);
+8010833d:	89 1c 24             	mov    %ebx,(%esp)
+80108340:	e8 4b 9f ff ff       	call   80102290 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80108345:	58                   	pop    %eax
+80108346:	5a                   	pop    %edx
+80108347:	57                   	push   %edi
+80108348:	ff 75 d0             	push   -0x30(%ebp)
+8010834b:	e8 d0 a8 ff ff       	call   80102c20 <nameiparent>
+80108350:	83 c4 10             	add    $0x10,%esp
+80108353:	89 c6                	mov    %eax,%esi
+80108355:	85 c0                	test   %eax,%eax
+80108357:	74 5b                	je     801083b4 <sys_link+0xf4>
+  ilock(dp);
+80108359:	83 ec 0c             	sub    $0xc,%esp
+8010835c:	50                   	push   %eax
+8010835d:	e8 5e 9e ff ff       	call   801021c0 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80108362:	8b 03                	mov    (%ebx),%eax
+80108364:	83 c4 10             	add    $0x10,%esp
+80108367:	39 06                	cmp    %eax,(%esi)
+80108369:	75 3d                	jne    801083a8 <sys_link+0xe8>
+8010836b:	83 ec 04             	sub    $0x4,%esp
+8010836e:	ff 73 04             	push   0x4(%ebx)
+80108371:	57                   	push   %edi
+80108372:	56                   	push   %esi
+80108373:	e8 c8 a7 ff ff       	call   80102b40 <dirlink>
+80108378:	83 c4 10             	add    $0x10,%esp
+8010837b:	85 c0                	test   %eax,%eax
+8010837d:	78 29                	js     801083a8 <sys_link+0xe8>
+  iunlockput(dp);
+8010837f:	83 ec 0c             	sub    $0xc,%esp
+80108382:	56                   	push   %esi
+80108383:	e8 b8 a0 ff ff       	call   80102440 <iunlockput>
+  iput(ip);
+80108388:	89 1c 24             	mov    %ebx,(%esp)
+8010838b:	e8 50 9f ff ff       	call   801022e0 <iput>
+  end_op();
+80108390:	e8 bb c4 ff ff       	call   80104850 <end_op>
+  return 0;
+80108395:	83 c4 10             	add    $0x10,%esp
+80108398:	31 c0                	xor    %eax,%eax
+}
+8010839a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010839d:	5b                   	pop    %ebx
+8010839e:	5e                   	pop    %esi
+8010839f:	5f                   	pop    %edi
+801083a0:	5d                   	pop    %ebp
+801083a1:	c3                   	ret
+801083a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(dp);
+801083a8:	83 ec 0c             	sub    $0xc,%esp
+801083ab:	56                   	push   %esi
+801083ac:	e8 8f a0 ff ff       	call   80102440 <iunlockput>
+    goto bad;
+801083b1:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+801083b4:	83 ec 0c             	sub    $0xc,%esp
+801083b7:	53                   	push   %ebx
+801083b8:	e8 03 9e ff ff       	call   801021c0 <ilock>
+  ip->nlink--;
+801083bd:	66 83 6b 62 01       	subw   $0x1,0x62(%ebx)
+  iupdate(ip);
+801083c2:	89 1c 24             	mov    %ebx,(%esp)
+801083c5:	e8 c6 9c ff ff       	call   80102090 <iupdate>
+  iunlockput(ip);
+801083ca:	89 1c 24             	mov    %ebx,(%esp)
+801083cd:	e8 6e a0 ff ff       	call   80102440 <iunlockput>
+  end_op();
+801083d2:	e8 79 c4 ff ff       	call   80104850 <end_op>
+  return -1;
+801083d7:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801083da:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801083df:	eb b9                	jmp    8010839a <sys_link+0xda>
+    iunlockput(ip);
+801083e1:	83 ec 0c             	sub    $0xc,%esp
+801083e4:	53                   	push   %ebx
+801083e5:	e8 56 a0 ff ff       	call   80102440 <iunlockput>
+    end_op();
+801083ea:	e8 61 c4 ff ff       	call   80104850 <end_op>
+    return -1;
+801083ef:	83 c4 10             	add    $0x10,%esp
+801083f2:	eb e6                	jmp    801083da <sys_link+0x11a>
+    end_op();
+801083f4:	e8 57 c4 ff ff       	call   80104850 <end_op>
+    return -1;
+801083f9:	eb df                	jmp    801083da <sys_link+0x11a>
+801083fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801083ff:	90                   	nop
+
+80108400 <sys_unlink>:
+{
+80108400:	55                   	push   %ebp
+80108401:	89 e5                	mov    %esp,%ebp
+80108403:	57                   	push   %edi
+80108404:	56                   	push   %esi
+  if(argstr(0, &path) < 0)
+80108405:	8d 45 c0             	lea    -0x40(%ebp),%eax
+{
+80108408:	53                   	push   %ebx
+80108409:	83 ec 54             	sub    $0x54,%esp
+  if(argstr(0, &path) < 0)
+8010840c:	50                   	push   %eax
+8010840d:	6a 00                	push   $0x0
+8010840f:	e8 3c f9 ff ff       	call   80107d50 <argstr>
+80108414:	83 c4 10             	add    $0x10,%esp
+80108417:	85 c0                	test   %eax,%eax
+80108419:	0f 88 54 01 00 00    	js     80108573 <sys_unlink+0x173>
+  begin_op();
+8010841f:	e8 7c c3 ff ff       	call   801047a0 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+80108424:	8d 5d ca             	lea    -0x36(%ebp),%ebx
+80108427:	83 ec 08             	sub    $0x8,%esp
+8010842a:	53                   	push   %ebx
+8010842b:	ff 75 c0             	push   -0x40(%ebp)
+8010842e:	e8 ed a7 ff ff       	call   80102c20 <nameiparent>
+80108433:	83 c4 10             	add    $0x10,%esp
+80108436:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+80108439:	85 c0                	test   %eax,%eax
+8010843b:	0f 84 58 01 00 00    	je     80108599 <sys_unlink+0x199>
+  ilock(dp);
+80108441:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+80108444:	83 ec 0c             	sub    $0xc,%esp
+80108447:	57                   	push   %edi
+80108448:	e8 73 9d ff ff       	call   801021c0 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+8010844d:	58                   	pop    %eax
+8010844e:	5a                   	pop    %edx
+8010844f:	68 64 bc 10 80       	push   $0x8010bc64
+80108454:	53                   	push   %ebx
+80108455:	e8 a6 a3 ff ff       	call   80102800 <namecmp>
+8010845a:	83 c4 10             	add    $0x10,%esp
+8010845d:	85 c0                	test   %eax,%eax
+8010845f:	0f 84 fb 00 00 00    	je     80108560 <sys_unlink+0x160>
+80108465:	83 ec 08             	sub    $0x8,%esp
+80108468:	68 63 bc 10 80       	push   $0x8010bc63
+8010846d:	53                   	push   %ebx
+8010846e:	e8 8d a3 ff ff       	call   80102800 <namecmp>
+80108473:	83 c4 10             	add    $0x10,%esp
+80108476:	85 c0                	test   %eax,%eax
+80108478:	0f 84 e2 00 00 00    	je     80108560 <sys_unlink+0x160>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+8010847e:	83 ec 04             	sub    $0x4,%esp
+80108481:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+80108484:	50                   	push   %eax
+80108485:	53                   	push   %ebx
+80108486:	57                   	push   %edi
+80108487:	e8 94 a3 ff ff       	call   80102820 <dirlookup>
+8010848c:	83 c4 10             	add    $0x10,%esp
+8010848f:	89 c3                	mov    %eax,%ebx
+80108491:	85 c0                	test   %eax,%eax
+80108493:	0f 84 c7 00 00 00    	je     80108560 <sys_unlink+0x160>
+  ilock(ip);
+80108499:	83 ec 0c             	sub    $0xc,%esp
+8010849c:	50                   	push   %eax
+8010849d:	e8 1e 9d ff ff       	call   801021c0 <ilock>
+  if(ip->nlink < 1)
+801084a2:	83 c4 10             	add    $0x10,%esp
+801084a5:	66 83 7b 62 00       	cmpw   $0x0,0x62(%ebx)
+801084aa:	0f 8e 0a 01 00 00    	jle    801085ba <sys_unlink+0x1ba>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+801084b0:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+801084b5:	8d 7d d8             	lea    -0x28(%ebp),%edi
+801084b8:	74 66                	je     80108520 <sys_unlink+0x120>
+  memset(&de, 0, sizeof(de));
+801084ba:	83 ec 04             	sub    $0x4,%esp
+801084bd:	6a 10                	push   $0x10
+801084bf:	6a 00                	push   $0x0
+801084c1:	57                   	push   %edi
+801084c2:	e8 79 ed ff ff       	call   80107240 <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801084c7:	6a 10                	push   $0x10
+801084c9:	ff 75 c4             	push   -0x3c(%ebp)
+801084cc:	57                   	push   %edi
+801084cd:	ff 75 b4             	push   -0x4c(%ebp)
+801084d0:	e8 cb a1 ff ff       	call   801026a0 <writei>
+801084d5:	83 c4 20             	add    $0x20,%esp
+801084d8:	83 f8 10             	cmp    $0x10,%eax
+801084db:	0f 85 cc 00 00 00    	jne    801085ad <sys_unlink+0x1ad>
+  if(ip->type == T_DIR){
+801084e1:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+801084e6:	0f 84 94 00 00 00    	je     80108580 <sys_unlink+0x180>
+  iunlockput(dp);
+801084ec:	83 ec 0c             	sub    $0xc,%esp
+801084ef:	ff 75 b4             	push   -0x4c(%ebp)
+801084f2:	e8 49 9f ff ff       	call   80102440 <iunlockput>
+  ip->nlink--;
+801084f7:	66 83 6b 62 01       	subw   $0x1,0x62(%ebx)
+  iupdate(ip);
+801084fc:	89 1c 24             	mov    %ebx,(%esp)
+801084ff:	e8 8c 9b ff ff       	call   80102090 <iupdate>
+  iunlockput(ip);
+80108504:	89 1c 24             	mov    %ebx,(%esp)
+80108507:	e8 34 9f ff ff       	call   80102440 <iunlockput>
+  end_op();
+8010850c:	e8 3f c3 ff ff       	call   80104850 <end_op>
+  return 0;
+80108511:	83 c4 10             	add    $0x10,%esp
+80108514:	31 c0                	xor    %eax,%eax
+}
+80108516:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108519:	5b                   	pop    %ebx
+8010851a:	5e                   	pop    %esi
+8010851b:	5f                   	pop    %edi
+8010851c:	5d                   	pop    %ebp
+8010851d:	c3                   	ret
+8010851e:	66 90                	xchg   %ax,%ax
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80108520:	83 7b 64 20          	cmpl   $0x20,0x64(%ebx)
+80108524:	76 94                	jbe    801084ba <sys_unlink+0xba>
+80108526:	be 20 00 00 00       	mov    $0x20,%esi
+8010852b:	eb 0b                	jmp    80108538 <sys_unlink+0x138>
+8010852d:	8d 76 00             	lea    0x0(%esi),%esi
+80108530:	83 c6 10             	add    $0x10,%esi
+80108533:	3b 73 64             	cmp    0x64(%ebx),%esi
+80108536:	73 82                	jae    801084ba <sys_unlink+0xba>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108538:	6a 10                	push   $0x10
+8010853a:	56                   	push   %esi
+8010853b:	57                   	push   %edi
+8010853c:	53                   	push   %ebx
+8010853d:	e8 9e 9f ff ff       	call   801024e0 <readi>
+80108542:	83 c4 10             	add    $0x10,%esp
+80108545:	83 f8 10             	cmp    $0x10,%eax
+80108548:	75 56                	jne    801085a0 <sys_unlink+0x1a0>
+    if(de.inum != 0)
+8010854a:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010854f:	74 df                	je     80108530 <sys_unlink+0x130>
+    iunlockput(ip);
+80108551:	83 ec 0c             	sub    $0xc,%esp
+80108554:	53                   	push   %ebx
+80108555:	e8 e6 9e ff ff       	call   80102440 <iunlockput>
+    goto bad;
+8010855a:	83 c4 10             	add    $0x10,%esp
+8010855d:	8d 76 00             	lea    0x0(%esi),%esi
+  iunlockput(dp);
+80108560:	83 ec 0c             	sub    $0xc,%esp
+80108563:	ff 75 b4             	push   -0x4c(%ebp)
+80108566:	e8 d5 9e ff ff       	call   80102440 <iunlockput>
+  end_op();
+8010856b:	e8 e0 c2 ff ff       	call   80104850 <end_op>
+  return -1;
+80108570:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108573:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108578:	eb 9c                	jmp    80108516 <sys_unlink+0x116>
+8010857a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    dp->nlink--;
+80108580:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    iupdate(dp);
+80108583:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink--;
+80108586:	66 83 68 62 01       	subw   $0x1,0x62(%eax)
+    iupdate(dp);
+8010858b:	50                   	push   %eax
+8010858c:	e8 ff 9a ff ff       	call   80102090 <iupdate>
+80108591:	83 c4 10             	add    $0x10,%esp
+80108594:	e9 53 ff ff ff       	jmp    801084ec <sys_unlink+0xec>
+    end_op();
+80108599:	e8 b2 c2 ff ff       	call   80104850 <end_op>
+    return -1;
+8010859e:	eb d3                	jmp    80108573 <sys_unlink+0x173>
+      panic("isdirempty: readi");
+801085a0:	83 ec 0c             	sub    $0xc,%esp
+801085a3:	68 88 bc 10 80       	push   $0x8010bc88
+801085a8:	e8 13 86 ff ff       	call   80100bc0 <panic>
+    panic("unlink: writei");
+801085ad:	83 ec 0c             	sub    $0xc,%esp
+801085b0:	68 9a bc 10 80       	push   $0x8010bc9a
+801085b5:	e8 06 86 ff ff       	call   80100bc0 <panic>
+    panic("unlink: nlink < 1");
+801085ba:	83 ec 0c             	sub    $0xc,%esp
+801085bd:	68 76 bc 10 80       	push   $0x8010bc76
+801085c2:	e8 f9 85 ff ff       	call   80100bc0 <panic>
+801085c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801085ce:	66 90                	xchg   %ax,%ax
+
+801085d0 <sys_open>:
+
+int
+sys_open(void)
+{
+801085d0:	55                   	push   %ebp
+801085d1:	89 e5                	mov    %esp,%ebp
+801085d3:	57                   	push   %edi
+801085d4:	56                   	push   %esi
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801085d5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+801085d8:	53                   	push   %ebx
+801085d9:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801085dc:	50                   	push   %eax
+801085dd:	6a 00                	push   $0x0
+801085df:	e8 6c f7 ff ff       	call   80107d50 <argstr>
+801085e4:	83 c4 10             	add    $0x10,%esp
+801085e7:	85 c0                	test   %eax,%eax
+801085e9:	0f 88 96 00 00 00    	js     80108685 <sys_open+0xb5>
+801085ef:	83 ec 08             	sub    $0x8,%esp
+801085f2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801085f5:	50                   	push   %eax
+801085f6:	6a 01                	push   $0x1
+801085f8:	e8 b3 f6 ff ff       	call   80107cb0 <argint>
+801085fd:	83 c4 10             	add    $0x10,%esp
+80108600:	85 c0                	test   %eax,%eax
+80108602:	0f 88 7d 00 00 00    	js     80108685 <sys_open+0xb5>
+    return -1;
+
+  begin_op();
+80108608:	e8 93 c1 ff ff       	call   801047a0 <begin_op>
+
+  if(omode & O_CREATE){
+8010860d:	f6 45 e5 02          	testb  $0x2,-0x1b(%ebp)
+80108611:	75 7d                	jne    80108690 <sys_open+0xc0>
+    if(ip == 0){
+      end_op();
+      return -1;
+    }
+  } else {
+    if((ip = namei(path)) == 0){
+80108613:	83 ec 0c             	sub    $0xc,%esp
+80108616:	ff 75 e0             	push   -0x20(%ebp)
+80108619:	e8 e2 a5 ff ff       	call   80102c00 <namei>
+8010861e:	83 c4 10             	add    $0x10,%esp
+80108621:	89 c6                	mov    %eax,%esi
+80108623:	85 c0                	test   %eax,%eax
+80108625:	0f 84 82 00 00 00    	je     801086ad <sys_open+0xdd>
+      end_op();
+      return -1;
+    }
+    ilock(ip);
+8010862b:	83 ec 0c             	sub    $0xc,%esp
+8010862e:	50                   	push   %eax
+8010862f:	e8 8c 9b ff ff       	call   801021c0 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80108634:	83 c4 10             	add    $0x10,%esp
+80108637:	66 83 7e 5c 01       	cmpw   $0x1,0x5c(%esi)
+8010863c:	0f 84 be 00 00 00    	je     80108700 <sys_open+0x130>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+80108642:	e8 49 91 ff ff       	call   80101790 <filealloc>
+80108647:	89 c7                	mov    %eax,%edi
+80108649:	85 c0                	test   %eax,%eax
+8010864b:	74 27                	je     80108674 <sys_open+0xa4>
+    if(proc->ofile[fd] == 0){
+8010864d:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  for(fd = 0; fd < NOFILE; fd++){
+80108653:	31 db                	xor    %ebx,%ebx
+80108655:	8d 76 00             	lea    0x0(%esi),%esi
+    if(proc->ofile[fd] == 0){
+80108658:	8b 54 98 6c          	mov    0x6c(%eax,%ebx,4),%edx
+8010865c:	85 d2                	test   %edx,%edx
+8010865e:	74 58                	je     801086b8 <sys_open+0xe8>
+  for(fd = 0; fd < NOFILE; fd++){
+80108660:	83 c3 01             	add    $0x1,%ebx
+80108663:	83 fb 10             	cmp    $0x10,%ebx
+80108666:	75 f0                	jne    80108658 <sys_open+0x88>
+    if(f)
+      fileclose(f);
+80108668:	83 ec 0c             	sub    $0xc,%esp
+8010866b:	57                   	push   %edi
+8010866c:	e8 df 91 ff ff       	call   80101850 <fileclose>
+80108671:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80108674:	83 ec 0c             	sub    $0xc,%esp
+80108677:	56                   	push   %esi
+80108678:	e8 c3 9d ff ff       	call   80102440 <iunlockput>
+    end_op();
+8010867d:	e8 ce c1 ff ff       	call   80104850 <end_op>
+    return -1;
+80108682:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108685:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010868a:	eb 65                	jmp    801086f1 <sys_open+0x121>
+8010868c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    ip = create(path, T_FILE, 0, 0);
+80108690:	83 ec 0c             	sub    $0xc,%esp
+80108693:	31 c9                	xor    %ecx,%ecx
+80108695:	ba 02 00 00 00       	mov    $0x2,%edx
+8010869a:	6a 00                	push   $0x0
+8010869c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010869f:	e8 5c f8 ff ff       	call   80107f00 <create>
+    if(ip == 0){
+801086a4:	83 c4 10             	add    $0x10,%esp
+    ip = create(path, T_FILE, 0, 0);
+801086a7:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+801086a9:	85 c0                	test   %eax,%eax
+801086ab:	75 95                	jne    80108642 <sys_open+0x72>
+      end_op();
+801086ad:	e8 9e c1 ff ff       	call   80104850 <end_op>
+      return -1;
+801086b2:	eb d1                	jmp    80108685 <sys_open+0xb5>
+801086b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  }
+  iunlock(ip);
+801086b8:	83 ec 0c             	sub    $0xc,%esp
+      proc->ofile[fd] = f;
+801086bb:	89 7c 98 6c          	mov    %edi,0x6c(%eax,%ebx,4)
+  iunlock(ip);
+801086bf:	56                   	push   %esi
+801086c0:	e8 cb 9b ff ff       	call   80102290 <iunlock>
+  end_op();
+801086c5:	e8 86 c1 ff ff       	call   80104850 <end_op>
+
+  f->type = FD_INODE;
+801086ca:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  f->ip = ip;
+  f->off = 0;
+  f->readable = !(omode & O_WRONLY);
+801086d0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801086d3:	83 c4 10             	add    $0x10,%esp
+  f->ip = ip;
+801086d6:	89 77 10             	mov    %esi,0x10(%edi)
+  f->readable = !(omode & O_WRONLY);
+801086d9:	89 d0                	mov    %edx,%eax
+  f->off = 0;
+801086db:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+  f->readable = !(omode & O_WRONLY);
+801086e2:	f7 d0                	not    %eax
+801086e4:	83 e0 01             	and    $0x1,%eax
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801086e7:	83 e2 03             	and    $0x3,%edx
+  f->readable = !(omode & O_WRONLY);
+801086ea:	88 47 08             	mov    %al,0x8(%edi)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801086ed:	0f 95 47 09          	setne  0x9(%edi)
+  return fd;
+}
+801086f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801086f4:	89 d8                	mov    %ebx,%eax
+801086f6:	5b                   	pop    %ebx
+801086f7:	5e                   	pop    %esi
+801086f8:	5f                   	pop    %edi
+801086f9:	5d                   	pop    %ebp
+801086fa:	c3                   	ret
+801086fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801086ff:	90                   	nop
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80108700:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80108703:	85 c9                	test   %ecx,%ecx
+80108705:	0f 84 37 ff ff ff    	je     80108642 <sys_open+0x72>
+8010870b:	e9 64 ff ff ff       	jmp    80108674 <sys_open+0xa4>
+
+80108710 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+80108710:	55                   	push   %ebp
+80108711:	89 e5                	mov    %esp,%ebp
+80108713:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+80108716:	e8 85 c0 ff ff       	call   801047a0 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+8010871b:	83 ec 08             	sub    $0x8,%esp
+8010871e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108721:	50                   	push   %eax
+80108722:	6a 00                	push   $0x0
+80108724:	e8 27 f6 ff ff       	call   80107d50 <argstr>
+80108729:	83 c4 10             	add    $0x10,%esp
+8010872c:	85 c0                	test   %eax,%eax
+8010872e:	78 30                	js     80108760 <sys_mkdir+0x50>
+80108730:	83 ec 0c             	sub    $0xc,%esp
+80108733:	31 c9                	xor    %ecx,%ecx
+80108735:	ba 01 00 00 00       	mov    $0x1,%edx
+8010873a:	6a 00                	push   $0x0
+8010873c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010873f:	e8 bc f7 ff ff       	call   80107f00 <create>
+80108744:	83 c4 10             	add    $0x10,%esp
+80108747:	85 c0                	test   %eax,%eax
+80108749:	74 15                	je     80108760 <sys_mkdir+0x50>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+8010874b:	83 ec 0c             	sub    $0xc,%esp
+8010874e:	50                   	push   %eax
+8010874f:	e8 ec 9c ff ff       	call   80102440 <iunlockput>
+  end_op();
+80108754:	e8 f7 c0 ff ff       	call   80104850 <end_op>
+  return 0;
+80108759:	83 c4 10             	add    $0x10,%esp
+8010875c:	31 c0                	xor    %eax,%eax
+}
+8010875e:	c9                   	leave
+8010875f:	c3                   	ret
+    end_op();
+80108760:	e8 eb c0 ff ff       	call   80104850 <end_op>
+    return -1;
+80108765:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010876a:	c9                   	leave
+8010876b:	c3                   	ret
+8010876c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108770 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+80108770:	55                   	push   %ebp
+80108771:	89 e5                	mov    %esp,%ebp
+80108773:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+80108776:	e8 25 c0 ff ff       	call   801047a0 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+8010877b:	83 ec 08             	sub    $0x8,%esp
+8010877e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108781:	50                   	push   %eax
+80108782:	6a 00                	push   $0x0
+80108784:	e8 c7 f5 ff ff       	call   80107d50 <argstr>
+80108789:	83 c4 10             	add    $0x10,%esp
+8010878c:	85 c0                	test   %eax,%eax
+8010878e:	78 60                	js     801087f0 <sys_mknod+0x80>
+     argint(1, &major) < 0 ||
+80108790:	83 ec 08             	sub    $0x8,%esp
+80108793:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108796:	50                   	push   %eax
+80108797:	6a 01                	push   $0x1
+80108799:	e8 12 f5 ff ff       	call   80107cb0 <argint>
+  if((argstr(0, &path)) < 0 ||
+8010879e:	83 c4 10             	add    $0x10,%esp
+801087a1:	85 c0                	test   %eax,%eax
+801087a3:	78 4b                	js     801087f0 <sys_mknod+0x80>
+     argint(2, &minor) < 0 ||
+801087a5:	83 ec 08             	sub    $0x8,%esp
+801087a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801087ab:	50                   	push   %eax
+801087ac:	6a 02                	push   $0x2
+801087ae:	e8 fd f4 ff ff       	call   80107cb0 <argint>
+     argint(1, &major) < 0 ||
+801087b3:	83 c4 10             	add    $0x10,%esp
+801087b6:	85 c0                	test   %eax,%eax
+801087b8:	78 36                	js     801087f0 <sys_mknod+0x80>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+801087ba:	0f bf 45 f4          	movswl -0xc(%ebp),%eax
+801087be:	83 ec 0c             	sub    $0xc,%esp
+801087c1:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+801087c5:	ba 03 00 00 00       	mov    $0x3,%edx
+801087ca:	50                   	push   %eax
+801087cb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+801087ce:	e8 2d f7 ff ff       	call   80107f00 <create>
+     argint(2, &minor) < 0 ||
+801087d3:	83 c4 10             	add    $0x10,%esp
+801087d6:	85 c0                	test   %eax,%eax
+801087d8:	74 16                	je     801087f0 <sys_mknod+0x80>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+801087da:	83 ec 0c             	sub    $0xc,%esp
+801087dd:	50                   	push   %eax
+801087de:	e8 5d 9c ff ff       	call   80102440 <iunlockput>
+  end_op();
+801087e3:	e8 68 c0 ff ff       	call   80104850 <end_op>
+  return 0;
+801087e8:	83 c4 10             	add    $0x10,%esp
+801087eb:	31 c0                	xor    %eax,%eax
+}
+801087ed:	c9                   	leave
+801087ee:	c3                   	ret
+801087ef:	90                   	nop
+    end_op();
+801087f0:	e8 5b c0 ff ff       	call   80104850 <end_op>
+    return -1;
+801087f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801087fa:	c9                   	leave
+801087fb:	c3                   	ret
+801087fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108800 <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+80108800:	55                   	push   %ebp
+80108801:	89 e5                	mov    %esp,%ebp
+80108803:	53                   	push   %ebx
+80108804:	83 ec 14             	sub    $0x14,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+80108807:	e8 94 bf ff ff       	call   801047a0 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+8010880c:	83 ec 08             	sub    $0x8,%esp
+8010880f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108812:	50                   	push   %eax
+80108813:	6a 00                	push   $0x0
+80108815:	e8 36 f5 ff ff       	call   80107d50 <argstr>
+8010881a:	83 c4 10             	add    $0x10,%esp
+8010881d:	85 c0                	test   %eax,%eax
+8010881f:	78 7f                	js     801088a0 <sys_chdir+0xa0>
+80108821:	83 ec 0c             	sub    $0xc,%esp
+80108824:	ff 75 f4             	push   -0xc(%ebp)
+80108827:	e8 d4 a3 ff ff       	call   80102c00 <namei>
+8010882c:	83 c4 10             	add    $0x10,%esp
+8010882f:	89 c3                	mov    %eax,%ebx
+80108831:	85 c0                	test   %eax,%eax
+80108833:	74 6b                	je     801088a0 <sys_chdir+0xa0>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+80108835:	83 ec 0c             	sub    $0xc,%esp
+80108838:	50                   	push   %eax
+80108839:	e8 82 99 ff ff       	call   801021c0 <ilock>
+  if(ip->type != T_DIR){
+8010883e:	83 c4 10             	add    $0x10,%esp
+80108841:	66 83 7b 5c 01       	cmpw   $0x1,0x5c(%ebx)
+80108846:	75 38                	jne    80108880 <sys_chdir+0x80>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80108848:	83 ec 0c             	sub    $0xc,%esp
+8010884b:	53                   	push   %ebx
+8010884c:	e8 3f 9a ff ff       	call   80102290 <iunlock>
+  iput(proc->cwd);
+80108851:	58                   	pop    %eax
+80108852:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80108858:	ff b0 ac 00 00 00    	push   0xac(%eax)
+8010885e:	e8 7d 9a ff ff       	call   801022e0 <iput>
+  end_op();
+80108863:	e8 e8 bf ff ff       	call   80104850 <end_op>
+  proc->cwd = ip;
+80108868:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  return 0;
+8010886e:	83 c4 10             	add    $0x10,%esp
+  proc->cwd = ip;
+80108871:	89 98 ac 00 00 00    	mov    %ebx,0xac(%eax)
+  return 0;
+80108877:	31 c0                	xor    %eax,%eax
+}
+80108879:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010887c:	c9                   	leave
+8010887d:	c3                   	ret
+8010887e:	66 90                	xchg   %ax,%ax
+    iunlockput(ip);
+80108880:	83 ec 0c             	sub    $0xc,%esp
+80108883:	53                   	push   %ebx
+80108884:	e8 b7 9b ff ff       	call   80102440 <iunlockput>
+    end_op();
+80108889:	e8 c2 bf ff ff       	call   80104850 <end_op>
+    return -1;
+8010888e:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108891:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108896:	eb e1                	jmp    80108879 <sys_chdir+0x79>
+80108898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010889f:	90                   	nop
+    end_op();
+801088a0:	e8 ab bf ff ff       	call   80104850 <end_op>
+    return -1;
+801088a5:	eb ea                	jmp    80108891 <sys_chdir+0x91>
+801088a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801088ae:	66 90                	xchg   %ax,%ax
+
+801088b0 <sys_exec>:
+
+int
+sys_exec(void)
+{
+801088b0:	55                   	push   %ebp
+801088b1:	89 e5                	mov    %esp,%ebp
+801088b3:	57                   	push   %edi
+801088b4:	56                   	push   %esi
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+801088b5:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+{
+801088bb:	53                   	push   %ebx
+801088bc:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+801088c2:	50                   	push   %eax
+801088c3:	6a 00                	push   $0x0
+801088c5:	e8 86 f4 ff ff       	call   80107d50 <argstr>
+801088ca:	83 c4 10             	add    $0x10,%esp
+801088cd:	85 c0                	test   %eax,%eax
+801088cf:	0f 88 87 00 00 00    	js     8010895c <sys_exec+0xac>
+801088d5:	83 ec 08             	sub    $0x8,%esp
+801088d8:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+801088de:	50                   	push   %eax
+801088df:	6a 01                	push   $0x1
+801088e1:	e8 ca f3 ff ff       	call   80107cb0 <argint>
+801088e6:	83 c4 10             	add    $0x10,%esp
+801088e9:	85 c0                	test   %eax,%eax
+801088eb:	78 6f                	js     8010895c <sys_exec+0xac>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+801088ed:	83 ec 04             	sub    $0x4,%esp
+801088f0:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  for(i=0;; i++){
+801088f6:	31 db                	xor    %ebx,%ebx
+  memset(argv, 0, sizeof(argv));
+801088f8:	68 80 00 00 00       	push   $0x80
+801088fd:	6a 00                	push   $0x0
+801088ff:	56                   	push   %esi
+80108900:	e8 3b e9 ff ff       	call   80107240 <memset>
+80108905:	83 c4 10             	add    $0x10,%esp
+80108908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010890f:	90                   	nop
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80108910:	83 ec 08             	sub    $0x8,%esp
+80108913:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+80108919:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+80108920:	50                   	push   %eax
+80108921:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+80108927:	01 f8                	add    %edi,%eax
+80108929:	50                   	push   %eax
+8010892a:	e8 b1 f2 ff ff       	call   80107be0 <fetchint>
+8010892f:	83 c4 10             	add    $0x10,%esp
+80108932:	85 c0                	test   %eax,%eax
+80108934:	78 26                	js     8010895c <sys_exec+0xac>
+      return -1;
+    if(uarg == 0){
+80108936:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+8010893c:	85 c0                	test   %eax,%eax
+8010893e:	74 30                	je     80108970 <sys_exec+0xc0>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80108940:	83 ec 08             	sub    $0x8,%esp
+80108943:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80108946:	52                   	push   %edx
+80108947:	50                   	push   %eax
+80108948:	e8 e3 f2 ff ff       	call   80107c30 <fetchstr>
+8010894d:	83 c4 10             	add    $0x10,%esp
+80108950:	85 c0                	test   %eax,%eax
+80108952:	78 08                	js     8010895c <sys_exec+0xac>
+  for(i=0;; i++){
+80108954:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+80108957:	83 fb 20             	cmp    $0x20,%ebx
+8010895a:	75 b4                	jne    80108910 <sys_exec+0x60>
+      return -1;
+  }
+  return exec(path, argv);
+}
+8010895c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010895f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108964:	5b                   	pop    %ebx
+80108965:	5e                   	pop    %esi
+80108966:	5f                   	pop    %edi
+80108967:	5d                   	pop    %ebp
+80108968:	c3                   	ret
+80108969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      argv[i] = 0;
+80108970:	c7 84 9d 68 ff ff ff 	movl   $0x0,-0x98(%ebp,%ebx,4)
+80108977:	00 00 00 00 
+  return exec(path, argv);
+8010897b:	83 ec 08             	sub    $0x8,%esp
+8010897e:	56                   	push   %esi
+8010897f:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+80108985:	e8 96 89 ff ff       	call   80101320 <exec>
+8010898a:	83 c4 10             	add    $0x10,%esp
+}
+8010898d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108990:	5b                   	pop    %ebx
+80108991:	5e                   	pop    %esi
+80108992:	5f                   	pop    %edi
+80108993:	5d                   	pop    %ebp
+80108994:	c3                   	ret
+80108995:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010899c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801089a0 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+801089a0:	55                   	push   %ebp
+801089a1:	89 e5                	mov    %esp,%ebp
+801089a3:	57                   	push   %edi
+801089a4:	56                   	push   %esi
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801089a5:	8d 45 dc             	lea    -0x24(%ebp),%eax
+{
+801089a8:	53                   	push   %ebx
+801089a9:	83 ec 20             	sub    $0x20,%esp
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801089ac:	6a 08                	push   $0x8
+801089ae:	50                   	push   %eax
+801089af:	6a 00                	push   $0x0
+801089b1:	e8 7a f3 ff ff       	call   80107d30 <argptrw>
+801089b6:	83 c4 10             	add    $0x10,%esp
+801089b9:	85 c0                	test   %eax,%eax
+801089bb:	78 7f                	js     80108a3c <sys_pipe+0x9c>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+801089bd:	83 ec 08             	sub    $0x8,%esp
+801089c0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801089c3:	50                   	push   %eax
+801089c4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+801089c7:	50                   	push   %eax
+801089c8:	e8 a3 c9 ff ff       	call   80105370 <pipealloc>
+801089cd:	83 c4 10             	add    $0x10,%esp
+801089d0:	85 c0                	test   %eax,%eax
+801089d2:	78 68                	js     80108a3c <sys_pipe+0x9c>
+    if(proc->ofile[fd] == 0){
+801089d4:	65 8b 0d 04 00 00 00 	mov    %gs:0x4,%ecx
+  for(fd = 0; fd < NOFILE; fd++){
+801089db:	31 c0                	xor    %eax,%eax
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+801089dd:	8b 75 e0             	mov    -0x20(%ebp),%esi
+    if(proc->ofile[fd] == 0){
+801089e0:	8b 54 81 6c          	mov    0x6c(%ecx,%eax,4),%edx
+801089e4:	85 d2                	test   %edx,%edx
+801089e6:	74 18                	je     80108a00 <sys_pipe+0x60>
+801089e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801089ef:	90                   	nop
+  for(fd = 0; fd < NOFILE; fd++){
+801089f0:	83 c0 01             	add    $0x1,%eax
+801089f3:	83 f8 10             	cmp    $0x10,%eax
+801089f6:	74 2f                	je     80108a27 <sys_pipe+0x87>
+    if(proc->ofile[fd] == 0){
+801089f8:	8b 54 81 6c          	mov    0x6c(%ecx,%eax,4),%edx
+801089fc:	85 d2                	test   %edx,%edx
+801089fe:	75 f0                	jne    801089f0 <sys_pipe+0x50>
+      proc->ofile[fd] = f;
+80108a00:	8d 58 18             	lea    0x18(%eax),%ebx
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108a03:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  for(fd = 0; fd < NOFILE; fd++){
+80108a06:	31 d2                	xor    %edx,%edx
+      proc->ofile[fd] = f;
+80108a08:	89 74 99 0c          	mov    %esi,0xc(%ecx,%ebx,4)
+  for(fd = 0; fd < NOFILE; fd++){
+80108a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(proc->ofile[fd] == 0){
+80108a10:	83 7c 91 6c 00       	cmpl   $0x0,0x6c(%ecx,%edx,4)
+80108a15:	74 31                	je     80108a48 <sys_pipe+0xa8>
+  for(fd = 0; fd < NOFILE; fd++){
+80108a17:	83 c2 01             	add    $0x1,%edx
+80108a1a:	83 fa 10             	cmp    $0x10,%edx
+80108a1d:	75 f1                	jne    80108a10 <sys_pipe+0x70>
+    if(fd0 >= 0)
+      proc->ofile[fd0] = 0;
+80108a1f:	c7 44 99 0c 00 00 00 	movl   $0x0,0xc(%ecx,%ebx,4)
+80108a26:	00 
+    fileclose(rf);
+80108a27:	83 ec 0c             	sub    $0xc,%esp
+80108a2a:	56                   	push   %esi
+80108a2b:	e8 20 8e ff ff       	call   80101850 <fileclose>
+    fileclose(wf);
+80108a30:	58                   	pop    %eax
+80108a31:	ff 75 e4             	push   -0x1c(%ebp)
+80108a34:	e8 17 8e ff ff       	call   80101850 <fileclose>
+    return -1;
+80108a39:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108a3c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a41:	eb 16                	jmp    80108a59 <sys_pipe+0xb9>
+80108a43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108a47:	90                   	nop
+      proc->ofile[fd] = f;
+80108a48:	89 7c 91 6c          	mov    %edi,0x6c(%ecx,%edx,4)
+  }
+  fd[0] = fd0;
+80108a4c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+80108a4f:	89 01                	mov    %eax,(%ecx)
+  fd[1] = fd1;
+80108a51:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80108a54:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+80108a57:	31 c0                	xor    %eax,%eax
+}
+80108a59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108a5c:	5b                   	pop    %ebx
+80108a5d:	5e                   	pop    %esi
+80108a5e:	5f                   	pop    %edi
+80108a5f:	5d                   	pop    %ebp
+80108a60:	c3                   	ret
+80108a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108a6f:	90                   	nop
+
+80108a70 <sys_readahead>:
+
+// Set the sequential read-ahead window in blocks, returning the
+// old one; a negative argument just returns it.
+int
+sys_readahead(void)
+{
+80108a70:	55                   	push   %ebp
+80108a71:	89 e5                	mov    %esp,%ebp
+80108a73:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if(argint(0, &n) < 0)
+80108a76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a79:	50                   	push   %eax
+80108a7a:	6a 00                	push   $0x0
+80108a7c:	e8 2f f2 ff ff       	call   80107cb0 <argint>
+80108a81:	83 c4 10             	add    $0x10,%esp
+80108a84:	85 c0                	test   %eax,%eax
+80108a86:	78 18                	js     80108aa0 <sys_readahead+0x30>
+    return -1;
+  return setreadahead(n);
+80108a88:	83 ec 0c             	sub    $0xc,%esp
+80108a8b:	ff 75 f4             	push   -0xc(%ebp)
+80108a8e:	e8 2d 9a ff ff       	call   801024c0 <setreadahead>
+80108a93:	83 c4 10             	add    $0x10,%esp
+}
+80108a96:	c9                   	leave
+80108a97:	c3                   	ret
+80108a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108a9f:	90                   	nop
+80108aa0:	c9                   	leave
+    return -1;
+80108aa1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108aa6:	c3                   	ret
+80108aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108aae:	66 90                	xchg   %ax,%ax
+
+80108ab0 <sys_dropcache>:
+
+// Empty the block cache of everything not in use, so that the
+// next reads are cold.
+int
+sys_dropcache(void)
+{
+80108ab0:	55                   	push   %ebp
+80108ab1:	89 e5                	mov    %esp,%ebp
+80108ab3:	83 ec 08             	sub    $0x8,%esp
+  bdrop();
+80108ab6:	e8 b5 7f ff ff       	call   80100a70 <bdrop>
+  return 0;
+}
+80108abb:	31 c0                	xor    %eax,%eax
+80108abd:	c9                   	leave
+80108abe:	c3                   	ret
+80108abf:	90                   	nop
+
+80108ac0 <sys_fork>:
+#include "trace.h"
+
+int
+sys_fork(void)
+{
+  return fork();
+80108ac0:	e9 5b d3 ff ff       	jmp    80105e20 <fork>
+80108ac5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108ad0 <sys_exit>:
+}
+
+int
+sys_exit(void)
+{
+80108ad0:	55                   	push   %ebp
+80108ad1:	89 e5                	mov    %esp,%ebp
+80108ad3:	83 ec 08             	sub    $0x8,%esp
+  exit();
+80108ad6:	e8 65 dc ff ff       	call   80106740 <exit>
+  return 0;  // not reached
+}
+80108adb:	31 c0                	xor    %eax,%eax
+80108add:	c9                   	leave
+80108ade:	c3                   	ret
+80108adf:	90                   	nop
+
+80108ae0 <sys_wait>:
+
+int
+sys_wait(void)
+{
+  return wait();
+80108ae0:	e9 ab da ff ff       	jmp    80106590 <wait>
+80108ae5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108af0 <sys_kill>:
+}
+
+int
+sys_kill(void)
+{
+80108af0:	55                   	push   %ebp
+80108af1:	89 e5                	mov    %esp,%ebp
+80108af3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80108af6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108af9:	50                   	push   %eax
+80108afa:	6a 00                	push   $0x0
+80108afc:	e8 af f1 ff ff       	call   80107cb0 <argint>
+80108b01:	83 c4 10             	add    $0x10,%esp
+80108b04:	85 c0                	test   %eax,%eax
+80108b06:	78 18                	js     80108b20 <sys_kill+0x30>
+    return -1;
+  return kill(pid);
+80108b08:	83 ec 0c             	sub    $0xc,%esp
+80108b0b:	ff 75 f4             	push   -0xc(%ebp)
+80108b0e:	e8 ad dd ff ff       	call   801068c0 <kill>
+80108b13:	83 c4 10             	add    $0x10,%esp
+}
+80108b16:	c9                   	leave
+80108b17:	c3                   	ret
+80108b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108b1f:	90                   	nop
+80108b20:	c9                   	leave
+    return -1;
+80108b21:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108b26:	c3                   	ret
+80108b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108b2e:	66 90                	xchg   %ax,%ax
+
+80108b30 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+  return proc->pid;
+80108b30:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80108b36:	8b 40 44             	mov    0x44(%eax),%eax
+}
+80108b39:	c3                   	ret
+80108b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108b40 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80108b40:	55                   	push   %ebp
+80108b41:	89 e5                	mov    %esp,%ebp
+80108b43:	53                   	push   %ebx
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+80108b44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108b47:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+80108b4a:	50                   	push   %eax
+80108b4b:	6a 00                	push   $0x0
+80108b4d:	e8 5e f1 ff ff       	call   80107cb0 <argint>
+80108b52:	83 c4 10             	add    $0x10,%esp
+80108b55:	85 c0                	test   %eax,%eax
+80108b57:	78 27                	js     80108b80 <sys_sbrk+0x40>
+    return -1;
+  addr = proc->sz;
+80108b59:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  if(growproc(n) < 0)
+80108b5f:	83 ec 0c             	sub    $0xc,%esp
+  addr = proc->sz;
+80108b62:	8b 58 34             	mov    0x34(%eax),%ebx
+  if(growproc(n) < 0)
+80108b65:	ff 75 f4             	push   -0xc(%ebp)
+80108b68:	e8 33 d2 ff ff       	call   80105da0 <growproc>
+80108b6d:	83 c4 10             	add    $0x10,%esp
+80108b70:	85 c0                	test   %eax,%eax
+80108b72:	78 0c                	js     80108b80 <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+80108b74:	89 d8                	mov    %ebx,%eax
+80108b76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108b79:	c9                   	leave
+80108b7a:	c3                   	ret
+80108b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108b7f:	90                   	nop
+    return -1;
+80108b80:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108b85:	eb ed                	jmp    80108b74 <sys_sbrk+0x34>
+80108b87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108b8e:	66 90                	xchg   %ax,%ax
+
+80108b90 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80108b90:	55                   	push   %ebp
+80108b91:	89 e5                	mov    %esp,%ebp
+80108b93:	53                   	push   %ebx
+  int n;
+  uint ticks0;
+
+  if(argint(0, &n) < 0)
+80108b94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108b97:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+80108b9a:	50                   	push   %eax
+80108b9b:	6a 00                	push   $0x0
+80108b9d:	e8 0e f1 ff ff       	call   80107cb0 <argint>
+80108ba2:	83 c4 10             	add    $0x10,%esp
+80108ba5:	85 c0                	test   %eax,%eax
+80108ba7:	78 6f                	js     80108c18 <sys_sleep+0x88>
+    return -1;
+  acquire(&tickslock);
+80108ba9:	83 ec 0c             	sub    $0xc,%esp
+80108bac:	68 40 1b 1a 80       	push   $0x801a1b40
+80108bb1:	e8 aa e1 ff ff       	call   80106d60 <acquire>
+  ticks0 = ticks;
+  while(ticks - ticks0 < n){
+80108bb6:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  ticks0 = ticks;
+80108bb9:	8b 1d 20 1b 1a 80    	mov    0x801a1b20,%ebx
+  while(ticks - ticks0 < n){
+80108bbf:	83 c4 10             	add    $0x10,%esp
+80108bc2:	85 c9                	test   %ecx,%ecx
+80108bc4:	75 35                	jne    80108bfb <sys_sleep+0x6b>
+80108bc6:	eb 60                	jmp    80108c28 <sys_sleep+0x98>
+80108bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108bcf:	90                   	nop
+    if(proc->killed){
+      release(&tickslock);
+      return -1;
+    }
+    proc->swappable = 1;  // see wait()
+80108bd0:	c7 80 0c 01 00 00 01 	movl   $0x1,0x10c(%eax)
+80108bd7:	00 00 00 
+    sleep(&ticks, &tickslock);
+80108bda:	83 ec 08             	sub    $0x8,%esp
+80108bdd:	68 40 1b 1a 80       	push   $0x801a1b40
+80108be2:	68 20 1b 1a 80       	push   $0x801a1b20
+80108be7:	e8 24 d9 ff ff       	call   80106510 <sleep>
+  while(ticks - ticks0 < n){
+80108bec:	a1 20 1b 1a 80       	mov    0x801a1b20,%eax
+80108bf1:	83 c4 10             	add    $0x10,%esp
+80108bf4:	29 d8                	sub    %ebx,%eax
+80108bf6:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+80108bf9:	73 2d                	jae    80108c28 <sys_sleep+0x98>
+    if(proc->killed){
+80108bfb:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80108c01:	8b 50 68             	mov    0x68(%eax),%edx
+80108c04:	85 d2                	test   %edx,%edx
+80108c06:	74 c8                	je     80108bd0 <sys_sleep+0x40>
+      release(&tickslock);
+80108c08:	83 ec 0c             	sub    $0xc,%esp
+80108c0b:	68 40 1b 1a 80       	push   $0x801a1b40
+80108c10:	e8 6b e3 ff ff       	call   80106f80 <release>
+      return -1;
+80108c15:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&tickslock);
+  return 0;
+}
+80108c18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+80108c1b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108c20:	c9                   	leave
+80108c21:	c3                   	ret
+80108c22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  release(&tickslock);
+80108c28:	83 ec 0c             	sub    $0xc,%esp
+80108c2b:	68 40 1b 1a 80       	push   $0x801a1b40
+80108c30:	e8 4b e3 ff ff       	call   80106f80 <release>
+}
+80108c35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return 0;
+80108c38:	83 c4 10             	add    $0x10,%esp
+80108c3b:	31 c0                	xor    %eax,%eax
+}
+80108c3d:	c9                   	leave
+80108c3e:	c3                   	ret
+80108c3f:	90                   	nop
+
+80108c40 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+80108c40:	55                   	push   %ebp
+80108c41:	89 e5                	mov    %esp,%ebp
+80108c43:	53                   	push   %ebx
+80108c44:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+80108c47:	68 40 1b 1a 80       	push   $0x801a1b40
+80108c4c:	e8 0f e1 ff ff       	call   80106d60 <acquire>
+  xticks = ticks;
+80108c51:	8b 1d 20 1b 1a 80    	mov    0x801a1b20,%ebx
+  release(&tickslock);
+80108c57:	c7 04 24 40 1b 1a 80 	movl   $0x801a1b40,(%esp)
+80108c5e:	e8 1d e3 ff ff       	call   80106f80 <release>
+  return xticks;
+}
+80108c63:	89 d8                	mov    %ebx,%eax
+80108c65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108c68:	c9                   	leave
+80108c69:	c3                   	ret
+80108c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108c70 <sys_trace>:
+
+int
+sys_trace(void)
+{
+80108c70:	55                   	push   %ebp
+80108c71:	89 e5                	mov    %esp,%ebp
+80108c73:	83 ec 20             	sub    $0x20,%esp
+    int on_off;
+
+    if(argint(0, &on_off) < 0)  // Get argument (0 or 1) from user space
+80108c76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108c79:	50                   	push   %eax
+80108c7a:	6a 00                	push   $0x0
+80108c7c:	e8 2f f0 ff ff       	call   80107cb0 <argint>
+80108c81:	83 c4 10             	add    $0x10,%esp
+80108c84:	85 c0                	test   %eax,%eax
+80108c86:	78 2b                	js     80108cb3 <sys_trace+0x43>
+        return -1;
+
+    proc->tracemask = on_off ? TRACE_ALL : 0;
+80108c88:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108c8b:	31 c0                	xor    %eax,%eax
+80108c8d:	65 8b 0d 04 00 00 00 	mov    %gs:0x4,%ecx
+80108c94:	85 d2                	test   %edx,%edx
+    proc->tracewhen = TRACE_ANY;
+80108c96:	c7 41 50 00 00 00 00 	movl   $0x0,0x50(%ecx)
+    proc->tracemask = on_off ? TRACE_ALL : 0;
+80108c9d:	0f 95 c0             	setne  %al
+80108ca0:	31 d2                	xor    %edx,%edx
+80108ca2:	f7 d8                	neg    %eax
+80108ca4:	83 d2 00             	adc    $0x0,%edx
+80108ca7:	89 41 48             	mov    %eax,0x48(%ecx)
+    return 0;
+80108caa:	31 c0                	xor    %eax,%eax
+    proc->tracemask = on_off ? TRACE_ALL : 0;
+80108cac:	f7 da                	neg    %edx
+80108cae:	89 51 4c             	mov    %edx,0x4c(%ecx)
+}
+80108cb1:	c9                   	leave
+80108cb2:	c3                   	ret
+80108cb3:	c9                   	leave
+        return -1;
+80108cb4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108cb9:	c3                   	ret
+80108cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108cc0 <sys_tracedrain>:
+
+// tracedrain(ev, n) moves up to n buffered trace events into
+// ev[] and returns how many it moved.
+int
+sys_tracedrain(void)
+{
+80108cc0:	55                   	push   %ebp
+80108cc1:	89 e5                	mov    %esp,%ebp
+80108cc3:	83 ec 20             	sub    $0x20,%esp
+  struct traceev *ev;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+80108cc6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108cc9:	50                   	push   %eax
+80108cca:	6a 01                	push   $0x1
+80108ccc:	e8 df ef ff ff       	call   80107cb0 <argint>
+80108cd1:	83 c4 10             	add    $0x10,%esp
+80108cd4:	85 c0                	test   %eax,%eax
+80108cd6:	78 58                	js     80108d30 <sys_tracedrain+0x70>
+80108cd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108cdb:	85 c0                	test   %eax,%eax
+80108cdd:	78 51                	js     80108d30 <sys_tracedrain+0x70>
+    return -1;
+  // No more can be buffered; also keeps n*sizeof(*ev) from wrapping.
+  if(n > NCPU*(TRACERING+1))
+80108cdf:	3d 08 08 00 00       	cmp    $0x808,%eax
+80108ce4:	7f 32                	jg     80108d18 <sys_tracedrain+0x58>
+    n = NCPU*(TRACERING+1);
+  if(argptrw(0, (char**)&ev, n*sizeof(*ev)) < 0)
+80108ce6:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+80108ce9:	c1 e0 02             	shl    $0x2,%eax
+80108cec:	83 ec 04             	sub    $0x4,%esp
+80108cef:	50                   	push   %eax
+80108cf0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108cf3:	50                   	push   %eax
+80108cf4:	6a 00                	push   $0x0
+80108cf6:	e8 35 f0 ff ff       	call   80107d30 <argptrw>
+80108cfb:	83 c4 10             	add    $0x10,%esp
+80108cfe:	85 c0                	test   %eax,%eax
+80108d00:	78 2e                	js     80108d30 <sys_tracedrain+0x70>
+    return -1;
+  return tracedrain(ev, n);
+80108d02:	83 ec 08             	sub    $0x8,%esp
+80108d05:	ff 75 f4             	push   -0xc(%ebp)
+80108d08:	ff 75 f0             	push   -0x10(%ebp)
+80108d0b:	e8 80 03 00 00       	call   80109090 <tracedrain>
+80108d10:	83 c4 10             	add    $0x10,%esp
+}
+80108d13:	c9                   	leave
+80108d14:	c3                   	ret
+80108d15:	8d 76 00             	lea    0x0(%esi),%esi
+    n = NCPU*(TRACERING+1);
+80108d18:	c7 45 f4 08 08 00 00 	movl   $0x808,-0xc(%ebp)
+80108d1f:	b8 20 21 01 00       	mov    $0x12120,%eax
+80108d24:	eb c6                	jmp    80108cec <sys_tracedrain+0x2c>
+80108d26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d2d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+80108d30:	c9                   	leave
+    return -1;
+80108d31:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108d36:	c3                   	ret
+80108d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d3e:	66 90                	xchg   %ax,%ax
+
+80108d40 <sys_assign_nice>:
+
+// assign_nice(pid, nice) returns the old nice value of pid,
+// -100 if nice is out of range or -101 if pid does not exist;
+// these are the codes nice(1) reports.
+int sys_assign_nice(void)
+{
+80108d40:	55                   	push   %ebp
+80108d41:	89 e5                	mov    %esp,%ebp
+80108d43:	83 ec 20             	sub    $0x20,%esp
+    int pid, nice, old;
+
+    if (argint(0, &pid) < 0 || argint(1, &nice) < 0)
+80108d46:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108d49:	50                   	push   %eax
+80108d4a:	6a 00                	push   $0x0
+80108d4c:	e8 5f ef ff ff       	call   80107cb0 <argint>
+80108d51:	83 c4 10             	add    $0x10,%esp
+80108d54:	85 c0                	test   %eax,%eax
+80108d56:	78 40                	js     80108d98 <sys_assign_nice+0x58>
+80108d58:	83 ec 08             	sub    $0x8,%esp
+80108d5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108d5e:	50                   	push   %eax
+80108d5f:	6a 01                	push   $0x1
+80108d61:	e8 4a ef ff ff       	call   80107cb0 <argint>
+80108d66:	83 c4 10             	add    $0x10,%esp
+80108d69:	85 c0                	test   %eax,%eax
+80108d6b:	78 2b                	js     80108d98 <sys_assign_nice+0x58>
+        return -1;
+    if (nice < NICEMIN || nice > NICEMAX)
+80108d6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108d70:	8d 50 ff             	lea    -0x1(%eax),%edx
+80108d73:	83 fa 04             	cmp    $0x4,%edx
+80108d76:	77 28                	ja     80108da0 <sys_assign_nice+0x60>
+        return -100;
+    if ((old = setnice(pid, nice)) < 0)
+80108d78:	83 ec 08             	sub    $0x8,%esp
+80108d7b:	50                   	push   %eax
+80108d7c:	ff 75 f0             	push   -0x10(%ebp)
+80108d7f:	e8 bc db ff ff       	call   80106940 <setnice>
+80108d84:	83 c4 10             	add    $0x10,%esp
+80108d87:	85 c0                	test   %eax,%eax
+80108d89:	78 02                	js     80108d8d <sys_assign_nice+0x4d>
+        return -101;
+    return old;
+}
+80108d8b:	c9                   	leave
+80108d8c:	c3                   	ret
+80108d8d:	c9                   	leave
+        return -101;
+80108d8e:	b8 9b ff ff ff       	mov    $0xffffff9b,%eax
+}
+80108d93:	c3                   	ret
+80108d94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108d98:	c9                   	leave
+        return -1;
+80108d99:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108d9e:	c3                   	ret
+80108d9f:	90                   	nop
+80108da0:	c9                   	leave
+        return -100;
+80108da1:	b8 9c ff ff ff       	mov    $0xffffff9c,%eax
+}
+80108da6:	c3                   	ret
+80108da7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108dae:	66 90                	xchg   %ax,%ax
+
+80108db0 <sys_settrace>:
+// reported when they end as when (TRACE_ANY, TRACE_OK,
+// TRACE_FAIL) says, or only counted (TRACE_COUNT).  pid 0 is
+// the caller, -1 the caller's parent.
+int
+sys_settrace(void)
+{
+80108db0:	55                   	push   %ebp
+80108db1:	89 e5                	mov    %esp,%ebp
+80108db3:	53                   	push   %ebx
+  int pid, lo, hi, when;
+
+  if(argint(0, &pid) < 0 || argint(1, &lo) < 0 ||
+80108db4:	8d 45 e8             	lea    -0x18(%ebp),%eax
+{
+80108db7:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &pid) < 0 || argint(1, &lo) < 0 ||
+80108dba:	50                   	push   %eax
+80108dbb:	6a 00                	push   $0x0
+80108dbd:	e8 ee ee ff ff       	call   80107cb0 <argint>
+80108dc2:	83 c4 10             	add    $0x10,%esp
+80108dc5:	85 c0                	test   %eax,%eax
+80108dc7:	78 6f                	js     80108e38 <sys_settrace+0x88>
+80108dc9:	83 ec 08             	sub    $0x8,%esp
+80108dcc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108dcf:	50                   	push   %eax
+80108dd0:	6a 01                	push   $0x1
+80108dd2:	e8 d9 ee ff ff       	call   80107cb0 <argint>
+80108dd7:	83 c4 10             	add    $0x10,%esp
+80108dda:	85 c0                	test   %eax,%eax
+80108ddc:	78 5a                	js     80108e38 <sys_settrace+0x88>
+     argint(2, &hi) < 0 || argint(3, &when) < 0)
+80108dde:	83 ec 08             	sub    $0x8,%esp
+80108de1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108de4:	50                   	push   %eax
+80108de5:	6a 02                	push   $0x2
+80108de7:	e8 c4 ee ff ff       	call   80107cb0 <argint>
+  if(argint(0, &pid) < 0 || argint(1, &lo) < 0 ||
+80108dec:	83 c4 10             	add    $0x10,%esp
+80108def:	85 c0                	test   %eax,%eax
+80108df1:	78 45                	js     80108e38 <sys_settrace+0x88>
+     argint(2, &hi) < 0 || argint(3, &when) < 0)
+80108df3:	83 ec 08             	sub    $0x8,%esp
+80108df6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108df9:	50                   	push   %eax
+80108dfa:	6a 03                	push   $0x3
+80108dfc:	e8 af ee ff ff       	call   80107cb0 <argint>
+80108e01:	83 c4 10             	add    $0x10,%esp
+80108e04:	85 c0                	test   %eax,%eax
+80108e06:	78 30                	js     80108e38 <sys_settrace+0x88>
+    return -1;
+  if(when < TRACE_ANY || when > TRACE_COUNT)
+80108e08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108e0b:	83 f8 03             	cmp    $0x3,%eax
+80108e0e:	77 28                	ja     80108e38 <sys_settrace+0x88>
+    return -1;
+  return settrace(pid, ((uint64)(uint)hi << 32) | (uint)lo, when);
+80108e10:	50                   	push   %eax
+80108e11:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80108e14:	31 db                	xor    %ebx,%ebx
+80108e16:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+80108e19:	89 c2                	mov    %eax,%edx
+80108e1b:	31 c0                	xor    %eax,%eax
+80108e1d:	09 c8                	or     %ecx,%eax
+80108e1f:	09 da                	or     %ebx,%edx
+80108e21:	52                   	push   %edx
+80108e22:	50                   	push   %eax
+80108e23:	ff 75 e8             	push   -0x18(%ebp)
+80108e26:	e8 b5 db ff ff       	call   801069e0 <settrace>
+80108e2b:	83 c4 10             	add    $0x10,%esp
+}
+80108e2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108e31:	c9                   	leave
+80108e32:	c3                   	ret
+80108e33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108e37:	90                   	nop
+    return -1;
+80108e38:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108e3d:	eb ef                	jmp    80108e2e <sys_settrace+0x7e>
+80108e3f:	90                   	nop
+
+80108e40 <sys_tracestat>:
+
+// tracestat(pid, st) copies the system call statistics of pid
+// (0: the caller, -1: the whole system) into st[NCALLSTAT].
+int
+sys_tracestat(void)
+{
+80108e40:	55                   	push   %ebp
+80108e41:	89 e5                	mov    %esp,%ebp
+80108e43:	83 ec 20             	sub    $0x20,%esp
+  struct callstat *st;
+  int pid;
+
+  if(argint(0, &pid) < 0 ||
+80108e46:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108e49:	50                   	push   %eax
+80108e4a:	6a 00                	push   $0x0
+80108e4c:	e8 5f ee ff ff       	call   80107cb0 <argint>
+80108e51:	83 c4 10             	add    $0x10,%esp
+80108e54:	85 c0                	test   %eax,%eax
+80108e56:	78 30                	js     80108e88 <sys_tracestat+0x48>
+     argptrw(1, (char**)&st, NCALLSTAT*sizeof(*st)) < 0)
+80108e58:	83 ec 04             	sub    $0x4,%esp
+80108e5b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108e5e:	68 c0 0f 00 00       	push   $0xfc0
+80108e63:	50                   	push   %eax
+80108e64:	6a 01                	push   $0x1
+80108e66:	e8 c5 ee ff ff       	call   80107d30 <argptrw>
+  if(argint(0, &pid) < 0 ||
+80108e6b:	83 c4 10             	add    $0x10,%esp
+80108e6e:	85 c0                	test   %eax,%eax
+80108e70:	78 16                	js     80108e88 <sys_tracestat+0x48>
+    return -1;
+  return tracestat(pid, st);
+80108e72:	83 ec 08             	sub    $0x8,%esp
+80108e75:	ff 75 f0             	push   -0x10(%ebp)
+80108e78:	ff 75 f4             	push   -0xc(%ebp)
+80108e7b:	e8 00 05 00 00       	call   80109380 <tracestat>
+80108e80:	83 c4 10             	add    $0x10,%esp
+}
+80108e83:	c9                   	leave
+80108e84:	c3                   	ret
+80108e85:	8d 76 00             	lea    0x0(%esi),%esi
+80108e88:	c9                   	leave
+    return -1;
+80108e89:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108e8e:	c3                   	ret
+80108e8f:	90                   	nop
+
+80108e90 <timerinit>:
+#define TIMER_RATEGEN   0x04    // mode 2, rate generator
+#define TIMER_16BIT     0x30    // r/w counter 16 bits, LSB first
+
+void
+timerinit(void)
+{
+80108e90:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80108e91:	b8 34 00 00 00       	mov    $0x34,%eax
+80108e96:	ba 43 00 00 00       	mov    $0x43,%edx
+80108e9b:	89 e5                	mov    %esp,%ebp
+80108e9d:	83 ec 14             	sub    $0x14,%esp
+80108ea0:	ee                   	out    %al,(%dx)
+80108ea1:	ba 40 00 00 00       	mov    $0x40,%edx
+80108ea6:	b8 9c ff ff ff       	mov    $0xffffff9c,%eax
+80108eab:	ee                   	out    %al,(%dx)
+80108eac:	b8 2e 00 00 00       	mov    $0x2e,%eax
+80108eb1:	ee                   	out    %al,(%dx)
+  // Interrupt 100 times/sec.
+  outb(TIMER_MODE, TIMER_SEL0 | TIMER_RATEGEN | TIMER_16BIT);
+  outb(IO_TIMER1, TIMER_DIV(100) % 256);
+  outb(IO_TIMER1, TIMER_DIV(100) / 256);
+  picenable(IRQ_TIMER);
+80108eb2:	6a 00                	push   $0x0
+80108eb4:	e8 e7 c3 ff ff       	call   801052a0 <picenable>
+}
+80108eb9:	83 c4 10             	add    $0x10,%esp
+80108ebc:	c9                   	leave
+80108ebd:	c3                   	ret
+80108ebe:	66 90                	xchg   %ax,%ax
+
+80108ec0 <countcall>:
+  return i;
+}
+
+static void
+countcall(struct callstat *st, int ret, uint64 cycles)
+{
+80108ec0:	55                   	push   %ebp
+80108ec1:	89 c1                	mov    %eax,%ecx
+80108ec3:	89 e5                	mov    %esp,%ebp
+80108ec5:	57                   	push   %edi
+80108ec6:	56                   	push   %esi
+80108ec7:	53                   	push   %ebx
+80108ec8:	83 ec 0c             	sub    $0xc,%esp
+  int i;
+
+  st->count++;
+80108ecb:	83 00 01             	addl   $0x1,(%eax)
+{
+80108ece:	8b 75 08             	mov    0x8(%ebp),%esi
+80108ed1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(ret < 0)
+80108ed4:	85 d2                	test   %edx,%edx
+80108ed6:	79 04                	jns    80108edc <countcall+0x1c>
+    st->errors++;
+80108ed8:	83 40 04 01          	addl   $0x1,0x4(%eax)
+  st->cycles += cycles;
+  for(i = 0; i < NCALLHIST-1 && (cycles >> (CALLHIST0+1+i)) != 0; i++)
+80108edc:	89 f0                	mov    %esi,%eax
+80108ede:	89 fa                	mov    %edi,%edx
+  st->cycles += cycles;
+80108ee0:	01 71 08             	add    %esi,0x8(%ecx)
+80108ee3:	11 79 0c             	adc    %edi,0xc(%ecx)
+  for(i = 0; i < NCALLHIST-1 && (cycles >> (CALLHIST0+1+i)) != 0; i++)
+80108ee6:	0f ac f8 09          	shrd   $0x9,%edi,%eax
+80108eea:	31 db                	xor    %ebx,%ebx
+80108eec:	c1 ea 09             	shr    $0x9,%edx
+80108eef:	09 d0                	or     %edx,%eax
+80108ef1:	74 33                	je     80108f26 <countcall+0x66>
+80108ef3:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+80108ef6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108efd:	8d 76 00             	lea    0x0(%esi),%esi
+80108f00:	89 d9                	mov    %ebx,%ecx
+80108f02:	83 c3 01             	add    $0x1,%ebx
+80108f05:	83 fb 17             	cmp    $0x17,%ebx
+80108f08:	74 19                	je     80108f23 <countcall+0x63>
+80108f0a:	83 c1 0a             	add    $0xa,%ecx
+80108f0d:	89 fa                	mov    %edi,%edx
+80108f0f:	89 f0                	mov    %esi,%eax
+80108f11:	0f ad d0             	shrd   %cl,%edx,%eax
+80108f14:	d3 ea                	shr    %cl,%edx
+80108f16:	f6 c1 20             	test   $0x20,%cl
+80108f19:	74 04                	je     80108f1f <countcall+0x5f>
+80108f1b:	89 d0                	mov    %edx,%eax
+80108f1d:	31 d2                	xor    %edx,%edx
+80108f1f:	09 d0                	or     %edx,%eax
+80108f21:	75 dd                	jne    80108f00 <countcall+0x40>
+80108f23:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+    ;
+  st->hist[i]++;
+80108f26:	83 44 99 10 01       	addl   $0x1,0x10(%ecx,%ebx,4)
+}
+80108f2b:	83 c4 0c             	add    $0xc,%esp
+80108f2e:	5b                   	pop    %ebx
+80108f2f:	5e                   	pop    %esi
+80108f30:	5f                   	pop    %edi
+80108f31:	5d                   	pop    %ebp
+80108f32:	c3                   	ret
+80108f33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108f40 <addstats>:
+
+static void
+addstats(struct callstat *to, struct callstat *from)
+{
+80108f40:	55                   	push   %ebp
+80108f41:	89 c1                	mov    %eax,%ecx
+80108f43:	89 e5                	mov    %esp,%ebp
+80108f45:	56                   	push   %esi
+80108f46:	8d b0 c0 0f 00 00    	lea    0xfc0(%eax),%esi
+80108f4c:	53                   	push   %ebx
+80108f4d:	89 d3                	mov    %edx,%ebx
+80108f4f:	90                   	nop
+  int i, j;
+
+  for(i = 0; i < NCALLSTAT; i++){
+    to[i].count += from[i].count;
+80108f50:	8b 03                	mov    (%ebx),%eax
+80108f52:	01 01                	add    %eax,(%ecx)
+    to[i].errors += from[i].errors;
+80108f54:	8b 43 04             	mov    0x4(%ebx),%eax
+80108f57:	01 41 04             	add    %eax,0x4(%ecx)
+    to[i].cycles += from[i].cycles;
+80108f5a:	8b 43 08             	mov    0x8(%ebx),%eax
+80108f5d:	8b 53 0c             	mov    0xc(%ebx),%edx
+80108f60:	01 41 08             	add    %eax,0x8(%ecx)
+80108f63:	11 51 0c             	adc    %edx,0xc(%ecx)
+    for(j = 0; j < NCALLHIST; j++)
+80108f66:	31 c0                	xor    %eax,%eax
+80108f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108f6f:	90                   	nop
+      to[i].hist[j] += from[i].hist[j];
+80108f70:	8b 54 83 10          	mov    0x10(%ebx,%eax,4),%edx
+80108f74:	01 54 81 10          	add    %edx,0x10(%ecx,%eax,4)
+    for(j = 0; j < NCALLHIST; j++)
+80108f78:	83 c0 01             	add    $0x1,%eax
+80108f7b:	83 f8 18             	cmp    $0x18,%eax
+80108f7e:	75 f0                	jne    80108f70 <addstats+0x30>
+  for(i = 0; i < NCALLSTAT; i++){
+80108f80:	83 c1 70             	add    $0x70,%ecx
+80108f83:	83 c3 70             	add    $0x70,%ebx
+80108f86:	39 f1                	cmp    %esi,%ecx
+80108f88:	75 c6                	jne    80108f50 <addstats+0x10>
+  }
+}
+80108f8a:	5b                   	pop    %ebx
+80108f8b:	5e                   	pop    %esi
+80108f8c:	5d                   	pop    %ebp
+80108f8d:	c3                   	ret
+80108f8e:	66 90                	xchg   %ax,%ax
+
+80108f90 <traceinit>:
+{
+80108f90:	55                   	push   %ebp
+80108f91:	89 e5                	mov    %esp,%ebp
+80108f93:	83 ec 10             	sub    $0x10,%esp
+  initsleeplock(&drainlock, "tracedrain");
+80108f96:	68 a9 bc 10 80       	push   $0x8010bca9
+80108f9b:	68 80 fa 18 80       	push   $0x8018fa80
+80108fa0:	e8 8b dc ff ff       	call   80106c30 <initsleeplock>
+}
+80108fa5:	83 c4 10             	add    $0x10,%esp
+80108fa8:	c9                   	leave
+80108fa9:	c3                   	ret
+80108faa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108fb0 <traceput>:
+{
+80108fb0:	55                   	push   %ebp
+80108fb1:	89 e5                	mov    %esp,%ebp
+80108fb3:	57                   	push   %edi
+80108fb4:	56                   	push   %esi
+80108fb5:	53                   	push   %ebx
+80108fb6:	83 ec 1c             	sub    $0x1c,%esp
+80108fb9:	8b 45 0c             	mov    0xc(%ebp),%eax
+80108fbc:	8b 75 08             	mov    0x8(%ebp),%esi
+80108fbf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80108fc2:	8b 45 10             	mov    0x10(%ebp),%eax
+80108fc5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  pushcli();
+80108fc8:	e8 33 df ff ff       	call   80106f00 <pushcli>
+  r = &ring[cpu - cpus];
+80108fcd:	65 8b 1d 00 00 00 00 	mov    %gs:0x0,%ebx
+80108fd4:	81 eb c0 e9 17 80    	sub    $0x8017e9c0,%ebx
+80108fda:	c1 fb 08             	sar    $0x8,%ebx
+  if(r->head - r->tail >= TRACERING){
+80108fdd:	69 db 0c 24 00 00    	imul   $0x240c,%ebx,%ebx
+80108fe3:	8b 83 c0 fa 18 80    	mov    -0x7fe70540(%ebx),%eax
+80108fe9:	8b 93 c4 fa 18 80    	mov    -0x7fe7053c(%ebx),%edx
+80108fef:	29 d0                	sub    %edx,%eax
+80108ff1:	3d ff 00 00 00       	cmp    $0xff,%eax
+80108ff6:	76 18                	jbe    80109010 <traceput+0x60>
+    __sync_fetch_and_add(&r->dropped, 1);
+80108ff8:	f0 83 83 c8 fa 18 80 	lock addl $0x1,-0x7fe70538(%ebx)
+80108fff:	01 
+}
+80109000:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109003:	5b                   	pop    %ebx
+80109004:	5e                   	pop    %esi
+80109005:	5f                   	pop    %edi
+80109006:	5d                   	pop    %ebp
+  popcli();
+80109007:	e9 24 df ff ff       	jmp    80106f30 <popcli>
+8010900c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    e = &r->ev[r->head % TRACERING];
+80109010:	8b 8b c0 fa 18 80    	mov    -0x7fe70540(%ebx),%ecx
+80109016:	0f b6 c9             	movzbl %cl,%ecx
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+80109019:	0f 31                	rdtsc
+    e->tsc = rdtsc();
+8010901b:	8d 3c c9             	lea    (%ecx,%ecx,8),%edi
+    safestrcpy(e->name, proc->name, sizeof(e->name));
+8010901e:	83 ec 04             	sub    $0x4,%esp
+    e->tsc = rdtsc();
+80109021:	c1 e7 02             	shl    $0x2,%edi
+80109024:	8d 8c 3b c0 fa 18 80 	lea    -0x7fe70540(%ebx,%edi,1),%ecx
+  return ((uint64)hi << 32) | lo;
+8010902b:	89 41 0c             	mov    %eax,0xc(%ecx)
+    e->pid = proc->pid;
+8010902e:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80109034:	89 51 10             	mov    %edx,0x10(%ecx)
+80109037:	8b 50 44             	mov    0x44(%eax),%edx
+    e->num = num;
+8010903a:	66 89 71 18          	mov    %si,0x18(%ecx)
+    safestrcpy(e->name, proc->name, sizeof(e->name));
+8010903e:	05 b0 00 00 00       	add    $0xb0,%eax
+    e->flags = flags;
+80109043:	0f b7 75 e0          	movzwl -0x20(%ebp),%esi
+    e->pid = proc->pid;
+80109047:	89 51 14             	mov    %edx,0x14(%ecx)
+    e->flags = flags;
+8010904a:	66 89 71 1a          	mov    %si,0x1a(%ecx)
+    e->ret = ret;
+8010904e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80109051:	89 71 1c             	mov    %esi,0x1c(%ecx)
+    safestrcpy(e->name, proc->name, sizeof(e->name));
+80109054:	6a 10                	push   $0x10
+80109056:	50                   	push   %eax
+80109057:	8d 84 3b e0 fa 18 80 	lea    -0x7fe70520(%ebx,%edi,1),%eax
+8010905e:	50                   	push   %eax
+8010905f:	e8 8c e3 ff ff       	call   801073f0 <safestrcpy>
+    r->head++;
+80109064:	83 c4 10             	add    $0x10,%esp
+    __sync_synchronize();  // the event is written before head moves
+80109067:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    r->head++;
+8010906c:	8b 83 c0 fa 18 80    	mov    -0x7fe70540(%ebx),%eax
+80109072:	83 c0 01             	add    $0x1,%eax
+80109075:	89 83 c0 fa 18 80    	mov    %eax,-0x7fe70540(%ebx)
+}
+8010907b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010907e:	5b                   	pop    %ebx
+8010907f:	5e                   	pop    %esi
+80109080:	5f                   	pop    %edi
+80109081:	5d                   	pop    %ebp
+  popcli();
+80109082:	e9 a9 de ff ff       	jmp    80106f30 <popcli>
+80109087:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010908e:	66 90                	xchg   %ax,%ax
+
+80109090 <tracedrain>:
+{
+80109090:	55                   	push   %ebp
+80109091:	89 e5                	mov    %esp,%ebp
+80109093:	57                   	push   %edi
+80109094:	56                   	push   %esi
+80109095:	53                   	push   %ebx
+80109096:	83 ec 28             	sub    $0x28,%esp
+  acquiresleep(&drainlock);
+80109099:	68 80 fa 18 80       	push   $0x8018fa80
+8010909e:	e8 cd db ff ff       	call   80106c70 <acquiresleep>
+  for(c = 0; c < ncpu && i < n; c++){
+801090a3:	8b 0d 84 e9 17 80    	mov    0x8017e984,%ecx
+801090a9:	83 c4 10             	add    $0x10,%esp
+801090ac:	85 c9                	test   %ecx,%ecx
+801090ae:	0f 8e 97 01 00 00    	jle    8010924b <tracedrain+0x1bb>
+801090b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+801090b7:	85 d2                	test   %edx,%edx
+801090b9:	0f 8e 8c 01 00 00    	jle    8010924b <tracedrain+0x1bb>
+801090bf:	be c8 fa 18 80       	mov    $0x8018fac8,%esi
+801090c4:	31 db                	xor    %ebx,%ebx
+  i = 0;
+801090c6:	31 ff                	xor    %edi,%edi
+801090c8:	eb 0b                	jmp    801090d5 <tracedrain+0x45>
+801090ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(c = 0; c < ncpu && i < n; c++){
+801090d0:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+801090d3:	7d 5b                	jge    80109130 <tracedrain+0xa0>
+    if(r->dropped == 0)
+801090d5:	69 c3 0c 24 00 00    	imul   $0x240c,%ebx,%eax
+801090db:	05 c0 fa 18 80       	add    $0x8018fac0,%eax
+801090e0:	8b 40 08             	mov    0x8(%eax),%eax
+801090e3:	85 c0                	test   %eax,%eax
+801090e5:	74 38                	je     8010911f <tracedrain+0x8f>
+    lost = __sync_lock_test_and_set(&r->dropped, 0);
+801090e7:	31 c9                	xor    %ecx,%ecx
+801090e9:	87 0e                	xchg   %ecx,(%esi)
+801090eb:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    memset(&ev[i], 0, sizeof(ev[i]));
+801090ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801090f1:	8d 04 ff             	lea    (%edi,%edi,8),%eax
+801090f4:	83 ec 04             	sub    $0x4,%esp
+801090f7:	6a 24                	push   $0x24
+    i++;
+801090f9:	83 c7 01             	add    $0x1,%edi
+    memset(&ev[i], 0, sizeof(ev[i]));
+801090fc:	8d 14 81             	lea    (%ecx,%eax,4),%edx
+801090ff:	6a 00                	push   $0x0
+80109101:	52                   	push   %edx
+80109102:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80109105:	e8 36 e1 ff ff       	call   80107240 <memset>
+    ev[i].flags = TRACE_LOST;
+8010910a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    ev[i].ret = lost;
+8010910d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    ev[i].flags = TRACE_LOST;
+80109110:	b8 02 00 00 00       	mov    $0x2,%eax
+    i++;
+80109115:	83 c4 10             	add    $0x10,%esp
+    ev[i].flags = TRACE_LOST;
+80109118:	66 89 42 0e          	mov    %ax,0xe(%edx)
+    ev[i].ret = lost;
+8010911c:	89 4a 10             	mov    %ecx,0x10(%edx)
+  for(c = 0; c < ncpu && i < n; c++){
+8010911f:	83 c3 01             	add    $0x1,%ebx
+80109122:	81 c6 0c 24 00 00    	add    $0x240c,%esi
+80109128:	39 1d 84 e9 17 80    	cmp    %ebx,0x8017e984
+8010912e:	7f a0                	jg     801090d0 <tracedrain+0x40>
+  while(i < n){
+80109130:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+80109133:	0f 8e fb 00 00 00    	jle    80109234 <tracedrain+0x1a4>
+80109139:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010913c:	8d 04 ff             	lea    (%edi,%edi,8),%eax
+8010913f:	89 fb                	mov    %edi,%ebx
+80109141:	8d 14 81             	lea    (%ecx,%eax,4),%edx
+80109144:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for(c = 0; c < ncpu; c++){
+80109148:	a1 84 e9 17 80       	mov    0x8017e984,%eax
+8010914d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80109150:	85 c0                	test   %eax,%eax
+80109152:	0f 8e da 00 00 00    	jle    80109232 <tracedrain+0x1a2>
+    first = 0;
+80109158:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    for(c = 0; c < ncpu; c++){
+8010915b:	31 c0                	xor    %eax,%eax
+    first = 0;
+8010915d:	31 c9                	xor    %ecx,%ecx
+8010915f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+80109162:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(r->tail != r->head &&
+80109168:	69 d0 0c 24 00 00    	imul   $0x240c,%eax,%edx
+8010916e:	8d 9a c0 fa 18 80    	lea    -0x7fe70540(%edx),%ebx
+80109174:	8b 7b 04             	mov    0x4(%ebx),%edi
+80109177:	8b b2 c0 fa 18 80    	mov    -0x7fe70540(%edx),%esi
+8010917d:	39 f7                	cmp    %esi,%edi
+8010917f:	74 3e                	je     801091bf <tracedrain+0x12f>
+80109181:	85 c9                	test   %ecx,%ecx
+80109183:	74 2e                	je     801091b3 <tracedrain+0x123>
+         (first == 0 || r->ev[r->tail % TRACERING].tsc <
+80109185:	8b 73 04             	mov    0x4(%ebx),%esi
+                        first->ev[first->tail % TRACERING].tsc))
+80109188:	8b 79 04             	mov    0x4(%ecx),%edi
+         (first == 0 || r->ev[r->tail % TRACERING].tsc <
+8010918b:	89 f3                	mov    %esi,%ebx
+8010918d:	0f b6 f3             	movzbl %bl,%esi
+                        first->ev[first->tail % TRACERING].tsc))
+80109190:	89 fb                	mov    %edi,%ebx
+80109192:	0f b6 db             	movzbl %bl,%ebx
+         (first == 0 || r->ev[r->tail % TRACERING].tsc <
+80109195:	8d 34 f6             	lea    (%esi,%esi,8),%esi
+80109198:	8d b4 b2 c0 fa 18 80 	lea    -0x7fe70540(%edx,%esi,4),%esi
+                        first->ev[first->tail % TRACERING].tsc))
+8010919f:	8d 14 db             	lea    (%ebx,%ebx,8),%edx
+801091a2:	8d 14 91             	lea    (%ecx,%edx,4),%edx
+         (first == 0 || r->ev[r->tail % TRACERING].tsc <
+801091a5:	8b 5e 10             	mov    0x10(%esi),%ebx
+801091a8:	8b 7a 0c             	mov    0xc(%edx),%edi
+801091ab:	39 7e 0c             	cmp    %edi,0xc(%esi)
+801091ae:	1b 5a 10             	sbb    0x10(%edx),%ebx
+801091b1:	73 0c                	jae    801091bf <tracedrain+0x12f>
+      r = &ring[c];
+801091b3:	69 c8 0c 24 00 00    	imul   $0x240c,%eax,%ecx
+801091b9:	81 c1 c0 fa 18 80    	add    $0x8018fac0,%ecx
+    for(c = 0; c < ncpu; c++){
+801091bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801091c2:	83 c0 01             	add    $0x1,%eax
+801091c5:	39 f8                	cmp    %edi,%eax
+801091c7:	75 9f                	jne    80109168 <tracedrain+0xd8>
+    if(first == 0)
+801091c9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801091cc:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+801091cf:	85 c9                	test   %ecx,%ecx
+801091d1:	74 5f                	je     80109232 <tracedrain+0x1a2>
+    ev[i++] = first->ev[first->tail % TRACERING];
+801091d3:	8b 41 04             	mov    0x4(%ecx),%eax
+801091d6:	83 c3 01             	add    $0x1,%ebx
+  while(i < n){
+801091d9:	83 c2 24             	add    $0x24,%edx
+    ev[i++] = first->ev[first->tail % TRACERING];
+801091dc:	0f b6 c0             	movzbl %al,%eax
+801091df:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+801091e2:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+801091e5:	8b 70 0c             	mov    0xc(%eax),%esi
+801091e8:	89 72 dc             	mov    %esi,-0x24(%edx)
+801091eb:	8b 70 10             	mov    0x10(%eax),%esi
+801091ee:	89 72 e0             	mov    %esi,-0x20(%edx)
+801091f1:	8b 70 14             	mov    0x14(%eax),%esi
+801091f4:	89 72 e4             	mov    %esi,-0x1c(%edx)
+801091f7:	8b 70 18             	mov    0x18(%eax),%esi
+801091fa:	89 72 e8             	mov    %esi,-0x18(%edx)
+801091fd:	8b 70 1c             	mov    0x1c(%eax),%esi
+80109200:	89 72 ec             	mov    %esi,-0x14(%edx)
+80109203:	8b 70 20             	mov    0x20(%eax),%esi
+80109206:	89 72 f0             	mov    %esi,-0x10(%edx)
+80109209:	8b 70 24             	mov    0x24(%eax),%esi
+8010920c:	89 72 f4             	mov    %esi,-0xc(%edx)
+8010920f:	8b 70 28             	mov    0x28(%eax),%esi
+80109212:	89 72 f8             	mov    %esi,-0x8(%edx)
+80109215:	8b 40 2c             	mov    0x2c(%eax),%eax
+80109218:	89 42 fc             	mov    %eax,-0x4(%edx)
+    __sync_synchronize();  // the event is copied before tail moves
+8010921b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    first->tail++;
+80109220:	8b 41 04             	mov    0x4(%ecx),%eax
+80109223:	83 c0 01             	add    $0x1,%eax
+80109226:	89 41 04             	mov    %eax,0x4(%ecx)
+  while(i < n){
+80109229:	39 5d 0c             	cmp    %ebx,0xc(%ebp)
+8010922c:	0f 85 16 ff ff ff    	jne    80109148 <tracedrain+0xb8>
+80109232:	89 df                	mov    %ebx,%edi
+  releasesleep(&drainlock);
+80109234:	83 ec 0c             	sub    $0xc,%esp
+80109237:	68 80 fa 18 80       	push   $0x8018fa80
+8010923c:	e8 8f da ff ff       	call   80106cd0 <releasesleep>
+}
+80109241:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109244:	89 f8                	mov    %edi,%eax
+80109246:	5b                   	pop    %ebx
+80109247:	5e                   	pop    %esi
+80109248:	5f                   	pop    %edi
+80109249:	5d                   	pop    %ebp
+8010924a:	c3                   	ret
+  i = 0;
+8010924b:	31 ff                	xor    %edi,%edi
+8010924d:	e9 de fe ff ff       	jmp    80109130 <tracedrain+0xa0>
+80109252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80109260 <tracecount>:
+
+// The current process's system call num returned ret after
+// taking cycles cycles.
+void
+tracecount(int num, int ret, uint64 cycles)
+{
+80109260:	55                   	push   %ebp
+80109261:	89 e5                	mov    %esp,%ebp
+80109263:	57                   	push   %edi
+80109264:	56                   	push   %esi
+80109265:	53                   	push   %ebx
+80109266:	83 ec 1c             	sub    $0x1c,%esp
+80109269:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010926c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010926f:	8b 75 10             	mov    0x10(%ebp),%esi
+80109272:	8b 7d 14             	mov    0x14(%ebp),%edi
+80109275:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(num >= NCALLSTAT)
+80109278:	83 fb 23             	cmp    $0x23,%ebx
+8010927b:	7e 0b                	jle    80109288 <tracecount+0x28>
+    return;
+  if(proc->callstat == 0 &&
+     (proc->callstat = (struct callstat*)kzalloc()) == 0)
+    return;
+  countcall(&proc->callstat[num], ret, cycles);
+}
+8010927d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109280:	5b                   	pop    %ebx
+80109281:	5e                   	pop    %esi
+80109282:	5f                   	pop    %edi
+80109283:	5d                   	pop    %ebp
+80109284:	c3                   	ret
+80109285:	8d 76 00             	lea    0x0(%esi),%esi
+  pushcli();
+80109288:	e8 73 dc ff ff       	call   80106f00 <pushcli>
+  countcall(&cpustat[cpu - cpus][num], ret, cycles);
+8010928d:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+80109294:	6b cb 70             	imul   $0x70,%ebx,%ecx
+80109297:	83 ec 08             	sub    $0x8,%esp
+8010929a:	81 ea c0 e9 17 80    	sub    $0x8017e9c0,%edx
+801092a0:	89 d0                	mov    %edx,%eax
+801092a2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+801092a5:	c1 f8 08             	sar    $0x8,%eax
+801092a8:	57                   	push   %edi
+801092a9:	69 c0 c0 0f 00 00    	imul   $0xfc0,%eax,%eax
+801092af:	56                   	push   %esi
+801092b0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801092b3:	8d 84 01 80 7c 18 80 	lea    -0x7fe78380(%ecx,%eax,1),%eax
+801092ba:	e8 01 fc ff ff       	call   80108ec0 <countcall>
+  popcli();
+801092bf:	e8 6c dc ff ff       	call   80106f30 <popcli>
+  if((proc->tracemask & TRACEBIT(num)) == 0)
+801092c4:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+801092ca:	89 d9                	mov    %ebx,%ecx
+801092cc:	8b 50 4c             	mov    0x4c(%eax),%edx
+801092cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801092d2:	8b 40 48             	mov    0x48(%eax),%eax
+801092d5:	0f ad d0             	shrd   %cl,%edx,%eax
+801092d8:	d3 ea                	shr    %cl,%edx
+801092da:	f6 c3 20             	test   $0x20,%bl
+801092dd:	0f 45 c2             	cmovne %edx,%eax
+801092e0:	83 c4 10             	add    $0x10,%esp
+801092e3:	83 e0 01             	and    $0x1,%eax
+801092e6:	83 c8 00             	or     $0x0,%eax
+801092e9:	74 92                	je     8010927d <tracecount+0x1d>
+  if(proc->callstat == 0 &&
+801092eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801092ee:	8b 40 54             	mov    0x54(%eax),%eax
+801092f1:	85 c0                	test   %eax,%eax
+801092f3:	74 1b                	je     80109310 <tracecount+0xb0>
+  countcall(&proc->callstat[num], ret, cycles);
+801092f5:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+801092f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801092fb:	89 75 08             	mov    %esi,0x8(%ebp)
+801092fe:	89 7d 0c             	mov    %edi,0xc(%ebp)
+}
+80109301:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  countcall(&proc->callstat[num], ret, cycles);
+80109304:	01 d8                	add    %ebx,%eax
+}
+80109306:	5b                   	pop    %ebx
+80109307:	5e                   	pop    %esi
+80109308:	5f                   	pop    %edi
+80109309:	5d                   	pop    %ebp
+  countcall(&proc->callstat[num], ret, cycles);
+8010930a:	e9 b1 fb ff ff       	jmp    80108ec0 <countcall>
+8010930f:	90                   	nop
+     (proc->callstat = (struct callstat*)kzalloc()) == 0)
+80109310:	e8 4b a6 ff ff       	call   80103960 <kzalloc>
+80109315:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80109318:	89 43 54             	mov    %eax,0x54(%ebx)
+  if(proc->callstat == 0 &&
+8010931b:	85 c0                	test   %eax,%eax
+8010931d:	0f 84 5a ff ff ff    	je     8010927d <tracecount+0x1d>
+  countcall(&proc->callstat[num], ret, cycles);
+80109323:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80109329:	8b 40 54             	mov    0x54(%eax),%eax
+8010932c:	eb c7                	jmp    801092f5 <tracecount+0x95>
+8010932e:	66 90                	xchg   %ax,%ax
+
+80109330 <tracereap>:
+
+// wait() is freeing zombie p: the current process, its parent,
+// takes over p's statistics.  Caller holds ptable.lock.
+void
+tracereap(struct proc *p)
+{
+80109330:	55                   	push   %ebp
+80109331:	89 e5                	mov    %esp,%ebp
+80109333:	53                   	push   %ebx
+80109334:	83 ec 04             	sub    $0x4,%esp
+80109337:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(p->callstat == 0)
+8010933a:	8b 53 54             	mov    0x54(%ebx),%edx
+8010933d:	85 d2                	test   %edx,%edx
+8010933f:	74 28                	je     80109369 <tracereap+0x39>
+    return;
+  if(proc->callstat == 0)
+80109341:	65 8b 0d 04 00 00 00 	mov    %gs:0x4,%ecx
+80109348:	8b 41 54             	mov    0x54(%ecx),%eax
+8010934b:	85 c0                	test   %eax,%eax
+8010934d:	74 21                	je     80109370 <tracereap+0x40>
+    proc->callstat = p->callstat;
+  else {
+    addstats(proc->callstat, p->callstat);
+8010934f:	e8 ec fb ff ff       	call   80108f40 <addstats>
+    kfree((char*)p->callstat);
+80109354:	83 ec 0c             	sub    $0xc,%esp
+80109357:	ff 73 54             	push   0x54(%ebx)
+8010935a:	e8 51 a2 ff ff       	call   801035b0 <kfree>
+8010935f:	83 c4 10             	add    $0x10,%esp
+  }
+  p->callstat = 0;
+80109362:	c7 43 54 00 00 00 00 	movl   $0x0,0x54(%ebx)
+}
+80109369:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010936c:	c9                   	leave
+8010936d:	c3                   	ret
+8010936e:	66 90                	xchg   %ax,%ax
+    proc->callstat = p->callstat;
+80109370:	89 51 54             	mov    %edx,0x54(%ecx)
+80109373:	eb ed                	jmp    80109362 <tracereap+0x32>
+80109375:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010937c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80109380 <tracestat>:
+// Copy the statistics of process pid, of the current process if
+// pid is 0, or of the whole system if pid is -1 into st, which
+// has room for NCALLSTAT.  Returns -1 if there is no such process.
+int
+tracestat(int pid, struct callstat *st)
+{
+80109380:	55                   	push   %ebp
+80109381:	89 e5                	mov    %esp,%ebp
+80109383:	57                   	push   %edi
+80109384:	56                   	push   %esi
+80109385:	53                   	push   %ebx
+80109386:	83 ec 10             	sub    $0x10,%esp
+80109389:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010938c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct callstat *buf;
+  int c;
+
+  memset(st, 0, NCALLSTAT*sizeof(*st));
+8010938f:	68 c0 0f 00 00       	push   $0xfc0
+80109394:	6a 00                	push   $0x0
+80109396:	56                   	push   %esi
+80109397:	e8 a4 de ff ff       	call   80107240 <memset>
+  if(pid == -1){
+8010939c:	83 c4 10             	add    $0x10,%esp
+8010939f:	83 ff ff             	cmp    $0xffffffff,%edi
+801093a2:	74 5c                	je     80109400 <tracestat+0x80>
+    for(c = 0; c < ncpu; c++)
+      addstats(st, cpustat[c]);
+    return 0;
+  }
+  if(pid == 0)
+801093a4:	85 ff                	test   %edi,%edi
+801093a6:	74 48                	je     801093f0 <tracestat+0x70>
+    pid = proc->pid;
+  // The statistics can go with their process once ptable.lock
+  // is released; copy them out while holding it.
+  if((buf = (struct callstat*)kalloc()) == 0)
+801093a8:	e8 a3 a4 ff ff       	call   80103850 <kalloc>
+801093ad:	89 c3                	mov    %eax,%ebx
+801093af:	85 c0                	test   %eax,%eax
+801093b1:	0f 84 81 00 00 00    	je     80109438 <tracestat+0xb8>
+    return -1;
+  if(procstat(pid, buf) < 0){
+801093b7:	83 ec 08             	sub    $0x8,%esp
+801093ba:	50                   	push   %eax
+801093bb:	57                   	push   %edi
+801093bc:	e8 ff d6 ff ff       	call   80106ac0 <procstat>
+801093c1:	83 c4 10             	add    $0x10,%esp
+801093c4:	85 c0                	test   %eax,%eax
+801093c6:	78 64                	js     8010942c <tracestat+0xac>
+    kfree((char*)buf);
+    return -1;
+  }
+  memmove(st, buf, NCALLSTAT*sizeof(*st));
+801093c8:	83 ec 04             	sub    $0x4,%esp
+801093cb:	68 c0 0f 00 00       	push   $0xfc0
+801093d0:	53                   	push   %ebx
+801093d1:	56                   	push   %esi
+801093d2:	e8 f9 de ff ff       	call   801072d0 <memmove>
+  kfree((char*)buf);
+801093d7:	89 1c 24             	mov    %ebx,(%esp)
+801093da:	e8 d1 a1 ff ff       	call   801035b0 <kfree>
+  return 0;
+801093df:	83 c4 10             	add    $0x10,%esp
+    return 0;
+801093e2:	31 c0                	xor    %eax,%eax
+}
+801093e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801093e7:	5b                   	pop    %ebx
+801093e8:	5e                   	pop    %esi
+801093e9:	5f                   	pop    %edi
+801093ea:	5d                   	pop    %ebp
+801093eb:	c3                   	ret
+801093ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    pid = proc->pid;
+801093f0:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+801093f6:	8b 78 44             	mov    0x44(%eax),%edi
+801093f9:	eb ad                	jmp    801093a8 <tracestat+0x28>
+801093fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801093ff:	90                   	nop
+    for(c = 0; c < ncpu; c++)
+80109400:	a1 84 e9 17 80       	mov    0x8017e984,%eax
+80109405:	bf 80 7c 18 80       	mov    $0x80187c80,%edi
+8010940a:	31 db                	xor    %ebx,%ebx
+8010940c:	85 c0                	test   %eax,%eax
+8010940e:	7e d2                	jle    801093e2 <tracestat+0x62>
+      addstats(st, cpustat[c]);
+80109410:	89 fa                	mov    %edi,%edx
+80109412:	89 f0                	mov    %esi,%eax
+    for(c = 0; c < ncpu; c++)
+80109414:	83 c3 01             	add    $0x1,%ebx
+80109417:	81 c7 c0 0f 00 00    	add    $0xfc0,%edi
+      addstats(st, cpustat[c]);
+8010941d:	e8 1e fb ff ff       	call   80108f40 <addstats>
+    for(c = 0; c < ncpu; c++)
+80109422:	39 1d 84 e9 17 80    	cmp    %ebx,0x8017e984
+80109428:	7f e6                	jg     80109410 <tracestat+0x90>
+8010942a:	eb b6                	jmp    801093e2 <tracestat+0x62>
+    kfree((char*)buf);
+8010942c:	83 ec 0c             	sub    $0xc,%esp
+8010942f:	53                   	push   %ebx
+80109430:	e8 7b a1 ff ff       	call   801035b0 <kfree>
+    return -1;
+80109435:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80109438:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010943d:	eb a5                	jmp    801093e4 <tracestat+0x64>
+
+8010943f <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+8010943f:	1e                   	push   %ds
+  pushl %es
+80109440:	06                   	push   %es
+  pushl %fs
+80109441:	0f a0                	push   %fs
+  pushl %gs
+80109443:	0f a8                	push   %gs
+  pushal
+80109445:	60                   	pusha
+  
+  # Set up data and per-cpu segments.
+  movw $(SEG_KDATA<<3), %ax
+80109446:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+8010944a:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+8010944c:	8e c0                	mov    %eax,%es
+  movw $(SEG_KCPU<<3), %ax
+8010944e:	66 b8 18 00          	mov    $0x18,%ax
+  movw %ax, %fs
+80109452:	8e e0                	mov    %eax,%fs
+  movw %ax, %gs
+80109454:	8e e8                	mov    %eax,%gs
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+80109456:	54                   	push   %esp
+  call trap
+80109457:	e8 c4 00 00 00       	call   80109520 <trap>
+  addl $4, %esp
+8010945c:	83 c4 04             	add    $0x4,%esp
+
+8010945f <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+8010945f:	61                   	popa
+  popl %gs
+80109460:	0f a9                	pop    %gs
+  popl %fs
+80109462:	0f a1                	pop    %fs
+  popl %es
+80109464:	07                   	pop    %es
+  popl %ds
+80109465:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+80109466:	83 c4 08             	add    $0x8,%esp
+  iret
+80109469:	cf                   	iret
+8010946a:	66 90                	xchg   %ax,%ax
+8010946c:	66 90                	xchg   %ax,%ax
+8010946e:	66 90                	xchg   %ax,%ax
+
+80109470 <tvinit>:
+struct spinlock tickslock;
+uint ticks;
+
+void
+tvinit(void)
+{
+80109470:	55                   	push   %ebp
+  int i;
+
+  for(i = 0; i < 256; i++)
+80109471:	31 c0                	xor    %eax,%eax
+{
+80109473:	89 e5                	mov    %esp,%ebp
+80109475:	83 ec 08             	sub    $0x8,%esp
+80109478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010947f:	90                   	nop
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80109480:	8b 14 85 0c e0 10 80 	mov    -0x7fef1ff4(,%eax,4),%edx
+80109487:	c7 04 c5 82 1b 1a 80 	movl   $0x8e000008,-0x7fe5e47e(,%eax,8)
+8010948e:	08 00 00 8e 
+80109492:	66 89 14 c5 80 1b 1a 	mov    %dx,-0x7fe5e480(,%eax,8)
+80109499:	80 
+8010949a:	c1 ea 10             	shr    $0x10,%edx
+8010949d:	66 89 14 c5 86 1b 1a 	mov    %dx,-0x7fe5e47a(,%eax,8)
+801094a4:	80 
+  for(i = 0; i < 256; i++)
+801094a5:	83 c0 01             	add    $0x1,%eax
+801094a8:	3d 00 01 00 00       	cmp    $0x100,%eax
+801094ad:	75 d1                	jne    80109480 <tvinit+0x10>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+801094af:	a1 0c e1 10 80       	mov    0x8010e10c,%eax
+
+  initlock(&tickslock, "time");
+801094b4:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+801094b7:	c7 05 82 1d 1a 80 08 	movl   $0xef000008,0x801a1d82
+801094be:	00 00 ef 
+801094c1:	66 a3 80 1d 1a 80    	mov    %ax,0x801a1d80
+801094c7:	c1 e8 10             	shr    $0x10,%eax
+801094ca:	66 a3 86 1d 1a 80    	mov    %ax,0x801a1d86
+  initlock(&tickslock, "time");
+801094d0:	68 b4 bc 10 80       	push   $0x8010bcb4
+801094d5:	68 40 1b 1a 80       	push   $0x801a1b40
+801094da:	e8 61 d8 ff ff       	call   80106d40 <initlock>
+}
+801094df:	83 c4 10             	add    $0x10,%esp
+801094e2:	c9                   	leave
+801094e3:	c3                   	ret
+801094e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801094eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801094ef:	90                   	nop
+
+801094f0 <idtinit>:
+
+void
+idtinit(void)
+{
+801094f0:	55                   	push   %ebp
+  pd[0] = size-1;
+801094f1:	b8 ff 07 00 00       	mov    $0x7ff,%eax
+801094f6:	89 e5                	mov    %esp,%ebp
+801094f8:	83 ec 10             	sub    $0x10,%esp
+801094fb:	66 89 45 fa          	mov    %ax,-0x6(%ebp)
+  pd[1] = (uint)p;
+801094ff:	b8 80 1b 1a 80       	mov    $0x801a1b80,%eax
+80109504:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80109508:	c1 e8 10             	shr    $0x10,%eax
+8010950b:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+8010950f:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80109512:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80109515:	c9                   	leave
+80109516:	c3                   	ret
+80109517:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010951e:	66 90                	xchg   %ax,%ax
+
+80109520 <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80109520:	55                   	push   %ebp
+80109521:	89 e5                	mov    %esp,%ebp
+80109523:	57                   	push   %edi
+80109524:	56                   	push   %esi
+80109525:	53                   	push   %ebx
+80109526:	83 ec 0c             	sub    $0xc,%esp
+80109529:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+8010952c:	8b 43 30             	mov    0x30(%ebx),%eax
+8010952f:	83 f8 40             	cmp    $0x40,%eax
+80109532:	0f 84 28 01 00 00    	je     80109660 <trap+0x140>
+    if(proc->killed)
+      exit();
+    return;
+  }
+
+  switch(tf->trapno){
+80109538:	83 e8 0e             	sub    $0xe,%eax
+8010953b:	83 f8 31             	cmp    $0x31,%eax
+8010953e:	0f 87 94 00 00 00    	ja     801095d8 <trap+0xb8>
+80109544:	ff 24 85 5c bd 10 80 	jmp    *-0x7fef42a4(,%eax,4)
+8010954b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010954f:	90                   	nop
+#endif
+    }
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+80109550:	e8 4b 9b ff ff       	call   801030a0 <ideintr>
+    lapiceoi();
+80109555:	e8 46 a8 ff ff       	call   80103da0 <lapiceoi>
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(proc && proc->killed && (tf->cs&3) == DPL_USER)
+8010955a:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80109560:	85 c0                	test   %eax,%eax
+80109562:	74 2d                	je     80109591 <trap+0x71>
+80109564:	8b 50 68             	mov    0x68(%eax),%edx
+80109567:	85 d2                	test   %edx,%edx
+80109569:	0f 85 c2 00 00 00    	jne    80109631 <trap+0x111>
+    exit();
+
+  // Force process to give up CPU on clock tick once its time
+  // slice is used up.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER &&
+8010956f:	83 78 40 04          	cmpl   $0x4,0x40(%eax)
+80109573:	0f 84 bf 01 00 00    	je     80109738 <trap+0x218>
+    proc->swappable = (tf->cs&3) == DPL_USER;
+    yield();
+  }
+
+  // Check if the process has been killed since we yielded
+  if(proc && proc->killed && (tf->cs&3) == DPL_USER)
+80109579:	8b 40 68             	mov    0x68(%eax),%eax
+8010957c:	85 c0                	test   %eax,%eax
+8010957e:	74 11                	je     80109591 <trap+0x71>
+80109580:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109584:	83 e0 03             	and    $0x3,%eax
+80109587:	66 83 f8 03          	cmp    $0x3,%ax
+8010958b:	0f 84 f5 00 00 00    	je     80109686 <trap+0x166>
+    exit();
+}
+80109591:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109594:	5b                   	pop    %ebx
+80109595:	5e                   	pop    %esi
+80109596:	5f                   	pop    %edi
+80109597:	5d                   	pop    %ebp
+80109598:	c3                   	ret
+80109599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    statinc(ST_PGFAULT);
+801095a0:	83 ec 0c             	sub    $0xc,%esp
+801095a3:	6a 01                	push   $0x1
+801095a5:	e8 56 dc ff ff       	call   80107200 <statinc>
+    if(proc && pgfault(rcr2(), tf->err) == 0)
+801095aa:	65 8b 35 04 00 00 00 	mov    %gs:0x4,%esi
+801095b1:	83 c4 10             	add    $0x10,%esp
+801095b4:	85 f6                	test   %esi,%esi
+801095b6:	0f 84 a4 01 00 00    	je     80109760 <trap+0x240>
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+801095bc:	0f 20 d0             	mov    %cr2,%eax
+801095bf:	83 ec 08             	sub    $0x8,%esp
+801095c2:	ff 73 34             	push   0x34(%ebx)
+801095c5:	50                   	push   %eax
+801095c6:	e8 a5 1a 00 00       	call   8010b070 <pgfault>
+801095cb:	83 c4 10             	add    $0x10,%esp
+801095ce:	85 c0                	test   %eax,%eax
+801095d0:	74 88                	je     8010955a <trap+0x3a>
+801095d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(proc == 0 || (tf->cs&3) == 0){
+801095d8:	65 8b 0d 04 00 00 00 	mov    %gs:0x4,%ecx
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801095df:	8b 73 38             	mov    0x38(%ebx),%esi
+    if(proc == 0 || (tf->cs&3) == 0){
+801095e2:	85 c9                	test   %ecx,%ecx
+801095e4:	0f 84 79 01 00 00    	je     80109763 <trap+0x243>
+801095ea:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+801095ee:	0f 84 6f 01 00 00    	je     80109763 <trap+0x243>
+801095f4:	0f 20 d7             	mov    %cr2,%edi
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801095f7:	e8 14 a7 ff ff       	call   80103d10 <cpunum>
+801095fc:	89 c2                	mov    %eax,%edx
+            proc->pid, proc->name, tf->trapno, tf->err, cpunum(), tf->eip,
+801095fe:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109604:	57                   	push   %edi
+80109605:	56                   	push   %esi
+80109606:	52                   	push   %edx
+            proc->pid, proc->name, tf->trapno, tf->err, cpunum(), tf->eip,
+80109607:	8d 90 b0 00 00 00    	lea    0xb0(%eax),%edx
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+8010960d:	ff 73 34             	push   0x34(%ebx)
+80109610:	ff 73 30             	push   0x30(%ebx)
+80109613:	52                   	push   %edx
+80109614:	ff 70 44             	push   0x44(%eax)
+80109617:	68 18 bd 10 80       	push   $0x8010bd18
+8010961c:	e8 cf 78 ff ff       	call   80100ef0 <cprintf>
+    proc->killed = 1;
+80109621:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80109627:	83 c4 20             	add    $0x20,%esp
+8010962a:	c7 40 68 01 00 00 00 	movl   $0x1,0x68(%eax)
+  if(proc && proc->killed && (tf->cs&3) == DPL_USER)
+80109631:	0f b7 53 3c          	movzwl 0x3c(%ebx),%edx
+80109635:	83 e2 03             	and    $0x3,%edx
+80109638:	66 83 fa 03          	cmp    $0x3,%dx
+8010963c:	0f 85 2d ff ff ff    	jne    8010956f <trap+0x4f>
+    exit();
+80109642:	e8 f9 d0 ff ff       	call   80106740 <exit>
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER &&
+80109647:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+8010964d:	85 c0                	test   %eax,%eax
+8010964f:	0f 85 1a ff ff ff    	jne    8010956f <trap+0x4f>
+80109655:	e9 37 ff ff ff       	jmp    80109591 <trap+0x71>
+8010965a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(proc->killed)
+80109660:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80109666:	8b 50 68             	mov    0x68(%eax),%edx
+80109669:	85 d2                	test   %edx,%edx
+8010966b:	75 2b                	jne    80109698 <trap+0x178>
+    proc->tf = tf;
+8010966d:	89 58 5c             	mov    %ebx,0x5c(%eax)
+    syscall();
+80109670:	e8 4b e7 ff ff       	call   80107dc0 <syscall>
+    if(proc->killed)
+80109675:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+8010967b:	8b 78 68             	mov    0x68(%eax),%edi
+8010967e:	85 ff                	test   %edi,%edi
+80109680:	0f 84 0b ff ff ff    	je     80109591 <trap+0x71>
+}
+80109686:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109689:	5b                   	pop    %ebx
+8010968a:	5e                   	pop    %esi
+8010968b:	5f                   	pop    %edi
+8010968c:	5d                   	pop    %ebp
+      exit();
+8010968d:	e9 ae d0 ff ff       	jmp    80106740 <exit>
+80109692:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      exit();
+80109698:	e8 a3 d0 ff ff       	call   80106740 <exit>
+    proc->tf = tf;
+8010969d:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+801096a3:	eb c8                	jmp    8010966d <trap+0x14d>
+801096a5:	8d 76 00             	lea    0x0(%esi),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+801096a8:	8b 7b 38             	mov    0x38(%ebx),%edi
+801096ab:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+801096af:	e8 5c a6 ff ff       	call   80103d10 <cpunum>
+801096b4:	57                   	push   %edi
+801096b5:	56                   	push   %esi
+801096b6:	50                   	push   %eax
+801096b7:	68 c0 bc 10 80       	push   $0x8010bcc0
+801096bc:	e8 2f 78 ff ff       	call   80100ef0 <cprintf>
+    lapiceoi();
+801096c1:	e8 da a6 ff ff       	call   80103da0 <lapiceoi>
+    break;
+801096c6:	83 c4 10             	add    $0x10,%esp
+801096c9:	e9 8c fe ff ff       	jmp    8010955a <trap+0x3a>
+801096ce:	66 90                	xchg   %ax,%ax
+    uartintr();
+801096d0:	e8 7b 02 00 00       	call   80109950 <uartintr>
+    lapiceoi();
+801096d5:	e8 c6 a6 ff ff       	call   80103da0 <lapiceoi>
+    break;
+801096da:	e9 7b fe ff ff       	jmp    8010955a <trap+0x3a>
+801096df:	90                   	nop
+    kbdintr();
+801096e0:	e8 0b a5 ff ff       	call   80103bf0 <kbdintr>
+    lapiceoi();
+801096e5:	e8 b6 a6 ff ff       	call   80103da0 <lapiceoi>
+    break;
+801096ea:	e9 6b fe ff ff       	jmp    8010955a <trap+0x3a>
+801096ef:	90                   	nop
+    if(cpunum() == 0){
+801096f0:	e8 1b a6 ff ff       	call   80103d10 <cpunum>
+801096f5:	85 c0                	test   %eax,%eax
+801096f7:	0f 85 58 fe ff ff    	jne    80109555 <trap+0x35>
+      acquire(&tickslock);
+801096fd:	83 ec 0c             	sub    $0xc,%esp
+80109700:	68 40 1b 1a 80       	push   $0x801a1b40
+80109705:	e8 56 d6 ff ff       	call   80106d60 <acquire>
+      ticks++;
+8010970a:	83 05 20 1b 1a 80 01 	addl   $0x1,0x801a1b20
+      wakeup(&ticks);
+80109711:	c7 04 24 20 1b 1a 80 	movl   $0x801a1b20,(%esp)
+80109718:	e8 c3 cf ff ff       	call   801066e0 <wakeup>
+      release(&tickslock);
+8010971d:	c7 04 24 40 1b 1a 80 	movl   $0x801a1b40,(%esp)
+80109724:	e8 57 d8 ff ff       	call   80106f80 <release>
+80109729:	83 c4 10             	add    $0x10,%esp
+    lapiceoi();
+8010972c:	e9 24 fe ff ff       	jmp    80109555 <trap+0x35>
+80109731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER &&
+80109738:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+8010973c:	0f 85 37 fe ff ff    	jne    80109579 <trap+0x59>
+     timeslice()){
+80109742:	e8 b9 cd ff ff       	call   80106500 <timeslice>
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER &&
+80109747:	85 c0                	test   %eax,%eax
+80109749:	75 45                	jne    80109790 <trap+0x270>
+  if(proc && proc->killed && (tf->cs&3) == DPL_USER)
+8010974b:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+80109751:	85 c0                	test   %eax,%eax
+80109753:	0f 85 20 fe ff ff    	jne    80109579 <trap+0x59>
+80109759:	e9 33 fe ff ff       	jmp    80109591 <trap+0x71>
+8010975e:	66 90                	xchg   %ax,%ax
+80109760:	8b 73 38             	mov    0x38(%ebx),%esi
+80109763:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80109766:	e8 a5 a5 ff ff       	call   80103d10 <cpunum>
+8010976b:	83 ec 0c             	sub    $0xc,%esp
+8010976e:	57                   	push   %edi
+8010976f:	56                   	push   %esi
+80109770:	50                   	push   %eax
+80109771:	ff 73 30             	push   0x30(%ebx)
+80109774:	68 e4 bc 10 80       	push   $0x8010bce4
+80109779:	e8 72 77 ff ff       	call   80100ef0 <cprintf>
+      panic("trap");
+8010977e:	83 c4 14             	add    $0x14,%esp
+80109781:	68 b9 bc 10 80       	push   $0x8010bcb9
+80109786:	e8 35 74 ff ff       	call   80100bc0 <panic>
+8010978b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010978f:	90                   	nop
+    proc->swappable = (tf->cs&3) == DPL_USER;
+80109790:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109794:	31 d2                	xor    %edx,%edx
+80109796:	83 e0 03             	and    $0x3,%eax
+80109799:	66 83 f8 03          	cmp    $0x3,%ax
+8010979d:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+801097a3:	0f 94 c2             	sete   %dl
+801097a6:	89 90 0c 01 00 00    	mov    %edx,0x10c(%eax)
+    yield();
+801097ac:	e8 0f cd ff ff       	call   801064c0 <yield>
+801097b1:	eb 98                	jmp    8010974b <trap+0x22b>
+801097b3:	66 90                	xchg   %ax,%ax
+801097b5:	66 90                	xchg   %ax,%ax
+801097b7:	66 90                	xchg   %ax,%ax
+801097b9:	66 90                	xchg   %ax,%ax
+801097bb:	66 90                	xchg   %ax,%ax
+801097bd:	66 90                	xchg   %ax,%ax
+801097bf:	90                   	nop
+
+801097c0 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+801097c0:	a1 80 23 1a 80       	mov    0x801a2380,%eax
+801097c5:	85 c0                	test   %eax,%eax
+801097c7:	74 17                	je     801097e0 <uartgetc+0x20>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801097c9:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801097ce:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+801097cf:	a8 01                	test   $0x1,%al
+801097d1:	74 0d                	je     801097e0 <uartgetc+0x20>
+801097d3:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801097d8:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+801097d9:	0f b6 c0             	movzbl %al,%eax
+801097dc:	c3                   	ret
+801097dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+801097e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801097e5:	c3                   	ret
+801097e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801097ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801097f0 <uartinit>:
+{
+801097f0:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801097f1:	31 c9                	xor    %ecx,%ecx
+801097f3:	89 c8                	mov    %ecx,%eax
+801097f5:	89 e5                	mov    %esp,%ebp
+801097f7:	57                   	push   %edi
+801097f8:	bf fa 03 00 00       	mov    $0x3fa,%edi
+801097fd:	56                   	push   %esi
+801097fe:	89 fa                	mov    %edi,%edx
+80109800:	53                   	push   %ebx
+80109801:	83 ec 1c             	sub    $0x1c,%esp
+80109804:	ee                   	out    %al,(%dx)
+80109805:	be fb 03 00 00       	mov    $0x3fb,%esi
+8010980a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+8010980f:	89 f2                	mov    %esi,%edx
+80109811:	ee                   	out    %al,(%dx)
+80109812:	b8 0c 00 00 00       	mov    $0xc,%eax
+80109817:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010981c:	ee                   	out    %al,(%dx)
+8010981d:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80109822:	89 c8                	mov    %ecx,%eax
+80109824:	89 da                	mov    %ebx,%edx
+80109826:	ee                   	out    %al,(%dx)
+80109827:	b8 03 00 00 00       	mov    $0x3,%eax
+8010982c:	89 f2                	mov    %esi,%edx
+8010982e:	ee                   	out    %al,(%dx)
+8010982f:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80109834:	89 c8                	mov    %ecx,%eax
+80109836:	ee                   	out    %al,(%dx)
+80109837:	b8 01 00 00 00       	mov    $0x1,%eax
+8010983c:	89 da                	mov    %ebx,%edx
+8010983e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010983f:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109844:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80109845:	3c ff                	cmp    $0xff,%al
+80109847:	0f 84 8c 00 00 00    	je     801098d9 <uartinit+0xe9>
+  uart = 1;
+8010984d:	c7 05 80 23 1a 80 01 	movl   $0x1,0x801a2380
+80109854:	00 00 00 
+80109857:	89 fa                	mov    %edi,%edx
+80109859:	ec                   	in     (%dx),%al
+8010985a:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010985f:	ec                   	in     (%dx),%al
+  picenable(IRQ_COM1);
+80109860:	83 ec 0c             	sub    $0xc,%esp
+  for(p="xv6...\n"; *p; p++)
+80109863:	bf 24 be 10 80       	mov    $0x8010be24,%edi
+80109868:	be fd 03 00 00       	mov    $0x3fd,%esi
+  picenable(IRQ_COM1);
+8010986d:	6a 04                	push   $0x4
+8010986f:	e8 2c ba ff ff       	call   801052a0 <picenable>
+  ioapicenable(IRQ_COM1, 0);
+80109874:	5a                   	pop    %edx
+80109875:	59                   	pop    %ecx
+80109876:	6a 00                	push   $0x0
+80109878:	6a 04                	push   $0x4
+8010987a:	e8 01 9c ff ff       	call   80103480 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+8010987f:	c6 45 e7 78          	movb   $0x78,-0x19(%ebp)
+  ioapicenable(IRQ_COM1, 0);
+80109883:	83 c4 10             	add    $0x10,%esp
+80109886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010988d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!uart)
+80109890:	a1 80 23 1a 80       	mov    0x801a2380,%eax
+80109895:	85 c0                	test   %eax,%eax
+80109897:	74 32                	je     801098cb <uartinit+0xdb>
+80109899:	89 f2                	mov    %esi,%edx
+8010989b:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+8010989c:	a8 20                	test   $0x20,%al
+8010989e:	75 21                	jne    801098c1 <uartinit+0xd1>
+801098a0:	bb 80 00 00 00       	mov    $0x80,%ebx
+801098a5:	8d 76 00             	lea    0x0(%esi),%esi
+    microdelay(10);
+801098a8:	83 ec 0c             	sub    $0xc,%esp
+801098ab:	6a 0a                	push   $0xa
+801098ad:	e8 0e a5 ff ff       	call   80103dc0 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+801098b2:	83 c4 10             	add    $0x10,%esp
+801098b5:	83 eb 01             	sub    $0x1,%ebx
+801098b8:	74 07                	je     801098c1 <uartinit+0xd1>
+801098ba:	89 f2                	mov    %esi,%edx
+801098bc:	ec                   	in     (%dx),%al
+801098bd:	a8 20                	test   $0x20,%al
+801098bf:	74 e7                	je     801098a8 <uartinit+0xb8>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801098c1:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801098c6:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+801098ca:	ee                   	out    %al,(%dx)
+  for(p="xv6...\n"; *p; p++)
+801098cb:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+801098cf:	83 c7 01             	add    $0x1,%edi
+801098d2:	88 45 e7             	mov    %al,-0x19(%ebp)
+801098d5:	84 c0                	test   %al,%al
+801098d7:	75 b7                	jne    80109890 <uartinit+0xa0>
+}
+801098d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801098dc:	5b                   	pop    %ebx
+801098dd:	5e                   	pop    %esi
+801098de:	5f                   	pop    %edi
+801098df:	5d                   	pop    %ebp
+801098e0:	c3                   	ret
+801098e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801098e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801098ef:	90                   	nop
+
+801098f0 <uartputc>:
+  if(!uart)
+801098f0:	a1 80 23 1a 80       	mov    0x801a2380,%eax
+801098f5:	85 c0                	test   %eax,%eax
+801098f7:	74 4f                	je     80109948 <uartputc+0x58>
+{
+801098f9:	55                   	push   %ebp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801098fa:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801098ff:	89 e5                	mov    %esp,%ebp
+80109901:	56                   	push   %esi
+80109902:	53                   	push   %ebx
+80109903:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109904:	a8 20                	test   $0x20,%al
+80109906:	75 29                	jne    80109931 <uartputc+0x41>
+80109908:	bb 80 00 00 00       	mov    $0x80,%ebx
+8010990d:	be fd 03 00 00       	mov    $0x3fd,%esi
+80109912:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    microdelay(10);
+80109918:	83 ec 0c             	sub    $0xc,%esp
+8010991b:	6a 0a                	push   $0xa
+8010991d:	e8 9e a4 ff ff       	call   80103dc0 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109922:	83 c4 10             	add    $0x10,%esp
+80109925:	83 eb 01             	sub    $0x1,%ebx
+80109928:	74 07                	je     80109931 <uartputc+0x41>
+8010992a:	89 f2                	mov    %esi,%edx
+8010992c:	ec                   	in     (%dx),%al
+8010992d:	a8 20                	test   $0x20,%al
+8010992f:	74 e7                	je     80109918 <uartputc+0x28>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109931:	8b 45 08             	mov    0x8(%ebp),%eax
+80109934:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109939:	ee                   	out    %al,(%dx)
+}
+8010993a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010993d:	5b                   	pop    %ebx
+8010993e:	5e                   	pop    %esi
+8010993f:	5d                   	pop    %ebp
+80109940:	c3                   	ret
+80109941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109948:	c3                   	ret
+80109949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80109950 <uartintr>:
+
+void
+uartintr(void)
+{
+80109950:	55                   	push   %ebp
+80109951:	89 e5                	mov    %esp,%ebp
+80109953:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+80109956:	68 c0 97 10 80       	push   $0x801097c0
+8010995b:	e8 a0 77 ff ff       	call   80101100 <consoleintr>
+}
+80109960:	83 c4 10             	add    $0x10,%esp
+80109963:	c9                   	leave
+80109964:	c3                   	ret
+
+80109965 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+80109965:	6a 00                	push   $0x0
+  pushl $0
+80109967:	6a 00                	push   $0x0
+  jmp alltraps
+80109969:	e9 d1 fa ff ff       	jmp    8010943f <alltraps>
+
+8010996e <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+8010996e:	6a 00                	push   $0x0
+  pushl $1
+80109970:	6a 01                	push   $0x1
+  jmp alltraps
+80109972:	e9 c8 fa ff ff       	jmp    8010943f <alltraps>
+
+80109977 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80109977:	6a 00                	push   $0x0
+  pushl $2
+80109979:	6a 02                	push   $0x2
+  jmp alltraps
+8010997b:	e9 bf fa ff ff       	jmp    8010943f <alltraps>
+
+80109980 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+80109980:	6a 00                	push   $0x0
+  pushl $3
+80109982:	6a 03                	push   $0x3
+  jmp alltraps
+80109984:	e9 b6 fa ff ff       	jmp    8010943f <alltraps>
+
+80109989 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+80109989:	6a 00                	push   $0x0
+  pushl $4
+8010998b:	6a 04                	push   $0x4
+  jmp alltraps
+8010998d:	e9 ad fa ff ff       	jmp    8010943f <alltraps>
+
+80109992 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+80109992:	6a 00                	push   $0x0
+  pushl $5
+80109994:	6a 05                	push   $0x5
+  jmp alltraps
+80109996:	e9 a4 fa ff ff       	jmp    8010943f <alltraps>
+
+8010999b <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+8010999b:	6a 00                	push   $0x0
+  pushl $6
+8010999d:	6a 06                	push   $0x6
+  jmp alltraps
+8010999f:	e9 9b fa ff ff       	jmp    8010943f <alltraps>
+
+801099a4 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+801099a4:	6a 00                	push   $0x0
+  pushl $7
+801099a6:	6a 07                	push   $0x7
+  jmp alltraps
+801099a8:	e9 92 fa ff ff       	jmp    8010943f <alltraps>
+
+801099ad <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+801099ad:	6a 08                	push   $0x8
+  jmp alltraps
+801099af:	e9 8b fa ff ff       	jmp    8010943f <alltraps>
+
+801099b4 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+801099b4:	6a 00                	push   $0x0
+  pushl $9
+801099b6:	6a 09                	push   $0x9
+  jmp alltraps
+801099b8:	e9 82 fa ff ff       	jmp    8010943f <alltraps>
+
+801099bd <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+801099bd:	6a 0a                	push   $0xa
+  jmp alltraps
+801099bf:	e9 7b fa ff ff       	jmp    8010943f <alltraps>
+
+801099c4 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+801099c4:	6a 0b                	push   $0xb
+  jmp alltraps
+801099c6:	e9 74 fa ff ff       	jmp    8010943f <alltraps>
+
+801099cb <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+801099cb:	6a 0c                	push   $0xc
+  jmp alltraps
+801099cd:	e9 6d fa ff ff       	jmp    8010943f <alltraps>
+
+801099d2 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+801099d2:	6a 0d                	push   $0xd
+  jmp alltraps
+801099d4:	e9 66 fa ff ff       	jmp    8010943f <alltraps>
+
+801099d9 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+801099d9:	6a 0e                	push   $0xe
+  jmp alltraps
+801099db:	e9 5f fa ff ff       	jmp    8010943f <alltraps>
+
+801099e0 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+801099e0:	6a 00                	push   $0x0
+  pushl $15
+801099e2:	6a 0f                	push   $0xf
+  jmp alltraps
+801099e4:	e9 56 fa ff ff       	jmp    8010943f <alltraps>
+
+801099e9 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+801099e9:	6a 00                	push   $0x0
+  pushl $16
+801099eb:	6a 10                	push   $0x10
+  jmp alltraps
+801099ed:	e9 4d fa ff ff       	jmp    8010943f <alltraps>
+
+801099f2 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+801099f2:	6a 11                	push   $0x11
+  jmp alltraps
+801099f4:	e9 46 fa ff ff       	jmp    8010943f <alltraps>
+
+801099f9 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+801099f9:	6a 00                	push   $0x0
+  pushl $18
+801099fb:	6a 12                	push   $0x12
+  jmp alltraps
+801099fd:	e9 3d fa ff ff       	jmp    8010943f <alltraps>
+
+80109a02 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80109a02:	6a 00                	push   $0x0
+  pushl $19
+80109a04:	6a 13                	push   $0x13
+  jmp alltraps
+80109a06:	e9 34 fa ff ff       	jmp    8010943f <alltraps>
+
+80109a0b <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+80109a0b:	6a 00                	push   $0x0
+  pushl $20
+80109a0d:	6a 14                	push   $0x14
+  jmp alltraps
+80109a0f:	e9 2b fa ff ff       	jmp    8010943f <alltraps>
+
+80109a14 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80109a14:	6a 00                	push   $0x0
+  pushl $21
+80109a16:	6a 15                	push   $0x15
+  jmp alltraps
+80109a18:	e9 22 fa ff ff       	jmp    8010943f <alltraps>
+
+80109a1d <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+80109a1d:	6a 00                	push   $0x0
+  pushl $22
+80109a1f:	6a 16                	push   $0x16
+  jmp alltraps
+80109a21:	e9 19 fa ff ff       	jmp    8010943f <alltraps>
+
+80109a26 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80109a26:	6a 00                	push   $0x0
+  pushl $23
+80109a28:	6a 17                	push   $0x17
+  jmp alltraps
+80109a2a:	e9 10 fa ff ff       	jmp    8010943f <alltraps>
+
+80109a2f <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+80109a2f:	6a 00                	push   $0x0
+  pushl $24
+80109a31:	6a 18                	push   $0x18
+  jmp alltraps
+80109a33:	e9 07 fa ff ff       	jmp    8010943f <alltraps>
+
+80109a38 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+80109a38:	6a 00                	push   $0x0
+  pushl $25
+80109a3a:	6a 19                	push   $0x19
+  jmp alltraps
+80109a3c:	e9 fe f9 ff ff       	jmp    8010943f <alltraps>
+
+80109a41 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+80109a41:	6a 00                	push   $0x0
+  pushl $26
+80109a43:	6a 1a                	push   $0x1a
+  jmp alltraps
+80109a45:	e9 f5 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109a4a <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+80109a4a:	6a 00                	push   $0x0
+  pushl $27
+80109a4c:	6a 1b                	push   $0x1b
+  jmp alltraps
+80109a4e:	e9 ec f9 ff ff       	jmp    8010943f <alltraps>
+
+80109a53 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+80109a53:	6a 00                	push   $0x0
+  pushl $28
+80109a55:	6a 1c                	push   $0x1c
+  jmp alltraps
+80109a57:	e9 e3 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109a5c <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+80109a5c:	6a 00                	push   $0x0
+  pushl $29
+80109a5e:	6a 1d                	push   $0x1d
+  jmp alltraps
+80109a60:	e9 da f9 ff ff       	jmp    8010943f <alltraps>
+
+80109a65 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+80109a65:	6a 00                	push   $0x0
+  pushl $30
+80109a67:	6a 1e                	push   $0x1e
+  jmp alltraps
+80109a69:	e9 d1 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109a6e <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+80109a6e:	6a 00                	push   $0x0
+  pushl $31
+80109a70:	6a 1f                	push   $0x1f
+  jmp alltraps
+80109a72:	e9 c8 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109a77 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+80109a77:	6a 00                	push   $0x0
+  pushl $32
+80109a79:	6a 20                	push   $0x20
+  jmp alltraps
+80109a7b:	e9 bf f9 ff ff       	jmp    8010943f <alltraps>
+
+80109a80 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+80109a80:	6a 00                	push   $0x0
+  pushl $33
+80109a82:	6a 21                	push   $0x21
+  jmp alltraps
+80109a84:	e9 b6 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109a89 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+80109a89:	6a 00                	push   $0x0
+  pushl $34
+80109a8b:	6a 22                	push   $0x22
+  jmp alltraps
+80109a8d:	e9 ad f9 ff ff       	jmp    8010943f <alltraps>
+
+80109a92 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+80109a92:	6a 00                	push   $0x0
+  pushl $35
+80109a94:	6a 23                	push   $0x23
+  jmp alltraps
+80109a96:	e9 a4 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109a9b <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+80109a9b:	6a 00                	push   $0x0
+  pushl $36
+80109a9d:	6a 24                	push   $0x24
+  jmp alltraps
+80109a9f:	e9 9b f9 ff ff       	jmp    8010943f <alltraps>
+
+80109aa4 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80109aa4:	6a 00                	push   $0x0
+  pushl $37
+80109aa6:	6a 25                	push   $0x25
+  jmp alltraps
+80109aa8:	e9 92 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109aad <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+80109aad:	6a 00                	push   $0x0
+  pushl $38
+80109aaf:	6a 26                	push   $0x26
+  jmp alltraps
+80109ab1:	e9 89 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109ab6 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+80109ab6:	6a 00                	push   $0x0
+  pushl $39
+80109ab8:	6a 27                	push   $0x27
+  jmp alltraps
+80109aba:	e9 80 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109abf <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+80109abf:	6a 00                	push   $0x0
+  pushl $40
+80109ac1:	6a 28                	push   $0x28
+  jmp alltraps
+80109ac3:	e9 77 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109ac8 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+80109ac8:	6a 00                	push   $0x0
+  pushl $41
+80109aca:	6a 29                	push   $0x29
+  jmp alltraps
+80109acc:	e9 6e f9 ff ff       	jmp    8010943f <alltraps>
+
+80109ad1 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+80109ad1:	6a 00                	push   $0x0
+  pushl $42
+80109ad3:	6a 2a                	push   $0x2a
+  jmp alltraps
+80109ad5:	e9 65 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109ada <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+80109ada:	6a 00                	push   $0x0
+  pushl $43
+80109adc:	6a 2b                	push   $0x2b
+  jmp alltraps
+80109ade:	e9 5c f9 ff ff       	jmp    8010943f <alltraps>
+
+80109ae3 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+80109ae3:	6a 00                	push   $0x0
+  pushl $44
+80109ae5:	6a 2c                	push   $0x2c
+  jmp alltraps
+80109ae7:	e9 53 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109aec <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+80109aec:	6a 00                	push   $0x0
+  pushl $45
+80109aee:	6a 2d                	push   $0x2d
+  jmp alltraps
+80109af0:	e9 4a f9 ff ff       	jmp    8010943f <alltraps>
+
+80109af5 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+80109af5:	6a 00                	push   $0x0
+  pushl $46
+80109af7:	6a 2e                	push   $0x2e
+  jmp alltraps
+80109af9:	e9 41 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109afe <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+80109afe:	6a 00                	push   $0x0
+  pushl $47
+80109b00:	6a 2f                	push   $0x2f
+  jmp alltraps
+80109b02:	e9 38 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109b07 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+80109b07:	6a 00                	push   $0x0
+  pushl $48
+80109b09:	6a 30                	push   $0x30
+  jmp alltraps
+80109b0b:	e9 2f f9 ff ff       	jmp    8010943f <alltraps>
+
+80109b10 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+80109b10:	6a 00                	push   $0x0
+  pushl $49
+80109b12:	6a 31                	push   $0x31
+  jmp alltraps
+80109b14:	e9 26 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109b19 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+80109b19:	6a 00                	push   $0x0
+  pushl $50
+80109b1b:	6a 32                	push   $0x32
+  jmp alltraps
+80109b1d:	e9 1d f9 ff ff       	jmp    8010943f <alltraps>
+
+80109b22 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+80109b22:	6a 00                	push   $0x0
+  pushl $51
+80109b24:	6a 33                	push   $0x33
+  jmp alltraps
+80109b26:	e9 14 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109b2b <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+80109b2b:	6a 00                	push   $0x0
+  pushl $52
+80109b2d:	6a 34                	push   $0x34
+  jmp alltraps
+80109b2f:	e9 0b f9 ff ff       	jmp    8010943f <alltraps>
+
+80109b34 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+80109b34:	6a 00                	push   $0x0
+  pushl $53
+80109b36:	6a 35                	push   $0x35
+  jmp alltraps
+80109b38:	e9 02 f9 ff ff       	jmp    8010943f <alltraps>
+
+80109b3d <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+80109b3d:	6a 00                	push   $0x0
+  pushl $54
+80109b3f:	6a 36                	push   $0x36
+  jmp alltraps
+80109b41:	e9 f9 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109b46 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+80109b46:	6a 00                	push   $0x0
+  pushl $55
+80109b48:	6a 37                	push   $0x37
+  jmp alltraps
+80109b4a:	e9 f0 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109b4f <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+80109b4f:	6a 00                	push   $0x0
+  pushl $56
+80109b51:	6a 38                	push   $0x38
+  jmp alltraps
+80109b53:	e9 e7 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109b58 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+80109b58:	6a 00                	push   $0x0
+  pushl $57
+80109b5a:	6a 39                	push   $0x39
+  jmp alltraps
+80109b5c:	e9 de f8 ff ff       	jmp    8010943f <alltraps>
+
+80109b61 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+80109b61:	6a 00                	push   $0x0
+  pushl $58
+80109b63:	6a 3a                	push   $0x3a
+  jmp alltraps
+80109b65:	e9 d5 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109b6a <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+80109b6a:	6a 00                	push   $0x0
+  pushl $59
+80109b6c:	6a 3b                	push   $0x3b
+  jmp alltraps
+80109b6e:	e9 cc f8 ff ff       	jmp    8010943f <alltraps>
+
+80109b73 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+80109b73:	6a 00                	push   $0x0
+  pushl $60
+80109b75:	6a 3c                	push   $0x3c
+  jmp alltraps
+80109b77:	e9 c3 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109b7c <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+80109b7c:	6a 00                	push   $0x0
+  pushl $61
+80109b7e:	6a 3d                	push   $0x3d
+  jmp alltraps
+80109b80:	e9 ba f8 ff ff       	jmp    8010943f <alltraps>
+
+80109b85 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+80109b85:	6a 00                	push   $0x0
+  pushl $62
+80109b87:	6a 3e                	push   $0x3e
+  jmp alltraps
+80109b89:	e9 b1 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109b8e <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+80109b8e:	6a 00                	push   $0x0
+  pushl $63
+80109b90:	6a 3f                	push   $0x3f
+  jmp alltraps
+80109b92:	e9 a8 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109b97 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+80109b97:	6a 00                	push   $0x0
+  pushl $64
+80109b99:	6a 40                	push   $0x40
+  jmp alltraps
+80109b9b:	e9 9f f8 ff ff       	jmp    8010943f <alltraps>
+
+80109ba0 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+80109ba0:	6a 00                	push   $0x0
+  pushl $65
+80109ba2:	6a 41                	push   $0x41
+  jmp alltraps
+80109ba4:	e9 96 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109ba9 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+80109ba9:	6a 00                	push   $0x0
+  pushl $66
+80109bab:	6a 42                	push   $0x42
+  jmp alltraps
+80109bad:	e9 8d f8 ff ff       	jmp    8010943f <alltraps>
+
+80109bb2 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+80109bb2:	6a 00                	push   $0x0
+  pushl $67
+80109bb4:	6a 43                	push   $0x43
+  jmp alltraps
+80109bb6:	e9 84 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109bbb <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+80109bbb:	6a 00                	push   $0x0
+  pushl $68
+80109bbd:	6a 44                	push   $0x44
+  jmp alltraps
+80109bbf:	e9 7b f8 ff ff       	jmp    8010943f <alltraps>
+
+80109bc4 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+80109bc4:	6a 00                	push   $0x0
+  pushl $69
+80109bc6:	6a 45                	push   $0x45
+  jmp alltraps
+80109bc8:	e9 72 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109bcd <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+80109bcd:	6a 00                	push   $0x0
+  pushl $70
+80109bcf:	6a 46                	push   $0x46
+  jmp alltraps
+80109bd1:	e9 69 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109bd6 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+80109bd6:	6a 00                	push   $0x0
+  pushl $71
+80109bd8:	6a 47                	push   $0x47
+  jmp alltraps
+80109bda:	e9 60 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109bdf <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+80109bdf:	6a 00                	push   $0x0
+  pushl $72
+80109be1:	6a 48                	push   $0x48
+  jmp alltraps
+80109be3:	e9 57 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109be8 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+80109be8:	6a 00                	push   $0x0
+  pushl $73
+80109bea:	6a 49                	push   $0x49
+  jmp alltraps
+80109bec:	e9 4e f8 ff ff       	jmp    8010943f <alltraps>
+
+80109bf1 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+80109bf1:	6a 00                	push   $0x0
+  pushl $74
+80109bf3:	6a 4a                	push   $0x4a
+  jmp alltraps
+80109bf5:	e9 45 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109bfa <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+80109bfa:	6a 00                	push   $0x0
+  pushl $75
+80109bfc:	6a 4b                	push   $0x4b
+  jmp alltraps
+80109bfe:	e9 3c f8 ff ff       	jmp    8010943f <alltraps>
+
+80109c03 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+80109c03:	6a 00                	push   $0x0
+  pushl $76
+80109c05:	6a 4c                	push   $0x4c
+  jmp alltraps
+80109c07:	e9 33 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109c0c <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+80109c0c:	6a 00                	push   $0x0
+  pushl $77
+80109c0e:	6a 4d                	push   $0x4d
+  jmp alltraps
+80109c10:	e9 2a f8 ff ff       	jmp    8010943f <alltraps>
+
+80109c15 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+80109c15:	6a 00                	push   $0x0
+  pushl $78
+80109c17:	6a 4e                	push   $0x4e
+  jmp alltraps
+80109c19:	e9 21 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109c1e <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+80109c1e:	6a 00                	push   $0x0
+  pushl $79
+80109c20:	6a 4f                	push   $0x4f
+  jmp alltraps
+80109c22:	e9 18 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109c27 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+80109c27:	6a 00                	push   $0x0
+  pushl $80
+80109c29:	6a 50                	push   $0x50
+  jmp alltraps
+80109c2b:	e9 0f f8 ff ff       	jmp    8010943f <alltraps>
+
+80109c30 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+80109c30:	6a 00                	push   $0x0
+  pushl $81
+80109c32:	6a 51                	push   $0x51
+  jmp alltraps
+80109c34:	e9 06 f8 ff ff       	jmp    8010943f <alltraps>
+
+80109c39 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+80109c39:	6a 00                	push   $0x0
+  pushl $82
+80109c3b:	6a 52                	push   $0x52
+  jmp alltraps
+80109c3d:	e9 fd f7 ff ff       	jmp    8010943f <alltraps>
+
+80109c42 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+80109c42:	6a 00                	push   $0x0
+  pushl $83
+80109c44:	6a 53                	push   $0x53
+  jmp alltraps
+80109c46:	e9 f4 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109c4b <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+80109c4b:	6a 00                	push   $0x0
+  pushl $84
+80109c4d:	6a 54                	push   $0x54
+  jmp alltraps
+80109c4f:	e9 eb f7 ff ff       	jmp    8010943f <alltraps>
+
+80109c54 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+80109c54:	6a 00                	push   $0x0
+  pushl $85
+80109c56:	6a 55                	push   $0x55
+  jmp alltraps
+80109c58:	e9 e2 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109c5d <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+80109c5d:	6a 00                	push   $0x0
+  pushl $86
+80109c5f:	6a 56                	push   $0x56
+  jmp alltraps
+80109c61:	e9 d9 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109c66 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+80109c66:	6a 00                	push   $0x0
+  pushl $87
+80109c68:	6a 57                	push   $0x57
+  jmp alltraps
+80109c6a:	e9 d0 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109c6f <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+80109c6f:	6a 00                	push   $0x0
+  pushl $88
+80109c71:	6a 58                	push   $0x58
+  jmp alltraps
+80109c73:	e9 c7 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109c78 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+80109c78:	6a 00                	push   $0x0
+  pushl $89
+80109c7a:	6a 59                	push   $0x59
+  jmp alltraps
+80109c7c:	e9 be f7 ff ff       	jmp    8010943f <alltraps>
+
+80109c81 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+80109c81:	6a 00                	push   $0x0
+  pushl $90
+80109c83:	6a 5a                	push   $0x5a
+  jmp alltraps
+80109c85:	e9 b5 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109c8a <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+80109c8a:	6a 00                	push   $0x0
+  pushl $91
+80109c8c:	6a 5b                	push   $0x5b
+  jmp alltraps
+80109c8e:	e9 ac f7 ff ff       	jmp    8010943f <alltraps>
+
+80109c93 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+80109c93:	6a 00                	push   $0x0
+  pushl $92
+80109c95:	6a 5c                	push   $0x5c
+  jmp alltraps
+80109c97:	e9 a3 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109c9c <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+80109c9c:	6a 00                	push   $0x0
+  pushl $93
+80109c9e:	6a 5d                	push   $0x5d
+  jmp alltraps
+80109ca0:	e9 9a f7 ff ff       	jmp    8010943f <alltraps>
+
+80109ca5 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+80109ca5:	6a 00                	push   $0x0
+  pushl $94
+80109ca7:	6a 5e                	push   $0x5e
+  jmp alltraps
+80109ca9:	e9 91 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109cae <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+80109cae:	6a 00                	push   $0x0
+  pushl $95
+80109cb0:	6a 5f                	push   $0x5f
+  jmp alltraps
+80109cb2:	e9 88 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109cb7 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+80109cb7:	6a 00                	push   $0x0
+  pushl $96
+80109cb9:	6a 60                	push   $0x60
+  jmp alltraps
+80109cbb:	e9 7f f7 ff ff       	jmp    8010943f <alltraps>
+
+80109cc0 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+80109cc0:	6a 00                	push   $0x0
+  pushl $97
+80109cc2:	6a 61                	push   $0x61
+  jmp alltraps
+80109cc4:	e9 76 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109cc9 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+80109cc9:	6a 00                	push   $0x0
+  pushl $98
+80109ccb:	6a 62                	push   $0x62
+  jmp alltraps
+80109ccd:	e9 6d f7 ff ff       	jmp    8010943f <alltraps>
+
+80109cd2 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+80109cd2:	6a 00                	push   $0x0
+  pushl $99
+80109cd4:	6a 63                	push   $0x63
+  jmp alltraps
+80109cd6:	e9 64 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109cdb <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+80109cdb:	6a 00                	push   $0x0
+  pushl $100
+80109cdd:	6a 64                	push   $0x64
+  jmp alltraps
+80109cdf:	e9 5b f7 ff ff       	jmp    8010943f <alltraps>
+
+80109ce4 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+80109ce4:	6a 00                	push   $0x0
+  pushl $101
+80109ce6:	6a 65                	push   $0x65
+  jmp alltraps
+80109ce8:	e9 52 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109ced <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+80109ced:	6a 00                	push   $0x0
+  pushl $102
+80109cef:	6a 66                	push   $0x66
+  jmp alltraps
+80109cf1:	e9 49 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109cf6 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+80109cf6:	6a 00                	push   $0x0
+  pushl $103
+80109cf8:	6a 67                	push   $0x67
+  jmp alltraps
+80109cfa:	e9 40 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109cff <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+80109cff:	6a 00                	push   $0x0
+  pushl $104
+80109d01:	6a 68                	push   $0x68
+  jmp alltraps
+80109d03:	e9 37 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109d08 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+80109d08:	6a 00                	push   $0x0
+  pushl $105
+80109d0a:	6a 69                	push   $0x69
+  jmp alltraps
+80109d0c:	e9 2e f7 ff ff       	jmp    8010943f <alltraps>
+
+80109d11 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+80109d11:	6a 00                	push   $0x0
+  pushl $106
+80109d13:	6a 6a                	push   $0x6a
+  jmp alltraps
+80109d15:	e9 25 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109d1a <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+80109d1a:	6a 00                	push   $0x0
+  pushl $107
+80109d1c:	6a 6b                	push   $0x6b
+  jmp alltraps
+80109d1e:	e9 1c f7 ff ff       	jmp    8010943f <alltraps>
+
+80109d23 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+80109d23:	6a 00                	push   $0x0
+  pushl $108
+80109d25:	6a 6c                	push   $0x6c
+  jmp alltraps
+80109d27:	e9 13 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109d2c <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+80109d2c:	6a 00                	push   $0x0
+  pushl $109
+80109d2e:	6a 6d                	push   $0x6d
+  jmp alltraps
+80109d30:	e9 0a f7 ff ff       	jmp    8010943f <alltraps>
+
+80109d35 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+80109d35:	6a 00                	push   $0x0
+  pushl $110
+80109d37:	6a 6e                	push   $0x6e
+  jmp alltraps
+80109d39:	e9 01 f7 ff ff       	jmp    8010943f <alltraps>
+
+80109d3e <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+80109d3e:	6a 00                	push   $0x0
+  pushl $111
+80109d40:	6a 6f                	push   $0x6f
+  jmp alltraps
+80109d42:	e9 f8 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109d47 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+80109d47:	6a 00                	push   $0x0
+  pushl $112
+80109d49:	6a 70                	push   $0x70
+  jmp alltraps
+80109d4b:	e9 ef f6 ff ff       	jmp    8010943f <alltraps>
+
+80109d50 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+80109d50:	6a 00                	push   $0x0
+  pushl $113
+80109d52:	6a 71                	push   $0x71
+  jmp alltraps
+80109d54:	e9 e6 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109d59 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+80109d59:	6a 00                	push   $0x0
+  pushl $114
+80109d5b:	6a 72                	push   $0x72
+  jmp alltraps
+80109d5d:	e9 dd f6 ff ff       	jmp    8010943f <alltraps>
+
+80109d62 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+80109d62:	6a 00                	push   $0x0
+  pushl $115
+80109d64:	6a 73                	push   $0x73
+  jmp alltraps
+80109d66:	e9 d4 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109d6b <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+80109d6b:	6a 00                	push   $0x0
+  pushl $116
+80109d6d:	6a 74                	push   $0x74
+  jmp alltraps
+80109d6f:	e9 cb f6 ff ff       	jmp    8010943f <alltraps>
+
+80109d74 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+80109d74:	6a 00                	push   $0x0
+  pushl $117
+80109d76:	6a 75                	push   $0x75
+  jmp alltraps
+80109d78:	e9 c2 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109d7d <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+80109d7d:	6a 00                	push   $0x0
+  pushl $118
+80109d7f:	6a 76                	push   $0x76
+  jmp alltraps
+80109d81:	e9 b9 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109d86 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+80109d86:	6a 00                	push   $0x0
+  pushl $119
+80109d88:	6a 77                	push   $0x77
+  jmp alltraps
+80109d8a:	e9 b0 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109d8f <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+80109d8f:	6a 00                	push   $0x0
+  pushl $120
+80109d91:	6a 78                	push   $0x78
+  jmp alltraps
+80109d93:	e9 a7 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109d98 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+80109d98:	6a 00                	push   $0x0
+  pushl $121
+80109d9a:	6a 79                	push   $0x79
+  jmp alltraps
+80109d9c:	e9 9e f6 ff ff       	jmp    8010943f <alltraps>
+
+80109da1 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+80109da1:	6a 00                	push   $0x0
+  pushl $122
+80109da3:	6a 7a                	push   $0x7a
+  jmp alltraps
+80109da5:	e9 95 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109daa <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+80109daa:	6a 00                	push   $0x0
+  pushl $123
+80109dac:	6a 7b                	push   $0x7b
+  jmp alltraps
+80109dae:	e9 8c f6 ff ff       	jmp    8010943f <alltraps>
+
+80109db3 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+80109db3:	6a 00                	push   $0x0
+  pushl $124
+80109db5:	6a 7c                	push   $0x7c
+  jmp alltraps
+80109db7:	e9 83 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109dbc <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+80109dbc:	6a 00                	push   $0x0
+  pushl $125
+80109dbe:	6a 7d                	push   $0x7d
+  jmp alltraps
+80109dc0:	e9 7a f6 ff ff       	jmp    8010943f <alltraps>
+
+80109dc5 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+80109dc5:	6a 00                	push   $0x0
+  pushl $126
+80109dc7:	6a 7e                	push   $0x7e
+  jmp alltraps
+80109dc9:	e9 71 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109dce <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+80109dce:	6a 00                	push   $0x0
+  pushl $127
+80109dd0:	6a 7f                	push   $0x7f
+  jmp alltraps
+80109dd2:	e9 68 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109dd7 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+80109dd7:	6a 00                	push   $0x0
+  pushl $128
+80109dd9:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+80109dde:	e9 5c f6 ff ff       	jmp    8010943f <alltraps>
+
+80109de3 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+80109de3:	6a 00                	push   $0x0
+  pushl $129
+80109de5:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+80109dea:	e9 50 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109def <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+80109def:	6a 00                	push   $0x0
+  pushl $130
+80109df1:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+80109df6:	e9 44 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109dfb <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+80109dfb:	6a 00                	push   $0x0
+  pushl $131
+80109dfd:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+80109e02:	e9 38 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109e07 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+80109e07:	6a 00                	push   $0x0
+  pushl $132
+80109e09:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+80109e0e:	e9 2c f6 ff ff       	jmp    8010943f <alltraps>
+
+80109e13 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+80109e13:	6a 00                	push   $0x0
+  pushl $133
+80109e15:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+80109e1a:	e9 20 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109e1f <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+80109e1f:	6a 00                	push   $0x0
+  pushl $134
+80109e21:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+80109e26:	e9 14 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109e2b <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+80109e2b:	6a 00                	push   $0x0
+  pushl $135
+80109e2d:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+80109e32:	e9 08 f6 ff ff       	jmp    8010943f <alltraps>
+
+80109e37 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+80109e37:	6a 00                	push   $0x0
+  pushl $136
+80109e39:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+80109e3e:	e9 fc f5 ff ff       	jmp    8010943f <alltraps>
+
+80109e43 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+80109e43:	6a 00                	push   $0x0
+  pushl $137
+80109e45:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+80109e4a:	e9 f0 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109e4f <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+80109e4f:	6a 00                	push   $0x0
+  pushl $138
+80109e51:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+80109e56:	e9 e4 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109e5b <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+80109e5b:	6a 00                	push   $0x0
+  pushl $139
+80109e5d:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+80109e62:	e9 d8 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109e67 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+80109e67:	6a 00                	push   $0x0
+  pushl $140
+80109e69:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+80109e6e:	e9 cc f5 ff ff       	jmp    8010943f <alltraps>
+
+80109e73 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+80109e73:	6a 00                	push   $0x0
+  pushl $141
+80109e75:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+80109e7a:	e9 c0 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109e7f <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+80109e7f:	6a 00                	push   $0x0
+  pushl $142
+80109e81:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+80109e86:	e9 b4 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109e8b <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+80109e8b:	6a 00                	push   $0x0
+  pushl $143
+80109e8d:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+80109e92:	e9 a8 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109e97 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+80109e97:	6a 00                	push   $0x0
+  pushl $144
+80109e99:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+80109e9e:	e9 9c f5 ff ff       	jmp    8010943f <alltraps>
+
+80109ea3 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+80109ea3:	6a 00                	push   $0x0
+  pushl $145
+80109ea5:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+80109eaa:	e9 90 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109eaf <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+80109eaf:	6a 00                	push   $0x0
+  pushl $146
+80109eb1:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+80109eb6:	e9 84 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109ebb <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+80109ebb:	6a 00                	push   $0x0
+  pushl $147
+80109ebd:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+80109ec2:	e9 78 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109ec7 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+80109ec7:	6a 00                	push   $0x0
+  pushl $148
+80109ec9:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+80109ece:	e9 6c f5 ff ff       	jmp    8010943f <alltraps>
+
+80109ed3 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+80109ed3:	6a 00                	push   $0x0
+  pushl $149
+80109ed5:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+80109eda:	e9 60 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109edf <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+80109edf:	6a 00                	push   $0x0
+  pushl $150
+80109ee1:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+80109ee6:	e9 54 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109eeb <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+80109eeb:	6a 00                	push   $0x0
+  pushl $151
+80109eed:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+80109ef2:	e9 48 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109ef7 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+80109ef7:	6a 00                	push   $0x0
+  pushl $152
+80109ef9:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+80109efe:	e9 3c f5 ff ff       	jmp    8010943f <alltraps>
+
+80109f03 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+80109f03:	6a 00                	push   $0x0
+  pushl $153
+80109f05:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+80109f0a:	e9 30 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109f0f <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+80109f0f:	6a 00                	push   $0x0
+  pushl $154
+80109f11:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+80109f16:	e9 24 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109f1b <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+80109f1b:	6a 00                	push   $0x0
+  pushl $155
+80109f1d:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+80109f22:	e9 18 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109f27 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+80109f27:	6a 00                	push   $0x0
+  pushl $156
+80109f29:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+80109f2e:	e9 0c f5 ff ff       	jmp    8010943f <alltraps>
+
+80109f33 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+80109f33:	6a 00                	push   $0x0
+  pushl $157
+80109f35:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+80109f3a:	e9 00 f5 ff ff       	jmp    8010943f <alltraps>
+
+80109f3f <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+80109f3f:	6a 00                	push   $0x0
+  pushl $158
+80109f41:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+80109f46:	e9 f4 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109f4b <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+80109f4b:	6a 00                	push   $0x0
+  pushl $159
+80109f4d:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+80109f52:	e9 e8 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109f57 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+80109f57:	6a 00                	push   $0x0
+  pushl $160
+80109f59:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+80109f5e:	e9 dc f4 ff ff       	jmp    8010943f <alltraps>
+
+80109f63 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+80109f63:	6a 00                	push   $0x0
+  pushl $161
+80109f65:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+80109f6a:	e9 d0 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109f6f <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+80109f6f:	6a 00                	push   $0x0
+  pushl $162
+80109f71:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+80109f76:	e9 c4 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109f7b <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+80109f7b:	6a 00                	push   $0x0
+  pushl $163
+80109f7d:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+80109f82:	e9 b8 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109f87 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+80109f87:	6a 00                	push   $0x0
+  pushl $164
+80109f89:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+80109f8e:	e9 ac f4 ff ff       	jmp    8010943f <alltraps>
+
+80109f93 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+80109f93:	6a 00                	push   $0x0
+  pushl $165
+80109f95:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+80109f9a:	e9 a0 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109f9f <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+80109f9f:	6a 00                	push   $0x0
+  pushl $166
+80109fa1:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+80109fa6:	e9 94 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109fab <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+80109fab:	6a 00                	push   $0x0
+  pushl $167
+80109fad:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+80109fb2:	e9 88 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109fb7 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+80109fb7:	6a 00                	push   $0x0
+  pushl $168
+80109fb9:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+80109fbe:	e9 7c f4 ff ff       	jmp    8010943f <alltraps>
+
+80109fc3 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+80109fc3:	6a 00                	push   $0x0
+  pushl $169
+80109fc5:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+80109fca:	e9 70 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109fcf <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+80109fcf:	6a 00                	push   $0x0
+  pushl $170
+80109fd1:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+80109fd6:	e9 64 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109fdb <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+80109fdb:	6a 00                	push   $0x0
+  pushl $171
+80109fdd:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+80109fe2:	e9 58 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109fe7 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+80109fe7:	6a 00                	push   $0x0
+  pushl $172
+80109fe9:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+80109fee:	e9 4c f4 ff ff       	jmp    8010943f <alltraps>
+
+80109ff3 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+80109ff3:	6a 00                	push   $0x0
+  pushl $173
+80109ff5:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+80109ffa:	e9 40 f4 ff ff       	jmp    8010943f <alltraps>
+
+80109fff <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+80109fff:	6a 00                	push   $0x0
+  pushl $174
+8010a001:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+8010a006:	e9 34 f4 ff ff       	jmp    8010943f <alltraps>
+
+8010a00b <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+8010a00b:	6a 00                	push   $0x0
+  pushl $175
+8010a00d:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+8010a012:	e9 28 f4 ff ff       	jmp    8010943f <alltraps>
+
+8010a017 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+8010a017:	6a 00                	push   $0x0
+  pushl $176
+8010a019:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+8010a01e:	e9 1c f4 ff ff       	jmp    8010943f <alltraps>
+
+8010a023 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+8010a023:	6a 00                	push   $0x0
+  pushl $177
+8010a025:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+8010a02a:	e9 10 f4 ff ff       	jmp    8010943f <alltraps>
+
+8010a02f <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+8010a02f:	6a 00                	push   $0x0
+  pushl $178
+8010a031:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+8010a036:	e9 04 f4 ff ff       	jmp    8010943f <alltraps>
+
+8010a03b <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+8010a03b:	6a 00                	push   $0x0
+  pushl $179
+8010a03d:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+8010a042:	e9 f8 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a047 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+8010a047:	6a 00                	push   $0x0
+  pushl $180
+8010a049:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+8010a04e:	e9 ec f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a053 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+8010a053:	6a 00                	push   $0x0
+  pushl $181
+8010a055:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+8010a05a:	e9 e0 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a05f <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+8010a05f:	6a 00                	push   $0x0
+  pushl $182
+8010a061:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+8010a066:	e9 d4 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a06b <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+8010a06b:	6a 00                	push   $0x0
+  pushl $183
+8010a06d:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+8010a072:	e9 c8 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a077 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+8010a077:	6a 00                	push   $0x0
+  pushl $184
+8010a079:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+8010a07e:	e9 bc f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a083 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+8010a083:	6a 00                	push   $0x0
+  pushl $185
+8010a085:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+8010a08a:	e9 b0 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a08f <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+8010a08f:	6a 00                	push   $0x0
+  pushl $186
+8010a091:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+8010a096:	e9 a4 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a09b <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+8010a09b:	6a 00                	push   $0x0
+  pushl $187
+8010a09d:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+8010a0a2:	e9 98 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a0a7 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+8010a0a7:	6a 00                	push   $0x0
+  pushl $188
+8010a0a9:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010a0ae:	e9 8c f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a0b3 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+8010a0b3:	6a 00                	push   $0x0
+  pushl $189
+8010a0b5:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+8010a0ba:	e9 80 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a0bf <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+8010a0bf:	6a 00                	push   $0x0
+  pushl $190
+8010a0c1:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+8010a0c6:	e9 74 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a0cb <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+8010a0cb:	6a 00                	push   $0x0
+  pushl $191
+8010a0cd:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+8010a0d2:	e9 68 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a0d7 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+8010a0d7:	6a 00                	push   $0x0
+  pushl $192
+8010a0d9:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+8010a0de:	e9 5c f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a0e3 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+8010a0e3:	6a 00                	push   $0x0
+  pushl $193
+8010a0e5:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+8010a0ea:	e9 50 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a0ef <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+8010a0ef:	6a 00                	push   $0x0
+  pushl $194
+8010a0f1:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+8010a0f6:	e9 44 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a0fb <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+8010a0fb:	6a 00                	push   $0x0
+  pushl $195
+8010a0fd:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+8010a102:	e9 38 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a107 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+8010a107:	6a 00                	push   $0x0
+  pushl $196
+8010a109:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+8010a10e:	e9 2c f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a113 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+8010a113:	6a 00                	push   $0x0
+  pushl $197
+8010a115:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+8010a11a:	e9 20 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a11f <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+8010a11f:	6a 00                	push   $0x0
+  pushl $198
+8010a121:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+8010a126:	e9 14 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a12b <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+8010a12b:	6a 00                	push   $0x0
+  pushl $199
+8010a12d:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+8010a132:	e9 08 f3 ff ff       	jmp    8010943f <alltraps>
+
+8010a137 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+8010a137:	6a 00                	push   $0x0
+  pushl $200
+8010a139:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+8010a13e:	e9 fc f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a143 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+8010a143:	6a 00                	push   $0x0
+  pushl $201
+8010a145:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+8010a14a:	e9 f0 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a14f <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+8010a14f:	6a 00                	push   $0x0
+  pushl $202
+8010a151:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+8010a156:	e9 e4 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a15b <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+8010a15b:	6a 00                	push   $0x0
+  pushl $203
+8010a15d:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+8010a162:	e9 d8 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a167 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+8010a167:	6a 00                	push   $0x0
+  pushl $204
+8010a169:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+8010a16e:	e9 cc f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a173 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+8010a173:	6a 00                	push   $0x0
+  pushl $205
+8010a175:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+8010a17a:	e9 c0 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a17f <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+8010a17f:	6a 00                	push   $0x0
+  pushl $206
+8010a181:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+8010a186:	e9 b4 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a18b <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+8010a18b:	6a 00                	push   $0x0
+  pushl $207
+8010a18d:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+8010a192:	e9 a8 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a197 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+8010a197:	6a 00                	push   $0x0
+  pushl $208
+8010a199:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+8010a19e:	e9 9c f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a1a3 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+8010a1a3:	6a 00                	push   $0x0
+  pushl $209
+8010a1a5:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+8010a1aa:	e9 90 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a1af <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+8010a1af:	6a 00                	push   $0x0
+  pushl $210
+8010a1b1:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+8010a1b6:	e9 84 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a1bb <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+8010a1bb:	6a 00                	push   $0x0
+  pushl $211
+8010a1bd:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+8010a1c2:	e9 78 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a1c7 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+8010a1c7:	6a 00                	push   $0x0
+  pushl $212
+8010a1c9:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+8010a1ce:	e9 6c f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a1d3 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+8010a1d3:	6a 00                	push   $0x0
+  pushl $213
+8010a1d5:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+8010a1da:	e9 60 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a1df <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+8010a1df:	6a 00                	push   $0x0
+  pushl $214
+8010a1e1:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+8010a1e6:	e9 54 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a1eb <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+8010a1eb:	6a 00                	push   $0x0
+  pushl $215
+8010a1ed:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+8010a1f2:	e9 48 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a1f7 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+8010a1f7:	6a 00                	push   $0x0
+  pushl $216
+8010a1f9:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+8010a1fe:	e9 3c f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a203 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+8010a203:	6a 00                	push   $0x0
+  pushl $217
+8010a205:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+8010a20a:	e9 30 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a20f <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+8010a20f:	6a 00                	push   $0x0
+  pushl $218
+8010a211:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+8010a216:	e9 24 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a21b <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+8010a21b:	6a 00                	push   $0x0
+  pushl $219
+8010a21d:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+8010a222:	e9 18 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a227 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+8010a227:	6a 00                	push   $0x0
+  pushl $220
+8010a229:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+8010a22e:	e9 0c f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a233 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+8010a233:	6a 00                	push   $0x0
+  pushl $221
+8010a235:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+8010a23a:	e9 00 f2 ff ff       	jmp    8010943f <alltraps>
+
+8010a23f <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+8010a23f:	6a 00                	push   $0x0
+  pushl $222
+8010a241:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+8010a246:	e9 f4 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a24b <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+8010a24b:	6a 00                	push   $0x0
+  pushl $223
+8010a24d:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+8010a252:	e9 e8 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a257 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+8010a257:	6a 00                	push   $0x0
+  pushl $224
+8010a259:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+8010a25e:	e9 dc f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a263 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+8010a263:	6a 00                	push   $0x0
+  pushl $225
+8010a265:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+8010a26a:	e9 d0 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a26f <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+8010a26f:	6a 00                	push   $0x0
+  pushl $226
+8010a271:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+8010a276:	e9 c4 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a27b <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+8010a27b:	6a 00                	push   $0x0
+  pushl $227
+8010a27d:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+8010a282:	e9 b8 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a287 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+8010a287:	6a 00                	push   $0x0
+  pushl $228
+8010a289:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+8010a28e:	e9 ac f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a293 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+8010a293:	6a 00                	push   $0x0
+  pushl $229
+8010a295:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+8010a29a:	e9 a0 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a29f <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+8010a29f:	6a 00                	push   $0x0
+  pushl $230
+8010a2a1:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+8010a2a6:	e9 94 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a2ab <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+8010a2ab:	6a 00                	push   $0x0
+  pushl $231
+8010a2ad:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+8010a2b2:	e9 88 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a2b7 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+8010a2b7:	6a 00                	push   $0x0
+  pushl $232
+8010a2b9:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+8010a2be:	e9 7c f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a2c3 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+8010a2c3:	6a 00                	push   $0x0
+  pushl $233
+8010a2c5:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+8010a2ca:	e9 70 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a2cf <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+8010a2cf:	6a 00                	push   $0x0
+  pushl $234
+8010a2d1:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+8010a2d6:	e9 64 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a2db <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+8010a2db:	6a 00                	push   $0x0
+  pushl $235
+8010a2dd:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+8010a2e2:	e9 58 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a2e7 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+8010a2e7:	6a 00                	push   $0x0
+  pushl $236
+8010a2e9:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+8010a2ee:	e9 4c f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a2f3 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+8010a2f3:	6a 00                	push   $0x0
+  pushl $237
+8010a2f5:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+8010a2fa:	e9 40 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a2ff <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+8010a2ff:	6a 00                	push   $0x0
+  pushl $238
+8010a301:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+8010a306:	e9 34 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a30b <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+8010a30b:	6a 00                	push   $0x0
+  pushl $239
+8010a30d:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+8010a312:	e9 28 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a317 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+8010a317:	6a 00                	push   $0x0
+  pushl $240
+8010a319:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+8010a31e:	e9 1c f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a323 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+8010a323:	6a 00                	push   $0x0
+  pushl $241
+8010a325:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+8010a32a:	e9 10 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a32f <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+8010a32f:	6a 00                	push   $0x0
+  pushl $242
+8010a331:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+8010a336:	e9 04 f1 ff ff       	jmp    8010943f <alltraps>
+
+8010a33b <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+8010a33b:	6a 00                	push   $0x0
+  pushl $243
+8010a33d:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+8010a342:	e9 f8 f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a347 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+8010a347:	6a 00                	push   $0x0
+  pushl $244
+8010a349:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+8010a34e:	e9 ec f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a353 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+8010a353:	6a 00                	push   $0x0
+  pushl $245
+8010a355:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+8010a35a:	e9 e0 f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a35f <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+8010a35f:	6a 00                	push   $0x0
+  pushl $246
+8010a361:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+8010a366:	e9 d4 f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a36b <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+8010a36b:	6a 00                	push   $0x0
+  pushl $247
+8010a36d:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+8010a372:	e9 c8 f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a377 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+8010a377:	6a 00                	push   $0x0
+  pushl $248
+8010a379:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+8010a37e:	e9 bc f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a383 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+8010a383:	6a 00                	push   $0x0
+  pushl $249
+8010a385:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+8010a38a:	e9 b0 f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a38f <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+8010a38f:	6a 00                	push   $0x0
+  pushl $250
+8010a391:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+8010a396:	e9 a4 f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a39b <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+8010a39b:	6a 00                	push   $0x0
+  pushl $251
+8010a39d:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+8010a3a2:	e9 98 f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a3a7 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+8010a3a7:	6a 00                	push   $0x0
+  pushl $252
+8010a3a9:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010a3ae:	e9 8c f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a3b3 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+8010a3b3:	6a 00                	push   $0x0
+  pushl $253
+8010a3b5:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010a3ba:	e9 80 f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a3bf <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010a3bf:	6a 00                	push   $0x0
+  pushl $254
+8010a3c1:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+8010a3c6:	e9 74 f0 ff ff       	jmp    8010943f <alltraps>
+
+8010a3cb <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+8010a3cb:	6a 00                	push   $0x0
+  pushl $255
+8010a3cd:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+8010a3d2:	e9 68 f0 ff ff       	jmp    8010943f <alltraps>
+8010a3d7:	66 90                	xchg   %ax,%ax
+8010a3d9:	66 90                	xchg   %ax,%ax
+8010a3db:	66 90                	xchg   %ax,%ax
+8010a3dd:	66 90                	xchg   %ax,%ax
+8010a3df:	90                   	nop
+
+8010a3e0 <deallocuvm.part.0>:
+// Deallocate user pages to bring the process size from oldsz to
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a3e0:	55                   	push   %ebp
+8010a3e1:	89 e5                	mov    %esp,%ebp
+8010a3e3:	57                   	push   %edi
+8010a3e4:	56                   	push   %esi
+8010a3e5:	53                   	push   %ebx
+  uint a, pa;
+
+  if(newsz >= oldsz)
+    return oldsz;
+
+  a = PGROUNDUP(newsz);
+8010a3e6:	8d 99 ff 0f 00 00    	lea    0xfff(%ecx),%ebx
+8010a3ec:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a3f2:	83 ec 1c             	sub    $0x1c,%esp
+  for(; a  < oldsz; a += PGSIZE){
+8010a3f5:	39 d3                	cmp    %edx,%ebx
+8010a3f7:	73 7c                	jae    8010a475 <deallocuvm.part.0+0x95>
+8010a3f9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010a3fc:	89 c6                	mov    %eax,%esi
+8010a3fe:	89 d7                	mov    %edx,%edi
+8010a400:	eb 12                	jmp    8010a414 <deallocuvm.part.0+0x34>
+8010a402:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;  // skip to next page table
+8010a408:	83 c2 01             	add    $0x1,%edx
+8010a40b:	89 d3                	mov    %edx,%ebx
+8010a40d:	c1 e3 16             	shl    $0x16,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010a410:	39 fb                	cmp    %edi,%ebx
+8010a412:	73 5e                	jae    8010a472 <deallocuvm.part.0+0x92>
+  pde = &pgdir[PDX(va)];
+8010a414:	89 da                	mov    %ebx,%edx
+8010a416:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+8010a419:	8b 04 96             	mov    (%esi,%edx,4),%eax
+8010a41c:	a8 01                	test   $0x1,%al
+8010a41e:	74 e8                	je     8010a408 <deallocuvm.part.0+0x28>
+  return &pgtab[PTX(va)];
+8010a420:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a422:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a427:	c1 e9 0a             	shr    $0xa,%ecx
+8010a42a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010a430:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    if(!pte)
+8010a437:	85 c0                	test   %eax,%eax
+8010a439:	74 cd                	je     8010a408 <deallocuvm.part.0+0x28>
+    else if((*pte & PTE_P) != 0){
+8010a43b:	8b 10                	mov    (%eax),%edx
+8010a43d:	f6 c2 01             	test   $0x1,%dl
+8010a440:	74 3e                	je     8010a480 <deallocuvm.part.0+0xa0>
+      pa = PTE_ADDR(*pte);
+      if(pa == 0)
+8010a442:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+8010a448:	74 63                	je     8010a4ad <deallocuvm.part.0+0xcd>
+        panic("kfree");
+      char *v = P2V(pa);
+      kfree(v);
+8010a44a:	83 ec 0c             	sub    $0xc,%esp
+      char *v = P2V(pa);
+8010a44d:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010a453:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(; a  < oldsz; a += PGSIZE){
+8010a456:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+      kfree(v);
+8010a45c:	52                   	push   %edx
+8010a45d:	e8 4e 91 ff ff       	call   801035b0 <kfree>
+      *pte = 0;
+8010a462:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a465:	83 c4 10             	add    $0x10,%esp
+8010a468:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; a  < oldsz; a += PGSIZE){
+8010a46e:	39 fb                	cmp    %edi,%ebx
+8010a470:	72 a2                	jb     8010a414 <deallocuvm.part.0+0x34>
+8010a472:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      swapfree(PTE_ADDR(*pte) >> PTXSHIFT);
+      *pte = 0;
+    }
+  }
+  return newsz;
+}
+8010a475:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a478:	89 c8                	mov    %ecx,%eax
+8010a47a:	5b                   	pop    %ebx
+8010a47b:	5e                   	pop    %esi
+8010a47c:	5f                   	pop    %edi
+8010a47d:	5d                   	pop    %ebp
+8010a47e:	c3                   	ret
+8010a47f:	90                   	nop
+    } else if(*pte & PTE_SWAP){
+8010a480:	f6 c6 04             	test   $0x4,%dh
+8010a483:	75 0b                	jne    8010a490 <deallocuvm.part.0+0xb0>
+  for(; a  < oldsz; a += PGSIZE){
+8010a485:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a48b:	eb 83                	jmp    8010a410 <deallocuvm.part.0+0x30>
+8010a48d:	8d 76 00             	lea    0x0(%esi),%esi
+      swapfree(PTE_ADDR(*pte) >> PTXSHIFT);
+8010a490:	83 ec 0c             	sub    $0xc,%esp
+8010a493:	c1 ea 0c             	shr    $0xc,%edx
+8010a496:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a499:	52                   	push   %edx
+8010a49a:	e8 e1 d4 ff ff       	call   80107980 <swapfree>
+      *pte = 0;
+8010a49f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a4a2:	83 c4 10             	add    $0x10,%esp
+8010a4a5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+8010a4ab:	eb d8                	jmp    8010a485 <deallocuvm.part.0+0xa5>
+        panic("kfree");
+8010a4ad:	83 ec 0c             	sub    $0xc,%esp
+8010a4b0:	68 ae b6 10 80       	push   $0x8010b6ae
+8010a4b5:	e8 06 67 ff ff       	call   80100bc0 <panic>
+8010a4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010a4c0 <mappages>:
+{
+8010a4c0:	55                   	push   %ebp
+8010a4c1:	89 e5                	mov    %esp,%ebp
+8010a4c3:	57                   	push   %edi
+8010a4c4:	89 c7                	mov    %eax,%edi
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010a4c6:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+{
+8010a4ca:	56                   	push   %esi
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010a4cb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+{
+8010a4d0:	53                   	push   %ebx
+  a = (char*)PGROUNDDOWN((uint)va);
+8010a4d1:	89 d3                	mov    %edx,%ebx
+8010a4d3:	89 fa                	mov    %edi,%edx
+8010a4d5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+8010a4db:	83 ec 1c             	sub    $0x1c,%esp
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010a4de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010a4e1:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a4e4:	29 d8                	sub    %ebx,%eax
+8010a4e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a4e9:	eb 3a                	jmp    8010a525 <mappages+0x65>
+8010a4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a4ef:	90                   	nop
+  return &pgtab[PTX(va)];
+8010a4f0:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a4f2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a4f7:	c1 e9 0a             	shr    $0xa,%ecx
+8010a4fa:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010a500:	8d 8c 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%ecx
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010a507:	85 c9                	test   %ecx,%ecx
+8010a509:	74 5d                	je     8010a568 <mappages+0xa8>
+    if(*pte & PTE_P)
+8010a50b:	f6 01 01             	testb  $0x1,(%ecx)
+8010a50e:	75 72                	jne    8010a582 <mappages+0xc2>
+    *pte = pa | perm | PTE_P;
+8010a510:	0b 75 0c             	or     0xc(%ebp),%esi
+    if(a == last)
+8010a513:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    *pte = pa | perm | PTE_P;
+8010a516:	83 ce 01             	or     $0x1,%esi
+8010a519:	89 31                	mov    %esi,(%ecx)
+    if(a == last)
+8010a51b:	39 c3                	cmp    %eax,%ebx
+8010a51d:	74 59                	je     8010a578 <mappages+0xb8>
+    a += PGSIZE;
+8010a51f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  for(;;){
+8010a525:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a528:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+  pde = &pgdir[PDX(va)];
+8010a52b:	89 d8                	mov    %ebx,%eax
+8010a52d:	c1 e8 16             	shr    $0x16,%eax
+8010a530:	8d 3c 82             	lea    (%edx,%eax,4),%edi
+  if(*pde & PTE_P){
+8010a533:	8b 07                	mov    (%edi),%eax
+8010a535:	a8 01                	test   $0x1,%al
+8010a537:	75 b7                	jne    8010a4f0 <mappages+0x30>
+8010a539:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    if(!alloc || (pgtab = (pte_t*)kzalloc()) == 0)
+8010a53c:	e8 1f 94 ff ff       	call   80103960 <kzalloc>
+8010a541:	85 c0                	test   %eax,%eax
+8010a543:	74 23                	je     8010a568 <mappages+0xa8>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a545:	8d 88 00 00 00 80    	lea    -0x80000000(%eax),%ecx
+  return &pgtab[PTX(va)];
+8010a54b:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a54e:	83 c9 07             	or     $0x7,%ecx
+8010a551:	89 0f                	mov    %ecx,(%edi)
+  return &pgtab[PTX(va)];
+8010a553:	89 d9                	mov    %ebx,%ecx
+8010a555:	c1 e9 0a             	shr    $0xa,%ecx
+8010a558:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010a55e:	01 c1                	add    %eax,%ecx
+8010a560:	eb a9                	jmp    8010a50b <mappages+0x4b>
+8010a562:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+}
+8010a568:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010a56b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a570:	5b                   	pop    %ebx
+8010a571:	5e                   	pop    %esi
+8010a572:	5f                   	pop    %edi
+8010a573:	5d                   	pop    %ebp
+8010a574:	c3                   	ret
+8010a575:	8d 76 00             	lea    0x0(%esi),%esi
+8010a578:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010a57b:	31 c0                	xor    %eax,%eax
+}
+8010a57d:	5b                   	pop    %ebx
+8010a57e:	5e                   	pop    %esi
+8010a57f:	5f                   	pop    %edi
+8010a580:	5d                   	pop    %ebp
+8010a581:	c3                   	ret
+      panic("remap");
+8010a582:	83 ec 0c             	sub    $0xc,%esp
+8010a585:	68 2c be 10 80       	push   $0x8010be2c
+8010a58a:	e8 31 66 ff ff       	call   80100bc0 <panic>
+8010a58f:	90                   	nop
+
+8010a590 <pagein>:
+// the kernel must be able to write wherever a system call's
+// buffer argument points.)  Returns 0 on success, -1 if va is
+// outside the process or there is no memory.
+static int
+pagein(uint va)
+{
+8010a590:	55                   	push   %ebp
+  struct execseg *s;
+  struct inode *ip;
+  pte_t *pte;
+  uint n, off, perm;
+
+  va = PGROUNDDOWN(va);
+8010a591:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+{
+8010a596:	89 e5                	mov    %esp,%ebp
+8010a598:	57                   	push   %edi
+8010a599:	56                   	push   %esi
+8010a59a:	53                   	push   %ebx
+8010a59b:	83 ec 1c             	sub    $0x1c,%esp
+  if(va >= proc->sz)
+8010a59e:	65 8b 35 04 00 00 00 	mov    %gs:0x4,%esi
+8010a5a5:	3b 46 34             	cmp    0x34(%esi),%eax
+8010a5a8:	0f 83 92 01 00 00    	jae    8010a740 <pagein+0x1b0>
+  pde = &pgdir[PDX(va)];
+8010a5ae:	89 c1                	mov    %eax,%ecx
+8010a5b0:	89 c2                	mov    %eax,%edx
+  if(*pde & PTE_P){
+8010a5b2:	8b 46 38             	mov    0x38(%esi),%eax
+  pde = &pgdir[PDX(va)];
+8010a5b5:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010a5b8:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+8010a5bb:	a8 01                	test   $0x1,%al
+8010a5bd:	74 69                	je     8010a628 <pagein+0x98>
+  return &pgtab[PTX(va)];
+8010a5bf:	89 d1                	mov    %edx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a5c1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a5c6:	c1 e9 0a             	shr    $0xa,%ecx
+8010a5c9:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010a5cf:	8d 9c 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%ebx
+    return -1;
+  pte = walkpgdir(proc->pgdir, (char*)va, 0);
+  if(pte && (*pte & PTE_SWAP)){
+8010a5d6:	85 db                	test   %ebx,%ebx
+8010a5d8:	74 4e                	je     8010a628 <pagein+0x98>
+8010a5da:	f7 03 00 04 00 00    	testl  $0x400,(%ebx)
+8010a5e0:	74 46                	je     8010a628 <pagein+0x98>
+    if((mem = kalloc()) == 0)
+8010a5e2:	e8 69 92 ff ff       	call   80103850 <kalloc>
+8010a5e7:	89 c6                	mov    %eax,%esi
+8010a5e9:	85 c0                	test   %eax,%eax
+8010a5eb:	0f 84 4f 01 00 00    	je     8010a740 <pagein+0x1b0>
+      return -1;
+    swapread(PTE_ADDR(*pte) >> PTXSHIFT, mem);
+8010a5f1:	83 ec 08             	sub    $0x8,%esp
+    swapfree(PTE_ADDR(*pte) >> PTXSHIFT);
+    *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+8010a5f4:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+    swapread(PTE_ADDR(*pte) >> PTXSHIFT, mem);
+8010a5fa:	50                   	push   %eax
+8010a5fb:	8b 03                	mov    (%ebx),%eax
+    *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+8010a5fd:	83 ce 07             	or     $0x7,%esi
+    swapread(PTE_ADDR(*pte) >> PTXSHIFT, mem);
+8010a600:	c1 e8 0c             	shr    $0xc,%eax
+8010a603:	50                   	push   %eax
+8010a604:	e8 c7 d3 ff ff       	call   801079d0 <swapread>
+    swapfree(PTE_ADDR(*pte) >> PTXSHIFT);
+8010a609:	8b 03                	mov    (%ebx),%eax
+8010a60b:	c1 e8 0c             	shr    $0xc,%eax
+8010a60e:	89 04 24             	mov    %eax,(%esp)
+8010a611:	e8 6a d3 ff ff       	call   80107980 <swapfree>
+    *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+8010a616:	89 33                	mov    %esi,(%ebx)
+    return 0;
+8010a618:	83 c4 10             	add    $0x10,%esp
+8010a61b:	31 c0                	xor    %eax,%eax
+  if(mappages(proc->pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+8010a61d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a620:	5b                   	pop    %ebx
+8010a621:	5e                   	pop    %esi
+8010a622:	5f                   	pop    %edi
+8010a623:	5d                   	pop    %ebp
+8010a624:	c3                   	ret
+8010a625:	8d 76 00             	lea    0x0(%esi),%esi
+  for(s = proc->seg; s < &proc->seg[proc->nseg]; s++){
+8010a628:	8b 8e 08 01 00 00    	mov    0x108(%esi),%ecx
+8010a62e:	8d 86 c8 00 00 00    	lea    0xc8(%esi),%eax
+8010a634:	c1 e1 04             	shl    $0x4,%ecx
+8010a637:	8d bc 0e c8 00 00 00 	lea    0xc8(%esi,%ecx,1),%edi
+8010a63e:	39 f8                	cmp    %edi,%eax
+8010a640:	0f 83 15 01 00 00    	jae    8010a75b <pagein+0x1cb>
+    if(va < s->va || va >= s->va + s->filesz)
+8010a646:	8b 08                	mov    (%eax),%ecx
+8010a648:	39 ca                	cmp    %ecx,%edx
+8010a64a:	0f 82 00 01 00 00    	jb     8010a750 <pagein+0x1c0>
+8010a650:	8b 58 08             	mov    0x8(%eax),%ebx
+8010a653:	01 cb                	add    %ecx,%ebx
+8010a655:	39 da                	cmp    %ebx,%edx
+8010a657:	0f 83 f3 00 00 00    	jae    8010a750 <pagein+0x1c0>
+    ip = proc->exe;
+8010a65d:	8b be c4 00 00 00    	mov    0xc4(%esi),%edi
+    off = s->off + va - s->va;
+8010a663:	8b 70 04             	mov    0x4(%eax),%esi
+    n = s->va + s->filesz - va;
+8010a666:	29 d3                	sub    %edx,%ebx
+8010a668:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    off = s->off + va - s->va;
+8010a66b:	01 d6                	add    %edx,%esi
+8010a66d:	89 f0                	mov    %esi,%eax
+8010a66f:	29 c8                	sub    %ecx,%eax
+8010a671:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(n > PGSIZE)
+8010a674:	b8 00 10 00 00       	mov    $0x1000,%eax
+8010a679:	39 c3                	cmp    %eax,%ebx
+8010a67b:	0f 46 c3             	cmovbe %ebx,%eax
+    ilock(ip);
+8010a67e:	83 ec 0c             	sub    $0xc,%esp
+    if(n > PGSIZE)
+8010a681:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    ilock(ip);
+8010a684:	57                   	push   %edi
+8010a685:	e8 36 7b ff ff       	call   801021c0 <ilock>
+    if(n == PGSIZE)
+8010a68a:	83 c4 10             	add    $0x10,%esp
+8010a68d:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+8010a693:	8b 55 dc             	mov    -0x24(%ebp),%edx
+8010a696:	0f 87 dc 00 00 00    	ja     8010a778 <pagein+0x1e8>
+8010a69c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+      if((mem = kzalloc()) == 0 || readi(ip, mem, off, n) != n){
+8010a69f:	e8 bc 92 ff ff       	call   80103960 <kzalloc>
+8010a6a4:	8b 55 dc             	mov    -0x24(%ebp),%edx
+8010a6a7:	85 c0                	test   %eax,%eax
+8010a6a9:	89 c6                	mov    %eax,%esi
+8010a6ab:	0f 84 30 01 00 00    	je     8010a7e1 <pagein+0x251>
+8010a6b1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+8010a6b4:	ff 75 e4             	push   -0x1c(%ebp)
+8010a6b7:	ff 75 e0             	push   -0x20(%ebp)
+8010a6ba:	50                   	push   %eax
+8010a6bb:	57                   	push   %edi
+8010a6bc:	e8 1f 7e ff ff       	call   801024e0 <readi>
+8010a6c1:	83 c4 10             	add    $0x10,%esp
+8010a6c4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+8010a6c7:	8b 55 dc             	mov    -0x24(%ebp),%edx
+8010a6ca:	0f 85 f8 00 00 00    	jne    8010a7c8 <pagein+0x238>
+      if(n == PGSIZE && pcput(ip->dev, ip->inum, off, mem))
+8010a6d0:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+8010a6d6:	0f 87 c4 00 00 00    	ja     8010a7a0 <pagein+0x210>
+    iunlock(ip);
+8010a6dc:	83 ec 0c             	sub    $0xc,%esp
+8010a6df:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010a6e2:	57                   	push   %edi
+8010a6e3:	e8 a8 7b ff ff       	call   80102290 <iunlock>
+    if(krefcnt(mem) > 1)
+8010a6e8:	89 34 24             	mov    %esi,(%esp)
+8010a6eb:	e8 c0 93 ff ff       	call   80103ab0 <krefcnt>
+8010a6f0:	83 c4 10             	add    $0x10,%esp
+8010a6f3:	b9 06 00 00 00       	mov    $0x6,%ecx
+8010a6f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010a6fb:	83 f8 01             	cmp    $0x1,%eax
+8010a6fe:	b8 04 02 00 00       	mov    $0x204,%eax
+8010a703:	0f 4e c1             	cmovle %ecx,%eax
+  if(mappages(proc->pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+8010a706:	65 8b 0d 04 00 00 00 	mov    %gs:0x4,%ecx
+8010a70d:	83 ec 08             	sub    $0x8,%esp
+8010a710:	8b 59 38             	mov    0x38(%ecx),%ebx
+8010a713:	50                   	push   %eax
+8010a714:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+8010a71a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a71f:	50                   	push   %eax
+8010a720:	89 d8                	mov    %ebx,%eax
+8010a722:	e8 99 fd ff ff       	call   8010a4c0 <mappages>
+8010a727:	83 c4 10             	add    $0x10,%esp
+8010a72a:	85 c0                	test   %eax,%eax
+8010a72c:	0f 89 e9 fe ff ff    	jns    8010a61b <pagein+0x8b>
+    kfree(mem);
+8010a732:	83 ec 0c             	sub    $0xc,%esp
+8010a735:	56                   	push   %esi
+8010a736:	e8 75 8e ff ff       	call   801035b0 <kfree>
+    return -1;
+8010a73b:	83 c4 10             	add    $0x10,%esp
+8010a73e:	66 90                	xchg   %ax,%ax
+    return -1;
+8010a740:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a745:	e9 d3 fe ff ff       	jmp    8010a61d <pagein+0x8d>
+8010a74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(s = proc->seg; s < &proc->seg[proc->nseg]; s++){
+8010a750:	83 c0 10             	add    $0x10,%eax
+8010a753:	39 f8                	cmp    %edi,%eax
+8010a755:	0f 82 eb fe ff ff    	jb     8010a646 <pagein+0xb6>
+8010a75b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  if(mem == 0 && (mem = kzalloc()) == 0)
+8010a75e:	e8 fd 91 ff ff       	call   80103960 <kzalloc>
+8010a763:	89 c6                	mov    %eax,%esi
+8010a765:	85 c0                	test   %eax,%eax
+8010a767:	74 d7                	je     8010a740 <pagein+0x1b0>
+8010a769:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010a76c:	b8 06 00 00 00       	mov    $0x6,%eax
+8010a771:	eb 93                	jmp    8010a706 <pagein+0x176>
+8010a773:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a777:	90                   	nop
+      mem = pcget(ip->dev, ip->inum, off);
+8010a778:	83 ec 04             	sub    $0x4,%esp
+8010a77b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+8010a77e:	ff 75 e0             	push   -0x20(%ebp)
+8010a781:	ff 77 04             	push   0x4(%edi)
+8010a784:	ff 37                	push   (%edi)
+8010a786:	e8 25 a8 ff ff       	call   80104fb0 <pcget>
+    if(mem == 0){
+8010a78b:	83 c4 10             	add    $0x10,%esp
+8010a78e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+8010a791:	85 c0                	test   %eax,%eax
+      mem = pcget(ip->dev, ip->inum, off);
+8010a793:	89 c6                	mov    %eax,%esi
+    if(mem == 0){
+8010a795:	0f 85 41 ff ff ff    	jne    8010a6dc <pagein+0x14c>
+8010a79b:	e9 fc fe ff ff       	jmp    8010a69c <pagein+0x10c>
+8010a7a0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+      if(n == PGSIZE && pcput(ip->dev, ip->inum, off, mem))
+8010a7a3:	56                   	push   %esi
+8010a7a4:	ff 75 e0             	push   -0x20(%ebp)
+8010a7a7:	ff 77 04             	push   0x4(%edi)
+8010a7aa:	ff 37                	push   (%edi)
+8010a7ac:	e8 7f a8 ff ff       	call   80105030 <pcput>
+8010a7b1:	83 c4 10             	add    $0x10,%esp
+8010a7b4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010a7b7:	85 c0                	test   %eax,%eax
+8010a7b9:	0f 84 1d ff ff ff    	je     8010a6dc <pagein+0x14c>
+        ip->flags |= I_PCACHE;
+8010a7bf:	83 4f 4c 04          	orl    $0x4,0x4c(%edi)
+8010a7c3:	e9 14 ff ff ff       	jmp    8010a6dc <pagein+0x14c>
+        iunlock(ip);
+8010a7c8:	83 ec 0c             	sub    $0xc,%esp
+8010a7cb:	57                   	push   %edi
+8010a7cc:	e8 bf 7a ff ff       	call   80102290 <iunlock>
+          kfree(mem);
+8010a7d1:	89 34 24             	mov    %esi,(%esp)
+8010a7d4:	e8 d7 8d ff ff       	call   801035b0 <kfree>
+8010a7d9:	83 c4 10             	add    $0x10,%esp
+8010a7dc:	e9 5f ff ff ff       	jmp    8010a740 <pagein+0x1b0>
+        iunlock(ip);
+8010a7e1:	83 ec 0c             	sub    $0xc,%esp
+8010a7e4:	57                   	push   %edi
+8010a7e5:	e8 a6 7a ff ff       	call   80102290 <iunlock>
+8010a7ea:	83 c4 10             	add    $0x10,%esp
+8010a7ed:	e9 4e ff ff ff       	jmp    8010a740 <pagein+0x1b0>
+8010a7f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+8010a800 <seginit>:
+{
+8010a800:	55                   	push   %ebp
+8010a801:	89 e5                	mov    %esp,%ebp
+8010a803:	53                   	push   %ebx
+  c->gdt[SEG_KCPU] = SEG(STA_W, &c->cpu, 8, 0);
+8010a804:	31 db                	xor    %ebx,%ebx
+{
+8010a806:	83 ec 14             	sub    $0x14,%esp
+  c = &cpus[cpunum()];
+8010a809:	e8 02 95 ff ff       	call   80103d10 <cpunum>
+8010a80e:	c1 e0 08             	shl    $0x8,%eax
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a811:	8d 90 c0 e9 17 80    	lea    -0x7fe81640(%eax),%edx
+  c->gdt[SEG_KCPU] = SEG(STA_W, &c->cpu, 8, 0);
+8010a817:	8d 88 9c ea 17 80    	lea    -0x7fe81564(%eax),%ecx
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a81d:	c7 80 38 ea 17 80 ff 	movl   $0xffff,-0x7fe815c8(%eax)
+8010a824:	ff 00 00 
+8010a827:	c7 42 7c 00 9a cf 00 	movl   $0xcf9a00,0x7c(%edx)
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010a82e:	c7 80 40 ea 17 80 ff 	movl   $0xffff,-0x7fe815c0(%eax)
+8010a835:	ff 00 00 
+8010a838:	c7 82 84 00 00 00 00 	movl   $0xcf9200,0x84(%edx)
+8010a83f:	92 cf 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010a842:	c7 80 50 ea 17 80 ff 	movl   $0xffff,-0x7fe815b0(%eax)
+8010a849:	ff 00 00 
+8010a84c:	c7 82 94 00 00 00 00 	movl   $0xcffa00,0x94(%edx)
+8010a853:	fa cf 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010a856:	c7 80 58 ea 17 80 ff 	movl   $0xffff,-0x7fe815a8(%eax)
+8010a85d:	ff 00 00 
+  lgdt(c->gdt, sizeof(c->gdt));
+8010a860:	05 30 ea 17 80       	add    $0x8017ea30,%eax
+  c->gdt[SEG_KCPU] = SEG(STA_W, &c->cpu, 8, 0);
+8010a865:	66 89 9a 88 00 00 00 	mov    %bx,0x88(%edx)
+8010a86c:	89 cb                	mov    %ecx,%ebx
+8010a86e:	66 89 8a 8a 00 00 00 	mov    %cx,0x8a(%edx)
+8010a875:	c1 e9 18             	shr    $0x18,%ecx
+8010a878:	c1 eb 10             	shr    $0x10,%ebx
+8010a87b:	88 8a 8f 00 00 00    	mov    %cl,0x8f(%edx)
+  pd[0] = size-1;
+8010a881:	b9 37 00 00 00       	mov    $0x37,%ecx
+8010a886:	66 89 4d f2          	mov    %cx,-0xe(%ebp)
+8010a88a:	88 9a 8c 00 00 00    	mov    %bl,0x8c(%edx)
+8010a890:	bb 92 c0 ff ff       	mov    $0xffffc092,%ebx
+  pd[1] = (uint)p;
+8010a895:	66 89 45 f4          	mov    %ax,-0xc(%ebp)
+  pd[2] = (uint)p >> 16;
+8010a899:	c1 e8 10             	shr    $0x10,%eax
+8010a89c:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010a8a0:	8d 45 f2             	lea    -0xe(%ebp),%eax
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010a8a3:	c7 82 9c 00 00 00 00 	movl   $0xcff200,0x9c(%edx)
+8010a8aa:	f2 cf 00 
+  c->gdt[SEG_KCPU] = SEG(STA_W, &c->cpu, 8, 0);
+8010a8ad:	66 89 9a 8d 00 00 00 	mov    %bx,0x8d(%edx)
+8010a8b4:	0f 01 10             	lgdtl  (%eax)
+  asm volatile("movw %0, %%gs" : : "r" (v));
+8010a8b7:	b8 18 00 00 00       	mov    $0x18,%eax
+8010a8bc:	8e e8                	mov    %eax,%gs
+  proc = 0;
+8010a8be:	65 c7 05 04 00 00 00 	movl   $0x0,%gs:0x4
+8010a8c5:	00 00 00 00 
+  c = &cpus[cpunum()];
+8010a8c9:	65 89 15 00 00 00 00 	mov    %edx,%gs:0x0
+}
+8010a8d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010a8d3:	c9                   	leave
+8010a8d4:	c3                   	ret
+8010a8d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a8dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010a8e0 <setupkvm>:
+{
+8010a8e0:	55                   	push   %ebp
+8010a8e1:	89 e5                	mov    %esp,%ebp
+8010a8e3:	57                   	push   %edi
+8010a8e4:	56                   	push   %esi
+8010a8e5:	53                   	push   %ebx
+8010a8e6:	83 ec 1c             	sub    $0x1c,%esp
+  if((pgdir = (pde_t*)kzalloc()) == 0)
+8010a8e9:	e8 72 90 ff ff       	call   80103960 <kzalloc>
+8010a8ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010a8f1:	85 c0                	test   %eax,%eax
+8010a8f3:	0f 84 cf 00 00 00    	je     8010a9c8 <setupkvm+0xe8>
+  if(kpgdir){
+8010a8f9:	8b 15 84 23 1a 80    	mov    0x801a2384,%edx
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010a8ff:	b8 20 e4 10 80       	mov    $0x8010e420,%eax
+  if(kpgdir){
+8010a904:	85 d2                	test   %edx,%edx
+8010a906:	0f 85 d4 00 00 00    	jne    8010a9e0 <setupkvm+0x100>
+  perm |= PTE_G;
+8010a90c:	8b 50 0c             	mov    0xc(%eax),%edx
+                (uint)k->phys_start, k->perm) < 0)
+8010a90f:	8b 70 04             	mov    0x4(%eax),%esi
+  while(size > 0){
+8010a912:	8b 58 08             	mov    0x8(%eax),%ebx
+  a = (uint)va;
+8010a915:	8b 38                	mov    (%eax),%edi
+  perm |= PTE_G;
+8010a917:	80 ce 01             	or     $0x1,%dh
+8010a91a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  while(size > 0){
+8010a91d:	29 f3                	sub    %esi,%ebx
+8010a91f:	0f 84 86 00 00 00    	je     8010a9ab <setupkvm+0xcb>
+8010a925:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010a928:	eb 38                	jmp    8010a962 <setupkvm+0x82>
+8010a92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      n = PTSIZE - a % PTSIZE;  // up to the next 4MB boundary
+8010a930:	b9 00 00 40 00       	mov    $0x400000,%ecx
+      if(mappages(pgdir, (void*)a, n, pa, perm) < 0)
+8010a935:	89 fa                	mov    %edi,%edx
+      n = PTSIZE - a % PTSIZE;  // up to the next 4MB boundary
+8010a937:	29 c1                	sub    %eax,%ecx
+8010a939:	39 d9                	cmp    %ebx,%ecx
+8010a93b:	0f 47 cb             	cmova  %ebx,%ecx
+      if(mappages(pgdir, (void*)a, n, pa, perm) < 0)
+8010a93e:	83 ec 08             	sub    $0x8,%esp
+8010a941:	ff 75 dc             	push   -0x24(%ebp)
+8010a944:	56                   	push   %esi
+8010a945:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010a948:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010a94b:	e8 70 fb ff ff       	call   8010a4c0 <mappages>
+8010a950:	83 c4 10             	add    $0x10,%esp
+8010a953:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010a956:	85 c0                	test   %eax,%eax
+8010a958:	78 6e                	js     8010a9c8 <setupkvm+0xe8>
+    a += n;
+8010a95a:	01 cf                	add    %ecx,%edi
+    pa += n;
+8010a95c:	01 ce                	add    %ecx,%esi
+  while(size > 0){
+8010a95e:	29 cb                	sub    %ecx,%ebx
+8010a960:	74 46                	je     8010a9a8 <setupkvm+0xc8>
+    if(a % PTSIZE == 0 && pa % PTSIZE == 0 && size >= PTSIZE){
+8010a962:	89 f9                	mov    %edi,%ecx
+8010a964:	89 f8                	mov    %edi,%eax
+8010a966:	09 f1                	or     %esi,%ecx
+8010a968:	25 ff ff 3f 00       	and    $0x3fffff,%eax
+8010a96d:	81 e1 ff ff 3f 00    	and    $0x3fffff,%ecx
+8010a973:	75 bb                	jne    8010a930 <setupkvm+0x50>
+8010a975:	81 fb ff ff 3f 00    	cmp    $0x3fffff,%ebx
+8010a97b:	76 b3                	jbe    8010a930 <setupkvm+0x50>
+      if(pgdir[PDX(a)] & PTE_P)
+8010a97d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010a980:	89 f8                	mov    %edi,%eax
+8010a982:	c1 e8 16             	shr    $0x16,%eax
+8010a985:	8d 0c 82             	lea    (%edx,%eax,4),%ecx
+8010a988:	f6 01 01             	testb  $0x1,(%ecx)
+8010a98b:	75 7e                	jne    8010aa0b <setupkvm+0x12b>
+      pgdir[PDX(a)] = pa | perm | PTE_P | PTE_PS;
+8010a98d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010a990:	09 f0                	or     %esi,%eax
+8010a992:	0c 81                	or     $0x81,%al
+8010a994:	89 01                	mov    %eax,(%ecx)
+      n = PTSIZE;
+8010a996:	b9 00 00 40 00       	mov    $0x400000,%ecx
+    a += n;
+8010a99b:	01 cf                	add    %ecx,%edi
+    pa += n;
+8010a99d:	01 ce                	add    %ecx,%esi
+  while(size > 0){
+8010a99f:	29 cb                	sub    %ecx,%ebx
+8010a9a1:	75 bf                	jne    8010a962 <setupkvm+0x82>
+8010a9a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a9a7:	90                   	nop
+8010a9a8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010a9ab:	83 c0 10             	add    $0x10,%eax
+8010a9ae:	3d 60 e4 10 80       	cmp    $0x8010e460,%eax
+8010a9b3:	0f 85 53 ff ff ff    	jne    8010a90c <setupkvm+0x2c>
+}
+8010a9b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010a9bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a9bf:	5b                   	pop    %ebx
+8010a9c0:	5e                   	pop    %esi
+8010a9c1:	5f                   	pop    %edi
+8010a9c2:	5d                   	pop    %ebp
+8010a9c3:	c3                   	ret
+8010a9c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return 0;
+8010a9c8:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+}
+8010a9cf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010a9d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a9d5:	5b                   	pop    %ebx
+8010a9d6:	5e                   	pop    %esi
+8010a9d7:	5f                   	pop    %edi
+8010a9d8:	5d                   	pop    %ebp
+8010a9d9:	c3                   	ret
+8010a9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+8010a9e0:	83 ec 04             	sub    $0x4,%esp
+8010a9e3:	81 c2 00 08 00 00    	add    $0x800,%edx
+8010a9e9:	68 00 08 00 00       	push   $0x800
+8010a9ee:	52                   	push   %edx
+8010a9ef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010a9f2:	05 00 08 00 00       	add    $0x800,%eax
+8010a9f7:	50                   	push   %eax
+8010a9f8:	e8 d3 c8 ff ff       	call   801072d0 <memmove>
+}
+8010a9fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    return pgdir;
+8010aa00:	83 c4 10             	add    $0x10,%esp
+}
+8010aa03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aa06:	5b                   	pop    %ebx
+8010aa07:	5e                   	pop    %esi
+8010aa08:	5f                   	pop    %edi
+8010aa09:	5d                   	pop    %ebp
+8010aa0a:	c3                   	ret
+        panic("remap");
+8010aa0b:	83 ec 0c             	sub    $0xc,%esp
+8010aa0e:	68 2c be 10 80       	push   $0x8010be2c
+8010aa13:	e8 a8 61 ff ff       	call   80100bc0 <panic>
+8010aa18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aa1f:	90                   	nop
+
+8010aa20 <kvmalloc>:
+{
+8010aa20:	55                   	push   %ebp
+8010aa21:	89 e5                	mov    %esp,%ebp
+8010aa23:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010aa26:	e8 b5 fe ff ff       	call   8010a8e0 <setupkvm>
+8010aa2b:	a3 84 23 1a 80       	mov    %eax,0x801a2384
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010aa30:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010aa35:	0f 22 d8             	mov    %eax,%cr3
+}
+8010aa38:	c9                   	leave
+8010aa39:	c3                   	ret
+8010aa3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010aa40 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010aa40:	a1 84 23 1a 80       	mov    0x801a2384,%eax
+8010aa45:	05 00 00 00 80       	add    $0x80000000,%eax
+8010aa4a:	0f 22 d8             	mov    %eax,%cr3
+}
+8010aa4d:	c3                   	ret
+8010aa4e:	66 90                	xchg   %ax,%ax
+
+8010aa50 <switchuvm>:
+{
+8010aa50:	55                   	push   %ebp
+8010aa51:	89 e5                	mov    %esp,%ebp
+8010aa53:	56                   	push   %esi
+  cpu->gdt[SEG_TSS] = SEG16(STS_T32A, &cpu->ts, sizeof(cpu->ts)-1, 0);
+8010aa54:	be 89 40 00 00       	mov    $0x4089,%esi
+{
+8010aa59:	53                   	push   %ebx
+8010aa5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+8010aa5d:	e8 9e c4 ff ff       	call   80106f00 <pushcli>
+  cpu->gdt[SEG_TSS] = SEG16(STS_T32A, &cpu->ts, sizeof(cpu->ts)-1, 0);
+8010aa62:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+8010aa68:	b9 67 00 00 00       	mov    $0x67,%ecx
+8010aa6d:	8d 50 08             	lea    0x8(%eax),%edx
+8010aa70:	66 89 88 a0 00 00 00 	mov    %cx,0xa0(%eax)
+8010aa77:	66 89 90 a2 00 00 00 	mov    %dx,0xa2(%eax)
+8010aa7e:	89 d1                	mov    %edx,%ecx
+8010aa80:	c1 ea 18             	shr    $0x18,%edx
+8010aa83:	88 90 a7 00 00 00    	mov    %dl,0xa7(%eax)
+  cpu->ts.ss0 = SEG_KDATA << 3;
+8010aa89:	ba 10 00 00 00       	mov    $0x10,%edx
+  cpu->gdt[SEG_TSS] = SEG16(STS_T32A, &cpu->ts, sizeof(cpu->ts)-1, 0);
+8010aa8e:	c1 e9 10             	shr    $0x10,%ecx
+  cpu->ts.ss0 = SEG_KDATA << 3;
+8010aa91:	66 89 50 10          	mov    %dx,0x10(%eax)
+  cpu->ts.esp0 = (uint)proc->kstack + KSTACKSIZE;
+8010aa95:	65 8b 15 04 00 00 00 	mov    %gs:0x4,%edx
+  cpu->gdt[SEG_TSS] = SEG16(STS_T32A, &cpu->ts, sizeof(cpu->ts)-1, 0);
+8010aa9c:	88 88 a4 00 00 00    	mov    %cl,0xa4(%eax)
+  cpu->ts.iomb = (ushort) 0xFFFF;
+8010aaa2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  cpu->gdt[SEG_TSS] = SEG16(STS_T32A, &cpu->ts, sizeof(cpu->ts)-1, 0);
+8010aaa7:	66 89 b0 a5 00 00 00 	mov    %si,0xa5(%eax)
+  cpu->ts.esp0 = (uint)proc->kstack + KSTACKSIZE;
+8010aaae:	8b 52 3c             	mov    0x3c(%edx),%edx
+  cpu->ts.iomb = (ushort) 0xFFFF;
+8010aab1:	66 89 48 6e          	mov    %cx,0x6e(%eax)
+  cpu->ts.esp0 = (uint)proc->kstack + KSTACKSIZE;
+8010aab5:	81 c2 00 10 00 00    	add    $0x1000,%edx
+8010aabb:	89 50 0c             	mov    %edx,0xc(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010aabe:	b8 30 00 00 00       	mov    $0x30,%eax
+8010aac3:	0f 00 d8             	ltr    %ax
+  if(p->pgdir == 0)
+8010aac6:	8b 5b 38             	mov    0x38(%ebx),%ebx
+8010aac9:	85 db                	test   %ebx,%ebx
+8010aacb:	74 62                	je     8010ab2f <switchuvm+0xdf>
+  pushcli();
+8010aacd:	e8 2e c4 ff ff       	call   80106f00 <pushcli>
+  old = cpu->pgdir;
+8010aad2:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+8010aad8:	8b b0 b4 00 00 00    	mov    0xb4(%eax),%esi
+  if(pgdir != kpgdir)
+8010aade:	3b 1d 84 23 1a 80    	cmp    0x801a2384,%ebx
+8010aae4:	74 12                	je     8010aaf8 <switchuvm+0xa8>
+    kdup((char*)pgdir);
+8010aae6:	83 ec 0c             	sub    $0xc,%esp
+8010aae9:	53                   	push   %ebx
+8010aaea:	e8 a1 8f ff ff       	call   80103a90 <kdup>
+  cpu->pgdir = pgdir;
+8010aaef:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+8010aaf5:	83 c4 10             	add    $0x10,%esp
+  lcr3(V2P(pgdir));
+8010aaf8:	8d 93 00 00 00 80    	lea    -0x80000000(%ebx),%edx
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010aafe:	0f 22 da             	mov    %edx,%cr3
+  cpu->pgdir = pgdir;
+8010ab01:	89 98 b4 00 00 00    	mov    %ebx,0xb4(%eax)
+  popcli();
+8010ab07:	e8 24 c4 ff ff       	call   80106f30 <popcli>
+  if(old && old != kpgdir)
+8010ab0c:	85 f6                	test   %esi,%esi
+8010ab0e:	74 14                	je     8010ab24 <switchuvm+0xd4>
+8010ab10:	3b 35 84 23 1a 80    	cmp    0x801a2384,%esi
+8010ab16:	74 0c                	je     8010ab24 <switchuvm+0xd4>
+    kfree((char*)old);
+8010ab18:	83 ec 0c             	sub    $0xc,%esp
+8010ab1b:	56                   	push   %esi
+8010ab1c:	e8 8f 8a ff ff       	call   801035b0 <kfree>
+8010ab21:	83 c4 10             	add    $0x10,%esp
+}
+8010ab24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010ab27:	5b                   	pop    %ebx
+8010ab28:	5e                   	pop    %esi
+8010ab29:	5d                   	pop    %ebp
+  popcli();
+8010ab2a:	e9 01 c4 ff ff       	jmp    80106f30 <popcli>
+    panic("switchuvm: no pgdir");
+8010ab2f:	83 ec 0c             	sub    $0xc,%esp
+8010ab32:	68 32 be 10 80       	push   $0x8010be32
+8010ab37:	e8 84 60 ff ff       	call   80100bc0 <panic>
+8010ab3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010ab40 <inituvm>:
+{
+8010ab40:	55                   	push   %ebp
+8010ab41:	89 e5                	mov    %esp,%ebp
+8010ab43:	57                   	push   %edi
+8010ab44:	56                   	push   %esi
+8010ab45:	53                   	push   %ebx
+8010ab46:	83 ec 1c             	sub    $0x1c,%esp
+8010ab49:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ab4c:	8b 75 10             	mov    0x10(%ebp),%esi
+8010ab4f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010ab52:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(sz >= PGSIZE)
+8010ab55:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010ab5b:	77 3a                	ja     8010ab97 <inituvm+0x57>
+  mem = kzalloc();
+8010ab5d:	e8 fe 8d ff ff       	call   80103960 <kzalloc>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010ab62:	83 ec 08             	sub    $0x8,%esp
+8010ab65:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010ab6a:	31 d2                	xor    %edx,%edx
+  mem = kzalloc();
+8010ab6c:	89 c3                	mov    %eax,%ebx
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010ab6e:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+8010ab74:	6a 06                	push   $0x6
+8010ab76:	50                   	push   %eax
+8010ab77:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010ab7a:	e8 41 f9 ff ff       	call   8010a4c0 <mappages>
+  memmove(mem, init, sz);
+8010ab7f:	89 75 10             	mov    %esi,0x10(%ebp)
+8010ab82:	83 c4 10             	add    $0x10,%esp
+8010ab85:	89 7d 0c             	mov    %edi,0xc(%ebp)
+8010ab88:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010ab8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ab8e:	5b                   	pop    %ebx
+8010ab8f:	5e                   	pop    %esi
+8010ab90:	5f                   	pop    %edi
+8010ab91:	5d                   	pop    %ebp
+  memmove(mem, init, sz);
+8010ab92:	e9 39 c7 ff ff       	jmp    801072d0 <memmove>
+    panic("inituvm: more than a page");
+8010ab97:	83 ec 0c             	sub    $0xc,%esp
+8010ab9a:	68 46 be 10 80       	push   $0x8010be46
+8010ab9f:	e8 1c 60 ff ff       	call   80100bc0 <panic>
+8010aba4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010abab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010abaf:	90                   	nop
+
+8010abb0 <allocuvm>:
+{
+8010abb0:	55                   	push   %ebp
+8010abb1:	89 e5                	mov    %esp,%ebp
+8010abb3:	57                   	push   %edi
+8010abb4:	56                   	push   %esi
+8010abb5:	53                   	push   %ebx
+8010abb6:	83 ec 1c             	sub    $0x1c,%esp
+8010abb9:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(newsz >= KERNBASE)
+8010abbc:	85 f6                	test   %esi,%esi
+8010abbe:	0f 88 89 00 00 00    	js     8010ac4d <allocuvm+0x9d>
+8010abc4:	89 f2                	mov    %esi,%edx
+  if(newsz < oldsz)
+8010abc6:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010abc9:	0f 82 91 00 00 00    	jb     8010ac60 <allocuvm+0xb0>
+  a = PGROUNDUP(oldsz);
+8010abcf:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010abd2:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010abd7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010abdc:	89 c7                	mov    %eax,%edi
+  for(; a < newsz; a += PGSIZE){
+8010abde:	39 f0                	cmp    %esi,%eax
+8010abe0:	0f 83 7d 00 00 00    	jae    8010ac63 <allocuvm+0xb3>
+8010abe6:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+8010abe9:	eb 35                	jmp    8010ac20 <allocuvm+0x70>
+8010abeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010abef:	90                   	nop
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010abf0:	83 ec 08             	sub    $0x8,%esp
+8010abf3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+8010abf9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010abfe:	89 fa                	mov    %edi,%edx
+8010ac00:	6a 06                	push   $0x6
+8010ac02:	50                   	push   %eax
+8010ac03:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ac06:	e8 b5 f8 ff ff       	call   8010a4c0 <mappages>
+8010ac0b:	83 c4 10             	add    $0x10,%esp
+8010ac0e:	85 c0                	test   %eax,%eax
+8010ac10:	78 5e                	js     8010ac70 <allocuvm+0xc0>
+  for(; a < newsz; a += PGSIZE){
+8010ac12:	81 c7 00 10 00 00    	add    $0x1000,%edi
+8010ac18:	39 f7                	cmp    %esi,%edi
+8010ac1a:	0f 83 88 00 00 00    	jae    8010aca8 <allocuvm+0xf8>
+    mem = kzalloc();
+8010ac20:	e8 3b 8d ff ff       	call   80103960 <kzalloc>
+8010ac25:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+8010ac27:	85 c0                	test   %eax,%eax
+8010ac29:	75 c5                	jne    8010abf0 <allocuvm+0x40>
+      cprintf("allocuvm out of memory\n");
+8010ac2b:	83 ec 0c             	sub    $0xc,%esp
+8010ac2e:	68 60 be 10 80       	push   $0x8010be60
+8010ac33:	e8 b8 62 ff ff       	call   80100ef0 <cprintf>
+  if(newsz >= oldsz)
+8010ac38:	83 c4 10             	add    $0x10,%esp
+8010ac3b:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010ac3e:	74 0d                	je     8010ac4d <allocuvm+0x9d>
+8010ac40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010ac43:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ac46:	89 f2                	mov    %esi,%edx
+8010ac48:	e8 93 f7 ff ff       	call   8010a3e0 <deallocuvm.part.0>
+    return 0;
+8010ac4d:	31 d2                	xor    %edx,%edx
+}
+8010ac4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ac52:	89 d0                	mov    %edx,%eax
+8010ac54:	5b                   	pop    %ebx
+8010ac55:	5e                   	pop    %esi
+8010ac56:	5f                   	pop    %edi
+8010ac57:	5d                   	pop    %ebp
+8010ac58:	c3                   	ret
+8010ac59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return oldsz;
+8010ac60:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+8010ac63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ac66:	89 d0                	mov    %edx,%eax
+8010ac68:	5b                   	pop    %ebx
+8010ac69:	5e                   	pop    %esi
+8010ac6a:	5f                   	pop    %edi
+8010ac6b:	5d                   	pop    %ebp
+8010ac6c:	c3                   	ret
+8010ac6d:	8d 76 00             	lea    0x0(%esi),%esi
+      cprintf("allocuvm out of memory (2)\n");
+8010ac70:	83 ec 0c             	sub    $0xc,%esp
+8010ac73:	68 78 be 10 80       	push   $0x8010be78
+8010ac78:	e8 73 62 ff ff       	call   80100ef0 <cprintf>
+  if(newsz >= oldsz)
+8010ac7d:	83 c4 10             	add    $0x10,%esp
+8010ac80:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010ac83:	74 0d                	je     8010ac92 <allocuvm+0xe2>
+8010ac85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010ac88:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ac8b:	89 f2                	mov    %esi,%edx
+8010ac8d:	e8 4e f7 ff ff       	call   8010a3e0 <deallocuvm.part.0>
+      kfree(mem);
+8010ac92:	83 ec 0c             	sub    $0xc,%esp
+8010ac95:	53                   	push   %ebx
+8010ac96:	e8 15 89 ff ff       	call   801035b0 <kfree>
+      return 0;
+8010ac9b:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010ac9e:	31 d2                	xor    %edx,%edx
+8010aca0:	eb ad                	jmp    8010ac4f <allocuvm+0x9f>
+8010aca2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+8010aca8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+}
+8010acab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010acae:	5b                   	pop    %ebx
+8010acaf:	5e                   	pop    %esi
+8010acb0:	89 d0                	mov    %edx,%eax
+8010acb2:	5f                   	pop    %edi
+8010acb3:	5d                   	pop    %ebp
+8010acb4:	c3                   	ret
+8010acb5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010acbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010acc0 <deallocuvm>:
+{
+8010acc0:	55                   	push   %ebp
+8010acc1:	89 e5                	mov    %esp,%ebp
+8010acc3:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010acc6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010acc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(newsz >= oldsz)
+8010accc:	39 d1                	cmp    %edx,%ecx
+8010acce:	73 10                	jae    8010ace0 <deallocuvm+0x20>
+}
+8010acd0:	5d                   	pop    %ebp
+8010acd1:	e9 0a f7 ff ff       	jmp    8010a3e0 <deallocuvm.part.0>
+8010acd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010acdd:	8d 76 00             	lea    0x0(%esi),%esi
+8010ace0:	89 d0                	mov    %edx,%eax
+8010ace2:	5d                   	pop    %ebp
+8010ace3:	c3                   	ret
+8010ace4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010acef:	90                   	nop
+
+8010acf0 <freevm>:
+{
+8010acf0:	55                   	push   %ebp
+8010acf1:	89 e5                	mov    %esp,%ebp
+8010acf3:	57                   	push   %edi
+8010acf4:	56                   	push   %esi
+8010acf5:	53                   	push   %ebx
+8010acf6:	83 ec 0c             	sub    $0xc,%esp
+8010acf9:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(pgdir == 0)
+8010acfc:	85 f6                	test   %esi,%esi
+8010acfe:	74 5f                	je     8010ad5f <freevm+0x6f>
+  if(newsz >= oldsz)
+8010ad00:	31 c9                	xor    %ecx,%ecx
+8010ad02:	ba 00 00 00 80       	mov    $0x80000000,%edx
+8010ad07:	89 f0                	mov    %esi,%eax
+8010ad09:	89 f3                	mov    %esi,%ebx
+8010ad0b:	e8 d0 f6 ff ff       	call   8010a3e0 <deallocuvm.part.0>
+  for(i = 0; i < PDX(KERNBASE); i++){
+8010ad10:	8d be 00 08 00 00    	lea    0x800(%esi),%edi
+8010ad16:	eb 0f                	jmp    8010ad27 <freevm+0x37>
+8010ad18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ad1f:	90                   	nop
+8010ad20:	83 c3 04             	add    $0x4,%ebx
+8010ad23:	39 fb                	cmp    %edi,%ebx
+8010ad25:	74 29                	je     8010ad50 <freevm+0x60>
+    if(pgdir[i] & PTE_P){
+8010ad27:	8b 03                	mov    (%ebx),%eax
+8010ad29:	a8 01                	test   $0x1,%al
+8010ad2b:	74 f3                	je     8010ad20 <freevm+0x30>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010ad2d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      kfree(v);
+8010ad32:	83 ec 0c             	sub    $0xc,%esp
+      pgdir[i] = 0;
+8010ad35:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  for(i = 0; i < PDX(KERNBASE); i++){
+8010ad3b:	83 c3 04             	add    $0x4,%ebx
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010ad3e:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010ad43:	50                   	push   %eax
+8010ad44:	e8 67 88 ff ff       	call   801035b0 <kfree>
+8010ad49:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < PDX(KERNBASE); i++){
+8010ad4c:	39 fb                	cmp    %edi,%ebx
+8010ad4e:	75 d7                	jne    8010ad27 <freevm+0x37>
+  kfree((char*)pgdir);
+8010ad50:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+8010ad53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ad56:	5b                   	pop    %ebx
+8010ad57:	5e                   	pop    %esi
+8010ad58:	5f                   	pop    %edi
+8010ad59:	5d                   	pop    %ebp
+  kfree((char*)pgdir);
+8010ad5a:	e9 51 88 ff ff       	jmp    801035b0 <kfree>
+    panic("freevm: no pgdir");
+8010ad5f:	83 ec 0c             	sub    $0xc,%esp
+8010ad62:	68 94 be 10 80       	push   $0x8010be94
+8010ad67:	e8 54 5e ff ff       	call   80100bc0 <panic>
+8010ad6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010ad70 <clearpteu>:
+{
+8010ad70:	55                   	push   %ebp
+8010ad71:	89 e5                	mov    %esp,%ebp
+8010ad73:	83 ec 08             	sub    $0x8,%esp
+8010ad76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010ad79:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+8010ad7c:	89 c1                	mov    %eax,%ecx
+8010ad7e:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010ad81:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010ad84:	f6 c2 01             	test   $0x1,%dl
+8010ad87:	75 17                	jne    8010ada0 <clearpteu+0x30>
+    panic("clearpteu");
+8010ad89:	83 ec 0c             	sub    $0xc,%esp
+8010ad8c:	68 a5 be 10 80       	push   $0x8010bea5
+8010ad91:	e8 2a 5e ff ff       	call   80100bc0 <panic>
+8010ad96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ad9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010ada0:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ada3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+8010ada9:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010adae:	8d 84 02 00 00 00 80 	lea    -0x80000000(%edx,%eax,1),%eax
+  if(pte == 0)
+8010adb5:	85 c0                	test   %eax,%eax
+8010adb7:	74 d0                	je     8010ad89 <clearpteu+0x19>
+  *pte &= ~PTE_U;
+8010adb9:	83 20 fb             	andl   $0xfffffffb,(%eax)
+}
+8010adbc:	c9                   	leave
+8010adbd:	c3                   	ret
+8010adbe:	66 90                	xchg   %ax,%ax
+
+8010adc0 <copyuvm>:
+{
+8010adc0:	55                   	push   %ebp
+8010adc1:	89 e5                	mov    %esp,%ebp
+8010adc3:	57                   	push   %edi
+8010adc4:	56                   	push   %esi
+8010adc5:	53                   	push   %ebx
+8010adc6:	83 ec 1c             	sub    $0x1c,%esp
+  if((d = setupkvm()) == 0)
+8010adc9:	e8 12 fb ff ff       	call   8010a8e0 <setupkvm>
+8010adce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010add1:	85 c0                	test   %eax,%eax
+8010add3:	0f 84 f0 00 00 00    	je     8010aec9 <copyuvm+0x109>
+  for(i = 0; i < sz; i += PGSIZE){
+8010add9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010addc:	31 ff                	xor    %edi,%edi
+8010adde:	85 c9                	test   %ecx,%ecx
+8010ade0:	75 75                	jne    8010ae57 <copyuvm+0x97>
+8010ade2:	e9 89 01 00 00       	jmp    8010af70 <copyuvm+0x1b0>
+8010ade7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010adee:	66 90                	xchg   %ax,%ax
+    if(!(*pte & PTE_P))
+8010adf0:	a8 01                	test   $0x1,%al
+8010adf2:	74 54                	je     8010ae48 <copyuvm+0x88>
+    pa = PTE_ADDR(*pte);
+8010adf4:	89 c6                	mov    %eax,%esi
+8010adf6:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+    if(*pte & PTE_U){
+8010adfc:	a8 04                	test   $0x4,%al
+8010adfe:	0f 84 14 01 00 00    	je     8010af18 <copyuvm+0x158>
+      if(*pte & PTE_W)
+8010ae04:	a8 02                	test   $0x2,%al
+8010ae06:	74 0a                	je     8010ae12 <copyuvm+0x52>
+        *pte = (*pte & ~PTE_W) | PTE_COW;
+8010ae08:	25 fd fd ff ff       	and    $0xfffffdfd,%eax
+8010ae0d:	80 cc 02             	or     $0x2,%ah
+8010ae10:	89 02                	mov    %eax,(%edx)
+      if(mappages(d, (void*)i, PGSIZE, pa, PTE_FLAGS(*pte)) < 0)
+8010ae12:	83 ec 08             	sub    $0x8,%esp
+8010ae15:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010ae1a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010ae1f:	89 fa                	mov    %edi,%edx
+8010ae21:	50                   	push   %eax
+8010ae22:	56                   	push   %esi
+8010ae23:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010ae26:	e8 95 f6 ff ff       	call   8010a4c0 <mappages>
+8010ae2b:	83 c4 10             	add    $0x10,%esp
+8010ae2e:	85 c0                	test   %eax,%eax
+8010ae30:	78 7e                	js     8010aeb0 <copyuvm+0xf0>
+      kdup(P2V(pa));
+8010ae32:	83 ec 0c             	sub    $0xc,%esp
+8010ae35:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+8010ae3b:	56                   	push   %esi
+8010ae3c:	e8 4f 8c ff ff       	call   80103a90 <kdup>
+      continue;
+8010ae41:	83 c4 10             	add    $0x10,%esp
+8010ae44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < sz; i += PGSIZE){
+8010ae48:	81 c7 00 10 00 00    	add    $0x1000,%edi
+8010ae4e:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+8010ae51:	0f 83 19 01 00 00    	jae    8010af70 <copyuvm+0x1b0>
+  if(*pde & PTE_P){
+8010ae57:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  pde = &pgdir[PDX(va)];
+8010ae5a:	89 f8                	mov    %edi,%eax
+8010ae5c:	c1 e8 16             	shr    $0x16,%eax
+8010ae5f:	8d 34 85 00 00 00 00 	lea    0x0(,%eax,4),%esi
+  if(*pde & PTE_P){
+8010ae66:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+8010ae69:	a8 01                	test   $0x1,%al
+8010ae6b:	74 db                	je     8010ae48 <copyuvm+0x88>
+  return &pgtab[PTX(va)];
+8010ae6d:	89 fb                	mov    %edi,%ebx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ae6f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010ae74:	c1 eb 0a             	shr    $0xa,%ebx
+8010ae77:	81 e3 fc 0f 00 00    	and    $0xffc,%ebx
+8010ae7d:	8d 94 03 00 00 00 80 	lea    -0x80000000(%ebx,%eax,1),%edx
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+8010ae84:	85 d2                	test   %edx,%edx
+8010ae86:	74 c0                	je     8010ae48 <copyuvm+0x88>
+    if(*pte & PTE_SWAP){
+8010ae88:	8b 02                	mov    (%edx),%eax
+8010ae8a:	f6 c4 04             	test   $0x4,%ah
+8010ae8d:	0f 84 5d ff ff ff    	je     8010adf0 <copyuvm+0x30>
+  pde = &pgdir[PDX(va)];
+8010ae93:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010ae96:	01 ce                	add    %ecx,%esi
+  if(*pde & PTE_P){
+8010ae98:	8b 0e                	mov    (%esi),%ecx
+8010ae9a:	f6 c1 01             	test   $0x1,%cl
+8010ae9d:	74 41                	je     8010aee0 <copyuvm+0x120>
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ae9f:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010aea5:	8d 8c 0b 00 00 00 80 	lea    -0x80000000(%ebx,%ecx,1),%ecx
+      if((cpte = walkpgdir(d, (void *) i, 1)) == 0)
+8010aeac:	85 c9                	test   %ecx,%ecx
+8010aeae:	75 4f                	jne    8010aeff <copyuvm+0x13f>
+  freevm(d);
+8010aeb0:	83 ec 0c             	sub    $0xc,%esp
+8010aeb3:	ff 75 e4             	push   -0x1c(%ebp)
+8010aeb6:	e8 35 fe ff ff       	call   8010acf0 <freevm>
+  lcr3(V2P(pgdir));
+8010aebb:	8b 45 08             	mov    0x8(%ebp),%eax
+8010aebe:	05 00 00 00 80       	add    $0x80000000,%eax
+8010aec3:	0f 22 d8             	mov    %eax,%cr3
+  return 0;
+8010aec6:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010aec9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+}
+8010aed0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010aed3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aed6:	5b                   	pop    %ebx
+8010aed7:	5e                   	pop    %esi
+8010aed8:	5f                   	pop    %edi
+8010aed9:	5d                   	pop    %ebp
+8010aeda:	c3                   	ret
+8010aedb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010aedf:	90                   	nop
+8010aee0:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    if(!alloc || (pgtab = (pte_t*)kzalloc()) == 0)
+8010aee3:	e8 78 8a ff ff       	call   80103960 <kzalloc>
+8010aee8:	85 c0                	test   %eax,%eax
+8010aeea:	74 c4                	je     8010aeb0 <copyuvm+0xf0>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010aeec:	8d 88 00 00 00 80    	lea    -0x80000000(%eax),%ecx
+      *cpte = *pte;
+8010aef2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010aef5:	83 c9 07             	or     $0x7,%ecx
+8010aef8:	89 0e                	mov    %ecx,(%esi)
+  return &pgtab[PTX(va)];
+8010aefa:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+      *cpte = *pte;
+8010aefd:	8b 02                	mov    (%edx),%eax
+8010aeff:	89 01                	mov    %eax,(%ecx)
+      swapdup(PTE_ADDR(*pte) >> PTXSHIFT);
+8010af01:	83 ec 0c             	sub    $0xc,%esp
+8010af04:	c1 e8 0c             	shr    $0xc,%eax
+8010af07:	50                   	push   %eax
+8010af08:	e8 43 ca ff ff       	call   80107950 <swapdup>
+      continue;
+8010af0d:	83 c4 10             	add    $0x10,%esp
+8010af10:	e9 33 ff ff ff       	jmp    8010ae48 <copyuvm+0x88>
+8010af15:	8d 76 00             	lea    0x0(%esi),%esi
+    flags = PTE_FLAGS(*pte);
+8010af18:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010af1d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if((mem = kalloc()) == 0)
+8010af20:	e8 2b 89 ff ff       	call   80103850 <kalloc>
+8010af25:	89 c3                	mov    %eax,%ebx
+8010af27:	85 c0                	test   %eax,%eax
+8010af29:	74 85                	je     8010aeb0 <copyuvm+0xf0>
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+8010af2b:	83 ec 04             	sub    $0x4,%esp
+8010af2e:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+8010af34:	68 00 10 00 00       	push   $0x1000
+8010af39:	56                   	push   %esi
+8010af3a:	50                   	push   %eax
+8010af3b:	e8 90 c3 ff ff       	call   801072d0 <memmove>
+    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0)
+8010af40:	58                   	pop    %eax
+8010af41:	5a                   	pop    %edx
+8010af42:	8d 93 00 00 00 80    	lea    -0x80000000(%ebx),%edx
+8010af48:	ff 75 e0             	push   -0x20(%ebp)
+8010af4b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010af50:	52                   	push   %edx
+8010af51:	89 fa                	mov    %edi,%edx
+8010af53:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010af56:	e8 65 f5 ff ff       	call   8010a4c0 <mappages>
+8010af5b:	83 c4 10             	add    $0x10,%esp
+8010af5e:	85 c0                	test   %eax,%eax
+8010af60:	0f 89 e2 fe ff ff    	jns    8010ae48 <copyuvm+0x88>
+8010af66:	e9 45 ff ff ff       	jmp    8010aeb0 <copyuvm+0xf0>
+8010af6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010af6f:	90                   	nop
+  lcr3(V2P(pgdir));  // flush the parent's now read-only pages
+8010af70:	8b 45 08             	mov    0x8(%ebp),%eax
+8010af73:	05 00 00 00 80       	add    $0x80000000,%eax
+8010af78:	0f 22 d8             	mov    %eax,%cr3
+}
+8010af7b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010af7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010af81:	5b                   	pop    %ebx
+8010af82:	5e                   	pop    %esi
+8010af83:	5f                   	pop    %edi
+8010af84:	5d                   	pop    %ebp
+8010af85:	c3                   	ret
+8010af86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010af8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010af90 <cowfault>:
+{
+8010af90:	55                   	push   %ebp
+8010af91:	89 e5                	mov    %esp,%ebp
+8010af93:	57                   	push   %edi
+8010af94:	56                   	push   %esi
+8010af95:	53                   	push   %ebx
+8010af96:	83 ec 1c             	sub    $0x1c,%esp
+8010af99:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(va >= KERNBASE || (pte = walkpgdir(pgdir, (char*)va, 0)) == 0)
+8010af9c:	85 f6                	test   %esi,%esi
+8010af9e:	0f 88 7c 00 00 00    	js     8010b020 <cowfault+0x90>
+  if(*pde & PTE_P){
+8010afa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010afa7:	89 f2                	mov    %esi,%edx
+8010afa9:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+8010afac:	8b 04 90             	mov    (%eax,%edx,4),%eax
+8010afaf:	a8 01                	test   $0x1,%al
+8010afb1:	74 6d                	je     8010b020 <cowfault+0x90>
+  return &pgtab[PTX(va)];
+8010afb3:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010afb5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010afba:	c1 ea 0a             	shr    $0xa,%edx
+8010afbd:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010afc3:	8d bc 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%edi
+  if(va >= KERNBASE || (pte = walkpgdir(pgdir, (char*)va, 0)) == 0)
+8010afca:	85 ff                	test   %edi,%edi
+8010afcc:	74 52                	je     8010b020 <cowfault+0x90>
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+8010afce:	8b 07                	mov    (%edi),%eax
+8010afd0:	89 c2                	mov    %eax,%edx
+8010afd2:	81 e2 05 02 00 00    	and    $0x205,%edx
+8010afd8:	81 fa 05 02 00 00    	cmp    $0x205,%edx
+8010afde:	75 40                	jne    8010b020 <cowfault+0x90>
+  pa = PTE_ADDR(*pte);
+8010afe0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if(krefcnt(P2V(pa)) == 1){
+8010afe5:	83 ec 0c             	sub    $0xc,%esp
+8010afe8:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+8010afee:	53                   	push   %ebx
+8010afef:	e8 bc 8a ff ff       	call   80103ab0 <krefcnt>
+8010aff4:	83 c4 10             	add    $0x10,%esp
+8010aff7:	83 f8 01             	cmp    $0x1,%eax
+8010affa:	75 34                	jne    8010b030 <cowfault+0xa0>
+    *pte = (*pte | PTE_W) & ~PTE_COW;
+8010affc:	8b 07                	mov    (%edi),%eax
+8010affe:	25 fd fd ff ff       	and    $0xfffffdfd,%eax
+8010b003:	83 c8 02             	or     $0x2,%eax
+8010b006:	89 07                	mov    %eax,(%edi)
+  invlpg((char*)PGROUNDDOWN(va));
+8010b008:	89 f0                	mov    %esi,%eax
+8010b00a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+8010b00f:	0f 01 38             	invlpg (%eax)
+}
+8010b012:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b015:	31 c0                	xor    %eax,%eax
+}
+8010b017:	5b                   	pop    %ebx
+8010b018:	5e                   	pop    %esi
+8010b019:	5f                   	pop    %edi
+8010b01a:	5d                   	pop    %ebp
+8010b01b:	c3                   	ret
+8010b01c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010b023:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b028:	5b                   	pop    %ebx
+8010b029:	5e                   	pop    %esi
+8010b02a:	5f                   	pop    %edi
+8010b02b:	5d                   	pop    %ebp
+8010b02c:	c3                   	ret
+8010b02d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((mem = kalloc()) == 0)
+8010b030:	e8 1b 88 ff ff       	call   80103850 <kalloc>
+8010b035:	85 c0                	test   %eax,%eax
+8010b037:	74 e7                	je     8010b020 <cowfault+0x90>
+    memmove(mem, P2V(pa), PGSIZE);
+8010b039:	83 ec 04             	sub    $0x4,%esp
+8010b03c:	68 00 10 00 00       	push   $0x1000
+8010b041:	53                   	push   %ebx
+8010b042:	50                   	push   %eax
+8010b043:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010b046:	e8 85 c2 ff ff       	call   801072d0 <memmove>
+    *pte = V2P(mem) | ((PTE_FLAGS(*pte) | PTE_W) & ~PTE_COW);
+8010b04b:	8b 07                	mov    (%edi),%eax
+8010b04d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b050:	25 fd 0d 00 00       	and    $0xdfd,%eax
+8010b055:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010b05b:	09 d0                	or     %edx,%eax
+8010b05d:	83 c8 02             	or     $0x2,%eax
+8010b060:	89 07                	mov    %eax,(%edi)
+    kfree(P2V(pa));
+8010b062:	89 1c 24             	mov    %ebx,(%esp)
+8010b065:	e8 46 85 ff ff       	call   801035b0 <kfree>
+8010b06a:	83 c4 10             	add    $0x10,%esp
+8010b06d:	eb 99                	jmp    8010b008 <cowfault+0x78>
+8010b06f:	90                   	nop
+
+8010b070 <pgfault>:
+// is a kernel bug, which must not be papered over with a zero
+// page.  Serving it could not fail the system call anyway, and
+// the kernel may hold a spinlock, so could not wait for memory.
+int
+pgfault(uint va, uint err)
+{
+8010b070:	55                   	push   %ebp
+8010b071:	89 e5                	mov    %esp,%ebp
+8010b073:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010b076:	8b 55 08             	mov    0x8(%ebp),%edx
+  if((err & FEC_U) == 0)
+8010b079:	a8 04                	test   $0x4,%al
+8010b07b:	74 33                	je     8010b0b0 <pgfault+0x40>
+    return -1;
+  if(err & FEC_PR){
+8010b07d:	a8 01                	test   $0x1,%al
+8010b07f:	74 1f                	je     8010b0a0 <pgfault+0x30>
+    if(err & FEC_WR)
+8010b081:	a8 02                	test   $0x2,%al
+8010b083:	74 2b                	je     8010b0b0 <pgfault+0x40>
+      return cowfault(proc->pgdir, va);
+8010b085:	89 55 0c             	mov    %edx,0xc(%ebp)
+8010b088:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+8010b08e:	8b 40 38             	mov    0x38(%eax),%eax
+8010b091:	89 45 08             	mov    %eax,0x8(%ebp)
+    return -1;
+  }
+  return pagein(va);
+}
+8010b094:	5d                   	pop    %ebp
+      return cowfault(proc->pgdir, va);
+8010b095:	e9 f6 fe ff ff       	jmp    8010af90 <cowfault>
+8010b09a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return pagein(va);
+8010b0a0:	89 d0                	mov    %edx,%eax
+}
+8010b0a2:	5d                   	pop    %ebp
+  return pagein(va);
+8010b0a3:	e9 e8 f4 ff ff       	jmp    8010a590 <pagein>
+8010b0a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b0af:	90                   	nop
+}
+8010b0b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b0b5:	5d                   	pop    %ebp
+8010b0b6:	c3                   	ret
+8010b0b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b0be:	66 90                	xchg   %ax,%ax
+
+8010b0c0 <uvmprefault>:
+// any copy-on-write ones, so that the kernel can use the memory
+// without a page fault.  Returns -1 if out of memory, which
+// fails the system call.
+int
+uvmprefault(uint va, uint len, int write)
+{
+8010b0c0:	55                   	push   %ebp
+8010b0c1:	89 e5                	mov    %esp,%ebp
+8010b0c3:	57                   	push   %edi
+8010b0c4:	56                   	push   %esi
+8010b0c5:	53                   	push   %ebx
+8010b0c6:	83 ec 0c             	sub    $0xc,%esp
+8010b0c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  uint a;
+  pte_t *pte;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010b0cc:	89 fb                	mov    %edi,%ebx
+8010b0ce:	03 7d 0c             	add    0xc(%ebp),%edi
+8010b0d1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010b0d7:	39 fb                	cmp    %edi,%ebx
+8010b0d9:	72 37                	jb     8010b112 <uvmprefault+0x52>
+8010b0db:	e9 b0 00 00 00       	jmp    8010b190 <uvmprefault+0xd0>
+  return &pgtab[PTX(va)];
+8010b0e0:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b0e2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b0e7:	c1 e9 0a             	shr    $0xa,%ecx
+8010b0ea:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010b0f0:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    pte = walkpgdir(proc->pgdir, (char*)a, 0);
+    if((pte == 0 || !(*pte & PTE_P)) && pagein(a) < 0)
+8010b0f7:	85 c0                	test   %eax,%eax
+8010b0f9:	74 2c                	je     8010b127 <uvmprefault+0x67>
+8010b0fb:	8b 00                	mov    (%eax),%eax
+8010b0fd:	a8 01                	test   $0x1,%al
+8010b0ff:	74 26                	je     8010b127 <uvmprefault+0x67>
+      return -1;
+    if(write){
+8010b101:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010b104:	85 c9                	test   %ecx,%ecx
+8010b106:	75 5c                	jne    8010b164 <uvmprefault+0xa4>
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010b108:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b10e:	39 fb                	cmp    %edi,%ebx
+8010b110:	73 7e                	jae    8010b190 <uvmprefault+0xd0>
+    pte = walkpgdir(proc->pgdir, (char*)a, 0);
+8010b112:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  pde = &pgdir[PDX(va)];
+8010b118:	89 de                	mov    %ebx,%esi
+8010b11a:	c1 ee 16             	shr    $0x16,%esi
+    pte = walkpgdir(proc->pgdir, (char*)a, 0);
+8010b11d:	8b 50 38             	mov    0x38(%eax),%edx
+  if(*pde & PTE_P){
+8010b120:	8b 04 b2             	mov    (%edx,%esi,4),%eax
+8010b123:	a8 01                	test   $0x1,%al
+8010b125:	75 b9                	jne    8010b0e0 <uvmprefault+0x20>
+    if((pte == 0 || !(*pte & PTE_P)) && pagein(a) < 0)
+8010b127:	89 d8                	mov    %ebx,%eax
+8010b129:	e8 62 f4 ff ff       	call   8010a590 <pagein>
+8010b12e:	85 c0                	test   %eax,%eax
+8010b130:	78 48                	js     8010b17a <uvmprefault+0xba>
+    if(write){
+8010b132:	8b 45 10             	mov    0x10(%ebp),%eax
+8010b135:	85 c0                	test   %eax,%eax
+8010b137:	74 cf                	je     8010b108 <uvmprefault+0x48>
+      pte = walkpgdir(proc->pgdir, (char*)a, 0);
+8010b139:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+8010b13f:	8b 50 38             	mov    0x38(%eax),%edx
+  if(*pde & PTE_P){
+8010b142:	8b 04 b2             	mov    (%edx,%esi,4),%eax
+8010b145:	a8 01                	test   $0x1,%al
+8010b147:	0f 84 bd 02 00 00    	je     8010b40a <uvmprefault.cold>
+  return &pgtab[PTX(va)];
+8010b14d:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b14f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b154:	c1 e9 0c             	shr    $0xc,%ecx
+8010b157:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+      if((*pte & PTE_COW) && cowfault(proc->pgdir, a) < 0)
+8010b15d:	8b 84 88 00 00 00 80 	mov    -0x80000000(%eax,%ecx,4),%eax
+8010b164:	f6 c4 02             	test   $0x2,%ah
+8010b167:	74 9f                	je     8010b108 <uvmprefault+0x48>
+8010b169:	83 ec 08             	sub    $0x8,%esp
+8010b16c:	53                   	push   %ebx
+8010b16d:	52                   	push   %edx
+8010b16e:	e8 1d fe ff ff       	call   8010af90 <cowfault>
+8010b173:	83 c4 10             	add    $0x10,%esp
+8010b176:	85 c0                	test   %eax,%eax
+8010b178:	79 8e                	jns    8010b108 <uvmprefault+0x48>
+        return -1;
+    }
+  }
+  return 0;
+}
+8010b17a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010b17d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b182:	5b                   	pop    %ebx
+8010b183:	5e                   	pop    %esi
+8010b184:	5f                   	pop    %edi
+8010b185:	5d                   	pop    %ebp
+8010b186:	c3                   	ret
+8010b187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b18e:	66 90                	xchg   %ax,%ax
+8010b190:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b193:	31 c0                	xor    %eax,%eax
+}
+8010b195:	5b                   	pop    %ebx
+8010b196:	5e                   	pop    %esi
+8010b197:	5f                   	pop    %edi
+8010b198:	5d                   	pop    %ebp
+8010b199:	c3                   	ret
+8010b19a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010b1a0 <uvmswapout>:
+// in page[] and slot[], for the caller to write out and free.
+// Advances *va past the pages looked at; returns pages unmapped.
+// The process must not be running.
+int
+uvmswapout(pde_t *pgdir, uint sz, uint *va, char **page, int *slot, int n)
+{
+8010b1a0:	55                   	push   %ebp
+8010b1a1:	89 e5                	mov    %esp,%ebp
+8010b1a3:	57                   	push   %edi
+  pte_t *pte;
+  uint a;
+  int i, s;
+
+  i = 0;
+8010b1a4:	31 ff                	xor    %edi,%edi
+{
+8010b1a6:	56                   	push   %esi
+8010b1a7:	53                   	push   %ebx
+8010b1a8:	83 ec 1c             	sub    $0x1c,%esp
+8010b1ab:	8b 75 10             	mov    0x10(%ebp),%esi
+  for(a = *va; a < sz && i < n; a += PGSIZE){
+8010b1ae:	8b 45 1c             	mov    0x1c(%ebp),%eax
+8010b1b1:	8b 1e                	mov    (%esi),%ebx
+8010b1b3:	85 c0                	test   %eax,%eax
+8010b1b5:	7e 6c                	jle    8010b223 <uvmswapout+0x83>
+8010b1b7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+8010b1ba:	72 16                	jb     8010b1d2 <uvmswapout+0x32>
+8010b1bc:	eb 65                	jmp    8010b223 <uvmswapout+0x83>
+8010b1be:	66 90                	xchg   %ax,%ax
+    if((pte = walkpgdir(pgdir, (char*)a, 0)) == 0){
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;  // skip to next page table
+8010b1c0:	83 c2 01             	add    $0x1,%edx
+8010b1c3:	89 d3                	mov    %edx,%ebx
+8010b1c5:	c1 e3 16             	shl    $0x16,%ebx
+  for(a = *va; a < sz && i < n; a += PGSIZE){
+8010b1c8:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+8010b1cb:	73 53                	jae    8010b220 <uvmswapout+0x80>
+8010b1cd:	3b 7d 1c             	cmp    0x1c(%ebp),%edi
+8010b1d0:	7d 4e                	jge    8010b220 <uvmswapout+0x80>
+  if(*pde & PTE_P){
+8010b1d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010b1d5:	89 da                	mov    %ebx,%edx
+8010b1d7:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+8010b1da:	8b 04 90             	mov    (%eax,%edx,4),%eax
+8010b1dd:	a8 01                	test   $0x1,%al
+8010b1df:	74 df                	je     8010b1c0 <uvmswapout+0x20>
+  return &pgtab[PTX(va)];
+8010b1e1:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b1e3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b1e8:	c1 e9 0a             	shr    $0xa,%ecx
+8010b1eb:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010b1f1:	8d b4 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%esi
+    if((pte = walkpgdir(pgdir, (char*)a, 0)) == 0){
+8010b1f8:	85 f6                	test   %esi,%esi
+8010b1fa:	74 c4                	je     8010b1c0 <uvmswapout+0x20>
+      continue;
+    }
+    if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+8010b1fc:	8b 06                	mov    (%esi),%eax
+8010b1fe:	89 c2                	mov    %eax,%edx
+8010b200:	83 e2 05             	and    $0x5,%edx
+8010b203:	83 fa 05             	cmp    $0x5,%edx
+8010b206:	0f 85 84 00 00 00    	jne    8010b290 <uvmswapout+0xf0>
+      continue;
+    if(*pte & PTE_A){
+8010b20c:	a8 20                	test   $0x20,%al
+8010b20e:	74 20                	je     8010b230 <uvmswapout+0x90>
+      *pte &= ~PTE_A;
+8010b210:	83 e0 df             	and    $0xffffffdf,%eax
+  for(a = *va; a < sz && i < n; a += PGSIZE){
+8010b213:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+      *pte &= ~PTE_A;
+8010b219:	89 06                	mov    %eax,(%esi)
+  for(a = *va; a < sz && i < n; a += PGSIZE){
+8010b21b:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+8010b21e:	72 ad                	jb     8010b1cd <uvmswapout+0x2d>
+8010b220:	8b 75 10             	mov    0x10(%ebp),%esi
+      break;
+    page[i] = P2V(PTE_ADDR(*pte));
+    slot[i++] = s;
+    *pte = (s << PTXSHIFT) | PTE_SWAP;
+  }
+  *va = a;
+8010b223:	89 1e                	mov    %ebx,(%esi)
+  return i;
+}
+8010b225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b228:	89 f8                	mov    %edi,%eax
+8010b22a:	5b                   	pop    %ebx
+8010b22b:	5e                   	pop    %esi
+8010b22c:	5f                   	pop    %edi
+8010b22d:	5d                   	pop    %ebp
+8010b22e:	c3                   	ret
+8010b22f:	90                   	nop
+    if(krefcnt(P2V(PTE_ADDR(*pte))) > 1)
+8010b230:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b235:	83 ec 0c             	sub    $0xc,%esp
+8010b238:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b23d:	50                   	push   %eax
+8010b23e:	e8 6d 88 ff ff       	call   80103ab0 <krefcnt>
+8010b243:	83 c4 10             	add    $0x10,%esp
+8010b246:	83 f8 01             	cmp    $0x1,%eax
+8010b249:	7f 45                	jg     8010b290 <uvmswapout+0xf0>
+    if((s = swapalloc()) < 0)
+8010b24b:	e8 40 c6 ff ff       	call   80107890 <swapalloc>
+8010b250:	85 c0                	test   %eax,%eax
+8010b252:	78 cc                	js     8010b220 <uvmswapout+0x80>
+    page[i] = P2V(PTE_ADDR(*pte));
+8010b254:	8d 14 bd 00 00 00 00 	lea    0x0(,%edi,4),%edx
+8010b25b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+8010b25e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010b261:	8b 16                	mov    (%esi),%edx
+8010b263:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+8010b269:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010b26f:	89 14 b9             	mov    %edx,(%ecx,%edi,4)
+    slot[i++] = s;
+8010b272:	8b 4d 18             	mov    0x18(%ebp),%ecx
+8010b275:	83 c7 01             	add    $0x1,%edi
+8010b278:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b27b:	89 04 11             	mov    %eax,(%ecx,%edx,1)
+    *pte = (s << PTXSHIFT) | PTE_SWAP;
+8010b27e:	c1 e0 0c             	shl    $0xc,%eax
+8010b281:	80 cc 04             	or     $0x4,%ah
+8010b284:	89 06                	mov    %eax,(%esi)
+8010b286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b28d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(a = *va; a < sz && i < n; a += PGSIZE){
+8010b290:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b296:	e9 2d ff ff ff       	jmp    8010b1c8 <uvmswapout+0x28>
+8010b29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b29f:	90                   	nop
+
+8010b2a0 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010b2a0:	55                   	push   %ebp
+8010b2a1:	89 e5                	mov    %esp,%ebp
+8010b2a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(*pde & PTE_P){
+8010b2a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010b2a9:	89 d1                	mov    %edx,%ecx
+8010b2ab:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b2ae:	8b 0c 88             	mov    (%eax,%ecx,4),%ecx
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0 || (*pte & PTE_P) == 0)
+    return 0;
+8010b2b1:	31 c0                	xor    %eax,%eax
+  if(*pde & PTE_P){
+8010b2b3:	f6 c1 01             	test   $0x1,%cl
+8010b2b6:	74 36                	je     8010b2ee <uva2ka+0x4e>
+  return &pgtab[PTX(va)];
+8010b2b8:	c1 ea 0a             	shr    $0xa,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b2bb:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010b2c1:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010b2c7:	8d 84 11 00 00 00 80 	lea    -0x80000000(%ecx,%edx,1),%eax
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010b2ce:	85 c0                	test   %eax,%eax
+8010b2d0:	74 1c                	je     8010b2ee <uva2ka+0x4e>
+8010b2d2:	8b 00                	mov    (%eax),%eax
+  if((*pte & PTE_U) == 0)
+8010b2d4:	89 c2                	mov    %eax,%edx
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b2d6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((*pte & PTE_U) == 0)
+8010b2db:	83 e2 05             	and    $0x5,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b2de:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b2e3:	83 fa 05             	cmp    $0x5,%edx
+8010b2e6:	ba 00 00 00 00       	mov    $0x0,%edx
+8010b2eb:	0f 45 c2             	cmovne %edx,%eax
+}
+8010b2ee:	5d                   	pop    %ebp
+8010b2ef:	c3                   	ret
+
+8010b2f0 <copyout>:
+// uva2ka ensures this only works for PTE_U pages.
+// Writing through the kernel mapping would not fault, so break
+// copy-on-write sharing by hand.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010b2f0:	55                   	push   %ebp
+8010b2f1:	89 e5                	mov    %esp,%ebp
+8010b2f3:	57                   	push   %edi
+8010b2f4:	56                   	push   %esi
+8010b2f5:	53                   	push   %ebx
+8010b2f6:	83 ec 1c             	sub    $0x1c,%esp
+8010b2f9:	8b 75 14             	mov    0x14(%ebp),%esi
+8010b2fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *buf, *pa0;
+  uint n, va0;
+  pte_t *pte;
+
+  buf = (char*)p;
+  while(len > 0){
+8010b2ff:	85 f6                	test   %esi,%esi
+8010b301:	0f 85 8b 00 00 00    	jne    8010b392 <copyout+0xa2>
+8010b307:	e9 f4 00 00 00       	jmp    8010b400 <copyout+0x110>
+8010b30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return &pgtab[PTX(va)];
+8010b310:	89 f9                	mov    %edi,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b312:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b317:	c1 e9 0a             	shr    $0xa,%ecx
+8010b31a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010b320:	8d 84 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%eax
+    va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+8010b327:	85 c0                	test   %eax,%eax
+8010b329:	0f 84 80 00 00 00    	je     8010b3af <copyout+0xbf>
+8010b32f:	f7 00 00 02 00 00    	testl  $0x200,(%eax)
+8010b335:	0f 85 85 00 00 00    	jne    8010b3c0 <copyout+0xd0>
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010b33b:	8b 00                	mov    (%eax),%eax
+  if((*pte & PTE_U) == 0)
+8010b33d:	89 c2                	mov    %eax,%edx
+8010b33f:	83 e2 05             	and    $0x5,%edx
+8010b342:	83 fa 05             	cmp    $0x5,%edx
+8010b345:	75 68                	jne    8010b3af <copyout+0xbf>
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b347:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b34c:	89 c2                	mov    %eax,%edx
+8010b34e:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+      return -1;
+    pa0 = uva2ka(pgdir, (char*)va0);
+    if(pa0 == 0)
+8010b354:	81 fa 00 00 00 80    	cmp    $0x80000000,%edx
+8010b35a:	74 53                	je     8010b3af <copyout+0xbf>
+      return -1;
+    n = PGSIZE - (va - va0);
+8010b35c:	89 fa                	mov    %edi,%edx
+8010b35e:	29 da                	sub    %ebx,%edx
+8010b360:	81 c2 00 10 00 00    	add    $0x1000,%edx
+8010b366:	39 f2                	cmp    %esi,%edx
+8010b368:	0f 47 d6             	cmova  %esi,%edx
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+8010b36b:	29 fb                	sub    %edi,%ebx
+8010b36d:	83 ec 04             	sub    $0x4,%esp
+8010b370:	01 d8                	add    %ebx,%eax
+    len -= n;
+    buf += n;
+    va = va0 + PGSIZE;
+8010b372:	8d 9f 00 10 00 00    	lea    0x1000(%edi),%ebx
+    memmove(pa0 + (va - va0), buf, n);
+8010b378:	52                   	push   %edx
+8010b379:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010b37c:	ff 75 10             	push   0x10(%ebp)
+8010b37f:	50                   	push   %eax
+8010b380:	e8 4b bf ff ff       	call   801072d0 <memmove>
+    buf += n;
+8010b385:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  while(len > 0){
+8010b388:	83 c4 10             	add    $0x10,%esp
+    buf += n;
+8010b38b:	01 55 10             	add    %edx,0x10(%ebp)
+  while(len > 0){
+8010b38e:	29 d6                	sub    %edx,%esi
+8010b390:	74 6e                	je     8010b400 <copyout+0x110>
+  pde = &pgdir[PDX(va)];
+8010b392:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010b395:	89 d8                	mov    %ebx,%eax
+    va0 = (uint)PGROUNDDOWN(va);
+8010b397:	89 df                	mov    %ebx,%edi
+  pde = &pgdir[PDX(va)];
+8010b399:	c1 e8 16             	shr    $0x16,%eax
+    va0 = (uint)PGROUNDDOWN(va);
+8010b39c:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  pde = &pgdir[PDX(va)];
+8010b3a2:	8d 14 81             	lea    (%ecx,%eax,4),%edx
+  if(*pde & PTE_P){
+8010b3a5:	8b 02                	mov    (%edx),%eax
+8010b3a7:	a8 01                	test   $0x1,%al
+8010b3a9:	0f 85 61 ff ff ff    	jne    8010b310 <copyout+0x20>
+  }
+  return 0;
+}
+8010b3af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010b3b2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b3b7:	5b                   	pop    %ebx
+8010b3b8:	5e                   	pop    %esi
+8010b3b9:	5f                   	pop    %edi
+8010b3ba:	5d                   	pop    %ebp
+8010b3bb:	c3                   	ret
+8010b3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+8010b3c0:	83 ec 08             	sub    $0x8,%esp
+8010b3c3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010b3c6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010b3c9:	57                   	push   %edi
+8010b3ca:	ff 75 08             	push   0x8(%ebp)
+8010b3cd:	e8 be fb ff ff       	call   8010af90 <cowfault>
+8010b3d2:	83 c4 10             	add    $0x10,%esp
+8010b3d5:	85 c0                	test   %eax,%eax
+8010b3d7:	78 d6                	js     8010b3af <copyout+0xbf>
+  if(*pde & PTE_P){
+8010b3d9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b3dc:	8b 02                	mov    (%edx),%eax
+8010b3de:	a8 01                	test   $0x1,%al
+8010b3e0:	74 cd                	je     8010b3af <copyout+0xbf>
+  return &pgtab[PTX(va)];
+8010b3e2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b3e5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b3ea:	8d 84 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%eax
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010b3f1:	85 c0                	test   %eax,%eax
+8010b3f3:	0f 85 42 ff ff ff    	jne    8010b33b <copyout+0x4b>
+8010b3f9:	eb b4                	jmp    8010b3af <copyout+0xbf>
+8010b3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b3ff:	90                   	nop
+}
+8010b400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b403:	31 c0                	xor    %eax,%eax
+}
+8010b405:	5b                   	pop    %ebx
+8010b406:	5e                   	pop    %esi
+8010b407:	5f                   	pop    %edi
+8010b408:	5d                   	pop    %ebp
+8010b409:	c3                   	ret
+
+8010b40a <uvmprefault.cold>:
+      if((*pte & PTE_COW) && cowfault(proc->pgdir, a) < 0)
+8010b40a:	a1 00 00 00 00       	mov    0x0,%eax
+8010b40f:	0f 0b                	ud2
@@ -1,8 +1,10 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
+#include "proc.h"
 #include "fs.h"
 #include "buf.h"
 
@@ -17,8 +19,18 @@
 // A system call should call begin_op()/end_op() to mark
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
-// But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// But if it thinks the log is close to running out, or a
+// commit is due, it sleeps until the transaction is closed.
+//
+// Commits are grouped and done in the background by a kernel
+// thread, logd.  A transaction stays open for COMMITTICKS
+// ticks after its first write, absorbing the writes of every
+// system call in that time.  Then logd waits for the calls in
+// progress to finish, copies the transaction's blocks, and lets
+// the next transaction open at once: the copy is what goes to
+// the log and to the home locations, while system calls keep
+// modifying the cached blocks.  With COMMITTICKS 0, end_op()
+// also waits until its transaction is on disk.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
@@ -42,13 +54,24 @@ struct log {
   int size;
   int outstanding; // how many FS sys calls are executing.
   int committing;  // in commit(), please wait.
+  int wanted;      // close the open transaction, please wait.
   int dev;
-  struct logheader lh;
+  uint opened;     // ticks when lh got its first block
+  uint seq;        // number of the open transaction
+  uint done;       // number of the last transaction on disk
+  struct logheader lh;   // the open transaction
+  struct logheader clh;  // the transaction being committed
 };
 struct log log;
 
+// logd's copy of the header block and of the blocks of the
+// transaction being committed (or recovered).
+static uchar loghead[BSIZE];
+static uchar logdata[LOGSIZE][BSIZE];
+
 static void recover_from_log(void);
-static void commit();
+static void commit(void);
+static void logd(void);
 
 void
 initlog(int dev)
@@ -62,7 +85,28 @@ initlog(int dev)
   log.start = sb.logstart;
   log.size = sb.nlog;
   log.dev = dev;
+  log.seq = 1;
   recover_from_log();
+  kthread("logd", logd);
+}
+
+// Read or write block blockno straight from or to data, not
+// through the buffer cache, which holds newer contents of the
+// blocks being installed.  Only logd and recovery use the log.
+static void
+logrw(uint blockno, uchar *data, int write)
+{
+  struct buf b;
+
+  memset(&b, 0, sizeof(b));
+  initsleeplock(&b.lock, "logbuf");
+  b.dev = log.dev;
+  b.blockno = blockno;
+  b.data = data;
+  b.flags = write ? B_DIRTY : 0;
+  acquiresleep(&b.lock);
+  iderw(&b);
+  releasesleep(&b.lock);
 }
 
 // Copy committed blocks from log to their home location
@@ -71,28 +115,22 @@ install_trans(void)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
-  }
+  for (tail = 0; tail < log.clh.n; tail++)
+    logrw(log.clh.block[tail], logdata[tail], 1);  // write dst to disk
 }
 
 // Read the log header from disk into the in-memory log header
 static void
 read_head(void)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
+  struct logheader *lh = (struct logheader *) loghead;
   int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+
+  logrw(log.start, loghead, 0);
+  log.clh.n = lh->n;
+  for (i = 0; i < log.clh.n; i++) {
+    log.clh.block[i] = lh->block[i];
   }
-  brelse(buf);
 }
 
 // Write in-memory log header to disk.
@@ -101,23 +139,26 @@ read_head(void)
 static void
 write_head(void)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
+  struct logheader *hb = (struct logheader *) loghead;
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+
+  hb->n = log.clh.n;
+  for (i = 0; i < log.clh.n; i++) {
+    hb->block[i] = log.clh.block[i];
   }
-  bwrite(buf);
-  brelse(buf);
+  logrw(log.start, loghead, 1);
 }
 
 static void
 recover_from_log(void)
 {
+  int tail;
+
   read_head();
+  for (tail = 0; tail < log.clh.n; tail++)
+    logrw(log.start+tail+1, logdata[tail], 0);  // read log block
   install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
+  log.clh.n = 0;
   write_head(); // clear the log
 }
 
@@ -127,10 +168,12 @@ begin_op(void)
 {
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.committing || log.wanted){
       sleep(&log, &log.lock);
     } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
       // this op might exhaust log space; wait for commit.
+      log.wanted = 1;
+      wakeup(&log.lh);
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
@@ -141,62 +184,131 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// lets logd commit if this was the last outstanding operation
+// and a commit is due.
 void
 end_op(void)
 {
-  int do_commit = 0;
+  uint seq;
 
   acquire(&log.lock);
   log.outstanding -= 1;
   if(log.committing)
     panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space.
-    wakeup(&log);
+  seq = log.seq;
+  if(log.outstanding == 0 && (log.wanted || (COMMITTICKS == 0 && log.lh.n > 0))){
+    log.wanted = 1;
+    wakeup(&log.lh);
+  }
+  // begin_op() may be waiting for log space.
+  wakeup(&log);
+  if(COMMITTICKS == 0 && log.lh.n > 0){
+    while(log.done < seq)
+      sleep(&log.done, &log.lock);
   }
   release(&log.lock);
+}
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
+// The log daemon: commit the open transaction once it has been
+// open COMMITTICKS, or begin_op() has run out of log space, and
+// no FS system call is running.
+static void
+logd(void)
+{
+  acquire(&log.lock);
+  for(;;){
+    if(log.lh.n > 0 && ticks - log.opened >= COMMITTICKS)
+      log.wanted = 1;
+    if(log.wanted && log.outstanding == 0){
+      if(log.lh.n > 0)
+        commit();
+      else {
+        log.wanted = 0;
+        wakeup(&log);
+      }
+    } else if(log.lh.n > 0 && !log.wanted){
+      // Check again at the next tick.
+      release(&log.lock);
+      acquire(&tickslock);
+      sleep(&ticks, &tickslock);
+      release(&tickslock);
+      acquire(&log.lock);
+    } else {
+      sleep(&log.lh, &log.lock);
+    }
   }
 }
 
-// Copy modified blocks from cache to log.
+// Write the snapshot to the log.
 static void
 write_log(void)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from);
-    brelse(to);
+  for (tail = 0; tail < log.clh.n; tail++)
+    logrw(log.start+tail+1, logdata[tail], 1);  // write the log
+}
+
+// Installed blocks no longer need to stay in the cache, unless
+// the open transaction has logged them again.  Holding the buf
+// keeps log_write() from logging it while we look.
+static void
+unpin(void)
+{
+  int tail, i;
+  struct buf *b;
+
+  for (tail = 0; tail < log.clh.n; tail++) {
+    b = bread(log.dev, log.clh.block[tail]);
+    acquire(&log.lock);
+    for (i = 0; i < log.lh.n; i++)
+      if (log.lh.block[i] == b->blockno)
+        break;
+    if (i == log.lh.n)
+      b->flags &= ~B_DIRTY;
+    release(&log.lock);
+    brelse(b);
   }
 }
 
+// Called by logd holding log.lock, with no FS system call
+// running; returns holding it again.
 static void
-commit()
+commit(void)
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+  int tail;
+  uint seq;
+  struct buf *b;
+
+  // Close the open transaction and copy its blocks, which are
+  // pinned in the cache, while begin_op() waits.
+  log.committing = 1;
+  log.wanted = 0;
+  log.clh = log.lh;
+  log.lh.n = 0;
+  seq = log.seq++;
+  statinc(ST_COMMIT);
+  release(&log.lock);
+  for (tail = 0; tail < log.clh.n; tail++) {
+    b = bread(log.dev, log.clh.block[tail]);
+    memmove(logdata[tail], b->data, BSIZE);
+    brelse(b);
   }
+  acquire(&log.lock);
+  log.committing = 0;
+  wakeup(&log);
+  release(&log.lock);
+
+  write_log();     // Write modified blocks from snapshot to log
+  write_head();    // Write header to disk -- the real commit
+  install_trans(); // Now install writes to home locations
+  unpin();
+  log.clh.n = 0;
+  write_head();    // Erase the transaction from the log
+
+  acquire(&log.lock);
+  log.done = seq;
+  wakeup(&log.done);
 }
 
 // Caller has modified b->data and is done with the buffer.
@@ -224,8 +336,13 @@ log_write(struct buf *b)
       break;
   }
   log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
+  if (i == log.lh.n){
+    if (log.lh.n++ == 0){
+      // Start the commit interval.
+      log.opened = ticks;
+      wakeup(&log.lh);
+    }
+  }
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 
@@ -30,6 +31,9 @@ main(void)
   pinit();         // process table
   tvinit();        // trap vectors
   binit();         // buffer cache
+  pcinit();        // page cache
+  traceinit();     // system call trace buffers
+  statsinit();     // event counters device
   fileinit();      // file table
   ideinit();       // disk
   if(!ismp)
@@ -1,14 +1,39 @@
 #define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define KMAGSIZE     64  // free pages kalloc() caches per CPU
+#define KZEROPAGES   64  // free pages idle CPUs keep zeroed for kzalloc()
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define NEXECSEG      4  // max loadable segments in an executable
+#define EXECDEMAND    1  // exec reads program pages in on first touch
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define COMMITTICKS     5  // ticks a transaction stays open; 0: commit at end_op
+#define NBUF         2048  // maximum size of disk block cache
+#define BCACHEMIN      64  // buffers the block cache always keeps (> LOGSIZE)
+#define BCACHEMINFREE 1024  // free pages below which the block cache stops growing
+#define RAWINDOW     16  // default blocks of sequential read-ahead
+#define NPCACHE     512  // executable pages the page cache can hold
 #define FSSIZE       1000  // size of file system in blocks
+#define NSWAPPAGE    1024  // pages of swap space mkfs puts after the file system
+#define DISKSIZE     (FSSIZE + NSWAPPAGE*8)  // blocks on disk 1 (8 per page)
+#define SWAPBATCH      32  // most pages kswapd evicts in one pass
+#define IDEMAXRUN      32  // most consecutive blocks in one disk command
+#define IDEDMA          1  // use bus-master DMA if the IDE controller can
+#define IDEREADEXPIRE  50  // IOSCHED=DEADLINE: ticks a read may wait
+#define IDEWRITEEXPIRE 500  // IOSCHED=DEADLINE: ticks a write may wait
+#define WORKSTEAL       1  // idle CPUs steal RUNNABLE work from busy peers
+#define MIGRATETICKS    2  // ticks a process stays cache-hot after running
+#define NICEMIN         1  // most favoured nice level
+#define NICEMAX         5  // least favoured nice level
+#define NICEDEFAULT     3  // nice level of init and new processes
+#define NMLFQ           3  // MLFQ scheduler (make SCHED=MLFQ): levels
+#define MLFQQUANTA  1, 4, 16  // MLFQ time slice of each level in ticks
+#define MLFQBOOST     100  // MLFQ ticks between priority boosts
+#define TRACERING     256  // system call trace events each CPU buffers
 
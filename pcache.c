@@ -0,0 +1,146 @@
+// Page cache.
+//
+// Holds whole pages of executable files, keyed by device, inode
+// number and file offset, so that processes running the same
+// program share its pages instead of each reading a private
+// copy.  pagein() maps cached pages copy-on-write.  The cache
+// owns one reference (see kdup()) on each page it holds; a page
+// stays in use by the processes mapping it after the cache lets
+// it go.
+//
+// Pages are forgotten when their file changes (writei() and
+// itrunc() call pcinval()), when the in-memory inode is
+// recycled, when the cache needs room for a new page, and when
+// kalloc() runs out of memory (pcshrink()).  Only pages no
+// process maps are ever replaced.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+
+struct pcentry {
+  uint dev;
+  uint inum;
+  uint off;
+  char *page;   // 0 if the entry is unused
+};
+
+struct {
+  struct spinlock lock;
+  struct pcentry e[NPCACHE];
+  int hand;     // next entry to consider for replacement
+} pcache;
+
+void
+pcinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+// Return the cached page holding offset off of inode (dev, inum)
+// with a reference for the caller, or 0 if it is not cached.
+char*
+pcget(uint dev, uint inum, uint off)
+{
+  struct pcentry *e;
+  char *page;
+
+  page = 0;
+  acquire(&pcache.lock);
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+    if(e->page && e->dev == dev && e->inum == inum && e->off == off){
+      page = e->page;
+      kdup(page);
+      break;
+    }
+  }
+  release(&pcache.lock);
+  return page;
+}
+
+// Offer page, which holds the PGSIZE bytes at offset off of
+// inode (dev, inum), to the cache.  Returns 1 if the cache took
+// a reference to it, 0 if there was no room or it is cached
+// already.  Caller must hold the inode's lock, so the file
+// cannot change before the page is in the cache.
+int
+pcput(uint dev, uint inum, uint off, char *page)
+{
+  struct pcentry *e, *free;
+  char *old;
+  int i;
+
+  old = 0;
+  free = 0;
+  acquire(&pcache.lock);
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+    if(e->page == 0){
+      if(free == 0)
+        free = e;
+    } else if(e->dev == dev && e->inum == inum && e->off == off){
+      release(&pcache.lock);
+      return 0;
+    }
+  }
+  // Full: replace the next page no process maps, clock order.
+  for(i = 0; free == 0 && i < NPCACHE; i++){
+    e = &pcache.e[pcache.hand];
+    pcache.hand = (pcache.hand + 1) % NPCACHE;
+    if(krefcnt(e->page) == 1){
+      old = e->page;
+      free = e;
+    }
+  }
+  if(free){
+    kdup(page);
+    free->dev = dev;
+    free->inum = inum;
+    free->off = off;
+    free->page = page;
+  }
+  release(&pcache.lock);
+  if(old)
+    kfree(old);
+  return free != 0;
+}
+
+// Forget the cached pages of inode (dev, inum).
+void
+pcinval(uint dev, uint inum)
+{
+  struct pcentry *e;
+
+  acquire(&pcache.lock);
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+    if(e->page && e->dev == dev && e->inum == inum){
+      kfree(e->page);
+      e->page = 0;
+    }
+  }
+  release(&pcache.lock);
+}
+
+// Free up to n cached pages that no process maps.
+// Called by kalloc() when it runs out of memory.
+// Returns pages freed.
+int
+pcshrink(int n)
+{
+  struct pcentry *e;
+  int nfreed;
+
+  nfreed = 0;
+  acquire(&pcache.lock);
+  for(e = pcache.e; e < &pcache.e[NPCACHE] && nfreed < n; e++){
+    if(e->page && krefcnt(e->page) == 1){
+      kfree(e->page);
+      e->page = 0;
+      nfreed++;
+    }
+  }
+  release(&pcache.lock);
+  return nfreed;
+}
@@ -0,0 +1,63 @@
+// PCI configuration space, through configuration mechanism #1
+// (I/O ports 0xCF8 and 0xCFC).  Just enough to find a device by
+// class and read or set up its registers.
+// http://wiki.osdev.org/PCI
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PCI_CONFADDR  0xCF8
+#define PCI_CONFDATA  0xCFC
+
+#define PCI_ID        0x00  // device ID << 16 | vendor ID
+#define PCI_CLASS     0x08  // class << 24 | subclass << 16 | ...
+#define PCI_HEADER    0x0C  // header type in bits 16-23
+
+// A device function is named by a tag: bus<<16 | dev<<11 | func<<8.
+static uint
+pcitag(int bus, int dev, int func)
+{
+  return (bus << 16) | (dev << 11) | (func << 8);
+}
+
+// Read the 32-bit configuration register at offset off.
+uint
+pciread(uint tag, int off)
+{
+  outl(PCI_CONFADDR, 0x80000000 | tag | (off & 0xfc));
+  return inl(PCI_CONFDATA);
+}
+
+void
+pciwrite(uint tag, int off, uint v)
+{
+  outl(PCI_CONFADDR, 0x80000000 | tag | (off & 0xfc));
+  outl(PCI_CONFDATA, v);
+}
+
+// Find the first function of the given class and subclass on
+// bus 0 and store its tag in *tagp.  Returns 0 if there is none.
+int
+pcifind(int class, int subclass, uint *tagp)
+{
+  int dev, func, nfunc;
+  uint tag, c;
+
+  for(dev = 0; dev < 32; dev++){
+    nfunc = 1;
+    for(func = 0; func < nfunc; func++){
+      tag = pcitag(0, dev, func);
+      if((pciread(tag, PCI_ID) & 0xffff) == 0xffff)
+        continue;   // no such device
+      if(func == 0 && (pciread(tag, PCI_HEADER) & 0x800000))
+        nfunc = 8;  // multi-function device
+      c = pciread(tag, PCI_CLASS);
+      if((c >> 24) == class && ((c >> 16) & 0xff) == subclass){
+        *tagp = tag;
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
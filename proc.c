@@ -4,28 +4,388 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "trace.h"
 
+// ptable.lock protects nextpid and the parent links between
+// processes.  Each process's own p->lock protects its state,
+// chan and killed fields, so the scheduler and sleep/wakeup
+// never need the table-wide lock.
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
 
+// Per-CPU run queues.  Every RUNNABLE process sits on exactly
+// one of them, chosen by p->rqcpu; rq->lock protects the queue.
+// Lock order: ptable.lock, then p->lock, then rq->lock.
+#ifdef MLFQ
+// Multi-level feedback queue: one FIFO list per level, level 0
+// first.  A process that uses up the time slice of its level
+// drops a level, so CPU hogs sink to long quanta while processes
+// that sleep early stay on top.  Every MLFQBOOST ticks mlfqepoch
+// advances and everybody goes back to level 0 (lazily: queues
+// and processes notice the new epoch the next time they are used).
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NMLFQ];
+  struct proc *tail[NMLFQ];
+  volatile int n;              // number of queued processes
+  uint epoch;                  // mlfqepoch of the last boost seen
+};
+
+static int mlfqquantum[NMLFQ] = { MLFQQUANTA };
+static uint mlfqepoch;
+#else
+// Processes are picked by stride scheduling: each one has a
+// pass value that advances by its stride (inversely proportional
+// to the weight of its nice level) every time it is dispatched,
+// and the queue is a binary min-heap on pass, so picking the
+// next process costs O(log n).
+struct runq {
+  struct spinlock lock;
+  struct proc *heap[NPROC];    // min-heap ordered by p->pass
+  volatile int n;              // number of queued processes
+  uint vtime;                  // pass of the last process dispatched
+};
+
+// Scheduling weight of each nice level; 1 is the most favoured.
+static int niceweight[] = {
+[1]  16,
+[2]  8,
+[3]  4,
+[4]  2,
+[5]  1,
+};
+
+#define STRIDE1     (1<<12)
+#define STRIDE(p)   (STRIDE1 / niceweight[(p)->nice])
+
+// Pass values wrap around, so compare them by difference.
+#define PASSLESS(a, b)  ((int)((a)->pass - (b)->pass) < 0)
+#endif
+
+static struct runq runq[NCPU];
+
 static struct proc *initproc;
 
 int nextpid = 1;
-int trace_flag = 0;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
-
 void
 pinit(void)
 {
+  struct proc *p;
+  struct runq *rq;
+
   initlock(&ptable.lock, "ptable");
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    initlock(&p->lock, "proc");
+  for(rq = runq; rq < &runq[NCPU]; rq++)
+    initlock(&rq->lock, "runq");
+}
+
+#ifdef MLFQ
+// Forget p's level if a boost happened since it was last set.
+static void
+mlfqsync(struct proc *p)
+{
+  if(p->epoch != mlfqepoch){
+    p->epoch = mlfqepoch;
+    p->level = 0;
+    p->ticksused = 0;
+  }
+}
+
+// Apply a pending boost to rq by moving every queued process
+// to level 0.  Caller holds rq->lock.
+static void
+rqboost(struct runq *rq)
+{
+  int l;
+
+  if(rq->epoch == mlfqepoch)
+    return;
+  rq->epoch = mlfqepoch;
+  for(l = 1; l < NMLFQ; l++){
+    if(rq->head[l] == 0)
+      continue;
+    if(rq->tail[0])
+      rq->tail[0]->rqnext = rq->head[l];
+    else
+      rq->head[0] = rq->head[l];
+    rq->tail[0] = rq->tail[l];
+    rq->head[l] = rq->tail[l] = 0;
+  }
+}
+
+// Append p to the list of its level.
+static void
+rqpush(struct runq *rq, struct proc *p)
+{
+  int l;
+
+  mlfqsync(p);
+  l = p->level;
+  acquire(&rq->lock);
+  rqboost(rq);
+  p->rqnext = 0;
+  if(rq->tail[l])
+    rq->tail[l]->rqnext = p;
+  else
+    rq->head[l] = p;
+  rq->tail[l] = p;
+  rq->n++;
+  release(&rq->lock);
+}
+
+// Unlink p, which follows prev on list l.  Caller holds rq->lock.
+static struct proc*
+rqremove(struct runq *rq, int l, struct proc *prev, struct proc *p)
+{
+  if(prev)
+    prev->rqnext = p->rqnext;
+  else
+    rq->head[l] = p->rqnext;
+  if(rq->tail[l] == p)
+    rq->tail[l] = prev;
+  p->rqnext = 0;
+  rq->n--;
+  return p;
+}
+
+// Remove and return the first process of the highest
+// non-empty level, or 0.
+static struct proc*
+rqpop(struct runq *rq)
+{
+  struct proc *p;
+  int l;
+
+  p = 0;
+  acquire(&rq->lock);
+  rqboost(rq);
+  for(l = 0; l < NMLFQ; l++){
+    if(rq->head[l]){
+      p = rqremove(rq, l, 0, rq->head[l]);
+      break;
+    }
+  }
+  release(&rq->lock);
+  return p;
+}
+
+// Remove and return a process from busy peer queue rq for an
+// idle CPU to run.  Prefer a process that has been off its CPU
+// for at least MIGRATETICKS; failing that, if the queue is long,
+// take the one at the head of the lowest non-empty level.
+static struct proc*
+rqsteal(struct runq *rq)
+{
+  struct proc *p, *prev;
+  int l;
+
+  acquire(&rq->lock);
+  rqboost(rq);
+  for(l = 0; l < NMLFQ; l++){
+    for(prev = 0, p = rq->head[l]; p; prev = p, p = p->rqnext){
+      if(ticks - p->lastrun >= MIGRATETICKS){
+        rqremove(rq, l, prev, p);
+        release(&rq->lock);
+        return p;
+      }
+    }
+  }
+  p = 0;
+  if(rq->n > 2){
+    for(l = NMLFQ-1; l >= 0; l--){
+      if(rq->head[l]){
+        p = rqremove(rq, l, 0, rq->head[l]);
+        break;
+      }
+    }
+  }
+  release(&rq->lock);
+  return p;
+}
+
+#else
+static void
+rqswap(struct runq *rq, int i, int j)
+{
+  struct proc *p;
+
+  p = rq->heap[i];
+  rq->heap[i] = rq->heap[j];
+  rq->heap[j] = p;
+  rq->heap[i]->rqidx = i;
+  rq->heap[j]->rqidx = j;
+}
+
+// Restore the heap property around slot i.
+static void
+rqfix(struct runq *rq, int i)
+{
+  int c;
+
+  while(i > 0 && PASSLESS(rq->heap[i], rq->heap[(i-1)/2])){
+    rqswap(rq, i, (i-1)/2);
+    i = (i-1)/2;
+  }
+  for(;;){
+    c = 2*i + 1;
+    if(c >= rq->n)
+      break;
+    if(c+1 < rq->n && PASSLESS(rq->heap[c+1], rq->heap[c]))
+      c++;
+    if(!PASSLESS(rq->heap[c], rq->heap[i]))
+      break;
+    rqswap(rq, i, c);
+    i = c;
+  }
+}
+
+// Remove the process in heap slot i.  Caller holds rq->lock.
+static struct proc*
+rqremove(struct runq *rq, int i)
+{
+  struct proc *p;
+
+  p = rq->heap[i];
+  rq->n--;
+  if(i != rq->n){
+    rq->heap[i] = rq->heap[rq->n];
+    rq->heap[i]->rqidx = i;
+    rqfix(rq, i);
+  }
+  return p;
+}
+
+// Insert p into rq.  A process that has been sleeping must not
+// come back with a pass far behind everybody else's and then
+// monopolize the CPU, so its pass is pulled up to the queue's
+// virtual time; it still goes straight to the front, which is
+// what keeps interactive processes responsive.
+static void
+rqpush(struct runq *rq, struct proc *p)
+{
+  acquire(&rq->lock);
+  if((int)(p->pass - rq->vtime) < 0)
+    p->pass = rq->vtime;
+  p->rqidx = rq->n;
+  rq->heap[rq->n++] = p;
+  rqfix(rq, p->rqidx);
+  release(&rq->lock);
+}
+
+// Remove and return the process with the smallest pass, or 0.
+static struct proc*
+rqpop(struct runq *rq)
+{
+  struct proc *p;
+
+  p = 0;
+  acquire(&rq->lock);
+  if(rq->n > 0){
+    p = rqremove(rq, 0);
+    rq->vtime = p->pass;
+  }
+  release(&rq->lock);
+  return p;
+}
+
+// Remove and return a process from busy peer queue rq for an
+// idle CPU to run.  Prefer a process that has been off its CPU
+// for at least MIGRATETICKS, since its cache footprint is likely
+// gone anyway.  Only if the queue is long enough that the peer
+// cannot get to everything soon take the one it would run last,
+// the one with the largest pass, which is one of the heap's
+// leaves (slots n/2 .. n-1).
+static struct proc*
+rqsteal(struct runq *rq)
+{
+  struct proc *p;
+  int i, j;
+
+  p = 0;
+  acquire(&rq->lock);
+  for(i = 0; i < rq->n; i++){
+    if(ticks - rq->heap[i]->lastrun >= MIGRATETICKS)
+      break;
+  }
+  if(i == rq->n && rq->n > 2){
+    i = rq->n / 2;
+    for(j = i + 1; j < rq->n; j++)
+      if(PASSLESS(rq->heap[i], rq->heap[j]))
+        i = j;
+  }
+  if(i < rq->n)
+    p = rqremove(rq, i);
+  release(&rq->lock);
+  return p;
+}
+#endif
+
+// Find the CPU with the longest run queue and try to steal
+// a process from it.  A peer with only one queued process is
+// left alone: moving it would just leave that CPU idle instead
+// and lose the process's cache state for nothing.
+static struct proc*
+steal(void)
+{
+  int i, busiest;
+
+  busiest = -1;
+  for(i = 0; i < ncpu; i++){
+    if(&cpus[i] == cpu || runq[i].n < 2)
+      continue;
+    if(busiest < 0 || runq[i].n > runq[busiest].n)
+      busiest = i;
+  }
+  if(busiest < 0)
+    return 0;
+  return rqsteal(&runq[busiest]);
+}
+
+// Return the index of the CPU with the shortest run queue,
+// preferring the current one.  The counts are read without
+// locks: a stale answer only costs balance, not correctness.
+static int
+leastloaded(void)
+{
+  int i, best;
+
+  best = cpu - cpus;
+  for(i = 0; i < ncpu; i++)
+    if(runq[i].n < runq[best].n)
+      best = i;
+  return best;
+}
+
+// Mark p RUNNABLE and queue it on the run queue of the CPU
+// it last ran on.  A process giving up the CPU in yield() has
+// used up its time slice: under MLFQ it drops a level, under
+// stride scheduling it is charged one stride (sleepers are
+// rebased in rqpush() instead).  Caller must hold p->lock.
+static void
+setrunnable(struct proc *p)
+{
+  if(!holding(&p->lock))
+    panic("setrunnable");
+  if(p->state == RUNNING){
+#ifdef MLFQ
+    mlfqsync(p);
+    if(p->level < NMLFQ-1)
+      p->level++;
+    p->ticksused = 0;
+#else
+    p->pass += STRIDE(p);
+#endif
+  }
+  p->state = RUNNABLE;
+  rqpush(&runq[p->rqcpu], p);
 }
 
 //PAGEBREAK: 32
@@ -39,27 +399,28 @@ allocproc(void)
   struct proc *p;
   char *sp;
 
-  acquire(&ptable.lock);
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    acquire(&p->lock);
     if(p->state == UNUSED)
       goto found;
-
-  release(&ptable.lock);
+    release(&p->lock);
+  }
   return 0;
 
 found:
   p->state = EMBRYO;
-  p->pid = nextpid++;
-  if(trace_flag == TRACE_ON){
-    p->tracer = TRACE_ON;
-  }
-  else{
-    p->tracer = TRACE_OFF;
-  }
+  p->nice = NICEDEFAULT;
+  p->pass = 0;
+  release(&p->lock);
 
+  acquire(&ptable.lock);
+  p->pid = nextpid++;
   release(&ptable.lock);
 
+  p->tracemask = 0;
+  p->tracewhen = TRACE_ANY;
+  p->callstat = 0;
+
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
     p->state = UNUSED;
@@ -80,6 +441,11 @@ found:
   p->context = (struct context*)sp;
   memset(p->context, 0, sizeof *p->context);
   p->context->eip = (uint)forkret;
+  p->kfn = 0;
+  p->exe = 0;
+  p->nseg = 0;
+  p->swappable = 0;
+  p->tlbcpu = -1;
 
   return p;
 }
@@ -111,19 +477,53 @@ userinit(void)
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
 
-  // this assignment to p->state lets other cores
-  // run this process. the acquire forces the above
-  // writes to be visible, and the lock is also needed
-  // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  // queueing p lets other cores run this process.
+  // the acquire forces the above writes to be visible,
+  // and the lock is also needed because the assignment
+  // to p->state might not be atomic.
+  acquire(&p->lock);
+  p->rqcpu = leastloaded();
+  setrunnable(p);
+  release(&p->lock);
+}
 
-  p->state = RUNNABLE;
+// A new kernel thread's first scheduling by scheduler()
+// will swtch here, instead of to forkret.
+static void
+kthreadret(void)
+{
+  // Still holding proc->lock from scheduler.
+  release(&proc->lock);
+  proc->kfn();
+  panic("kthread returned");
+}
 
-  release(&ptable.lock);
+// Start a kernel thread running fn, which must not return.
+// It has no user memory, so it never leaves the kernel.
+void
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+    panic("kthread");
+  p->sz = 0;
+  p->parent = 0;
+  p->cwd = 0;
+  p->kfn = fn;
+  p->context->eip = (uint)kthreadret;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&p->lock);
+  p->rqcpu = leastloaded();
+  setrunnable(p);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
+// Growing only reserves the addresses: pgfault() maps a zeroed
+// page when the process first touches one.
 int
 growproc(int n)
 {
@@ -131,8 +531,9 @@ growproc(int n)
 
   sz = proc->sz;
   if(n > 0){
-    if((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
+    if(sz + n < sz || sz + n > KERNBASE)
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
       return -1;
@@ -174,16 +575,25 @@ fork(void)
     if(proc->ofile[i])
       np->ofile[i] = filedup(proc->ofile[i]);
   np->cwd = idup(proc->cwd);
+  if(proc->exe){
+    np->exe = idup(proc->exe);
+    idenywrite(np->exe);
+  }
+  memmove(np->seg, proc->seg, sizeof(proc->seg));
+  np->nseg = proc->nseg;
+  np->nice = proc->nice;
+  np->pass = proc->pass;
+  np->tracemask = proc->tracemask;
+  np->tracewhen = proc->tracewhen;
 
   safestrcpy(np->name, proc->name, sizeof(proc->name));
 
   pid = np->pid;
 
-  acquire(&ptable.lock);
-
-  np->state = RUNNABLE;
-
-  release(&ptable.lock);
+  acquire(&np->lock);
+  np->rqcpu = leastloaded();
+  setrunnable(np);
+  release(&np->lock);
 
   return pid;
 }
@@ -208,27 +618,37 @@ exit(void)
     }
   }
 
+  if(proc->exe)
+    iallowwrite(proc->exe);
   begin_op();
   iput(proc->cwd);
+  if(proc->exe)
+    iput(proc->exe);
   end_op();
   proc->cwd = 0;
+  proc->exe = 0;
 
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(proc->parent);
+  wakeup(proc->parent);
 
   // Pass abandoned children to init.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == proc){
       p->parent = initproc;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup(initproc);
     }
   }
 
-  // Jump into the scheduler, never to return.
+  // Become a zombie while still holding ptable.lock, so the
+  // parent's wait() cannot look at us half way.
+  acquire(&proc->lock);
   proc->state = ZOMBIE;
+  release(&ptable.lock);
+
+  // Jump into the scheduler, never to return.
   sched();
   panic("zombie exit");
 }
@@ -249,9 +669,11 @@ wait(void)
       if(p->parent != proc)
         continue;
       havekids = 1;
+      acquire(&p->lock);
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
+        tracereap(p);
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
@@ -260,9 +682,11 @@ wait(void)
         p->name[0] = 0;
         p->killed = 0;
         p->state = UNUSED;
+        release(&p->lock);
         release(&ptable.lock);
         return pid;
       }
+      release(&p->lock);
     }
 
     // No point waiting if we don't have any children.
@@ -271,7 +695,10 @@ wait(void)
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in proc_exit.)
+    // Nothing touches user memory after this, so kswapd may
+    // take the pages of processes waiting here, like the shell.
+    proc->swappable = 1;
     sleep(proc, &ptable.lock);  //DOC: wait-sleep
   }
 }
@@ -280,7 +707,7 @@ wait(void)
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.  It loops, doing:
-//  - choose a process to run
+//  - take the next process off this CPU's run queue
 //  - swtch to start running that process
 //  - eventually that process transfers control
 //      via swtch back to the scheduler.
@@ -288,36 +715,56 @@ void
 scheduler(void)
 {
   struct proc *p;
+  struct runq *rq;
 
+  rq = &runq[cpu - cpus];
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-      swtch(&cpu->scheduler, p->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      proc = 0;
+    // Peek at the queue without locking, so an idle CPU
+    // spins on its own counter rather than on a shared lock.
+    // When there is nothing local, go looking for work.
+    p = 0;
+    if(rq->n > 0)
+      p = rqpop(rq);
+    else if(WORKSTEAL)
+      p = steal();
+    if(p == 0){
+      kzeroidle();  // nothing to run; get ahead on zeroing pages
+      continue;
     }
-    release(&ptable.lock);
-
+#ifndef MLFQ
+    if(p->rqcpu != cpu - cpus)
+      p->pass = rq->vtime;  // stolen: rebase onto this CPU's virtual time
+#endif
+
+    // Switch to chosen process.  It is the process's job
+    // to release p->lock and then reacquire it
+    // before jumping back to us.
+    acquire(&p->lock);
+    proc = p;
+    p->rqcpu = cpu - cpus;
+    p->swappable = 0;
+    // If p was the last process to run here, and its mappings have
+    // not changed elsewhere since, its page directory is still
+    // loaded and the TLB still good; see loadpgdir().
+    if(cpu->pgdir != p->pgdir || p->tlbcpu != cpu - cpus)
+      switchuvm(p);
+    p->tlbcpu = cpu - cpus;
+    p->state = RUNNING;
+    cpu->stat[ST_CSWITCH]++;
+    swtch(&cpu->scheduler, p->context);
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    proc = 0;
+    p->lastrun = ticks;
+    release(&p->lock);
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only proc->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -329,8 +776,8 @@ sched(void)
 {
   int intena;
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&proc->lock))
+    panic("sched proc->lock");
   if(cpu->ncli != 1)
     panic("sched locks");
   if(proc->state == RUNNING)
@@ -346,20 +793,44 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  proc->state = RUNNABLE;
+  acquire(&proc->lock);  //DOC: yieldlock
+  setrunnable(proc);
   sched();
-  release(&ptable.lock);
+  release(&proc->lock);
+}
+
+// Called on each timer interrupt that finds proc RUNNING.
+// Returns whether proc has used up its time slice and should
+// yield.  Without MLFQ every process gets one tick.
+int
+timeslice(void)
+{
+#ifdef MLFQ
+  mlfqsync(proc);
+  return ++proc->ticksused >= mlfqquantum[proc->level];
+#else
+  return 1;
+#endif
 }
 
+#ifdef MLFQ
+// Start a new epoch in which every process is back at level 0.
+// Called from the timer interrupt every MLFQBOOST ticks.
+void
+mlfqboost(void)
+{
+  mlfqepoch++;
+}
+#endif
+
 // A fork child's very first scheduling by scheduler()
 // will swtch here.  "Return" to user space.
 void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding proc->lock from scheduler.
+  release(&proc->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -368,6 +839,7 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    swapinit(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -384,16 +856,14 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
+  // Must acquire proc->lock in order to
   // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
+  // Once we hold proc->lock, we can be
   // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
+  // (wakeup locks each p->lock it looks at),
   // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+  acquire(&proc->lock);  //DOC: sleeplock1
+  release(lk);
 
   // Go to sleep.
   proc->chan = chan;
@@ -404,32 +874,35 @@ sleep(void *chan, struct spinlock *lk)
   proc->chan = 0;
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  release(&proc->lock);  //DOC: sleeplock2
+  acquire(lk);
 }
 
-//PAGEBREAK!
-// Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
+// Slot i of the process table, for kswapd's sweep over the
+// processes.  Caller must lock it before looking inside.
+struct proc*
+procslot(int i)
 {
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  return &ptable.proc[i];
 }
 
-// Wake up all processes sleeping on chan.
+//PAGEBREAK!
+// Wake up all processes sleeping on chan and queue them
+// on the run queue of the CPU they last ran on.
+// Must be called without any p->lock held.
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct proc *p;
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p == proc)
+      continue;
+    acquire(&p->lock);
+    if(p->state == SLEEPING && p->chan == chan)
+      setrunnable(p);
+    release(&p->lock);
+  }
 }
 
 // Kill the process with the given pid.
@@ -440,13 +913,90 @@ kill(int pid)
 {
   struct proc *p;
 
-  acquire(&ptable.lock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    acquire(&p->lock);
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
       if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+        setrunnable(p);
+      release(&p->lock);
+      return 0;
+    }
+    release(&p->lock);
+  }
+  return -1;
+}
+
+// Set the nice level of the process with the given pid and
+// return its old level, or -1 if there is no such process.
+// The new weight applies from the process's next dispatch.
+int
+setnice(int pid, int nice)
+{
+  struct proc *p;
+  int old;
+
+  if(nice < NICEMIN || nice > NICEMAX)
+    panic("setnice");
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    acquire(&p->lock);
+    if(p->pid == pid && p->state != UNUSED){
+      old = p->nice;
+      p->nice = nice;
+      release(&p->lock);
+      return old;
+    }
+    release(&p->lock);
+  }
+  return -1;
+}
+
+// Set the trace filter of the process with the given pid, 0 for
+// the caller or -1 for the caller's parent (the shell running
+// strace).  Processes it creates from now on inherit the filter.
+// Returns 0, or -1 if there is no such process.
+int
+settrace(int pid, uint64 mask, int when)
+{
+  struct proc *p;
+
+  if(pid == 0)
+    pid = proc->pid;
+  else if(pid == -1){
+    acquire(&ptable.lock);
+    pid = proc->parent ? proc->parent->pid : 0;
+    release(&ptable.lock);
+  }
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    acquire(&p->lock);
+    if(p->pid == pid && p->state != UNUSED && p->state != ZOMBIE){
+      // p reads its filter without the lock; at worst one call
+      // sees half an update.
+      p->tracemask = mask;
+      p->tracewhen = when;
+      release(&p->lock);
+      return 0;
+    }
+    release(&p->lock);
+  }
+  return -1;
+}
+
+// Copy the system call statistics of process pid into st, which
+// has room for NCALLSTAT.  Returns -1 if there is no such process.
+int
+procstat(int pid, struct callstat *st)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      if(p->callstat)
+        memmove(st, p->callstat, NCALLSTAT*sizeof(*st));
+      else
+        memset(st, 0, NCALLSTAT*sizeof(*st));
       release(&ptable.lock);
       return 0;
     }
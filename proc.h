@@ -1,4 +1,16 @@
 // Per-CPU state
+// Events each CPU counts in its struct cpu.
+enum cpustat {
+  ST_CSWITCH,  // switches from the scheduler to a process
+  ST_PGFAULT,  // page faults
+  ST_BHIT,     // bread()s that found the block cached
+  ST_BMISS,    //   and that had to read it from disk
+  ST_COMMIT,   // log commits
+  ST_IDERW,    // buffers queued for the disk
+  ST_SPIN,     // turns round acquire()'s loop waiting for a lock
+  NSTAT
+};
+
 struct cpu {
   uchar apicid;                // Local APIC ID
   struct context *scheduler;   // swtch() here to enter scheduler
@@ -7,6 +19,9 @@ struct cpu {
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
+  pde_t *pgdir;                // Page directory in %cr3 (see loadpgdir())
+  // Event counters (see stats.c), in cache lines of their own.
+  uint stat[NSTAT] __attribute__((aligned(64)));
 
   // Cpu-local storage variables; see below
   struct cpu *cpu;
@@ -48,14 +63,26 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// A loadable segment of the program a process runs, kept so
+// that pgfault() can read its pages in when first touched.
+struct execseg {
+  uint va;      // page-aligned start address
+  uint off;     // offset in the executable
+  uint filesz;  // bytes from the executable; the rest are zero
+  uint memsz;
+};
+
 // Per-process state
 struct proc {
+  struct spinlock lock;        // Protects state, chan and killed
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
   int pid;                     // Process ID
-  int tracer;
+  uint64 tracemask;            // System calls traced, TRACEBIT(num) for num
+  int tracewhen;               // Results traced: TRACE_ANY, TRACE_OK or TRACE_FAIL
+  struct callstat *callstat;   // Latency statistics page, or 0; see trace.h
   struct proc *parent;         // Parent process
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
@@ -64,6 +91,23 @@ struct proc {
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
+  void (*kfn)(void);           // Body of a kernel thread, else 0
+  struct inode *exe;           // Executable, for demand paging
+  struct execseg seg[NEXECSEG];  // Its loadable segments
+  int nseg;
+  int swappable;                // Won't touch user memory before user space: kswapd may evict its pages
+  int tlbcpu;                   // CPU whose TLB holds p's mappings, or -1
+#ifdef MLFQ
+  struct proc *rqnext;         // Next RUNNABLE process on run queue level
+#endif
+  int rqcpu;                   // Run queue (CPU index) p belongs to
+  uint lastrun;                // ticks when p last left a CPU
+  int rqidx;                   // Slot in the run queue heap
+  int nice;                    // NICEMIN (favoured) .. NICEMAX
+  uint pass;                   // Stride scheduling virtual time
+  int level;                   // MLFQ level, 0 is the highest
+  int ticksused;               // MLFQ ticks used at this level
+  uint epoch;                  // MLFQ boost epoch level is valid for
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -72,7 +116,3 @@ struct proc {
 //   fixed-size stack
 //   expandable heap
 
-extern int trace_flag;
-extern int exclusive_flag;
-extern int success_flag;
-extern int fail_flag;
\ No newline at end of file
@@ -0,0 +1,1444 @@
+
+_readbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         kb*10000/1024/t % 10);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 10 00 00 00       	mov    $0x10,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 19                	mov    (%ecx),%ebx
+  1b:	8b 71 04             	mov    0x4(%ecx),%esi
+  int fd, i, old, window, rounds, t;
+
+  window = argc > 1 ? atoi(argv[1]) : 16;
+  rounds = argc > 2 ? atoi(argv[2]) : NROUNDS;
+  1e:	c7 45 e4 14 00 00 00 	movl   $0x14,-0x1c(%ebp)
+  window = argc > 1 ? atoi(argv[1]) : 16;
+  25:	83 fb 01             	cmp    $0x1,%ebx
+  28:	0f 8f 8a 00 00 00    	jg     b8 <main+0xb8>
+  if(window <= 0 || rounds <= 0){
+    printf(2, "usage: readbench [window] [rounds]\n");
+    exit();
+  }
+
+  fd = open(FILENAME, O_CREATE|O_RDWR);
+  2e:	56                   	push   %esi
+  2f:	56                   	push   %esi
+  30:	68 02 02 00 00       	push   $0x202
+  35:	68 a8 09 00 00       	push   $0x9a8
+  3a:	e8 04 05 00 00       	call   543 <open>
+  if(fd < 0){
+  3f:	83 c4 10             	add    $0x10,%esp
+  fd = open(FILENAME, O_CREATE|O_RDWR);
+  42:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+  44:	85 c0                	test   %eax,%eax
+  46:	78 59                	js     a1 <main+0xa1>
+    printf(1, "readbench: cannot create %s\n", FILENAME);
+    exit();
+  }
+  memset(buf, 'r', sizeof(buf));
+  48:	51                   	push   %ecx
+  49:	bb 8c 00 00 00       	mov    $0x8c,%ebx
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 72                	push   $0x72
+  55:	68 00 0e 00 00       	push   $0xe00
+  5a:	e8 21 03 00 00       	call   380 <memset>
+  5f:	83 c4 10             	add    $0x10,%esp
+  62:	eb 0d                	jmp    71 <main+0x71>
+  64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < MAXFILE; i++){
+  68:	83 eb 01             	sub    $0x1,%ebx
+  6b:	0f 84 8e 00 00 00    	je     ff <main+0xff>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+  71:	83 ec 04             	sub    $0x4,%esp
+  74:	68 00 02 00 00       	push   $0x200
+  79:	68 00 0e 00 00       	push   $0xe00
+  7e:	56                   	push   %esi
+  7f:	e8 9f 04 00 00       	call   523 <write>
+  84:	83 c4 10             	add    $0x10,%esp
+  87:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8c:	74 da                	je     68 <main+0x68>
+      printf(1, "readbench: write failed\n");
+  8e:	52                   	push   %edx
+  8f:	52                   	push   %edx
+  90:	68 fc 09 00 00       	push   $0x9fc
+  95:	6a 01                	push   $0x1
+  97:	e8 e4 05 00 00       	call   680 <printf>
+      exit();
+  9c:	e8 62 04 00 00       	call   503 <exit>
+    printf(1, "readbench: cannot create %s\n", FILENAME);
+  a1:	53                   	push   %ebx
+  a2:	68 a8 09 00 00       	push   $0x9a8
+  a7:	68 df 09 00 00       	push   $0x9df
+  ac:	6a 01                	push   $0x1
+  ae:	e8 cd 05 00 00       	call   680 <printf>
+    exit();
+  b3:	e8 4b 04 00 00       	call   503 <exit>
+  window = argc > 1 ? atoi(argv[1]) : 16;
+  b8:	83 ec 0c             	sub    $0xc,%esp
+  bb:	ff 76 04             	push   0x4(%esi)
+  be:	e8 cd 03 00 00       	call   490 <atoi>
+  rounds = argc > 2 ? atoi(argv[2]) : NROUNDS;
+  c3:	83 c4 10             	add    $0x10,%esp
+  window = argc > 1 ? atoi(argv[1]) : 16;
+  c6:	89 c7                	mov    %eax,%edi
+  rounds = argc > 2 ? atoi(argv[2]) : NROUNDS;
+  c8:	83 fb 02             	cmp    $0x2,%ebx
+  cb:	74 11                	je     de <main+0xde>
+  cd:	83 ec 0c             	sub    $0xc,%esp
+  d0:	ff 76 08             	push   0x8(%esi)
+  d3:	e8 b8 03 00 00       	call   490 <atoi>
+  d8:	83 c4 10             	add    $0x10,%esp
+  db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(window <= 0 || rounds <= 0){
+  de:	85 ff                	test   %edi,%edi
+  e0:	7e 0a                	jle    ec <main+0xec>
+  e2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  e6:	0f 8f 42 ff ff ff    	jg     2e <main+0x2e>
+    printf(2, "usage: readbench [window] [rounds]\n");
+  ec:	57                   	push   %edi
+  ed:	57                   	push   %edi
+  ee:	68 58 0a 00 00       	push   $0xa58
+  f3:	6a 02                	push   $0x2
+  f5:	e8 86 05 00 00       	call   680 <printf>
+    exit();
+  fa:	e8 04 04 00 00       	call   503 <exit>
+    }
+  }
+  close(fd);
+  ff:	83 ec 0c             	sub    $0xc,%esp
+ 102:	56                   	push   %esi
+ 103:	e8 23 04 00 00       	call   52b <close>
+
+  old = readahead(0);
+ 108:	31 c0                	xor    %eax,%eax
+ 10a:	89 04 24             	mov    %eax,(%esp)
+ 10d:	e8 a1 04 00 00       	call   5b3 <readahead>
+  t = readall(rounds);
+ 112:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  old = readahead(0);
+ 115:	89 c3                	mov    %eax,%ebx
+  t = readall(rounds);
+ 117:	89 34 24             	mov    %esi,(%esp)
+ 11a:	e8 51 00 00 00       	call   170 <readall>
+  report("off", 0, rounds, t);
+ 11f:	50                   	push   %eax
+ 120:	56                   	push   %esi
+ 121:	6a 00                	push   $0x0
+ 123:	68 15 0a 00 00       	push   $0xa15
+ 128:	e8 e3 00 00 00       	call   210 <report>
+  readahead(window);
+ 12d:	83 c4 14             	add    $0x14,%esp
+ 130:	57                   	push   %edi
+ 131:	e8 7d 04 00 00       	call   5b3 <readahead>
+  t = readall(rounds);
+ 136:	89 34 24             	mov    %esi,(%esp)
+ 139:	e8 32 00 00 00       	call   170 <readall>
+  report("on", window, rounds, t);
+ 13e:	50                   	push   %eax
+ 13f:	56                   	push   %esi
+ 140:	57                   	push   %edi
+ 141:	68 19 0a 00 00       	push   $0xa19
+ 146:	e8 c5 00 00 00       	call   210 <report>
+  readahead(old);
+ 14b:	83 c4 14             	add    $0x14,%esp
+ 14e:	53                   	push   %ebx
+ 14f:	e8 5f 04 00 00       	call   5b3 <readahead>
+
+  unlink(FILENAME);
+ 154:	c7 04 24 a8 09 00 00 	movl   $0x9a8,(%esp)
+ 15b:	e8 f3 03 00 00       	call   553 <unlink>
+  exit();
+ 160:	e8 9e 03 00 00       	call   503 <exit>
+ 165:	66 90                	xchg   %ax,%ax
+ 167:	66 90                	xchg   %ax,%ax
+ 169:	66 90                	xchg   %ax,%ax
+ 16b:	66 90                	xchg   %ax,%ax
+ 16d:	66 90                	xchg   %ax,%ax
+ 16f:	90                   	nop
+
+00000170 <readall>:
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	57                   	push   %edi
+ 174:	56                   	push   %esi
+ 175:	53                   	push   %ebx
+ 176:	83 ec 1c             	sub    $0x1c,%esp
+ 179:	8b 7d 08             	mov    0x8(%ebp),%edi
+  t0 = uptime();
+ 17c:	e8 1a 04 00 00       	call   59b <uptime>
+ 181:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < rounds; i++){
+ 184:	85 ff                	test   %edi,%edi
+ 186:	7e 55                	jle    1dd <readall+0x6d>
+ 188:	31 f6                	xor    %esi,%esi
+ 18a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    dropcache();
+ 190:	e8 26 04 00 00       	call   5bb <dropcache>
+    if((fd = open(FILENAME, O_RDONLY)) < 0){
+ 195:	83 ec 08             	sub    $0x8,%esp
+ 198:	6a 00                	push   $0x0
+ 19a:	68 a8 09 00 00       	push   $0x9a8
+ 19f:	e8 9f 03 00 00       	call   543 <open>
+ 1a4:	83 c4 10             	add    $0x10,%esp
+ 1a7:	89 c3                	mov    %eax,%ebx
+ 1a9:	85 c0                	test   %eax,%eax
+ 1ab:	78 42                	js     1ef <readall+0x7f>
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	68 00 02 00 00       	push   $0x200
+ 1b8:	68 00 0e 00 00       	push   $0xe00
+ 1bd:	53                   	push   %ebx
+ 1be:	e8 58 03 00 00       	call   51b <read>
+ 1c3:	83 c4 10             	add    $0x10,%esp
+ 1c6:	85 c0                	test   %eax,%eax
+ 1c8:	7f e6                	jg     1b0 <readall+0x40>
+    close(fd);
+ 1ca:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < rounds; i++){
+ 1cd:	83 c6 01             	add    $0x1,%esi
+    close(fd);
+ 1d0:	53                   	push   %ebx
+ 1d1:	e8 55 03 00 00       	call   52b <close>
+  for(i = 0; i < rounds; i++){
+ 1d6:	83 c4 10             	add    $0x10,%esp
+ 1d9:	39 f7                	cmp    %esi,%edi
+ 1db:	75 b3                	jne    190 <readall+0x20>
+  t1 = uptime();
+ 1dd:	e8 b9 03 00 00       	call   59b <uptime>
+  return t1 - t0;
+ 1e2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+}
+ 1e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1e8:	5b                   	pop    %ebx
+ 1e9:	5e                   	pop    %esi
+  return t1 - t0;
+ 1ea:	29 d0                	sub    %edx,%eax
+}
+ 1ec:	5f                   	pop    %edi
+ 1ed:	5d                   	pop    %ebp
+ 1ee:	c3                   	ret
+      printf(1, "readbench: cannot open %s\n", FILENAME);
+ 1ef:	83 ec 04             	sub    $0x4,%esp
+ 1f2:	68 a8 09 00 00       	push   $0x9a8
+ 1f7:	68 b6 09 00 00       	push   $0x9b6
+ 1fc:	6a 01                	push   $0x1
+ 1fe:	e8 7d 04 00 00       	call   680 <printf>
+      exit();
+ 203:	e8 fb 02 00 00       	call   503 <exit>
+ 208:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <report>:
+{
+ 210:	55                   	push   %ebp
+    t = 1;
+ 211:	b8 01 00 00 00       	mov    $0x1,%eax
+{
+ 216:	89 e5                	mov    %esp,%ebp
+ 218:	57                   	push   %edi
+  printf(1, "%d.%d%d MB/s\n", kb*100/1024/t, kb*1000/1024/t % 10,
+ 219:	bf 67 66 66 66       	mov    $0x66666667,%edi
+{
+ 21e:	56                   	push   %esi
+ 21f:	53                   	push   %ebx
+ 220:	83 ec 14             	sub    $0x14,%esp
+  kb = rounds * MAXFILE * BSIZE / 1024;
+ 223:	69 5d 10 00 18 01 00 	imul   $0x11800,0x10(%ebp),%ebx
+{
+ 22a:	8b 75 14             	mov    0x14(%ebp),%esi
+  kb = rounds * MAXFILE * BSIZE / 1024;
+ 22d:	c1 eb 0a             	shr    $0xa,%ebx
+    t = 1;
+ 230:	85 f6                	test   %esi,%esi
+ 232:	0f 44 f0             	cmove  %eax,%esi
+  printf(1, "readbench: read-ahead %s (%d blocks): %d KB in %d ticks, ",
+ 235:	56                   	push   %esi
+ 236:	53                   	push   %ebx
+ 237:	ff 75 0c             	push   0xc(%ebp)
+ 23a:	ff 75 08             	push   0x8(%ebp)
+ 23d:	68 1c 0a 00 00       	push   $0xa1c
+ 242:	6a 01                	push   $0x1
+ 244:	e8 37 04 00 00       	call   680 <printf>
+         kb*10000/1024/t % 10);
+ 249:	69 c3 10 27 00 00    	imul   $0x2710,%ebx,%eax
+  printf(1, "%d.%d%d MB/s\n", kb*100/1024/t, kb*1000/1024/t % 10,
+ 24f:	83 c4 14             	add    $0x14,%esp
+         kb*10000/1024/t % 10);
+ 252:	c1 f8 0a             	sar    $0xa,%eax
+ 255:	99                   	cltd
+ 256:	f7 fe                	idiv   %esi
+ 258:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d.%d%d MB/s\n", kb*100/1024/t, kb*1000/1024/t % 10,
+ 25a:	f7 ef                	imul   %edi
+ 25c:	89 c8                	mov    %ecx,%eax
+ 25e:	c1 f8 1f             	sar    $0x1f,%eax
+ 261:	c1 fa 02             	sar    $0x2,%edx
+ 264:	29 c2                	sub    %eax,%edx
+ 266:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 269:	01 c0                	add    %eax,%eax
+ 26b:	29 c1                	sub    %eax,%ecx
+ 26d:	69 c3 e8 03 00 00    	imul   $0x3e8,%ebx,%eax
+ 273:	51                   	push   %ecx
+ 274:	c1 f8 0a             	sar    $0xa,%eax
+ 277:	99                   	cltd
+ 278:	f7 fe                	idiv   %esi
+ 27a:	89 c1                	mov    %eax,%ecx
+ 27c:	f7 ef                	imul   %edi
+ 27e:	89 c8                	mov    %ecx,%eax
+ 280:	c1 f8 1f             	sar    $0x1f,%eax
+ 283:	c1 fa 02             	sar    $0x2,%edx
+ 286:	29 c2                	sub    %eax,%edx
+ 288:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 28b:	01 c0                	add    %eax,%eax
+ 28d:	29 c1                	sub    %eax,%ecx
+ 28f:	6b c3 64             	imul   $0x64,%ebx,%eax
+ 292:	51                   	push   %ecx
+ 293:	c1 f8 0a             	sar    $0xa,%eax
+ 296:	99                   	cltd
+ 297:	f7 fe                	idiv   %esi
+ 299:	50                   	push   %eax
+ 29a:	68 d1 09 00 00       	push   $0x9d1
+ 29f:	6a 01                	push   $0x1
+ 2a1:	e8 da 03 00 00       	call   680 <printf>
+}
+ 2a6:	83 c4 20             	add    $0x20,%esp
+ 2a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ac:	5b                   	pop    %ebx
+ 2ad:	5e                   	pop    %esi
+ 2ae:	5f                   	pop    %edi
+ 2af:	5d                   	pop    %ebp
+ 2b0:	c3                   	ret
+ 2b1:	66 90                	xchg   %ax,%ax
+ 2b3:	66 90                	xchg   %ax,%ax
+ 2b5:	66 90                	xchg   %ax,%ax
+ 2b7:	66 90                	xchg   %ax,%ax
+ 2b9:	66 90                	xchg   %ax,%ax
+ 2bb:	66 90                	xchg   %ax,%ax
+ 2bd:	66 90                	xchg   %ax,%ax
+ 2bf:	90                   	nop
+
+000002c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2c1:	31 c0                	xor    %eax,%eax
+{
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	53                   	push   %ebx
+ 2c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2d7:	83 c0 01             	add    $0x1,%eax
+ 2da:	84 d2                	test   %dl,%dl
+ 2dc:	75 f2                	jne    2d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e1:	89 c8                	mov    %ecx,%eax
+ 2e3:	c9                   	leave
+ 2e4:	c3                   	ret
+ 2e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2fa:	0f b6 02             	movzbl (%edx),%eax
+ 2fd:	84 c0                	test   %al,%al
+ 2ff:	75 17                	jne    318 <strcmp+0x28>
+ 301:	eb 3a                	jmp    33d <strcmp+0x4d>
+ 303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 307:	90                   	nop
+ 308:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 30c:	83 c2 01             	add    $0x1,%edx
+ 30f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 312:	84 c0                	test   %al,%al
+ 314:	74 1a                	je     330 <strcmp+0x40>
+    p++, q++;
+ 316:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 318:	0f b6 19             	movzbl (%ecx),%ebx
+ 31b:	38 c3                	cmp    %al,%bl
+ 31d:	74 e9                	je     308 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 31f:	29 d8                	sub    %ebx,%eax
+}
+ 321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 324:	c9                   	leave
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 330:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 334:	31 c0                	xor    %eax,%eax
+ 336:	29 d8                	sub    %ebx,%eax
+}
+ 338:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 33b:	c9                   	leave
+ 33c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 33d:	0f b6 19             	movzbl (%ecx),%ebx
+ 340:	31 c0                	xor    %eax,%eax
+ 342:	eb db                	jmp    31f <strcmp+0x2f>
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 356:	80 3a 00             	cmpb   $0x0,(%edx)
+ 359:	74 15                	je     370 <strlen+0x20>
+ 35b:	31 c0                	xor    %eax,%eax
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+ 360:	83 c0 01             	add    $0x1,%eax
+ 363:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 367:	89 c1                	mov    %eax,%ecx
+ 369:	75 f5                	jne    360 <strlen+0x10>
+    ;
+  return n;
+}
+ 36b:	89 c8                	mov    %ecx,%eax
+ 36d:	5d                   	pop    %ebp
+ 36e:	c3                   	ret
+ 36f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 370:	31 c9                	xor    %ecx,%ecx
+}
+ 372:	5d                   	pop    %ebp
+ 373:	89 c8                	mov    %ecx,%eax
+ 375:	c3                   	ret
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000380 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 387:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 38a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 38d:	89 d7                	mov    %edx,%edi
+ 38f:	fc                   	cld
+ 390:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 392:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 395:	89 d0                	mov    %edx,%eax
+ 397:	c9                   	leave
+ 398:	c3                   	ret
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3aa:	0f b6 10             	movzbl (%eax),%edx
+ 3ad:	84 d2                	test   %dl,%dl
+ 3af:	75 12                	jne    3c3 <strchr+0x23>
+ 3b1:	eb 1d                	jmp    3d0 <strchr+0x30>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+ 3b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3bc:	83 c0 01             	add    $0x1,%eax
+ 3bf:	84 d2                	test   %dl,%dl
+ 3c1:	74 0d                	je     3d0 <strchr+0x30>
+    if(*s == c)
+ 3c3:	38 d1                	cmp    %dl,%cl
+ 3c5:	75 f1                	jne    3b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3c7:	5d                   	pop    %ebp
+ 3c8:	c3                   	ret
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3d0:	31 c0                	xor    %eax,%eax
+}
+ 3d2:	5d                   	pop    %ebp
+ 3d3:	c3                   	ret
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3e9:	31 db                	xor    %ebx,%ebx
+{
+ 3eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ee:	eb 27                	jmp    417 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3f0:	83 ec 04             	sub    $0x4,%esp
+ 3f3:	6a 01                	push   $0x1
+ 3f5:	56                   	push   %esi
+ 3f6:	6a 00                	push   $0x0
+ 3f8:	e8 1e 01 00 00       	call   51b <read>
+    if(cc < 1)
+ 3fd:	83 c4 10             	add    $0x10,%esp
+ 400:	85 c0                	test   %eax,%eax
+ 402:	7e 1d                	jle    421 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 404:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 40f:	3c 0a                	cmp    $0xa,%al
+ 411:	74 10                	je     423 <gets+0x43>
+ 413:	3c 0d                	cmp    $0xd,%al
+ 415:	74 0c                	je     423 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 417:	89 df                	mov    %ebx,%edi
+ 419:	83 c3 01             	add    $0x1,%ebx
+ 41c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 41f:	7c cf                	jl     3f0 <gets+0x10>
+ 421:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 42a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42d:	5b                   	pop    %ebx
+ 42e:	5e                   	pop    %esi
+ 42f:	5f                   	pop    %edi
+ 430:	5d                   	pop    %ebp
+ 431:	c3                   	ret
+ 432:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	56                   	push   %esi
+ 444:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 445:	83 ec 08             	sub    $0x8,%esp
+ 448:	6a 00                	push   $0x0
+ 44a:	ff 75 08             	push   0x8(%ebp)
+ 44d:	e8 f1 00 00 00       	call   543 <open>
+  if(fd < 0)
+ 452:	83 c4 10             	add    $0x10,%esp
+ 455:	85 c0                	test   %eax,%eax
+ 457:	78 27                	js     480 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 459:	83 ec 08             	sub    $0x8,%esp
+ 45c:	ff 75 0c             	push   0xc(%ebp)
+ 45f:	89 c3                	mov    %eax,%ebx
+ 461:	50                   	push   %eax
+ 462:	e8 f4 00 00 00       	call   55b <fstat>
+  close(fd);
+ 467:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 46a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 46c:	e8 ba 00 00 00       	call   52b <close>
+  return r;
+ 471:	83 c4 10             	add    $0x10,%esp
+}
+ 474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 477:	89 f0                	mov    %esi,%eax
+ 479:	5b                   	pop    %ebx
+ 47a:	5e                   	pop    %esi
+ 47b:	5d                   	pop    %ebp
+ 47c:	c3                   	ret
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 480:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 485:	eb ed                	jmp    474 <stat+0x34>
+ 487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 497:	0f be 02             	movsbl (%edx),%eax
+ 49a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 49d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4a5:	77 1e                	ja     4c5 <atoi+0x35>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4b0:	83 c2 01             	add    $0x1,%edx
+ 4b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ba:	0f be 02             	movsbl (%edx),%eax
+ 4bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4c0:	80 fb 09             	cmp    $0x9,%bl
+ 4c3:	76 eb                	jbe    4b0 <atoi+0x20>
+  return n;
+}
+ 4c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4c8:	89 c8                	mov    %ecx,%eax
+ 4ca:	c9                   	leave
+ 4cb:	c3                   	ret
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4de:	85 c0                	test   %eax,%eax
+ 4e0:	7e 13                	jle    4f5 <memmove+0x25>
+ 4e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4e4:	89 d7                	mov    %edx,%edi
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4f1:	39 f8                	cmp    %edi,%eax
+ 4f3:	75 fb                	jne    4f0 <memmove+0x20>
+  return vdst;
+}
+ 4f5:	5e                   	pop    %esi
+ 4f6:	89 d0                	mov    %edx,%eax
+ 4f8:	5f                   	pop    %edi
+ 4f9:	5d                   	pop    %ebp
+ 4fa:	c3                   	ret
+
+000004fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <exit>:
+SYSCALL(exit)
+ 503:	b8 02 00 00 00       	mov    $0x2,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <wait>:
+SYSCALL(wait)
+ 50b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <pipe>:
+SYSCALL(pipe)
+ 513:	b8 04 00 00 00       	mov    $0x4,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <read>:
+SYSCALL(read)
+ 51b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <write>:
+SYSCALL(write)
+ 523:	b8 10 00 00 00       	mov    $0x10,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <close>:
+SYSCALL(close)
+ 52b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <kill>:
+SYSCALL(kill)
+ 533:	b8 06 00 00 00       	mov    $0x6,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <exec>:
+SYSCALL(exec)
+ 53b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <open>:
+SYSCALL(open)
+ 543:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <mknod>:
+SYSCALL(mknod)
+ 54b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <unlink>:
+SYSCALL(unlink)
+ 553:	b8 12 00 00 00       	mov    $0x12,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <fstat>:
+SYSCALL(fstat)
+ 55b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <link>:
+SYSCALL(link)
+ 563:	b8 13 00 00 00       	mov    $0x13,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <mkdir>:
+SYSCALL(mkdir)
+ 56b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <chdir>:
+SYSCALL(chdir)
+ 573:	b8 09 00 00 00       	mov    $0x9,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <dup>:
+SYSCALL(dup)
+ 57b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <getpid>:
+SYSCALL(getpid)
+ 583:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <sbrk>:
+SYSCALL(sbrk)
+ 58b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <sleep>:
+SYSCALL(sleep)
+ 593:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <uptime>:
+SYSCALL(uptime)
+ 59b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <trace>:
+SYSCALL(trace)
+ 5a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <assign_nice>:
+SYSCALL(assign_nice)
+ 5ab:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <readahead>:
+SYSCALL(readahead)
+ 5b3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <dropcache>:
+SYSCALL(dropcache)
+ 5bb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <tracedrain>:
+SYSCALL(tracedrain)
+ 5c3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <settrace>:
+SYSCALL(settrace)
+ 5cb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <tracestat>:
+ 5d3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+ 5db:	66 90                	xchg   %ax,%ax
+ 5dd:	66 90                	xchg   %ax,%ax
+ 5df:	90                   	nop
+
+000005e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	53                   	push   %ebx
+ 5e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5e8:	89 d1                	mov    %edx,%ecx
+{
+ 5ea:	83 ec 3c             	sub    $0x3c,%esp
+ 5ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5f0:	85 d2                	test   %edx,%edx
+ 5f2:	0f 89 80 00 00 00    	jns    678 <printint+0x98>
+ 5f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5fc:	74 7a                	je     678 <printint+0x98>
+    x = -xx;
+ 5fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 600:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 605:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 608:	31 f6                	xor    %esi,%esi
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 610:	89 c8                	mov    %ecx,%eax
+ 612:	31 d2                	xor    %edx,%edx
+ 614:	89 f7                	mov    %esi,%edi
+ 616:	f7 f3                	div    %ebx
+ 618:	8d 76 01             	lea    0x1(%esi),%esi
+ 61b:	0f b6 92 dc 0a 00 00 	movzbl 0xadc(%edx),%edx
+ 622:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 626:	89 ca                	mov    %ecx,%edx
+ 628:	89 c1                	mov    %eax,%ecx
+ 62a:	39 da                	cmp    %ebx,%edx
+ 62c:	73 e2                	jae    610 <printint+0x30>
+  if(neg)
+ 62e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 631:	85 c0                	test   %eax,%eax
+ 633:	74 07                	je     63c <printint+0x5c>
+    buf[i++] = '-';
+ 635:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 63a:	89 f7                	mov    %esi,%edi
+ 63c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 63f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 642:	01 df                	add    %ebx,%edi
+ 644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 648:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 64b:	83 ec 04             	sub    $0x4,%esp
+ 64e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 651:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 654:	6a 01                	push   $0x1
+ 656:	50                   	push   %eax
+ 657:	56                   	push   %esi
+ 658:	e8 c6 fe ff ff       	call   523 <write>
+  while(--i >= 0)
+ 65d:	89 f8                	mov    %edi,%eax
+ 65f:	83 c4 10             	add    $0x10,%esp
+ 662:	83 ef 01             	sub    $0x1,%edi
+ 665:	39 d8                	cmp    %ebx,%eax
+ 667:	75 df                	jne    648 <printint+0x68>
+}
+ 669:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 66c:	5b                   	pop    %ebx
+ 66d:	5e                   	pop    %esi
+ 66e:	5f                   	pop    %edi
+ 66f:	5d                   	pop    %ebp
+ 670:	c3                   	ret
+ 671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 678:	31 c0                	xor    %eax,%eax
+ 67a:	eb 89                	jmp    605 <printint+0x25>
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	53                   	push   %ebx
+ 686:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 689:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 68c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 68f:	0f b6 1e             	movzbl (%esi),%ebx
+ 692:	83 c6 01             	add    $0x1,%esi
+ 695:	84 db                	test   %bl,%bl
+ 697:	74 67                	je     700 <printf+0x80>
+ 699:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 69c:	31 d2                	xor    %edx,%edx
+ 69e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6a1:	eb 34                	jmp    6d7 <printf+0x57>
+ 6a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6a7:	90                   	nop
+ 6a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6b0:	83 f8 25             	cmp    $0x25,%eax
+ 6b3:	74 18                	je     6cd <printf+0x4d>
+  write(fd, &c, 1);
+ 6b5:	83 ec 04             	sub    $0x4,%esp
+ 6b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6be:	6a 01                	push   $0x1
+ 6c0:	50                   	push   %eax
+ 6c1:	57                   	push   %edi
+ 6c2:	e8 5c fe ff ff       	call   523 <write>
+ 6c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 6d0:	83 c6 01             	add    $0x1,%esi
+ 6d3:	84 db                	test   %bl,%bl
+ 6d5:	74 29                	je     700 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6da:	85 d2                	test   %edx,%edx
+ 6dc:	74 ca                	je     6a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6de:	83 fa 25             	cmp    $0x25,%edx
+ 6e1:	75 ea                	jne    6cd <printf+0x4d>
+      if(c == 'd'){
+ 6e3:	83 f8 25             	cmp    $0x25,%eax
+ 6e6:	0f 84 24 01 00 00    	je     810 <printf+0x190>
+ 6ec:	83 e8 63             	sub    $0x63,%eax
+ 6ef:	83 f8 15             	cmp    $0x15,%eax
+ 6f2:	77 1c                	ja     710 <printf+0x90>
+ 6f4:	ff 24 85 84 0a 00 00 	jmp    *0xa84(,%eax,4)
+ 6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 700:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 703:	5b                   	pop    %ebx
+ 704:	5e                   	pop    %esi
+ 705:	5f                   	pop    %edi
+ 706:	5d                   	pop    %ebp
+ 707:	c3                   	ret
+ 708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70f:	90                   	nop
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 716:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 71a:	6a 01                	push   $0x1
+ 71c:	52                   	push   %edx
+ 71d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 720:	57                   	push   %edi
+ 721:	e8 fd fd ff ff       	call   523 <write>
+ 726:	83 c4 0c             	add    $0xc,%esp
+ 729:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 72c:	6a 01                	push   $0x1
+ 72e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 731:	52                   	push   %edx
+ 732:	57                   	push   %edi
+ 733:	e8 eb fd ff ff       	call   523 <write>
+        putc(fd, c);
+ 738:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 73b:	31 d2                	xor    %edx,%edx
+ 73d:	eb 8e                	jmp    6cd <printf+0x4d>
+ 73f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 00                	push   $0x0
+ 74f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 751:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 754:	e8 87 fe ff ff       	call   5e0 <printint>
+        ap++;
+ 759:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 75c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 75f:	31 d2                	xor    %edx,%edx
+ 761:	e9 67 ff ff ff       	jmp    6cd <printf+0x4d>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 770:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 773:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 775:	83 c0 04             	add    $0x4,%eax
+ 778:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 77b:	85 db                	test   %ebx,%ebx
+ 77d:	0f 84 9d 00 00 00    	je     820 <printf+0x1a0>
+        while(*s != 0){
+ 783:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 786:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 788:	84 c0                	test   %al,%al
+ 78a:	0f 84 3d ff ff ff    	je     6cd <printf+0x4d>
+ 790:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 793:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 796:	89 de                	mov    %ebx,%esi
+ 798:	89 d3                	mov    %edx,%ebx
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7a9:	6a 01                	push   $0x1
+ 7ab:	53                   	push   %ebx
+ 7ac:	57                   	push   %edi
+ 7ad:	e8 71 fd ff ff       	call   523 <write>
+        while(*s != 0){
+ 7b2:	0f b6 06             	movzbl (%esi),%eax
+ 7b5:	83 c4 10             	add    $0x10,%esp
+ 7b8:	84 c0                	test   %al,%al
+ 7ba:	75 e4                	jne    7a0 <printf+0x120>
+      state = 0;
+ 7bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7bf:	31 d2                	xor    %edx,%edx
+ 7c1:	e9 07 ff ff ff       	jmp    6cd <printf+0x4d>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7db:	8b 13                	mov    (%ebx),%edx
+ 7dd:	6a 01                	push   $0x1
+ 7df:	e9 6b ff ff ff       	jmp    74f <printf+0xcf>
+ 7e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7eb:	83 ec 04             	sub    $0x4,%esp
+ 7ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	52                   	push   %edx
+ 7fc:	57                   	push   %edi
+ 7fd:	e8 21 fd ff ff       	call   523 <write>
+        ap++;
+ 802:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 805:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 808:	31 d2                	xor    %edx,%edx
+ 80a:	e9 be fe ff ff       	jmp    6cd <printf+0x4d>
+ 80f:	90                   	nop
+  write(fd, &c, 1);
+ 810:	83 ec 04             	sub    $0x4,%esp
+ 813:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 816:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 819:	6a 01                	push   $0x1
+ 81b:	e9 11 ff ff ff       	jmp    731 <printf+0xb1>
+ 820:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 825:	bb 7c 0a 00 00       	mov    $0xa7c,%ebx
+ 82a:	e9 61 ff ff ff       	jmp    790 <printf+0x110>
+ 82f:	90                   	nop
+
+00000830 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 830:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 831:	a1 00 10 00 00       	mov    0x1000,%eax
+{
+ 836:	89 e5                	mov    %esp,%ebp
+ 838:	57                   	push   %edi
+ 839:	56                   	push   %esi
+ 83a:	53                   	push   %ebx
+ 83b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 83e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 848:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 84a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 84c:	39 ca                	cmp    %ecx,%edx
+ 84e:	73 30                	jae    880 <free+0x50>
+ 850:	39 c1                	cmp    %eax,%ecx
+ 852:	72 04                	jb     858 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 854:	39 c2                	cmp    %eax,%edx
+ 856:	72 f0                	jb     848 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 858:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 85b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 85e:	39 f8                	cmp    %edi,%eax
+ 860:	74 2e                	je     890 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 862:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 865:	8b 42 04             	mov    0x4(%edx),%eax
+ 868:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 86b:	39 f1                	cmp    %esi,%ecx
+ 86d:	74 38                	je     8a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 86f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 871:	5b                   	pop    %ebx
+  freep = p;
+ 872:	89 15 00 10 00 00    	mov    %edx,0x1000
+}
+ 878:	5e                   	pop    %esi
+ 879:	5f                   	pop    %edi
+ 87a:	5d                   	pop    %ebp
+ 87b:	c3                   	ret
+ 87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 880:	39 c1                	cmp    %eax,%ecx
+ 882:	72 d0                	jb     854 <free+0x24>
+ 884:	eb c2                	jmp    848 <free+0x18>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 890:	03 70 04             	add    0x4(%eax),%esi
+ 893:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 896:	8b 02                	mov    (%edx),%eax
+ 898:	8b 00                	mov    (%eax),%eax
+ 89a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 89d:	8b 42 04             	mov    0x4(%edx),%eax
+ 8a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8a3:	39 f1                	cmp    %esi,%ecx
+ 8a5:	75 c8                	jne    86f <free+0x3f>
+    p->s.size += bp->s.size;
+ 8a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8aa:	89 15 00 10 00 00    	mov    %edx,0x1000
+    p->s.size += bp->s.size;
+ 8b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8b6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8b8:	5b                   	pop    %ebx
+ 8b9:	5e                   	pop    %esi
+ 8ba:	5f                   	pop    %edi
+ 8bb:	5d                   	pop    %ebp
+ 8bc:	c3                   	ret
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8cc:	8b 15 00 10 00 00    	mov    0x1000,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8d2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8d5:	c1 ef 03             	shr    $0x3,%edi
+ 8d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8db:	85 d2                	test   %edx,%edx
+ 8dd:	0f 84 8d 00 00 00    	je     970 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8e5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8e8:	39 f9                	cmp    %edi,%ecx
+ 8ea:	73 64                	jae    950 <malloc+0x90>
+  if(nu < 4096)
+ 8ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8f1:	39 df                	cmp    %ebx,%edi
+ 8f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8fd:	eb 0a                	jmp    909 <malloc+0x49>
+ 8ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 900:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 902:	8b 48 04             	mov    0x4(%eax),%ecx
+ 905:	39 f9                	cmp    %edi,%ecx
+ 907:	73 47                	jae    950 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 909:	89 c2                	mov    %eax,%edx
+ 90b:	39 05 00 10 00 00    	cmp    %eax,0x1000
+ 911:	75 ed                	jne    900 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	56                   	push   %esi
+ 917:	e8 6f fc ff ff       	call   58b <sbrk>
+  if(p == (char*)-1)
+ 91c:	83 c4 10             	add    $0x10,%esp
+ 91f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 922:	74 1c                	je     940 <malloc+0x80>
+  hp->s.size = nu;
+ 924:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 927:	83 ec 0c             	sub    $0xc,%esp
+ 92a:	83 c0 08             	add    $0x8,%eax
+ 92d:	50                   	push   %eax
+ 92e:	e8 fd fe ff ff       	call   830 <free>
+  return freep;
+ 933:	8b 15 00 10 00 00    	mov    0x1000,%edx
+      if((p = morecore(nunits)) == 0)
+ 939:	83 c4 10             	add    $0x10,%esp
+ 93c:	85 d2                	test   %edx,%edx
+ 93e:	75 c0                	jne    900 <malloc+0x40>
+        return 0;
+  }
+}
+ 940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 943:	31 c0                	xor    %eax,%eax
+}
+ 945:	5b                   	pop    %ebx
+ 946:	5e                   	pop    %esi
+ 947:	5f                   	pop    %edi
+ 948:	5d                   	pop    %ebp
+ 949:	c3                   	ret
+ 94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 950:	39 cf                	cmp    %ecx,%edi
+ 952:	74 4c                	je     9a0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 954:	29 f9                	sub    %edi,%ecx
+ 956:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 959:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 95c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 95f:	89 15 00 10 00 00    	mov    %edx,0x1000
+}
+ 965:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 968:	83 c0 08             	add    $0x8,%eax
+}
+ 96b:	5b                   	pop    %ebx
+ 96c:	5e                   	pop    %esi
+ 96d:	5f                   	pop    %edi
+ 96e:	5d                   	pop    %ebp
+ 96f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 970:	c7 05 00 10 00 00 04 	movl   $0x1004,0x1000
+ 977:	10 00 00 
+    base.s.size = 0;
+ 97a:	b8 04 10 00 00       	mov    $0x1004,%eax
+    base.s.ptr = freep = prevp = &base;
+ 97f:	c7 05 04 10 00 00 04 	movl   $0x1004,0x1004
+ 986:	10 00 00 
+    base.s.size = 0;
+ 989:	c7 05 08 10 00 00 00 	movl   $0x0,0x1008
+ 990:	00 00 00 
+    if(p->s.size >= nunits){
+ 993:	e9 54 ff ff ff       	jmp    8ec <malloc+0x2c>
+ 998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9a0:	8b 08                	mov    (%eax),%ecx
+ 9a2:	89 0a                	mov    %ecx,(%edx)
+ 9a4:	eb b9                	jmp    95f <malloc+0x9f>
@@ -0,0 +1,91 @@
+// Sequential read benchmark.
+// Writes a file of the largest size xv6 supports, then reads it
+// back cold (the block cache emptied with dropcache()) a number
+// of times, first with read-ahead off and then with a window of
+// the given number of blocks, and reports the throughput of each.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+
+#define NROUNDS 20
+#define FILENAME "readbench.tmp"
+
+char buf[BSIZE];
+
+// Read the file from start to end rounds times, each from cold.
+// Returns elapsed ticks.
+int
+readall(int rounds)
+{
+  int fd, i, n, t0, t1;
+
+  t0 = uptime();
+  for(i = 0; i < rounds; i++){
+    dropcache();
+    if((fd = open(FILENAME, O_RDONLY)) < 0){
+      printf(1, "readbench: cannot open %s\n", FILENAME);
+      exit();
+    }
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+      ;
+    close(fd);
+  }
+  t1 = uptime();
+  return t1 - t0;
+}
+
+void
+report(char *what, int window, int rounds, int t)
+{
+  int kb;
+
+  kb = rounds * MAXFILE * BSIZE / 1024;
+  if(t == 0)
+    t = 1;
+  // 100 ticks a second; print MB/s with two decimals.
+  printf(1, "readbench: read-ahead %s (%d blocks): %d KB in %d ticks, ",
+         what, window, kb, t);
+  printf(1, "%d.%d%d MB/s\n", kb*100/1024/t, kb*1000/1024/t % 10,
+         kb*10000/1024/t % 10);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, old, window, rounds, t;
+
+  window = argc > 1 ? atoi(argv[1]) : 16;
+  rounds = argc > 2 ? atoi(argv[2]) : NROUNDS;
+  if(window <= 0 || rounds <= 0){
+    printf(2, "usage: readbench [window] [rounds]\n");
+    exit();
+  }
+
+  fd = open(FILENAME, O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "readbench: cannot create %s\n", FILENAME);
+    exit();
+  }
+  memset(buf, 'r', sizeof(buf));
+  for(i = 0; i < MAXFILE; i++){
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(1, "readbench: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  old = readahead(0);
+  t = readall(rounds);
+  report("off", 0, rounds, t);
+  readahead(window);
+  t = readall(rounds);
+  report("on", window, rounds, t);
+  readahead(old);
+
+  unlink(FILENAME);
+  exit();
+}
@@ -0,0 +1,1751 @@
+
+_schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 71 04             	mov    0x4(%ecx),%esi
+  int a, b;
+
+  if(argc < 2){
+  19:	83 fb 01             	cmp    $0x1,%ebx
+  1c:	7e 3a                	jle    58 <main+0x58>
+    printf(2, "usage: schedbench pingpong [pairs] [rounds]\n");
+    printf(2, "       schedbench fork [workers] [jobs]\n");
+    printf(2, "       schedbench switch [rounds]\n");
+    exit();
+  }
+  if(strcmp(argv[1], "pingpong") == 0){
+  1e:	51                   	push   %ecx
+  1f:	51                   	push   %ecx
+  20:	68 5a 0c 00 00       	push   $0xc5a
+  25:	ff 76 04             	push   0x4(%esi)
+  28:	e8 43 05 00 00       	call   570 <strcmp>
+  2d:	83 c4 10             	add    $0x10,%esp
+  30:	85 c0                	test   %eax,%eax
+  32:	75 53                	jne    87 <main+0x87>
+    a = argc > 2 ? atoi(argv[2]) : NPAIRS;
+  34:	83 fb 02             	cmp    $0x2,%ebx
+  37:	0f 85 91 00 00 00    	jne    ce <main+0xce>
+    b = argc > 3 ? atoi(argv[3]) : NROUNDS;
+  3d:	b8 d0 07 00 00       	mov    $0x7d0,%eax
+    a = argc > 2 ? atoi(argv[2]) : NPAIRS;
+  42:	bf 04 00 00 00       	mov    $0x4,%edi
+    if(a > 0 && b > 0)
+      runpingpong(a, b);
+  47:	52                   	push   %edx
+  48:	52                   	push   %edx
+  49:	50                   	push   %eax
+  4a:	57                   	push   %edi
+  4b:	e8 20 03 00 00       	call   370 <runpingpong>
+  50:	83 c4 10             	add    $0x10,%esp
+    if(a > 0)
+      runswitch(a);
+  } else {
+    printf(2, "schedbench: unknown benchmark %s\n", argv[1]);
+  }
+  exit();
+  53:	e8 2b 07 00 00       	call   783 <exit>
+    printf(2, "usage: schedbench pingpong [pairs] [rounds]\n");
+  58:	53                   	push   %ebx
+  59:	53                   	push   %ebx
+  5a:	68 80 0d 00 00       	push   $0xd80
+  5f:	6a 02                	push   $0x2
+  61:	e8 9a 08 00 00       	call   900 <printf>
+    printf(2, "       schedbench fork [workers] [jobs]\n");
+  66:	5e                   	pop    %esi
+  67:	5f                   	pop    %edi
+  68:	68 b0 0d 00 00       	push   $0xdb0
+  6d:	6a 02                	push   $0x2
+  6f:	e8 8c 08 00 00       	call   900 <printf>
+    printf(2, "       schedbench switch [rounds]\n");
+  74:	58                   	pop    %eax
+  75:	5a                   	pop    %edx
+  76:	68 dc 0d 00 00       	push   $0xddc
+  7b:	6a 02                	push   $0x2
+  7d:	e8 7e 08 00 00       	call   900 <printf>
+    exit();
+  82:	e8 fc 06 00 00       	call   783 <exit>
+  } else if(strcmp(argv[1], "fork") == 0){
+  87:	57                   	push   %edi
+  88:	57                   	push   %edi
+  89:	68 63 0c 00 00       	push   $0xc63
+  8e:	ff 76 04             	push   0x4(%esi)
+  91:	e8 da 04 00 00       	call   570 <strcmp>
+  96:	83 c4 10             	add    $0x10,%esp
+  99:	85 c0                	test   %eax,%eax
+  9b:	0f 85 85 00 00 00    	jne    126 <main+0x126>
+    a = argc > 2 ? atoi(argv[2]) : NWORKERS;
+  a1:	83 fb 02             	cmp    $0x2,%ebx
+  a4:	74 65                	je     10b <main+0x10b>
+  a6:	83 ec 0c             	sub    $0xc,%esp
+  a9:	ff 76 08             	push   0x8(%esi)
+  ac:	e8 5f 06 00 00       	call   710 <atoi>
+    b = argc > 3 ? atoi(argv[3]) : NJOBS;
+  b1:	83 c4 10             	add    $0x10,%esp
+    a = argc > 2 ? atoi(argv[2]) : NWORKERS;
+  b4:	89 c7                	mov    %eax,%edi
+    b = argc > 3 ? atoi(argv[3]) : NJOBS;
+  b6:	b8 08 00 00 00       	mov    $0x8,%eax
+  bb:	83 fb 03             	cmp    $0x3,%ebx
+  be:	0f 85 a4 00 00 00    	jne    168 <main+0x168>
+    if(a > 0 && b > 0)
+  c4:	85 ff                	test   %edi,%edi
+  c6:	7e 8b                	jle    53 <main+0x53>
+  c8:	85 c0                	test   %eax,%eax
+  ca:	7e 87                	jle    53 <main+0x53>
+  cc:	eb 47                	jmp    115 <main+0x115>
+    a = argc > 2 ? atoi(argv[2]) : NPAIRS;
+  ce:	83 ec 0c             	sub    $0xc,%esp
+  d1:	ff 76 08             	push   0x8(%esi)
+  d4:	e8 37 06 00 00       	call   710 <atoi>
+    b = argc > 3 ? atoi(argv[3]) : NROUNDS;
+  d9:	83 c4 10             	add    $0x10,%esp
+    a = argc > 2 ? atoi(argv[2]) : NPAIRS;
+  dc:	89 c7                	mov    %eax,%edi
+    b = argc > 3 ? atoi(argv[3]) : NROUNDS;
+  de:	b8 d0 07 00 00       	mov    $0x7d0,%eax
+  e3:	83 fb 03             	cmp    $0x3,%ebx
+  e6:	74 0e                	je     f6 <main+0xf6>
+  e8:	83 ec 0c             	sub    $0xc,%esp
+  eb:	ff 76 0c             	push   0xc(%esi)
+  ee:	e8 1d 06 00 00       	call   710 <atoi>
+  f3:	83 c4 10             	add    $0x10,%esp
+    if(a > 0 && b > 0)
+  f6:	85 ff                	test   %edi,%edi
+  f8:	0f 8e 55 ff ff ff    	jle    53 <main+0x53>
+  fe:	85 c0                	test   %eax,%eax
+ 100:	0f 8e 4d ff ff ff    	jle    53 <main+0x53>
+ 106:	e9 3c ff ff ff       	jmp    47 <main+0x47>
+    b = argc > 3 ? atoi(argv[3]) : NJOBS;
+ 10b:	b8 08 00 00 00       	mov    $0x8,%eax
+    a = argc > 2 ? atoi(argv[2]) : NWORKERS;
+ 110:	bf 04 00 00 00       	mov    $0x4,%edi
+      runfork(a, b);
+ 115:	51                   	push   %ecx
+ 116:	51                   	push   %ecx
+ 117:	50                   	push   %eax
+ 118:	57                   	push   %edi
+ 119:	e8 92 03 00 00       	call   4b0 <runfork>
+ 11e:	83 c4 10             	add    $0x10,%esp
+ 121:	e9 2d ff ff ff       	jmp    53 <main+0x53>
+  } else if(strcmp(argv[1], "switch") == 0){
+ 126:	52                   	push   %edx
+ 127:	52                   	push   %edx
+ 128:	68 68 0c 00 00       	push   $0xc68
+ 12d:	ff 76 04             	push   0x4(%esi)
+ 130:	e8 3b 04 00 00       	call   570 <strcmp>
+ 135:	83 c4 10             	add    $0x10,%esp
+ 138:	85 c0                	test   %eax,%eax
+ 13a:	75 3f                	jne    17b <main+0x17b>
+    a = argc > 2 ? atoi(argv[2]) : NSWITCH;
+ 13c:	83 fb 02             	cmp    $0x2,%ebx
+ 13f:	74 52                	je     193 <main+0x193>
+ 141:	83 ec 0c             	sub    $0xc,%esp
+ 144:	ff 76 08             	push   0x8(%esi)
+ 147:	e8 c4 05 00 00       	call   710 <atoi>
+    if(a > 0)
+ 14c:	83 c4 10             	add    $0x10,%esp
+ 14f:	85 c0                	test   %eax,%eax
+ 151:	0f 8e fc fe ff ff    	jle    53 <main+0x53>
+      runswitch(a);
+ 157:	83 ec 0c             	sub    $0xc,%esp
+ 15a:	50                   	push   %eax
+ 15b:	e8 b0 02 00 00       	call   410 <runswitch>
+ 160:	83 c4 10             	add    $0x10,%esp
+ 163:	e9 eb fe ff ff       	jmp    53 <main+0x53>
+    b = argc > 3 ? atoi(argv[3]) : NJOBS;
+ 168:	83 ec 0c             	sub    $0xc,%esp
+ 16b:	ff 76 0c             	push   0xc(%esi)
+ 16e:	e8 9d 05 00 00       	call   710 <atoi>
+ 173:	83 c4 10             	add    $0x10,%esp
+ 176:	e9 49 ff ff ff       	jmp    c4 <main+0xc4>
+    printf(2, "schedbench: unknown benchmark %s\n", argv[1]);
+ 17b:	50                   	push   %eax
+ 17c:	ff 76 04             	push   0x4(%esi)
+ 17f:	68 00 0e 00 00       	push   $0xe00
+ 184:	6a 02                	push   $0x2
+ 186:	e8 75 07 00 00       	call   900 <printf>
+ 18b:	83 c4 10             	add    $0x10,%esp
+ 18e:	e9 c0 fe ff ff       	jmp    53 <main+0x53>
+    a = argc > 2 ? atoi(argv[2]) : NSWITCH;
+ 193:	b8 20 4e 00 00       	mov    $0x4e20,%eax
+ 198:	eb bd                	jmp    157 <main+0x157>
+ 19a:	66 90                	xchg   %ax,%ax
+ 19c:	66 90                	xchg   %ax,%ax
+ 19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <pingpong>:
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  if(pipe(ab) < 0 || pipe(ba) < 0){
+ 1a5:	8d 45 d8             	lea    -0x28(%ebp),%eax
+{
+ 1a8:	53                   	push   %ebx
+ 1a9:	83 ec 38             	sub    $0x38,%esp
+ 1ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(pipe(ab) < 0 || pipe(ba) < 0){
+ 1af:	50                   	push   %eax
+ 1b0:	e8 de 05 00 00       	call   793 <pipe>
+ 1b5:	83 c4 10             	add    $0x10,%esp
+ 1b8:	85 c0                	test   %eax,%eax
+ 1ba:	78 13                	js     1cf <pingpong+0x2f>
+ 1bc:	83 ec 0c             	sub    $0xc,%esp
+ 1bf:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 1c2:	50                   	push   %eax
+ 1c3:	e8 cb 05 00 00       	call   793 <pipe>
+ 1c8:	83 c4 10             	add    $0x10,%esp
+ 1cb:	85 c0                	test   %eax,%eax
+ 1cd:	79 14                	jns    1e3 <pingpong+0x43>
+    printf(1, "schedbench: pipe failed\n");
+ 1cf:	83 ec 08             	sub    $0x8,%esp
+ 1d2:	68 28 0c 00 00       	push   $0xc28
+ 1d7:	6a 01                	push   $0x1
+ 1d9:	e8 22 07 00 00       	call   900 <printf>
+    exit();
+ 1de:	e8 a0 05 00 00       	call   783 <exit>
+  pid = fork();
+ 1e3:	e8 93 05 00 00       	call   77b <fork>
+ 1e8:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+ 1ea:	85 c0                	test   %eax,%eax
+ 1ec:	78 45                	js     233 <pingpong+0x93>
+  if(pid == 0){
+ 1ee:	75 56                	jne    246 <pingpong+0xa6>
+    for(i = 0; i < rounds; i++){
+ 1f0:	85 ff                	test   %edi,%edi
+ 1f2:	7e 3a                	jle    22e <pingpong+0x8e>
+ 1f4:	8d 5d d7             	lea    -0x29(%ebp),%ebx
+ 1f7:	eb 1f                	jmp    218 <pingpong+0x78>
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      write(ba[1], &c, 1);
+ 200:	83 ec 04             	sub    $0x4,%esp
+    for(i = 0; i < rounds; i++){
+ 203:	83 c6 01             	add    $0x1,%esi
+      write(ba[1], &c, 1);
+ 206:	6a 01                	push   $0x1
+ 208:	53                   	push   %ebx
+ 209:	ff 75 e4             	push   -0x1c(%ebp)
+ 20c:	e8 92 05 00 00       	call   7a3 <write>
+    for(i = 0; i < rounds; i++){
+ 211:	83 c4 10             	add    $0x10,%esp
+ 214:	39 f7                	cmp    %esi,%edi
+ 216:	74 16                	je     22e <pingpong+0x8e>
+      if(read(ab[0], &c, 1) != 1)
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	6a 01                	push   $0x1
+ 21d:	53                   	push   %ebx
+ 21e:	ff 75 d8             	push   -0x28(%ebp)
+ 221:	e8 75 05 00 00       	call   79b <read>
+ 226:	83 c4 10             	add    $0x10,%esp
+ 229:	83 f8 01             	cmp    $0x1,%eax
+ 22c:	74 d2                	je     200 <pingpong+0x60>
+  exit();
+ 22e:	e8 50 05 00 00       	call   783 <exit>
+    printf(1, "schedbench: fork failed\n");
+ 233:	50                   	push   %eax
+ 234:	50                   	push   %eax
+ 235:	68 41 0c 00 00       	push   $0xc41
+ 23a:	6a 01                	push   $0x1
+ 23c:	e8 bf 06 00 00       	call   900 <printf>
+    exit();
+ 241:	e8 3d 05 00 00       	call   783 <exit>
+  c = 'x';
+ 246:	c6 45 d7 78          	movb   $0x78,-0x29(%ebp)
+  for(i = 0; i < rounds; i++){
+ 24a:	85 ff                	test   %edi,%edi
+ 24c:	7e 35                	jle    283 <pingpong+0xe3>
+ 24e:	31 f6                	xor    %esi,%esi
+ 250:	8d 5d d7             	lea    -0x29(%ebp),%ebx
+ 253:	eb 0a                	jmp    25f <pingpong+0xbf>
+ 255:	8d 76 00             	lea    0x0(%esi),%esi
+ 258:	83 c6 01             	add    $0x1,%esi
+ 25b:	39 f7                	cmp    %esi,%edi
+ 25d:	74 24                	je     283 <pingpong+0xe3>
+    write(ab[1], &c, 1);
+ 25f:	83 ec 04             	sub    $0x4,%esp
+ 262:	6a 01                	push   $0x1
+ 264:	53                   	push   %ebx
+ 265:	ff 75 dc             	push   -0x24(%ebp)
+ 268:	e8 36 05 00 00       	call   7a3 <write>
+    if(read(ba[0], &c, 1) != 1)
+ 26d:	83 c4 0c             	add    $0xc,%esp
+ 270:	6a 01                	push   $0x1
+ 272:	53                   	push   %ebx
+ 273:	ff 75 e0             	push   -0x20(%ebp)
+ 276:	e8 20 05 00 00       	call   79b <read>
+ 27b:	83 c4 10             	add    $0x10,%esp
+ 27e:	83 f8 01             	cmp    $0x1,%eax
+ 281:	74 d5                	je     258 <pingpong+0xb8>
+  wait();
+ 283:	e8 03 05 00 00       	call   78b <wait>
+ 288:	eb a4                	jmp    22e <pingpong+0x8e>
+ 28a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000290 <spin>:
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	83 ec 10             	sub    $0x10,%esp
+  x = 0;
+ 296:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+{
+ 29d:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(i = 0; i < n; i++)
+ 2a0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+ 2a7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 2aa:	39 c2                	cmp    %eax,%edx
+ 2ac:	7e 1d                	jle    2cb <spin+0x3b>
+ 2ae:	66 90                	xchg   %ax,%ax
+    x += i;
+ 2b0:	8b 4d f8             	mov    -0x8(%ebp),%ecx
+ 2b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2b6:	01 c8                	add    %ecx,%eax
+ 2b8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  for(i = 0; i < n; i++)
+ 2bb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 2be:	83 c0 01             	add    $0x1,%eax
+ 2c1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2c4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 2c7:	39 d0                	cmp    %edx,%eax
+ 2c9:	7c e5                	jl     2b0 <spin+0x20>
+  return x;
+ 2cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2ce:	c9                   	leave
+ 2cf:	c3                   	ret
+
+000002d0 <forker>:
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	56                   	push   %esi
+ 2d5:	53                   	push   %ebx
+ 2d6:	83 ec 1c             	sub    $0x1c,%esp
+ 2d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; i < jobs; i++){
+ 2dc:	85 ff                	test   %edi,%edi
+ 2de:	7e 6a                	jle    34a <forker+0x7a>
+    spin(SPIN / (id + 2));
+ 2e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  for(i = 0; i < jobs; i++){
+ 2e3:	31 db                	xor    %ebx,%ebx
+    spin(SPIN / (id + 2));
+ 2e5:	8d 70 02             	lea    0x2(%eax),%esi
+ 2e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(fork() == 0){
+ 2f0:	e8 86 04 00 00       	call   77b <fork>
+ 2f5:	85 c0                	test   %eax,%eax
+ 2f7:	74 56                	je     34f <forker+0x7f>
+    spin(SPIN / (id + 2));
+ 2f9:	b8 80 84 1e 00       	mov    $0x1e8480,%eax
+ 2fe:	31 d2                	xor    %edx,%edx
+  x = 0;
+ 300:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    spin(SPIN / (id + 2));
+ 307:	f7 fe                	idiv   %esi
+  for(i = 0; i < n; i++)
+ 309:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 310:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 313:	39 d0                	cmp    %edx,%eax
+ 315:	7e 24                	jle    33b <forker+0x6b>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+    x += i;
+ 320:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 323:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 326:	01 ca                	add    %ecx,%edx
+ 328:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  for(i = 0; i < n; i++)
+ 32b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 32e:	83 c2 01             	add    $0x1,%edx
+ 331:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 334:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 337:	39 d0                	cmp    %edx,%eax
+ 339:	7f e5                	jg     320 <forker+0x50>
+  for(i = 0; i < jobs; i++){
+ 33b:	83 c3 01             	add    $0x1,%ebx
+  return x;
+ 33e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    wait();
+ 341:	e8 45 04 00 00       	call   78b <wait>
+  for(i = 0; i < jobs; i++){
+ 346:	39 df                	cmp    %ebx,%edi
+ 348:	75 a6                	jne    2f0 <forker+0x20>
+  exit();
+ 34a:	e8 34 04 00 00       	call   783 <exit>
+      spin(SPIN);
+ 34f:	83 ec 0c             	sub    $0xc,%esp
+ 352:	68 80 84 1e 00       	push   $0x1e8480
+ 357:	e8 34 ff ff ff       	call   290 <spin>
+      exit();
+ 35c:	e8 22 04 00 00       	call   783 <exit>
+ 361:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 368:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <runpingpong>:
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+ 375:	53                   	push   %ebx
+ 376:	31 db                	xor    %ebx,%ebx
+ 378:	83 ec 1c             	sub    $0x1c,%esp
+ 37b:	8b 75 08             	mov    0x8(%ebp),%esi
+  printf(1, "schedbench: %d pairs x %d round trips\n", pairs, rounds);
+ 37e:	ff 75 0c             	push   0xc(%ebp)
+ 381:	56                   	push   %esi
+ 382:	68 70 0c 00 00       	push   $0xc70
+ 387:	6a 01                	push   $0x1
+ 389:	e8 72 05 00 00       	call   900 <printf>
+  t0 = uptime();
+ 38e:	e8 88 04 00 00       	call   81b <uptime>
+  for(i = 0; i < pairs; i++){
+ 393:	83 c4 10             	add    $0x10,%esp
+  t0 = uptime();
+ 396:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < pairs; i++){
+ 399:	85 f6                	test   %esi,%esi
+ 39b:	7f 05                	jg     3a2 <runpingpong+0x32>
+ 39d:	eb 27                	jmp    3c6 <runpingpong+0x56>
+ 39f:	90                   	nop
+ 3a0:	89 c3                	mov    %eax,%ebx
+    if(fork() == 0)
+ 3a2:	e8 d4 03 00 00       	call   77b <fork>
+ 3a7:	85 c0                	test   %eax,%eax
+ 3a9:	74 58                	je     403 <runpingpong+0x93>
+  for(i = 0; i < pairs; i++){
+ 3ab:	8d 43 01             	lea    0x1(%ebx),%eax
+ 3ae:	39 c6                	cmp    %eax,%esi
+ 3b0:	75 ee                	jne    3a0 <runpingpong+0x30>
+  for(i = 0; i < pairs; i++)
+ 3b2:	31 ff                	xor    %edi,%edi
+ 3b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+ 3b8:	e8 ce 03 00 00       	call   78b <wait>
+  for(i = 0; i < pairs; i++)
+ 3bd:	89 f8                	mov    %edi,%eax
+ 3bf:	83 c7 01             	add    $0x1,%edi
+ 3c2:	39 d8                	cmp    %ebx,%eax
+ 3c4:	75 f2                	jne    3b8 <runpingpong+0x48>
+  t1 = uptime();
+ 3c6:	e8 50 04 00 00       	call   81b <uptime>
+         2*pairs*rounds, t1 - t0, 2*pairs*rounds / (t1 - t0));
+ 3cb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 3ce:	89 c1                	mov    %eax,%ecx
+ 3d0:	29 d1                	sub    %edx,%ecx
+ 3d2:	39 c2                	cmp    %eax,%edx
+ 3d4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3d9:	0f 44 c8             	cmove  %eax,%ecx
+ 3dc:	0f af 75 0c          	imul   0xc(%ebp),%esi
+  printf(1, "schedbench: %d switches in %d ticks, %d switches/tick\n",
+ 3e0:	83 ec 0c             	sub    $0xc,%esp
+         2*pairs*rounds, t1 - t0, 2*pairs*rounds / (t1 - t0));
+ 3e3:	01 f6                	add    %esi,%esi
+  printf(1, "schedbench: %d switches in %d ticks, %d switches/tick\n",
+ 3e5:	89 f0                	mov    %esi,%eax
+ 3e7:	99                   	cltd
+ 3e8:	f7 f9                	idiv   %ecx
+ 3ea:	50                   	push   %eax
+ 3eb:	51                   	push   %ecx
+ 3ec:	56                   	push   %esi
+ 3ed:	68 98 0c 00 00       	push   $0xc98
+ 3f2:	6a 01                	push   $0x1
+ 3f4:	e8 07 05 00 00       	call   900 <printf>
+}
+ 3f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3fc:	31 c0                	xor    %eax,%eax
+ 3fe:	5b                   	pop    %ebx
+ 3ff:	5e                   	pop    %esi
+ 400:	5f                   	pop    %edi
+ 401:	5d                   	pop    %ebp
+ 402:	c3                   	ret
+      pingpong(rounds);
+ 403:	83 ec 0c             	sub    $0xc,%esp
+ 406:	ff 75 0c             	push   0xc(%ebp)
+ 409:	e8 92 fd ff ff       	call   1a0 <pingpong>
+ 40e:	66 90                	xchg   %ax,%ax
+
+00000410 <runswitch>:
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	53                   	push   %ebx
+ 416:	83 ec 10             	sub    $0x10,%esp
+ 419:	8b 75 08             	mov    0x8(%ebp),%esi
+  printf(1, "schedbench: 1 pair x %d round trips\n", rounds);
+ 41c:	56                   	push   %esi
+ 41d:	68 d0 0c 00 00       	push   $0xcd0
+ 422:	6a 01                	push   $0x1
+ 424:	e8 d7 04 00 00       	call   900 <printf>
+  t0 = uptime();
+ 429:	e8 ed 03 00 00       	call   81b <uptime>
+ 42e:	89 c7                	mov    %eax,%edi
+  if(fork() == 0)
+ 430:	e8 46 03 00 00       	call   77b <fork>
+ 435:	83 c4 10             	add    $0x10,%esp
+ 438:	85 c0                	test   %eax,%eax
+ 43a:	74 60                	je     49c <runswitch+0x8c>
+  wait();
+ 43c:	e8 4a 03 00 00       	call   78b <wait>
+  t1 = uptime();
+ 441:	e8 d5 03 00 00       	call   81b <uptime>
+ 446:	89 c3                	mov    %eax,%ebx
+  if(t1 == t0)
+ 448:	39 c7                	cmp    %eax,%edi
+ 44a:	74 44                	je     490 <runswitch+0x80>
+  us10 = (t1 - t0) * 100000 / (2*rounds);
+ 44c:	29 fb                	sub    %edi,%ebx
+ 44e:	69 c3 a0 86 01 00    	imul   $0x186a0,%ebx,%eax
+ 454:	01 f6                	add    %esi,%esi
+ 456:	99                   	cltd
+  printf(1, "schedbench: %d switches in %d ticks, %d.%d us per switch\n",
+ 457:	83 ec 08             	sub    $0x8,%esp
+  us10 = (t1 - t0) * 100000 / (2*rounds);
+ 45a:	f7 fe                	idiv   %esi
+  printf(1, "schedbench: %d switches in %d ticks, %d.%d us per switch\n",
+ 45c:	ba 67 66 66 66       	mov    $0x66666667,%edx
+  us10 = (t1 - t0) * 100000 / (2*rounds);
+ 461:	89 c1                	mov    %eax,%ecx
+  printf(1, "schedbench: %d switches in %d ticks, %d.%d us per switch\n",
+ 463:	f7 ea                	imul   %edx
+ 465:	89 c8                	mov    %ecx,%eax
+ 467:	c1 f8 1f             	sar    $0x1f,%eax
+ 46a:	c1 fa 02             	sar    $0x2,%edx
+ 46d:	29 c2                	sub    %eax,%edx
+ 46f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 472:	01 c0                	add    %eax,%eax
+ 474:	29 c1                	sub    %eax,%ecx
+ 476:	51                   	push   %ecx
+ 477:	52                   	push   %edx
+ 478:	53                   	push   %ebx
+ 479:	56                   	push   %esi
+ 47a:	68 f8 0c 00 00       	push   $0xcf8
+ 47f:	6a 01                	push   $0x1
+ 481:	e8 7a 04 00 00       	call   900 <printf>
+}
+ 486:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 489:	31 c0                	xor    %eax,%eax
+ 48b:	5b                   	pop    %ebx
+ 48c:	5e                   	pop    %esi
+ 48d:	5f                   	pop    %edi
+ 48e:	5d                   	pop    %ebp
+ 48f:	c3                   	ret
+ 490:	b8 a0 86 01 00       	mov    $0x186a0,%eax
+ 495:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 49a:	eb b8                	jmp    454 <runswitch+0x44>
+    pingpong(rounds);
+ 49c:	83 ec 0c             	sub    $0xc,%esp
+ 49f:	56                   	push   %esi
+ 4a0:	e8 fb fc ff ff       	call   1a0 <pingpong>
+ 4a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <runfork>:
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	53                   	push   %ebx
+ 4b6:	83 ec 0c             	sub    $0xc,%esp
+ 4b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  printf(1, "schedbench: %d workers x %d forked jobs\n", workers, jobs);
+ 4bc:	ff 75 0c             	push   0xc(%ebp)
+ 4bf:	56                   	push   %esi
+ 4c0:	68 34 0d 00 00       	push   $0xd34
+ 4c5:	6a 01                	push   $0x1
+ 4c7:	e8 34 04 00 00       	call   900 <printf>
+  t0 = uptime();
+ 4cc:	e8 4a 03 00 00       	call   81b <uptime>
+  for(i = 0; i < workers; i++){
+ 4d1:	83 c4 10             	add    $0x10,%esp
+  t0 = uptime();
+ 4d4:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < workers; i++){
+ 4d6:	85 f6                	test   %esi,%esi
+ 4d8:	7e 2c                	jle    506 <runfork+0x56>
+ 4da:	31 db                	xor    %ebx,%ebx
+ 4dc:	eb 04                	jmp    4e2 <runfork+0x32>
+ 4de:	66 90                	xchg   %ax,%ax
+ 4e0:	89 c3                	mov    %eax,%ebx
+    if(fork() == 0)
+ 4e2:	e8 94 02 00 00       	call   77b <fork>
+ 4e7:	85 c0                	test   %eax,%eax
+ 4e9:	74 3c                	je     527 <runfork+0x77>
+  for(i = 0; i < workers; i++){
+ 4eb:	8d 43 01             	lea    0x1(%ebx),%eax
+ 4ee:	39 c6                	cmp    %eax,%esi
+ 4f0:	75 ee                	jne    4e0 <runfork+0x30>
+  for(i = 0; i < workers; i++)
+ 4f2:	31 f6                	xor    %esi,%esi
+ 4f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+ 4f8:	e8 8e 02 00 00       	call   78b <wait>
+  for(i = 0; i < workers; i++)
+ 4fd:	89 f0                	mov    %esi,%eax
+ 4ff:	83 c6 01             	add    $0x1,%esi
+ 502:	39 c3                	cmp    %eax,%ebx
+ 504:	75 f2                	jne    4f8 <runfork+0x48>
+  t1 = uptime();
+ 506:	e8 10 03 00 00       	call   81b <uptime>
+  printf(1, "schedbench: makespan %d ticks\n", t1 - t0);
+ 50b:	83 ec 04             	sub    $0x4,%esp
+ 50e:	29 f8                	sub    %edi,%eax
+ 510:	50                   	push   %eax
+ 511:	68 60 0d 00 00       	push   $0xd60
+ 516:	6a 01                	push   $0x1
+ 518:	e8 e3 03 00 00       	call   900 <printf>
+}
+ 51d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 520:	31 c0                	xor    %eax,%eax
+ 522:	5b                   	pop    %ebx
+ 523:	5e                   	pop    %esi
+ 524:	5f                   	pop    %edi
+ 525:	5d                   	pop    %ebp
+ 526:	c3                   	ret
+      forker(jobs, i);
+ 527:	83 ec 08             	sub    $0x8,%esp
+ 52a:	53                   	push   %ebx
+ 52b:	ff 75 0c             	push   0xc(%ebp)
+ 52e:	e8 9d fd ff ff       	call   2d0 <forker>
+ 533:	66 90                	xchg   %ax,%ax
+ 535:	66 90                	xchg   %ax,%ax
+ 537:	66 90                	xchg   %ax,%ax
+ 539:	66 90                	xchg   %ax,%ax
+ 53b:	66 90                	xchg   %ax,%ax
+ 53d:	66 90                	xchg   %ax,%ax
+ 53f:	90                   	nop
+
+00000540 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 540:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 541:	31 c0                	xor    %eax,%eax
+{
+ 543:	89 e5                	mov    %esp,%ebp
+ 545:	53                   	push   %ebx
+ 546:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 549:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 550:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 554:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 557:	83 c0 01             	add    $0x1,%eax
+ 55a:	84 d2                	test   %dl,%dl
+ 55c:	75 f2                	jne    550 <strcpy+0x10>
+    ;
+  return os;
+}
+ 55e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 561:	89 c8                	mov    %ecx,%eax
+ 563:	c9                   	leave
+ 564:	c3                   	ret
+ 565:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+ 577:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 57a:	0f b6 02             	movzbl (%edx),%eax
+ 57d:	84 c0                	test   %al,%al
+ 57f:	75 17                	jne    598 <strcmp+0x28>
+ 581:	eb 3a                	jmp    5bd <strcmp+0x4d>
+ 583:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 587:	90                   	nop
+ 588:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 58c:	83 c2 01             	add    $0x1,%edx
+ 58f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 592:	84 c0                	test   %al,%al
+ 594:	74 1a                	je     5b0 <strcmp+0x40>
+    p++, q++;
+ 596:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 598:	0f b6 19             	movzbl (%ecx),%ebx
+ 59b:	38 c3                	cmp    %al,%bl
+ 59d:	74 e9                	je     588 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 59f:	29 d8                	sub    %ebx,%eax
+}
+ 5a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a4:	c9                   	leave
+ 5a5:	c3                   	ret
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 5b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 5b4:	31 c0                	xor    %eax,%eax
+ 5b6:	29 d8                	sub    %ebx,%eax
+}
+ 5b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5bb:	c9                   	leave
+ 5bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 5bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 5c0:	31 c0                	xor    %eax,%eax
+ 5c2:	eb db                	jmp    59f <strcmp+0x2f>
+ 5c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5cf:	90                   	nop
+
+000005d0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 5d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 5d9:	74 15                	je     5f0 <strlen+0x20>
+ 5db:	31 c0                	xor    %eax,%eax
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 5e0:	83 c0 01             	add    $0x1,%eax
+ 5e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 5e7:	89 c1                	mov    %eax,%ecx
+ 5e9:	75 f5                	jne    5e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 5eb:	89 c8                	mov    %ecx,%eax
+ 5ed:	5d                   	pop    %ebp
+ 5ee:	c3                   	ret
+ 5ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 5f0:	31 c9                	xor    %ecx,%ecx
+}
+ 5f2:	5d                   	pop    %ebp
+ 5f3:	89 c8                	mov    %ecx,%eax
+ 5f5:	c3                   	ret
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000600 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 607:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 60a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 60d:	89 d7                	mov    %edx,%edi
+ 60f:	fc                   	cld
+ 610:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 612:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 615:	89 d0                	mov    %edx,%eax
+ 617:	c9                   	leave
+ 618:	c3                   	ret
+ 619:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	8b 45 08             	mov    0x8(%ebp),%eax
+ 626:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 62a:	0f b6 10             	movzbl (%eax),%edx
+ 62d:	84 d2                	test   %dl,%dl
+ 62f:	75 12                	jne    643 <strchr+0x23>
+ 631:	eb 1d                	jmp    650 <strchr+0x30>
+ 633:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 637:	90                   	nop
+ 638:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 63c:	83 c0 01             	add    $0x1,%eax
+ 63f:	84 d2                	test   %dl,%dl
+ 641:	74 0d                	je     650 <strchr+0x30>
+    if(*s == c)
+ 643:	38 d1                	cmp    %dl,%cl
+ 645:	75 f1                	jne    638 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 647:	5d                   	pop    %ebp
+ 648:	c3                   	ret
+ 649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 650:	31 c0                	xor    %eax,%eax
+}
+ 652:	5d                   	pop    %ebp
+ 653:	c3                   	ret
+ 654:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+
+00000660 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 665:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 668:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 669:	31 db                	xor    %ebx,%ebx
+{
+ 66b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 66e:	eb 27                	jmp    697 <gets+0x37>
+    cc = read(0, &c, 1);
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	6a 01                	push   $0x1
+ 675:	56                   	push   %esi
+ 676:	6a 00                	push   $0x0
+ 678:	e8 1e 01 00 00       	call   79b <read>
+    if(cc < 1)
+ 67d:	83 c4 10             	add    $0x10,%esp
+ 680:	85 c0                	test   %eax,%eax
+ 682:	7e 1d                	jle    6a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 684:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 688:	8b 55 08             	mov    0x8(%ebp),%edx
+ 68b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 68f:	3c 0a                	cmp    $0xa,%al
+ 691:	74 10                	je     6a3 <gets+0x43>
+ 693:	3c 0d                	cmp    $0xd,%al
+ 695:	74 0c                	je     6a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 697:	89 df                	mov    %ebx,%edi
+ 699:	83 c3 01             	add    $0x1,%ebx
+ 69c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 69f:	7c cf                	jl     670 <gets+0x10>
+ 6a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 6a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 6aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ad:	5b                   	pop    %ebx
+ 6ae:	5e                   	pop    %esi
+ 6af:	5f                   	pop    %edi
+ 6b0:	5d                   	pop    %ebp
+ 6b1:	c3                   	ret
+ 6b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	56                   	push   %esi
+ 6c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 6c5:	83 ec 08             	sub    $0x8,%esp
+ 6c8:	6a 00                	push   $0x0
+ 6ca:	ff 75 08             	push   0x8(%ebp)
+ 6cd:	e8 f1 00 00 00       	call   7c3 <open>
+  if(fd < 0)
+ 6d2:	83 c4 10             	add    $0x10,%esp
+ 6d5:	85 c0                	test   %eax,%eax
+ 6d7:	78 27                	js     700 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 6d9:	83 ec 08             	sub    $0x8,%esp
+ 6dc:	ff 75 0c             	push   0xc(%ebp)
+ 6df:	89 c3                	mov    %eax,%ebx
+ 6e1:	50                   	push   %eax
+ 6e2:	e8 f4 00 00 00       	call   7db <fstat>
+  close(fd);
+ 6e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 6ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 6ec:	e8 ba 00 00 00       	call   7ab <close>
+  return r;
+ 6f1:	83 c4 10             	add    $0x10,%esp
+}
+ 6f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 6f7:	89 f0                	mov    %esi,%eax
+ 6f9:	5b                   	pop    %ebx
+ 6fa:	5e                   	pop    %esi
+ 6fb:	5d                   	pop    %ebp
+ 6fc:	c3                   	ret
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 700:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 705:	eb ed                	jmp    6f4 <stat+0x34>
+ 707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70e:	66 90                	xchg   %ax,%ax
+
+00000710 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	53                   	push   %ebx
+ 714:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 717:	0f be 02             	movsbl (%edx),%eax
+ 71a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 71d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 720:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 725:	77 1e                	ja     745 <atoi+0x35>
+ 727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 730:	83 c2 01             	add    $0x1,%edx
+ 733:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 736:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 73a:	0f be 02             	movsbl (%edx),%eax
+ 73d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 740:	80 fb 09             	cmp    $0x9,%bl
+ 743:	76 eb                	jbe    730 <atoi+0x20>
+  return n;
+}
+ 745:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 748:	89 c8                	mov    %ecx,%eax
+ 74a:	c9                   	leave
+ 74b:	c3                   	ret
+ 74c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	8b 45 10             	mov    0x10(%ebp),%eax
+ 758:	8b 55 08             	mov    0x8(%ebp),%edx
+ 75b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 75e:	85 c0                	test   %eax,%eax
+ 760:	7e 13                	jle    775 <memmove+0x25>
+ 762:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 764:	89 d7                	mov    %edx,%edi
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 770:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 771:	39 f8                	cmp    %edi,%eax
+ 773:	75 fb                	jne    770 <memmove+0x20>
+  return vdst;
+}
+ 775:	5e                   	pop    %esi
+ 776:	89 d0                	mov    %edx,%eax
+ 778:	5f                   	pop    %edi
+ 779:	5d                   	pop    %ebp
+ 77a:	c3                   	ret
+
+0000077b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 77b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <exit>:
+SYSCALL(exit)
+ 783:	b8 02 00 00 00       	mov    $0x2,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <wait>:
+SYSCALL(wait)
+ 78b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <pipe>:
+SYSCALL(pipe)
+ 793:	b8 04 00 00 00       	mov    $0x4,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <read>:
+SYSCALL(read)
+ 79b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <write>:
+SYSCALL(write)
+ 7a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <close>:
+SYSCALL(close)
+ 7ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <kill>:
+SYSCALL(kill)
+ 7b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <exec>:
+SYSCALL(exec)
+ 7bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <open>:
+SYSCALL(open)
+ 7c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <mknod>:
+SYSCALL(mknod)
+ 7cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <unlink>:
+SYSCALL(unlink)
+ 7d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <fstat>:
+SYSCALL(fstat)
+ 7db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <link>:
+SYSCALL(link)
+ 7e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <mkdir>:
+SYSCALL(mkdir)
+ 7eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <chdir>:
+SYSCALL(chdir)
+ 7f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <dup>:
+SYSCALL(dup)
+ 7fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <getpid>:
+SYSCALL(getpid)
+ 803:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <sbrk>:
+SYSCALL(sbrk)
+ 80b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <sleep>:
+SYSCALL(sleep)
+ 813:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <uptime>:
+SYSCALL(uptime)
+ 81b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <trace>:
+SYSCALL(trace)
+ 823:	b8 16 00 00 00       	mov    $0x16,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <assign_nice>:
+SYSCALL(assign_nice)
+ 82b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <readahead>:
+SYSCALL(readahead)
+ 833:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <dropcache>:
+SYSCALL(dropcache)
+ 83b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <tracedrain>:
+SYSCALL(tracedrain)
+ 843:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <settrace>:
+SYSCALL(settrace)
+ 84b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <tracestat>:
+ 853:	b8 21 00 00 00       	mov    $0x21,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+ 85b:	66 90                	xchg   %ax,%ax
+ 85d:	66 90                	xchg   %ax,%ax
+ 85f:	90                   	nop
+
+00000860 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	57                   	push   %edi
+ 864:	56                   	push   %esi
+ 865:	53                   	push   %ebx
+ 866:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 868:	89 d1                	mov    %edx,%ecx
+{
+ 86a:	83 ec 3c             	sub    $0x3c,%esp
+ 86d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 870:	85 d2                	test   %edx,%edx
+ 872:	0f 89 80 00 00 00    	jns    8f8 <printint+0x98>
+ 878:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 87c:	74 7a                	je     8f8 <printint+0x98>
+    x = -xx;
+ 87e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 880:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 885:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 888:	31 f6                	xor    %esi,%esi
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 890:	89 c8                	mov    %ecx,%eax
+ 892:	31 d2                	xor    %edx,%edx
+ 894:	89 f7                	mov    %esi,%edi
+ 896:	f7 f3                	div    %ebx
+ 898:	8d 76 01             	lea    0x1(%esi),%esi
+ 89b:	0f b6 92 84 0e 00 00 	movzbl 0xe84(%edx),%edx
+ 8a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8a6:	89 ca                	mov    %ecx,%edx
+ 8a8:	89 c1                	mov    %eax,%ecx
+ 8aa:	39 da                	cmp    %ebx,%edx
+ 8ac:	73 e2                	jae    890 <printint+0x30>
+  if(neg)
+ 8ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8b1:	85 c0                	test   %eax,%eax
+ 8b3:	74 07                	je     8bc <printint+0x5c>
+    buf[i++] = '-';
+ 8b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8ba:	89 f7                	mov    %esi,%edi
+ 8bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8c2:	01 df                	add    %ebx,%edi
+ 8c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8cb:	83 ec 04             	sub    $0x4,%esp
+ 8ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8d4:	6a 01                	push   $0x1
+ 8d6:	50                   	push   %eax
+ 8d7:	56                   	push   %esi
+ 8d8:	e8 c6 fe ff ff       	call   7a3 <write>
+  while(--i >= 0)
+ 8dd:	89 f8                	mov    %edi,%eax
+ 8df:	83 c4 10             	add    $0x10,%esp
+ 8e2:	83 ef 01             	sub    $0x1,%edi
+ 8e5:	39 d8                	cmp    %ebx,%eax
+ 8e7:	75 df                	jne    8c8 <printint+0x68>
+}
+ 8e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8ec:	5b                   	pop    %ebx
+ 8ed:	5e                   	pop    %esi
+ 8ee:	5f                   	pop    %edi
+ 8ef:	5d                   	pop    %ebp
+ 8f0:	c3                   	ret
+ 8f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8f8:	31 c0                	xor    %eax,%eax
+ 8fa:	eb 89                	jmp    885 <printint+0x25>
+ 8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 909:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 90c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 90f:	0f b6 1e             	movzbl (%esi),%ebx
+ 912:	83 c6 01             	add    $0x1,%esi
+ 915:	84 db                	test   %bl,%bl
+ 917:	74 67                	je     980 <printf+0x80>
+ 919:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 91c:	31 d2                	xor    %edx,%edx
+ 91e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 921:	eb 34                	jmp    957 <printf+0x57>
+ 923:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 927:	90                   	nop
+ 928:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 92b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 930:	83 f8 25             	cmp    $0x25,%eax
+ 933:	74 18                	je     94d <printf+0x4d>
+  write(fd, &c, 1);
+ 935:	83 ec 04             	sub    $0x4,%esp
+ 938:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 93b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 93e:	6a 01                	push   $0x1
+ 940:	50                   	push   %eax
+ 941:	57                   	push   %edi
+ 942:	e8 5c fe ff ff       	call   7a3 <write>
+ 947:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 94a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 94d:	0f b6 1e             	movzbl (%esi),%ebx
+ 950:	83 c6 01             	add    $0x1,%esi
+ 953:	84 db                	test   %bl,%bl
+ 955:	74 29                	je     980 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 957:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 95a:	85 d2                	test   %edx,%edx
+ 95c:	74 ca                	je     928 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 95e:	83 fa 25             	cmp    $0x25,%edx
+ 961:	75 ea                	jne    94d <printf+0x4d>
+      if(c == 'd'){
+ 963:	83 f8 25             	cmp    $0x25,%eax
+ 966:	0f 84 24 01 00 00    	je     a90 <printf+0x190>
+ 96c:	83 e8 63             	sub    $0x63,%eax
+ 96f:	83 f8 15             	cmp    $0x15,%eax
+ 972:	77 1c                	ja     990 <printf+0x90>
+ 974:	ff 24 85 2c 0e 00 00 	jmp    *0xe2c(,%eax,4)
+ 97b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 980:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 983:	5b                   	pop    %ebx
+ 984:	5e                   	pop    %esi
+ 985:	5f                   	pop    %edi
+ 986:	5d                   	pop    %ebp
+ 987:	c3                   	ret
+ 988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+  write(fd, &c, 1);
+ 990:	83 ec 04             	sub    $0x4,%esp
+ 993:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 996:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 99a:	6a 01                	push   $0x1
+ 99c:	52                   	push   %edx
+ 99d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9a0:	57                   	push   %edi
+ 9a1:	e8 fd fd ff ff       	call   7a3 <write>
+ 9a6:	83 c4 0c             	add    $0xc,%esp
+ 9a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ac:	6a 01                	push   $0x1
+ 9ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9b1:	52                   	push   %edx
+ 9b2:	57                   	push   %edi
+ 9b3:	e8 eb fd ff ff       	call   7a3 <write>
+        putc(fd, c);
+ 9b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9bb:	31 d2                	xor    %edx,%edx
+ 9bd:	eb 8e                	jmp    94d <printf+0x4d>
+ 9bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9c3:	83 ec 0c             	sub    $0xc,%esp
+ 9c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9cb:	8b 13                	mov    (%ebx),%edx
+ 9cd:	6a 00                	push   $0x0
+ 9cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9d4:	e8 87 fe ff ff       	call   860 <printint>
+        ap++;
+ 9d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9df:	31 d2                	xor    %edx,%edx
+ 9e1:	e9 67 ff ff ff       	jmp    94d <printf+0x4d>
+ 9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9f5:	83 c0 04             	add    $0x4,%eax
+ 9f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9fb:	85 db                	test   %ebx,%ebx
+ 9fd:	0f 84 9d 00 00 00    	je     aa0 <printf+0x1a0>
+        while(*s != 0){
+ a03:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a06:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a08:	84 c0                	test   %al,%al
+ a0a:	0f 84 3d ff ff ff    	je     94d <printf+0x4d>
+ a10:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a13:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a16:	89 de                	mov    %ebx,%esi
+ a18:	89 d3                	mov    %edx,%ebx
+ a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a20:	83 ec 04             	sub    $0x4,%esp
+ a23:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a26:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a29:	6a 01                	push   $0x1
+ a2b:	53                   	push   %ebx
+ a2c:	57                   	push   %edi
+ a2d:	e8 71 fd ff ff       	call   7a3 <write>
+        while(*s != 0){
+ a32:	0f b6 06             	movzbl (%esi),%eax
+ a35:	83 c4 10             	add    $0x10,%esp
+ a38:	84 c0                	test   %al,%al
+ a3a:	75 e4                	jne    a20 <printf+0x120>
+      state = 0;
+ a3c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a3f:	31 d2                	xor    %edx,%edx
+ a41:	e9 07 ff ff ff       	jmp    94d <printf+0x4d>
+ a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a53:	83 ec 0c             	sub    $0xc,%esp
+ a56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a5b:	8b 13                	mov    (%ebx),%edx
+ a5d:	6a 01                	push   $0x1
+ a5f:	e9 6b ff ff ff       	jmp    9cf <printf+0xcf>
+ a64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a68:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a6b:	83 ec 04             	sub    $0x4,%esp
+ a6e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a71:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a73:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a76:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a79:	6a 01                	push   $0x1
+ a7b:	52                   	push   %edx
+ a7c:	57                   	push   %edi
+ a7d:	e8 21 fd ff ff       	call   7a3 <write>
+        ap++;
+ a82:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a85:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a88:	31 d2                	xor    %edx,%edx
+ a8a:	e9 be fe ff ff       	jmp    94d <printf+0x4d>
+ a8f:	90                   	nop
+  write(fd, &c, 1);
+ a90:	83 ec 04             	sub    $0x4,%esp
+ a93:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a96:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a99:	6a 01                	push   $0x1
+ a9b:	e9 11 ff ff ff       	jmp    9b1 <printf+0xb1>
+ aa0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ aa5:	bb 22 0e 00 00       	mov    $0xe22,%ebx
+ aaa:	e9 61 ff ff ff       	jmp    a10 <printf+0x110>
+ aaf:	90                   	nop
+
+00000ab0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ab0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ab1:	a1 1c 12 00 00       	mov    0x121c,%eax
+{
+ ab6:	89 e5                	mov    %esp,%ebp
+ ab8:	57                   	push   %edi
+ ab9:	56                   	push   %esi
+ aba:	53                   	push   %ebx
+ abb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ abe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ac8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ acc:	39 ca                	cmp    %ecx,%edx
+ ace:	73 30                	jae    b00 <free+0x50>
+ ad0:	39 c1                	cmp    %eax,%ecx
+ ad2:	72 04                	jb     ad8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ad4:	39 c2                	cmp    %eax,%edx
+ ad6:	72 f0                	jb     ac8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ad8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ adb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ ade:	39 f8                	cmp    %edi,%eax
+ ae0:	74 2e                	je     b10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ae2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ ae5:	8b 42 04             	mov    0x4(%edx),%eax
+ ae8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ aeb:	39 f1                	cmp    %esi,%ecx
+ aed:	74 38                	je     b27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ aef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ af1:	5b                   	pop    %ebx
+  freep = p;
+ af2:	89 15 1c 12 00 00    	mov    %edx,0x121c
+}
+ af8:	5e                   	pop    %esi
+ af9:	5f                   	pop    %edi
+ afa:	5d                   	pop    %ebp
+ afb:	c3                   	ret
+ afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b00:	39 c1                	cmp    %eax,%ecx
+ b02:	72 d0                	jb     ad4 <free+0x24>
+ b04:	eb c2                	jmp    ac8 <free+0x18>
+ b06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b10:	03 70 04             	add    0x4(%eax),%esi
+ b13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b16:	8b 02                	mov    (%edx),%eax
+ b18:	8b 00                	mov    (%eax),%eax
+ b1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b1d:	8b 42 04             	mov    0x4(%edx),%eax
+ b20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b23:	39 f1                	cmp    %esi,%ecx
+ b25:	75 c8                	jne    aef <free+0x3f>
+    p->s.size += bp->s.size;
+ b27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b2a:	89 15 1c 12 00 00    	mov    %edx,0x121c
+    p->s.size += bp->s.size;
+ b30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b36:	89 0a                	mov    %ecx,(%edx)
+}
+ b38:	5b                   	pop    %ebx
+ b39:	5e                   	pop    %esi
+ b3a:	5f                   	pop    %edi
+ b3b:	5d                   	pop    %ebp
+ b3c:	c3                   	ret
+ b3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	57                   	push   %edi
+ b44:	56                   	push   %esi
+ b45:	53                   	push   %ebx
+ b46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b4c:	8b 15 1c 12 00 00    	mov    0x121c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b52:	8d 78 07             	lea    0x7(%eax),%edi
+ b55:	c1 ef 03             	shr    $0x3,%edi
+ b58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b5b:	85 d2                	test   %edx,%edx
+ b5d:	0f 84 8d 00 00 00    	je     bf0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b65:	8b 48 04             	mov    0x4(%eax),%ecx
+ b68:	39 f9                	cmp    %edi,%ecx
+ b6a:	73 64                	jae    bd0 <malloc+0x90>
+  if(nu < 4096)
+ b6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b71:	39 df                	cmp    %ebx,%edi
+ b73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b7d:	eb 0a                	jmp    b89 <malloc+0x49>
+ b7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b82:	8b 48 04             	mov    0x4(%eax),%ecx
+ b85:	39 f9                	cmp    %edi,%ecx
+ b87:	73 47                	jae    bd0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b89:	89 c2                	mov    %eax,%edx
+ b8b:	39 05 1c 12 00 00    	cmp    %eax,0x121c
+ b91:	75 ed                	jne    b80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b93:	83 ec 0c             	sub    $0xc,%esp
+ b96:	56                   	push   %esi
+ b97:	e8 6f fc ff ff       	call   80b <sbrk>
+  if(p == (char*)-1)
+ b9c:	83 c4 10             	add    $0x10,%esp
+ b9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ba2:	74 1c                	je     bc0 <malloc+0x80>
+  hp->s.size = nu;
+ ba4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ba7:	83 ec 0c             	sub    $0xc,%esp
+ baa:	83 c0 08             	add    $0x8,%eax
+ bad:	50                   	push   %eax
+ bae:	e8 fd fe ff ff       	call   ab0 <free>
+  return freep;
+ bb3:	8b 15 1c 12 00 00    	mov    0x121c,%edx
+      if((p = morecore(nunits)) == 0)
+ bb9:	83 c4 10             	add    $0x10,%esp
+ bbc:	85 d2                	test   %edx,%edx
+ bbe:	75 c0                	jne    b80 <malloc+0x40>
+        return 0;
+  }
+}
+ bc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ bc3:	31 c0                	xor    %eax,%eax
+}
+ bc5:	5b                   	pop    %ebx
+ bc6:	5e                   	pop    %esi
+ bc7:	5f                   	pop    %edi
+ bc8:	5d                   	pop    %ebp
+ bc9:	c3                   	ret
+ bca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ bd0:	39 cf                	cmp    %ecx,%edi
+ bd2:	74 4c                	je     c20 <malloc+0xe0>
+        p->s.size -= nunits;
+ bd4:	29 f9                	sub    %edi,%ecx
+ bd6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ bd9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ bdc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ bdf:	89 15 1c 12 00 00    	mov    %edx,0x121c
+}
+ be5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ be8:	83 c0 08             	add    $0x8,%eax
+}
+ beb:	5b                   	pop    %ebx
+ bec:	5e                   	pop    %esi
+ bed:	5f                   	pop    %edi
+ bee:	5d                   	pop    %ebp
+ bef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ bf0:	c7 05 1c 12 00 00 20 	movl   $0x1220,0x121c
+ bf7:	12 00 00 
+    base.s.size = 0;
+ bfa:	b8 20 12 00 00       	mov    $0x1220,%eax
+    base.s.ptr = freep = prevp = &base;
+ bff:	c7 05 20 12 00 00 20 	movl   $0x1220,0x1220
+ c06:	12 00 00 
+    base.s.size = 0;
+ c09:	c7 05 24 12 00 00 00 	movl   $0x0,0x1224
+ c10:	00 00 00 
+    if(p->s.size >= nunits){
+ c13:	e9 54 ff ff ff       	jmp    b6c <malloc+0x2c>
+ c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c20:	8b 08                	mov    (%eax),%ecx
+ c22:	89 0a                	mov    %ecx,(%edx)
+ c24:	eb b9                	jmp    bdf <malloc+0x9f>
@@ -0,0 +1,180 @@
+// Scheduler benchmarks.
+// pingpong: pairs of processes bounce a byte through two pipes,
+// so every round trip costs two sleeps, two wakeups and two
+// context switches.  Run with different CPUS= settings to see
+// how context-switch throughput scales with the number of CPUs.
+// fork: workers repeatedly fork CPU-bound children and wait for
+// them; the makespan shows how well idle CPUs pick up work
+// (compare kernels built with WORKSTEAL 0 and 1, CPUS=4).
+// switch: a single pair bounces the byte, and the cost of one
+// context switch is reported.  With CPUS=2 each process tends to
+// keep a CPU to itself, sleeping and waking there without another
+// address space in between, so the kernel need not load %cr3 and
+// the TLB survives; with CPUS=1 every switch changes address space.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NPAIRS   4
+#define NROUNDS  2000
+#define NSWITCH  20000
+#define NWORKERS 4
+#define NJOBS    8
+#define SPIN     2000000
+
+void
+pingpong(int rounds)
+{
+  int ab[2], ba[2], i, pid;
+  char c;
+
+  if(pipe(ab) < 0 || pipe(ba) < 0){
+    printf(1, "schedbench: pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "schedbench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < rounds; i++){
+      if(read(ab[0], &c, 1) != 1)
+        break;
+      write(ba[1], &c, 1);
+    }
+    exit();
+  }
+  c = 'x';
+  for(i = 0; i < rounds; i++){
+    write(ab[1], &c, 1);
+    if(read(ba[0], &c, 1) != 1)
+      break;
+  }
+  wait();
+  exit();
+}
+
+// Burn CPU without making system calls.
+int
+spin(int n)
+{
+  volatile int i, x;
+
+  x = 0;
+  for(i = 0; i < n; i++)
+    x += i;
+  return x;
+}
+
+// One worker of the fork benchmark: jobs rounds of forking a
+// short-lived CPU-bound child, with a burst of its own work in
+// between so that workers drift out of lock step.
+void
+forker(int jobs, int id)
+{
+  int i;
+
+  for(i = 0; i < jobs; i++){
+    if(fork() == 0){
+      spin(SPIN);
+      exit();
+    }
+    spin(SPIN / (id + 2));
+    wait();
+  }
+  exit();
+}
+
+int
+runpingpong(int pairs, int rounds)
+{
+  int i, t0, t1;
+
+  printf(1, "schedbench: %d pairs x %d round trips\n", pairs, rounds);
+  t0 = uptime();
+  for(i = 0; i < pairs; i++){
+    if(fork() == 0)
+      pingpong(rounds);
+  }
+  for(i = 0; i < pairs; i++)
+    wait();
+  t1 = uptime();
+
+  if(t1 == t0)
+    t1 = t0 + 1;
+  printf(1, "schedbench: %d switches in %d ticks, %d switches/tick\n",
+         2*pairs*rounds, t1 - t0, 2*pairs*rounds / (t1 - t0));
+  return 0;
+}
+
+int
+runswitch(int rounds)
+{
+  int t0, t1, us10;
+
+  printf(1, "schedbench: 1 pair x %d round trips\n", rounds);
+  t0 = uptime();
+  if(fork() == 0)
+    pingpong(rounds);
+  wait();
+  t1 = uptime();
+
+  if(t1 == t0)
+    t1 = t0 + 1;
+  // 100 ticks a second, so a tick is 10000 us.
+  us10 = (t1 - t0) * 100000 / (2*rounds);
+  printf(1, "schedbench: %d switches in %d ticks, %d.%d us per switch\n",
+         2*rounds, t1 - t0, us10 / 10, us10 % 10);
+  return 0;
+}
+
+int
+runfork(int workers, int jobs)
+{
+  int i, t0, t1;
+
+  printf(1, "schedbench: %d workers x %d forked jobs\n", workers, jobs);
+  t0 = uptime();
+  for(i = 0; i < workers; i++){
+    if(fork() == 0)
+      forker(jobs, i);
+  }
+  for(i = 0; i < workers; i++)
+    wait();
+  t1 = uptime();
+  printf(1, "schedbench: makespan %d ticks\n", t1 - t0);
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int a, b;
+
+  if(argc < 2){
+    printf(2, "usage: schedbench pingpong [pairs] [rounds]\n");
+    printf(2, "       schedbench fork [workers] [jobs]\n");
+    printf(2, "       schedbench switch [rounds]\n");
+    exit();
+  }
+  if(strcmp(argv[1], "pingpong") == 0){
+    a = argc > 2 ? atoi(argv[2]) : NPAIRS;
+    b = argc > 3 ? atoi(argv[3]) : NROUNDS;
+    if(a > 0 && b > 0)
+      runpingpong(a, b);
+  } else if(strcmp(argv[1], "fork") == 0){
+    a = argc > 2 ? atoi(argv[2]) : NWORKERS;
+    b = argc > 3 ? atoi(argv[3]) : NJOBS;
+    if(a > 0 && b > 0)
+      runfork(a, b);
+  } else if(strcmp(argv[1], "switch") == 0){
+    a = argc > 2 ? atoi(argv[2]) : NSWITCH;
+    if(a > 0)
+      runswitch(a);
+  } else {
+    printf(2, "schedbench: unknown benchmark %s\n", argv[1]);
+  }
+  exit();
+}
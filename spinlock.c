@@ -6,8 +6,8 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 
 void
 initlock(struct spinlock *lk, char *name)
@@ -24,13 +24,18 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint spins;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
   // The xchg is atomic.
+  spins = 0;
   while(xchg(&lk->locked, 1) != 0)
-    ;
+    spins++;
+  if(spins)
+    cpu->stat[ST_SPIN] += spins;  // interrupts are off: no statinc()
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -2,6 +2,10 @@
 #define T_FILE 2   // File
 #define T_DEV  3   // Device
 
+// Major device numbers.
+#define CONSOLE 1
+#define STATS   2  // event counters; see stats.c
+
 struct stat {
   short type;  // Type of file
   int dev;     // File system's disk device
@@ -0,0 +1,101 @@
+// Event counters.
+//
+// Each CPU counts events of interest in its struct cpu (see
+// enum cpustat in proc.h), so counting takes no lock.  The
+// counters are cache-line aligned, and so is struct cpu, so CPUs
+// don't fight over the lines holding them.  Reading the device STATS
+// (/dev/stats, made by init) returns a table of them as text:
+// a line naming the counters, then a line per CPU.  vmstat
+// prints it, or how it changes over time.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "stat.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "proc.h"
+#include "fs.h"
+#include "file.h"
+
+static char *statname[NSTAT] = {
+[ST_CSWITCH]  "cswitch",
+[ST_PGFAULT]  "pgfault",
+[ST_BHIT]     "bhit",
+[ST_BMISS]    "bmiss",
+[ST_COMMIT]   "commit",
+[ST_IDERW]    "iderw",
+[ST_SPIN]     "spin",
+};
+
+// Count an event on this CPU.
+void
+statinc(int i)
+{
+  pushcli();
+  cpu->stat[i]++;
+  popcli();
+}
+
+// Append s to the text at p; return the new end.
+static char*
+putstr(char *p, char *s)
+{
+  while(*s)
+    *p++ = *s++;
+  return p;
+}
+
+static char*
+putuint(char *p, uint x)
+{
+  char digits[10];
+  int i;
+
+  i = 0;
+  do {
+    digits[i++] = '0' + x % 10;
+  } while((x /= 10) != 0);
+  while(--i >= 0)
+    *p++ = digits[i];
+  return p;
+}
+
+// Up to 10 digits and a separator for each field.
+#define STATLINE ((NSTAT+1)*11)
+
+static int
+statsread(struct inode *ip, char *dst, uint off, int n)
+{
+  char buf[(NCPU+1)*STATLINE], *p;
+  int c, i;
+
+  p = putstr(buf, "cpu");
+  for(i = 0; i < NSTAT; i++){
+    *p++ = '\t';
+    p = putstr(p, statname[i]);
+  }
+  *p++ = '\n';
+  for(c = 0; c < ncpu; c++){
+    p = putuint(p, c);
+    for(i = 0; i < NSTAT; i++){
+      *p++ = '\t';
+      p = putuint(p, cpus[c].stat[i]);
+    }
+    *p++ = '\n';
+  }
+
+  if(off >= p - buf)
+    return 0;
+  if(n > p - buf - off)
+    n = p - buf - off;
+  memmove(dst, buf + off, n);
+  return n;
+}
+
+void
+statsinit(void)
+{
+  devsw[STATS].read = statsread;
+}
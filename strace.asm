@@ -0,0 +1,2310 @@
+
+_strace:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+// (run), so traced workloads don't disturb each other.
+// With -c, strace prints latency statistics instead of calls:
+// those of a command it runs, of process pid or of the system.
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 44             	sub    $0x44,%esp
+      14:	8b 31                	mov    (%ecx),%esi
+      16:	8b 41 04             	mov    0x4(%ecx),%eax
+      19:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+      1c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  uint64 mask;
+  int i, pid, when, count;
+
+  // Don't trace strace itself.
+  trace(0);
+      1f:	6a 00                	push   $0x0
+      21:	e8 ed 0d 00 00       	call   e13 <trace>
+
+  mask = TRACE_ALL;
+      26:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  when = TRACE_ANY;
+  pid = -1;
+  count = 0;
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+      2d:	83 c4 10             	add    $0x10,%esp
+  mask = TRACE_ALL;
+      30:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+      37:	83 fe 01             	cmp    $0x1,%esi
+      3a:	0f 8e a5 02 00 00    	jle    2e5 <main+0x2e5>
+  count = 0;
+      40:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+      47:	bf 01 00 00 00       	mov    $0x1,%edi
+  when = TRACE_ANY;
+      4c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  pid = -1;
+      53:	c7 45 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebp)
+      5a:	eb 13                	jmp    6f <main+0x6f>
+      5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(strcmp(argv[i], "-s") == 0)
+      when = TRACE_OK;
+      60:	c7 45 cc 01 00 00 00 	movl   $0x1,-0x34(%ebp)
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+      67:	83 c7 01             	add    $0x1,%edi
+      6a:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+      6d:	7e 51                	jle    c0 <main+0xc0>
+      6f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+      72:	8d 34 bd 00 00 00 00 	lea    0x0(,%edi,4),%esi
+      79:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+      7c:	8b 03                	mov    (%ebx),%eax
+      7e:	80 38 2d             	cmpb   $0x2d,(%eax)
+      81:	75 3d                	jne    c0 <main+0xc0>
+    if(strcmp(argv[i], "-s") == 0)
+      83:	83 ec 08             	sub    $0x8,%esp
+      86:	68 89 12 00 00       	push   $0x1289
+      8b:	50                   	push   %eax
+      8c:	e8 cf 0a 00 00       	call   b60 <strcmp>
+      91:	83 c4 10             	add    $0x10,%esp
+      94:	85 c0                	test   %eax,%eax
+      96:	74 c8                	je     60 <main+0x60>
+    else if(strcmp(argv[i], "-f") == 0)
+      98:	83 ec 08             	sub    $0x8,%esp
+      9b:	68 8c 12 00 00       	push   $0x128c
+      a0:	ff 33                	push   (%ebx)
+      a2:	e8 b9 0a 00 00       	call   b60 <strcmp>
+      a7:	83 c4 10             	add    $0x10,%esp
+      aa:	85 c0                	test   %eax,%eax
+      ac:	75 42                	jne    f0 <main+0xf0>
+      when = TRACE_FAIL;
+      ae:	c7 45 cc 02 00 00 00 	movl   $0x2,-0x34(%ebp)
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+      b5:	83 c7 01             	add    $0x1,%edi
+      b8:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+      bb:	7f b2                	jg     6f <main+0x6f>
+      bd:	8d 76 00             	lea    0x0(%esi),%esi
+      pid = atoi(argv[++i]);
+    else
+      usage();
+  }
+
+  if(count && i == argc){
+      c0:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+      c3:	8b 55 c8             	mov    -0x38(%ebp),%edx
+      c6:	0f 94 c0             	sete   %al
+      c9:	89 c6                	mov    %eax,%esi
+      cb:	85 d2                	test   %edx,%edx
+      cd:	0f 84 a2 00 00 00    	je     175 <main+0x175>
+      d3:	84 c0                	test   %al,%al
+      d5:	74 7f                	je     156 <main+0x156>
+    summary(pid);
+      d7:	83 ec 0c             	sub    $0xc,%esp
+      da:	ff 75 c4             	push   -0x3c(%ebp)
+      dd:	e8 6e 06 00 00       	call   750 <summary>
+      e2:	83 c4 10             	add    $0x10,%esp
+        exit();
+      e5:	e8 89 0c 00 00       	call   d73 <exit>
+      ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    else if(strcmp(argv[i], "-c") == 0)
+      f0:	83 ec 08             	sub    $0x8,%esp
+      f3:	68 8f 12 00 00       	push   $0x128f
+      f8:	ff 33                	push   (%ebx)
+      fa:	e8 61 0a 00 00       	call   b60 <strcmp>
+      ff:	83 c4 10             	add    $0x10,%esp
+     102:	85 c0                	test   %eax,%eax
+     104:	75 12                	jne    118 <main+0x118>
+      count = 1;
+     106:	c7 45 c8 01 00 00 00 	movl   $0x1,-0x38(%ebp)
+     10d:	e9 55 ff ff ff       	jmp    67 <main+0x67>
+     112:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    else if(strcmp(argv[i], "-e") == 0 && i + 1 < argc){
+     118:	83 ec 08             	sub    $0x8,%esp
+     11b:	68 92 12 00 00       	push   $0x1292
+     120:	ff 33                	push   (%ebx)
+     122:	e8 39 0a 00 00       	call   b60 <strcmp>
+     127:	83 c4 10             	add    $0x10,%esp
+     12a:	85 c0                	test   %eax,%eax
+     12c:	0f 85 45 01 00 00    	jne    277 <main+0x277>
+     132:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     135:	83 c7 01             	add    $0x1,%edi
+     138:	39 c7                	cmp    %eax,%edi
+     13a:	0f 8c 78 01 00 00    	jl     2b8 <main+0x2b8>
+    } else if(strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+     140:	50                   	push   %eax
+     141:	50                   	push   %eax
+     142:	68 95 12 00 00       	push   $0x1295
+     147:	ff 33                	push   (%ebx)
+     149:	e8 12 0a 00 00       	call   b60 <strcmp>
+     14e:	83 c4 10             	add    $0x10,%esp
+      usage();
+     151:	e8 8a 04 00 00       	call   5e0 <usage>
+  } else if(count && strcmp(argv[i], "run") != 0){
+     156:	83 7d c8 00          	cmpl   $0x0,-0x38(%ebp)
+     15a:	74 19                	je     175 <main+0x175>
+     15c:	50                   	push   %eax
+     15d:	50                   	push   %eax
+     15e:	68 98 12 00 00       	push   $0x1298
+     163:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     166:	ff 34 b8             	push   (%eax,%edi,4)
+     169:	e8 f2 09 00 00       	call   b60 <strcmp>
+     16e:	83 c4 10             	add    $0x10,%esp
+     171:	85 c0                	test   %eax,%eax
+     173:	75 dc                	jne    151 <main+0x151>
+    usage();
+  } else if(i == argc || strcmp(argv[i], "on") == 0){
+     175:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+     178:	75 40                	jne    1ba <main+0x1ba>
+    if(pid == -1 && i == argc)
+     17a:	83 7d c4 ff          	cmpl   $0xffffffff,-0x3c(%ebp)
+     17e:	75 06                	jne    186 <main+0x186>
+     180:	89 f0                	mov    %esi,%eax
+     182:	84 c0                	test   %al,%al
+     184:	75 cb                	jne    151 <main+0x151>
+      usage();
+    if(settrace(pid, (uint)mask, (uint)(mask >> 32), when) < 0)
+     186:	ff 75 cc             	push   -0x34(%ebp)
+     189:	ff 75 e4             	push   -0x1c(%ebp)
+     18c:	ff 75 e0             	push   -0x20(%ebp)
+      printf(2, "strace: no process %d\n", pid);
+  } else if(strcmp(argv[i], "off") == 0){
+    if(settrace(pid, 0, 0, TRACE_ANY) < 0)
+     18f:	ff 75 c4             	push   -0x3c(%ebp)
+     192:	e8 a4 0c 00 00       	call   e3b <settrace>
+     197:	83 c4 10             	add    $0x10,%esp
+     19a:	85 c0                	test   %eax,%eax
+     19c:	0f 89 43 ff ff ff    	jns    e5 <main+0xe5>
+      printf(2, "strace: no process %d\n", pid);
+     1a2:	50                   	push   %eax
+     1a3:	ff 75 c4             	push   -0x3c(%ebp)
+     1a6:	68 59 12 00 00       	push   $0x1259
+     1ab:	6a 02                	push   $0x2
+     1ad:	e8 3e 0d 00 00       	call   ef0 <printf>
+     1b2:	83 c4 10             	add    $0x10,%esp
+     1b5:	e9 2b ff ff ff       	jmp    e5 <main+0xe5>
+  } else if(i == argc || strcmp(argv[i], "on") == 0){
+     1ba:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     1bd:	8d 04 bd 00 00 00 00 	lea    0x0(,%edi,4),%eax
+     1c4:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     1c7:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+     1ca:	50                   	push   %eax
+     1cb:	50                   	push   %eax
+     1cc:	68 9c 12 00 00       	push   $0x129c
+     1d1:	ff 33                	push   (%ebx)
+     1d3:	e8 88 09 00 00       	call   b60 <strcmp>
+     1d8:	83 c4 10             	add    $0x10,%esp
+     1db:	85 c0                	test   %eax,%eax
+     1dd:	74 9b                	je     17a <main+0x17a>
+  } else if(strcmp(argv[i], "off") == 0){
+     1df:	50                   	push   %eax
+     1e0:	50                   	push   %eax
+     1e1:	68 9f 12 00 00       	push   $0x129f
+     1e6:	ff 33                	push   (%ebx)
+     1e8:	e8 73 09 00 00       	call   b60 <strcmp>
+     1ed:	83 c4 10             	add    $0x10,%esp
+     1f0:	85 c0                	test   %eax,%eax
+     1f2:	0f 84 e2 00 00 00    	je     2da <main+0x2da>
+  } else if(strcmp(argv[i], "run") == 0){
+     1f8:	50                   	push   %eax
+     1f9:	50                   	push   %eax
+     1fa:	68 98 12 00 00       	push   $0x1298
+     1ff:	ff 33                	push   (%ebx)
+     201:	e8 5a 09 00 00       	call   b60 <strcmp>
+     206:	83 c4 10             	add    $0x10,%esp
+     209:	85 c0                	test   %eax,%eax
+     20b:	0f 85 f2 00 00 00    	jne    303 <main+0x303>
+    if(i + 1 >= argc)
+     211:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     214:	8d 57 01             	lea    0x1(%edi),%edx
+     217:	39 c2                	cmp    %eax,%edx
+     219:	0f 8d 32 ff ff ff    	jge    151 <main+0x151>
+      usage();
+    pid = fork();
+     21f:	e8 47 0b 00 00       	call   d6b <fork>
+    if(pid < 0){
+     224:	85 c0                	test   %eax,%eax
+     226:	0f 88 17 01 00 00    	js     343 <main+0x343>
+      printf(2, "strace: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+     22c:	0f 85 f4 00 00 00    	jne    326 <main+0x326>
+      settrace(0, (uint)mask, (uint)(mask >> 32), count ? TRACE_COUNT : when);
+     232:	83 7d c8 00          	cmpl   $0x0,-0x38(%ebp)
+     236:	b8 03 00 00 00       	mov    $0x3,%eax
+     23b:	0f 44 45 cc          	cmove  -0x34(%ebp),%eax
+     23f:	50                   	push   %eax
+     240:	ff 75 e4             	push   -0x1c(%ebp)
+     243:	ff 75 e0             	push   -0x20(%ebp)
+     246:	6a 00                	push   $0x0
+     248:	e8 ee 0b 00 00       	call   e3b <settrace>
+      exec(argv[i + 1], &argv[i + 1]);
+     24d:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     250:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     253:	59                   	pop    %ecx
+     254:	5e                   	pop    %esi
+     255:	8d 5c 10 04          	lea    0x4(%eax,%edx,1),%ebx
+     259:	53                   	push   %ebx
+     25a:	ff 33                	push   (%ebx)
+     25c:	e8 4a 0b 00 00       	call   dab <exec>
+      printf(2, "strace: exec %s failed\n", argv[i + 1]);
+     261:	83 c4 0c             	add    $0xc,%esp
+     264:	ff 33                	push   (%ebx)
+     266:	68 b8 12 00 00       	push   $0x12b8
+     26b:	6a 02                	push   $0x2
+     26d:	e8 7e 0c 00 00       	call   ef0 <printf>
+      exit();
+     272:	e8 fc 0a 00 00       	call   d73 <exit>
+    } else if(strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+     277:	51                   	push   %ecx
+     278:	51                   	push   %ecx
+     279:	68 95 12 00 00       	push   $0x1295
+     27e:	ff 33                	push   (%ebx)
+     280:	e8 db 08 00 00       	call   b60 <strcmp>
+     285:	83 c4 10             	add    $0x10,%esp
+     288:	85 c0                	test   %eax,%eax
+     28a:	0f 85 c1 fe ff ff    	jne    151 <main+0x151>
+     290:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     293:	83 c7 01             	add    $0x1,%edi
+     296:	39 c7                	cmp    %eax,%edi
+     298:	0f 8d b3 fe ff ff    	jge    151 <main+0x151>
+      pid = atoi(argv[++i]);
+     29e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     2a1:	83 ec 0c             	sub    $0xc,%esp
+     2a4:	ff 74 30 04          	push   0x4(%eax,%esi,1)
+     2a8:	e8 53 0a 00 00       	call   d00 <atoi>
+     2ad:	83 c4 10             	add    $0x10,%esp
+     2b0:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     2b3:	e9 af fd ff ff       	jmp    67 <main+0x67>
+      if(setcalls(argv[++i], &mask) < 0)
+     2b8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     2bb:	53                   	push   %ebx
+     2bc:	53                   	push   %ebx
+     2bd:	50                   	push   %eax
+     2be:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     2c1:	ff 74 30 04          	push   0x4(%eax,%esi,1)
+     2c5:	e8 86 01 00 00       	call   450 <setcalls>
+     2ca:	83 c4 10             	add    $0x10,%esp
+     2cd:	85 c0                	test   %eax,%eax
+     2cf:	0f 89 92 fd ff ff    	jns    67 <main+0x67>
+     2d5:	e9 0b fe ff ff       	jmp    e5 <main+0xe5>
+    if(settrace(pid, 0, 0, TRACE_ANY) < 0)
+     2da:	6a 00                	push   $0x0
+     2dc:	6a 00                	push   $0x0
+     2de:	6a 00                	push   $0x0
+     2e0:	e9 aa fe ff ff       	jmp    18f <main+0x18f>
+  if(count && i == argc){
+     2e5:	0f 94 c0             	sete   %al
+  count = 0;
+     2e8:	31 ff                	xor    %edi,%edi
+  pid = -1;
+     2ea:	c7 45 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebp)
+  count = 0;
+     2f1:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  if(count && i == argc){
+     2f4:	89 c6                	mov    %eax,%esi
+  count = 0;
+     2f6:	89 7d c8             	mov    %edi,-0x38(%ebp)
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+     2f9:	bf 01 00 00 00       	mov    $0x1,%edi
+     2fe:	e9 72 fe ff ff       	jmp    175 <main+0x175>
+    wait();
+    if(count)
+      summary(0);
+    else
+      dump();
+  } else if(strcmp(argv[i], "dump") == 0){
+     303:	52                   	push   %edx
+     304:	52                   	push   %edx
+     305:	68 d0 12 00 00       	push   $0x12d0
+     30a:	ff 33                	push   (%ebx)
+     30c:	e8 4f 08 00 00       	call   b60 <strcmp>
+     311:	83 c4 10             	add    $0x10,%esp
+     314:	85 c0                	test   %eax,%eax
+     316:	0f 85 35 fe ff ff    	jne    151 <main+0x151>
+      dump();
+     31c:	e8 5f 02 00 00       	call   580 <dump>
+     321:	e9 bf fd ff ff       	jmp    e5 <main+0xe5>
+    wait();
+     326:	e8 50 0a 00 00       	call   d7b <wait>
+    if(count)
+     32b:	83 7d c8 00          	cmpl   $0x0,-0x38(%ebp)
+     32f:	74 eb                	je     31c <main+0x31c>
+      summary(0);
+     331:	83 ec 0c             	sub    $0xc,%esp
+     334:	6a 00                	push   $0x0
+     336:	e8 15 04 00 00       	call   750 <summary>
+     33b:	83 c4 10             	add    $0x10,%esp
+     33e:	e9 a2 fd ff ff       	jmp    e5 <main+0xe5>
+      printf(2, "strace: fork failed\n");
+     343:	57                   	push   %edi
+     344:	57                   	push   %edi
+     345:	68 a3 12 00 00       	push   $0x12a3
+     34a:	6a 02                	push   $0x2
+     34c:	e8 9f 0b 00 00       	call   ef0 <printf>
+      exit();
+     351:	e8 1d 0a 00 00       	call   d73 <exit>
+     356:	66 90                	xchg   %ax,%ax
+     358:	66 90                	xchg   %ax,%ax
+     35a:	66 90                	xchg   %ax,%ax
+     35c:	66 90                	xchg   %ax,%ax
+     35e:	66 90                	xchg   %ax,%ax
+
+00000360 <printev>:
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	56                   	push   %esi
+     364:	53                   	push   %ebx
+     365:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(e->flags & TRACE_LOST){
+     368:	0f b7 48 0e          	movzwl 0xe(%eax),%ecx
+     36c:	f6 c1 02             	test   $0x2,%cl
+     36f:	75 6f                	jne    3e0 <printev+0x80>
+  if(e->num > 0 && e->num < NSYSCALL && syscall_name[e->num])
+     371:	0f bf 58 0c          	movswl 0xc(%eax),%ebx
+  name = "?";
+     375:	ba 20 12 00 00       	mov    $0x1220,%edx
+  if(e->num > 0 && e->num < NSYSCALL && syscall_name[e->num])
+     37a:	8d 73 ff             	lea    -0x1(%ebx),%esi
+     37d:	66 83 fe 20          	cmp    $0x20,%si
+     381:	77 11                	ja     394 <printev+0x34>
+     383:	8b 14 9d e0 14 00 00 	mov    0x14e0(,%ebx,4),%edx
+  name = "?";
+     38a:	bb 20 12 00 00       	mov    $0x1220,%ebx
+     38f:	85 d2                	test   %edx,%edx
+     391:	0f 44 d3             	cmove  %ebx,%edx
+  if(e->flags & TRACE_RET)
+     394:	83 e1 01             	and    $0x1,%ecx
+    printf(1, "TRACE: pid = %d | command name = %s | syscall = %s | return value = %d\n",
+     397:	8b 58 08             	mov    0x8(%eax),%ebx
+           e->pid, e->name, name, e->ret);
+     39a:	8d 70 14             	lea    0x14(%eax),%esi
+  if(e->flags & TRACE_RET)
+     39d:	75 21                	jne    3c0 <printev+0x60>
+    printf(1, "TRACE: pid = %d | command name = %s | syscall = %s\n",
+     39f:	83 ec 0c             	sub    $0xc,%esp
+     3a2:	52                   	push   %edx
+     3a3:	56                   	push   %esi
+     3a4:	53                   	push   %ebx
+     3a5:	68 cc 13 00 00       	push   $0x13cc
+     3aa:	6a 01                	push   $0x1
+     3ac:	e8 3f 0b 00 00       	call   ef0 <printf>
+     3b1:	83 c4 20             	add    $0x20,%esp
+}
+     3b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3b7:	5b                   	pop    %ebx
+     3b8:	5e                   	pop    %esi
+     3b9:	5d                   	pop    %ebp
+     3ba:	c3                   	ret
+     3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3bf:	90                   	nop
+    printf(1, "TRACE: pid = %d | command name = %s | syscall = %s | return value = %d\n",
+     3c0:	83 ec 08             	sub    $0x8,%esp
+     3c3:	ff 70 10             	push   0x10(%eax)
+     3c6:	52                   	push   %edx
+     3c7:	56                   	push   %esi
+     3c8:	53                   	push   %ebx
+     3c9:	68 84 13 00 00       	push   $0x1384
+     3ce:	6a 01                	push   $0x1
+     3d0:	e8 1b 0b 00 00       	call   ef0 <printf>
+     3d5:	83 c4 20             	add    $0x20,%esp
+}
+     3d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3db:	5b                   	pop    %ebx
+     3dc:	5e                   	pop    %esi
+     3dd:	5d                   	pop    %ebp
+     3de:	c3                   	ret
+     3df:	90                   	nop
+    printf(1, "TRACE: %d events lost\n", e->ret);
+     3e0:	83 ec 04             	sub    $0x4,%esp
+     3e3:	ff 70 10             	push   0x10(%eax)
+     3e6:	68 22 12 00 00       	push   $0x1222
+     3eb:	6a 01                	push   $0x1
+     3ed:	e8 fe 0a 00 00       	call   ef0 <printf>
+    return;
+     3f2:	83 c4 10             	add    $0x10,%esp
+}
+     3f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3f8:	5b                   	pop    %ebx
+     3f9:	5e                   	pop    %esi
+     3fa:	5d                   	pop    %ebp
+     3fb:	c3                   	ret
+     3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <callnum>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	56                   	push   %esi
+     404:	53                   	push   %ebx
+  for(j = 1; j < NSYSCALL; j++)
+     405:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+     40a:	8b 75 08             	mov    0x8(%ebp),%esi
+     40d:	eb 09                	jmp    418 <callnum+0x18>
+     40f:	90                   	nop
+  for(j = 1; j < NSYSCALL; j++)
+     410:	83 c3 01             	add    $0x1,%ebx
+     413:	83 fb 22             	cmp    $0x22,%ebx
+     416:	74 28                	je     440 <callnum+0x40>
+    if(syscall_name[j] && strcmp(name, syscall_name[j]) == 0)
+     418:	8b 04 9d e0 14 00 00 	mov    0x14e0(,%ebx,4),%eax
+     41f:	85 c0                	test   %eax,%eax
+     421:	74 ed                	je     410 <callnum+0x10>
+     423:	83 ec 08             	sub    $0x8,%esp
+     426:	50                   	push   %eax
+     427:	56                   	push   %esi
+     428:	e8 33 07 00 00       	call   b60 <strcmp>
+     42d:	83 c4 10             	add    $0x10,%esp
+     430:	85 c0                	test   %eax,%eax
+     432:	75 dc                	jne    410 <callnum+0x10>
+}
+     434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     437:	89 d8                	mov    %ebx,%eax
+     439:	5b                   	pop    %ebx
+     43a:	5e                   	pop    %esi
+     43b:	5d                   	pop    %ebp
+     43c:	c3                   	ret
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+     440:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return -1;
+     443:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+     448:	89 d8                	mov    %ebx,%eax
+     44a:	5b                   	pop    %ebx
+     44b:	5e                   	pop    %esi
+     44c:	5d                   	pop    %ebp
+     44d:	c3                   	ret
+     44e:	66 90                	xchg   %ax,%ax
+
+00000450 <setcalls>:
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	57                   	push   %edi
+     454:	56                   	push   %esi
+     455:	53                   	push   %ebx
+     456:	83 ec 2c             	sub    $0x2c,%esp
+  *mask = 0;
+     459:	8b 45 0c             	mov    0xc(%ebp),%eax
+{
+     45c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  *mask = 0;
+     45f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+     465:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  while(*list){
+     46c:	0f b6 03             	movzbl (%ebx),%eax
+     46f:	84 c0                	test   %al,%al
+     471:	0f 84 cd 00 00 00    	je     544 <setcalls+0xf4>
+     477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47e:	66 90                	xchg   %ax,%ax
+    for(n = 0; list[n] && list[n] != ','; n++)
+     480:	31 f6                	xor    %esi,%esi
+     482:	3c 2c                	cmp    $0x2c,%al
+     484:	74 24                	je     4aa <setcalls+0x5a>
+     486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     48d:	8d 76 00             	lea    0x0(%esi),%esi
+     490:	83 c6 01             	add    $0x1,%esi
+     493:	0f b6 04 33          	movzbl (%ebx,%esi,1),%eax
+     497:	84 c0                	test   %al,%al
+     499:	74 04                	je     49f <setcalls+0x4f>
+     49b:	3c 2c                	cmp    $0x2c,%al
+     49d:	75 f1                	jne    490 <setcalls+0x40>
+      n = sizeof(name) - 1;
+     49f:	83 fe 20             	cmp    $0x20,%esi
+     4a2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     4a7:	0f 43 f0             	cmovae %eax,%esi
+    memmove(name, list, n);
+     4aa:	83 ec 04             	sub    $0x4,%esp
+     4ad:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  for(j = 1; j < NSYSCALL; j++)
+     4b0:	bf 01 00 00 00       	mov    $0x1,%edi
+    memmove(name, list, n);
+     4b5:	56                   	push   %esi
+     4b6:	53                   	push   %ebx
+     4b7:	50                   	push   %eax
+     4b8:	e8 83 08 00 00       	call   d40 <memmove>
+    name[n] = 0;
+     4bd:	c6 44 35 c8 00       	movb   $0x0,-0x38(%ebp,%esi,1)
+     4c2:	83 c4 10             	add    $0x10,%esp
+     4c5:	eb 11                	jmp    4d8 <setcalls+0x88>
+     4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ce:	66 90                	xchg   %ax,%ax
+  for(j = 1; j < NSYSCALL; j++)
+     4d0:	83 c7 01             	add    $0x1,%edi
+     4d3:	83 ff 22             	cmp    $0x22,%edi
+     4d6:	74 78                	je     550 <setcalls+0x100>
+    if(syscall_name[j] && strcmp(name, syscall_name[j]) == 0)
+     4d8:	8b 04 bd e0 14 00 00 	mov    0x14e0(,%edi,4),%eax
+     4df:	85 c0                	test   %eax,%eax
+     4e1:	74 ed                	je     4d0 <setcalls+0x80>
+     4e3:	83 ec 08             	sub    $0x8,%esp
+     4e6:	50                   	push   %eax
+     4e7:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     4ea:	50                   	push   %eax
+     4eb:	e8 70 06 00 00       	call   b60 <strcmp>
+     4f0:	83 c4 10             	add    $0x10,%esp
+     4f3:	85 c0                	test   %eax,%eax
+     4f5:	75 d9                	jne    4d0 <setcalls+0x80>
+    *mask |= TRACEBIT(num);
+     4f7:	89 f9                	mov    %edi,%ecx
+     4f9:	31 c0                	xor    %eax,%eax
+     4fb:	31 d2                	xor    %edx,%edx
+     4fd:	f6 c1 20             	test   $0x20,%cl
+     500:	0f 94 c0             	sete   %al
+     503:	0f 95 c2             	setne  %dl
+    list += n;
+     506:	01 f3                	add    %esi,%ebx
+    *mask |= TRACEBIT(num);
+     508:	d3 e0                	shl    %cl,%eax
+     50a:	d3 e2                	shl    %cl,%edx
+     50c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     50f:	09 01                	or     %eax,(%ecx)
+     511:	09 51 04             	or     %edx,0x4(%ecx)
+    while(*list && *list != ',')
+     514:	0f b6 03             	movzbl (%ebx),%eax
+     517:	3c 2c                	cmp    $0x2c,%al
+     519:	74 14                	je     52f <setcalls+0xdf>
+     51b:	84 c0                	test   %al,%al
+     51d:	74 10                	je     52f <setcalls+0xdf>
+     51f:	90                   	nop
+     520:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+      list++;
+     524:	83 c3 01             	add    $0x1,%ebx
+    while(*list && *list != ',')
+     527:	84 c0                	test   %al,%al
+     529:	74 04                	je     52f <setcalls+0xdf>
+     52b:	3c 2c                	cmp    $0x2c,%al
+     52d:	75 f1                	jne    520 <setcalls+0xd0>
+      list++;
+     52f:	3c 2c                	cmp    $0x2c,%al
+     531:	0f 94 c0             	sete   %al
+     534:	0f b6 c0             	movzbl %al,%eax
+     537:	01 c3                	add    %eax,%ebx
+  while(*list){
+     539:	0f b6 03             	movzbl (%ebx),%eax
+     53c:	84 c0                	test   %al,%al
+     53e:	0f 85 3c ff ff ff    	jne    480 <setcalls+0x30>
+}
+     544:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+     547:	31 c0                	xor    %eax,%eax
+}
+     549:	5b                   	pop    %ebx
+     54a:	5e                   	pop    %esi
+     54b:	5f                   	pop    %edi
+     54c:	5d                   	pop    %ebp
+     54d:	c3                   	ret
+     54e:	66 90                	xchg   %ax,%ax
+      printf(2, "Unknown syscall: %s\n", name);
+     550:	83 ec 04             	sub    $0x4,%esp
+     553:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     556:	50                   	push   %eax
+     557:	68 39 12 00 00       	push   $0x1239
+     55c:	6a 02                	push   $0x2
+     55e:	e8 8d 09 00 00       	call   ef0 <printf>
+      return -1;
+     563:	83 c4 10             	add    $0x10,%esp
+}
+     566:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+     569:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     56e:	5b                   	pop    %ebx
+     56f:	5e                   	pop    %esi
+     570:	5f                   	pop    %edi
+     571:	5d                   	pop    %ebp
+     572:	c3                   	ret
+     573:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000580 <dump>:
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	57                   	push   %edi
+     584:	56                   	push   %esi
+     585:	53                   	push   %ebx
+     586:	83 ec 0c             	sub    $0xc,%esp
+  while((n = tracedrain(ev, NEV)) > 0)
+     589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     590:	83 ec 08             	sub    $0x8,%esp
+     593:	6a 40                	push   $0x40
+     595:	68 e0 29 00 00       	push   $0x29e0
+     59a:	e8 94 08 00 00       	call   e33 <tracedrain>
+     59f:	83 c4 10             	add    $0x10,%esp
+     5a2:	89 c7                	mov    %eax,%edi
+     5a4:	85 c0                	test   %eax,%eax
+     5a6:	7e 28                	jle    5d0 <dump+0x50>
+     5a8:	be e0 29 00 00       	mov    $0x29e0,%esi
+    for(i = 0; i < n; i++)
+     5ad:	31 db                	xor    %ebx,%ebx
+     5af:	90                   	nop
+      printev(&ev[i]);
+     5b0:	83 ec 0c             	sub    $0xc,%esp
+    for(i = 0; i < n; i++)
+     5b3:	83 c3 01             	add    $0x1,%ebx
+      printev(&ev[i]);
+     5b6:	56                   	push   %esi
+    for(i = 0; i < n; i++)
+     5b7:	83 c6 24             	add    $0x24,%esi
+      printev(&ev[i]);
+     5ba:	e8 a1 fd ff ff       	call   360 <printev>
+    for(i = 0; i < n; i++)
+     5bf:	83 c4 10             	add    $0x10,%esp
+     5c2:	39 df                	cmp    %ebx,%edi
+     5c4:	75 ea                	jne    5b0 <dump+0x30>
+     5c6:	eb c8                	jmp    590 <dump+0x10>
+     5c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cf:	90                   	nop
+}
+     5d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5d3:	5b                   	pop    %ebx
+     5d4:	5e                   	pop    %esi
+     5d5:	5f                   	pop    %edi
+     5d6:	5d                   	pop    %ebp
+     5d7:	c3                   	ret
+     5d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5df:	90                   	nop
+
+000005e0 <usage>:
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	83 ec 10             	sub    $0x10,%esp
+  printf(2, "usage: strace [-e call,...] [-s|-f] [-p pid] [on|off]\n"
+     5e6:	68 00 14 00 00       	push   $0x1400
+     5eb:	6a 02                	push   $0x2
+     5ed:	e8 fe 08 00 00       	call   ef0 <printf>
+  exit();
+     5f2:	e8 7c 07 00 00       	call   d73 <exit>
+     5f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fe:	66 90                	xchg   %ax,%ax
+
+00000600 <printcycles>:
+{
+     600:	55                   	push   %ebp
+  if(c < (1 << 20))
+     601:	31 c9                	xor    %ecx,%ecx
+{
+     603:	89 e5                	mov    %esp,%ebp
+     605:	53                   	push   %ebx
+  if(c < (1 << 20))
+     606:	bb ff ff 0f 00       	mov    $0xfffff,%ebx
+{
+     60b:	83 ec 04             	sub    $0x4,%esp
+     60e:	8b 45 08             	mov    0x8(%ebp),%eax
+     611:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(c < (1 << 20))
+     614:	39 c3                	cmp    %eax,%ebx
+     616:	89 cb                	mov    %ecx,%ebx
+     618:	19 d3                	sbb    %edx,%ebx
+     61a:	73 4c                	jae    668 <printcycles+0x68>
+  else if(c < (1ULL << 30))
+     61c:	bb ff ff ff 3f       	mov    $0x3fffffff,%ebx
+     621:	39 c3                	cmp    %eax,%ebx
+     623:	19 d1                	sbb    %edx,%ecx
+     625:	73 21                	jae    648 <printcycles+0x48>
+    printf(1, "%dM", (uint)(c >> 20));
+     627:	83 ec 04             	sub    $0x4,%esp
+     62a:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+     62e:	50                   	push   %eax
+     62f:	68 55 12 00 00       	push   $0x1255
+     634:	6a 01                	push   $0x1
+     636:	e8 b5 08 00 00       	call   ef0 <printf>
+}
+     63b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "%dM", (uint)(c >> 20));
+     63e:	83 c4 10             	add    $0x10,%esp
+}
+     641:	c9                   	leave
+     642:	c3                   	ret
+     643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     647:	90                   	nop
+    printf(1, "%dK", (uint)(c >> 10));
+     648:	83 ec 04             	sub    $0x4,%esp
+     64b:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+     64f:	50                   	push   %eax
+     650:	68 51 12 00 00       	push   $0x1251
+     655:	6a 01                	push   $0x1
+     657:	e8 94 08 00 00       	call   ef0 <printf>
+}
+     65c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     65f:	83 c4 10             	add    $0x10,%esp
+     662:	c9                   	leave
+     663:	c3                   	ret
+     664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "%d", (uint)c);
+     668:	83 ec 04             	sub    $0x4,%esp
+     66b:	50                   	push   %eax
+     66c:	68 4e 12 00 00       	push   $0x124e
+     671:	6a 01                	push   $0x1
+     673:	e8 78 08 00 00       	call   ef0 <printf>
+}
+     678:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     67b:	83 c4 10             	add    $0x10,%esp
+     67e:	c9                   	leave
+     67f:	c3                   	ret
+
+00000680 <percentile>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	57                   	push   %edi
+     684:	56                   	push   %esi
+     685:	53                   	push   %ebx
+     686:	83 ec 14             	sub    $0x14,%esp
+  need = (uint64)s->count * pct;
+     689:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     68c:	8b 75 0c             	mov    0xc(%ebp),%esi
+    sum += s->hist[i];
+     68f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  need = (uint64)s->count * pct;
+     696:	89 c7                	mov    %eax,%edi
+     698:	8b 08                	mov    (%eax),%ecx
+     69a:	89 f0                	mov    %esi,%eax
+     69c:	89 f3                	mov    %esi,%ebx
+     69e:	f7 27                	mull   (%edi)
+     6a0:	c1 fb 1f             	sar    $0x1f,%ebx
+     6a3:	0f af cb             	imul   %ebx,%ecx
+     6a6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    sum += s->hist[i];
+     6a9:	8b 47 10             	mov    0x10(%edi),%eax
+  need = (uint64)s->count * pct;
+     6ac:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    if(sum * 100 >= need)
+     6af:	ba 64 00 00 00       	mov    $0x64,%edx
+    sum += s->hist[i];
+     6b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(sum * 100 >= need)
+     6b7:	f7 e2                	mul    %edx
+  need = (uint64)s->count * pct;
+     6b9:	01 4d ec             	add    %ecx,-0x14(%ebp)
+    if(sum * 100 >= need)
+     6bc:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+     6bf:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     6c2:	39 c8                	cmp    %ecx,%eax
+     6c4:	89 d0                	mov    %edx,%eax
+     6c6:	19 d8                	sbb    %ebx,%eax
+     6c8:	73 75                	jae    73f <percentile+0xbf>
+  for(i = 0; i < NCALLHIST-1; i++){
+     6ca:	31 c9                	xor    %ecx,%ecx
+     6cc:	8b 75 e0             	mov    -0x20(%ebp),%esi
+     6cf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     6d2:	89 cb                	mov    %ecx,%ebx
+     6d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6d8:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+     6db:	83 c3 01             	add    $0x1,%ebx
+     6de:	83 fb 17             	cmp    $0x17,%ebx
+     6e1:	74 4d                	je     730 <percentile+0xb0>
+    sum += s->hist[i];
+     6e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6e6:	31 d2                	xor    %edx,%edx
+     6e8:	8b 44 98 10          	mov    0x10(%eax,%ebx,4),%eax
+     6ec:	01 c6                	add    %eax,%esi
+    if(sum * 100 >= need)
+     6ee:	b8 64 00 00 00       	mov    $0x64,%eax
+    sum += s->hist[i];
+     6f3:	11 d7                	adc    %edx,%edi
+    if(sum * 100 >= need)
+     6f5:	f7 e6                	mul    %esi
+     6f7:	6b cf 64             	imul   $0x64,%edi,%ecx
+     6fa:	01 ca                	add    %ecx,%edx
+     6fc:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+     6ff:	39 c8                	cmp    %ecx,%eax
+     701:	89 d0                	mov    %edx,%eax
+     703:	1b 45 ec             	sbb    -0x14(%ebp),%eax
+     706:	72 d0                	jb     6d8 <percentile+0x58>
+  return 1ULL << (CALLHIST0 + 1 + i);
+     708:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     70b:	31 c0                	xor    %eax,%eax
+     70d:	31 d2                	xor    %edx,%edx
+     70f:	83 c1 0a             	add    $0xa,%ecx
+     712:	f6 c1 20             	test   $0x20,%cl
+     715:	0f 94 c0             	sete   %al
+     718:	0f 95 c2             	setne  %dl
+     71b:	d3 e2                	shl    %cl,%edx
+     71d:	d3 e0                	shl    %cl,%eax
+}
+     71f:	83 c4 14             	add    $0x14,%esp
+     722:	5b                   	pop    %ebx
+     723:	5e                   	pop    %esi
+     724:	5f                   	pop    %edi
+     725:	5d                   	pop    %ebp
+     726:	c3                   	ret
+     727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72e:	66 90                	xchg   %ax,%ax
+     730:	83 c4 14             	add    $0x14,%esp
+     733:	31 c0                	xor    %eax,%eax
+     735:	ba 01 00 00 00       	mov    $0x1,%edx
+     73a:	5b                   	pop    %ebx
+     73b:	5e                   	pop    %esi
+     73c:	5f                   	pop    %edi
+     73d:	5d                   	pop    %ebp
+     73e:	c3                   	ret
+    if(sum * 100 >= need)
+     73f:	b8 00 02 00 00       	mov    $0x200,%eax
+     744:	31 d2                	xor    %edx,%edx
+  return 1ULL << (CALLHIST0 + 1 + i);
+     746:	eb d7                	jmp    71f <percentile+0x9f>
+     748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74f:	90                   	nop
+
+00000750 <summary>:
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	57                   	push   %edi
+     754:	56                   	push   %esi
+     755:	53                   	push   %ebx
+     756:	81 ec d4 00 00 00    	sub    $0xd4,%esp
+     75c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tracestat(pid, st) < 0){
+     75f:	68 20 1a 00 00       	push   $0x1a20
+     764:	53                   	push   %ebx
+     765:	e8 d9 06 00 00       	call   e43 <tracestat>
+     76a:	83 c4 10             	add    $0x10,%esp
+     76d:	85 c0                	test   %eax,%eax
+     76f:	0f 88 91 03 00 00    	js     b06 <summary+0x3b6>
+  printf(1, "calls\terrors\tcycles\tp50\tp99\tsyscall\n");
+     775:	83 ec 08             	sub    $0x8,%esp
+     778:	68 a0 14 00 00       	push   $0x14a0
+     77d:	6a 01                	push   $0x1
+     77f:	e8 6c 07 00 00       	call   ef0 <printf>
+  memset(done, 0, sizeof(done));
+     784:	83 c4 0c             	add    $0xc,%esp
+     787:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+     78d:	68 90 00 00 00       	push   $0x90
+     792:	6a 00                	push   $0x0
+     794:	50                   	push   %eax
+     795:	e8 56 04 00 00       	call   bf0 <memset>
+     79a:	83 c4 10             	add    $0x10,%esp
+  cycles = 0;
+     79d:	c7 85 30 ff ff ff 00 	movl   $0x0,-0xd0(%ebp)
+     7a4:	00 00 00 
+     7a7:	c7 85 34 ff ff ff 00 	movl   $0x0,-0xcc(%ebp)
+     7ae:	00 00 00 
+  calls = errors = 0;
+     7b1:	c7 85 3c ff ff ff 00 	movl   $0x0,-0xc4(%ebp)
+     7b8:	00 00 00 
+     7bb:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%ebp)
+     7c2:	00 00 00 
+     7c5:	8d 76 00             	lea    0x0(%esi),%esi
+    for(i = 1; i < NCALLSTAT; i++)
+     7c8:	ba 90 1a 00 00       	mov    $0x1a90,%edx
+    j = -1;
+     7cd:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    for(i = 1; i < NCALLSTAT; i++)
+     7d2:	b8 01 00 00 00       	mov    $0x1,%eax
+     7d7:	eb 32                	jmp    80b <summary+0xbb>
+     7d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(!done[i] && st[i].count && (j < 0 || st[i].cycles > st[j].cycles))
+     7e0:	6b f3 70             	imul   $0x70,%ebx,%esi
+     7e3:	8b 7a 08             	mov    0x8(%edx),%edi
+     7e6:	8b 8e 2c 1a 00 00    	mov    0x1a2c(%esi),%ecx
+     7ec:	39 be 28 1a 00 00    	cmp    %edi,0x1a28(%esi)
+     7f2:	1b 4a 0c             	sbb    0xc(%edx),%ecx
+     7f5:	0f 42 d8             	cmovb  %eax,%ebx
+     7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ff:	90                   	nop
+    for(i = 1; i < NCALLSTAT; i++)
+     800:	83 c0 01             	add    $0x1,%eax
+     803:	83 c2 70             	add    $0x70,%edx
+     806:	83 f8 24             	cmp    $0x24,%eax
+     809:	74 25                	je     830 <summary+0xe0>
+      if(!done[i] && st[i].count && (j < 0 || st[i].cycles > st[j].cycles))
+     80b:	8b 8c 85 58 ff ff ff 	mov    -0xa8(%ebp,%eax,4),%ecx
+     812:	85 c9                	test   %ecx,%ecx
+     814:	75 ea                	jne    800 <summary+0xb0>
+     816:	8b 3a                	mov    (%edx),%edi
+     818:	85 ff                	test   %edi,%edi
+     81a:	74 e4                	je     800 <summary+0xb0>
+     81c:	83 fb ff             	cmp    $0xffffffff,%ebx
+     81f:	75 bf                	jne    7e0 <summary+0x90>
+     821:	89 c3                	mov    %eax,%ebx
+    for(i = 1; i < NCALLSTAT; i++)
+     823:	83 c0 01             	add    $0x1,%eax
+     826:	83 c2 70             	add    $0x70,%edx
+     829:	83 f8 24             	cmp    $0x24,%eax
+     82c:	75 dd                	jne    80b <summary+0xbb>
+     82e:	66 90                	xchg   %ax,%ax
+    if(j < 0)
+     830:	83 fb ff             	cmp    $0xffffffff,%ebx
+     833:	0f 84 71 02 00 00    	je     aaa <summary+0x35a>
+    done[j] = 1;
+     839:	c7 84 9d 58 ff ff ff 	movl   $0x1,-0xa8(%ebp,%ebx,4)
+     840:	01 00 00 00 
+    printf(1, "%d\t%d\t", st[j].count, st[j].errors);
+     844:	6b fb 70             	imul   $0x70,%ebx,%edi
+     847:	89 bd 4c ff ff ff    	mov    %edi,-0xb4(%ebp)
+     84d:	ff b7 24 1a 00 00    	push   0x1a24(%edi)
+     853:	ff b7 20 1a 00 00    	push   0x1a20(%edi)
+     859:	68 70 12 00 00       	push   $0x1270
+     85e:	6a 01                	push   $0x1
+     860:	e8 8b 06 00 00       	call   ef0 <printf>
+    printcycles(st[j].cycles);
+     865:	58                   	pop    %eax
+     866:	5a                   	pop    %edx
+     867:	ff b7 2c 1a 00 00    	push   0x1a2c(%edi)
+     86d:	ff b7 28 1a 00 00    	push   0x1a28(%edi)
+     873:	e8 88 fd ff ff       	call   600 <printcycles>
+    printf(1, "\t<");
+     878:	59                   	pop    %ecx
+     879:	5e                   	pop    %esi
+     87a:	68 77 12 00 00       	push   $0x1277
+     87f:	6a 01                	push   $0x1
+     881:	e8 6a 06 00 00       	call   ef0 <printf>
+  need = (uint64)s->count * pct;
+     886:	b8 32 00 00 00       	mov    $0x32,%eax
+    if(sum * 100 >= need)
+     88b:	b9 64 00 00 00       	mov    $0x64,%ecx
+     890:	83 c4 10             	add    $0x10,%esp
+  need = (uint64)s->count * pct;
+     893:	f7 a7 20 1a 00 00    	mull   0x1a20(%edi)
+     899:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+    sum += s->hist[i];
+     89f:	8b 87 30 1a 00 00    	mov    0x1a30(%edi),%eax
+     8a5:	31 ff                	xor    %edi,%edi
+  need = (uint64)s->count * pct;
+     8a7:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    sum += s->hist[i];
+     8ad:	89 c6                	mov    %eax,%esi
+    if(sum * 100 >= need)
+     8af:	f7 e1                	mul    %ecx
+     8b1:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+     8b7:	39 c8                	cmp    %ecx,%eax
+     8b9:	89 d1                	mov    %edx,%ecx
+     8bb:	1b 8d 54 ff ff ff    	sbb    -0xac(%ebp),%ecx
+     8c1:	0f 83 27 02 00 00    	jae    aee <summary+0x39e>
+  for(i = 0; i < NCALLHIST-1; i++){
+     8c7:	31 c9                	xor    %ecx,%ecx
+     8c9:	89 9d 44 ff ff ff    	mov    %ebx,-0xbc(%ebp)
+     8cf:	89 cb                	mov    %ecx,%ebx
+     8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8d8:	89 9d 48 ff ff ff    	mov    %ebx,-0xb8(%ebp)
+     8de:	83 c3 01             	add    $0x1,%ebx
+     8e1:	83 fb 17             	cmp    $0x17,%ebx
+     8e4:	0f 84 ae 01 00 00    	je     a98 <summary+0x348>
+    sum += s->hist[i];
+     8ea:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+     8f0:	31 d2                	xor    %edx,%edx
+     8f2:	8b 84 98 30 1a 00 00 	mov    0x1a30(%eax,%ebx,4),%eax
+     8f9:	01 c6                	add    %eax,%esi
+    if(sum * 100 >= need)
+     8fb:	b8 64 00 00 00       	mov    $0x64,%eax
+    sum += s->hist[i];
+     900:	11 d7                	adc    %edx,%edi
+    if(sum * 100 >= need)
+     902:	f7 e6                	mul    %esi
+     904:	6b cf 64             	imul   $0x64,%edi,%ecx
+     907:	01 ca                	add    %ecx,%edx
+     909:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+     90f:	39 c8                	cmp    %ecx,%eax
+     911:	89 d0                	mov    %edx,%eax
+     913:	1b 85 54 ff ff ff    	sbb    -0xac(%ebp),%eax
+     919:	72 bd                	jb     8d8 <summary+0x188>
+  return 1ULL << (CALLHIST0 + 1 + i);
+     91b:	8b 8d 48 ff ff ff    	mov    -0xb8(%ebp),%ecx
+     921:	31 c0                	xor    %eax,%eax
+     923:	31 d2                	xor    %edx,%edx
+     925:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+     92b:	83 c1 0a             	add    $0xa,%ecx
+     92e:	f6 c1 20             	test   $0x20,%cl
+     931:	0f 94 c0             	sete   %al
+     934:	0f 95 c2             	setne  %dl
+     937:	d3 e2                	shl    %cl,%edx
+     939:	d3 e0                	shl    %cl,%eax
+    printcycles(percentile(&st[j], 50));
+     93b:	83 ec 08             	sub    $0x8,%esp
+     93e:	52                   	push   %edx
+     93f:	50                   	push   %eax
+     940:	e8 bb fc ff ff       	call   600 <printcycles>
+    printf(1, "\t<");
+     945:	5f                   	pop    %edi
+  need = (uint64)s->count * pct;
+     946:	6b fb 70             	imul   $0x70,%ebx,%edi
+    printf(1, "\t<");
+     949:	58                   	pop    %eax
+     94a:	68 77 12 00 00       	push   $0x1277
+     94f:	6a 01                	push   $0x1
+     951:	e8 9a 05 00 00       	call   ef0 <printf>
+  need = (uint64)s->count * pct;
+     956:	b8 63 00 00 00       	mov    $0x63,%eax
+    if(sum * 100 >= need)
+     95b:	b9 64 00 00 00       	mov    $0x64,%ecx
+     960:	83 c4 10             	add    $0x10,%esp
+  need = (uint64)s->count * pct;
+     963:	f7 a7 20 1a 00 00    	mull   0x1a20(%edi)
+     969:	89 bd 4c ff ff ff    	mov    %edi,-0xb4(%ebp)
+     96f:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+    sum += s->hist[i];
+     975:	8b 87 30 1a 00 00    	mov    0x1a30(%edi),%eax
+     97b:	31 ff                	xor    %edi,%edi
+  need = (uint64)s->count * pct;
+     97d:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    sum += s->hist[i];
+     983:	89 c6                	mov    %eax,%esi
+    if(sum * 100 >= need)
+     985:	f7 e1                	mul    %ecx
+     987:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+     98d:	39 c8                	cmp    %ecx,%eax
+     98f:	89 d1                	mov    %edx,%ecx
+     991:	1b 8d 54 ff ff ff    	sbb    -0xac(%ebp),%ecx
+     997:	0f 83 5d 01 00 00    	jae    afa <summary+0x3aa>
+  for(i = 0; i < NCALLHIST-1; i++){
+     99d:	31 c9                	xor    %ecx,%ecx
+     99f:	89 9d 44 ff ff ff    	mov    %ebx,-0xbc(%ebp)
+     9a5:	89 cb                	mov    %ecx,%ebx
+     9a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ae:	66 90                	xchg   %ax,%ax
+     9b0:	89 9d 48 ff ff ff    	mov    %ebx,-0xb8(%ebp)
+     9b6:	83 c3 01             	add    $0x1,%ebx
+     9b9:	83 fb 17             	cmp    $0x17,%ebx
+     9bc:	0f 84 c4 00 00 00    	je     a86 <summary+0x336>
+    sum += s->hist[i];
+     9c2:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+     9c8:	31 d2                	xor    %edx,%edx
+     9ca:	8b 84 98 30 1a 00 00 	mov    0x1a30(%eax,%ebx,4),%eax
+     9d1:	01 c6                	add    %eax,%esi
+    if(sum * 100 >= need)
+     9d3:	b8 64 00 00 00       	mov    $0x64,%eax
+    sum += s->hist[i];
+     9d8:	11 d7                	adc    %edx,%edi
+    if(sum * 100 >= need)
+     9da:	f7 e6                	mul    %esi
+     9dc:	6b cf 64             	imul   $0x64,%edi,%ecx
+     9df:	01 ca                	add    %ecx,%edx
+     9e1:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+     9e7:	39 c8                	cmp    %ecx,%eax
+     9e9:	89 d0                	mov    %edx,%eax
+     9eb:	1b 85 54 ff ff ff    	sbb    -0xac(%ebp),%eax
+     9f1:	72 bd                	jb     9b0 <summary+0x260>
+  return 1ULL << (CALLHIST0 + 1 + i);
+     9f3:	8b 8d 48 ff ff ff    	mov    -0xb8(%ebp),%ecx
+     9f9:	31 c0                	xor    %eax,%eax
+     9fb:	31 d2                	xor    %edx,%edx
+     9fd:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+     a03:	83 c1 0a             	add    $0xa,%ecx
+     a06:	f6 c1 20             	test   $0x20,%cl
+     a09:	0f 94 c0             	sete   %al
+     a0c:	0f 95 c2             	setne  %dl
+     a0f:	d3 e2                	shl    %cl,%edx
+     a11:	d3 e0                	shl    %cl,%eax
+    printcycles(percentile(&st[j], 99));
+     a13:	83 ec 08             	sub    $0x8,%esp
+     a16:	52                   	push   %edx
+     a17:	50                   	push   %eax
+     a18:	e8 e3 fb ff ff       	call   600 <printcycles>
+    printf(1, "\t%s\n", j < NSYSCALL && syscall_name[j] ? syscall_name[j] : "?");
+     a1d:	83 c4 10             	add    $0x10,%esp
+     a20:	b8 20 12 00 00       	mov    $0x1220,%eax
+     a25:	83 fb 21             	cmp    $0x21,%ebx
+     a28:	7f 11                	jg     a3b <summary+0x2eb>
+     a2a:	8b 04 9d e0 14 00 00 	mov    0x14e0(,%ebx,4),%eax
+     a31:	ba 20 12 00 00       	mov    $0x1220,%edx
+     a36:	85 c0                	test   %eax,%eax
+     a38:	0f 44 c2             	cmove  %edx,%eax
+    calls += st[j].count;
+     a3b:	6b db 70             	imul   $0x70,%ebx,%ebx
+    printf(1, "\t%s\n", j < NSYSCALL && syscall_name[j] ? syscall_name[j] : "?");
+     a3e:	83 ec 04             	sub    $0x4,%esp
+     a41:	50                   	push   %eax
+     a42:	68 7a 12 00 00       	push   $0x127a
+     a47:	6a 01                	push   $0x1
+     a49:	e8 a2 04 00 00       	call   ef0 <printf>
+    calls += st[j].count;
+     a4e:	8b bb 20 1a 00 00    	mov    0x1a20(%ebx),%edi
+    cycles += st[j].cycles;
+     a54:	8b 8b 28 1a 00 00    	mov    0x1a28(%ebx),%ecx
+    calls += st[j].count;
+     a5a:	01 bd 40 ff ff ff    	add    %edi,-0xc0(%ebp)
+    errors += st[j].errors;
+     a60:	8b bb 24 1a 00 00    	mov    0x1a24(%ebx),%edi
+    cycles += st[j].cycles;
+     a66:	8b 9b 2c 1a 00 00    	mov    0x1a2c(%ebx),%ebx
+    errors += st[j].errors;
+     a6c:	01 bd 3c ff ff ff    	add    %edi,-0xc4(%ebp)
+    cycles += st[j].cycles;
+     a72:	01 8d 30 ff ff ff    	add    %ecx,-0xd0(%ebp)
+     a78:	11 9d 34 ff ff ff    	adc    %ebx,-0xcc(%ebp)
+    j = -1;
+     a7e:	83 c4 10             	add    $0x10,%esp
+     a81:	e9 42 fd ff ff       	jmp    7c8 <summary+0x78>
+     a86:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+     a8c:	31 c0                	xor    %eax,%eax
+     a8e:	ba 01 00 00 00       	mov    $0x1,%edx
+     a93:	e9 7b ff ff ff       	jmp    a13 <summary+0x2c3>
+     a98:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+     a9e:	31 c0                	xor    %eax,%eax
+     aa0:	ba 01 00 00 00       	mov    $0x1,%edx
+     aa5:	e9 91 fe ff ff       	jmp    93b <summary+0x1eb>
+  printf(1, "%d\t%d\t", calls, errors);
+     aaa:	ff b5 3c ff ff ff    	push   -0xc4(%ebp)
+     ab0:	ff b5 40 ff ff ff    	push   -0xc0(%ebp)
+     ab6:	68 70 12 00 00       	push   $0x1270
+     abb:	6a 01                	push   $0x1
+     abd:	e8 2e 04 00 00       	call   ef0 <printf>
+  printcycles(cycles);
+     ac2:	58                   	pop    %eax
+     ac3:	5a                   	pop    %edx
+     ac4:	ff b5 34 ff ff ff    	push   -0xcc(%ebp)
+     aca:	ff b5 30 ff ff ff    	push   -0xd0(%ebp)
+     ad0:	e8 2b fb ff ff       	call   600 <printcycles>
+  printf(1, "\t\t\ttotal\n");
+     ad5:	59                   	pop    %ecx
+     ad6:	5b                   	pop    %ebx
+     ad7:	68 7f 12 00 00       	push   $0x127f
+     adc:	6a 01                	push   $0x1
+     ade:	e8 0d 04 00 00       	call   ef0 <printf>
+     ae3:	83 c4 10             	add    $0x10,%esp
+}
+     ae6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ae9:	5b                   	pop    %ebx
+     aea:	5e                   	pop    %esi
+     aeb:	5f                   	pop    %edi
+     aec:	5d                   	pop    %ebp
+     aed:	c3                   	ret
+    if(sum * 100 >= need)
+     aee:	b8 00 02 00 00       	mov    $0x200,%eax
+     af3:	31 d2                	xor    %edx,%edx
+     af5:	e9 41 fe ff ff       	jmp    93b <summary+0x1eb>
+     afa:	b8 00 02 00 00       	mov    $0x200,%eax
+     aff:	31 d2                	xor    %edx,%edx
+     b01:	e9 0d ff ff ff       	jmp    a13 <summary+0x2c3>
+    printf(2, "strace: no process %d\n", pid);
+     b06:	83 ec 04             	sub    $0x4,%esp
+     b09:	53                   	push   %ebx
+     b0a:	68 59 12 00 00       	push   $0x1259
+     b0f:	6a 02                	push   $0x2
+     b11:	e8 da 03 00 00       	call   ef0 <printf>
+     b16:	83 c4 10             	add    $0x10,%esp
+}
+     b19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b1c:	5b                   	pop    %ebx
+     b1d:	5e                   	pop    %esi
+     b1e:	5f                   	pop    %edi
+     b1f:	5d                   	pop    %ebp
+     b20:	c3                   	ret
+     b21:	66 90                	xchg   %ax,%ax
+     b23:	66 90                	xchg   %ax,%ax
+     b25:	66 90                	xchg   %ax,%ax
+     b27:	66 90                	xchg   %ax,%ax
+     b29:	66 90                	xchg   %ax,%ax
+     b2b:	66 90                	xchg   %ax,%ax
+     b2d:	66 90                	xchg   %ax,%ax
+     b2f:	90                   	nop
+
+00000b30 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     b30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     b31:	31 c0                	xor    %eax,%eax
+{
+     b33:	89 e5                	mov    %esp,%ebp
+     b35:	53                   	push   %ebx
+     b36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     b39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     b40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     b44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     b47:	83 c0 01             	add    $0x1,%eax
+     b4a:	84 d2                	test   %dl,%dl
+     b4c:	75 f2                	jne    b40 <strcpy+0x10>
+    ;
+  return os;
+}
+     b4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b51:	89 c8                	mov    %ecx,%eax
+     b53:	c9                   	leave
+     b54:	c3                   	ret
+     b55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b60 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	53                   	push   %ebx
+     b64:	8b 55 08             	mov    0x8(%ebp),%edx
+     b67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     b6a:	0f b6 02             	movzbl (%edx),%eax
+     b6d:	84 c0                	test   %al,%al
+     b6f:	75 17                	jne    b88 <strcmp+0x28>
+     b71:	eb 3a                	jmp    bad <strcmp+0x4d>
+     b73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b77:	90                   	nop
+     b78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     b7c:	83 c2 01             	add    $0x1,%edx
+     b7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     b82:	84 c0                	test   %al,%al
+     b84:	74 1a                	je     ba0 <strcmp+0x40>
+    p++, q++;
+     b86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     b88:	0f b6 19             	movzbl (%ecx),%ebx
+     b8b:	38 c3                	cmp    %al,%bl
+     b8d:	74 e9                	je     b78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     b8f:	29 d8                	sub    %ebx,%eax
+}
+     b91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b94:	c9                   	leave
+     b95:	c3                   	ret
+     b96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     ba0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     ba4:	31 c0                	xor    %eax,%eax
+     ba6:	29 d8                	sub    %ebx,%eax
+}
+     ba8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bab:	c9                   	leave
+     bac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     bad:	0f b6 19             	movzbl (%ecx),%ebx
+     bb0:	31 c0                	xor    %eax,%eax
+     bb2:	eb db                	jmp    b8f <strcmp+0x2f>
+     bb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bbf:	90                   	nop
+
+00000bc0 <strlen>:
+
+uint
+strlen(char *s)
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     bc6:	80 3a 00             	cmpb   $0x0,(%edx)
+     bc9:	74 15                	je     be0 <strlen+0x20>
+     bcb:	31 c0                	xor    %eax,%eax
+     bcd:	8d 76 00             	lea    0x0(%esi),%esi
+     bd0:	83 c0 01             	add    $0x1,%eax
+     bd3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     bd7:	89 c1                	mov    %eax,%ecx
+     bd9:	75 f5                	jne    bd0 <strlen+0x10>
+    ;
+  return n;
+}
+     bdb:	89 c8                	mov    %ecx,%eax
+     bdd:	5d                   	pop    %ebp
+     bde:	c3                   	ret
+     bdf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     be0:	31 c9                	xor    %ecx,%ecx
+}
+     be2:	5d                   	pop    %ebp
+     be3:	89 c8                	mov    %ecx,%eax
+     be5:	c3                   	ret
+     be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bf0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	57                   	push   %edi
+     bf4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     bf7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     bfa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bfd:	89 d7                	mov    %edx,%edi
+     bff:	fc                   	cld
+     c00:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     c02:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     c05:	89 d0                	mov    %edx,%eax
+     c07:	c9                   	leave
+     c08:	c3                   	ret
+     c09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c10 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	8b 45 08             	mov    0x8(%ebp),%eax
+     c16:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     c1a:	0f b6 10             	movzbl (%eax),%edx
+     c1d:	84 d2                	test   %dl,%dl
+     c1f:	75 12                	jne    c33 <strchr+0x23>
+     c21:	eb 1d                	jmp    c40 <strchr+0x30>
+     c23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c27:	90                   	nop
+     c28:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     c2c:	83 c0 01             	add    $0x1,%eax
+     c2f:	84 d2                	test   %dl,%dl
+     c31:	74 0d                	je     c40 <strchr+0x30>
+    if(*s == c)
+     c33:	38 d1                	cmp    %dl,%cl
+     c35:	75 f1                	jne    c28 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     c37:	5d                   	pop    %ebp
+     c38:	c3                   	ret
+     c39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     c40:	31 c0                	xor    %eax,%eax
+}
+     c42:	5d                   	pop    %ebp
+     c43:	c3                   	ret
+     c44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c4f:	90                   	nop
+
+00000c50 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	57                   	push   %edi
+     c54:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     c55:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     c58:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     c59:	31 db                	xor    %ebx,%ebx
+{
+     c5b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     c5e:	eb 27                	jmp    c87 <gets+0x37>
+    cc = read(0, &c, 1);
+     c60:	83 ec 04             	sub    $0x4,%esp
+     c63:	6a 01                	push   $0x1
+     c65:	56                   	push   %esi
+     c66:	6a 00                	push   $0x0
+     c68:	e8 1e 01 00 00       	call   d8b <read>
+    if(cc < 1)
+     c6d:	83 c4 10             	add    $0x10,%esp
+     c70:	85 c0                	test   %eax,%eax
+     c72:	7e 1d                	jle    c91 <gets+0x41>
+      break;
+    buf[i++] = c;
+     c74:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     c78:	8b 55 08             	mov    0x8(%ebp),%edx
+     c7b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     c7f:	3c 0a                	cmp    $0xa,%al
+     c81:	74 10                	je     c93 <gets+0x43>
+     c83:	3c 0d                	cmp    $0xd,%al
+     c85:	74 0c                	je     c93 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     c87:	89 df                	mov    %ebx,%edi
+     c89:	83 c3 01             	add    $0x1,%ebx
+     c8c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     c8f:	7c cf                	jl     c60 <gets+0x10>
+     c91:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     c93:	8b 45 08             	mov    0x8(%ebp),%eax
+     c96:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     c9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c9d:	5b                   	pop    %ebx
+     c9e:	5e                   	pop    %esi
+     c9f:	5f                   	pop    %edi
+     ca0:	5d                   	pop    %ebp
+     ca1:	c3                   	ret
+     ca2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cb0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	56                   	push   %esi
+     cb4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     cb5:	83 ec 08             	sub    $0x8,%esp
+     cb8:	6a 00                	push   $0x0
+     cba:	ff 75 08             	push   0x8(%ebp)
+     cbd:	e8 f1 00 00 00       	call   db3 <open>
+  if(fd < 0)
+     cc2:	83 c4 10             	add    $0x10,%esp
+     cc5:	85 c0                	test   %eax,%eax
+     cc7:	78 27                	js     cf0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     cc9:	83 ec 08             	sub    $0x8,%esp
+     ccc:	ff 75 0c             	push   0xc(%ebp)
+     ccf:	89 c3                	mov    %eax,%ebx
+     cd1:	50                   	push   %eax
+     cd2:	e8 f4 00 00 00       	call   dcb <fstat>
+  close(fd);
+     cd7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     cda:	89 c6                	mov    %eax,%esi
+  close(fd);
+     cdc:	e8 ba 00 00 00       	call   d9b <close>
+  return r;
+     ce1:	83 c4 10             	add    $0x10,%esp
+}
+     ce4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ce7:	89 f0                	mov    %esi,%eax
+     ce9:	5b                   	pop    %ebx
+     cea:	5e                   	pop    %esi
+     ceb:	5d                   	pop    %ebp
+     cec:	c3                   	ret
+     ced:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     cf0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     cf5:	eb ed                	jmp    ce4 <stat+0x34>
+     cf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cfe:	66 90                	xchg   %ax,%ax
+
+00000d00 <atoi>:
+
+int
+atoi(const char *s)
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	53                   	push   %ebx
+     d04:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     d07:	0f be 02             	movsbl (%edx),%eax
+     d0a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     d0d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     d10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     d15:	77 1e                	ja     d35 <atoi+0x35>
+     d17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     d20:	83 c2 01             	add    $0x1,%edx
+     d23:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     d26:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     d2a:	0f be 02             	movsbl (%edx),%eax
+     d2d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     d30:	80 fb 09             	cmp    $0x9,%bl
+     d33:	76 eb                	jbe    d20 <atoi+0x20>
+  return n;
+}
+     d35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d38:	89 c8                	mov    %ecx,%eax
+     d3a:	c9                   	leave
+     d3b:	c3                   	ret
+     d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d40 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	57                   	push   %edi
+     d44:	56                   	push   %esi
+     d45:	8b 45 10             	mov    0x10(%ebp),%eax
+     d48:	8b 55 08             	mov    0x8(%ebp),%edx
+     d4b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     d4e:	85 c0                	test   %eax,%eax
+     d50:	7e 13                	jle    d65 <memmove+0x25>
+     d52:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     d54:	89 d7                	mov    %edx,%edi
+     d56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     d60:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     d61:	39 f8                	cmp    %edi,%eax
+     d63:	75 fb                	jne    d60 <memmove+0x20>
+  return vdst;
+}
+     d65:	5e                   	pop    %esi
+     d66:	89 d0                	mov    %edx,%eax
+     d68:	5f                   	pop    %edi
+     d69:	5d                   	pop    %ebp
+     d6a:	c3                   	ret
+
+00000d6b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     d6b:	b8 01 00 00 00       	mov    $0x1,%eax
+     d70:	cd 40                	int    $0x40
+     d72:	c3                   	ret
+
+00000d73 <exit>:
+SYSCALL(exit)
+     d73:	b8 02 00 00 00       	mov    $0x2,%eax
+     d78:	cd 40                	int    $0x40
+     d7a:	c3                   	ret
+
+00000d7b <wait>:
+SYSCALL(wait)
+     d7b:	b8 03 00 00 00       	mov    $0x3,%eax
+     d80:	cd 40                	int    $0x40
+     d82:	c3                   	ret
+
+00000d83 <pipe>:
+SYSCALL(pipe)
+     d83:	b8 04 00 00 00       	mov    $0x4,%eax
+     d88:	cd 40                	int    $0x40
+     d8a:	c3                   	ret
+
+00000d8b <read>:
+SYSCALL(read)
+     d8b:	b8 05 00 00 00       	mov    $0x5,%eax
+     d90:	cd 40                	int    $0x40
+     d92:	c3                   	ret
+
+00000d93 <write>:
+SYSCALL(write)
+     d93:	b8 10 00 00 00       	mov    $0x10,%eax
+     d98:	cd 40                	int    $0x40
+     d9a:	c3                   	ret
+
+00000d9b <close>:
+SYSCALL(close)
+     d9b:	b8 15 00 00 00       	mov    $0x15,%eax
+     da0:	cd 40                	int    $0x40
+     da2:	c3                   	ret
+
+00000da3 <kill>:
+SYSCALL(kill)
+     da3:	b8 06 00 00 00       	mov    $0x6,%eax
+     da8:	cd 40                	int    $0x40
+     daa:	c3                   	ret
+
+00000dab <exec>:
+SYSCALL(exec)
+     dab:	b8 07 00 00 00       	mov    $0x7,%eax
+     db0:	cd 40                	int    $0x40
+     db2:	c3                   	ret
+
+00000db3 <open>:
+SYSCALL(open)
+     db3:	b8 0f 00 00 00       	mov    $0xf,%eax
+     db8:	cd 40                	int    $0x40
+     dba:	c3                   	ret
+
+00000dbb <mknod>:
+SYSCALL(mknod)
+     dbb:	b8 11 00 00 00       	mov    $0x11,%eax
+     dc0:	cd 40                	int    $0x40
+     dc2:	c3                   	ret
+
+00000dc3 <unlink>:
+SYSCALL(unlink)
+     dc3:	b8 12 00 00 00       	mov    $0x12,%eax
+     dc8:	cd 40                	int    $0x40
+     dca:	c3                   	ret
+
+00000dcb <fstat>:
+SYSCALL(fstat)
+     dcb:	b8 08 00 00 00       	mov    $0x8,%eax
+     dd0:	cd 40                	int    $0x40
+     dd2:	c3                   	ret
+
+00000dd3 <link>:
+SYSCALL(link)
+     dd3:	b8 13 00 00 00       	mov    $0x13,%eax
+     dd8:	cd 40                	int    $0x40
+     dda:	c3                   	ret
+
+00000ddb <mkdir>:
+SYSCALL(mkdir)
+     ddb:	b8 14 00 00 00       	mov    $0x14,%eax
+     de0:	cd 40                	int    $0x40
+     de2:	c3                   	ret
+
+00000de3 <chdir>:
+SYSCALL(chdir)
+     de3:	b8 09 00 00 00       	mov    $0x9,%eax
+     de8:	cd 40                	int    $0x40
+     dea:	c3                   	ret
+
+00000deb <dup>:
+SYSCALL(dup)
+     deb:	b8 0a 00 00 00       	mov    $0xa,%eax
+     df0:	cd 40                	int    $0x40
+     df2:	c3                   	ret
+
+00000df3 <getpid>:
+SYSCALL(getpid)
+     df3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     df8:	cd 40                	int    $0x40
+     dfa:	c3                   	ret
+
+00000dfb <sbrk>:
+SYSCALL(sbrk)
+     dfb:	b8 0c 00 00 00       	mov    $0xc,%eax
+     e00:	cd 40                	int    $0x40
+     e02:	c3                   	ret
+
+00000e03 <sleep>:
+SYSCALL(sleep)
+     e03:	b8 0d 00 00 00       	mov    $0xd,%eax
+     e08:	cd 40                	int    $0x40
+     e0a:	c3                   	ret
+
+00000e0b <uptime>:
+SYSCALL(uptime)
+     e0b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     e10:	cd 40                	int    $0x40
+     e12:	c3                   	ret
+
+00000e13 <trace>:
+SYSCALL(trace)
+     e13:	b8 16 00 00 00       	mov    $0x16,%eax
+     e18:	cd 40                	int    $0x40
+     e1a:	c3                   	ret
+
+00000e1b <assign_nice>:
+SYSCALL(assign_nice)
+     e1b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     e20:	cd 40                	int    $0x40
+     e22:	c3                   	ret
+
+00000e23 <readahead>:
+SYSCALL(readahead)
+     e23:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     e28:	cd 40                	int    $0x40
+     e2a:	c3                   	ret
+
+00000e2b <dropcache>:
+SYSCALL(dropcache)
+     e2b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     e30:	cd 40                	int    $0x40
+     e32:	c3                   	ret
+
+00000e33 <tracedrain>:
+SYSCALL(tracedrain)
+     e33:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     e38:	cd 40                	int    $0x40
+     e3a:	c3                   	ret
+
+00000e3b <settrace>:
+SYSCALL(settrace)
+     e3b:	b8 20 00 00 00       	mov    $0x20,%eax
+     e40:	cd 40                	int    $0x40
+     e42:	c3                   	ret
+
+00000e43 <tracestat>:
+     e43:	b8 21 00 00 00       	mov    $0x21,%eax
+     e48:	cd 40                	int    $0x40
+     e4a:	c3                   	ret
+     e4b:	66 90                	xchg   %ax,%ax
+     e4d:	66 90                	xchg   %ax,%ax
+     e4f:	90                   	nop
+
+00000e50 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     e50:	55                   	push   %ebp
+     e51:	89 e5                	mov    %esp,%ebp
+     e53:	57                   	push   %edi
+     e54:	56                   	push   %esi
+     e55:	53                   	push   %ebx
+     e56:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     e58:	89 d1                	mov    %edx,%ecx
+{
+     e5a:	83 ec 3c             	sub    $0x3c,%esp
+     e5d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     e60:	85 d2                	test   %edx,%edx
+     e62:	0f 89 80 00 00 00    	jns    ee8 <printint+0x98>
+     e68:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     e6c:	74 7a                	je     ee8 <printint+0x98>
+    x = -xx;
+     e6e:	f7 d9                	neg    %ecx
+    neg = 1;
+     e70:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     e75:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     e78:	31 f6                	xor    %esi,%esi
+     e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     e80:	89 c8                	mov    %ecx,%eax
+     e82:	31 d2                	xor    %edx,%edx
+     e84:	89 f7                	mov    %esi,%edi
+     e86:	f7 f3                	div    %ebx
+     e88:	8d 76 01             	lea    0x1(%esi),%esi
+     e8b:	0f b6 92 c8 15 00 00 	movzbl 0x15c8(%edx),%edx
+     e92:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     e96:	89 ca                	mov    %ecx,%edx
+     e98:	89 c1                	mov    %eax,%ecx
+     e9a:	39 da                	cmp    %ebx,%edx
+     e9c:	73 e2                	jae    e80 <printint+0x30>
+  if(neg)
+     e9e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ea1:	85 c0                	test   %eax,%eax
+     ea3:	74 07                	je     eac <printint+0x5c>
+    buf[i++] = '-';
+     ea5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     eaa:	89 f7                	mov    %esi,%edi
+     eac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     eaf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     eb2:	01 df                	add    %ebx,%edi
+     eb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     eb8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     ebb:	83 ec 04             	sub    $0x4,%esp
+     ebe:	88 45 d7             	mov    %al,-0x29(%ebp)
+     ec1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     ec4:	6a 01                	push   $0x1
+     ec6:	50                   	push   %eax
+     ec7:	56                   	push   %esi
+     ec8:	e8 c6 fe ff ff       	call   d93 <write>
+  while(--i >= 0)
+     ecd:	89 f8                	mov    %edi,%eax
+     ecf:	83 c4 10             	add    $0x10,%esp
+     ed2:	83 ef 01             	sub    $0x1,%edi
+     ed5:	39 d8                	cmp    %ebx,%eax
+     ed7:	75 df                	jne    eb8 <printint+0x68>
+}
+     ed9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     edc:	5b                   	pop    %ebx
+     edd:	5e                   	pop    %esi
+     ede:	5f                   	pop    %edi
+     edf:	5d                   	pop    %ebp
+     ee0:	c3                   	ret
+     ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     ee8:	31 c0                	xor    %eax,%eax
+     eea:	eb 89                	jmp    e75 <printint+0x25>
+     eec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ef0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     ef0:	55                   	push   %ebp
+     ef1:	89 e5                	mov    %esp,%ebp
+     ef3:	57                   	push   %edi
+     ef4:	56                   	push   %esi
+     ef5:	53                   	push   %ebx
+     ef6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     ef9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     efc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     eff:	0f b6 1e             	movzbl (%esi),%ebx
+     f02:	83 c6 01             	add    $0x1,%esi
+     f05:	84 db                	test   %bl,%bl
+     f07:	74 67                	je     f70 <printf+0x80>
+     f09:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     f0c:	31 d2                	xor    %edx,%edx
+     f0e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     f11:	eb 34                	jmp    f47 <printf+0x57>
+     f13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f17:	90                   	nop
+     f18:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     f1b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     f20:	83 f8 25             	cmp    $0x25,%eax
+     f23:	74 18                	je     f3d <printf+0x4d>
+  write(fd, &c, 1);
+     f25:	83 ec 04             	sub    $0x4,%esp
+     f28:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     f2b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     f2e:	6a 01                	push   $0x1
+     f30:	50                   	push   %eax
+     f31:	57                   	push   %edi
+     f32:	e8 5c fe ff ff       	call   d93 <write>
+     f37:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     f3a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     f3d:	0f b6 1e             	movzbl (%esi),%ebx
+     f40:	83 c6 01             	add    $0x1,%esi
+     f43:	84 db                	test   %bl,%bl
+     f45:	74 29                	je     f70 <printf+0x80>
+    c = fmt[i] & 0xff;
+     f47:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     f4a:	85 d2                	test   %edx,%edx
+     f4c:	74 ca                	je     f18 <printf+0x28>
+      }
+    } else if(state == '%'){
+     f4e:	83 fa 25             	cmp    $0x25,%edx
+     f51:	75 ea                	jne    f3d <printf+0x4d>
+      if(c == 'd'){
+     f53:	83 f8 25             	cmp    $0x25,%eax
+     f56:	0f 84 24 01 00 00    	je     1080 <printf+0x190>
+     f5c:	83 e8 63             	sub    $0x63,%eax
+     f5f:	83 f8 15             	cmp    $0x15,%eax
+     f62:	77 1c                	ja     f80 <printf+0x90>
+     f64:	ff 24 85 70 15 00 00 	jmp    *0x1570(,%eax,4)
+     f6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f6f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f73:	5b                   	pop    %ebx
+     f74:	5e                   	pop    %esi
+     f75:	5f                   	pop    %edi
+     f76:	5d                   	pop    %ebp
+     f77:	c3                   	ret
+     f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7f:	90                   	nop
+  write(fd, &c, 1);
+     f80:	83 ec 04             	sub    $0x4,%esp
+     f83:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     f86:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     f8a:	6a 01                	push   $0x1
+     f8c:	52                   	push   %edx
+     f8d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     f90:	57                   	push   %edi
+     f91:	e8 fd fd ff ff       	call   d93 <write>
+     f96:	83 c4 0c             	add    $0xc,%esp
+     f99:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     f9c:	6a 01                	push   $0x1
+     f9e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     fa1:	52                   	push   %edx
+     fa2:	57                   	push   %edi
+     fa3:	e8 eb fd ff ff       	call   d93 <write>
+        putc(fd, c);
+     fa8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     fab:	31 d2                	xor    %edx,%edx
+     fad:	eb 8e                	jmp    f3d <printf+0x4d>
+     faf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     fb0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     fb3:	83 ec 0c             	sub    $0xc,%esp
+     fb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     fbb:	8b 13                	mov    (%ebx),%edx
+     fbd:	6a 00                	push   $0x0
+     fbf:	89 f8                	mov    %edi,%eax
+        ap++;
+     fc1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     fc4:	e8 87 fe ff ff       	call   e50 <printint>
+        ap++;
+     fc9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     fcc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     fcf:	31 d2                	xor    %edx,%edx
+     fd1:	e9 67 ff ff ff       	jmp    f3d <printf+0x4d>
+     fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     fe0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     fe3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     fe5:	83 c0 04             	add    $0x4,%eax
+     fe8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     feb:	85 db                	test   %ebx,%ebx
+     fed:	0f 84 9d 00 00 00    	je     1090 <printf+0x1a0>
+        while(*s != 0){
+     ff3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     ff6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     ff8:	84 c0                	test   %al,%al
+     ffa:	0f 84 3d ff ff ff    	je     f3d <printf+0x4d>
+    1000:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1003:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1006:	89 de                	mov    %ebx,%esi
+    1008:	89 d3                	mov    %edx,%ebx
+    100a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1010:	83 ec 04             	sub    $0x4,%esp
+    1013:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1016:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1019:	6a 01                	push   $0x1
+    101b:	53                   	push   %ebx
+    101c:	57                   	push   %edi
+    101d:	e8 71 fd ff ff       	call   d93 <write>
+        while(*s != 0){
+    1022:	0f b6 06             	movzbl (%esi),%eax
+    1025:	83 c4 10             	add    $0x10,%esp
+    1028:	84 c0                	test   %al,%al
+    102a:	75 e4                	jne    1010 <printf+0x120>
+      state = 0;
+    102c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    102f:	31 d2                	xor    %edx,%edx
+    1031:	e9 07 ff ff ff       	jmp    f3d <printf+0x4d>
+    1036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1040:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1043:	83 ec 0c             	sub    $0xc,%esp
+    1046:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    104b:	8b 13                	mov    (%ebx),%edx
+    104d:	6a 01                	push   $0x1
+    104f:	e9 6b ff ff ff       	jmp    fbf <printf+0xcf>
+    1054:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1058:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    105b:	83 ec 04             	sub    $0x4,%esp
+    105e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1061:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1063:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1066:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1069:	6a 01                	push   $0x1
+    106b:	52                   	push   %edx
+    106c:	57                   	push   %edi
+    106d:	e8 21 fd ff ff       	call   d93 <write>
+        ap++;
+    1072:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1075:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1078:	31 d2                	xor    %edx,%edx
+    107a:	e9 be fe ff ff       	jmp    f3d <printf+0x4d>
+    107f:	90                   	nop
+  write(fd, &c, 1);
+    1080:	83 ec 04             	sub    $0x4,%esp
+    1083:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1086:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1089:	6a 01                	push   $0x1
+    108b:	e9 11 ff ff ff       	jmp    fa1 <printf+0xb1>
+    1090:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1095:	bb 68 15 00 00       	mov    $0x1568,%ebx
+    109a:	e9 61 ff ff ff       	jmp    1000 <printf+0x110>
+    109f:	90                   	nop
+
+000010a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    10a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10a1:	a1 e0 32 00 00       	mov    0x32e0,%eax
+{
+    10a6:	89 e5                	mov    %esp,%ebp
+    10a8:	57                   	push   %edi
+    10a9:	56                   	push   %esi
+    10aa:	53                   	push   %ebx
+    10ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    10ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10bc:	39 ca                	cmp    %ecx,%edx
+    10be:	73 30                	jae    10f0 <free+0x50>
+    10c0:	39 c1                	cmp    %eax,%ecx
+    10c2:	72 04                	jb     10c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10c4:	39 c2                	cmp    %eax,%edx
+    10c6:	72 f0                	jb     10b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    10c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    10cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    10ce:	39 f8                	cmp    %edi,%eax
+    10d0:	74 2e                	je     1100 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    10d5:	8b 42 04             	mov    0x4(%edx),%eax
+    10d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10db:	39 f1                	cmp    %esi,%ecx
+    10dd:	74 38                	je     1117 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    10df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    10e1:	5b                   	pop    %ebx
+  freep = p;
+    10e2:	89 15 e0 32 00 00    	mov    %edx,0x32e0
+}
+    10e8:	5e                   	pop    %esi
+    10e9:	5f                   	pop    %edi
+    10ea:	5d                   	pop    %ebp
+    10eb:	c3                   	ret
+    10ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10f0:	39 c1                	cmp    %eax,%ecx
+    10f2:	72 d0                	jb     10c4 <free+0x24>
+    10f4:	eb c2                	jmp    10b8 <free+0x18>
+    10f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1100:	03 70 04             	add    0x4(%eax),%esi
+    1103:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1106:	8b 02                	mov    (%edx),%eax
+    1108:	8b 00                	mov    (%eax),%eax
+    110a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    110d:	8b 42 04             	mov    0x4(%edx),%eax
+    1110:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1113:	39 f1                	cmp    %esi,%ecx
+    1115:	75 c8                	jne    10df <free+0x3f>
+    p->s.size += bp->s.size;
+    1117:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    111a:	89 15 e0 32 00 00    	mov    %edx,0x32e0
+    p->s.size += bp->s.size;
+    1120:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1123:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1126:	89 0a                	mov    %ecx,(%edx)
+}
+    1128:	5b                   	pop    %ebx
+    1129:	5e                   	pop    %esi
+    112a:	5f                   	pop    %edi
+    112b:	5d                   	pop    %ebp
+    112c:	c3                   	ret
+    112d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001130 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	57                   	push   %edi
+    1134:	56                   	push   %esi
+    1135:	53                   	push   %ebx
+    1136:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1139:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    113c:	8b 15 e0 32 00 00    	mov    0x32e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1142:	8d 78 07             	lea    0x7(%eax),%edi
+    1145:	c1 ef 03             	shr    $0x3,%edi
+    1148:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    114b:	85 d2                	test   %edx,%edx
+    114d:	0f 84 8d 00 00 00    	je     11e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1153:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1155:	8b 48 04             	mov    0x4(%eax),%ecx
+    1158:	39 f9                	cmp    %edi,%ecx
+    115a:	73 64                	jae    11c0 <malloc+0x90>
+  if(nu < 4096)
+    115c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1161:	39 df                	cmp    %ebx,%edi
+    1163:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1166:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    116d:	eb 0a                	jmp    1179 <malloc+0x49>
+    116f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1170:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1172:	8b 48 04             	mov    0x4(%eax),%ecx
+    1175:	39 f9                	cmp    %edi,%ecx
+    1177:	73 47                	jae    11c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1179:	89 c2                	mov    %eax,%edx
+    117b:	39 05 e0 32 00 00    	cmp    %eax,0x32e0
+    1181:	75 ed                	jne    1170 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1183:	83 ec 0c             	sub    $0xc,%esp
+    1186:	56                   	push   %esi
+    1187:	e8 6f fc ff ff       	call   dfb <sbrk>
+  if(p == (char*)-1)
+    118c:	83 c4 10             	add    $0x10,%esp
+    118f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1192:	74 1c                	je     11b0 <malloc+0x80>
+  hp->s.size = nu;
+    1194:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1197:	83 ec 0c             	sub    $0xc,%esp
+    119a:	83 c0 08             	add    $0x8,%eax
+    119d:	50                   	push   %eax
+    119e:	e8 fd fe ff ff       	call   10a0 <free>
+  return freep;
+    11a3:	8b 15 e0 32 00 00    	mov    0x32e0,%edx
+      if((p = morecore(nunits)) == 0)
+    11a9:	83 c4 10             	add    $0x10,%esp
+    11ac:	85 d2                	test   %edx,%edx
+    11ae:	75 c0                	jne    1170 <malloc+0x40>
+        return 0;
+  }
+}
+    11b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    11b3:	31 c0                	xor    %eax,%eax
+}
+    11b5:	5b                   	pop    %ebx
+    11b6:	5e                   	pop    %esi
+    11b7:	5f                   	pop    %edi
+    11b8:	5d                   	pop    %ebp
+    11b9:	c3                   	ret
+    11ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    11c0:	39 cf                	cmp    %ecx,%edi
+    11c2:	74 4c                	je     1210 <malloc+0xe0>
+        p->s.size -= nunits;
+    11c4:	29 f9                	sub    %edi,%ecx
+    11c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    11c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    11cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    11cf:	89 15 e0 32 00 00    	mov    %edx,0x32e0
+}
+    11d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    11d8:	83 c0 08             	add    $0x8,%eax
+}
+    11db:	5b                   	pop    %ebx
+    11dc:	5e                   	pop    %esi
+    11dd:	5f                   	pop    %edi
+    11de:	5d                   	pop    %ebp
+    11df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    11e0:	c7 05 e0 32 00 00 e4 	movl   $0x32e4,0x32e0
+    11e7:	32 00 00 
+    base.s.size = 0;
+    11ea:	b8 e4 32 00 00       	mov    $0x32e4,%eax
+    base.s.ptr = freep = prevp = &base;
+    11ef:	c7 05 e4 32 00 00 e4 	movl   $0x32e4,0x32e4
+    11f6:	32 00 00 
+    base.s.size = 0;
+    11f9:	c7 05 e8 32 00 00 00 	movl   $0x0,0x32e8
+    1200:	00 00 00 
+    if(p->s.size >= nunits){
+    1203:	e9 54 ff ff ff       	jmp    115c <malloc+0x2c>
+    1208:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1210:	8b 08                	mov    (%eax),%ecx
+    1212:	89 0a                	mov    %ecx,(%edx)
+    1214:	eb b9                	jmp    11cf <malloc+0x9f>
@@ -26,106 +26,246 @@ static char *syscall_name[] = {
   [SYS_mkdir]   "mkdir",
   [SYS_close]   "close",
   [SYS_trace]  "trace",
-  [SYS_t_toggle] "t_toggle",
+  [SYS_assign_nice] "assign_nice",
+  [SYS_readahead] "readahead",
+  [SYS_dropcache] "dropcache",
+  [SYS_tracedrain] "tracedrain",
+  [SYS_settrace] "settrace",
+  [SYS_tracestat] "tracestat",
 };
 
-int
-main(int argc, char *argv[])
+#define NSYSCALL (sizeof(syscall_name)/sizeof(syscall_name[0]))
+#define NEV 64  // events read at a time
+
+static struct traceev ev[NEV];
+static struct callstat st[NCALLSTAT];
+
+void
+printev(struct traceev *e)
 {
-  if(argc < 2){
-    printf(2, "not enough args\n");
-    exit();
+  char *name;
+
+  if(e->flags & TRACE_LOST){
+    printf(1, "TRACE: %d events lost\n", e->ret);
+    return;
   }
+  name = "?";
+  if(e->num > 0 && e->num < NSYSCALL && syscall_name[e->num])
+    name = syscall_name[e->num];
+  if(e->flags & TRACE_RET)
+    printf(1, "TRACE: pid = %d | command name = %s | syscall = %s | return value = %d\n",
+           e->pid, e->name, name, e->ret);
+  else
+    printf(1, "TRACE: pid = %d | command name = %s | syscall = %s\n",
+           e->pid, e->name, name);
+}
 
-  //adding option checking
-  int i, j;
-  const char* j_str;
-
-  //exclusive_flag = 0;
-
-  for(i = 1; i < argc; i++){
-    if(strcmp(argv[i], "-f") == 0){
-      set_fail_flag();
-      if(i + 2 < argc && strcmp(argv[i + 1], "-e") == 0){
-        for(j = 1; j < 24; j++){
-          j_str = syscall_name[j];
-          if(strcmp(argv[i + 2], j_str) == 0){
-            excid(j);  
-            t_toggle(TRACE_ON);  
-            exit();
-          }
-        }
-        printf(2, "Unknown syscall: %s\n", argv[i + 2]);
-        exit();
-      }
-      exit();
-    } else if(strcmp(argv[i], "-s") == 0){
-      set_success_flag();
-      if(i + 2 < argc && strcmp(argv[i + 1], "-e") == 0){
-        for(j = 1; j < 24; j++){
-          j_str = syscall_name[j];
-          if(strcmp(argv[i + 2], j_str) == 0){
-            excid(j);  
-            t_toggle(TRACE_ON);  
-            exit();
-          }
-        }
-        printf(2, "Unknown syscall: %s\n", argv[i + 2]);
-        exit();
-      }
-      exit();
-    } else if(strcmp(argv[i], "-e") == 0){
-      // Original -e handling remains the same
-      if(i + 1 >= argc){
-        printf(2, "strace -e needs a <syscall>\n");
-        exit();
-      }
-      
-      // Find and set exclusive flag for specified syscall
-      for(j = 1; j < 24; j++){
-        j_str = syscall_name[j];
-        if(strcmp(argv[i + 1], j_str) == 0){
-          excid(j);  // Set exclusive flag for this syscall
-          t_toggle(TRACE_ON);  // Enable tracing
-          exit();  // Exit and let user enter their command in shell
-        }
-      }
-      printf(2, "Unknown syscall: %s\n", argv[i + 1]);
-      exit();
+// The number of the system call called name, or -1.
+int
+callnum(char *name)
+{
+  int j;
+
+  for(j = 1; j < NSYSCALL; j++)
+    if(syscall_name[j] && strcmp(name, syscall_name[j]) == 0)
+      return j;
+  return -1;
+}
+
+// Set *mask to the calls in list, names separated by commas.
+// Returns -1 if a name is unknown.
+int
+setcalls(char *list, uint64 *mask)
+{
+  char name[32];
+  int n, num;
+
+  *mask = 0;
+  while(*list){
+    for(n = 0; list[n] && list[n] != ','; n++)
+      ;
+    if(n >= sizeof(name))
+      n = sizeof(name) - 1;
+    memmove(name, list, n);
+    name[n] = 0;
+    if((num = callnum(name)) < 0){
+      printf(2, "Unknown syscall: %s\n", name);
+      return -1;
     }
+    *mask |= TRACEBIT(num);
+    list += n;
+    while(*list && *list != ',')
+      list++;
+    if(*list == ',')
+      list++;
+  }
+  return 0;
+}
+
+// Print the events the kernel has buffered until none are left.
+void
+dump(void)
+{
+  int i, n;
+
+  while((n = tracedrain(ev, NEV)) > 0)
+    for(i = 0; i < n; i++)
+      printev(&ev[i]);
+}
+
+void
+usage(void)
+{
+  printf(2, "usage: strace [-e call,...] [-s|-f] [-p pid] [on|off]\n"
+            "       strace [-e call,...] [-s|-f|-c] run cmd [arg ...]\n"
+            "       strace -c [-p pid]\n"
+            "       strace dump\n");
+  exit();
+}
+
+// Print a number of cycles, in K (1024) or M cycles if large.
+void
+printcycles(uint64 c)
+{
+  if(c < (1 << 20))
+    printf(1, "%d", (uint)c);
+  else if(c < (1ULL << 30))
+    printf(1, "%dK", (uint)(c >> 10));
+  else
+    printf(1, "%dM", (uint)(c >> 20));
+}
+
+// The top of the histogram bucket that holds the pct'th
+// percentile latency of s.
+uint64
+percentile(struct callstat *s, int pct)
+{
+  uint64 need, sum;
+  int i;
+
+  // In 64 bits: count*pct overflows a uint past ~43M calls.
+  // Compare sum*100 rather than divide, to need no libgcc.
+  need = (uint64)s->count * pct;
+  sum = 0;
+  for(i = 0; i < NCALLHIST-1; i++){
+    sum += s->hist[i];
+    if(sum * 100 >= need)
+      break;
+  }
+  return 1ULL << (CALLHIST0 + 1 + i);
+}
+
+// Print the statistics of process pid (0: strace and the children
+// it waited for, -1: the whole system), most time first.
+// Percentiles are the tops of power of two histogram buckets.
+void
+summary(int pid)
+{
+  int i, j, done[NCALLSTAT];
+  uint calls, errors;
+  uint64 cycles;
+
+  if(tracestat(pid, st) < 0){
+    printf(2, "strace: no process %d\n", pid);
+    return;
+  }
+  printf(1, "calls\terrors\tcycles\tp50\tp99\tsyscall\n");
+  memset(done, 0, sizeof(done));
+  calls = errors = 0;
+  cycles = 0;
+  for(;;){
+    j = -1;
+    for(i = 1; i < NCALLSTAT; i++)
+      if(!done[i] && st[i].count && (j < 0 || st[i].cycles > st[j].cycles))
+        j = i;
+    if(j < 0)
+      break;
+    done[j] = 1;
+    printf(1, "%d\t%d\t", st[j].count, st[j].errors);
+    printcycles(st[j].cycles);
+    printf(1, "\t<");
+    printcycles(percentile(&st[j], 50));
+    printf(1, "\t<");
+    printcycles(percentile(&st[j], 99));
+    printf(1, "\t%s\n", j < NSYSCALL && syscall_name[j] ? syscall_name[j] : "?");
+    calls += st[j].count;
+    errors += st[j].errors;
+    cycles += st[j].cycles;
   }
+  printf(1, "%d\t%d\t", calls, errors);
+  printcycles(cycles);
+  printf(1, "\t\t\ttotal\n");
+}
 
-  if(strcmp(argv[1], "run") == 0){
-    if(argc < 3){
-        printf(2, "strace run <command>\n");
+// Each process has its own trace filter, which the processes it
+// forks inherit.  strace sets the filter of the shell that runs it
+// (on, off), of process pid (-p), or of a command it runs itself
+// (run), so traced workloads don't disturb each other.
+// With -c, strace prints latency statistics instead of calls:
+// those of a command it runs, of process pid or of the system.
+int
+main(int argc, char *argv[])
+{
+  uint64 mask;
+  int i, pid, when, count;
+
+  // Don't trace strace itself.
+  trace(0);
+
+  mask = TRACE_ALL;
+  when = TRACE_ANY;
+  pid = -1;
+  count = 0;
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+    if(strcmp(argv[i], "-s") == 0)
+      when = TRACE_OK;
+    else if(strcmp(argv[i], "-f") == 0)
+      when = TRACE_FAIL;
+    else if(strcmp(argv[i], "-c") == 0)
+      count = 1;
+    else if(strcmp(argv[i], "-e") == 0 && i + 1 < argc){
+      if(setcalls(argv[++i], &mask) < 0)
         exit();
+    } else if(strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+      pid = atoi(argv[++i]);
+    else
+      usage();
+  }
+
+  if(count && i == argc){
+    summary(pid);
+  } else if(count && strcmp(argv[i], "run") != 0){
+    usage();
+  } else if(i == argc || strcmp(argv[i], "on") == 0){
+    if(pid == -1 && i == argc)
+      usage();
+    if(settrace(pid, (uint)mask, (uint)(mask >> 32), when) < 0)
+      printf(2, "strace: no process %d\n", pid);
+  } else if(strcmp(argv[i], "off") == 0){
+    if(settrace(pid, 0, 0, TRACE_ANY) < 0)
+      printf(2, "strace: no process %d\n", pid);
+  } else if(strcmp(argv[i], "run") == 0){
+    if(i + 1 >= argc)
+      usage();
+    pid = fork();
+    if(pid < 0){
+      printf(2, "strace: fork failed\n");
+      exit();
     }
-    
-    // Check trace_flag and make copy
-    int was_tracing = get_trace_flag();
-    t_toggle(TRACE_ON);
-    
-    int pid = fork();
     if(pid == 0){
-        if(exec(argv[2], &argv[2]) < 0){
-            printf(2, "exec failed: %s\n", argv[2]);
-            exit();
-        }
-    } else if (pid > 0) {
-        wait();
-        t_toggle(was_tracing);
-    } else {
-        printf(2, "fork failed\n");
-        exit();
+      settrace(0, (uint)mask, (uint)(mask >> 32), count ? TRACE_COUNT : when);
+      exec(argv[i + 1], &argv[i + 1]);
+      printf(2, "strace: exec %s failed\n", argv[i + 1]);
+      exit();
     }
-  } else if(strcmp(argv[1], "on") == 0){
-    t_toggle(TRACE_ON);
-  } else if(strcmp(argv[1], "off") == 0){
-    t_toggle(TRACE_OFF);
-  } else {
-    printf(2, "Invalid argument.\n");
-    exit();
-  }
+    wait();
+    if(count)
+      summary(0);
+    else
+      dump();
+  } else if(strcmp(argv[i], "dump") == 0){
+    dump();
+  } else
+    usage();
   exit();
-  return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,264 @@
+// Swap.
+//
+// When kalloc() runs out of memory, the kernel thread kswapd
+// writes cold user pages to the swap area that mkfs leaves after
+// the file system, and frees them.  A swapped-out page's PTE is
+// left not present, marked PTE_SWAP, with the number of its swap
+// slot where the physical address was; pagein() reads the page
+// back when the process touches it.
+//
+// kswapd picks pages with the clock (second chance) algorithm,
+// sweeping over the processes' user memory: a page the processor
+// has marked accessed (PTE_A) since the hand last passed has the
+// mark cleared and is passed over, an unmarked one is evicted.
+//
+// Only pages of processes marked swappable are taken, with the
+// process locked so it cannot run meanwhile: those preempted in
+// user space, and those asleep in wait() or sleep(), which return
+// to user space without touching user memory.  Such a process is
+// not in the kernel using its memory, perhaps holding a spinlock,
+// where a fault could not wait for the disk.
+// Pages shared with another process (copy-on-write after fork,
+// or through the page cache) are left alone.
+//
+// fork() shares swapped-out pages too: each slot counts the PTEs
+// that refer to it.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "proc.h"
+#include "fs.h"
+#include "buf.h"
+
+struct {
+  struct spinlock lock;
+  int dev;
+  uint start;                // first block of the swap area
+  int nslot;                 // pages it holds; 0 if no swap
+  ushort ref[NSWAPPAGE];     // PTEs referring to each slot
+  uchar busy[NSWAPPAGE];     // being written out by kswapd
+  int next;                  // where swapalloc() looks first
+  int wanted;                // kswapd should make a pass
+  int passes;                // passes kswapd has made
+  int freed;                 // pages freed by the last pass
+  int hand;                  // clock hand: process table slot
+  uint handva;               //   and address in it
+} swap;
+
+// Buffers for swaprw(), too big for a kernel stack: one set for
+// kswapd's writes, one for swapread()s, taken in turn.
+static struct swapio {
+  struct sleeplock lock;
+  struct buf b[PGSIZE/BSIZE];
+} swapio[2];
+
+static void kswapd(void);
+
+void
+swapinit(int dev)
+{
+  struct superblock sb;
+  int i, j;
+
+  initlock(&swap.lock, "swap");
+  for(i = 0; i < NELEM(swapio); i++){
+    initsleeplock(&swapio[i].lock, "swapio");
+    for(j = 0; j < PGSIZE/BSIZE; j++)
+      initsleeplock(&swapio[i].b[j].lock, "swapbuf");
+  }
+  readsb(dev, &sb);
+  if(sb.nswap == 0)
+    return;   // made by an older mkfs
+  swap.dev = dev;
+  swap.start = sb.swapstart;
+  swap.nslot = sb.nswap < NSWAPPAGE ? sb.nswap : NSWAPPAGE;
+  kthread("kswapd", kswapd);
+}
+
+// Read or write the page in slot straight from or to page,
+// all its blocks in one go.
+static void
+swaprw(int slot, char *page, int write)
+{
+  struct swapio *io;
+  struct buf *bv[PGSIZE/BSIZE];
+  int i;
+
+  io = &swapio[write != 0];
+  acquiresleep(&io->lock);
+  for(i = 0; i < PGSIZE/BSIZE; i++){
+    bv[i] = &io->b[i];
+    bv[i]->dev = swap.dev;
+    bv[i]->blockno = swap.start + slot*(PGSIZE/BSIZE) + i;
+    bv[i]->data = (uchar*)page + i*BSIZE;
+    bv[i]->flags = write ? B_DIRTY : 0;
+    bv[i]->qnext = 0;
+    acquiresleep(&bv[i]->lock);
+  }
+  iderwv(bv, PGSIZE/BSIZE);
+  for(i = 0; i < PGSIZE/BSIZE; i++)
+    releasesleep(&bv[i]->lock);
+  releasesleep(&io->lock);
+}
+
+// Allocate a swap slot for a page kswapd is about to write out.
+// Returns -1 if swap is full.
+int
+swapalloc(void)
+{
+  int i, s;
+
+  acquire(&swap.lock);
+  for(i = 0; i < swap.nslot; i++){
+    s = (swap.next + i) % swap.nslot;
+    if(swap.ref[s] == 0 && !swap.busy[s]){
+      swap.ref[s] = 1;
+      swap.busy[s] = 1;
+      swap.next = (s + 1) % swap.nslot;
+      release(&swap.lock);
+      return s;
+    }
+  }
+  release(&swap.lock);
+  return -1;
+}
+
+// Another PTE refers to slot.
+void
+swapdup(int slot)
+{
+  acquire(&swap.lock);
+  swap.ref[slot]++;
+  release(&swap.lock);
+}
+
+// A PTE no longer refers to slot.
+void
+swapfree(int slot)
+{
+  acquire(&swap.lock);
+  if(swap.ref[slot] == 0)
+    panic("swapfree");
+  swap.ref[slot]--;
+  release(&swap.lock);
+}
+
+// Read the page in slot into page, once kswapd has finished
+// writing it out.
+void
+swapread(int slot, char *page)
+{
+  acquire(&swap.lock);
+  while(swap.busy[slot])
+    sleep(&swap.busy[slot], &swap.lock);
+  release(&swap.lock);
+  swaprw(slot, page, 0);
+}
+
+// Evict up to n (at most SWAPBATCH) pages.
+// Returns the number of pages freed.
+static int
+swapout(int n)
+{
+  char *page[SWAPBATCH];
+  int slot[SWAPBATCH];
+  struct proc *p;
+  int i, nv, visits, more;
+
+  if(n > SWAPBATCH)
+    n = SWAPBATCH;
+  nv = 0;
+  // Go round the process table twice at most: the first time
+  // round may only clear accessed bits.
+  for(visits = 0; nv < n && visits <= 2*NPROC; visits++){
+    p = procslot(swap.hand);
+    more = 0;
+    acquire(&p->lock);
+    if((p->state == RUNNABLE || p->state == SLEEPING) && p->swappable){
+      nv += uvmswapout(p->pgdir, p->sz, &swap.handva,
+                       page + nv, slot + nv, n - nv);
+      more = swap.handva < p->sz;
+      p->tlbcpu = -1;  // a CPU's TLB may still hold the old PTEs
+    }
+    release(&p->lock);
+    if(more && nv < n)
+      break;  // swap is full
+    if(!more){
+      swap.hand = (swap.hand + 1) % NPROC;
+      swap.handva = 0;
+    }
+  }
+
+  // The pages are unmapped; the processes that had them can run
+  // again, and wait in swapread() if they touch one too soon.
+  for(i = 0; i < nv; i++){
+    swaprw(slot[i], page[i], 1);
+    acquire(&swap.lock);
+    swap.busy[slot[i]] = 0;
+    release(&swap.lock);
+    wakeup(&swap.busy[slot[i]]);
+    kfree(page[i]);
+  }
+  return nv;
+}
+
+static void
+kswapd(void)
+{
+  int n;
+
+  for(;;){
+    acquire(&swap.lock);
+    while(!swap.wanted)
+      sleep(&swap.wanted, &swap.lock);
+    swap.wanted = 0;
+    release(&swap.lock);
+
+    n = swapout(SWAPBATCH);
+
+    acquire(&swap.lock);
+    swap.freed = n;
+    swap.passes++;
+    release(&swap.lock);
+    wakeup(&swap.passes);
+  }
+}
+
+// Called by kalloc() when memory has run out: start kswapd on a
+// pass and wait for it.  Returns the number of pages it freed, or
+// 0 at once if there is no swap or the caller holds a spinlock and
+// so cannot sleep (kswapd's pages come in handy for the next
+// allocation).
+int
+swapwait(void)
+{
+  int pass, n, ncli;
+
+  if(swap.nslot == 0)
+    return 0;
+  pushcli();
+  ncli = cpu->ncli;
+  popcli();
+
+  acquire(&swap.lock);
+  n = !swap.wanted;
+  swap.wanted = 1;
+  pass = swap.passes;
+  release(&swap.lock);
+  if(n)
+    wakeup(&swap.wanted);
+  if(proc == 0 || ncli > 1)
+    return 0;
+
+  acquire(&swap.lock);
+  while(swap.passes == pass)
+    sleep(&swap.passes, &swap.lock);
+  n = swap.freed;
+  release(&swap.lock);
+  return n;
+}
@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
@@ -20,6 +21,8 @@ fetchint(uint addr, int *ip)
 {
   if(addr >= proc->sz || addr+4 > proc->sz)
     return -1;
+  if(uvmprefault(addr, 4, 0) < 0)
+    return -1;
   *ip = *(int*)(addr);
   return 0;
 }
@@ -36,9 +39,12 @@ fetchstr(uint addr, char **pp)
     return -1;
   *pp = (char*)addr;
   ep = (char*)proc->sz;
-  for(s = *pp; s < ep; s++)
+  for(s = *pp; s < ep; s++){
+    if((s == *pp || ((uint)s % PGSIZE) == 0) && uvmprefault((uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
+  }
   return -1;
 }
 
@@ -49,11 +55,8 @@ argint(int n, int *ip)
   return fetchint(proc->tf->esp + 4 + 4*n, ip);
 }
 
-// Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
-int
-argptr(int n, char **pp, int size)
+static int
+argmem(int n, char **pp, int size, int write)
 {
   int i;
 
@@ -61,10 +64,30 @@ argptr(int n, char **pp, int size)
     return -1;
   if(size < 0 || (uint)i >= proc->sz || (uint)i+size > proc->sz)
     return -1;
+  if(uvmprefault(i, size, write) < 0)
+    return -1;
   *pp = (char*)i;
   return 0;
 }
 
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+  return argmem(n, pp, size, 0);
+}
+
+// Like argptr(), for a block the kernel will write to: break
+// copy-on-write sharing now, since the kernel cannot take a
+// fault on it.
+int
+argptrw(int n, char **pp, int size)
+{
+  return argmem(n, pp, size, 1);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -103,17 +126,12 @@ extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_trace(void);
-extern int sys_t_toggle(void);
-extern int sys_excid(void);
-extern int sys_get_trace_flag(void);
-extern int sys_set_success_flag(void);
-extern int sys_set_fail_flag(void);
-extern int trace_flag;
-
-int shell_reading_command = 0;
-int exclusive_flag = 0;
-int success_flag = 0;
-int fail_flag = 0;
+extern int sys_assign_nice(void);
+extern int sys_readahead(void);
+extern int sys_dropcache(void);
+extern int sys_tracedrain(void);
+extern int sys_settrace(void);
+extern int sys_tracestat(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -138,240 +156,50 @@ static int (*syscalls[])(void) = {
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
 [SYS_trace]   sys_trace,
-[SYS_t_toggle] sys_t_toggle,
-[SYS_excid]   sys_excid,
-[SYS_get_trace_flag] sys_get_trace_flag,
-[SYS_set_success_flag] sys_set_success_flag,
-[SYS_set_fail_flag] sys_set_fail_flag,
+[SYS_assign_nice] sys_assign_nice,
+[SYS_readahead] sys_readahead,
+[SYS_dropcache] sys_dropcache,
+[SYS_tracedrain] sys_tracedrain,
+[SYS_settrace] sys_settrace,
+[SYS_tracestat] sys_tracestat,
 };
 
-static char *syscall_name[] = {
-  [SYS_fork]    "fork",
-  [SYS_exit]    "exit",
-  [SYS_wait]    "wait",
-  [SYS_pipe]    "pipe",
-  [SYS_read]    "read",
-  [SYS_kill]    "kill",
-  [SYS_exec]    "exec",
-  [SYS_fstat]   "fstat",
-  [SYS_chdir]   "chdir",
-  [SYS_dup]     "dup",
-  [SYS_getpid]  "getpid",
-  [SYS_sbrk]    "sbrk",
-  [SYS_sleep]   "sleep",
-  [SYS_uptime]  "uptime",
-  [SYS_open]    "open",
-  [SYS_write]   "write",
-  [SYS_mknod]   "mknod",
-  [SYS_unlink]  "unlink",
-  [SYS_link]    "link",
-  [SYS_mkdir]   "mkdir",
-  [SYS_close]   "close",
-  [SYS_trace]  "trace",
-  [SYS_t_toggle] "t_toggle",
-  [SYS_excid]   "excid",
-  [SYS_get_trace_flag] "get_trace_flag",
-  [SYS_set_success_flag] "set_success_flag",
-  [SYS_set_fail_flag] "set_fail_flag",
-};
+// Does a call that returned ret pass a trace filter's result test?
+static int
+tracematch(int when, int ret)
+{
+  switch(when){
+  case TRACE_ANY:
+    return 1;
+  case TRACE_OK:
+    return ret >= 0;
+  case TRACE_FAIL:
+    return ret < 0;
+  }
+  return 0;
+}
 
 void
 syscall(void)
 {
-  int num;
-  int return_value;
+  int num, ret, traced;
+  uint64 t0;
 
   num = proc->tf->eax;
-  if (proc->tracer && strncmp(proc->name, "strace", 6) != 0) {
-    const char *syscall_name_str = syscall_name[num];
-    if(syscall_name_str && exclusive_flag && success_flag){
-        // cprintf("DEBUG: Handling syscall with exclusive=%d success=%d flags\n", exclusive_flag, success_flag);
-        if(num == exclusive_flag){
-            if(num == SYS_exit) {
-                // Print before exit, don't check return value
-                cprintf("TRACE: pid = %d | command name = %s | syscall = %s\n", 
-                        proc->pid, proc->name, syscall_name_str);
-                exclusive_flag = 0;
-                success_flag = 0;
-                proc->tracer = 0;
-                return_value = syscalls[num]();
-            } else {
-                // For non-exit syscalls, check return value
-                return_value = syscalls[num]();
-                if(return_value >= 0) {
-                    cprintf("TRACE: pid = %d | command name = %s | syscall = %s | return value = %d\n", 
-                            proc->pid, proc->name, syscall_name_str, return_value);
-                }
-            }
-        } else {
-            if (num == SYS_exit) {
-                exclusive_flag = 0;
-                success_flag = 0;
-            }
-            return_value = syscalls[num]();
-        }
-        proc->tf->eax = return_value;
-        return;
-    }
-    else if(syscall_name_str && exclusive_flag && fail_flag){
-        if(num == exclusive_flag){
-            if(num == SYS_exit) {
-                // Print before exit, don't check return value for exit
-                cprintf("TRACE: pid = %d | command name = %s | syscall = %s\n", 
-                        proc->pid, proc->name, syscall_name_str);
-                exclusive_flag = 0;
-                fail_flag = 0;
-                proc->tracer = 0;
-                return_value = syscalls[num]();
-            } else {
-                // For non-exit syscalls, check for failure
-                return_value = syscalls[num]();
-                if(return_value < 0) {
-                    cprintf("TRACE: pid = %d | command name = %s | syscall = %s | return value = %d\n", 
-                            proc->pid, proc->name, syscall_name_str, return_value);
-                }
-            }
-        } else {
-            if (num == SYS_exit) {
-                exclusive_flag = 0;
-                fail_flag = 0;
-            }
-            return_value = syscalls[num]();
-        }
-        proc->tf->eax = return_value;
-        return;
-    }
-    else if(syscall_name_str && exclusive_flag){
-        // cprintf("DEBUG: Handling syscall with exclusive=%d flag only\n", exclusive_flag);
-        if(num == exclusive_flag){
-            cprintf("TRACE: pid = %d | command name = %s | syscall = %s", 
-                    proc->pid, proc->name, syscall_name_str);
-            
-            return_value = syscalls[num]();
-            
-            cprintf(" | return value = %d\n", return_value);
-            
-            // If this syscall is exit and it's not from the shell,
-            // clear the exclusive flag and tracing
-            if(num == SYS_exit && strncmp(proc->name, "sh", 2) != 0){
-                exclusive_flag = 0;
-                proc->tracer = 0;
-            }
-        } else {
-            if (num == SYS_exit) {
-                exclusive_flag = 0;
-            }
-            // Just execute the syscall without tracing if it's not the one we're watching
-            return_value = syscalls[num]();
-        }
-        proc->tf->eax = return_value;
-        return;
-    }
-    else if(syscall_name_str && success_flag){
-        // cprintf("DEBUG: Handling syscall with success=%d flag only\n", success_flag);
-        // Store the flag for next shellcmd after strace on
-        if (!trace_flag) {
-            return_value = syscalls[num]();
-            proc->tf->eax = return_value;
-            return;
-        }
-        
-        // clear flags
-        if(num == SYS_exit) {
-            cprintf("TRACE: pid = %d | command name = %s | syscall = %s\n", 
-                    proc->pid, proc->name, syscall_name_str, success_flag, fail_flag);
-            success_flag = 0;
-            proc->tracer = 0;
-            return_value = syscalls[num]();
-        } else {
-            return_value = syscalls[num]();
-            if(return_value >= 0) {
-                cprintf("TRACE: pid = %d | command name = %s | syscall = %s | return value = %d\n", 
-                        proc->pid, proc->name, syscall_name_str, return_value, success_flag, fail_flag);
-            }
-        }
-        
-        proc->tf->eax = return_value;
-        return;
-    }
-    else if(syscall_name_str && fail_flag){
-        // cprintf("DEBUG: Handling syscall with fail=%d flag only\n", fail_flag);
-        // Store the flag for next shellcmd after strace on
-        if (!trace_flag) {
-            return_value = syscalls[num]();
-            proc->tf->eax = return_value;
-            return;
-        }
-        
-        // clear flags
-        if(num == SYS_exit) {
-            fail_flag = 0;
-            proc->tracer = 0;
-            return_value = syscalls[num]();
-        } else {
-            return_value = syscalls[num]();
-            if(return_value < 0) {
-                cprintf("TRACE: pid = %d | command name = %s | syscall = %s | return value = %d\n", 
-                        proc->pid, proc->name, syscall_name_str, return_value, success_flag, fail_flag);
-            }
-        }
-        
-        proc->tf->eax = return_value;
-        return;
-    }
-    else if (syscall_name_str && exclusive_flag == 0) {
-      if (strncmp(proc->name, "sh", 2) == 0) {
-        cprintf("TRACE: pid = %d | command name = %s | syscall = %s", 
-                  proc->pid, proc->name, syscall_name_str);
-                  return_value = syscalls[num]();
-          cprintf(" | return value = %d\n", return_value);
-          proc->tf->eax = return_value;
-        
-        // Only trace the shell's read syscall when reading a command
-        if (shell_reading_command || num == SYS_exec) {
-          cprintf("TRACE: pid = %d | command name = %s | syscall = %s", 
-                  proc->pid, proc->name, syscall_name_str);
-                  return_value = syscalls[num]();
-          cprintf(" | return value = %d\n", return_value);
-          proc->tf->eax = return_value;
-          return;
-        }
-      } 
-      else {
-        // Trace non-shell processes normally
-        if (num == SYS_write) {
-          return_value = syscalls[num]();
-          cprintf("TRACE: pid = %d | command name = %s | syscall = %s | return value = %d\n", 
-                  proc->pid, proc->name, syscall_name_str, return_value);
-          proc->tf->eax = return_value;
-        } else {
-          // space after sys call exit
-          if (num == SYS_exit) {
-            cprintf("TRACE: pid = %d | command name = %s | syscall = %s", 
-                    proc->pid, proc->name, syscall_name_str);
-            cprintf(" | return value = 0\n");  
-            return_value = syscalls[num]();  
-            proc->tf->eax = return_value;
-          } else {
-            cprintf("TRACE: pid = %d | command name = %s | syscall = %s", 
-                    proc->pid, proc->name, syscall_name_str);
-            return_value = syscalls[num]();
-            cprintf(" | return value = %d\n", return_value);
-            proc->tf->eax = return_value;
-          }
-        }
-      }
-    } /*else {
-      cprintf("TRACE: pid = %d | command name = %s | unknown syscall\n", 
-              proc->pid, proc->name);
-      proc->tf->eax = -1;
-    }*/
-  } else {
-    if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
-      proc->tf->eax = syscalls[num]();
-    } else {
-      cprintf("%d %s: unknown sys call %d\n", proc->pid, proc->name, num);
-      proc->tf->eax = -1;
-    }
+  if(num <= 0 || num >= NELEM(syscalls) || !syscalls[num]){
+    cprintf("%d %s: unknown sys call %d\n", proc->pid, proc->name, num);
+    proc->tf->eax = -1;
+    return;
   }
-}
\ No newline at end of file
+  traced = (proc->tracemask & TRACEBIT(num)) != 0;
+
+  // exit() does not return: record it now, as a success.
+  if(traced && num == SYS_exit && tracematch(proc->tracewhen, 0))
+    traceput(num, 0, 0);
+  t0 = rdtsc();
+  ret = syscalls[num]();
+  tracecount(num, ret, rdtsc() - t0);
+  if(traced && tracematch(proc->tracewhen, ret))
+    traceput(num, ret, TRACE_RET);
+  proc->tf->eax = ret;
+}
@@ -21,8 +21,9 @@
 #define SYS_mkdir  20
 #define SYS_close  21
 #define SYS_trace 22
-#define SYS_t_toggle 23
-#define SYS_excid 24
-#define SYS_get_trace_flag 25
-#define SYS_set_success_flag 26
-#define SYS_set_fail_flag 27
\ No newline at end of file
+#define SYS_assign_nice 28
+#define SYS_readahead 29
+#define SYS_dropcache 30
+#define SYS_tracedrain 31
+#define SYS_settrace 32
+#define SYS_tracestat 33
\ No newline at end of file
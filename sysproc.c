@@ -5,6 +5,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "trace.h"
 
@@ -72,6 +73,7 @@ sys_sleep(void)
       release(&tickslock);
       return -1;
     }
+    proc->swappable = 1;  // see wait()
     sleep(&ticks, &tickslock);
   }
   release(&tickslock);
@@ -99,45 +101,73 @@ sys_trace(void)
     if(argint(0, &on_off) < 0)  // Get argument (0 or 1) from user space
         return -1;
 
-    proc->tracer = on_off;  // Set the process's tracer flag directly
+    proc->tracemask = on_off ? TRACE_ALL : 0;
+    proc->tracewhen = TRACE_ANY;
     return 0;
 }
 
-int sys_t_toggle(void)
+// tracedrain(ev, n) moves up to n buffered trace events into
+// ev[] and returns how many it moved.
+int
+sys_tracedrain(void)
 {
-    int on_off;
-
-    if (argint(0, &on_off) < 0)
-        return -1;
+  struct traceev *ev;
+  int n;
 
-    trace_flag = on_off;
-    return 0;
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  // No more can be buffered; also keeps n*sizeof(*ev) from wrapping.
+  if(n > NCPU*(TRACERING+1))
+    n = NCPU*(TRACERING+1);
+  if(argptrw(0, (char**)&ev, n*sizeof(*ev)) < 0)
+    return -1;
+  return tracedrain(ev, n);
 }
 
-int sys_excid(void)
+// assign_nice(pid, nice) returns the old nice value of pid,
+// -100 if nice is out of range or -101 if pid does not exist;
+// these are the codes nice(1) reports.
+int sys_assign_nice(void)
 {
-    int sysid;
+    int pid, nice, old;
 
-    if (argint(0, &sysid) < 0)
+    if (argint(0, &pid) < 0 || argint(1, &nice) < 0)
         return -1;
-
-    exclusive_flag = sysid;
-    return 0;
+    if (nice < NICEMIN || nice > NICEMAX)
+        return -100;
+    if ((old = setnice(pid, nice)) < 0)
+        return -101;
+    return old;
 }
 
-int sys_get_trace_flag(void)
+// settrace(pid, lo, hi, when) sets the trace filter of process
+// pid: the calls whose bits are set in the 64-bit mask hi:lo,
+// reported when they end as when (TRACE_ANY, TRACE_OK,
+// TRACE_FAIL) says, or only counted (TRACE_COUNT).  pid 0 is
+// the caller, -1 the caller's parent.
+int
+sys_settrace(void)
 {
-    return trace_flag;
-}
+  int pid, lo, hi, when;
 
-int sys_set_success_flag(void)
-{
-    success_flag = 1;
-    return 0;
+  if(argint(0, &pid) < 0 || argint(1, &lo) < 0 ||
+     argint(2, &hi) < 0 || argint(3, &when) < 0)
+    return -1;
+  if(when < TRACE_ANY || when > TRACE_COUNT)
+    return -1;
+  return settrace(pid, ((uint64)(uint)hi << 32) | (uint)lo, when);
 }
 
-int sys_set_fail_flag(void)
+// tracestat(pid, st) copies the system call statistics of pid
+// (0: the caller, -1: the whole system) into st[NCALLSTAT].
+int
+sys_tracestat(void)
 {
-    fail_flag = 1;
-    return 0;
-}
\ No newline at end of file
+  struct callstat *st;
+  int pid;
+
+  if(argint(0, &pid) < 0 ||
+     argptrw(1, (char**)&st, NCALLSTAT*sizeof(*st)) < 0)
+    return -1;
+  return tracestat(pid, st);
+}
@@ -1,2 +1,202 @@
-int show_success_only = 0;
-int show_failures_only = 0; 
\ No newline at end of file
+// System call trace buffer.
+//
+// syscall() records each traced call as a fixed-size struct
+// traceev in a ring belonging to the CPU it runs on, instead of
+// printing it on the console while the call runs.  Only that CPU
+// writes to its ring, with interrupts off, so recording takes no
+// lock; when the ring is full the event is dropped and counted.
+// strace reads the events back with tracedrain(), which merges
+// the rings into time order.
+//
+// syscall() also times every call and keeps latency histograms
+// (struct callstat) per CPU, summed up by tracestat(), and for
+// the calls a process traces, in a page of the process's own.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "proc.h"
+#include "trace.h"
+
+struct tracering {
+  volatile uint head;     // events written; only this CPU changes it
+  volatile uint tail;     // events read; only tracedrain() changes it
+  volatile uint dropped;  // events lost to a full ring
+  struct traceev ev[TRACERING];
+};
+
+static struct tracering ring[NCPU];
+static struct sleeplock drainlock;   // one tracedrain() at a time
+
+// Only the CPU itself changes its statistics, with interrupts off.
+static struct callstat cpustat[NCPU][NCALLSTAT];
+
+void
+traceinit(void)
+{
+  initsleeplock(&drainlock, "tracedrain");
+}
+
+// Record that the current process made system call num; ret is
+// its return value if flags has TRACE_RET.
+void
+traceput(int num, int ret, int flags)
+{
+  struct tracering *r;
+  struct traceev *e;
+
+  pushcli();
+  r = &ring[cpu - cpus];
+  if(r->head - r->tail >= TRACERING){
+    __sync_fetch_and_add(&r->dropped, 1);
+  } else {
+    e = &r->ev[r->head % TRACERING];
+    e->tsc = rdtsc();
+    e->pid = proc->pid;
+    e->num = num;
+    e->flags = flags;
+    e->ret = ret;
+    safestrcpy(e->name, proc->name, sizeof(e->name));
+    __sync_synchronize();  // the event is written before head moves
+    r->head++;
+  }
+  popcli();
+}
+
+// Move up to n events into ev, oldest first, starting with a
+// TRACE_LOST event for each ring that has dropped some.
+// Returns the number of events.
+int
+tracedrain(struct traceev *ev, int n)
+{
+  struct tracering *r, *first;
+  int i, c;
+  uint lost;
+
+  acquiresleep(&drainlock);
+  i = 0;
+  for(c = 0; c < ncpu && i < n; c++){
+    r = &ring[c];
+    if(r->dropped == 0)
+      continue;
+    lost = __sync_lock_test_and_set(&r->dropped, 0);
+    memset(&ev[i], 0, sizeof(ev[i]));
+    ev[i].flags = TRACE_LOST;
+    ev[i].ret = lost;
+    i++;
+  }
+  while(i < n){
+    first = 0;
+    for(c = 0; c < ncpu; c++){
+      r = &ring[c];
+      if(r->tail != r->head &&
+         (first == 0 || r->ev[r->tail % TRACERING].tsc <
+                        first->ev[first->tail % TRACERING].tsc))
+        first = r;
+    }
+    if(first == 0)
+      break;
+    ev[i++] = first->ev[first->tail % TRACERING];
+    __sync_synchronize();  // the event is copied before tail moves
+    first->tail++;
+  }
+  releasesleep(&drainlock);
+  return i;
+}
+
+static void
+countcall(struct callstat *st, int ret, uint64 cycles)
+{
+  int i;
+
+  st->count++;
+  if(ret < 0)
+    st->errors++;
+  st->cycles += cycles;
+  for(i = 0; i < NCALLHIST-1 && (cycles >> (CALLHIST0+1+i)) != 0; i++)
+    ;
+  st->hist[i]++;
+}
+
+static void
+addstats(struct callstat *to, struct callstat *from)
+{
+  int i, j;
+
+  for(i = 0; i < NCALLSTAT; i++){
+    to[i].count += from[i].count;
+    to[i].errors += from[i].errors;
+    to[i].cycles += from[i].cycles;
+    for(j = 0; j < NCALLHIST; j++)
+      to[i].hist[j] += from[i].hist[j];
+  }
+}
+
+// The current process's system call num returned ret after
+// taking cycles cycles.
+void
+tracecount(int num, int ret, uint64 cycles)
+{
+  if(num >= NCALLSTAT)
+    return;
+  pushcli();
+  countcall(&cpustat[cpu - cpus][num], ret, cycles);
+  popcli();
+
+  if((proc->tracemask & TRACEBIT(num)) == 0)
+    return;
+  if(proc->callstat == 0 &&
+     (proc->callstat = (struct callstat*)kzalloc()) == 0)
+    return;
+  countcall(&proc->callstat[num], ret, cycles);
+}
+
+// wait() is freeing zombie p: the current process, its parent,
+// takes over p's statistics.  Caller holds ptable.lock.
+void
+tracereap(struct proc *p)
+{
+  if(p->callstat == 0)
+    return;
+  if(proc->callstat == 0)
+    proc->callstat = p->callstat;
+  else {
+    addstats(proc->callstat, p->callstat);
+    kfree((char*)p->callstat);
+  }
+  p->callstat = 0;
+}
+
+// Copy the statistics of process pid, of the current process if
+// pid is 0, or of the whole system if pid is -1 into st, which
+// has room for NCALLSTAT.  Returns -1 if there is no such process.
+int
+tracestat(int pid, struct callstat *st)
+{
+  struct callstat *buf;
+  int c;
+
+  memset(st, 0, NCALLSTAT*sizeof(*st));
+  if(pid == -1){
+    for(c = 0; c < ncpu; c++)
+      addstats(st, cpustat[c]);
+    return 0;
+  }
+  if(pid == 0)
+    pid = proc->pid;
+  // The statistics can go with their process once ptable.lock
+  // is released; copy them out while holding it.
+  if((buf = (struct callstat*)kalloc()) == 0)
+    return -1;
+  if(procstat(pid, buf) < 0){
+    kfree((char*)buf);
+    return -1;
+  }
+  memmove(st, buf, NCALLSTAT*sizeof(*st));
+  kfree((char*)buf);
+  return 0;
+}
@@ -1,7 +1,45 @@
 #define TRACE_ON 1
 #define TRACE_OFF 0
 
-extern int trace_flag;
-extern int exclusive_flag;
-extern int success_flag;
-extern int fail_flag;
\ No newline at end of file
+// A traced system call, as tracedrain() hands it to strace.
+struct traceev {
+  uint64 tsc;        // rdtsc() when it was recorded
+  int pid;
+  short num;         // system call number
+  short flags;
+  int ret;           // return value if TRACE_RET; events lost if TRACE_LOST
+  char name[16];     // command name
+};
+
+#define TRACE_RET   0x1  // ret holds the call's return value
+#define TRACE_LOST  0x2  // not a call: ret events were dropped, ring full
+
+// A traced process records the calls whose bits are set in its
+// tracemask, if their results pass its tracewhen test.
+#define TRACEBIT(num)  (1ULL << (num))
+#define TRACE_ALL      (~0ULL)
+
+#define TRACE_ANY   0  // any result
+#define TRACE_OK    1  // only calls that succeed (return >= 0)
+#define TRACE_FAIL  2  // only calls that fail (return < 0)
+#define TRACE_COUNT 3  // none; just count them (see struct callstat)
+
+// Latency statistics of one system call, from rdtsc() at its start
+// and end.  hist[i] counts the calls that took from 2^(i+8) up to
+// 2^(i+9) cycles; hist[0] also counts faster ones and the last
+// bucket slower ones.  The kernel keeps them for the whole system
+// and, for the calls in its tracemask, for each process; a process
+// takes over the statistics of the children it waits for.
+#define NCALLHIST 24
+#define CALLHIST0 8    // log2 of the cycles at the top of hist[0]'s range
+
+struct callstat {
+  uint count;
+  uint errors;       // calls that returned < 0
+  uint64 cycles;     // total
+  uint hist[NCALLHIST];
+};
+
+// System calls numbered below NCALLSTAT are counted; one
+// process's struct callstat[NCALLSTAT] fits in a page.
+#define NCALLSTAT 36
@@ -3,10 +3,10 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
@@ -53,6 +53,10 @@ trap(struct trapframe *tf)
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
+#ifdef MLFQ
+      if(ticks % MLFQBOOST == 0)
+        mlfqboost();
+#endif
     }
     lapiceoi();
     break;
@@ -78,6 +82,16 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // A lazily allocated, swapped-out or copy-on-write page,
+    // touched by the process.  The kernel prefaults user memory
+    // before using it, so a fault in the kernel is a bug, and
+    // panics below.
+    statinc(ST_PGFAULT);
+    if(proc && pgfault(rcr2(), tf->err) == 0)
+      break;
+    // fall through
+
   //PAGEBREAK: 13
   default:
     if(proc == 0 || (tf->cs&3) == 0){
@@ -100,10 +114,16 @@ trap(struct trapframe *tf)
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU on clock tick once its time
+  // slice is used up.
   // If interrupts were on while locks held, would need to check nlock.
-  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER)
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER &&
+     timeslice()){
+    // Preempted in user space, the process is using none of its
+    // memory in the kernel, so swapping its pages out is safe.
+    proc->swappable = (tf->cs&3) == DPL_USER;
     yield();
+  }
 
   // Check if the process has been killed since we yielded
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
@@ -1,6 +1,8 @@
 #include "types.h"
 struct stat;
 struct rtcdate;
+struct traceev;
+struct callstat;
 
 // system calls
 int fork(void);
@@ -25,11 +27,12 @@ char* sbrk(int);
 int sleep(int);
 int uptime(void);
 int trace(int);
-int t_toggle(int);
-int excid(int);
-int get_trace_flag(void);
-int set_success_flag(void);
-int set_fail_flag(void);
+int assign_nice(int, int);
+int readahead(int);
+int dropcache(void);
+int tracedrain(struct traceev*, int);
+int settrace(int, uint, uint, int);
+int tracestat(int, struct callstat*);
 int race(void);
 
 // ulib.c
@@ -4,8 +4,12 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "elf.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -51,10 +55,9 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+    // kzalloc() makes sure all those PTE_P bits are zero.
+    if(!alloc || (pgtab = (pte_t*)kzalloc()) == 0)
       return 0;
-    // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -88,6 +91,39 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
   return 0;
 }
 
+// Like mappages(), but map each whole 4MB-aligned stretch with
+// one 4MB page (PTE_PS) in the page directory itself, which needs
+// no page table and only one TLB entry.  For the kernel's part of
+// the address space only: walkpgdir() cannot look inside PTE_PS
+// entries.  The mappings are global (PTE_G): they are the same in
+// every page directory, so loading %cr3 need not flush them.
+static int
+kmappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
+{
+  uint a, n;
+
+  a = (uint)va;
+  perm |= PTE_G;
+  while(size > 0){
+    if(a % PTSIZE == 0 && pa % PTSIZE == 0 && size >= PTSIZE){
+      if(pgdir[PDX(a)] & PTE_P)
+        panic("remap");
+      pgdir[PDX(a)] = pa | perm | PTE_P | PTE_PS;
+      n = PTSIZE;
+    } else {
+      n = PTSIZE - a % PTSIZE;  // up to the next 4MB boundary
+      if(n > size)
+        n = size;
+      if(mappages(pgdir, (void*)a, n, pa, perm) < 0)
+        return -1;
+    }
+    a += n;
+    pa += n;
+    size -= n;
+  }
+  return 0;
+}
+
 // There is one page table per process, plus one that's used when
 // a CPU is not running any process (kpgdir). The kernel uses the
 // current process's page table during system calls and interrupts;
@@ -105,6 +141,12 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 //                                  rw data + free physical memory
 //   0xfe000000..0: mapped direct (devices such as ioapic)
 //
+// Whole 4MB-aligned stretches of the kernel mappings use 4MB
+// pages; only the first 4MB, where the kernel's text ends and its
+// data begins, needs a page table.  kvmalloc() builds the kernel
+// mappings once, in kpgdir; every other page directory shares
+// them by copying kpgdir's kernel-half entries.
+//
 // The kernel allocates physical memory for its heap and for user memory
 // between V2P(end) and the end of physical memory (PHYSTOP)
 // (directly addressable from end..P2V(PHYSTOP)).
@@ -130,13 +172,18 @@ setupkvm(void)
   pde_t *pgdir;
   struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kzalloc()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
+  if(kpgdir){
+    // Point at kpgdir's page tables; they never change.
+    memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+            (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
+    return pgdir;
+  }
   if (P2V(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+    if(kmappages(pgdir, k->virt, k->phys_end - k->phys_start,
                 (uint)k->phys_start, k->perm) < 0)
       return 0;
   return pgdir;
@@ -151,8 +198,33 @@ kvmalloc(void)
   switchkvm();
 }
 
-// Switch h/w page table register to the kernel-only page table,
-// for when no process is running.
+// Load pgdir into %cr3, flushing the TLB of all but the global
+// (kernel) mappings.  The scheduler goes on using the page
+// directory of the process it last ran, whose kernel half is the
+// same as kpgdir's, rather than loading kpgdir; if it picks the same
+// process again it need not load %cr3 at all.  Since that process
+// may exit or exec meanwhile, each CPU holds a reference (kdup())
+// on the page directory it has loaded.
+static void
+loadpgdir(pde_t *pgdir)
+{
+  pde_t *old;
+
+  pushcli();
+  old = cpu->pgdir;
+  if(pgdir != kpgdir)
+    kdup((char*)pgdir);
+  lcr3(V2P(pgdir));
+  cpu->pgdir = pgdir;
+  popcli();
+  if(old && old != kpgdir)
+    kfree((char*)old);
+}
+
+// Switch h/w page table register to the kernel-only page table.
+// Used only while a CPU boots, before seginit() has set up %gs,
+// so it must not touch cpu (cpu->pgdir stays 0, which loadpgdir()
+// takes to mean no process's page directory is loaded).
 void
 switchkvm(void)
 {
@@ -174,7 +246,7 @@ switchuvm(struct proc *p)
   ltr(SEG_TSS << 3);
   if(p->pgdir == 0)
     panic("switchuvm: no pgdir");
-  lcr3(V2P(p->pgdir));  // switch to process's address space
+  loadpgdir(p->pgdir);  // switch to process's address space
   popcli();
 }
 
@@ -187,36 +259,11 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kzalloc();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, P2V(pa), offset+i, n) != n)
-      return -1;
-  }
-  return 0;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
 int
@@ -232,13 +279,12 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kzalloc();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -266,7 +312,7 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
-      a += (NPTENTRIES - 1) * PGSIZE;
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;  // skip to next page table
     else if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
@@ -274,13 +320,18 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       char *v = P2V(pa);
       kfree(v);
       *pte = 0;
+    } else if(*pte & PTE_SWAP){
+      swapfree(PTE_ADDR(*pte) >> PTXSHIFT);
+      *pte = 0;
     }
   }
   return newsz;
 }
 
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part.  The kernel part's page tables are shared.
+// A CPU may still have pgdir loaded (see loadpgdir()); clearing
+// the user part first keeps it from reaching the freed tables.
 void
 freevm(pde_t *pgdir)
 {
@@ -289,9 +340,10 @@ freevm(pde_t *pgdir)
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
+      pgdir[i] = 0;
       kfree(v);
     }
   }
@@ -312,12 +364,16 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child.  User pages are not copied but shared
+// copy-on-write: writable ones become read-only in both, marked
+// PTE_COW, and cowfault() copies them on the first write.
+// Swapped-out pages share the swap slot.
+// pgdir must be the current page table.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
-  pte_t *pte;
+  pte_t *pte, *cpte;
   uint pa, i, flags;
   char *mem;
 
@@ -325,10 +381,27 @@ copyuvm(pde_t *pgdir, uint sz)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
     if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+      continue;
+    if(*pte & PTE_SWAP){
+      if((cpte = walkpgdir(d, (void *) i, 1)) == 0)
+        goto bad;
+      *cpte = *pte;
+      swapdup(PTE_ADDR(*pte) >> PTXSHIFT);
+      continue;
+    }
     if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue;   // not touched yet; the child will fault it in
     pa = PTE_ADDR(*pte);
+    if(*pte & PTE_U){
+      if(*pte & PTE_W)
+        *pte = (*pte & ~PTE_W) | PTE_COW;
+      if(mappages(d, (void*)i, PGSIZE, pa, PTE_FLAGS(*pte)) < 0)
+        goto bad;
+      kdup(P2V(pa));
+      continue;
+    }
+    // The guard page below the stack is copied; it is only one
+    // page and the kernel must never fault on it.
     flags = PTE_FLAGS(*pte);
     if((mem = kalloc()) == 0)
       goto bad;
@@ -336,13 +409,196 @@ copyuvm(pde_t *pgdir, uint sz)
     if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0)
       goto bad;
   }
+  lcr3(V2P(pgdir));  // flush the parent's now read-only pages
   return d;
 
 bad:
   freevm(d);
+  lcr3(V2P(pgdir));
+  return 0;
+}
+
+// Handle a write to the copy-on-write page at va: give the
+// process its own copy of the page, or just make it writable
+// again if no one else shares it any more.
+// Returns 0 on success, -1 if va is not copy-on-write or
+// there is no memory for the copy.
+int
+cowfault(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  uint pa;
+  char *mem;
+
+  if(va >= KERNBASE || (pte = walkpgdir(pgdir, (char*)va, 0)) == 0)
+    return -1;
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  pa = PTE_ADDR(*pte);
+  if(krefcnt(P2V(pa)) == 1){
+    *pte = (*pte | PTE_W) & ~PTE_COW;
+  } else {
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, P2V(pa), PGSIZE);
+    *pte = V2P(mem) | ((PTE_FLAGS(*pte) | PTE_W) & ~PTE_COW);
+    kfree(P2V(pa));
+  }
+  invlpg((char*)PGROUNDDOWN(va));
   return 0;
 }
 
+// Bring in the page at va of the current process: from swap if
+// kswapd swapped it out; if it was never touched, from its
+// executable if va is in a program segment, zero otherwise
+// (sbrk() heap, bss).  Whole pages of the executable
+// go through the page cache and are shared copy-on-write with
+// other processes running it.  (Not read-only, even for text:
+// the kernel must be able to write wherever a system call's
+// buffer argument points.)  Returns 0 on success, -1 if va is
+// outside the process or there is no memory.
+static int
+pagein(uint va)
+{
+  char *mem;
+  struct execseg *s;
+  struct inode *ip;
+  pte_t *pte;
+  uint n, off, perm;
+
+  va = PGROUNDDOWN(va);
+  if(va >= proc->sz)
+    return -1;
+  pte = walkpgdir(proc->pgdir, (char*)va, 0);
+  if(pte && (*pte & PTE_SWAP)){
+    if((mem = kalloc()) == 0)
+      return -1;
+    swapread(PTE_ADDR(*pte) >> PTXSHIFT, mem);
+    swapfree(PTE_ADDR(*pte) >> PTXSHIFT);
+    *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+    return 0;
+  }
+  mem = 0;
+  perm = PTE_W|PTE_U;
+  for(s = proc->seg; s < &proc->seg[proc->nseg]; s++){
+    if(va < s->va || va >= s->va + s->filesz)
+      continue;
+    ip = proc->exe;
+    off = s->off + va - s->va;
+    n = s->va + s->filesz - va;
+    if(n > PGSIZE)
+      n = PGSIZE;
+    ilock(ip);
+    if(n == PGSIZE)
+      mem = pcget(ip->dev, ip->inum, off);
+    if(mem == 0){
+      if((mem = kzalloc()) == 0 || readi(ip, mem, off, n) != n){
+        iunlock(ip);
+        if(mem)
+          kfree(mem);
+        return -1;
+      }
+      if(n == PGSIZE && pcput(ip->dev, ip->inum, off, mem))
+        ip->flags |= I_PCACHE;
+    }
+    iunlock(ip);
+    if(krefcnt(mem) > 1)
+      perm = PTE_COW|PTE_U;  // shared
+    break;
+  }
+  if(mem == 0 && (mem = kzalloc()) == 0)
+    return -1;
+  if(mappages(proc->pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Handle a page fault at va in the current process; err is the
+// error code the processor pushed.  Returns 0 if the faulting
+// access can be retried, -1 if it was a real error.
+// Only faults in user mode are served: the kernel calls
+// uvmprefault() before it touches user memory (see argptr(),
+// argptrw(), fetchint(), fetchstr()), so a fault in kernel mode
+// is a kernel bug, which must not be papered over with a zero
+// page.  Serving it could not fail the system call anyway, and
+// the kernel may hold a spinlock, so could not wait for memory.
+int
+pgfault(uint va, uint err)
+{
+  if((err & FEC_U) == 0)
+    return -1;
+  if(err & FEC_PR){
+    if(err & FEC_WR)
+      return cowfault(proc->pgdir, va);
+    return -1;
+  }
+  return pagein(va);
+}
+
+// Bring in any untouched pages in memory [va, va+len) of the
+// current process, and if write is set give it its own copy of
+// any copy-on-write ones, so that the kernel can use the memory
+// without a page fault.  Returns -1 if out of memory, which
+// fails the system call.
+int
+uvmprefault(uint va, uint len, int write)
+{
+  uint a;
+  pte_t *pte;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+    pte = walkpgdir(proc->pgdir, (char*)a, 0);
+    if((pte == 0 || !(*pte & PTE_P)) && pagein(a) < 0)
+      return -1;
+    if(write){
+      pte = walkpgdir(proc->pgdir, (char*)a, 0);
+      if((*pte & PTE_COW) && cowfault(proc->pgdir, a) < 0)
+        return -1;
+    }
+  }
+  return 0;
+}
+
+// One step of kswapd's clock over the user pages of pgdir, from
+// *va up to sz: a page used since the last sweep (PTE_A set) gets
+// a second chance, and up to n others that no one else shares
+// are unmapped, each given a swap slot.  Their pages and slots go
+// in page[] and slot[], for the caller to write out and free.
+// Advances *va past the pages looked at; returns pages unmapped.
+// The process must not be running.
+int
+uvmswapout(pde_t *pgdir, uint sz, uint *va, char **page, int *slot, int n)
+{
+  pte_t *pte;
+  uint a;
+  int i, s;
+
+  i = 0;
+  for(a = *va; a < sz && i < n; a += PGSIZE){
+    if((pte = walkpgdir(pgdir, (char*)a, 0)) == 0){
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;  // skip to next page table
+      continue;
+    }
+    if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+      continue;
+    if(*pte & PTE_A){
+      *pte &= ~PTE_A;
+      continue;
+    }
+    if(krefcnt(P2V(PTE_ADDR(*pte))) > 1)
+      continue;
+    if((s = swapalloc()) < 0)
+      break;
+    page[i] = P2V(PTE_ADDR(*pte));
+    slot[i++] = s;
+    *pte = (s << PTXSHIFT) | PTE_SWAP;
+  }
+  *va = a;
+  return i;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -351,7 +607,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -361,15 +617,21 @@ uva2ka(pde_t *pgdir, char *uva)
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
 // uva2ka ensures this only works for PTE_U pages.
+// Writing through the kernel mapping would not fault, so break
+// copy-on-write sharing by hand.
 int
 copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
@@ -0,0 +1,1607 @@
+
+_vmstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec d8 00 00 00    	sub    $0xd8,%esp
+  17:	8b 39                	mov    (%ecx),%edi
+  19:	8b 71 04             	mov    0x4(%ecx),%esi
+  uint last[MAXSTAT], now[MAXSTAT], diff[MAXSTAT];
+  int i, n, secs, count;
+
+  if(readstats() < 0){
+  1c:	e8 cf 01 00 00       	call   1f0 <readstats>
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 6e 01 00 00    	js     197 <main+0x197>
+    printf(2, "vmstat: cannot read /dev/stats\n");
+    exit();
+  }
+  n = sumstats(last);
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	8d 9d 28 ff ff ff    	lea    -0xd8(%ebp),%ebx
+  32:	53                   	push   %ebx
+  33:	e8 38 02 00 00       	call   270 <sumstats>
+
+  if(argc < 2){
+  38:	83 c4 10             	add    $0x10,%esp
+  n = sumstats(last);
+  3b:	89 85 20 ff ff ff    	mov    %eax,-0xe0(%ebp)
+  if(argc < 2){
+  41:	83 ff 01             	cmp    $0x1,%edi
+  44:	0f 8e 1a 01 00 00    	jle    164 <main+0x164>
+    printf(1, "all\t");
+    printstats(last, n);
+    exit();
+  }
+
+  secs = atoi(argv[1]);
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	ff 76 04             	push   0x4(%esi)
+  50:	e8 bb 05 00 00       	call   610 <atoi>
+  count = argc > 2 ? atoi(argv[2]) : -1;
+  55:	83 c4 10             	add    $0x10,%esp
+  secs = atoi(argv[1]);
+  58:	89 c2                	mov    %eax,%edx
+  count = argc > 2 ? atoi(argv[2]) : -1;
+  5a:	83 c8 ff             	or     $0xffffffff,%eax
+  5d:	83 ff 02             	cmp    $0x2,%edi
+  60:	0f 85 49 01 00 00    	jne    1af <main+0x1af>
+  if(secs <= 0){
+  66:	85 d2                	test   %edx,%edx
+  68:	0f 8e 60 01 00 00    	jle    1ce <main+0x1ce>
+  6e:	89 95 1c ff ff ff    	mov    %edx,-0xe4(%ebp)
+  74:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+    printf(2, "usage: vmstat [secs [count]]\n");
+    exit();
+  }
+  printnames();
+  7a:	e8 01 03 00 00       	call   380 <printnames>
+  while(count < 0 || count-- > 0){
+    sleep(secs * 100);  // 100 ticks a second
+  7f:	8b 95 1c ff ff ff    	mov    -0xe4(%ebp),%edx
+  85:	6b c2 64             	imul   $0x64,%edx,%eax
+  88:	89 85 1c ff ff ff    	mov    %eax,-0xe4(%ebp)
+  8e:	8b 85 24 ff ff ff    	mov    -0xdc(%ebp),%eax
+  while(count < 0 || count-- > 0){
+  94:	85 c0                	test   %eax,%eax
+  96:	0f 88 bd 00 00 00    	js     159 <main+0x159>
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a0:	8d 50 ff             	lea    -0x1(%eax),%edx
+  a3:	89 95 24 ff ff ff    	mov    %edx,-0xdc(%ebp)
+  a9:	0f 84 fb 00 00 00    	je     1aa <main+0x1aa>
+    sleep(secs * 100);  // 100 ticks a second
+  af:	83 ec 0c             	sub    $0xc,%esp
+  b2:	ff b5 1c ff ff ff    	push   -0xe4(%ebp)
+  b8:	e8 56 06 00 00       	call   713 <sleep>
+    if(readstats() < 0)
+  bd:	e8 2e 01 00 00       	call   1f0 <readstats>
+  c2:	83 c4 10             	add    $0x10,%esp
+  c5:	85 c0                	test   %eax,%eax
+  c7:	0f 88 dd 00 00 00    	js     1aa <main+0x1aa>
+      break;
+    sumstats(now);
+  cd:	83 ec 0c             	sub    $0xc,%esp
+  d0:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  d6:	57                   	push   %edi
+  d7:	e8 94 01 00 00       	call   270 <sumstats>
+    for(i = 0; i < n; i++){
+  dc:	8b 8d 20 ff ff ff    	mov    -0xe0(%ebp),%ecx
+  e2:	83 c4 10             	add    $0x10,%esp
+  e5:	85 c9                	test   %ecx,%ecx
+  e7:	7e 50                	jle    139 <main+0x139>
+  e9:	31 c0                	xor    %eax,%eax
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+      diff[i] = now[i] - last[i];
+  f0:	8b 14 87             	mov    (%edi,%eax,4),%edx
+  f3:	89 d6                	mov    %edx,%esi
+  f5:	2b 34 83             	sub    (%ebx,%eax,4),%esi
+      last[i] = now[i];
+  f8:	89 14 83             	mov    %edx,(%ebx,%eax,4)
+      diff[i] = now[i] - last[i];
+  fb:	89 74 85 a8          	mov    %esi,-0x58(%ebp,%eax,4)
+    for(i = 0; i < n; i++){
+  ff:	89 c6                	mov    %eax,%esi
+ 101:	8d 40 01             	lea    0x1(%eax),%eax
+ 104:	39 c1                	cmp    %eax,%ecx
+ 106:	75 e8                	jne    f0 <main+0xf0>
+    printf(1, i ? "\t%d" : "%d", st[i]);
+ 108:	8b 4d a8             	mov    -0x58(%ebp),%ecx
+ 10b:	31 ff                	xor    %edi,%edi
+ 10d:	b8 37 0b 00 00       	mov    $0xb37,%eax
+ 112:	eb 0f                	jmp    123 <main+0x123>
+ 114:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 118:	8b 4c 85 a8          	mov    -0x58(%ebp,%eax,4),%ecx
+  for(i = 0; i < n; i++)
+ 11c:	89 c7                	mov    %eax,%edi
+    printf(1, i ? "\t%d" : "%d", st[i]);
+ 11e:	b8 36 0b 00 00       	mov    $0xb36,%eax
+ 123:	83 ec 04             	sub    $0x4,%esp
+ 126:	51                   	push   %ecx
+ 127:	50                   	push   %eax
+ 128:	6a 01                	push   $0x1
+ 12a:	e8 d1 06 00 00       	call   800 <printf>
+  for(i = 0; i < n; i++)
+ 12f:	8d 47 01             	lea    0x1(%edi),%eax
+ 132:	83 c4 10             	add    $0x10,%esp
+ 135:	39 f7                	cmp    %esi,%edi
+ 137:	75 df                	jne    118 <main+0x118>
+  printf(1, "\n");
+ 139:	83 ec 08             	sub    $0x8,%esp
+ 13c:	68 5e 0b 00 00       	push   $0xb5e
+ 141:	6a 01                	push   $0x1
+ 143:	e8 b8 06 00 00       	call   800 <printf>
+}
+ 148:	8b 85 24 ff ff ff    	mov    -0xdc(%ebp),%eax
+ 14e:	83 c4 10             	add    $0x10,%esp
+  while(count < 0 || count-- > 0){
+ 151:	85 c0                	test   %eax,%eax
+ 153:	0f 89 47 ff ff ff    	jns    a0 <main+0xa0>
+ 159:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+ 15f:	e9 4b ff ff ff       	jmp    af <main+0xaf>
+    printf(1, "%s", buf);
+ 164:	52                   	push   %edx
+ 165:	68 60 0f 00 00       	push   $0xf60
+ 16a:	68 3a 0b 00 00       	push   $0xb3a
+ 16f:	6a 01                	push   $0x1
+ 171:	e8 8a 06 00 00       	call   800 <printf>
+    printf(1, "all\t");
+ 176:	59                   	pop    %ecx
+ 177:	5e                   	pop    %esi
+ 178:	68 3d 0b 00 00       	push   $0xb3d
+ 17d:	6a 01                	push   $0x1
+ 17f:	e8 7c 06 00 00       	call   800 <printf>
+    printstats(last, n);
+ 184:	5f                   	pop    %edi
+ 185:	58                   	pop    %eax
+ 186:	ff b5 20 ff ff ff    	push   -0xe0(%ebp)
+ 18c:	53                   	push   %ebx
+ 18d:	e8 4e 02 00 00       	call   3e0 <printstats>
+    exit();
+ 192:	e8 ec 04 00 00       	call   683 <exit>
+    printf(2, "vmstat: cannot read /dev/stats\n");
+ 197:	50                   	push   %eax
+ 198:	50                   	push   %eax
+ 199:	68 60 0b 00 00       	push   $0xb60
+ 19e:	6a 02                	push   $0x2
+ 1a0:	e8 5b 06 00 00       	call   800 <printf>
+    exit();
+ 1a5:	e8 d9 04 00 00       	call   683 <exit>
+    }
+    printstats(diff, n);
+  }
+  exit();
+ 1aa:	e8 d4 04 00 00       	call   683 <exit>
+ 1af:	89 95 24 ff ff ff    	mov    %edx,-0xdc(%ebp)
+  count = argc > 2 ? atoi(argv[2]) : -1;
+ 1b5:	83 ec 0c             	sub    $0xc,%esp
+ 1b8:	ff 76 08             	push   0x8(%esi)
+ 1bb:	e8 50 04 00 00       	call   610 <atoi>
+ 1c0:	8b 95 24 ff ff ff    	mov    -0xdc(%ebp),%edx
+ 1c6:	83 c4 10             	add    $0x10,%esp
+ 1c9:	e9 98 fe ff ff       	jmp    66 <main+0x66>
+    printf(2, "usage: vmstat [secs [count]]\n");
+ 1ce:	50                   	push   %eax
+ 1cf:	50                   	push   %eax
+ 1d0:	68 42 0b 00 00       	push   $0xb42
+ 1d5:	6a 02                	push   $0x2
+ 1d7:	e8 24 06 00 00       	call   800 <printf>
+    exit();
+ 1dc:	e8 a2 04 00 00       	call   683 <exit>
+ 1e1:	66 90                	xchg   %ax,%ax
+ 1e3:	66 90                	xchg   %ax,%ax
+ 1e5:	66 90                	xchg   %ax,%ax
+ 1e7:	66 90                	xchg   %ax,%ax
+ 1e9:	66 90                	xchg   %ax,%ax
+ 1eb:	66 90                	xchg   %ax,%ax
+ 1ed:	66 90                	xchg   %ax,%ax
+ 1ef:	90                   	nop
+
+000001f0 <readstats>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	56                   	push   %esi
+ 1f5:	53                   	push   %ebx
+ 1f6:	83 ec 14             	sub    $0x14,%esp
+  if((fd = open("/dev/stats", O_RDONLY)) < 0)
+ 1f9:	6a 00                	push   $0x0
+ 1fb:	68 28 0b 00 00       	push   $0xb28
+ 200:	e8 be 04 00 00       	call   6c3 <open>
+ 205:	83 c4 10             	add    $0x10,%esp
+ 208:	85 c0                	test   %eax,%eax
+ 20a:	78 58                	js     264 <readstats+0x74>
+ 20c:	89 c3                	mov    %eax,%ebx
+  n = 0;
+ 20e:	31 ff                	xor    %edi,%edi
+  while(n < sizeof(buf) - 1 && (m = read(fd, buf + n, sizeof(buf) - 1 - n)) > 0)
+ 210:	31 c0                	xor    %eax,%eax
+ 212:	be ff 07 00 00       	mov    $0x7ff,%esi
+ 217:	eb 13                	jmp    22c <readstats+0x3c>
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n += m;
+ 220:	01 c7                	add    %eax,%edi
+  while(n < sizeof(buf) - 1 && (m = read(fd, buf + n, sizeof(buf) - 1 - n)) > 0)
+ 222:	89 f8                	mov    %edi,%eax
+ 224:	81 ff fe 07 00 00    	cmp    $0x7fe,%edi
+ 22a:	7f 1b                	jg     247 <readstats+0x57>
+ 22c:	89 f2                	mov    %esi,%edx
+ 22e:	83 ec 04             	sub    $0x4,%esp
+ 231:	29 c2                	sub    %eax,%edx
+ 233:	05 60 0f 00 00       	add    $0xf60,%eax
+ 238:	52                   	push   %edx
+ 239:	50                   	push   %eax
+ 23a:	53                   	push   %ebx
+ 23b:	e8 5b 04 00 00       	call   69b <read>
+ 240:	83 c4 10             	add    $0x10,%esp
+ 243:	85 c0                	test   %eax,%eax
+ 245:	7f d9                	jg     220 <readstats+0x30>
+  close(fd);
+ 247:	83 ec 0c             	sub    $0xc,%esp
+ 24a:	53                   	push   %ebx
+ 24b:	e8 5b 04 00 00       	call   6ab <close>
+  buf[n] = 0;
+ 250:	c6 87 60 0f 00 00 00 	movb   $0x0,0xf60(%edi)
+  return n;
+ 257:	83 c4 10             	add    $0x10,%esp
+}
+ 25a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25d:	89 f8                	mov    %edi,%eax
+ 25f:	5b                   	pop    %ebx
+ 260:	5e                   	pop    %esi
+ 261:	5f                   	pop    %edi
+ 262:	5d                   	pop    %ebp
+ 263:	c3                   	ret
+    return -1;
+ 264:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+ 269:	eb ef                	jmp    25a <readstats+0x6a>
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <sumstats>:
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	53                   	push   %ebx
+ 276:	83 ec 10             	sub    $0x10,%esp
+ 279:	8b 75 08             	mov    0x8(%ebp),%esi
+  memset(total, 0, MAXSTAT*sizeof(total[0]));
+ 27c:	6a 40                	push   $0x40
+ 27e:	6a 00                	push   $0x0
+ 280:	56                   	push   %esi
+ 281:	e8 7a 02 00 00       	call   500 <memset>
+  p = strchr(buf, '\n');   // skip the names
+ 286:	58                   	pop    %eax
+ 287:	5a                   	pop    %edx
+ 288:	6a 0a                	push   $0xa
+ 28a:	68 60 0f 00 00       	push   $0xf60
+ 28f:	e8 8c 02 00 00       	call   520 <strchr>
+  while(p && *++p){
+ 294:	83 c4 10             	add    $0x10,%esp
+ 297:	85 c0                	test   %eax,%eax
+ 299:	74 56                	je     2f1 <sumstats+0x81>
+ 29b:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+ 29f:	8d 58 01             	lea    0x1(%eax),%ebx
+ 2a2:	74 4d                	je     2f1 <sumstats+0x81>
+ 2a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for(i = -1; ; i++){
+ 2a8:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+      if(i >= 0 && i < MAXSTAT)
+ 2b0:	83 ff 0f             	cmp    $0xf,%edi
+ 2b3:	0f 86 a9 00 00 00    	jbe    362 <sumstats+0xf2>
+      while(*p && *p != '\t' && *p != '\n')
+ 2b9:	0f b6 03             	movzbl (%ebx),%eax
+ 2bc:	3c 09                	cmp    $0x9,%al
+ 2be:	0f 84 80 00 00 00    	je     344 <sumstats+0xd4>
+ 2c4:	84 c0                	test   %al,%al
+ 2c6:	75 17                	jne    2df <sumstats+0x6f>
+ 2c8:	eb 76                	jmp    340 <sumstats+0xd0>
+ 2ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 2d0:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+        p++;
+ 2d4:	83 c3 01             	add    $0x1,%ebx
+      while(*p && *p != '\t' && *p != '\n')
+ 2d7:	84 c0                	test   %al,%al
+ 2d9:	74 65                	je     340 <sumstats+0xd0>
+ 2db:	3c 09                	cmp    $0x9,%al
+ 2dd:	74 65                	je     344 <sumstats+0xd4>
+ 2df:	3c 0a                	cmp    $0xa,%al
+ 2e1:	75 ed                	jne    2d0 <sumstats+0x60>
+    if(*p == 0)
+ 2e3:	89 d8                	mov    %ebx,%eax
+ 2e5:	8d 76 00             	lea    0x0(%esi),%esi
+  while(p && *++p){
+ 2e8:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+ 2ec:	8d 58 01             	lea    0x1(%eax),%ebx
+ 2ef:	75 b7                	jne    2a8 <sumstats+0x38>
+  for(i = 0, p = buf; *p && *p != '\n'; p++)
+ 2f1:	0f b6 05 60 0f 00 00 	movzbl 0xf60,%eax
+ 2f8:	84 c0                	test   %al,%al
+ 2fa:	74 5c                	je     358 <sumstats+0xe8>
+ 2fc:	31 c9                	xor    %ecx,%ecx
+ 2fe:	ba 60 0f 00 00       	mov    $0xf60,%edx
+ 303:	3c 0a                	cmp    $0xa,%al
+ 305:	75 0d                	jne    314 <sumstats+0xa4>
+ 307:	eb 4f                	jmp    358 <sumstats+0xe8>
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 310:	84 c0                	test   %al,%al
+ 312:	74 14                	je     328 <sumstats+0xb8>
+      i++;
+ 314:	3c 09                	cmp    $0x9,%al
+ 316:	0f 94 c0             	sete   %al
+  for(i = 0, p = buf; *p && *p != '\n'; p++)
+ 319:	83 c2 01             	add    $0x1,%edx
+      i++;
+ 31c:	0f b6 c0             	movzbl %al,%eax
+ 31f:	01 c1                	add    %eax,%ecx
+  for(i = 0, p = buf; *p && *p != '\n'; p++)
+ 321:	0f b6 02             	movzbl (%edx),%eax
+ 324:	3c 0a                	cmp    $0xa,%al
+ 326:	75 e8                	jne    310 <sumstats+0xa0>
+  return i < MAXSTAT ? i : MAXSTAT;
+ 328:	b8 10 00 00 00       	mov    $0x10,%eax
+ 32d:	39 c1                	cmp    %eax,%ecx
+ 32f:	0f 4e c1             	cmovle %ecx,%eax
+}
+ 332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 335:	5b                   	pop    %ebx
+ 336:	5e                   	pop    %esi
+ 337:	5f                   	pop    %edi
+ 338:	5d                   	pop    %ebp
+ 339:	c3                   	ret
+ 33a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(*p != '\t')
+ 340:	3c 09                	cmp    $0x9,%al
+ 342:	75 0c                	jne    350 <sumstats+0xe0>
+      p++;
+ 344:	83 c3 01             	add    $0x1,%ebx
+    for(i = -1; ; i++){
+ 347:	83 c7 01             	add    $0x1,%edi
+      if(i >= 0 && i < MAXSTAT)
+ 34a:	e9 61 ff ff ff       	jmp    2b0 <sumstats+0x40>
+ 34f:	90                   	nop
+    if(*p == 0)
+ 350:	84 c0                	test   %al,%al
+ 352:	74 9d                	je     2f1 <sumstats+0x81>
+ 354:	89 d8                	mov    %ebx,%eax
+ 356:	eb 90                	jmp    2e8 <sumstats+0x78>
+}
+ 358:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  for(i = 0, p = buf; *p && *p != '\n'; p++)
+ 35b:	31 c0                	xor    %eax,%eax
+}
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5f                   	pop    %edi
+ 360:	5d                   	pop    %ebp
+ 361:	c3                   	ret
+        total[i] += atoi(p);
+ 362:	83 ec 0c             	sub    $0xc,%esp
+ 365:	53                   	push   %ebx
+ 366:	e8 a5 02 00 00       	call   610 <atoi>
+ 36b:	83 c4 10             	add    $0x10,%esp
+ 36e:	01 04 be             	add    %eax,(%esi,%edi,4)
+ 371:	e9 43 ff ff ff       	jmp    2b9 <sumstats+0x49>
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000380 <printnames>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	83 ec 0c             	sub    $0xc,%esp
+  for(p = strchr(buf, '\t') + 1; *p && *p != '\n'; p++)
+ 387:	6a 09                	push   $0x9
+ 389:	68 60 0f 00 00       	push   $0xf60
+ 38e:	e8 8d 01 00 00       	call   520 <strchr>
+ 393:	83 c4 10             	add    $0x10,%esp
+ 396:	8d 58 01             	lea    0x1(%eax),%ebx
+ 399:	0f be 40 01          	movsbl 0x1(%eax),%eax
+ 39d:	84 c0                	test   %al,%al
+ 39f:	75 24                	jne    3c5 <printnames+0x45>
+ 3a1:	eb 26                	jmp    3c9 <printnames+0x49>
+ 3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3a7:	90                   	nop
+    printf(1, "%c", *p);
+ 3a8:	83 ec 04             	sub    $0x4,%esp
+  for(p = strchr(buf, '\t') + 1; *p && *p != '\n'; p++)
+ 3ab:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "%c", *p);
+ 3ae:	50                   	push   %eax
+ 3af:	68 33 0b 00 00       	push   $0xb33
+ 3b4:	6a 01                	push   $0x1
+ 3b6:	e8 45 04 00 00       	call   800 <printf>
+  for(p = strchr(buf, '\t') + 1; *p && *p != '\n'; p++)
+ 3bb:	0f be 03             	movsbl (%ebx),%eax
+ 3be:	83 c4 10             	add    $0x10,%esp
+ 3c1:	84 c0                	test   %al,%al
+ 3c3:	74 04                	je     3c9 <printnames+0x49>
+ 3c5:	3c 0a                	cmp    $0xa,%al
+ 3c7:	75 df                	jne    3a8 <printnames+0x28>
+  printf(1, "\n");
+ 3c9:	83 ec 08             	sub    $0x8,%esp
+ 3cc:	68 5e 0b 00 00       	push   $0xb5e
+ 3d1:	6a 01                	push   $0x1
+ 3d3:	e8 28 04 00 00       	call   800 <printf>
+}
+ 3d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3db:	83 c4 10             	add    $0x10,%esp
+ 3de:	c9                   	leave
+ 3df:	c3                   	ret
+
+000003e0 <printstats>:
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	53                   	push   %ebx
+ 3e6:	83 ec 0c             	sub    $0xc,%esp
+ 3e9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 3ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(i = 0; i < n; i++)
+ 3ef:	85 ff                	test   %edi,%edi
+ 3f1:	7e 2b                	jle    41e <printstats+0x3e>
+    printf(1, i ? "\t%d" : "%d", st[i]);
+ 3f3:	8b 16                	mov    (%esi),%edx
+ 3f5:	31 db                	xor    %ebx,%ebx
+ 3f7:	b8 37 0b 00 00       	mov    $0xb37,%eax
+ 3fc:	eb 0a                	jmp    408 <printstats+0x28>
+ 3fe:	66 90                	xchg   %ax,%ax
+ 400:	8b 14 9e             	mov    (%esi,%ebx,4),%edx
+ 403:	b8 36 0b 00 00       	mov    $0xb36,%eax
+ 408:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < n; i++)
+ 40b:	83 c3 01             	add    $0x1,%ebx
+    printf(1, i ? "\t%d" : "%d", st[i]);
+ 40e:	52                   	push   %edx
+ 40f:	50                   	push   %eax
+ 410:	6a 01                	push   $0x1
+ 412:	e8 e9 03 00 00       	call   800 <printf>
+  for(i = 0; i < n; i++)
+ 417:	83 c4 10             	add    $0x10,%esp
+ 41a:	39 df                	cmp    %ebx,%edi
+ 41c:	75 e2                	jne    400 <printstats+0x20>
+  printf(1, "\n");
+ 41e:	c7 45 0c 5e 0b 00 00 	movl   $0xb5e,0xc(%ebp)
+ 425:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 42c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42f:	5b                   	pop    %ebx
+ 430:	5e                   	pop    %esi
+ 431:	5f                   	pop    %edi
+ 432:	5d                   	pop    %ebp
+  printf(1, "\n");
+ 433:	e9 c8 03 00 00       	jmp    800 <printf>
+ 438:	66 90                	xchg   %ax,%ax
+ 43a:	66 90                	xchg   %ax,%ax
+ 43c:	66 90                	xchg   %ax,%ax
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 440:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 441:	31 c0                	xor    %eax,%eax
+{
+ 443:	89 e5                	mov    %esp,%ebp
+ 445:	53                   	push   %ebx
+ 446:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 449:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 450:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 454:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 457:	83 c0 01             	add    $0x1,%eax
+ 45a:	84 d2                	test   %dl,%dl
+ 45c:	75 f2                	jne    450 <strcpy+0x10>
+    ;
+  return os;
+}
+ 45e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 461:	89 c8                	mov    %ecx,%eax
+ 463:	c9                   	leave
+ 464:	c3                   	ret
+ 465:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	53                   	push   %ebx
+ 474:	8b 55 08             	mov    0x8(%ebp),%edx
+ 477:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 47a:	0f b6 02             	movzbl (%edx),%eax
+ 47d:	84 c0                	test   %al,%al
+ 47f:	75 17                	jne    498 <strcmp+0x28>
+ 481:	eb 3a                	jmp    4bd <strcmp+0x4d>
+ 483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 487:	90                   	nop
+ 488:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 48c:	83 c2 01             	add    $0x1,%edx
+ 48f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 492:	84 c0                	test   %al,%al
+ 494:	74 1a                	je     4b0 <strcmp+0x40>
+    p++, q++;
+ 496:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 498:	0f b6 19             	movzbl (%ecx),%ebx
+ 49b:	38 c3                	cmp    %al,%bl
+ 49d:	74 e9                	je     488 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 49f:	29 d8                	sub    %ebx,%eax
+}
+ 4a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4a4:	c9                   	leave
+ 4a5:	c3                   	ret
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4b4:	31 c0                	xor    %eax,%eax
+ 4b6:	29 d8                	sub    %ebx,%eax
+}
+ 4b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4bb:	c9                   	leave
+ 4bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 4c0:	31 c0                	xor    %eax,%eax
+ 4c2:	eb db                	jmp    49f <strcmp+0x2f>
+ 4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 4d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 4d9:	74 15                	je     4f0 <strlen+0x20>
+ 4db:	31 c0                	xor    %eax,%eax
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 4e0:	83 c0 01             	add    $0x1,%eax
+ 4e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 4e7:	89 c1                	mov    %eax,%ecx
+ 4e9:	75 f5                	jne    4e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 4eb:	89 c8                	mov    %ecx,%eax
+ 4ed:	5d                   	pop    %ebp
+ 4ee:	c3                   	ret
+ 4ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4f0:	31 c9                	xor    %ecx,%ecx
+}
+ 4f2:	5d                   	pop    %ebp
+ 4f3:	89 c8                	mov    %ecx,%eax
+ 4f5:	c3                   	ret
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000500 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 507:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 50a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 50d:	89 d7                	mov    %edx,%edi
+ 50f:	fc                   	cld
+ 510:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 512:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 515:	89 d0                	mov    %edx,%eax
+ 517:	c9                   	leave
+ 518:	c3                   	ret
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	8b 45 08             	mov    0x8(%ebp),%eax
+ 526:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 52a:	0f b6 10             	movzbl (%eax),%edx
+ 52d:	84 d2                	test   %dl,%dl
+ 52f:	75 12                	jne    543 <strchr+0x23>
+ 531:	eb 1d                	jmp    550 <strchr+0x30>
+ 533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 537:	90                   	nop
+ 538:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 53c:	83 c0 01             	add    $0x1,%eax
+ 53f:	84 d2                	test   %dl,%dl
+ 541:	74 0d                	je     550 <strchr+0x30>
+    if(*s == c)
+ 543:	38 d1                	cmp    %dl,%cl
+ 545:	75 f1                	jne    538 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 547:	5d                   	pop    %ebp
+ 548:	c3                   	ret
+ 549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 550:	31 c0                	xor    %eax,%eax
+}
+ 552:	5d                   	pop    %ebp
+ 553:	c3                   	ret
+ 554:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+
+00000560 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 565:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 568:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 569:	31 db                	xor    %ebx,%ebx
+{
+ 56b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 56e:	eb 27                	jmp    597 <gets+0x37>
+    cc = read(0, &c, 1);
+ 570:	83 ec 04             	sub    $0x4,%esp
+ 573:	6a 01                	push   $0x1
+ 575:	56                   	push   %esi
+ 576:	6a 00                	push   $0x0
+ 578:	e8 1e 01 00 00       	call   69b <read>
+    if(cc < 1)
+ 57d:	83 c4 10             	add    $0x10,%esp
+ 580:	85 c0                	test   %eax,%eax
+ 582:	7e 1d                	jle    5a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 584:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 588:	8b 55 08             	mov    0x8(%ebp),%edx
+ 58b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 58f:	3c 0a                	cmp    $0xa,%al
+ 591:	74 10                	je     5a3 <gets+0x43>
+ 593:	3c 0d                	cmp    $0xd,%al
+ 595:	74 0c                	je     5a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 597:	89 df                	mov    %ebx,%edi
+ 599:	83 c3 01             	add    $0x1,%ebx
+ 59c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 59f:	7c cf                	jl     570 <gets+0x10>
+ 5a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 5aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ad:	5b                   	pop    %ebx
+ 5ae:	5e                   	pop    %esi
+ 5af:	5f                   	pop    %edi
+ 5b0:	5d                   	pop    %ebp
+ 5b1:	c3                   	ret
+ 5b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	56                   	push   %esi
+ 5c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 5c5:	83 ec 08             	sub    $0x8,%esp
+ 5c8:	6a 00                	push   $0x0
+ 5ca:	ff 75 08             	push   0x8(%ebp)
+ 5cd:	e8 f1 00 00 00       	call   6c3 <open>
+  if(fd < 0)
+ 5d2:	83 c4 10             	add    $0x10,%esp
+ 5d5:	85 c0                	test   %eax,%eax
+ 5d7:	78 27                	js     600 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 5d9:	83 ec 08             	sub    $0x8,%esp
+ 5dc:	ff 75 0c             	push   0xc(%ebp)
+ 5df:	89 c3                	mov    %eax,%ebx
+ 5e1:	50                   	push   %eax
+ 5e2:	e8 f4 00 00 00       	call   6db <fstat>
+  close(fd);
+ 5e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 5ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 5ec:	e8 ba 00 00 00       	call   6ab <close>
+  return r;
+ 5f1:	83 c4 10             	add    $0x10,%esp
+}
+ 5f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5f7:	89 f0                	mov    %esi,%eax
+ 5f9:	5b                   	pop    %ebx
+ 5fa:	5e                   	pop    %esi
+ 5fb:	5d                   	pop    %ebp
+ 5fc:	c3                   	ret
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 600:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 605:	eb ed                	jmp    5f4 <stat+0x34>
+ 607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60e:	66 90                	xchg   %ax,%ax
+
+00000610 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	53                   	push   %ebx
+ 614:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 617:	0f be 02             	movsbl (%edx),%eax
+ 61a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 61d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 620:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 625:	77 1e                	ja     645 <atoi+0x35>
+ 627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 630:	83 c2 01             	add    $0x1,%edx
+ 633:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 636:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 63a:	0f be 02             	movsbl (%edx),%eax
+ 63d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 640:	80 fb 09             	cmp    $0x9,%bl
+ 643:	76 eb                	jbe    630 <atoi+0x20>
+  return n;
+}
+ 645:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 648:	89 c8                	mov    %ecx,%eax
+ 64a:	c9                   	leave
+ 64b:	c3                   	ret
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	8b 45 10             	mov    0x10(%ebp),%eax
+ 658:	8b 55 08             	mov    0x8(%ebp),%edx
+ 65b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 65e:	85 c0                	test   %eax,%eax
+ 660:	7e 13                	jle    675 <memmove+0x25>
+ 662:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 664:	89 d7                	mov    %edx,%edi
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 670:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 671:	39 f8                	cmp    %edi,%eax
+ 673:	75 fb                	jne    670 <memmove+0x20>
+  return vdst;
+}
+ 675:	5e                   	pop    %esi
+ 676:	89 d0                	mov    %edx,%eax
+ 678:	5f                   	pop    %edi
+ 679:	5d                   	pop    %ebp
+ 67a:	c3                   	ret
+
+0000067b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 67b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <exit>:
+SYSCALL(exit)
+ 683:	b8 02 00 00 00       	mov    $0x2,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <wait>:
+SYSCALL(wait)
+ 68b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <pipe>:
+SYSCALL(pipe)
+ 693:	b8 04 00 00 00       	mov    $0x4,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <read>:
+SYSCALL(read)
+ 69b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <write>:
+SYSCALL(write)
+ 6a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <close>:
+SYSCALL(close)
+ 6ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <kill>:
+SYSCALL(kill)
+ 6b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <exec>:
+SYSCALL(exec)
+ 6bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <open>:
+SYSCALL(open)
+ 6c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mknod>:
+SYSCALL(mknod)
+ 6cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <unlink>:
+SYSCALL(unlink)
+ 6d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <fstat>:
+SYSCALL(fstat)
+ 6db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <link>:
+SYSCALL(link)
+ 6e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <mkdir>:
+SYSCALL(mkdir)
+ 6eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <chdir>:
+SYSCALL(chdir)
+ 6f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <dup>:
+SYSCALL(dup)
+ 6fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <getpid>:
+SYSCALL(getpid)
+ 703:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <sbrk>:
+SYSCALL(sbrk)
+ 70b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <sleep>:
+SYSCALL(sleep)
+ 713:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <uptime>:
+SYSCALL(uptime)
+ 71b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <trace>:
+SYSCALL(trace)
+ 723:	b8 16 00 00 00       	mov    $0x16,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <assign_nice>:
+SYSCALL(assign_nice)
+ 72b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <readahead>:
+SYSCALL(readahead)
+ 733:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <dropcache>:
+SYSCALL(dropcache)
+ 73b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <tracedrain>:
+SYSCALL(tracedrain)
+ 743:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <settrace>:
+SYSCALL(settrace)
+ 74b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <tracestat>:
+ 753:	b8 21 00 00 00       	mov    $0x21,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+ 75b:	66 90                	xchg   %ax,%ax
+ 75d:	66 90                	xchg   %ax,%ax
+ 75f:	90                   	nop
+
+00000760 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	57                   	push   %edi
+ 764:	56                   	push   %esi
+ 765:	53                   	push   %ebx
+ 766:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 768:	89 d1                	mov    %edx,%ecx
+{
+ 76a:	83 ec 3c             	sub    $0x3c,%esp
+ 76d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 770:	85 d2                	test   %edx,%edx
+ 772:	0f 89 80 00 00 00    	jns    7f8 <printint+0x98>
+ 778:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 77c:	74 7a                	je     7f8 <printint+0x98>
+    x = -xx;
+ 77e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 780:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 785:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 788:	31 f6                	xor    %esi,%esi
+ 78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 790:	89 c8                	mov    %ecx,%eax
+ 792:	31 d2                	xor    %edx,%edx
+ 794:	89 f7                	mov    %esi,%edi
+ 796:	f7 f3                	div    %ebx
+ 798:	8d 76 01             	lea    0x1(%esi),%esi
+ 79b:	0f b6 92 e0 0b 00 00 	movzbl 0xbe0(%edx),%edx
+ 7a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7a6:	89 ca                	mov    %ecx,%edx
+ 7a8:	89 c1                	mov    %eax,%ecx
+ 7aa:	39 da                	cmp    %ebx,%edx
+ 7ac:	73 e2                	jae    790 <printint+0x30>
+  if(neg)
+ 7ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7b1:	85 c0                	test   %eax,%eax
+ 7b3:	74 07                	je     7bc <printint+0x5c>
+    buf[i++] = '-';
+ 7b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7ba:	89 f7                	mov    %esi,%edi
+ 7bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7c2:	01 df                	add    %ebx,%edi
+ 7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7cb:	83 ec 04             	sub    $0x4,%esp
+ 7ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7d4:	6a 01                	push   $0x1
+ 7d6:	50                   	push   %eax
+ 7d7:	56                   	push   %esi
+ 7d8:	e8 c6 fe ff ff       	call   6a3 <write>
+  while(--i >= 0)
+ 7dd:	89 f8                	mov    %edi,%eax
+ 7df:	83 c4 10             	add    $0x10,%esp
+ 7e2:	83 ef 01             	sub    $0x1,%edi
+ 7e5:	39 d8                	cmp    %ebx,%eax
+ 7e7:	75 df                	jne    7c8 <printint+0x68>
+}
+ 7e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ec:	5b                   	pop    %ebx
+ 7ed:	5e                   	pop    %esi
+ 7ee:	5f                   	pop    %edi
+ 7ef:	5d                   	pop    %ebp
+ 7f0:	c3                   	ret
+ 7f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7f8:	31 c0                	xor    %eax,%eax
+ 7fa:	eb 89                	jmp    785 <printint+0x25>
+ 7fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000800 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	57                   	push   %edi
+ 804:	56                   	push   %esi
+ 805:	53                   	push   %ebx
+ 806:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 809:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 80c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 80f:	0f b6 1e             	movzbl (%esi),%ebx
+ 812:	83 c6 01             	add    $0x1,%esi
+ 815:	84 db                	test   %bl,%bl
+ 817:	74 67                	je     880 <printf+0x80>
+ 819:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 81c:	31 d2                	xor    %edx,%edx
+ 81e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 821:	eb 34                	jmp    857 <printf+0x57>
+ 823:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 827:	90                   	nop
+ 828:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 82b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 830:	83 f8 25             	cmp    $0x25,%eax
+ 833:	74 18                	je     84d <printf+0x4d>
+  write(fd, &c, 1);
+ 835:	83 ec 04             	sub    $0x4,%esp
+ 838:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 83b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 83e:	6a 01                	push   $0x1
+ 840:	50                   	push   %eax
+ 841:	57                   	push   %edi
+ 842:	e8 5c fe ff ff       	call   6a3 <write>
+ 847:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 84a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 84d:	0f b6 1e             	movzbl (%esi),%ebx
+ 850:	83 c6 01             	add    $0x1,%esi
+ 853:	84 db                	test   %bl,%bl
+ 855:	74 29                	je     880 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 857:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 85a:	85 d2                	test   %edx,%edx
+ 85c:	74 ca                	je     828 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 85e:	83 fa 25             	cmp    $0x25,%edx
+ 861:	75 ea                	jne    84d <printf+0x4d>
+      if(c == 'd'){
+ 863:	83 f8 25             	cmp    $0x25,%eax
+ 866:	0f 84 24 01 00 00    	je     990 <printf+0x190>
+ 86c:	83 e8 63             	sub    $0x63,%eax
+ 86f:	83 f8 15             	cmp    $0x15,%eax
+ 872:	77 1c                	ja     890 <printf+0x90>
+ 874:	ff 24 85 88 0b 00 00 	jmp    *0xb88(,%eax,4)
+ 87b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 880:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 883:	5b                   	pop    %ebx
+ 884:	5e                   	pop    %esi
+ 885:	5f                   	pop    %edi
+ 886:	5d                   	pop    %ebp
+ 887:	c3                   	ret
+ 888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88f:	90                   	nop
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 896:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 89a:	6a 01                	push   $0x1
+ 89c:	52                   	push   %edx
+ 89d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8a0:	57                   	push   %edi
+ 8a1:	e8 fd fd ff ff       	call   6a3 <write>
+ 8a6:	83 c4 0c             	add    $0xc,%esp
+ 8a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ac:	6a 01                	push   $0x1
+ 8ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8b1:	52                   	push   %edx
+ 8b2:	57                   	push   %edi
+ 8b3:	e8 eb fd ff ff       	call   6a3 <write>
+        putc(fd, c);
+ 8b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8bb:	31 d2                	xor    %edx,%edx
+ 8bd:	eb 8e                	jmp    84d <printf+0x4d>
+ 8bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8cb:	8b 13                	mov    (%ebx),%edx
+ 8cd:	6a 00                	push   $0x0
+ 8cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8d4:	e8 87 fe ff ff       	call   760 <printint>
+        ap++;
+ 8d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8df:	31 d2                	xor    %edx,%edx
+ 8e1:	e9 67 ff ff ff       	jmp    84d <printf+0x4d>
+ 8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8f5:	83 c0 04             	add    $0x4,%eax
+ 8f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8fb:	85 db                	test   %ebx,%ebx
+ 8fd:	0f 84 9d 00 00 00    	je     9a0 <printf+0x1a0>
+        while(*s != 0){
+ 903:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 906:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 908:	84 c0                	test   %al,%al
+ 90a:	0f 84 3d ff ff ff    	je     84d <printf+0x4d>
+ 910:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 913:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 916:	89 de                	mov    %ebx,%esi
+ 918:	89 d3                	mov    %edx,%ebx
+ 91a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 920:	83 ec 04             	sub    $0x4,%esp
+ 923:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 926:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 929:	6a 01                	push   $0x1
+ 92b:	53                   	push   %ebx
+ 92c:	57                   	push   %edi
+ 92d:	e8 71 fd ff ff       	call   6a3 <write>
+        while(*s != 0){
+ 932:	0f b6 06             	movzbl (%esi),%eax
+ 935:	83 c4 10             	add    $0x10,%esp
+ 938:	84 c0                	test   %al,%al
+ 93a:	75 e4                	jne    920 <printf+0x120>
+      state = 0;
+ 93c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 93f:	31 d2                	xor    %edx,%edx
+ 941:	e9 07 ff ff ff       	jmp    84d <printf+0x4d>
+ 946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 950:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 953:	83 ec 0c             	sub    $0xc,%esp
+ 956:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 95b:	8b 13                	mov    (%ebx),%edx
+ 95d:	6a 01                	push   $0x1
+ 95f:	e9 6b ff ff ff       	jmp    8cf <printf+0xcf>
+ 964:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 968:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 96b:	83 ec 04             	sub    $0x4,%esp
+ 96e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 971:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 973:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 976:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 979:	6a 01                	push   $0x1
+ 97b:	52                   	push   %edx
+ 97c:	57                   	push   %edi
+ 97d:	e8 21 fd ff ff       	call   6a3 <write>
+        ap++;
+ 982:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 985:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 988:	31 d2                	xor    %edx,%edx
+ 98a:	e9 be fe ff ff       	jmp    84d <printf+0x4d>
+ 98f:	90                   	nop
+  write(fd, &c, 1);
+ 990:	83 ec 04             	sub    $0x4,%esp
+ 993:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 996:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 999:	6a 01                	push   $0x1
+ 99b:	e9 11 ff ff ff       	jmp    8b1 <printf+0xb1>
+ 9a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9a5:	bb 80 0b 00 00       	mov    $0xb80,%ebx
+ 9aa:	e9 61 ff ff ff       	jmp    910 <printf+0x110>
+ 9af:	90                   	nop
+
+000009b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9b1:	a1 60 17 00 00       	mov    0x1760,%eax
+{
+ 9b6:	89 e5                	mov    %esp,%ebp
+ 9b8:	57                   	push   %edi
+ 9b9:	56                   	push   %esi
+ 9ba:	53                   	push   %ebx
+ 9bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9cc:	39 ca                	cmp    %ecx,%edx
+ 9ce:	73 30                	jae    a00 <free+0x50>
+ 9d0:	39 c1                	cmp    %eax,%ecx
+ 9d2:	72 04                	jb     9d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9d4:	39 c2                	cmp    %eax,%edx
+ 9d6:	72 f0                	jb     9c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9de:	39 f8                	cmp    %edi,%eax
+ 9e0:	74 2e                	je     a10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9e5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9eb:	39 f1                	cmp    %esi,%ecx
+ 9ed:	74 38                	je     a27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9f1:	5b                   	pop    %ebx
+  freep = p;
+ 9f2:	89 15 60 17 00 00    	mov    %edx,0x1760
+}
+ 9f8:	5e                   	pop    %esi
+ 9f9:	5f                   	pop    %edi
+ 9fa:	5d                   	pop    %ebp
+ 9fb:	c3                   	ret
+ 9fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a00:	39 c1                	cmp    %eax,%ecx
+ a02:	72 d0                	jb     9d4 <free+0x24>
+ a04:	eb c2                	jmp    9c8 <free+0x18>
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a10:	03 70 04             	add    0x4(%eax),%esi
+ a13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a16:	8b 02                	mov    (%edx),%eax
+ a18:	8b 00                	mov    (%eax),%eax
+ a1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a1d:	8b 42 04             	mov    0x4(%edx),%eax
+ a20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a23:	39 f1                	cmp    %esi,%ecx
+ a25:	75 c8                	jne    9ef <free+0x3f>
+    p->s.size += bp->s.size;
+ a27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a2a:	89 15 60 17 00 00    	mov    %edx,0x1760
+    p->s.size += bp->s.size;
+ a30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a36:	89 0a                	mov    %ecx,(%edx)
+}
+ a38:	5b                   	pop    %ebx
+ a39:	5e                   	pop    %esi
+ a3a:	5f                   	pop    %edi
+ a3b:	5d                   	pop    %ebp
+ a3c:	c3                   	ret
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	57                   	push   %edi
+ a44:	56                   	push   %esi
+ a45:	53                   	push   %ebx
+ a46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a4c:	8b 15 60 17 00 00    	mov    0x1760,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a52:	8d 78 07             	lea    0x7(%eax),%edi
+ a55:	c1 ef 03             	shr    $0x3,%edi
+ a58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a5b:	85 d2                	test   %edx,%edx
+ a5d:	0f 84 8d 00 00 00    	je     af0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a65:	8b 48 04             	mov    0x4(%eax),%ecx
+ a68:	39 f9                	cmp    %edi,%ecx
+ a6a:	73 64                	jae    ad0 <malloc+0x90>
+  if(nu < 4096)
+ a6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a71:	39 df                	cmp    %ebx,%edi
+ a73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a7d:	eb 0a                	jmp    a89 <malloc+0x49>
+ a7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a82:	8b 48 04             	mov    0x4(%eax),%ecx
+ a85:	39 f9                	cmp    %edi,%ecx
+ a87:	73 47                	jae    ad0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a89:	89 c2                	mov    %eax,%edx
+ a8b:	39 05 60 17 00 00    	cmp    %eax,0x1760
+ a91:	75 ed                	jne    a80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a93:	83 ec 0c             	sub    $0xc,%esp
+ a96:	56                   	push   %esi
+ a97:	e8 6f fc ff ff       	call   70b <sbrk>
+  if(p == (char*)-1)
+ a9c:	83 c4 10             	add    $0x10,%esp
+ a9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ aa2:	74 1c                	je     ac0 <malloc+0x80>
+  hp->s.size = nu;
+ aa4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ aa7:	83 ec 0c             	sub    $0xc,%esp
+ aaa:	83 c0 08             	add    $0x8,%eax
+ aad:	50                   	push   %eax
+ aae:	e8 fd fe ff ff       	call   9b0 <free>
+  return freep;
+ ab3:	8b 15 60 17 00 00    	mov    0x1760,%edx
+      if((p = morecore(nunits)) == 0)
+ ab9:	83 c4 10             	add    $0x10,%esp
+ abc:	85 d2                	test   %edx,%edx
+ abe:	75 c0                	jne    a80 <malloc+0x40>
+        return 0;
+  }
+}
+ ac0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ac3:	31 c0                	xor    %eax,%eax
+}
+ ac5:	5b                   	pop    %ebx
+ ac6:	5e                   	pop    %esi
+ ac7:	5f                   	pop    %edi
+ ac8:	5d                   	pop    %ebp
+ ac9:	c3                   	ret
+ aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ad0:	39 cf                	cmp    %ecx,%edi
+ ad2:	74 4c                	je     b20 <malloc+0xe0>
+        p->s.size -= nunits;
+ ad4:	29 f9                	sub    %edi,%ecx
+ ad6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ad9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ adc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ adf:	89 15 60 17 00 00    	mov    %edx,0x1760
+}
+ ae5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ae8:	83 c0 08             	add    $0x8,%eax
+}
+ aeb:	5b                   	pop    %ebx
+ aec:	5e                   	pop    %esi
+ aed:	5f                   	pop    %edi
+ aee:	5d                   	pop    %ebp
+ aef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ af0:	c7 05 60 17 00 00 64 	movl   $0x1764,0x1760
+ af7:	17 00 00 
+    base.s.size = 0;
+ afa:	b8 64 17 00 00       	mov    $0x1764,%eax
+    base.s.ptr = freep = prevp = &base;
+ aff:	c7 05 64 17 00 00 64 	movl   $0x1764,0x1764
+ b06:	17 00 00 
+    base.s.size = 0;
+ b09:	c7 05 68 17 00 00 00 	movl   $0x0,0x1768
+ b10:	00 00 00 
+    if(p->s.size >= nunits){
+ b13:	e9 54 ff ff ff       	jmp    a6c <malloc+0x2c>
+ b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b20:	8b 08                	mov    (%eax),%ecx
+ b22:	89 0a                	mov    %ecx,(%edx)
+ b24:	eb b9                	jmp    adf <malloc+0x9f>
@@ -0,0 +1,122 @@
+// Print the kernel's event counters, from /dev/stats.
+//
+//   vmstat                   counters of each CPU, and their total
+//   vmstat secs [count]      every secs seconds, count times or
+//                            for ever, the events in that time
+//                            summed over the CPUs
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define MAXSTAT 16
+
+char buf[2048];
+
+// Read /dev/stats into buf.  Returns its length, or -1.
+int
+readstats(void)
+{
+  int fd, n, m;
+
+  if((fd = open("/dev/stats", O_RDONLY)) < 0)
+    return -1;
+  n = 0;
+  while(n < sizeof(buf) - 1 && (m = read(fd, buf + n, sizeof(buf) - 1 - n)) > 0)
+    n += m;
+  close(fd);
+  buf[n] = 0;
+  return n;
+}
+
+// Add up the counters of all the CPUs in buf into total.
+// Returns the number of counters.
+int
+sumstats(uint *total)
+{
+  char *p;
+  int i;
+
+  memset(total, 0, MAXSTAT*sizeof(total[0]));
+  p = strchr(buf, '\n');   // skip the names
+  while(p && *++p){
+    // A CPU's number, then its counters, separated by tabs.
+    for(i = -1; ; i++){
+      if(i >= 0 && i < MAXSTAT)
+        total[i] += atoi(p);
+      while(*p && *p != '\t' && *p != '\n')
+        p++;
+      if(*p != '\t')
+        break;
+      p++;
+    }
+    if(*p == 0)
+      break;
+  }
+  for(i = 0, p = buf; *p && *p != '\n'; p++)
+    if(*p == '\t')
+      i++;
+  return i < MAXSTAT ? i : MAXSTAT;
+}
+
+// Print buf's line of counter names, leaving out the first.
+void
+printnames(void)
+{
+  char *p;
+
+  for(p = strchr(buf, '\t') + 1; *p && *p != '\n'; p++)
+    printf(1, "%c", *p);
+  printf(1, "\n");
+}
+
+void
+printstats(uint *st, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    printf(1, i ? "\t%d" : "%d", st[i]);
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint last[MAXSTAT], now[MAXSTAT], diff[MAXSTAT];
+  int i, n, secs, count;
+
+  if(readstats() < 0){
+    printf(2, "vmstat: cannot read /dev/stats\n");
+    exit();
+  }
+  n = sumstats(last);
+
+  if(argc < 2){
+    printf(1, "%s", buf);
+    printf(1, "all\t");
+    printstats(last, n);
+    exit();
+  }
+
+  secs = atoi(argv[1]);
+  count = argc > 2 ? atoi(argv[2]) : -1;
+  if(secs <= 0){
+    printf(2, "usage: vmstat [secs [count]]\n");
+    exit();
+  }
+  printnames();
+  while(count < 0 || count-- > 0){
+    sleep(secs * 100);  // 100 ticks a second
+    if(readstats() < 0)
+      break;
+    sumstats(now);
+    for(i = 0; i < n; i++){
+      diff[i] = now[i] - last[i];
+      last[i] = now[i];
+    }
+    printstats(diff, n);
+  }
+  exit();
+}